@@ -35,6 +35,16 @@ macro(global_set_flags)
         add_definitions(-DEASYLOGGINGPP_ASYNC)
     endif()
 
+    # Same order as rs2_log_severity
+    set(LRS_LOG_SEVERITIES DEBUG INFO WARN ERROR FATAL NONE)
+    string(TOUPPER "${LOG_MIN_SEVERITY}" LRS_LOG_MIN_SEVERITY)
+    list(FIND LRS_LOG_SEVERITIES "${LRS_LOG_MIN_SEVERITY}" LRS_LOG_MIN_SEVERITY)
+    if (LRS_LOG_MIN_SEVERITY LESS 0)
+        message(FATAL_ERROR "LOG_MIN_SEVERITY must be one of DEBUG, INFO, WARN, ERROR, FATAL or NONE; got '${LOG_MIN_SEVERITY}'")
+    elseif (LRS_LOG_MIN_SEVERITY GREATER 0)
+        add_definitions(-DLRS_LOG_MIN_SEVERITY=${LRS_LOG_MIN_SEVERITY})
+    endif()
+
     if(TRACE_API)
         add_definitions(-DTRACE_API)
     endif()
@@ -55,6 +65,10 @@ macro(global_set_flags)
         add_definitions(-DRS2_USE_CUDA)
     endif()
 
+    if (BUILD_FIXED_RESOLUTION_UNPACKERS)
+        add_definitions(-DRS2_FIXED_RESOLUTION_UNPACK)
+    endif()
+
     if (BUILD_SHARED_LIBS)
         add_definitions(-DBUILD_SHARED_LIBS)
     endif()
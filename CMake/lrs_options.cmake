@@ -1,7 +1,10 @@
 option(ENABLE_CCACHE "Build with ccache." ON)
 option(BUILD_WITH_CUDA "Enable CUDA" OFF)
 option(BUILD_GLSL_EXTENSIONS "Build GLSL extensions API" ON)
+option(BUILD_GL_HEADLESS "Allow GLSL processing on a headless EGL context (Linux only; requires libEGL)" OFF)
 option(BUILD_WITH_OPENMP "Use OpenMP" OFF)
+option(BUILD_FIXED_RESOLUTION_UNPACKERS "Compile the interleaved IR unpackers separately for the most common resolutions (larger binary)" OFF)
+option(BUILD_WITH_TURBOJPEG "Decode MJPEG color streams with libjpeg-turbo (requires libturbojpeg)" OFF)
 option(BUILD_EASYLOGGINGPP "Build EasyLogging++ as a part of the build" ON)
 option(BUILD_WITH_STATIC_CRT "Build with static link CRT" ON)
 option(HWM_OVER_XU "Send HWM commands over UVC XU control" ON)
@@ -45,6 +48,8 @@ if(UNIX AND (NOT ANDROID_NDK_TOOLCHAIN_INCLUDED))
 else()
     option(ENABLE_EASYLOGGINGPP_ASYNC "Switch Logger to Asynchronous Mode (set OFF for Synchronous Mode)" OFF)
 endif()
+set(LOG_MIN_SEVERITY "DEBUG" CACHE STRING "Log macros below this severity (DEBUG, INFO, WARN, ERROR, FATAL or NONE) compile to nothing")
+set_property(CACHE LOG_MIN_SEVERITY PROPERTY STRINGS DEBUG INFO WARN ERROR FATAL NONE)
 option(BUILD_PC_STITCHING "Build pointcloud-stitching example" OFF)
 option(BUILD_WITH_DDS "Access camera devices through DDS topics (requires CMake 3.16.3)" OFF)
 option(BUILD_RS2_ALL "Build realsense2-all static bundle containing all realsense libraries (with BUILD_SHARED_LIBS=OFF)" ON)
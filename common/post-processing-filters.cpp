@@ -89,6 +89,7 @@ void post_processing_filters::zero_first_pixel(const rs2::frame& f)
 
 void post_processing_filters::map_id(rs2::frame new_frame, rs2::frame old_frame)
 {
+    std::lock_guard<std::mutex> lock(map_id_mutex);
     if (auto new_set = new_frame.as<rs2::frameset>())
     {
         if (auto old_set = old_frame.as<rs2::frameset>())
@@ -241,30 +242,134 @@ void post_processing_filters::render_loop()
         {
             if (viewer.synchronization_enable)
             {
+                stop_stream_workers();
+
                 auto frames = viewer.syncer->try_wait_for_frames();
                 for (auto f : frames)
                 {
+                    auto started = std::chrono::high_resolution_clock::now();
                     processing_block.invoke(f);
+                    auto duration = std::chrono::high_resolution_clock::now() - started;
+                    record_processing_time(f, std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
                 }
             }
             else
             {
-                std::map<int, rs2::frame_queue> frames_queue_local;
-                {
-                    std::lock_guard<std::mutex> lock(viewer.streams_mutex);
-                    frames_queue_local = frames_queue;
-                }
-                for (auto&& q : frames_queue_local)
+                update_stream_workers();
+                std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            }
+        }
+        catch (...) {}
+    }
+    stop_stream_workers();
+}
+
+post_processing_filters::stream_worker::stream_worker(post_processing_filters& owner,
+                                                      rs2::frame_queue input,
+                                                      std::shared_ptr<duration_average> time)
+    : results(1),
+      block([&owner](rs2::frame f, const rs2::frame_source& source)
+          {
+              owner.process(std::move(f), source);
+          }),
+      active(true)
+{
+    block.start(results);
+    thread = std::thread([this, input, time]() mutable
+        {
+            while (active)
+            {
+                try
                 {
-                    frame frm;
-                    if (q.second.try_wait_for_frame(&frm, 30))
+                    frame f;
+                    if (input.try_wait_for_frame(&f, 30))
                     {
-                        processing_block.invoke(frm);
+                        scoped_duration measure(*time);
+                        block.invoke(f);
                     }
                 }
+                catch (...) {}
+            }
+        });
+}
+
+post_processing_filters::stream_worker::~stream_worker()
+{
+    active = false;
+    thread.join();
+}
+
+void post_processing_filters::update_stream_workers()
+{
+    std::map<int, rs2::frame_queue> frames_queue_local;
+    {
+        std::lock_guard<std::mutex> lock(viewer.streams_mutex);
+        frames_queue_local = frames_queue;
+    }
+
+    // Workers are joined outside the lock, not to hold up the renderer
+    std::vector<std::shared_ptr<stream_worker>> stopped;
+    {
+        std::lock_guard<std::mutex> lock(workers_mutex);
+        for (auto it = workers.begin(); it != workers.end();)
+        {
+            if (frames_queue_local.find(it->first) == frames_queue_local.end())
+            {
+                stopped.push_back(it->second);
+                it = workers.erase(it);
             }
+            else
+                ++it;
+        }
+        for (auto&& q : frames_queue_local)
+        {
+            if (workers.find(q.first) == workers.end())
+                workers[q.first] = std::make_shared<stream_worker>(*this, q.second, get_processing_time(q.first));
         }
-        catch (...) {}
     }
 }
 
+void post_processing_filters::stop_stream_workers()
+{
+    std::map<int, std::shared_ptr<stream_worker>> stopped;
+    {
+        std::lock_guard<std::mutex> lock(workers_mutex);
+        std::swap(stopped, workers);
+    }
+}
+
+void post_processing_filters::get_ready_frames(std::vector<rs2::frame>& frames)
+{
+    frame f;
+    size_t index = 0;
+    while (index++ < resulting_queue_max_size && resulting_queue.poll_for_frame(&f))
+        frames.push_back(f);
+
+    std::lock_guard<std::mutex> lock(workers_mutex);
+    for (auto&& w : workers)
+    {
+        if (w.second->results.poll_for_frame(&f))
+            frames.push_back(f);
+    }
+}
+
+std::shared_ptr<duration_average> post_processing_filters::get_processing_time(int stream_id)
+{
+    std::lock_guard<std::mutex> lock(processing_times_mutex);
+    auto& time = processing_times[stream_id];
+    if (!time)
+        time = std::make_shared<duration_average>();
+    return time;
+}
+
+// A frameset is processed as a whole: its time is that of each of the streams in it
+void post_processing_filters::record_processing_time(const rs2::frame& f, long long usec)
+{
+    if (auto composite = f.as<rs2::frameset>())
+    {
+        for (auto&& sf : composite)
+            get_processing_time(sf.get_profile().unique_id())->record(usec);
+    }
+    else
+        get_processing_time(f.get_profile().unique_id())->record(usec);
+}
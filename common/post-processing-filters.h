@@ -7,7 +7,9 @@
 #include <string>
 #include <map>
 #include <thread>
+#include <mutex>
 #include "opengl3.h"
+#include "tiny-profiler.h"
 #include <GLFW/glfw3.h>
 
 
@@ -73,6 +75,13 @@ namespace rs2
                     while (resulting_queue.poll_for_frame(&f));
                 }
 
+                /* Adds the frames processed since the last call: all those of the synchronized streams (up to
+                   resulting_queue_max_size), and the latest of each stream processed on its own */
+                void get_ready_frames(std::vector<rs2::frame>& frames);
+
+                /* How long the frames of a stream take to process, by its unique id */
+                std::shared_ptr<duration_average> get_processing_time(int stream_id);
+
                 std::atomic<bool> depth_stream_active;
 
                 const size_t resulting_queue_max_size;
@@ -96,6 +105,8 @@ namespace rs2
         std::shared_ptr<subdevice_model> get_frame_origin(const rs2::frame& f);
 
         void zero_first_pixel(const rs2::frame& f);
+        void record_processing_time(const rs2::frame& f, long long usec);
+        std::mutex map_id_mutex;                // process() runs on the stream workers concurrently
         rs2::frame last_tex_frame;
         rs2::processing_block processing_block;
         std::shared_ptr<pointcloud> pc;
@@ -108,6 +119,28 @@ namespace rs2
         std::shared_ptr<std::thread> render_thread;              // Post processing filter rendering Thread running render_loop()
         void render_loop();                     // Post processing filter rendering function
 
+        /* When frames are not synchronized, each stream is processed on a thread of its own, so that a stream with
+           heavy filters does not hold back the others. The renderer only takes the latest result of each. */
+        class stream_worker
+        {
+        public:
+            stream_worker(post_processing_filters& owner, rs2::frame_queue input, std::shared_ptr<duration_average> time);
+            ~stream_worker();
+
+            rs2::frame_queue results;           // Holds just the latest result
+        private:
+            rs2::processing_block block;
+            std::atomic<bool> active;
+            std::thread thread;
+        };
+        std::map<int, std::shared_ptr<stream_worker>> workers;
+        std::mutex workers_mutex;
+        void update_stream_workers();           // Starts workers for new streams and stops those of closed ones
+        void stop_stream_workers();
+
+        std::map<int, std::shared_ptr<duration_average>> processing_times;
+        std::mutex processing_times_mutex;
+
         std::shared_ptr<gl::uploader> uploader; // GL element that helps pre-emptively copy frames to the GPU
     };
 }
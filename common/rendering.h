@@ -384,6 +384,82 @@ namespace rs2
         GLuint texture;
         rs2::frame_queue last_queue[2];
         mutable rs2::frame last[2];
+
+        // Format and size the texture storage was last allocated with
+        GLint allocated_format = 0;
+        int allocated_width = 0;
+        int allocated_height = 0;
+
+        // Pixel buffers the frames are staged in, used in turns
+        GLuint pbo[2] = {};
+        size_t pbo_size[2] = {};
+        int next_pbo = 0;
+
+        // Bytes glTexSubImage2D reads for a w x h image, rows starting on 4-byte boundaries (GL_UNPACK_ALIGNMENT)
+        static size_t image_size(int w, int h, GLenum format, GLenum type)
+        {
+            size_t components = 1;
+            switch (format)
+            {
+            case GL_RG: case GL_LUMINANCE_ALPHA: components = 2; break;
+            case GL_RGB: components = 3; break;
+            case GL_RGBA: components = 4; break;
+            }
+            size_t component_size = type == GL_FLOAT ? 4 : type == GL_UNSIGNED_SHORT ? 2 : 1;
+            size_t row = w * components * component_size;
+            size_t aligned_row = (row + 3) & ~size_t(3);
+            return h > 0 ? aligned_row * (h - 1) + row : 0;
+        }
+
+        // Uploads an image to the bound texture. Its storage is only allocated again when the format or size of the
+        // images changes; otherwise the pixels are written over the existing ones. When the context has
+        // glMapBufferRange (GL 3.0), they are staged in a pixel buffer, so that the copy to the GPU is done by the driver
+        // while the previous frame is still being rendered, and the buffer is invalidated first rather than waited for.
+        void upload_texture(GLint internal_format, int w, int h, GLenum format, GLenum type, const void* data)
+        {
+            if (internal_format != allocated_format || w != allocated_width || h != allocated_height)
+            {
+                glTexImage2D(GL_TEXTURE_2D, 0, internal_format, w, h, 0, format, type, nullptr);
+                allocated_format = internal_format;
+                allocated_width = w;
+                allocated_height = h;
+            }
+
+            // GPU frames have no pixels to upload
+            if (!data || w <= 0 || h <= 0)
+                return;
+
+            if (GLAD_GL_VERSION_3_0)
+            {
+                if (!pbo[0])
+                    glGenBuffers(2, pbo);
+
+                auto size = image_size(w, h, format, type);
+                auto i = next_pbo;
+                next_pbo = 1 - next_pbo;
+
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo[i]);
+                if (size > pbo_size[i])
+                {
+                    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+                    pbo_size[i] = size;
+                }
+                if (auto staging = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT))
+                {
+                    memcpy(staging, data, size);
+                    // Unmapping fails when the contents were lost (e.g., on a mode switch); upload directly then
+                    if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER))
+                    {
+                        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, format, type, nullptr);
+                        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                        return;
+                    }
+                }
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            }
+
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, format, type, data);
+        }
     public:
         std::shared_ptr<colorizer> colorize;
         std::shared_ptr<yuy_decoder> yuy2rgb;
@@ -394,12 +470,15 @@ namespace rs2
 
         texture_buffer(const texture_buffer& other)
         {
-            texture = other.texture;
+            *this = other;
         }
 
         texture_buffer& operator=(const texture_buffer& other)
         {
             texture = other.texture;
+            allocated_format = other.allocated_format;
+            allocated_width = other.allocated_width;
+            allocated_height = other.allocated_height;
             return *this;
         }
 
@@ -484,13 +563,13 @@ namespace rs2
                     {
                         // Upload vertices
                         data = pc.get_vertices();
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, width, height, 0, GL_RGB, GL_FLOAT, data);
+                        upload_texture(GL_RGB16F, width, height, GL_RGB, GL_FLOAT, data);
                     }
                     else
                     {
                         // Upload texture coordinates
                         data = pc.get_texture_coordinates();
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RG16F, width, height, 0, GL_RG, GL_FLOAT, data);
+                        upload_texture(GL_RG16F, width, height, GL_RG, GL_FLOAT, data);
                     }
 
                     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
@@ -518,11 +597,11 @@ namespace rs2
                     {
                         if (prefered_format == RS2_FORMAT_Z16)
                         {
-                            glTexImage2D(GL_TEXTURE_2D, 0, GL_RG8, width, height, 0, GL_RG, GL_UNSIGNED_BYTE, data);
+                            upload_texture(GL_RG8, width, height, GL_RG, GL_UNSIGNED_BYTE, data);
                         }
                         else if (prefered_format == RS2_FORMAT_DISPARITY32)
                         {
-                            glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, width, height, 0, GL_RED, GL_FLOAT, data);
+                            upload_texture(GL_R32F, width, height, GL_RED, GL_FLOAT, data);
                         }
                         else
                         {
@@ -532,24 +611,20 @@ namespace rs2
                                 {
                                     data = colorized_frame.get_data();
 
-                                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB,
-                                        colorized_frame.get_width(),
-                                        colorized_frame.get_height(),
-                                        0, GL_RGB, GL_UNSIGNED_BYTE,
-                                        data);
+                                    upload_texture(GL_RGB, colorized_frame.get_width(), colorized_frame.get_height(), GL_RGB, GL_UNSIGNED_BYTE, data);
 
                                 }
                                 rendered_frame = colorized_frame;
                             }
                         }
                     }
-                    else glTexImage2D(GL_TEXTURE_2D, 0, GL_RG8, width, height, 0, GL_RG, GL_UNSIGNED_BYTE, data);
+                    else upload_texture(GL_RG8, width, height, GL_RG, GL_UNSIGNED_BYTE, data);
                     break;
                 case RS2_FORMAT_FG:
-                    glTexImage2D( GL_TEXTURE_2D, 0, GL_LUMINANCE, width, height, 0, GL_LUMINANCE, GL_UNSIGNED_SHORT, data);
+                    upload_texture(GL_LUMINANCE, width, height, GL_LUMINANCE, GL_UNSIGNED_SHORT, data);
                     break;
                 case RS2_FORMAT_XYZ32F:
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_FLOAT, data);
+                    upload_texture(GL_RGB, width, height, GL_RGB, GL_FLOAT, data);
                     break;
                 case RS2_FORMAT_YUYV:
                     if (yuy2rgb)
@@ -561,18 +636,14 @@ namespace rs2
                                 glBindTexture(GL_TEXTURE_2D, texture);
                                 data = colorized_frame.get_data();
 
-                                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB,
-                                    colorized_frame.get_width(),
-                                    colorized_frame.get_height(),
-                                    0, GL_RGB, GL_UNSIGNED_BYTE,
-                                    colorized_frame.get_data());
+                                upload_texture(GL_RGB, colorized_frame.get_width(), colorized_frame.get_height(), GL_RGB, GL_UNSIGNED_BYTE, colorized_frame.get_data());
                             }
                             rendered_frame = colorized_frame;
                         }
                     }
                     else
                     {
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, data);
+                        upload_texture(GL_RGB, width, height, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, data);
                     }
                     break;
                 case RS2_FORMAT_Y411:
@@ -585,31 +656,27 @@ namespace rs2
                                 glBindTexture(GL_TEXTURE_2D, texture);
                                 data = colorized_frame.get_data();
 
-                                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB,
-                                    colorized_frame.get_width(),
-                                    colorized_frame.get_height(),
-                                    0, GL_RGB, GL_UNSIGNED_BYTE,
-                                    colorized_frame.get_data());
+                                upload_texture(GL_RGB, colorized_frame.get_width(), colorized_frame.get_height(), GL_RGB, GL_UNSIGNED_BYTE, colorized_frame.get_data());
                             }
                             rendered_frame = colorized_frame;
                         }
                     }
                     else
                     {
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, data);
+                        upload_texture(GL_RGB, width, height, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, data);
                     }
                     break;
                 case RS2_FORMAT_UYVY: // Use luminance component only to avoid costly UVUY->RGB conversion
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, width, height, 0, GL_LUMINANCE, GL_UNSIGNED_SHORT, data);
+                    upload_texture(GL_LUMINANCE, width, height, GL_LUMINANCE, GL_UNSIGNED_SHORT, data);
                     break;
                 case RS2_FORMAT_RGB8: case RS2_FORMAT_BGR8: // Display both RGB and BGR by interpreting them RGB, to show the flipped byte ordering. Obviously, GL_BGR could be used on OpenGL 1.2+
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
+                    upload_texture(GL_RGB, width, height, GL_RGB, GL_UNSIGNED_BYTE, data);
                     break;
                 case RS2_FORMAT_RGBA8: case RS2_FORMAT_BGRA8: // Display both RGBA and BGRA by interpreting them RGBA, to show the flipped byte ordering. Obviously, GL_BGRA could be used on OpenGL 1.2+
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+                    upload_texture(GL_RGBA, width, height, GL_RGBA, GL_UNSIGNED_BYTE, data);
                     break;
                 case RS2_FORMAT_Y8:
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, data);
+                    upload_texture(GL_RGB, width, height, GL_LUMINANCE, GL_UNSIGNED_BYTE, data);
                     break;
                 case RS2_FORMAT_MOTION_XYZ32F:
                 {
@@ -638,12 +705,12 @@ namespace rs2
                 }
                 case RS2_FORMAT_Y16:
                 case RS2_FORMAT_Y10BPACK:
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_LUMINANCE, GL_UNSIGNED_SHORT, data);
+                    upload_texture(GL_RGB, width, height, GL_LUMINANCE, GL_UNSIGNED_SHORT, data);
                     break;
                 case RS2_FORMAT_RAW8:
                 case RS2_FORMAT_MOTION_RAW:
                 case RS2_FORMAT_GPIO_RAW:
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, width, height, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, data);
+                    upload_texture(GL_LUMINANCE, width, height, GL_LUMINANCE, GL_UNSIGNED_BYTE, data);
                     break;
                 case RS2_FORMAT_6DOF:
                 {
@@ -680,7 +747,7 @@ namespace rs2
                 default:
                 {
                     memset((void*)data, 0, height*width);
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_LUMINANCE, width, height, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, data);
+                    upload_texture(GL_LUMINANCE, width, height, GL_LUMINANCE, GL_UNSIGNED_BYTE, data);
                 }
                 }
 
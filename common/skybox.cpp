@@ -24,24 +24,54 @@ skybox::skybox()
     minus_z = nullptr;
 }
 
+void skybox::preload()
+{
+    if (_faces.valid())
+        return;
+
+    // Decoding the PNGs takes long enough to be felt if done when the 3D view first shows
+    _faces = std::async(std::launch::async, []() {
+        std::vector<face> faces;
+        auto decode = [&](const uint8_t* buff, int length) {
+            face f;
+            int comp;
+            if (auto data = stbi_load_from_memory(buff, length, &f.width, &f.height, &comp, 3))
+            {
+                f.rgb.assign(data, data + size_t(f.width) * f.height * 3);
+                stbi_image_free(data);
+            }
+            faces.push_back(std::move(f));
+        };
+        decode(cubemap_pz_png_data, cubemap_pz_png_size);
+        decode(cubemap_nz_png_data, cubemap_nz_png_size);
+        decode(cubemap_nx_png_data, cubemap_nx_png_size);
+        decode(cubemap_px_png_data, cubemap_px_png_size);
+        decode(cubemap_py_png_data, cubemap_py_png_size);
+        decode(cubemap_ny_png_data, cubemap_ny_png_size);
+        return faces;
+    }).share();
+}
+
 void skybox::render(rs2::float3 cam_position)
 {
-    auto init = [](const uint8_t* buff, int length, std::shared_ptr<rs2::texture_buffer>& tex){
-        if (tex) tex.reset();
-        tex = std::make_shared<rs2::texture_buffer>();
-        int x, y, comp;
-        auto data = stbi_load_from_memory(buff, length, &x, &y, &comp, 3);
-        tex->upload_image(x, y, data, GL_RGB);
-        stbi_image_free(data);
-    };
     if (!initialized)
     {
-        init(cubemap_pz_png_data, cubemap_pz_png_size, plus_z);
-        init(cubemap_nz_png_data, cubemap_nz_png_size, minus_z);
-        init(cubemap_nx_png_data, cubemap_nx_png_size, minus_x);
-        init(cubemap_px_png_data, cubemap_px_png_size, plus_x);
-        init(cubemap_py_png_data, cubemap_py_png_size, plus_y);
-        init(cubemap_ny_png_data, cubemap_ny_png_size, minus_y);
+        preload();
+        if (_faces.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return;
+
+        auto& faces = _faces.get();
+        auto init = [](const face& f, std::shared_ptr<rs2::texture_buffer>& tex){
+            if (tex) tex.reset();
+            tex = std::make_shared<rs2::texture_buffer>();
+            tex->upload_image(f.width, f.height, (void*)f.rgb.data(), GL_RGB);
+        };
+        init(faces[0], plus_z);
+        init(faces[1], minus_z);
+        init(faces[2], minus_x);
+        init(faces[3], plus_x);
+        init(faces[4], plus_y);
+        init(faces[5], minus_y);
         initialized = true;
     }
     glEnable(GL_TEXTURE_2D);
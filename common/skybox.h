@@ -4,7 +4,10 @@
 #pragma once
 
 #include "float3.h"
+#include <cstdint>
+#include <future>
 #include <memory>  // shared_ptr
+#include <vector>
 
 namespace rs2 {
     class texture_buffer;
@@ -14,10 +17,21 @@ class skybox
 {
 public:
     skybox();
+    // Starts decoding the faces in the background, if not already; render() draws nothing until they are decoded
+    void preload();
     void render(rs2::float3 cam_position);
+    // The textures are uploaded again, from the faces already decoded
     void reset() { initialized = false; }
 
 private:
+    struct face
+    {
+        int width = 0, height = 0;
+        std::vector< uint8_t > rgb;
+    };
+    std::shared_future< std::vector< face > > _faces;  // +z, -z, -x, +x, +y, -y
+
+
     std::shared_ptr<rs2::texture_buffer> plus_x, minus_x;
     std::shared_ptr<rs2::texture_buffer> plus_y, minus_y;
     std::shared_ptr<rs2::texture_buffer> plus_z, minus_z;
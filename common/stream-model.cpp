@@ -860,6 +860,51 @@ namespace rs2
               "Viewer FPS captures how many frames the application manages to render.\n"
               "Frame drops can occur for variety of reasons." } );
 
+        if( processing_time && processing_time->usec() >= 0 )
+            stream_details.push_back(
+                { "Processing Time",
+                  rsutils::string::from() << std::setprecision( 2 ) << std::fixed
+                                          << processing_time->usec() / 1000.0 << " ms",
+                  "Processing Time is how long post-processing (filters, point-cloud) takes per frame,\n"
+                  "on average. Each stream is processed on a thread of its own unless streams are synchronized,\n"
+                  "in which case the time is that of the whole frameset." } );
+
+        auto const drops = profile.get_frame_drops();
+        unsigned long long total_drops = 0;
+        std::string drops_by_stage;
+        for( int stage = 0; stage < RS2_FRAME_DROP_STAGE_COUNT; ++stage )
+        {
+            if( ! drops.dropped[stage] )
+                continue;
+            total_drops += drops.dropped[stage];
+            drops_by_stage += ( rsutils::string::from()
+                                << ( drops_by_stage.empty() ? " (" : ", " )
+                                << rs2_frame_drop_stage_to_string( rs2_frame_drop_stage( stage ) ) << " "
+                                << drops.dropped[stage] ).str();
+        }
+        if( drops.decimated )
+            drops_by_stage += ( rsutils::string::from()
+                                << ( drops_by_stage.empty() ? " (" : ", " ) << drops.decimated
+                                << " decimated instead, at scale " << drops.decimation_scale ).str();
+        if( drops.latency_cutoffs )
+            drops_by_stage += ( rsutils::string::from()
+                                << ( drops_by_stage.empty() ? " (" : ", " ) << drops.latency_cutoffs
+                                << " framesets went without it, at max latency" ).str();
+        if( ! drops_by_stage.empty() )
+            drops_by_stage += ")";
+        stream_details.push_back(
+            { "Dropped Frames",
+              rsutils::string::from() << total_drops << drops_by_stage,
+              "Frames of this stream dropped since the library was loaded, by where they were dropped:\n"
+              "Backend - never reached the sensor (frame counter gaps)\n"
+              "Archive - too many frames held by the application\n"
+              "Syncer Inbox / Syncer - frames arrived faster than they could be matched\n"
+              "Frame Queue - frames were not dequeued by the application in time\n"
+              "Recorder - frames could not be written to the file in time\n"
+              "Metadata Sync - no metadata buffer could be paired with the frame, in the backend\n"
+              "Frames that adaptive decimation decimated further, rather than have them dropped, are counted apart,\n"
+              "as are framesets the syncer released without this stream, not to wait past its max latency" } );
+
         stream_details.push_back( { "", "", "" } );
     }
 
@@ -5,6 +5,7 @@
 
 #include "rect.h"
 #include "rendering.h"
+#include "tiny-profiler.h"
 #include <imgui.h>
 #include "reflectivity/reflectivity.h"
 #include <rsutils/number/stabilized-value.h>
@@ -79,6 +80,7 @@ namespace rs2
         unsigned long long  frame_number = 0;
         rs2_timestamp_domain timestamp_domain = RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME;
         fps_calc            fps, view_fps;
+        std::shared_ptr<duration_average> processing_time;  // Of the post-processing, updated by its worker
         int                 count = 0;
         rect                roi_display_rect{};
         float               roi_percentage = 0.4f;
@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <chrono>
 #include <iostream>
+#include <atomic>
 #include <cstring> // strlen
 
 class scoped_timer
@@ -93,3 +94,52 @@ private:
     std::chrono::high_resolution_clock::time_point _started;
     const char* key;
 };
+
+// Average duration of some repeated work, over periods of a second, for showing next to what the work is done for
+// rather than printing. Durations are recorded on one thread, and the average can be read on any.
+class duration_average
+{
+public:
+    void record(long long usec)
+    {
+        _sum += usec;
+        _count++;
+
+        auto now = std::chrono::high_resolution_clock::now();
+        if (now - _period_started >= std::chrono::seconds(1))
+        {
+            _average = _sum / _count;
+            _sum = 0;
+            _count = 0;
+            _period_started = now;
+        }
+    }
+
+    // Negative until the first period is over
+    long long usec() const { return _average; }
+
+private:
+    long long _sum = 0;
+    long long _count = 0;
+    std::chrono::high_resolution_clock::time_point _period_started = std::chrono::high_resolution_clock::now();
+    std::atomic<long long> _average{ -1 };
+};
+
+class scoped_duration
+{
+public:
+    scoped_duration(duration_average& average)
+        : _average(average), _started(std::chrono::high_resolution_clock::now())
+    {
+    }
+
+    ~scoped_duration()
+    {
+        auto duration = std::chrono::high_resolution_clock::now() - _started;
+        _average.record(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+    }
+
+private:
+    duration_average& _average;
+    std::chrono::high_resolution_clock::time_point _started;
+};
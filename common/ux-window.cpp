@@ -184,35 +184,40 @@ namespace rs2
 
     void ux_window::setup_icon()
     {
-        GLFWimage icon[4];
-
-        int x, y, comp;
-
-        auto icon_16 = stbi_load_from_memory(icon_16_png_data, (int)icon_16_png_size, &x, &y, &comp, false);
-        icon[0].width = x; icon[0].height = y;
-        icon[0].pixels = icon_16;
-
-        auto icon_24 = stbi_load_from_memory(icon_24_png_data, (int)icon_24_png_size, &x, &y, &comp, false);
-        icon[1].width = x; icon[1].height = y;
-        icon[1].pixels = icon_24;
-
-        auto icon_64 = stbi_load_from_memory(icon_64_png_data, (int)icon_64_png_size, &x, &y, &comp, false);
-        icon[2].width = x; icon[2].height = y;
-        icon[2].pixels = icon_64;
-
-        auto icon_256 = stbi_load_from_memory(icon_256_png_data, (int)icon_256_png_size, &x, &y, &comp, false);
-        icon[3].width = x; icon[3].height = y;
-        icon[3].pixels = icon_256;
-
-        glfwSetWindowIcon(_win, 4, icon);
+        // Decoded in the background after the first frame (see load_icons); until then, the window has the default
+        if (_icons.empty())
+            return;
+
+        std::vector<GLFWimage> images;
+        for (auto& icon : _icons)
+            images.push_back({ icon.width, icon.height, icon.pixels.get() });
+        glfwSetWindowIcon(_win, (int)images.size(), images.data());
+    }
 
-        stbi_image_free(icon_16);
-        stbi_image_free(icon_24);
-        stbi_image_free(icon_64);
-        stbi_image_free(icon_256);
+    void ux_window::load_icons()
+    {
+        if (_icons_loading.valid() || !_icons.empty())
+            return;
+
+        _icons_loading = std::async(std::launch::async, []() {
+            std::vector<decoded_image> icons;
+            auto decode = [&](const uint8_t* data, uint32_t size) {
+                decoded_image icon;
+                int comp;
+                auto pixels = stbi_load_from_memory(data, (int)size, &icon.width, &icon.height, &comp, false);
+                if (!pixels)
+                    return;
+                icon.pixels.reset(pixels, stbi_image_free);
+                icons.push_back(icon);
+            };
+            decode(icon_16_png_data, icon_16_png_size);
+            decode(icon_24_png_data, icon_24_png_size);
+            decode(icon_64_png_data, icon_64_png_size);
+            decode(icon_256_png_data, icon_256_png_size);
+            return icons;
+        });
     }
 
-   
     void ux_window::open_window()
     {
         if (_win)
@@ -590,6 +595,8 @@ namespace rs2
             {
                 _is_ui_aligned = is_gui_aligned(_win);
                 _first_frame = false;
+                load_icons();
+                on_first_frame();
             }
 
             imgui_config_push();
@@ -670,6 +677,12 @@ namespace rs2
     {
         glfwPollEvents();
 
+        if (_icons_loading.valid() && _icons_loading.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            _icons = _icons_loading.get();
+            setup_icon();
+        }
+
         int state = glfwGetKey(_win, GLFW_KEY_F8);
         if (state == GLFW_PRESS)
         {
@@ -9,10 +9,12 @@
 #include "imgui.h"
 #include <string>
 #include <functional>
+#include <future>
 #include <thread>
 #include "rendering.h"
 #include <atomic>
 #include <memory>
+#include <vector>
 
 namespace rs2
 {
@@ -38,6 +40,8 @@ namespace rs2
         std::function<void(std::string)> on_file_drop = [](std::string) {};
         std::function<bool()>            on_load = []() { return false; };
         std::function<void()>            on_reload_complete = []() { };
+        // Once the first frame is shown: for loading what is not needed right away in the background
+        std::function<void()>            on_first_frame = []() { };
 
         ux_window(const char* title, context &ctx);
 
@@ -91,6 +95,7 @@ namespace rs2
         void open_window();
 
         void setup_icon();
+        void load_icons();
 
         void imgui_config_push();
         void imgui_config_pop();
@@ -107,6 +112,14 @@ namespace rs2
         std::string              _error_message;
         float                    _scale_factor;
 
+        struct decoded_image
+        {
+            int width = 0, height = 0;
+            std::shared_ptr< unsigned char > pixels;
+        };
+        std::future< std::vector< decoded_image > > _icons_loading;
+        std::vector< decoded_image > _icons;  // kept, for when the window is opened again
+
         std::thread              _first_load;
         bool                     _first_frame;
         std::atomic<bool>        _app_ready;
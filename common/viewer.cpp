@@ -1283,9 +1283,12 @@ namespace rs2
         std::map<int, frame> last_frames;
         try
         {
-            size_t index = 0;
-            while (ppf.resulting_queue.poll_for_frame(&f) && ++index < ppf.resulting_queue_max_size)
+            std::vector<frame> ready_frames;
+            ppf.get_ready_frames(ready_frames);
+            for (auto&& ready : ready_frames)
             {
+                f = ready;
+
                 // Open the frame-set and validate the incoming frame originated from one of the source streams
                 // and save the frames on last_frames
                 // if one of the streams is missing we will use the last frame arrived
@@ -3167,6 +3170,7 @@ namespace rs2
         // Starting post processing filter rendering thread
         ppf.start();
         streams[p.unique_id()].begin_stream(d, p, *this);
+        streams[p.unique_id()].processing_time = ppf.get_processing_time(p.unique_id());
         ppf.frames_queue.emplace(p.unique_id(), rs2::frame_queue(5));
     }
 
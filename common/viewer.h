@@ -66,6 +66,9 @@ namespace rs2
 
         void update_configuration();
 
+        // Starts decoding the assets that are not needed for the first frames (e.g., the skybox) in the background
+        void preload_assets() { if (show_skybox) _skybox.preload(); }
+
         const float panel_width = 340.f;
         const float panel_y = 50.f;
 
@@ -204,6 +204,17 @@ void rs2_gl_init_rendering_glfw(int api_version, glfw_binding bindings, int use_
  */
 void rs2_gl_init_processing(int api_version, int use_glsl, rs2_error** error);
 
+/**
+ * Initialize processing pipeline on a headless (EGL) context of its own, which needs neither a window system nor GLFW,
+ * e.g. on servers and embedded targets. GPU frames stay on the GPU from block to block; their data is only read back
+ * when requested through rs2_get_frame_data. Texture sharing with the application's contexts is not available.
+ * Requires librealsense built with BUILD_GL_HEADLESS (Linux only).
+ * \param[in] api_version Users are expected to pass their version of \c RS2_API_VERSION to make sure they are running the correct librealsense version.
+ * \param[in] use_glsl  Use GLSL shaders for processing
+ * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_gl_init_processing_headless(int api_version, int use_glsl, rs2_error** error);
+
 /**
 * In order to share GL processing results with GLFW rendering application
 * the user need to initialize rendering by passing GLFW binding information
@@ -105,6 +105,31 @@ void rs2_context_remove_device(rs2_context* ctx, const char* file, rs2_error** e
  */
 void rs2_context_unload_tracking_module(rs2_context* ctx, rs2_error** error);
 
+/**
+* Report the USB bandwidth taken by the open UVC streams, per USB bus, over all contexts in the process.
+* The payload of each stream is estimated as width x height x bpp x fps and compared with a nominal capacity for its bus
+* type, which can be overridden with the "usb-bandwidth" context setting: { "usb2": MB/s, "usb3": MB/s }.
+* Profiles resolved by a pipeline or config are chosen, where there are several that can satisfy a request, to fit in
+* the headroom that is left.
+* \param context     Object representing librealsense session
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return            ASCII-serialized JSON: { "<bus>": { "usb-type", "capacity", "used", "headroom" (MB/s), "sensors" } };
+*                    should be released by rs2_delete_raw_data
+*/
+rs2_raw_data_buffer* rs2_get_usb_bandwidth_usage(const rs2_context* context, rs2_error** error);
+
+/**
+* Report the memory taken by frame data, over all sensors and processing blocks in the process, against the budget set
+* with the "frame-memory-budget" context setting (MB; none by default). When the budget runs short, the buffers kept
+* for reuse are released first, then new frames are dropped: point clouds when it is 3/4 used, color, infrared and
+* other streams at 7/8, and depth and motion only when it is exhausted.
+* \param context     Object representing librealsense session
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return            ASCII-serialized JSON: { "limit", "in-use", "pooled", "peak" (MB), "dropped": { "low", "normal",
+*                    "high" }, "reclaims" }; should be released by rs2_delete_raw_data
+*/
+rs2_raw_data_buffer* rs2_get_frame_memory_usage(const rs2_context* context, rs2_error** error);
+
 /**
 * create a static snapshot of all connected devices at the time of the call
 * \param context     Object representing librealsense session
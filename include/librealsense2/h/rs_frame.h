@@ -14,6 +14,7 @@
 extern "C" {
 #endif
 #include "rs_types.h"
+#include "rs_sensor.h"
 
 /** \brief Specifies the clock in relation to which the frame timestamp was measured. */
 typedef enum rs2_timestamp_domain
@@ -254,6 +255,15 @@ rs2_pixel* rs2_get_frame_texture_coordinates(const rs2_frame* frame, rs2_error**
 */
 int rs2_get_frame_points_count(const rs2_frame* frame, rs2_error** error);
 
+/**
+* When called on Points frame type that holds only the valid points, this method returns the index of the depth pixel
+* each point came from (see RS2_OPTION_VALID_POINTS_ONLY)
+* \param[in] frame       Points frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Pointer to an array of rs2_get_frame_points_count() indices, or null if they were not kept; lifetime is managed by the frame
+*/
+const int* rs2_get_frame_points_pixel_indices(const rs2_frame* frame, rs2_error** error);
+
 /**
 * Returns the stream profile that was used to start the stream of this frame
 * \param[in] frame       frame reference, owned by the user
@@ -342,6 +352,45 @@ rs2_frame* rs2_extract_frame(rs2_frame* composite, int index, rs2_error** error)
 */
 int rs2_embedded_frames_count(rs2_frame* composite, rs2_error** error);
 
+/** \brief What rs2_frameset_snapshot retrieves of each frame; for non-video frames, width, height, stride and bpp are 0 */
+typedef struct rs2_frame_snapshot
+{
+    rs2_frame* frame;                    /**< Not referenced: bound by the lifetime of the frameset, as with rs2_extract_frame */
+    const void* data;                    /**< As rs2_get_frame_data */
+    int data_size;                       /**< In bytes */
+    const rs2_stream_profile* profile;   /**< As rs2_get_frame_stream_profile */
+    rs2_stream stream;
+    int stream_index;
+    rs2_format format;
+    int unique_id;                       /**< Of the stream profile */
+    unsigned long long frame_number;
+    rs2_time_t timestamp;
+    rs2_timestamp_domain timestamp_domain;
+    int width;
+    int height;
+    int stride;                          /**< In bytes */
+    int bpp;                             /**< Bits per pixel */
+} rs2_frame_snapshot;
+
+/**
+* Retrieve everything commonly needed of the frames of a frameset -- data, profile, timestamp and the requested
+* metadata -- in a single call, instead of a call per frame and attribute
+* \param[in] frameset        Composite frame; any other frame is treated as a frameset of one
+* \param[out] frames         Caller-allocated array of at least max_frames entries
+* \param[in] max_frames      Number of entries in 'frames'
+* \param[in] metadata        The metadata to retrieve of each frame; may be null if metadata_count is 0
+* \param[in] metadata_count  Number of entries in 'metadata'
+* \param[out] values         Caller-allocated array of max_frames * metadata_count values, row i for frame i; values
+*                            of metadata a frame does not support are 0. May be null if metadata_count is 0
+* \param[out] supported      If non-null, caller-allocated array laid out as 'values', receiving 1 where the metadata is
+*                            supported and 0 where not
+* \param[out] error          If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                    The number of frames in the frameset; entries are filled for up to max_frames of them
+*/
+int rs2_frameset_snapshot( rs2_frame* frameset, rs2_frame_snapshot* frames, int max_frames,
+                           const rs2_frame_metadata_value* metadata, int metadata_count,
+                           rs2_metadata_type* values, int* supported, rs2_error** error );
+
 /**
 * This method will dispatch frame callback on a frame
 * \param[in] source      Frame pool provided by the processing block
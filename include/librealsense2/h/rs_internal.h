@@ -72,7 +72,10 @@ typedef struct rs2_pose_stream
     rs2_format fmt;
 } rs2_pose_stream;
 
-/** \brief All the parameters required to define a video frame. */
+/** \brief All the parameters required to define a video frame.
+ * The deleter is called with the pixels once the last reference to the frame is released. It may be null, in which
+ * case the pixels are borrowed from the caller (e.g., a ring buffer it manages): see
+ * rs2_software_device_set_frameset_release_callback(). */
 typedef struct rs2_software_video_frame
 {
     void* pixels;
@@ -130,6 +133,7 @@ typedef struct rs2_software_notification
 } rs2_software_notification;
 
 struct rs2_software_device_destruction_callback;
+struct rs2_software_device_frameset_release_callback;
 
 /**
  * Create librealsense context that will try to record all operations over librealsense into a file
@@ -242,6 +246,26 @@ void rs2_software_device_set_destruction_callback(const rs2_device* dev, rs2_sof
 */
 void rs2_software_device_set_destruction_callback_cpp(const rs2_device* dev, rs2_software_device_destruction_callback* callback, rs2_error** error);
 
+/**
+* set callback to be notified when frames injected with a null deleter (borrowed buffers) are no longer in use
+* The callback is called once per frame number, when the last frame injected with that number, over all the sensors of
+* the device, is released -- so a frameset's buffers can be returned to the caller's ring in one go rather than one
+* deleter call per frame. It is called from whichever thread releases that last frame.
+* A frame number whose frames are all released before others with the same number are injected is reported again.
+* \param[in] dev        software device
+* \param[in] on_release function pointer to register as callback; receives the frame number
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_software_device_set_frameset_release_callback(const rs2_device* dev, rs2_software_device_frameset_release_callback_ptr on_release, void* user, rs2_error** error);
+
+/**
+* set callback to be notified when frames injected with a null deleter (borrowed buffers) are no longer in use
+* \param[in] dev      software device
+* \param[in] callback callback object created from c++ application. ownership over the callback object is moved into the relevant device lock
+* \param[out] error   if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_software_device_set_frameset_release_callback_cpp(const rs2_device* dev, rs2_software_device_frameset_release_callback* callback, rs2_error** error);
+
 /**
  * Set the wanted matcher type that will be used by the syncer
  * \param[in] dev the software device
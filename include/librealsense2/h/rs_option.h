@@ -124,6 +124,23 @@ extern "C" {
         RS2_OPTION_OHM_TEMPERATURE, /**< Temperature of the Optical Head Sensor */
         RS2_OPTION_SOC_PVT_TEMPERATURE, /**< Temperature of PVT SOC */
         RS2_OPTION_GYRO_SENSITIVITY,/**< Control of the gyro sensitivity level, see rs2_gyro_sensitivity for values */ 
+        RS2_OPTION_PROCESSING_THREADS, /**< Number of threads a processing block may split each frame between; 1 = single-threaded */
+        RS2_OPTION_OUTPUT_FORMAT, /**< Format of the frames a processing block outputs, see rs2_format for values */
+        RS2_OPTION_VALID_POINTS_ONLY, /**< Pointcloud emits only the points that have depth: 0 = all pixels, 1 = valid points, 2 = valid points and the depth pixel index of each */
+        RS2_OPTION_MAX_LATENCY, /**< Syncer releases a partial frameset rather than wait longer than this many milliseconds for a late stream; 0 = no limit */
+        RS2_OPTION_PROCESSING_STATS, /**< Processing block collects timing and frame counters, read through RS2_CAMERA_INFO_PROCESSING_STATS */
+        RS2_OPTION_SYNC_BATCH_WINDOW, /**< Syncer waits this many milliseconds for frames of other streams to arrive before matching them together; 0 = match each frame on arrival */
+        RS2_OPTION_ASYNC_PROCESSING, /**< Processing block returns from invoke right away and processes the frame on the shared worker pool, still one frame at a time and in order */
+        RS2_OPTION_IN_PLACE_PROCESSING, /**< Filter writes its output into the input frame, instead of a new one, when nothing else references the input */
+        RS2_OPTION_ROI_MIN_X, /**< Left edge of the region a processing block computes in, as a fraction of the frame width */
+        RS2_OPTION_ROI_MIN_Y, /**< Top edge of the region a processing block computes in, as a fraction of the frame height */
+        RS2_OPTION_ROI_MAX_X, /**< Right edge of the region a processing block computes in, as a fraction of the frame width */
+        RS2_OPTION_ROI_MAX_Y, /**< Bottom edge of the region a processing block computes in, as a fraction of the frame height */
+        RS2_OPTION_MOTION_BATCH_SIZE, /**< Number of samples in each RS2_FORMAT_MOTION_BATCH motion frame */
+        RS2_OPTION_SHARE_RESULTS, /**< Processing block reuses the output an equivalent block already computed from the same input frame, for as long as that frame lives */
+        RS2_OPTION_VOXEL_SIZE, /**< Size, in meters, of the grid cells a pointcloud is reduced to one point per; 0 for no reduction */
+        RS2_OPTION_FIXED_POINT_DISPARITY, /**< Depth to disparity transform outputs 16-bit fixed-point disparity (RS2_FORMAT_DISPARITY16) instead of 32-bit floats */
+        RS2_OPTION_ADAPTIVE_DECIMATION, /**< Decimation filter raises its scale while frames of the stream back up in the queues downstream, and lowers it back once they drain */
         RS2_OPTION_COUNT /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
     } rs2_option;
 
@@ -296,6 +313,15 @@ extern "C" {
     */
     int rs2_is_option_read_only(const rs2_options* options, rs2_option option, rs2_error** error);
 
+    /**
+    * check if an option can be changed while the sensor is streaming; options that cannot must be set before it starts
+    * \param[in] options  the options container
+    * \param[in] option   option id to be checked
+    * \param[out] error   if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    * \return true if the option can be set while streaming
+    */
+    int rs2_can_set_option_while_streaming(const rs2_options* options, rs2_option option, rs2_error** error);
+
     /**
     * read option value from the sensor
     * \param[in] options  the options container
@@ -323,6 +349,18 @@ extern "C" {
     */
     void rs2_set_option(const rs2_options* options, rs2_option option, float value, rs2_error** error);
 
+    /**
+    * write several option values at once, all or none: every value is checked before any is written, including that
+    * the option can be set while streaming if the sensor is, and if writing one fails those already written are
+    * restored. The values are written in order, with the device kept powered between them
+    * \param[in] options     the options container
+    * \param[in] option_ids  ids of the options to write
+    * \param[in] values      new value for each of the options
+    * \param[in] count       number of options
+    * \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    void rs2_apply_options(const rs2_options* options, const rs2_option* option_ids, const float* values, int count, rs2_error** error);
+
     /**
     * write new value to sensor option
     * \param[in] options       the options container
@@ -91,6 +91,20 @@ extern "C" {
     */
     int rs2_pipeline_try_wait_for_frames(rs2_pipeline* pipe, rs2_frame** output_frame, unsigned int timeout_ms, rs2_error ** error);
 
+    /**
+    * Wait until a batch of frames sets becomes available, as rs2_pipeline_wait_for_frames does for one, in a single call.
+    * The sets are taken as they are published; those published while the function wasn't called are dropped, as with
+    * rs2_pipeline_wait_for_frames.
+    * \param[in] pipe           the pipeline
+    * \param[out] framesets     receives the frames sets, each to be released using rs2_release_frame
+    * \param[in] count          frames sets in a batch
+    * \param[in] timeout_ms     max time in milliseconds to wait for the whole batch; if it expires first, the sets that
+    *                           did arrive are returned, and if none did, an exception is thrown
+    * \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    * \return the number of frames sets stored to framesets
+    */
+    int rs2_pipeline_wait_for_frames_batch(rs2_pipeline* pipe, rs2_frame** framesets, int count, unsigned int timeout_ms, rs2_error ** error);
+
     /**
     * Delete a pipeline instance.
     * Upon destruction, the pipeline will implicitly stop itself
@@ -35,6 +35,15 @@ rs2_processing_block* rs2_create_colorizer(rs2_error** error);
 */
 rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error);
 
+/**
+* Creates a Sync processing block that also matches frames across devices: each device's frames are synced as by
+* rs2_create_sync_processing_block, and the resulting framesets are then matched with other devices' by timestamp.
+* The devices should have RS2_OPTION_GLOBAL_TIME_ENABLED on, so that their timestamps are all in host time. Use
+* RS2_OPTION_MAX_LATENCY to bound how long a frameset will wait for a device that is late.
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_multi_device_sync_processing_block(rs2_error** error);
+
 /**
 * Creates Point-Cloud processing block. This block accepts depth frames and outputs Points frames
 * In addition, given non-depth frame, the block will align texture coordinate to the non-depth stream
@@ -203,6 +212,31 @@ int rs2_poll_for_frame(rs2_frame_queue* queue, rs2_frame** output_frame, rs2_err
 */
 int rs2_try_wait_for_frame(rs2_frame_queue* queue, unsigned int timeout_ms, rs2_frame** output_frame, rs2_error** error);
 
+/**
+* wait until a batch of frames is available in the queue and dequeue them all at once
+* \param[in] queue          the frame queue data structure
+* \param[out] frames        receives the frame handles, each to be released using rs2_release_frame
+* \param[in] count          frames in a batch; no more than the capacity of the queue
+* \param[in] timeout_ms     max time in milliseconds to wait for the whole batch; if it expires first, the frames that
+*                           did arrive are dequeued, and if none did, an exception is thrown
+* \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return the number of frames stored to frames
+*/
+int rs2_wait_for_frame_batch(rs2_frame_queue* queue, rs2_frame** frames, int count, unsigned int timeout_ms, rs2_error** error);
+
+/**
+* pack video frames of the same stream profile into a single frame, as an N x C x H x W tensor (e.g., for batch
+* inference): frame after frame, each as a plane per channel. The channels keep their type, so only formats whose
+* channels are all alike can be packed (Z16, Y8, Y16, RGB8, BGRA8, DISPARITY32, etc.)
+* The frame is allocated from the same frame pool as the frames, and has the metadata and profile of the first: it is
+* W wide and N*C*H high, with a stride of W channels
+* \param[in] frames         the frames to pack; left as they are
+* \param[in] count          number of frames
+* \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return the packed frame, to be released using rs2_release_frame
+*/
+rs2_frame* rs2_pack_frames_nchw(rs2_frame** frames, int count, rs2_error** error);
+
 /**
 * enqueue new frame into a queue
 * \param[in] frame frame handle to enqueue (this operation passed ownership to the queue)
@@ -217,6 +251,15 @@ void rs2_enqueue_frame(rs2_frame* frame, void* queue);
 */
 rs2_processing_block* rs2_create_align(rs2_stream align_to, rs2_error** error);
 
+/**
+* Creates Align processing block that aligns depth to several streams at once. Each depth pixel is deprojected once
+* and mapped onto all of them; the output frameset holds a depth frame aligned to each target found in the input.
+* \param[in] align_to   stream types to align depth to, none of them depth and none listed twice
+* \param[in] count      number of stream types in align_to
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_align_to_streams(const rs2_stream* align_to, int count, rs2_error** error);
+
 /**
 * Creates Depth post-processing filter block. This block accepts depth frames, applies decimation filter and plots modified prames
 * Note that due to the modifiedframe size, the decimated frame repaces the original one
@@ -249,6 +292,60 @@ rs2_processing_block* rs2_create_disparity_transform_block(unsigned char transfo
 */
 rs2_processing_block* rs2_create_hole_filling_filter_block(rs2_error** error);
 
+/**
+* Creates Depth post-processing block that runs the recommended chain of the stereo depth filters - decimation, depth to disparity,
+* spatial, temporal, disparity to depth and hole filling - in one pass over bands of the frame, with the same output as the separate blocks.
+* Hole filling is disabled to begin with; the stages are configured through rs2_get_depth_postprocess_stage.
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_depth_postprocess_block(rs2_error** error);
+
+/**
+* Retrieves the block of one stage of a depth post-processing block, to set the options of that stage.
+* The stage block is only configured through; invoking it on its own is not supported.
+* \param[in] block  a block created by rs2_create_depth_postprocess_block
+* \param[in] stage  one of RS2_EXTENSION_DECIMATION_FILTER, RS2_EXTENSION_DISPARITY_FILTER, RS2_EXTENSION_SPATIAL_FILTER,
+*                   RS2_EXTENSION_TEMPORAL_FILTER and RS2_EXTENSION_HOLE_FILLING_FILTER
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return           the stage block, to be released by rs2_delete_processing_block
+*/
+rs2_processing_block* rs2_get_depth_postprocess_stage(rs2_processing_block* block, rs2_extension stage, rs2_error** error);
+
+/**
+* Enables or disables one stage of a depth post-processing block
+* \param[in] block  a block created by rs2_create_depth_postprocess_block
+* \param[in] stage  one of the stages accepted by rs2_get_depth_postprocess_stage
+* \param[in] enable non-zero to run the stage
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_enable_depth_postprocess_stage(rs2_processing_block* block, rs2_extension stage, int enable, rs2_error** error);
+
+/**
+* Creates a rectify block. The block undistorts color frames (RGB8, BGR8, RGBA8, BGRA8, Y8 or Y16) into a pinhole image with
+* the same focal length and principal point; its output profile carries these intrinsics, with no distortion.
+* Frames whose intrinsics have no distortion pass through unchanged.
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_rectify_block(rs2_error** error);
+
+/**
+* Creates a fused pointcloud block. The block merges the Z16 depth frames of a frameset - from several cameras, e.g. out of
+* the multi-device syncer - into a single points frame, each camera's points moved into the rig's coordinates by the
+* extrinsics set with rs2_set_fused_pointcloud_extrinsics. Points have no texture coordinates. With RS2_OPTION_VOXEL_SIZE,
+* the output holds one point per occupied cell of that size, the centroid of the points in it.
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_fused_pointcloud_block(rs2_error** error);
+
+/**
+* Sets where a camera is in the rig, for a fused pointcloud block. Cameras without extrinsics are at the rig's origin.
+* \param[in] block       a block created by rs2_create_fused_pointcloud_block
+* \param[in] serial      the camera's RS2_CAMERA_INFO_SERIAL_NUMBER
+* \param[in] extrinsics  transformation from the camera's depth coordinates to the rig's
+* \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_fused_pointcloud_extrinsics(rs2_processing_block* block, const char* serial, const rs2_extrinsics* extrinsics, rs2_error** error);
+
 /**
 * Creates a rates printer block. The printer prints the actual FPS of the invoked frame stream.
 * The block ignores reapiting frames and calculats the FPS only if the frame number of the relevant frame was changed.
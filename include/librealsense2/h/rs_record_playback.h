@@ -27,6 +27,17 @@ typedef enum rs2_playback_status
 
 const char* rs2_playback_status_to_string(rs2_playback_status status);
 
+/** \brief What a recording device does with a new frame once its write queue is full */
+typedef enum rs2_record_queue_policy
+{
+    RS2_RECORD_QUEUE_POLICY_DROP_OLDEST, /**< Discard the oldest frame that was not written yet, keeping the latest data */
+    RS2_RECORD_QUEUE_POLICY_DROP_NEWEST, /**< Discard the incoming frame, keeping the data already queued */
+    RS2_RECORD_QUEUE_POLICY_BLOCK,       /**< Hold the streaming thread until the writer catches up; no frame is lost */
+    RS2_RECORD_QUEUE_POLICY_COUNT
+} rs2_record_queue_policy;
+
+const char* rs2_record_queue_policy_to_string(rs2_record_queue_policy policy);
+
 typedef void (*rs2_playback_status_changed_callback_ptr)(rs2_playback_status);
 
 /**
@@ -71,6 +82,24 @@ void rs2_record_device_resume(const rs2_device* device, rs2_error** error);
 */
 const char* rs2_record_device_filename(const rs2_device* device, rs2_error** error);
 
+/**
+* Limits the number of frames the recorder keeps in memory while they wait to be written to file.
+* By default the queue is unbounded, so a writer that cannot keep up with the streams keeps growing memory.
+* \param[in]  device      A recording device
+* \param[in]  max_frames  Maximum number of frames waiting to be written, or 0 for no limit
+* \param[in]  policy      What to do with a new frame when max_frames are already waiting
+* \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_set_queue_limit(const rs2_device* device, unsigned int max_frames, rs2_record_queue_policy policy, rs2_error** error);
+
+/**
+* Gets the number of frames the recorder discarded because its write queue was full
+* \param[in]  device    A recording device
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return The number of frames that were not written to file since the recorder was created
+*/
+unsigned long long rs2_record_device_get_dropped_frames(const rs2_device* device, rs2_error** error);
+
 /**
 * Creates a playback device to play the content of the given file
 * \param[in]  file      Path to the file to play
@@ -150,6 +179,26 @@ void rs2_playback_device_set_real_time(const rs2_device* device, int real_time,
  */
 int rs2_playback_device_is_real_time(const rs2_device* device, rs2_error** error);
 
+/**
+ * Lets playback read ahead of the frames it delivers, on a separate thread, so that reading and decompressing the file
+ * overlaps with handling the frames. Most useful when playing in non real time mode.
+ * \param[in] device A playback device
+ * \param[in] depth  Maximum number of samples read in advance (clamped to 16), or 0 to read each one when it is due
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_playback_device_set_prefetch_depth(const rs2_device* device, unsigned int depth, rs2_error** error);
+
+/**
+ * Plays two recordings on one clock: samples are delivered when their time since the start of their own file is due
+ * on a shared time base, and the files are read ahead on one shared pool of threads. Each file remains a device of
+ * its own. Pausing, resuming, seeking or changing the rate of any of the synced devices applies to all of them.
+ * Devices already synced with others bring them along.
+ * \param[in] device A playback device
+ * \param[in] other  Another playback device, to play on the same clock
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_playback_device_sync_with(const rs2_device* device, const rs2_device* other, rs2_error** error);
+
 /**
  * Register to receive callback from playback device upon its status changes
  *
@@ -178,6 +227,15 @@ rs2_playback_status rs2_playback_device_get_current_status(const rs2_device* dev
  */
 void rs2_playback_device_set_playback_speed(const rs2_device* device, float speed, rs2_error** error);
 
+/**
+* Gets the number of frames that real-time playback dropped because they were not consumed in time, e.g. when
+* the user callbacks cannot keep up with the playback speed. Non-real-time playback waits for the callbacks instead.
+* \param[in]  device    A playback device
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return The number of frames that were read from the file but not delivered, since the playback device was created
+*/
+unsigned long long rs2_playback_device_get_dropped_frames(const rs2_device* device, rs2_error** error);
+
 /**
 * Stops the playback
 * Calling stop() will stop all streaming playbakc sensors and will reset the playback (returning to beginning of file)
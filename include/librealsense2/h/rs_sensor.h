@@ -35,6 +35,8 @@ typedef enum rs2_camera_info {
     RS2_CAMERA_INFO_FIRMWARE_UPDATE_ID             , /**< Firmware update ID */
     RS2_CAMERA_INFO_IP_ADDRESS                     , /**< IP address for remote camera. */
     RS2_CAMERA_INFO_DFU_DEVICE_PATH                , /**< DFU Device node path */
+    RS2_CAMERA_INFO_PROCESSING_STATS               , /**< Processing block timing and frame counters, collected while RS2_OPTION_PROCESSING_STATS is on */
+    RS2_CAMERA_INFO_STREAM_STATS                   , /**< Transport counters of each stream of a network (DDS) sensor since it was opened: samples received and lost, throughput, latency */
     RS2_CAMERA_INFO_COUNT                            /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
 } rs2_camera_info;
 const char* rs2_camera_info_to_string(rs2_camera_info info);
@@ -62,7 +64,7 @@ typedef enum rs2_format
 {
     RS2_FORMAT_ANY             , /**< When passed to enable stream, librealsense will try to provide best suited format */
     RS2_FORMAT_Z16             , /**< 16-bit linear depth values. The depth is meters is equal to depth scale * pixel value. */
-    RS2_FORMAT_DISPARITY16     , /**< 16-bit float-point disparity values. Depth->Disparity conversion : Disparity = Baseline*FocalLength/Depth. */
+    RS2_FORMAT_DISPARITY16     , /**< 16-bit fixed-point disparity values, in 1/32 pixel. Depth->Disparity conversion : Disparity = Baseline*FocalLength/Depth. */
     RS2_FORMAT_XYZ32F          , /**< 32-bit floating point 3D coordinates. */
     RS2_FORMAT_YUYV            , /**< 32-bit y0, u, y1, v data for every two pixels. Similar to YUV422 but packed in a different order - https://en.wikipedia.org/wiki/YUV */
     RS2_FORMAT_RGB8            , /**< 8-bit red, green and blue channels */
@@ -94,6 +96,8 @@ typedef enum rs2_format
     RS2_FORMAT_Y16I            , /**< 12-bit per pixel interleaved. 12-bit left, 12-bit right. */
     RS2_FORMAT_M420            , /**< 24-bit for every pixel: y for each pixel, and u,v data for every four pixels - packed as 2 lines of y, 1 line of u,v */
     RS2_FORMAT_COMBINED_MOTION , /**< Combined motion data, as in the combined_motion structure */
+    RS2_FORMAT_XYZ16           , /**< 16-bit signed 3D coordinates in depth units for every point, followed by 16-bit signed texture coordinates in units of 1/8192 */
+    RS2_FORMAT_MOTION_BATCH    , /**< Several accel or gyro samples per frame, as an array of rs2_motion_sample, oldest first */
     RS2_FORMAT_COUNT             /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
 } rs2_format;
 const char* rs2_format_to_string(rs2_format format);
@@ -105,6 +109,54 @@ typedef struct rs2_extrinsics
     float translation[3]; /**< Three-element translation vector, in meters */
 } rs2_extrinsics;
 
+/** \brief Distribution of one latency, in milliseconds. Percentiles are accurate to within 25%. */
+typedef struct rs2_latency_stats
+{
+    unsigned long long count; /**< Number of frames measured */
+    float mean_ms;
+    float p50_ms;
+    float p90_ms;
+    float p99_ms;
+    float max_ms;
+} rs2_latency_stats;
+
+/** \brief Where the time goes for the frames of a stream, from the backend to the user */
+typedef struct rs2_stream_stats
+{
+    rs2_latency_stats arrival_to_publish; /**< From the frame arriving from the backend until the sensor publishes it */
+    rs2_latency_stats publish_to_sync;    /**< From the sensor publishing the frame until a syncer releases it in a frameset */
+    rs2_latency_stats processing;         /**< Time spent in each processing block the stream's frames go through */
+    rs2_latency_stats exposure_to_callback; /**< From the middle of the exposure until the sensor publishes the frame; only frames in RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME with sensor-timestamp or actual-exposure metadata are counted */
+} rs2_stream_stats;
+
+/** \brief Where along the way from the device to the user the frames of a stream can be dropped */
+typedef enum rs2_frame_drop_stage
+{
+    RS2_FRAME_DROP_STAGE_BACKEND,      /**< Never reached the sensor: lost in the device, transport or backend (gaps in the frame counter, less those of RS2_FRAME_DROP_STAGE_METADATA_SYNC) */
+    RS2_FRAME_DROP_STAGE_ARCHIVE,      /**< The sensor had no frame to put it in: too many frames are still held by the application */
+    RS2_FRAME_DROP_STAGE_SYNCER_INBOX, /**< Overran the syncer inbox: frames arrived faster than they could be matched */
+    RS2_FRAME_DROP_STAGE_SYNCER,       /**< Overran its syncer queue, while waiting for frames of other streams to match */
+    RS2_FRAME_DROP_STAGE_FRAME_QUEUE,  /**< Overran an rs2_frame_queue: the application did not dequeue in time */
+    RS2_FRAME_DROP_STAGE_CALLBACK_QUEUE, /**< Overran the sensor's callback queue (see rs2_set_callback_queue): its callback did not return in time */
+    RS2_FRAME_DROP_STAGE_RECORDER,     /**< Overran the recorder's write queue (see rs2_record_device_set_queue_limit): the file could not be written in time */
+    RS2_FRAME_DROP_STAGE_METADATA_SYNC, /**< Given back to the kernel by the backend, as no metadata buffer could be paired with it (V4L2 metadata nodes only) */
+    RS2_FRAME_DROP_STAGE_COUNT         /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
+} rs2_frame_drop_stage;
+const char* rs2_frame_drop_stage_to_string(rs2_frame_drop_stage stage);
+
+/** \brief Frames of a stream that were dropped, by stage, and how deep the queue at each stage got */
+typedef struct rs2_frame_drops
+{
+    unsigned long long dropped[RS2_FRAME_DROP_STAGE_COUNT]; /**< Frames dropped at each stage */
+    unsigned int max_queue_depth[RS2_FRAME_DROP_STAGE_COUNT]; /**< Most frames that were waiting in the queue of each stage at once; 0 for stages without a queue */
+    unsigned int queue_fill[RS2_FRAME_DROP_STAGE_COUNT]; /**< How full the queue of each stage was when a frame last entered it, in percent of its capacity; 0 for stages without a bound */
+    unsigned long long decimated; /**< Frames that were not dropped, but decimated further than asked, to relieve the backpressure (see RS2_OPTION_ADAPTIVE_DECIMATION) */
+    unsigned int decimation_scale; /**< The scale the adaptive decimation filter last used on the stream; 0 if none did */
+    unsigned long long metadata_mismatches; /**< Times the backend found the next video and metadata buffers out of step, and had to look further to pair them (V4L2 metadata nodes only) */
+    unsigned long long metadata_dropped; /**< Metadata buffers the backend gave back to the kernel unpaired; unlike RS2_FRAME_DROP_STAGE_METADATA_SYNC, no frame was lost with them */
+    unsigned long long latency_cutoffs; /**< Framesets a syncer released without this stream, rather than hold them back past its RS2_OPTION_MAX_LATENCY; the stream's frame was not dropped, only late */
+} rs2_frame_drops;
+
 /** \brief RS2_STREAM_MOTION / RS2_FORMAT_COMBINED_MOTION content is similar to ROS2's Imu message */
 typedef struct rs2_combined_motion
 {
@@ -113,6 +165,13 @@ typedef struct rs2_combined_motion
     struct { double x, y, z; } linear_acceleration;
 } rs2_combined_motion;
 
+/** \brief RS2_FORMAT_MOTION_BATCH content is an array of these; the frame itself has the metadata of its last sample */
+typedef struct rs2_motion_sample
+{
+    rs2_vector data;   /**< As in RS2_FORMAT_MOTION_XYZ32F; first, so a motion frame's data starts with its oldest sample */
+    double timestamp;  /**< Of the sample, in milliseconds, in the frame's timestamp domain */
+} rs2_motion_sample;
+
 /**
 * Deletes sensors list, any sensors created from this list will remain unaffected
 * \param[in] info_list list to delete
@@ -291,6 +350,41 @@ void rs2_set_notifications_callback(const rs2_sensor* sensor, rs2_notification_c
 */
 void rs2_set_notifications_callback_cpp(const rs2_sensor* sensor, rs2_notifications_callback* callback, rs2_error** error);
 
+/**
+* set the allocator used for the payload of frames produced by the sensor, instead of the library's own buffers
+* the allocator is called from the streaming threads and must be thread-safe; each buffer is handed back through
+* 'deallocate' once the last reference to its frame is released. Frames that are not allocated by the sensor itself
+* (e.g., outputs of processing blocks) are not affected
+* \param[in] sensor      RealSense sensor
+* \param[in] allocate    returns a buffer of at least 'size' bytes, or null to let the library allocate this frame; pass
+*                        a null allocate to restore the library's default allocation
+* \param[in] deallocate  releases a buffer previously returned by 'allocate'
+* \param[in] user        user data passed back to 'allocate' and 'deallocate'
+* \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator(const rs2_sensor* sensor, rs2_frame_allocate_callback_ptr allocate, rs2_frame_deallocate_callback_ptr deallocate, void* user, rs2_error** error);
+
+/**
+* set the allocator used for the payload of frames produced by the sensor, instead of the library's own buffers
+* \param[in] sensor     RealSense sensor
+* \param[in] allocator  allocator object created from c++ application, or null to restore the default allocation.
+*                       ownership over the allocator object is moved into the sensor
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator_cpp(const rs2_sensor* sensor, rs2_frame_allocator* allocator, rs2_error** error);
+
+/**
+* deliver the frames of the sensor to its callback from a thread of its own, through a queue of up to 'size' frames,
+* so that a slow callback does not hold up the streaming thread and the buffers it captures into. When the queue is
+* full, a frame is dropped (see RS2_FRAME_DROP_STAGE_CALLBACK_QUEUE). Queued frames count against the frames the sensor
+* can have in flight (RS2_OPTION_FRAMES_QUEUE_SIZE). Can only be changed while the sensor is not streaming
+* \param[in] sensor      RealSense sensor
+* \param[in] size        most frames waiting for the callback, or 0 to call it directly from the streaming thread
+* \param[in] drop_newest if non-zero, the arriving frame is dropped when the queue is full; otherwise the oldest waiting one
+* \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_callback_queue(const rs2_sensor* sensor, unsigned int size, int drop_newest, rs2_error** error);
+
 /**
 * retrieve description from notification handle
 * \param[in] notification      handle returned from a callback
@@ -444,6 +538,20 @@ void rs2_get_video_stream_resolution(const rs2_stream_profile* mode, int* width,
 */
 void rs2_get_motion_intrinsics(const rs2_stream_profile* mode, rs2_motion_device_intrinsic * intrinsics, rs2_error ** error);
 
+/**
+* Copy the recent samples of a motion stream whose timestamps fall in a range, without waiting for them as frames.
+* The sensor keeps the last ~1000 corrected samples of each stream; timestamps are those of the stream's frames.
+* \param[in] sensor       Motion sensor
+* \param[in] stream       RS2_STREAM_ACCEL or RS2_STREAM_GYRO
+* \param[in] from_ms      Earliest timestamp, inclusive
+* \param[in] to_ms        Latest timestamp, inclusive
+* \param[out] samples     Receives the samples, oldest first
+* \param[in] max_samples  Capacity of 'samples'; if more match, the oldest ones are copied
+* \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                 Number of samples copied
+*/
+int rs2_get_motion_samples(const rs2_sensor* sensor, rs2_stream stream, double from_ms, double to_ms, rs2_motion_sample* samples, int max_samples, rs2_error** error);
+
 /**
 * Returns non-zero if selected profile is recommended for the sensor
 * This is an optional hint we offer to suggest profiles with best performance-quality tradeof
@@ -477,6 +585,26 @@ void rs2_get_extrinsics(const rs2_stream_profile* from,
                         const rs2_stream_profile* to,
                         rs2_extrinsics* extrin, rs2_error** error);
 
+/**
+ * Get the latency statistics collected so far for a stream. They are shared by all profiles with the same unique ID
+ * (see rs2_get_stream_profile_data) and kept for the lifetime of the library.
+ * \param[in] profile       stream profile
+ * \param[out] stats        latency statistics of the frames of that stream
+ * \param[in] reset         if non-zero, the statistics are cleared after being read
+ * \param[out] error        if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_get_stream_stats(const rs2_stream_profile* profile, rs2_stream_stats* stats, int reset, rs2_error** error);
+
+/**
+ * Get the frames of a stream dropped so far, attributed to the stage that dropped them. Like the latency statistics,
+ * they are shared by all profiles with the same unique ID and kept for the lifetime of the library.
+ * \param[in] profile       stream profile
+ * \param[out] drops        the drop counters and queue depths of that stream
+ * \param[in] reset         if non-zero, the counters are cleared after being read
+ * \param[out] error        if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_get_stream_frame_drops(const rs2_stream_profile* profile, rs2_frame_drops* drops, int reset, rs2_error** error);
+
 /**
 * \param[in] from          origin stream profile
 * \param[in] to            target stream profile
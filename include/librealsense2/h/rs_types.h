@@ -255,18 +255,23 @@ typedef struct rs2_options_changed_callback rs2_options_changed_callback;
 typedef struct rs2_devices_changed_callback rs2_devices_changed_callback;
 typedef struct rs2_notification rs2_notification;
 typedef struct rs2_notifications_callback rs2_notifications_callback;
+typedef struct rs2_frame_allocator rs2_frame_allocator;
 typedef struct rs2_firmware_log_message rs2_firmware_log_message;
 typedef struct rs2_firmware_log_parsed_message rs2_firmware_log_parsed_message;
 typedef struct rs2_firmware_log_parser rs2_firmware_log_parser;
 typedef struct rs2_terminal_parser rs2_terminal_parser;
+typedef struct rs2_color_to_depth_projector rs2_color_to_depth_projector;
 typedef void (*rs2_log_callback_ptr)(rs2_log_severity, rs2_log_message const *, void * arg);
 typedef void (*rs2_notification_callback_ptr)(rs2_notification*, void*);
 typedef void (*rs2_software_device_destruction_callback_ptr)(void*);
+typedef void (*rs2_software_device_frameset_release_callback_ptr)(int, void*);
 typedef void (*rs2_devices_changed_callback_ptr)(rs2_device_list*, rs2_device_list*, void*);
 typedef void (*rs2_frame_callback_ptr)(rs2_frame*, void*);
 typedef void (*rs2_frame_processor_callback_ptr)(rs2_frame*, rs2_source*, void*);
 typedef void (*rs2_update_progress_callback_ptr)(const float, void*);
 typedef void (*rs2_options_changed_callback_ptr)(const rs2_options_list *);
+typedef void * (*rs2_frame_allocate_callback_ptr)(int size, void * user);
+typedef void (*rs2_frame_deallocate_callback_ptr)(void * buffer, int size, void * user);
 
 typedef double      rs2_time_t;     /**< Timestamp format. units are milliseconds */
 typedef long long   rs2_metadata_type; /**< Metadata attribute type is defined as 64 bit signed integer*/
@@ -216,6 +216,46 @@ namespace rs2
             rs2::error::handle(e);
         }
 
+        /**
+        * \return  JSON of the USB bandwidth used by open streams, per bus, in MB/s: see rs2_get_usb_bandwidth_usage()
+        */
+        std::string get_usb_bandwidth_usage() const
+        {
+            rs2_error* e = nullptr;
+            std::shared_ptr<rs2_raw_data_buffer> usage(
+                rs2_get_usb_bandwidth_usage(_context.get(), &e),
+                rs2_delete_raw_data);
+            rs2::error::handle(e);
+
+            auto size = rs2_get_raw_data_size(usage.get(), &e);
+            rs2::error::handle(e);
+
+            auto start = rs2_get_raw_data(usage.get(), &e);
+            rs2::error::handle(e);
+
+            return std::string(start, start + size);
+        }
+
+        /**
+        * \return  JSON of the memory frames take, in MB, against the process-wide budget: see rs2_get_frame_memory_usage()
+        */
+        std::string get_frame_memory_usage() const
+        {
+            rs2_error* e = nullptr;
+            std::shared_ptr<rs2_raw_data_buffer> usage(
+                rs2_get_frame_memory_usage(_context.get(), &e),
+                rs2_delete_raw_data);
+            rs2::error::handle(e);
+
+            auto size = rs2_get_raw_data_size(usage.get(), &e);
+            rs2::error::handle(e);
+
+            auto start = rs2_get_raw_data(usage.get(), &e);
+            rs2::error::handle(e);
+
+            return std::string(start, start + size);
+        }
+
         context(std::shared_ptr<rs2_context> ctx)
             : _context(ctx)
         {}
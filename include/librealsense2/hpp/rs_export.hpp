@@ -5,6 +5,12 @@
 #define LIBREALSENSE_RS2_EXPORT_HPP
 
 #include <map>
+#include <array>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
 #include <fstream>
 #include <cmath>
 #include <sstream>
@@ -31,88 +37,63 @@ namespace rs2
     inline vec3d operator - (const vec3d & a, const vec3d & b) { return{ a.x - b.x, a.y - b.y, a.z - b.z }; }
     inline vec3d cross(const vec3d & a, const vec3d & b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
 
-    class save_to_ply : public filter
+    // Writes point clouds to PLY files. The whole file is put together in memory and written at once, and the buffers
+    // are kept from one call to the next, so a sequence of frames is exported without reallocating. Not thread-safe:
+    // use one writer per thread.
+    class ply_writer
     {
     public:
-        static const auto OPTION_IGNORE_COLOR = rs2_option(RS2_OPTION_COUNT + 10);
-        static const auto OPTION_PLY_MESH = rs2_option(RS2_OPTION_COUNT + 11);
-        static const auto OPTION_PLY_BINARY = rs2_option(RS2_OPTION_COUNT + 12);
-        static const auto OPTION_PLY_NORMALS = rs2_option(RS2_OPTION_COUNT + 13);
-        static const auto OPTION_PLY_THRESHOLD = rs2_option(RS2_OPTION_COUNT + 14);
-
-        save_to_ply(std::string filename = "RealSense Pointcloud ", pointcloud pc = pointcloud()) : filter([this](frame f, frame_source& s) { func(f, s); }),
-            _pc(std::move(pc)), fname(filename)
+        struct settings
         {
-            register_simple_option(OPTION_IGNORE_COLOR, option_range{ 0, 1, 0, 1 });
-            register_simple_option(OPTION_PLY_MESH, option_range{ 0, 1, 1, 1 });
-            register_simple_option(OPTION_PLY_NORMALS, option_range{ 0, 1, 0, 1 });
-            register_simple_option(OPTION_PLY_BINARY, option_range{ 0, 1, 1, 1 });
-            register_simple_option(OPTION_PLY_THRESHOLD, option_range{ 0, 1, 0.05f, 0 });
-        }
-
-    private:
-        void func(frame data, frame_source& source)
-        {
-            frame depth, color;
-            if (auto fs = data.as<frameset>()) {
-                for (auto f : fs) {
-                    if (f.is<points>()) depth = f;
-                    else if (!depth && f.is<depth_frame>()) depth = f;
-                    else if (!color && f.is<video_frame>()) color = f;
-                }
-            } else if (data.is<depth_frame>() || data.is<points>()) {
-                depth = data;
-            }
+            bool mesh = true;          // faces between neighbouring points
+            bool binary = true;        // binary_little_endian, otherwise ascii
+            bool normals = false;      // per-vertex normals; mesh only
+            float threshold = 0.05f;   // largest depth difference between neighbours connected by a face
+        };
 
-            if (!depth) throw std::runtime_error("Need depth data to save PLY");
-            if (!depth.is<points>()) {
-                if (color) _pc.map_to(color);
-                depth = _pc.calculate(depth);
-            }
+        ply_writer() = default;
+        explicit ply_writer(const settings& s) : _settings(s) {}
 
-            export_to_ply(depth, color);
-            source.frame_ready(data); // passthrough filter because processing_block::process doesn't support sinks
-        }
+        settings& get_settings() { return _settings; }
 
-        void export_to_ply(points p, video_frame color) {
-            const bool use_texcoords  = color && !get_option(OPTION_IGNORE_COLOR);
-            bool mesh = get_option(OPTION_PLY_MESH) != 0;
-            bool binary = get_option(OPTION_PLY_BINARY) != 0;
-            bool use_normals = get_option(OPTION_PLY_NORMALS) != 0;
+        // Without a color frame, the vertices have no color
+        void write(const std::string& fname, points p, video_frame color = video_frame(frame()))
+        {
+            const bool use_texcoords = bool(color);
             const auto verts = p.get_vertices();
             const auto texcoords = p.get_texture_coordinates();
-            const uint8_t* texture_data;
-            if (use_texcoords) // texture might be on the gpu, get pointer to data before for-loop to avoid repeated access
+            const size_t count = p.size();
+            const uint8_t* texture_data = nullptr;
+            if (use_texcoords) // texture might be on the gpu, get pointer to data before the loop to avoid repeated access
                 texture_data = reinterpret_cast<const uint8_t*>(color.get_data());
-            std::vector<rs2::vertex> new_verts;
-            std::vector<vec3d> normals;
-            std::vector<std::array<uint8_t, 3>> new_tex;
-            std::map<size_t, size_t> idx_map;
-            std::map<size_t, std::vector<vec3d>> index_to_normals;
-
-            new_verts.reserve(p.size());
-            if (use_texcoords) new_tex.reserve(p.size());
 
             static const auto min_distance = 1e-6;
 
-            for (size_t i = 0; i < p.size(); ++i) {
+            _index.assign(count, -1);
+            _verts.clear();
+            _colors.clear();
+            for (size_t i = 0; i < count; ++i)
+            {
                 if (fabs(verts[i].x) >= min_distance || fabs(verts[i].y) >= min_distance ||
                     fabs(verts[i].z) >= min_distance)
                 {
-                    idx_map[int(i)] = int(new_verts.size());
-                    new_verts.push_back({ verts[i].x, -1 * verts[i].y, -1 * verts[i].z });
+                    _index[i] = int(_verts.size());
+                    _verts.push_back({ verts[i].x, -1 * verts[i].y, -1 * verts[i].z });
                     if (use_texcoords)
-                    {
-                        auto rgb = get_texcolor(color, texture_data, texcoords[i].u, texcoords[i].v);
-                        new_tex.push_back(rgb);
-                    }
+                        _colors.push_back(get_texcolor(color, texture_data, texcoords[i].u, texcoords[i].v));
                 }
             }
 
             auto profile = p.get_profile().as<video_stream_profile>();
-            auto width = profile.width(), height = profile.height();
-            static const auto threshold = get_option(OPTION_PLY_THRESHOLD);
-            std::vector<std::array<size_t, 3>> faces;
+            const size_t width = profile.width(), height = profile.height();
+            // Faces connect neighbouring pixels: there are none unless there is a point per pixel
+            const bool mesh = _settings.mesh && width > 1 && height > 1 && count == width * height;
+            const bool use_normals = mesh && _settings.normals;
+            const auto threshold = _settings.threshold;
+
+            _faces.clear();
+            if (use_normals)
+                _normals.assign(_verts.size(), { 0, 0, 0 });
             if (mesh)
             {
                 for (size_t x = 0; x < width - 1; ++x) {
@@ -122,160 +103,123 @@ namespace rs2
                             && fabs(verts[a].z - verts[b].z) < threshold && fabs(verts[a].z - verts[c].z) < threshold
                             && fabs(verts[b].z - verts[d].z) < threshold && fabs(verts[c].z - verts[d].z) < threshold)
                         {
-                            if (idx_map.count(a) == 0 || idx_map.count(b) == 0 || idx_map.count(c) == 0 ||
-                                idx_map.count(d) == 0)
+                            const int ia = _index[a], ib = _index[b], ic = _index[c], id = _index[d];
+                            if (ia < 0 || ib < 0 || ic < 0 || id < 0)
                                 continue;
-                            faces.push_back({ idx_map[a], idx_map[d], idx_map[b] });
-                            faces.push_back({ idx_map[d], idx_map[a], idx_map[c] });
+                            _faces.insert(_faces.end(), { ia, id, ib, id, ia, ic });
 
                             if (use_normals)
                             {
-                                vec3d point_a = { verts[a].x ,  -1 * verts[a].y,  -1 * verts[a].z };
-                                vec3d point_b = { verts[b].x ,  -1 * verts[b].y,  -1 * verts[b].z };
-                                vec3d point_c = { verts[c].x ,  -1 * verts[c].y,  -1 * verts[c].z };
-                                vec3d point_d = { verts[d].x ,  -1 * verts[d].y,  -1 * verts[d].z };
+                                const auto& point_a = _verts[ia];
+                                const auto& point_b = _verts[ib];
+                                const auto& point_c = _verts[ic];
+                                const auto& point_d = _verts[id];
 
                                 auto n1 = cross(point_d - point_a, point_b - point_a);
                                 auto n2 = cross(point_c - point_a, point_d - point_a);
 
-                                index_to_normals[idx_map[a]].push_back(n1);
-                                index_to_normals[idx_map[a]].push_back(n2);
-
-                                index_to_normals[idx_map[b]].push_back(n1);
-
-                                index_to_normals[idx_map[c]].push_back(n2);
-
-                                index_to_normals[idx_map[d]].push_back(n1);
-                                index_to_normals[idx_map[d]].push_back(n2);
+                                _normals[ia] = _normals[ia] + n1 + n2;
+                                _normals[ib] = _normals[ib] + n1;
+                                _normals[ic] = _normals[ic] + n2;
+                                _normals[id] = _normals[id] + n1 + n2;
                             }
                         }
                     }
                 }
             }
-
-            if (mesh && use_normals)
+            if (use_normals)
             {
-                for (size_t i = 0; i < new_verts.size(); ++i)
-                {
-                    auto normals_vec = index_to_normals[i];
-                    vec3d sum = { 0, 0, 0 };
-                    for (auto& n : normals_vec)
-                        sum = sum + n;
-                    if (normals_vec.size() > 0)
-                        normals.push_back((sum.normalize()));
-                    else
-                        normals.push_back({ 0, 0, 0 });
-                }
+                // Vertices that are not on any face keep a zero normal
+                for (auto& n : _normals)
+                    if (n.x || n.y || n.z)
+                        n = n.normalize();
             }
 
-            std::ofstream out(fname);
-            out << "ply\n";
-            if (binary)
-                out << "format binary_little_endian 1.0\n";
+            std::ostringstream header;
+            header << "ply\n";
+            if (_settings.binary)
+                header << "format binary_little_endian 1.0\n";
             else
-                out << "format ascii 1.0\n";
-            out << "comment pointcloud saved from Realsense Viewer\n";
-            out << "element vertex " << new_verts.size() << "\n";
-            out << "property float" << sizeof(float) * 8 << " x\n";
-            out << "property float" << sizeof(float) * 8 << " y\n";
-            out << "property float" << sizeof(float) * 8 << " z\n";
-            if (mesh && use_normals)
+                header << "format ascii 1.0\n";
+            header << "comment pointcloud saved from Realsense Viewer\n";
+            header << "element vertex " << _verts.size() << "\n";
+            header << "property float" << sizeof(float) * 8 << " x\n";
+            header << "property float" << sizeof(float) * 8 << " y\n";
+            header << "property float" << sizeof(float) * 8 << " z\n";
+            if (use_normals)
             {
-                out << "property float" << sizeof(float) * 8 << " nx\n";
-                out << "property float" << sizeof(float) * 8 << " ny\n";
-                out << "property float" << sizeof(float) * 8 << " nz\n";
+                header << "property float" << sizeof(float) * 8 << " nx\n";
+                header << "property float" << sizeof(float) * 8 << " ny\n";
+                header << "property float" << sizeof(float) * 8 << " nz\n";
             }
             if (use_texcoords)
             {
-                out << "property uchar red\n";
-                out << "property uchar green\n";
-                out << "property uchar blue\n";
+                header << "property uchar red\n";
+                header << "property uchar green\n";
+                header << "property uchar blue\n";
             }
-            if (mesh)
+            if (_settings.mesh)
             {
-                out << "element face " << faces.size() << "\n";
-                out << "property list uchar int vertex_indices\n";
+                header << "element face " << _faces.size() / 3 << "\n";
+                header << "property list uchar int vertex_indices\n";
             }
-            out << "end_header\n";
+            header << "end_header\n";
 
-            if (binary)
+            _buffer = header.str();
+            if (_settings.binary)
             {
-                out.close();
-                out.open(fname, std::ios_base::app | std::ios_base::binary);
-                for (size_t i = 0; i < new_verts.size(); ++i)
+                // we assume little endian architecture on your device
+                const size_t vertex_size = 3 * sizeof(float) * (use_normals ? 2 : 1) + (use_texcoords ? 3 : 0);
+                const size_t face_size = 1 + 3 * sizeof(int);
+                size_t offset = _buffer.size();
+                _buffer.resize(offset + _verts.size() * vertex_size + _faces.size() / 3 * face_size);
+                char* out = &_buffer[offset];
+                for (size_t i = 0; i < _verts.size(); ++i)
                 {
-                    // we assume little endian architecture on your device
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].x)), sizeof(float));
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].y)), sizeof(float));
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].z)), sizeof(float));
-
-                    if (mesh && use_normals)
+                    memcpy(out, &_verts[i], 3 * sizeof(float));
+                    out += 3 * sizeof(float);
+                    if (use_normals)
                     {
-                        out.write(reinterpret_cast<const char*>(&(normals[i].x)), sizeof(float));
-                        out.write(reinterpret_cast<const char*>(&(normals[i].y)), sizeof(float));
-                        out.write(reinterpret_cast<const char*>(&(normals[i].z)), sizeof(float));
+                        memcpy(out, &_normals[i], 3 * sizeof(float));
+                        out += 3 * sizeof(float);
                     }
-
                     if (use_texcoords)
                     {
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][0])), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][1])), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][2])), sizeof(uint8_t));
+                        memcpy(out, _colors[i].data(), 3);
+                        out += 3;
                     }
                 }
-                if (mesh)
+                for (size_t i = 0; i < _faces.size(); i += 3)
                 {
-                    auto size = faces.size();
-                    for (size_t i = 0; i < size; ++i) {
-                        static const int three = 3;
-                        out.write(reinterpret_cast<const char*>(&three), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][0])), sizeof(int));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][1])), sizeof(int));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][2])), sizeof(int));
-                    }
+                    *out++ = 3;
+                    memcpy(out, &_faces[i], 3 * sizeof(int));
+                    out += 3 * sizeof(int);
                 }
             }
             else
             {
-                for (size_t i = 0; i <new_verts.size(); ++i)
+                // Same text as the standard stream's default formatting (%g)
+                char line[128];
+                for (size_t i = 0; i < _verts.size(); ++i)
                 {
-                    out << new_verts[i].x << " ";
-                    out << new_verts[i].y << " ";
-                    out << new_verts[i].z << " ";
-                    out << "\n";
-
-                    if (mesh && use_normals)
-                    {
-                        out << normals[i].x << " ";
-                        out << normals[i].y << " ";
-                        out << normals[i].z << " ";
-                        out << "\n";
-                    }
-
+                    _buffer.append(line, snprintf(line, sizeof(line), "%g %g %g \n", _verts[i].x, _verts[i].y, _verts[i].z));
+                    if (use_normals)
+                        _buffer.append(line, snprintf(line, sizeof(line), "%g %g %g \n", _normals[i].x, _normals[i].y, _normals[i].z));
                     if (use_texcoords)
-                    {
-                        out << unsigned(new_tex[i][0]) << " ";
-                        out << unsigned(new_tex[i][1]) << " ";
-                        out << unsigned(new_tex[i][2]) << " ";
-                        out << "\n";
-                    }
-                }
-                if (mesh)
-                {
-                    auto size = faces.size();
-                    for (size_t i = 0; i < size; ++i) {
-                        int three = 3;
-                        out << three << " ";
-                        out << std::get<0>(faces[i]) << " ";
-                        out << std::get<1>(faces[i]) << " ";
-                        out << std::get<2>(faces[i]) << " ";
-                        out << "\n";
-                    }
+                        _buffer.append(line, snprintf(line, sizeof(line), "%u %u %u \n", unsigned(_colors[i][0]), unsigned(_colors[i][1]), unsigned(_colors[i][2])));
                 }
+                for (size_t i = 0; i < _faces.size(); i += 3)
+                    _buffer.append(line, snprintf(line, sizeof(line), "3 %d %d %d \n", _faces[i], _faces[i + 1], _faces[i + 2]));
             }
+
+            std::ofstream out(fname, std::ios_base::binary);
+            out.write(_buffer.data(), _buffer.size());
+            if (!out)
+                throw std::runtime_error("Failed to write " + fname);
         }
 
-        std::array<uint8_t, 3> get_texcolor(const video_frame& texture, const uint8_t* texture_data, float u, float v)
+    private:
+        static std::array<uint8_t, 3> get_texcolor(const video_frame& texture, const uint8_t* texture_data, float u, float v)
         {
             const int w = texture.get_width(), h = texture.get_height();
             int x = std::min(std::max(int(u*w + .5f), 0), w - 1);
@@ -284,8 +228,83 @@ namespace rs2
             return { texture_data[idx], texture_data[idx + 1], texture_data[idx + 2] };
         }
 
+        settings _settings;
+        std::vector<int> _index;       // of each point's vertex, -1 if it has none
+        std::vector<vec3d> _verts;
+        std::vector<vec3d> _normals;
+        std::vector<std::array<uint8_t, 3>> _colors;
+        std::vector<int> _faces;       // three vertices each
+        std::string _buffer;
+    };
+
+    class save_to_ply : public filter
+    {
+    public:
+        static const auto OPTION_IGNORE_COLOR = rs2_option(RS2_OPTION_COUNT + 10);
+        static const auto OPTION_PLY_MESH = rs2_option(RS2_OPTION_COUNT + 11);
+        static const auto OPTION_PLY_BINARY = rs2_option(RS2_OPTION_COUNT + 12);
+        static const auto OPTION_PLY_NORMALS = rs2_option(RS2_OPTION_COUNT + 13);
+        static const auto OPTION_PLY_THRESHOLD = rs2_option(RS2_OPTION_COUNT + 14);
+        // Write each frame to a file of its own, named with the filename as prefix followed by the frame number
+        static const auto OPTION_PLY_SEQUENCE = rs2_option(RS2_OPTION_COUNT + 15);
+
+        save_to_ply(std::string filename = "RealSense Pointcloud ", pointcloud pc = pointcloud()) : filter([this](frame f, frame_source& s) { func(f, s); }),
+            _pc(std::move(pc)), fname(filename)
+        {
+            register_simple_option(OPTION_IGNORE_COLOR, option_range{ 0, 1, 0, 1 });
+            register_simple_option(OPTION_PLY_MESH, option_range{ 0, 1, 1, 1 });
+            register_simple_option(OPTION_PLY_NORMALS, option_range{ 0, 1, 0, 1 });
+            register_simple_option(OPTION_PLY_BINARY, option_range{ 0, 1, 1, 1 });
+            register_simple_option(OPTION_PLY_THRESHOLD, option_range{ 0, 1, 0.05f, 0 });
+            register_simple_option(OPTION_PLY_SEQUENCE, option_range{ 0, 1, 0, 1 });
+        }
+
+    private:
+        void func(frame data, frame_source& source)
+        {
+            frame depth, color;
+            if (auto fs = data.as<frameset>()) {
+                for (auto f : fs) {
+                    if (f.is<points>()) depth = f;
+                    else if (!depth && f.is<depth_frame>()) depth = f;
+                    else if (!color && f.is<video_frame>()) color = f;
+                }
+            } else if (data.is<depth_frame>() || data.is<points>()) {
+                depth = data;
+            }
+
+            if (!depth) throw std::runtime_error("Need depth data to save PLY");
+            if (!depth.is<points>()) {
+                if (color) _pc.map_to(color);
+                depth = _pc.calculate(depth);
+            }
+
+            export_to_ply(depth, color);
+            source.frame_ready(data); // passthrough filter because processing_block::process doesn't support sinks
+        }
+
+        void export_to_ply(points p, video_frame color) {
+            auto& settings = _writer.get_settings();
+            settings.mesh = get_option(OPTION_PLY_MESH) != 0;
+            settings.binary = get_option(OPTION_PLY_BINARY) != 0;
+            settings.normals = get_option(OPTION_PLY_NORMALS) != 0;
+            settings.threshold = get_option(OPTION_PLY_THRESHOLD);
+            if (get_option(OPTION_IGNORE_COLOR))
+                color = video_frame(frame());
+
+            if (get_option(OPTION_PLY_SEQUENCE))
+            {
+                std::stringstream name;
+                name << fname << p.get_frame_number() << ".ply";
+                _writer.write(name.str(), p, color);
+            }
+            else
+                _writer.write(fname, p, color);
+        }
+
         std::string fname;
         pointcloud _pc;
+        ply_writer _writer;
     };
 
     class save_single_frameset : public filter {
@@ -154,6 +154,30 @@ namespace rs2
             return res;
         }
         /**
+        * Get the latency statistics collected so far for this stream, from the backend to the user
+        * \param[in] reset  clear the statistics after reading them
+        */
+        rs2_stream_stats get_stats(bool reset = false) const
+        {
+            rs2_error* e = nullptr;
+            rs2_stream_stats res;
+            rs2_get_stream_stats(get(), &res, reset ? 1 : 0, &e);
+            error::handle(e);
+            return res;
+        }
+        /**
+        * Get the frames of this stream dropped so far, by the stage that dropped them
+        * \param[in] reset  clear the counters after reading them
+        */
+        rs2_frame_drops get_frame_drops(bool reset = false) const
+        {
+            rs2_error* e = nullptr;
+            rs2_frame_drops res;
+            rs2_get_stream_frame_drops(get(), &res, reset ? 1 : 0, &e);
+            error::handle(e);
+            return res;
+        }
+        /**
         * Assign extrinsic transformation parameters to a specific profile (sensor). The extrinsic information is generally available as part of the camera calibration, and librealsense is responsible for retrieving and assigning these parameters where appropriate.
         * This specific function is intended for synthetic/mock-up (software) devices for which the parameters are produced and injected by the user.
         * \param[in] stream_profile to - which stream profile to be registered with the extrinsic.
@@ -801,6 +825,18 @@ namespace rs2
             return (const texture_coordinate*)res;
         }
 
+        /**
+        * Retrieve the depth pixel index of every point, when the point cloud holds only valid points
+        * \return int* - pointer to size() indices, or null if they were not kept
+        */
+        const int* get_pixel_indices() const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_get_frame_points_pixel_indices(get(), &e);
+            error::handle(e);
+            return res;
+        }
+
         size_t size() const
         {
             return _size;
@@ -842,6 +878,32 @@ namespace rs2
             return r;
         }
 
+        /**
+        * Retrieve the distance of many pixels at once, in a single call
+        * \param[in] pixels    - count (x, y) pairs of pixel coordinates
+        * \param[in] count     - number of pixels
+        * \param[out] distances - receives the depth in metric units of each pixel
+        */
+        void get_distances(const int* pixels, int count, float* distances) const
+        {
+            rs2_error * e = nullptr;
+            rs2_depth_frame_get_distances(get(), pixels, count, distances, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Retrieve the distance of every pixel
+        * \return std::vector<float> - depth in metric units, width * height of them, row by row
+        */
+        std::vector<float> get_distances() const
+        {
+            std::vector<float> distances(size_t(get_width()) * get_height());
+            rs2_error * e = nullptr;
+            rs2_depth_frame_get_all_distances(get(), distances.data(), int(distances.size()), &e);
+            error::handle(e);
+            return distances;
+        }
+
         /**
         * Provide the scaling factor to use when converting from get_data() units to meters
         * \return float - depth, in meters, per 1 unit stored in the frame data
@@ -911,6 +973,22 @@ namespace rs2
             auto data = reinterpret_cast<const float*>(get_data());
             return rs2_vector{ data[0], data[1], data[2] };
         }
+        /**
+        * Retrieve the samples of an RS2_FORMAT_MOTION_BATCH frame, oldest first
+        * \return pointer to get_motion_sample_count() samples
+        */
+        const rs2_motion_sample* get_motion_samples() const
+        {
+            return reinterpret_cast<const rs2_motion_sample*>(get_data());
+        }
+        /**
+        * Retrieve the number of samples in an RS2_FORMAT_MOTION_BATCH frame
+        * \return number of samples
+        */
+        size_t get_motion_sample_count() const
+        {
+            return get_data_size() / sizeof(rs2_motion_sample);
+        }
     };
 
     class pose_frame : public frame
@@ -42,6 +42,21 @@ namespace rs2
         void release() override { delete this; }
     };
 
+    template<class T>
+    class software_device_frameset_release_callback : public rs2_software_device_frameset_release_callback
+    {
+        T on_release_function;
+    public:
+        explicit software_device_frameset_release_callback(T on_release) : on_release_function(on_release) {}
+
+        void on_frameset_release(int frame_number) override
+        {
+            on_release_function(frame_number);
+        }
+
+        void release() override { delete this; }
+    };
+
     class software_sensor : public sensor
     {
     public:
@@ -268,6 +283,21 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Register a callback for frames injected with a null deleter, whose buffers are borrowed from the caller: it
+        * is called with the frame number once all the frames injected with that number are released, so the buffers
+        * can be reused. Frames with a deleter are unaffected.
+        * \param[in] callback   void(int frame_number)
+        */
+        template<class T>
+        void set_frameset_release_callback(T callback) const
+        {
+            rs2_error* e = nullptr;
+            rs2_software_device_set_frameset_release_callback_cpp(_dev.get(),
+                new software_device_frameset_release_callback<T>(std::move(callback)), &e);
+            error::handle(e);
+        }
+
         /**
         * Add software device to existing context.
         * Any future queries on the context will return this device.
@@ -260,6 +260,24 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * write several options at once: all are checked first, and none is left changed if one fails
+        * \param[in] values     option ids and their new values, written in this order
+        */
+        void apply_options(const std::vector<std::pair<rs2_option, float>>& values) const
+        {
+            std::vector<rs2_option> ids;
+            std::vector<float> vals;
+            for (auto&& v : values)
+            {
+                ids.push_back(v.first);
+                vals.push_back(v.second);
+            }
+            rs2_error* e = nullptr;
+            rs2_apply_options(_options, ids.data(), vals.data(), static_cast<int>(ids.size()), &e);
+            error::handle(e);
+        }
+
         /**
         * write new value to the option
         * \param[in] option     option id to be queried
@@ -285,6 +303,19 @@ namespace rs2
             return res > 0;
         }
 
+        /**
+        * check if particular option can be changed while streaming
+        * \param[in] option     option id to be checked
+        * \return true if the option can be set while the sensor streams
+        */
+        bool can_set_option_while_streaming(rs2_option option) const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_can_set_option_while_streaming(_options, option, &e);
+            error::handle(e);
+            return res > 0;
+        }
+
         /**
          * sets a callback in case an option in this options container value is updated
          * \param[in] callback     the callback function
@@ -516,6 +516,28 @@ namespace rs2
             return frameset(f);
         }
 
+        /**
+        * Wait until a batch of frames sets becomes available, in a single call; for each, as wait_for_frames() does.
+        * Sets published while the method wasn't called are dropped, as with wait_for_frames().
+        *
+        * \param[in] count        Frames sets in a batch
+        * \param[in] timeout_ms   Max time in milliseconds to wait for the whole batch; if it expires first, the sets that
+        *                         did arrive are returned, and if none did, an exception is thrown
+        * \return                 The frames sets, oldest first
+        */
+        std::vector<frameset> wait_for_frames(size_t count, unsigned int timeout_ms) const
+        {
+            rs2_error* e = nullptr;
+            std::vector<rs2_frame*> refs(count);
+            auto n = rs2_pipeline_wait_for_frames_batch(_pipeline.get(), refs.data(), static_cast<int>(count), timeout_ms, &e);
+            error::handle(e);
+            std::vector<frameset> framesets;
+            framesets.reserve(n);
+            for (int i = 0; i < n; ++i)
+                framesets.emplace_back(frame(refs[i]));
+            return framesets;
+        }
+
         /**
         * Check if a new set of frames is available and retrieve the latest undelivered set.
         * The frames set includes time-synchronized frames of each enabled stream in the pipeline.
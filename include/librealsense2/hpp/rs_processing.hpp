@@ -8,6 +8,8 @@
 #include "rs_frame.hpp"
 #include "rs_options.hpp"
 
+#include <mutex>
+
 namespace rs2
 {
     /**
@@ -202,6 +204,27 @@ namespace rs2
             if (res) *output = f;
             return res > 0;
         }
+
+        /**
+        * wait until a batch of frames is available in the queue and dequeue them all at once
+        * \param[in] count       frames in a batch; no more than the capacity of the queue
+        * \param[in] timeout_ms  max time to wait for the whole batch; if it expires first, the frames that did arrive
+        *                        are returned, and if none did, an exception is thrown
+        * \return the frames, oldest first
+        */
+        std::vector<frame> wait_for_frames(size_t count, unsigned int timeout_ms = 5000) const
+        {
+            rs2_error* e = nullptr;
+            std::vector<rs2_frame*> refs(count);
+            auto n = rs2_wait_for_frame_batch(_queue.get(), refs.data(), static_cast<int>(count), timeout_ms, &e);
+            error::handle(e);
+            std::vector<frame> frames;
+            frames.reserve(n);
+            for (int i = 0; i < n; ++i)
+                frames.emplace_back(refs[i]);
+            return frames;
+        }
+
         /**
         * Does the same thing as enqueue function.
         */
@@ -245,6 +268,24 @@ namespace rs2
         bool _keep;
     };
 
+    /**
+    * Pack video frames of the same stream profile into a single frame, as an N x C x H x W tensor: frame after frame,
+    * each as a plane per channel. The frame comes from the same frame pool as the frames (see rs2_pack_frames_nchw)
+    * \param[in] frames  the frames to pack, e.g. the same stream from each frameset of a batch
+    * \return the packed frame, W wide and N*C*H high
+    */
+    inline video_frame pack_frames_nchw(const std::vector<frame>& frames)
+    {
+        rs2_error* e = nullptr;
+        std::vector<rs2_frame*> refs;
+        refs.reserve(frames.size());
+        for (auto&& f : frames)
+            refs.push_back(f.get());
+        frame packed(rs2_pack_frames_nchw(refs.data(), static_cast<int>(refs.size()), &e));
+        error::handle(e);
+        return video_frame(packed);
+    }
+
     /**
     * Define the processing block flow, inherit this class to generate your own processing_block. Please refer to the viewer class in examples.hpp for a detailed usage example.
     */
@@ -622,15 +663,17 @@ namespace rs2
     public:
         /**
         * Real asynchronous syncer within syncer class
+        * \param[in] across_devices  also match the framesets of different devices with each other
         */
-        asynchronous_syncer() : processing_block(init()) {}
+        asynchronous_syncer(bool across_devices = false) : processing_block(init(across_devices)) {}
 
     private:
-        std::shared_ptr<rs2_processing_block> init()
+        std::shared_ptr<rs2_processing_block> init(bool across_devices)
         {
             rs2_error* e = nullptr;
             auto block = std::shared_ptr<rs2_processing_block>(
-                rs2_create_sync_processing_block(&e),
+                across_devices ? rs2_create_multi_device_sync_processing_block(&e)
+                               : rs2_create_sync_processing_block(&e),
                 rs2_delete_processing_block);
 
             error::handle(e);
@@ -643,9 +686,12 @@ namespace rs2
     public:
         /**
         * Sync instance to align frames from different streams
+        * \param[in] queue_size      number of framesets to keep for wait_for_frames / poll_for_frames
+        * \param[in] across_devices  also match the framesets of different devices with each other, by timestamp;
+        *                            the devices should have RS2_OPTION_GLOBAL_TIME_ENABLED on
         */
-        syncer(int queue_size = 1)
-            :_results(queue_size)
+        syncer(int queue_size = 1, bool across_devices = false)
+            :_sync(across_devices), _results(queue_size)
         {
             _sync.start(_results);
         }
@@ -697,6 +743,16 @@ namespace rs2
         {
             _sync.invoke(std::move(f));
         }
+
+        /**
+        * Bound how long a frameset can be held back waiting for a stream that is late
+        * \param[in] max_latency_ms  Once a stream is this many milliseconds past its expected frame, framesets are
+        *                            released without it; 0 (the default) waits as long as its frame rate allows
+        */
+        void set_max_latency(float max_latency_ms)
+        {
+            _sync.set_option(RS2_OPTION_MAX_LATENCY, max_latency_ms);
+        }
     private:
         asynchronous_syncer _sync;
         frame_queue _results;
@@ -719,6 +775,15 @@ namespace rs2
         */
         align(rs2_stream align_to) : filter(init(align_to), 1) {}
 
+        /**
+        Create align filter that aligns depth to several streams at once
+        Each depth pixel is deprojected once and mapped onto all the other images, instead of once per rs2::align.
+        The output frameset holds a depth frame aligned to each of the streams found in the input, in the given order.
+
+        * \param[in] align_to      The stream types to align depth to; depth cannot be one of them.
+        */
+        align(const std::vector<rs2_stream>& align_to) : filter(init(align_to), 1) {}
+
         using filter::process;
 
         /**
@@ -747,6 +812,17 @@ namespace rs2
 
             return block;
         }
+
+        std::shared_ptr<rs2_processing_block> init(const std::vector<rs2_stream>& align_to)
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_align_to_streams(align_to.data(), int(align_to.size()), &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
     };
 
     class colorizer : public filter
@@ -1086,6 +1162,135 @@ namespace rs2
         }
     };
 
+    class depth_postprocess : public filter
+    {
+    public:
+        /**
+        * Create depth post-processing block
+        * Runs decimation, depth to disparity, spatial, temporal, disparity to depth and hole filling in one pass, with
+        * the same output as the separate filters. Hole filling is disabled to begin with.
+        */
+        depth_postprocess() : filter(init(), 1) {}
+
+        /**
+        * The block of one of the stages, to set its options; it is not meant to process frames of its own
+        * \param[in] stage - RS2_EXTENSION_DECIMATION_FILTER, RS2_EXTENSION_DISPARITY_FILTER, RS2_EXTENSION_SPATIAL_FILTER,
+        *                    RS2_EXTENSION_TEMPORAL_FILTER or RS2_EXTENSION_HOLE_FILLING_FILTER
+        */
+        processing_block get_stage(rs2_extension stage) const
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_get_depth_postprocess_stage(_block.get(), stage, &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+            return processing_block(block);
+        }
+
+        /**
+        * Enable or disable one of the stages
+        * \param[in] stage  - as for get_stage()
+        * \param[in] enable - whether the stage runs
+        */
+        void enable_stage(rs2_extension stage, bool enable)
+        {
+            rs2_error* e = nullptr;
+            rs2_enable_depth_postprocess_stage(_block.get(), stage, enable ? 1 : 0, &e);
+            error::handle(e);
+        }
+
+    private:
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_depth_postprocess_block(&e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
+
+    class rectify : public filter
+    {
+    public:
+        /**
+        * Create rectify processing block
+        * Undistorts color frames into a pinhole image with the same focal length and principal point; the output
+        * profile's intrinsics have no distortion, for align, pointcloud etc. to work with.
+        */
+        rectify() : filter(init(), 1) {}
+
+    private:
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_rectify_block(&e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
+
+    class fused_pointcloud : public filter
+    {
+    public:
+        /**
+        * Create fused pointcloud processing block
+        * Merges the depth frames of several cameras, in one frameset, into the points of the whole rig
+        */
+        fused_pointcloud() : filter(init(), 1) {}
+
+        /**
+        * Set where a camera is in the rig; cameras not set are at its origin
+        * \param[in] serial      the camera's RS2_CAMERA_INFO_SERIAL_NUMBER
+        * \param[in] extrinsics  transformation from the camera's depth coordinates to the rig's
+        */
+        void set_extrinsics(const std::string& serial, const rs2_extrinsics& extrinsics)
+        {
+            rs2_error* e = nullptr;
+            rs2_set_fused_pointcloud_extrinsics(_block.get(), serial.c_str(), &extrinsics, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Generate the points of all the depth frames in a frameset
+        * \param[in] frames  the depth frames of the cameras, each other frame being ignored
+        * \return points in the rig's coordinates
+        */
+        points calculate(frame frames) const
+        {
+            auto res = process(frames);
+            if (res.as<points>())
+                return res;
+
+            if (auto set = res.as<frameset>())
+            {
+                for (auto f : set)
+                {
+                    if (f.as<points>())
+                        return f;
+                }
+            }
+            throw std::runtime_error("Error occured during execution of the processing block! See the log for more info");
+        }
+
+    private:
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_fused_pointcloud_block(&e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
+
     class rates_printer : public filter
     {
     public:
@@ -1188,5 +1393,161 @@ namespace rs2
             return block;
         }
     };
+
+    /**
+    * Processing blocks connected into a graph, each fed with the frames output by the blocks before it: for example a
+    * syncer feeding align, which feeds both a pointcloud and a colorizer. A block may feed several others, and the
+    * graph's blocks are switched to RS2_OPTION_ASYNC_PROCESSING, so independent branches run concurrently on the
+    * library's worker pool while each block still gets its frames one at a time, in order. Frames are reference
+    * counted: an output frame goes back to its block for reuse once every consumer has released it.
+    *
+    * The graph takes over the blocks' output callbacks, so a filter added to it can no longer be used with process().
+    */
+    class processing_graph
+    {
+    public:
+        typedef size_t node_id;
+
+        /**
+        * \param[in] concurrent   Whether to switch the blocks to RS2_OPTION_ASYNC_PROCESSING; otherwise each frame is
+        *                         processed through the whole graph on the thread that invokes it
+        */
+        explicit processing_graph(bool concurrent = true) : _concurrent(concurrent) {}
+
+        /**
+        * Add a block, fed with the frames passed to invoke()
+        * \return the id of the new node
+        */
+        node_id add(processing_block const & block)
+        {
+            auto id = add_node(block);
+            std::lock_guard<std::mutex> lock(_mutex);
+            _roots.push_back(block);
+            return id;
+        }
+
+        /**
+        * Add a block, fed with the frames another node outputs
+        * \return the id of the new node
+        */
+        node_id add(processing_block const & block, node_id from)
+        {
+            auto id = add_node(block);
+            connect(from, id);
+            return id;
+        }
+
+        /**
+        * Also feed a node with the frames another one outputs. Nodes only feed nodes added after them, which keeps
+        * the graph free of cycles.
+        */
+        void connect(node_id from, node_id to)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (from >= to || to >= _nodes.size())
+                throw std::runtime_error("processing_graph nodes can only feed nodes added after them");
+            auto& n = *_nodes[from];
+            std::lock_guard<std::mutex> node_lock(n.mutex);
+            n.consumers.push_back(_nodes[to]->block);
+        }
+
+        /**
+        * Call on_frame with every frame a node outputs, on the thread that processed it
+        */
+        template<class S>
+        void on_output(node_id node, S on_frame)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (node >= _nodes.size())
+                throw std::runtime_error("No such processing_graph node");
+            auto& n = *_nodes[node];
+            std::lock_guard<std::mutex> node_lock(n.mutex);
+            n.outputs.push_back(on_frame);
+        }
+
+        /**
+        * Feed the frame to the blocks that were added without an input node
+        */
+        void invoke(frame f) const
+        {
+            std::vector<processing_block> roots;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                roots = _roots;
+            }
+            for (auto&& block : roots)
+                block.invoke(f);
+        }
+
+        /**
+        * Timing and frame counters of a node's block, as its RS2_CAMERA_INFO_PROCESSING_STATS; collection is turned on
+        * when the block is added
+        */
+        std::string get_stats(node_id node) const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (node >= _nodes.size())
+                throw std::runtime_error("No such processing_graph node");
+            auto& block = _nodes[node]->block;
+            return block.supports(RS2_CAMERA_INFO_PROCESSING_STATS) ? block.get_info(RS2_CAMERA_INFO_PROCESSING_STATS) : "";
+        }
+
+        size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _nodes.size();
+        }
+
+    private:
+        struct node
+        {
+            processing_block block;
+            std::mutex mutex;
+            std::vector<processing_block> consumers;
+            std::vector<std::function<void(frame)>> outputs;
+
+            explicit node(processing_block const & b) : block(b) {}
+
+            void deliver(frame f)
+            {
+                std::vector<processing_block> to;
+                std::vector<std::function<void(frame)>> callbacks;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    to = consumers;
+                    callbacks = outputs;
+                }
+                for (auto&& block : to)
+                    block.invoke(f);
+                for (auto&& callback : callbacks)
+                    callback(f);
+            }
+        };
+
+        node_id add_node(processing_block block)
+        {
+            if (_concurrent && block.supports(RS2_OPTION_ASYNC_PROCESSING))
+                block.set_option(RS2_OPTION_ASYNC_PROCESSING, 1.f);
+            if (block.supports(RS2_OPTION_PROCESSING_STATS))
+                block.set_option(RS2_OPTION_PROCESSING_STATS, 1.f);
+
+            auto n = std::make_shared<node>(block);
+            // The block owns its callback, so the callback must not own the node (and with it the block)
+            std::weak_ptr<node> weak = n;
+            block.start([weak](frame f) {
+                if (auto n = weak.lock())
+                    n->deliver(std::move(f));
+            });
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            _nodes.push_back(n);
+            return _nodes.size() - 1;
+        }
+
+        bool _concurrent;
+        mutable std::mutex _mutex;
+        std::vector<std::shared_ptr<node>> _nodes;
+        std::vector<processing_block> _roots;
+    };
 }
 #endif // LIBREALSENSE_RS2_PROCESSING_HPP
@@ -126,6 +126,29 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Read up to 'depth' samples ahead of the ones being delivered, on a separate thread
+        * \param[in] depth  Maximum number of samples read in advance, or 0 to disable read-ahead
+        */
+        void set_prefetch_depth(unsigned int depth) const
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_device_set_prefetch_depth(_dev.get(), depth, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Play this recording and 'other' on one clock, reading both ahead on a shared pool of threads.
+        * Pause, resume, seek and set_playback_speed on either then apply to both.
+        * \param[in] other  Another playback device
+        */
+        void sync_with(const playback& other) const
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_device_sync_with(_dev.get(), other._dev.get(), &e);
+            error::handle(e);
+        }
+
         /**
         * Set the playing speed
         * \param[in] speed  Indicates a multiplication of the speed to play (e.g: 1 = normal, 0.5 twice as slow)
@@ -137,6 +160,18 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Gets the number of frames that real-time playback dropped because they were not consumed in time
+        * \return The number of frames read from the file but not delivered
+        */
+        unsigned long long get_dropped_frames() const
+        {
+            rs2_error* e = nullptr;
+            auto dropped = rs2_playback_device_get_dropped_frames(_dev.get(), &e);
+            error::handle(e);
+            return dropped;
+        }
+
         /**
         * Start passing frames into user provided callback
         * \param[in] callback   Stream callback, can be any callable object accepting rs2::frame
@@ -266,6 +301,30 @@ namespace rs2
             error::handle(e);
             return filename;
         }
+
+        /**
+        * Limits the number of frames waiting to be written to file
+        * \param[in]  max_frames  Maximum number of queued frames, or 0 for no limit
+        * \param[in]  policy      What to do with a new frame when the queue is full
+        */
+        void set_queue_limit(unsigned int max_frames, rs2_record_queue_policy policy = RS2_RECORD_QUEUE_POLICY_DROP_OLDEST)
+        {
+            rs2_error* e = nullptr;
+            rs2_record_device_set_queue_limit(_dev.get(), max_frames, policy, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Gets the number of frames that were discarded because the write queue was full
+        * \return The number of frames not written to file
+        */
+        unsigned long long get_dropped_frames() const
+        {
+            rs2_error* e = nullptr;
+            auto dropped = rs2_record_device_get_dropped_frames(_dev.get(), &e);
+            error::handle(e);
+            return dropped;
+        }
     protected:
         explicit recorder(std::shared_ptr<rs2_device> dev) : device(dev)
         {
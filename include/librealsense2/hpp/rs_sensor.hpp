@@ -98,6 +98,21 @@ namespace rs2
         void release() override { delete this; }
     };
 
+    template<class A, class D>
+    class frame_allocator : public rs2_frame_allocator
+    {
+        A allocate_function;
+        D deallocate_function;
+    public:
+        frame_allocator(A on_allocate, D on_deallocate)
+            : allocate_function(std::move(on_allocate)), deallocate_function(std::move(on_deallocate)) {}
+
+        void * allocate(size_t size) override { return allocate_function(size); }
+        void deallocate(void * buffer, size_t size) override { deallocate_function(buffer, size); }
+
+        void release() override { delete this; }
+    };
+
 
     class sensor : public options
     {
@@ -212,6 +227,44 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * provide the memory for frame payloads produced by the sensor, instead of the library's own buffers
+        * \param[in] allocate    callable accepting the size in bytes and returning a void* to at least that many bytes
+        *                        (or nullptr to let the library allocate the frame); called from streaming threads
+        * \param[in] deallocate  callable accepting the void* buffer and its size, called once the frame is released
+        */
+        template<class A, class D>
+        void set_frame_allocator(A allocate, D deallocate) const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator_cpp(_sensor.get(),
+                new frame_allocator<A, D>(std::move(allocate), std::move(deallocate)), &e);
+            error::handle(e);
+        }
+
+        /**
+        * go back to the library's own frame buffers
+        */
+        void reset_frame_allocator() const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator_cpp(_sensor.get(), nullptr, &e);
+            error::handle(e);
+        }
+
+        /**
+        * call the frame callback from a thread of the sensor's own, through a queue of up to 'size' frames, so that a
+        * slow callback does not hold up streaming; frames dropped when it is full are counted in the stream's frame drops
+        * \param[in] size         most frames waiting for the callback, or 0 to call it from the streaming thread
+        * \param[in] drop_newest  drop the arriving frame when the queue is full, rather than the oldest waiting one
+        */
+        void set_callback_queue(unsigned int size, bool drop_newest = false) const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_callback_queue(_sensor.get(), size, drop_newest ? 1 : 0, &e);
+            error::handle(e);
+        }
+
         /**
         * Retrieves the list of stream profiles supported by the sensor.
         * \return   list of stream profiles that given sensor can provide
@@ -400,6 +453,21 @@ namespace rs2
             error::handle(e);
         }
         operator bool() const { return _sensor.get() != nullptr; }
+
+        /**
+        * The recent samples of a motion stream with timestamps in [from_ms, to_ms], oldest first
+        * \param[in] stream       RS2_STREAM_ACCEL or RS2_STREAM_GYRO
+        * \param[in] max_samples  Upper limit on the number returned
+        */
+        std::vector<rs2_motion_sample> get_motion_samples(rs2_stream stream, double from_ms, double to_ms, int max_samples = 1024) const
+        {
+            std::vector<rs2_motion_sample> samples(max_samples);
+            rs2_error* e = nullptr;
+            auto n = rs2_get_motion_samples(_sensor.get(), stream, from_ms, to_ms, samples.data(), max_samples, &e);
+            error::handle(e);
+            samples.resize(n);
+            return samples;
+        }
     };
 
     class fisheye_sensor : public sensor
@@ -56,6 +56,14 @@ struct rs2_software_device_destruction_callback
 };
 typedef std::shared_ptr<rs2_software_device_destruction_callback> rs2_software_device_destruction_callback_sptr;
 
+struct rs2_software_device_frameset_release_callback
+{
+    virtual void                            on_frameset_release(int frame_number) = 0;
+    virtual void                            release() = 0;
+    virtual                                 ~rs2_software_device_frameset_release_callback() {}
+};
+typedef std::shared_ptr<rs2_software_device_frameset_release_callback> rs2_software_device_frameset_release_callback_sptr;
+
 struct rs2_log_callback
 {
     virtual void                            on_log( rs2_log_severity severity, rs2_log_message const & msg ) noexcept = 0;
@@ -104,6 +112,15 @@ struct rs2_options_changed_callback
 };
 typedef std::shared_ptr< rs2_options_changed_callback > rs2_options_changed_callback_sptr;
 
+struct rs2_frame_allocator
+{
+    virtual void * allocate( size_t size ) = 0;
+    virtual void deallocate( void * buffer, size_t size ) = 0;
+    virtual void release() = 0;
+    virtual ~rs2_frame_allocator() {}
+};
+typedef std::shared_ptr< rs2_frame_allocator > rs2_frame_allocator_sptr;
+
 namespace rs2
 {
     class error : public std::runtime_error
@@ -129,6 +129,25 @@ void rs2_log(rs2_log_severity severity, const char * message, rs2_error ** error
 */
 float rs2_depth_frame_get_distance(const rs2_frame* frame_ref, int x, int y, rs2_error** error);
 
+/**
+* Like rs2_depth_frame_get_distance, for many pixels in a single call
+* \param[in] frame_ref  depth frame
+* \param[in] pixels     count (x,y) pairs of 2D depth pixel coordinates (Left-Upper corner origin); all must be in the frame
+* \param[in] count      number of pixels
+* \param[out] distances receives the depth, in meters, of each pixel
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_depth_frame_get_distances(const rs2_frame* frame_ref, const int* pixels, int count, float* distances, rs2_error** error);
+
+/**
+* The depth, in meters, of every pixel of a depth frame
+* \param[in] frame_ref  depth frame
+* \param[out] distances receives width * height floats, row by row
+* \param[in] size       number of floats distances has room for; must be at least width * height
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_depth_frame_get_all_distances(const rs2_frame* frame_ref, float* distances, int size, rs2_error** error);
+
 /**
 * return the time at specific time point
 * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
@@ -22,6 +22,12 @@ void rs2_project_point_to_pixel(float pixel[2], const rs2_intrinsics* intrin, co
 /* Given pixel coordinates and depth in an image with no distortion or inverse distortion coefficients, compute the corresponding point in 3D space relative to the same camera */
 void rs2_deproject_pixel_to_point(float point[3], const rs2_intrinsics* intrin, const float pixel[2], float depth);
 
+/* Batch version of rs2_project_point_to_pixel: points are count interleaved (x,y,z) triplets, pixels receives count (x,y) pairs. Faster than one call per point, with the same results */
+void rs2_project_points_to_pixels(float* pixels, const rs2_intrinsics* intrin, const float* points, int count);
+
+/* Batch version of rs2_deproject_pixel_to_point: pixels are count interleaved (x,y) pairs with one depth each, points receives count (x,y,z) triplets. Faster than one call per pixel, with the same results */
+void rs2_deproject_pixels_to_points(float* points, const rs2_intrinsics* intrin, const float* pixels, const float* depths, int count);
+
 /* Transform 3D coordinates relative to one sensor to 3D coordinates relative to another viewpoint */
 void rs2_transform_point_to_point(float to_point[3], const rs2_extrinsics* extrin, const float from_point[3]);
 
@@ -38,6 +44,21 @@ void rs2_project_color_pixel_to_depth_pixel(float to_pixel[2],
     const struct rs2_extrinsics* depth_to_color,
     const float from_pixel[2]);
 
+/* Precompute, for one pair of depth and color intrinsics and extrinsics, what rs2_project_color_pixel_to_depth_pixel
+   recomputes at every step of its line search. Release with rs2_delete_color_to_depth_projector. */
+rs2_color_to_depth_projector* rs2_create_color_to_depth_projector(const struct rs2_intrinsics* depth_intrin,
+    const struct rs2_intrinsics* color_intrin,
+    const struct rs2_extrinsics* color_to_depth,
+    const struct rs2_extrinsics* depth_to_color, rs2_error** error);
+
+void rs2_delete_color_to_depth_projector(rs2_color_to_depth_projector* projector);
+
+/* Same as rs2_project_color_pixel_to_depth_pixel, for count (x,y) color pixels against the same depth frame. Pixels
+   for which no depth was found along the search line are set to (-1,-1). */
+void rs2_project_color_pixels_to_depth_pixels(const rs2_color_to_depth_projector* projector,
+    float* to_pixels, const float* from_pixels, int count,
+    const uint16_t* data, float depth_scale, float depth_min, float depth_max, rs2_error** error);
+
 
 #ifdef __cplusplus
 }
@@ -4,6 +4,7 @@
 #include "algo.h"
 #include "option.h"
 #include "core/video-frame.h"
+#include <rsutils/concurrency/thread-policy.h>
 
 using namespace librealsense;
 
@@ -42,6 +43,16 @@ void auto_exposure_state::set_auto_exposure_antiflicker_rate(unsigned value)
     rate = value;
 }
 
+unsigned auto_exposure_state::get_auto_exposure_sample_rate() const
+{
+    return sample_rate;
+}
+
+void auto_exposure_state::set_auto_exposure_sample_rate(unsigned value)
+{
+    sample_rate = value ? value : 1;
+}
+
 void auto_exposure_state::set_auto_exposure_step(float value)
 {
     step = value;
@@ -56,6 +67,7 @@ auto_exposure_mechanism::auto_exposure_mechanism(option& gain_option, option& ex
     _exposure_thread = std::make_shared<std::thread>(
                 [this]()
     {
+        rsutils::concurrency::apply_thread_policy( nullptr );
         while (_keep_alive)
         {
             std::unique_lock<std::mutex> lk(_queue_mtx);
@@ -243,10 +255,11 @@ bool auto_exposure_algorithm::analyze_image(const frame_interface* image)
     }
 
     std::vector<int> H(256);
-    auto total_weight = number_of_pixels;
 
     auto cols = frame->get_width();
-    im_hist((uint8_t*)frame->get_frame_data(), image_roi, frame->get_bpp() / 8 * cols, &H[0]);
+    auto total_weight = im_hist((uint8_t*)frame->get_frame_data(), image_roi, frame->get_bpp() / 8 * cols, &H[0]);
+    if (!total_weight)
+        return false;
 
     histogram_metric score = {};
     histogram_score(H, total_weight, score);
@@ -299,17 +312,55 @@ void auto_exposure_algorithm::update_roi(const region_of_interest& ae_roi)
     is_roi_initialized = true;
 }
 
-void auto_exposure_algorithm::im_hist(const uint8_t* data, const region_of_interest& image_roi, const int rowStep, int h[])
+// Counting into a single histogram serializes on the increments of repeated values (each has to wait for the previous
+// one's store), which is most of the time in a well-exposed image; so we spread consecutive pixels over four
+// sub-histograms and only add them up at the end. There is no gather/scatter-increment to vectorize this with in
+// SSE/NEON/AVX2, but the contiguous case reads 8 pixels per load.
+static void accumulate_row(const uint8_t* p, int n, int stride, uint32_t (&h)[4][256])
 {
-    std::lock_guard<std::recursive_mutex> lock(state_mutex);
+    int j = 0;
+    if (stride == 1)
+    {
+        for (; j + 8 <= n; j += 8)
+        {
+            uint64_t w;
+            memcpy(&w, p + j, sizeof(w));
+            ++h[0][w & 0xff]; ++h[1][(w >> 8) & 0xff]; ++h[2][(w >> 16) & 0xff]; ++h[3][(w >> 24) & 0xff];
+            ++h[0][(w >> 32) & 0xff]; ++h[1][(w >> 40) & 0xff]; ++h[2][(w >> 48) & 0xff]; ++h[3][w >> 56];
+        }
+    }
+    else
+    {
+        for (; j + 3 * stride < n; j += 4 * stride)
+        {
+            ++h[0][p[j]];
+            ++h[1][p[j + stride]];
+            ++h[2][p[j + 2 * stride]];
+            ++h[3][p[j + 3 * stride]];
+        }
+    }
+    for (; j < n; j += stride)
+        ++h[0][p[j]];
+}
 
-    for (int i = 0; i < 256; ++i)
-        h[i] = 0;
+int auto_exposure_algorithm::im_hist(const uint8_t* data, const region_of_interest& image_roi, const int rowStep, int h[])
+{
+    int stride;
+    {
+        std::lock_guard<std::recursive_mutex> lock(state_mutex);
+        stride = static_cast<int>(state.get_auto_exposure_sample_rate());
+    }
+
+    uint32_t sub[4][256] = {};
+    int const n = image_roi.max_x - image_roi.min_x;
+    int rows = 0;
+    const uint8_t* rowData = data + (image_roi.min_y * rowStep) + image_roi.min_x;
+    for (int i = image_roi.min_y; i < image_roi.max_y; i += stride, rowData += stride * rowStep, ++rows)
+        accumulate_row(rowData, n, stride, sub);
 
-    const uint8_t* rowData = data + (image_roi.min_y * rowStep);
-    for (int i = image_roi.min_y; i < image_roi.max_y; ++i, rowData += rowStep)
-        for (int j = image_roi.min_x; j < image_roi.max_x; j+=state.sample_rate)
-            ++h[rowData[j]];
+    for (int i = 0; i < 256; ++i)
+        h[i] = static_cast<int>(sub[0][i] + sub[1][i] + sub[2][i] + sub[3][i]);
+    return n > 0 ? rows * ((n + stride - 1) / stride) : 0;
 }
 
 void auto_exposure_algorithm::increase_exposure_target(float mult, float& target_exposure)
@@ -0,0 +1,192 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "hardware-buffer-allocator.h"
+
+#include <android/hardware_buffer.h>
+#include <dlfcn.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace librealsense
+{
+    namespace
+    {
+        // The AHardwareBuffer functions, when the system has them
+        struct hardware_buffer_api
+        {
+            int ( *allocate )( const AHardwareBuffer_Desc *, AHardwareBuffer ** ) = nullptr;
+            void ( *release )( AHardwareBuffer * ) = nullptr;
+            int ( *lock )( AHardwareBuffer *, uint64_t, int32_t, const ARect *, void ** ) = nullptr;
+            int ( *unlock )( AHardwareBuffer *, int32_t * ) = nullptr;
+            jobject ( *to_java )( JNIEnv *, AHardwareBuffer * ) = nullptr;
+
+            hardware_buffer_api()
+            {
+                if( auto lib = dlopen( "libnativewindow.so", RTLD_NOW ) )
+                {
+                    allocate = reinterpret_cast< decltype( allocate ) >( dlsym( lib, "AHardwareBuffer_allocate" ) );
+                    release = reinterpret_cast< decltype( release ) >( dlsym( lib, "AHardwareBuffer_release" ) );
+                    lock = reinterpret_cast< decltype( lock ) >( dlsym( lib, "AHardwareBuffer_lock" ) );
+                    unlock = reinterpret_cast< decltype( unlock ) >( dlsym( lib, "AHardwareBuffer_unlock" ) );
+                }
+                if( auto lib = dlopen( "libandroid.so", RTLD_NOW ) )
+                    to_java = reinterpret_cast< decltype( to_java ) >( dlsym( lib, "AHardwareBuffer_toHardwareBuffer" ) );
+            }
+
+            bool loaded() const { return allocate && release && lock && unlock; }
+
+            static hardware_buffer_api const & instance()
+            {
+                static hardware_buffer_api api;
+                return api;
+            }
+        };
+
+        struct mapped_buffer
+        {
+            AHardwareBuffer * buffer;
+            size_t size;
+        };
+
+        // Every buffer handed out, by its mapped address
+        std::mutex live_mutex;
+        std::unordered_map< const void *, mapped_buffer > live;
+
+        // Buffers whose frames were released, for the next frames of the same size
+        static const size_t max_pooled = 16;
+        std::mutex pool_mutex;
+        std::unordered_map< const hardware_buffer_allocator *, std::vector< void * > > pools;
+
+        void destroy( void * data )
+        {
+            mapped_buffer b;
+            {
+                std::lock_guard< std::mutex > lock( live_mutex );
+                auto it = live.find( data );
+                if( it == live.end() )
+                    return;
+                b = it->second;
+                live.erase( it );
+            }
+            auto & api = hardware_buffer_api::instance();
+            api.unlock( b.buffer, nullptr );
+            api.release( b.buffer );
+        }
+
+        size_t size_of( const void * data )
+        {
+            std::lock_guard< std::mutex > lock( live_mutex );
+            auto it = live.find( data );
+            return it == live.end() ? 0 : it->second.size;
+        }
+    }
+
+    bool hardware_buffer_allocator::is_supported()
+    {
+        return hardware_buffer_api::instance().loaded();
+    }
+
+    hardware_buffer_allocator::~hardware_buffer_allocator()
+    {
+        std::vector< void * > pooled;
+        {
+            std::lock_guard< std::mutex > lock( pool_mutex );
+            auto it = pools.find( this );
+            if( it != pools.end() )
+            {
+                pooled = std::move( it->second );
+                pools.erase( it );
+            }
+        }
+        for( auto data : pooled )
+            destroy( data );
+    }
+
+    void * hardware_buffer_allocator::allocate( size_t size )
+    {
+        auto & api = hardware_buffer_api::instance();
+        if( ! api.loaded() )
+            return nullptr;
+
+        {
+            std::lock_guard< std::mutex > lock( pool_mutex );
+            auto & pool = pools[this];
+            for( auto it = pool.begin(); it != pool.end(); ++it )
+            {
+                if( size_of( *it ) == size )
+                {
+                    auto data = *it;
+                    pool.erase( it );
+                    return data;
+                }
+            }
+        }
+
+        AHardwareBuffer_Desc desc = {};
+        desc.width = static_cast< uint32_t >( size );
+        desc.height = 1;
+        desc.layers = 1;
+        desc.format = AHARDWAREBUFFER_FORMAT_BLOB;
+        desc.usage = AHARDWAREBUFFER_USAGE_CPU_READ_OFTEN | AHARDWAREBUFFER_USAGE_CPU_WRITE_OFTEN;
+
+        // GPU access to BLOB buffers (API 28) is not available everywhere; CPU-only buffers still feed NNAPI
+        AHardwareBuffer * buffer = nullptr;
+        desc.usage |= AHARDWAREBUFFER_USAGE_GPU_DATA_BUFFER;
+        if( api.allocate( &desc, &buffer ) != 0 )
+        {
+            desc.usage &= ~uint64_t( AHARDWAREBUFFER_USAGE_GPU_DATA_BUFFER );
+            if( api.allocate( &desc, &buffer ) != 0 )
+                return nullptr;
+        }
+
+        // The buffer stays mapped for its whole life: frames are written and read through this address
+        void * data = nullptr;
+        if( api.lock( buffer, desc.usage & ( AHARDWAREBUFFER_USAGE_CPU_READ_MASK | AHARDWAREBUFFER_USAGE_CPU_WRITE_MASK ),
+                      -1, nullptr, &data ) != 0 || ! data )
+        {
+            api.release( buffer );
+            return nullptr;
+        }
+
+        std::lock_guard< std::mutex > lock( live_mutex );
+        live[data] = { buffer, size };
+        return data;
+    }
+
+    void hardware_buffer_allocator::deallocate( void * buffer, size_t )
+    {
+        {
+            std::lock_guard< std::mutex > lock( pool_mutex );
+            auto & pool = pools[this];
+            if( pool.size() < max_pooled )
+            {
+                pool.push_back( buffer );
+                return;
+            }
+        }
+        destroy( buffer );
+    }
+
+    void hardware_buffer_allocator::release()
+    {
+        delete this;
+    }
+
+    AHardwareBuffer * hardware_buffer_allocator::find( const void * data )
+    {
+        std::lock_guard< std::mutex > lock( live_mutex );
+        auto it = live.find( data );
+        return it == live.end() ? nullptr : it->second.buffer;
+    }
+
+    jobject hardware_buffer_allocator::to_java( JNIEnv * env, AHardwareBuffer * buffer )
+    {
+        auto & api = hardware_buffer_api::instance();
+        if( ! buffer || ! api.to_java )
+            return nullptr;
+        return api.to_java( env, buffer );
+    }
+}
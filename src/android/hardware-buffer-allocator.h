@@ -0,0 +1,39 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/hpp/rs_types.hpp>
+
+#include <jni.h>
+#include <cstddef>
+
+struct AHardwareBuffer;
+
+namespace librealsense
+{
+    // Frame allocator (see rs2_set_frame_allocator_cpp) placing the payload of each frame in a CPU-mapped BLOB
+    // AHardwareBuffer, so that the frame can be handed to GLES, Vulkan or NNAPI as it is, without copying.
+    //
+    // AHardwareBuffer needs API level 26, above the library's minimum, so it is resolved at run time: on older
+    // systems is_supported() is false and allocate() returns null, which leaves the frames to the library's default
+    // allocation. Buffers are pooled by size; one goes back to the pool when its frame is released, so a buffer
+    // obtained through find() is only valid for as long as its frame is held.
+    class hardware_buffer_allocator : public rs2_frame_allocator
+    {
+    public:
+        ~hardware_buffer_allocator() override;
+
+        static bool is_supported();
+
+        void * allocate( size_t size ) override;
+        void deallocate( void * buffer, size_t size ) override;
+        void release() override;
+
+        // The hardware buffer holding the data of a frame, or null if it was not allocated by one of these
+        static AHardwareBuffer * find( const void * data );
+
+        // A new android.hardware.HardwareBuffer referring to the buffer, or null if not supported
+        static jobject to_java( JNIEnv * env, AHardwareBuffer * buffer );
+    };
+}
@@ -4,6 +4,7 @@
 #include <jni.h>
 #include "error.h"
 #include "../../../include/librealsense2/rs.h"
+#include "../hardware-buffer-allocator.h"
 
 extern "C" JNIEXPORT void JNICALL
 Java_com_intel_realsense_librealsense_Frame_nAddRef(JNIEnv *env, jclass type, jlong handle) {
@@ -195,3 +196,29 @@ Java_com_intel_realsense_librealsense_Frame_nSupportsMetadata(JNIEnv *env, jclas
     handle_error(env, e);
     return rv > 0;
 }
+
+// The frame's own data, wrapped without copying: valid only for as long as the frame is held
+extern "C" JNIEXPORT jobject JNICALL
+Java_com_intel_realsense_librealsense_Frame_nGetDataBuffer(JNIEnv *env, jclass type, jlong handle) {
+    rs2_error *e = NULL;
+    auto frame = reinterpret_cast<const rs2_frame *>(handle);
+    auto data = rs2_get_frame_data(frame, &e);
+    handle_error(env, e);
+    if (e) return nullptr;
+    auto size = rs2_get_frame_data_size(frame, &e);
+    handle_error(env, e);
+    if (e || !data) return nullptr;
+    return env->NewDirectByteBuffer(const_cast<void *>(data), size);
+}
+
+// The AHardwareBuffer holding the frame's data, when the sensor allocates frames in them (see
+// Sensor.nSetHardwareBufferAllocator); null otherwise
+extern "C" JNIEXPORT jobject JNICALL
+Java_com_intel_realsense_librealsense_Frame_nGetHardwareBuffer(JNIEnv *env, jclass type, jlong handle) {
+    rs2_error *e = NULL;
+    auto data = rs2_get_frame_data(reinterpret_cast<const rs2_frame *>(handle), &e);
+    handle_error(env, e);
+    if (e || !data) return nullptr;
+    return librealsense::hardware_buffer_allocator::to_java(
+            env, librealsense::hardware_buffer_allocator::find(data));
+}
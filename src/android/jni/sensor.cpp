@@ -11,6 +11,7 @@
 #include "jni_logging.h"
 #include "frame_callback.h"
 #include "jni_common.h"
+#include "../hardware-buffer-allocator.h"
 
 extern "C"
 JNIEXPORT void JNICALL
@@ -187,3 +188,19 @@ Java_com_intel_realsense_librealsense_Sensor_nGetActiveStreams(JNIEnv *env, jcla
     jlongArray rv = rs_jni_convert_stream_profiles(env, list);
     return rv;
 }
+
+extern "C"
+JNIEXPORT jboolean JNICALL
+Java_com_intel_realsense_librealsense_Sensor_nIsHardwareBufferSupported(JNIEnv *env, jclass type) {
+    return librealsense::hardware_buffer_allocator::is_supported();
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_intel_realsense_librealsense_Sensor_nSetHardwareBufferAllocator(JNIEnv *env, jclass type,
+                                                                         jlong handle, jboolean enable) {
+    rs2_error *e = nullptr;
+    rs2_set_frame_allocator_cpp(reinterpret_cast<rs2_sensor *>(handle),
+                                enable ? new librealsense::hardware_buffer_allocator() : nullptr, &e);
+    handle_error(env, e);
+}
@@ -5,6 +5,9 @@
 
 #include "core/frame-additional-data.h"
 #include "callback-invocation.h"
+#include "frame-memory-budget.h"
+
+#include <librealsense2/hpp/rs_types.hpp>
 
 
 namespace librealsense
@@ -17,13 +20,16 @@ namespace librealsense
     public:
         virtual callback_invocation_holder begin_callback() = 0;
 
-        virtual frame_interface* alloc_and_track(const size_t size, frame_additional_data && additional_data, bool requires_memory) = 0;
+        // When 'zero_fill' is false, the caller overwrites all of the frame data and newly-allocated memory isn't cleared
+        virtual frame_interface* alloc_and_track(const size_t size, frame_additional_data && additional_data, bool requires_memory, bool zero_fill) = 0;
 
         virtual std::shared_ptr<metadata_parser_map> get_md_parsers() const = 0;
 
         virtual std::shared_ptr< sensor_interface > get_sensor() const = 0;
         virtual void set_sensor( const std::weak_ptr< sensor_interface > & ) = 0;
 
+        virtual void set_frame_allocator( rs2_frame_allocator_sptr allocator ) = 0;
+
         virtual void flush() = 0;
 
         virtual frame_interface* publish_frame(frame_interface* frame) = 0;
@@ -34,6 +40,7 @@ namespace librealsense
 
     std::shared_ptr<archive_interface> make_archive(rs2_extension type,
         std::atomic<uint32_t>* in_max_frame_queue_size,
-        std::shared_ptr<metadata_parser_map> parsers);
+        std::shared_ptr<metadata_parser_map> parsers,
+        frame_memory_budget::priority priority = frame_memory_budget::priority::normal);
 
 }
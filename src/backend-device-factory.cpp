@@ -12,6 +12,7 @@
 #include "ds/d500/d500-info.h"
 #include "fw-update/fw-update-factory.h"
 #include "platform-camera.h"
+#include "proc/worker-pool.h"
 
 #include <librealsense2/h/rs_context.h>
 
@@ -161,6 +162,7 @@ backend_device_factory::backend_device_factory( std::shared_ptr< context > const
               }
           } ) )
 {
+    _device_watcher->get_backend()->apply_settings( ctx->get_settings() );
 }
 
 
@@ -179,9 +181,27 @@ std::vector< std::shared_ptr< device_info > > backend_device_factory::query_devi
         return {};  // We don't carry any software devices
 
     auto backend = _device_watcher->get_backend();
+#ifdef RS2_USE_V4L2_BACKEND
+    // Each is a separate scan of sysfs; other backends may have thread affinity (e.g., COM), so do not move them
+    platform::backend_device_group group;
+    worker_pool::shared()->parallel_for( 0, 3, 3,
+                                         [&]( size_t begin, size_t end )
+                                         {
+                                             for( auto i = begin; i < end; ++i )
+                                             {
+                                                 if( i == 0 )
+                                                     group.uvc_devices = backend->query_uvc_devices();
+                                                 else if( i == 1 )
+                                                     group.usb_devices = backend->query_usb_devices();
+                                                 else
+                                                     group.hid_devices = backend->query_hid_devices();
+                                             }
+                                         } );
+#else
     platform::backend_device_group group( backend->query_uvc_devices(),
                                           backend->query_usb_devices(),
                                           backend->query_hid_devices() );
+#endif
     auto devices = create_devices_from_group( group, requested_mask );
     return { devices.begin(), devices.end() };
 }
@@ -8,6 +8,8 @@
 #include "platform/stream-profile.h"
 #include "platform/frame-object.h"
 
+#include <rsutils/json-fwd.h>
+
 #include <memory>
 #include <vector>
 #include <string>
@@ -16,6 +18,7 @@
 const uint16_t DELAY_FOR_CONNECTION        = 50;
 const int      DISCONNECT_PERIOD_MS        = 6000;
 const int      POLLING_DEVICES_INTERVAL_MS = 2000;
+const int      HOTPLUG_SETTLE_MS           = 200;  // a device comes up as several hotplug events
 
 const uint8_t MAX_META_DATA_SIZE          = 0xff; // UVC Metadata total length
                                             // is limited by (UVC Bulk) design to 255 bytes
@@ -50,6 +53,10 @@ namespace librealsense
                 return empty_str;
             }
 
+            // Context settings, applied whenever a context starts using the backend; the backend is shared by all
+            // contexts, so these only affect devices created afterwards
+            virtual void apply_settings( rsutils::json const & settings ) {}
+
             virtual ~backend() = default;
         };
 
@@ -0,0 +1,118 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "callback-executor.h"
+#include "latency-stats.h"
+#include <src/core/frame-interface.h>
+#include <src/core/stream-profile-interface.h>
+
+#include <rsutils/concurrency/thread-policy.h>
+
+#include <algorithm>
+
+
+namespace librealsense {
+
+
+frame_callback_executor::frame_callback_executor( size_t capacity, bool drop_newest, deliver_fn deliver )
+    : _state( std::make_shared< state >() )
+{
+    _state->capacity = std::max< size_t >( capacity, 1 );
+    _state->drop_newest = drop_newest;
+    _state->deliver = std::move( deliver );
+}
+
+
+frame_callback_executor::~frame_callback_executor()
+{
+    cancel();
+    {
+        std::lock_guard< std::mutex > lock( _state->mutex );
+        _state->stopping = true;
+    }
+    _state->cv.notify_all();
+    if( _thread.joinable() )
+    {
+        if( _thread.get_id() == std::this_thread::get_id() )
+            _thread.detach();  // destroyed from inside the callback: the thread ends once it returns
+        else
+            _thread.join();
+    }
+}
+
+
+static void record_queue_depth( frame_holder const & frame, size_t depth, size_t capacity )
+{
+    if( auto profile = frame->get_stream() )
+        profile->get_stats().drops.queue_depth( RS2_FRAME_DROP_STAGE_CALLBACK_QUEUE, depth, capacity );
+}
+
+
+void frame_callback_executor::enqueue( frame_holder && frame )
+{
+    if( ! frame )
+        return;
+    frame_holder dropped;  // released outside the lock
+    {
+        std::lock_guard< std::mutex > lock( _state->mutex );
+        if( _state->stopping )
+            return;
+        if( _state->queue.size() >= _state->capacity )
+        {
+            if( _state->drop_newest )
+            {
+                stream_stats::drop( frame.frame, RS2_FRAME_DROP_STAGE_CALLBACK_QUEUE );
+                dropped = std::move( frame );
+                return;
+            }
+            dropped = std::move( _state->queue.front() );
+            _state->queue.pop_front();
+            stream_stats::drop( dropped.frame, RS2_FRAME_DROP_STAGE_CALLBACK_QUEUE );
+        }
+        _state->queue.push_back( std::move( frame ) );
+        record_queue_depth( _state->queue.back(), _state->queue.size(), _state->capacity );
+        if( ! _thread.joinable() )
+        {
+            auto st = _state;
+            _thread = std::thread( [st]() { run( st ); } );
+            _state->thread_id = _thread.get_id();
+        }
+    }
+    _state->cv.notify_all();
+}
+
+
+void frame_callback_executor::cancel()
+{
+    std::deque< frame_holder > discarded;  // released outside the lock
+    std::unique_lock< std::mutex > lock( _state->mutex );
+    for( auto & f : _state->queue )
+        stream_stats::drop( f.frame, RS2_FRAME_DROP_STAGE_CALLBACK_QUEUE );
+    discarded.swap( _state->queue );
+    if( _state->thread_id != std::this_thread::get_id() )
+        _state->cv.wait( lock, [this]() { return ! _state->delivering; } );
+}
+
+
+void frame_callback_executor::run( std::shared_ptr< state > const & st )
+{
+    rsutils::concurrency::apply_thread_policy( "frame-callback" );
+    std::unique_lock< std::mutex > lock( st->mutex );
+    while( true )
+    {
+        st->cv.wait( lock, [&]() { return st->stopping || ! st->queue.empty(); } );
+        if( st->stopping )
+            break;
+        frame_holder frame = std::move( st->queue.front() );
+        st->queue.pop_front();
+        st->delivering = true;
+        lock.unlock();
+        st->deliver( std::move( frame ) );
+        lock.lock();
+        st->delivering = false;
+        st->cv.notify_all();
+    }
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,63 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <src/core/frame-holder.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+
+namespace librealsense {
+
+
+// Delivers the frames of a sensor to its callback on a thread of its own, so that a slow callback does not hold up the
+// backend thread the frames arrive on (and, with it, the buffers the kernel or USB stack capture into).
+//
+// Frames wait in a bounded queue. When it is full, either the oldest waiting frame or the arriving one is dropped, and
+// counted against its stream as RS2_FRAME_DROP_STAGE_CALLBACK_QUEUE (see rs2_get_stream_frame_drops). The thread only
+// starts with the first frame.
+//
+class frame_callback_executor
+{
+public:
+    typedef std::function< void( frame_holder && ) > deliver_fn;
+
+    frame_callback_executor( size_t capacity, bool drop_newest, deliver_fn deliver );
+    ~frame_callback_executor();
+
+    void enqueue( frame_holder && frame );
+
+    // Drop whatever is waiting and wait for the frame being delivered, if any, unless called from the delivery itself.
+    // Nothing is delivered after this returns, until more frames are enqueued.
+    void cancel();
+
+private:
+    // Shared with the thread, which may outlive us if we're destroyed from inside the callback
+    struct state
+    {
+        size_t capacity;
+        bool drop_newest;
+        deliver_fn deliver;
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque< frame_holder > queue;
+        bool delivering = false;
+        bool stopping = false;
+        std::thread::id thread_id;
+    };
+
+    static void run( std::shared_ptr< state > const & );
+
+    std::shared_ptr< state > _state;
+    std::thread _thread;
+};
+
+
+}  // namespace librealsense
@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include "small-heap.h"
+#include "lock-free-heap.h"
 
 #include <chrono>
 
@@ -17,7 +17,7 @@ struct callback_invocation
     std::chrono::high_resolution_clock::time_point ended;
 };
 
-typedef small_heap< callback_invocation, 1 > callbacks_heap;
+typedef lock_free_heap< callback_invocation, 1 > callbacks_heap;
 
 struct callback_invocation_holder
 {
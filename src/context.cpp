@@ -9,6 +9,11 @@
 #include "dds/rsdds-device-factory.h"
 #endif
 #include "rscore-pp-block-factory.h"
+#include "cpu-features.h"
+#include "proc/worker-pool.h"
+#include "usb-bandwidth.h"
+#include "frame-memory-budget.h"
+#include "frame-trace.h"
 
 #include <librealsense2/hpp/rs_types.hpp>  // rs2_devices_changed_callback
 #include <librealsense2/rs.h>              // RS2_API_FULL_VERSION_STR
@@ -20,6 +25,9 @@
 #include <rsutils/string/from.h>
 #include <rsutils/json.h>
 #include <rsutils/json-config.h>
+#include <rsutils/concurrency/thread-policy.h>
+
+#include <future>
 using json = rsutils::json;
 
 
@@ -54,6 +62,39 @@ namespace librealsense {
             version_logged = true;
             LOG_DEBUG( "Librealsense VERSION: " << RS2_API_FULL_VERSION_STR );
         }
+
+        // Caps the SIMD kernels used by all processing blocks (not just this context's), for testing
+        auto const simd = _settings.nested( "simd-level" );
+        if( simd.is_string() )
+            limit_simd_level( parse_simd_level( simd.string_ref() ) );
+
+        // Sizes the worker pool all processing blocks share, if it is not already running
+        auto const threads = _settings.nested( "processing-threads" );
+        if( threads.exists() )
+            worker_pool::set_shared_size( threads.default_value< size_t >( 0 ) );
+
+        // Names, pins and prioritizes the threads created from now on (see thread-policy.h)
+        auto const thread_policies = _settings.nested( "thread-policies" );
+        if( thread_policies.exists() )
+            rsutils::concurrency::set_thread_policies( thread_policies );
+
+        // Nominal payload capacity of USB buses, in MB/s, that profiles are resolved against (see usb-bandwidth.h)
+        auto const usb_capacities = _settings.nested( "usb-bandwidth" );
+        if( usb_capacities.exists() )
+            usb_bandwidth::set_capacities( usb_capacities.nested( "usb2" ).default_value( 0. ) * 1e6,
+                                           usb_capacities.nested( "usb3" ).default_value( 0. ) * 1e6 );
+
+        // Bounds the memory frames take, in MB over all sensors and processing blocks (see frame-memory-budget.h)
+        auto const frame_memory = _settings.nested( "frame-memory-budget" );
+        if( frame_memory.exists() )
+            frame_memory_budget::instance().set_limit( uint64_t( frame_memory.default_value( 0. ) * 1e6 ) );
+
+        // Traces frames through the pipeline, until this context is gone (see frame-trace.h)
+        auto const trace = _settings.nested( "frame-trace" );
+        auto const trace_file = trace.nested( "file" );
+        if( trace_file.is_string() )
+            _tracing = frame_trace::start( trace_file.string_ref(),
+                                           trace.nested( "max-events" ).default_value< size_t >( 1000000 ) );
     }
 
 
@@ -91,6 +132,8 @@ namespace librealsense {
 
     context::~context()
     {
+        if( _tracing )
+            frame_trace::stop();
     }
 
 
@@ -108,10 +151,23 @@ namespace librealsense {
 
     std::vector< std::shared_ptr< device_info > > context::query_devices( int requested_mask ) const
     {
+        // Factories enumerate independently (and some, like DDS, mostly wait), so query them all at once; the list is
+        // still in factory order. The first, the platform backend, stays on our thread: some backends (Media
+        // Foundation) need it.
+        std::vector< std::vector< std::shared_ptr< device_info > > > per_factory( _factories.size() );
+        std::vector< std::future< void > > others;
+        for( size_t i = 1; i < _factories.size(); ++i )
+            others.push_back( std::async( std::launch::async,
+                                          [&, i]() { per_factory[i] = _factories[i]->query_devices( requested_mask ); } ) );
+        if( ! _factories.empty() )
+            per_factory[0] = _factories[0]->query_devices( requested_mask );
+        for( auto & f : others )
+            f.get();
+
         std::vector< std::shared_ptr< device_info > > list;
-        for( auto & factory : _factories )
+        for( auto & devices : per_factory )
         {
-            for( auto & dev_info : factory->query_devices( requested_mask ) )
+            for( auto & dev_info : devices )
             {
                 LOG_INFO( "... " << dev_info->get_address() );
                 list.push_back( dev_info );
@@ -141,7 +197,10 @@ namespace librealsense {
 
     rsutils::subscription context::on_device_changes( devices_changed_callback && callback )
     {
-        return _devices_changed.subscribe( std::move( callback ) );
+        auto subscription = _devices_changed.subscribe( std::move( callback ) );
+        for( auto & factory : _factories )
+            factory->on_callback_registered();
+        return subscription;
     }
 
 
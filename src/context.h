@@ -79,6 +79,7 @@ namespace librealsense
 
         rsutils::json _settings; // Save operation settings
         unsigned const _device_mask;
+        bool _tracing = false;  // this context started the frame trace, and writes it when done
 
         std::vector< std::shared_ptr< device_factory > > _factories;
     };
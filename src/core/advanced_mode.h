@@ -9,6 +9,8 @@
 #include <librealsense2/h/rs_advanced_mode_command.h>
 #include "serializable-interface.h"
 #include <rsutils/lazy.h>
+#include <chrono>
+#include <cstring>
 
 
 typedef enum
@@ -209,10 +211,12 @@ namespace librealsense
         rsutils::lazy< bool > _amplitude_factor_support;
         bool _blocked = false;
         std::string _block_message;
+        mutable std::chrono::steady_clock::time_point _settled;  // when the last SET_ADV is done settling
 
         preset get_all() const;
-        void set_all( const preset & p );
-        void set_all_depth( const preset & p );
+        // With the device's 'current' settings (from get_all()), only the tables that differ from them are written
+        void set_all( const preset & p, const preset * current = nullptr );
+        void set_all_depth( const preset & p, const preset * current );
         void set_all_rgb( const preset & p );
         bool should_set_rgb_preset() const;
 
@@ -229,9 +233,22 @@ namespace librealsense
 
             assert_no_error(ds::fw_cmd::SET_ADV,
                 send_receive(encode_command(ds::fw_cmd::SET_ADV, static_cast<uint32_t>(cmd), 0, 0, 0, data)));
-            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            // The table is committed; the FW only needs a moment before the next command
+            _settled = std::chrono::steady_clock::now() + std::chrono::milliseconds(20);
         }
 
+        // Same, unless it would not change the 'current' table
+        template<class T>
+        void set_changed(const T& strct, const T* current, EtAdvancedModeRegGroup cmd) const
+        {
+            if (current && !std::memcmp(&strct, current, sizeof(T)))
+                return;
+            set(strct, cmd);
+        }
+
+        // Waits until the FW is ready for another command after the last SET_ADV
+        void settle() const { std::this_thread::sleep_until(_settled); }
+
         template<class T>
         T get(EtAdvancedModeRegGroup cmd, T* ptr = static_cast<T*>(nullptr), int mode = 0) const
         {
@@ -31,6 +31,15 @@ public:
 
     float get_distance( int x, int y ) const;
 
+    // get_distance() for 'count' (x, y) pairs at once; throws if any is outside the frame
+    void get_distances( const int * pixels, size_t count, float * distances ) const;
+
+    // The distance of every pixel, row by row (width * height floats)
+    void get_distances( float * distances ) const;
+
+    // Z16 depth to meters, several pixels at a time with SSE; shared with units_transform
+    static void depth_to_meters( const uint16_t * depth, size_t count, float units, float * meters );
+
     float get_units() const { return additional_data.depth_units; }
 
     void set_original( frame_holder h )
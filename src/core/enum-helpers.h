@@ -43,6 +43,8 @@ constexpr static char const * UNKNOWN_VALUE = "UNKNOWN";
 
 // For rs2_option, these make use of the registry
 LRS_EXTENSION_API std::string const & get_string( rs2_option value );
+// The name of a built-in option (not a registered one), from a table made at compile time
+char const * get_builtin_option_name( rs2_option value );
 bool is_valid( rs2_option value );
 std::ostream & operator<<( std::ostream & out, rs2_option option );
 bool try_parse( const std::string & option_name, rs2_option & result );
@@ -62,7 +64,9 @@ RS2_ENUM_HELPERS( rs2_exception_type, EXCEPTION_TYPE )
 RS2_ENUM_HELPERS( rs2_log_severity, LOG_SEVERITY )
 RS2_ENUM_HELPERS( rs2_notification_category, NOTIFICATION_CATEGORY )
 RS2_ENUM_HELPERS( rs2_playback_status, PLAYBACK_STATUS )
+RS2_ENUM_HELPERS( rs2_record_queue_policy, RECORD_QUEUE_POLICY )
 RS2_ENUM_HELPERS( rs2_matchers, MATCHER )
+RS2_ENUM_HELPERS( rs2_frame_drop_stage, FRAME_DROP_STAGE )
 RS2_ENUM_HELPERS( rs2_sensor_mode, SENSOR_MODE )
 RS2_ENUM_HELPERS( rs2_l500_visual_preset, L500_VISUAL_PRESET )
 RS2_ENUM_HELPERS( rs2_calibration_type, CALIBRATION_TYPE )
@@ -50,11 +50,11 @@ static_assert( sizeof( metadata_array_value ) == sizeof( rs2_metadata_type ) + 1
                "unexpected size for metadata array members" );
 
 
-struct frame_additional_data : frame_header
+// The fields of frame_additional_data besides the raw metadata, copied as they are
+struct frame_additional_fields : frame_header
 {
     uint32_t metadata_size = 0;
     bool fisheye_ae_mode = false;  // TODO: remove in future release
-    std::array< uint8_t, sizeof( metadata_array ) > metadata_blob = {};
     rs2_time_t last_timestamp = 0;
     unsigned long long last_frame_number = 0;
     bool is_blocking = false;  // when running from recording, this bit indicates
@@ -66,8 +66,39 @@ struct frame_additional_data : frame_header
 
     uint32_t raw_size = 0;  // The frame transmitted size (payload only)
 
+    // Set by frame::decode_metadata(): every value the parsers found, indexed by rs2_frame_metadata_value; null until
+    // then. Never changed once set, so the frames made from this one (by processing blocks) share it and need no
+    // decoding of their own.
+    std::shared_ptr< const metadata_array > decoded_metadata;
+};
+
+
+// Frames are copied into and out of archives and processing blocks whole, so the raw metadata buffer, which is
+// mostly unused, is copied only up to metadata_size. The bytes after it are always zero: whatever writes the buffer
+// must cover what it writes with metadata_size.
+struct frame_additional_data : frame_additional_fields
+{
+    std::array< uint8_t, sizeof( metadata_array ) > metadata_blob = {};
+
     frame_additional_data() {}
 
+    frame_additional_data( frame_additional_data const & other )
+        : frame_additional_fields( other )
+    {
+        copy_metadata( other, 0 );
+    }
+
+    frame_additional_data & operator=( frame_additional_data const & other )
+    {
+        if( this != &other )
+        {
+            auto const previous_size = metadata_size;
+            static_cast< frame_additional_fields & >( *this ) = other;
+            copy_metadata( other, previous_size );
+        }
+        return *this;
+    }
+
     frame_additional_data( metadata_array const & metadata )
     {
         metadata_size = (uint32_t)sizeof( metadata );
@@ -85,17 +116,27 @@ struct frame_additional_data : frame_header
                            bool in_is_blocking,
                            float in_depth_units = 0,
                            uint32_t transmitted_size = 0 )
-        : frame_header( in_timestamp, in_frame_number, in_system_time, backend_time )
-        , metadata_size( md_size )
-        , last_timestamp( last_timestamp )
-        , last_frame_number( last_frame_number )
-        , is_blocking( in_is_blocking )
-        , depth_units( in_depth_units )
-        , raw_size( transmitted_size )
     {
+        frame_header::operator=( frame_header( in_timestamp, in_frame_number, in_system_time, backend_time ) );
+        metadata_size = md_size;
+        this->last_timestamp = last_timestamp;
+        this->last_frame_number = last_frame_number;
+        is_blocking = in_is_blocking;
+        depth_units = in_depth_units;
+        raw_size = transmitted_size;
         if( metadata_size )
             std::copy( md_buf, md_buf + std::min( size_t( md_size ), metadata_blob.size() ), metadata_blob.begin() );
     }
+
+private:
+    void copy_metadata( frame_additional_data const & other, size_t previous_size )
+    {
+        auto const size = std::min( size_t( other.metadata_size ), metadata_blob.size() );
+        std::memcpy( metadata_blob.data(), other.metadata_blob.data(), size );
+        previous_size = std::min( previous_size, metadata_blob.size() );
+        if( previous_size > size )
+            std::memset( metadata_blob.data() + size, 0, previous_size - size );
+    }
 };
 
 
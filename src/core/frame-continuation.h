@@ -23,7 +23,7 @@ public:
     }
 
     explicit frame_continuation( std::function< void() > continuation, const void * protected_data )
-        : continuation( continuation )
+        : continuation( std::move( continuation ) )
         , protected_data( protected_data )
     {
     }
@@ -59,7 +59,7 @@ public:
     {
         continuation();
         protected_data = other.protected_data;
-        continuation = other.continuation;
+        continuation = std::move( other.continuation );
         other.continuation = []() {
         };
         other.protected_data = nullptr;
@@ -22,6 +22,7 @@ struct frame_header
     rs2_timestamp_domain timestamp_domain = RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK;
     rs2_time_t system_time = 0;        // sys-clock at the time the frame was received from the backend
     rs2_time_t backend_timestamp = 0;  // time when the frame arrived to the backend (OS dependent)
+    rs2_time_t publish_time = 0;       // sys-clock when the sensor handed the frame to its callback (0 if not yet)
 
     frame_header() = default;
     frame_header( frame_header const & ) = default;
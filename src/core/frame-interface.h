@@ -40,6 +40,8 @@ public:
 
     virtual void acquire() = 0;
     virtual void release() = 0;
+    // Whether there are other references to the frame besides the caller's; one that is not shared may be modified
+    virtual bool is_shared() const = 0;
     virtual frame_interface * publish( std::shared_ptr< archive_interface > new_owner ) = 0;
     virtual void unpublish() = 0;
     virtual void attach_continuation( frame_continuation && continuation ) = 0;
@@ -39,6 +39,8 @@ public:
     virtual option_range get_range() const = 0;
     virtual bool is_enabled() const = 0;
     virtual bool is_read_only() const { return false; }
+    // Whether set() takes effect while the sensor streams; those that are not throw if set then
+    virtual bool can_set_while_streaming() const { return true; }
     virtual const char * get_description() const = 0;
     virtual const char * get_value_description( float ) const { return nullptr; }
     
@@ -12,21 +12,15 @@
 namespace librealsense {
 
 
-LRS_EXTENSION_API std::string const & get_string( rs2_option );
+char const * get_builtin_option_name( rs2_option );
 
 
 namespace by_name {
 
 
-static std::map< std::string, rs2_option > _option_by_name = []()
-{
-    // Automatically add all our known options into the option names -- that way, no duplicate custom option
-    // can be added...
-    std::map< std::string, rs2_option > map;
-    for( auto option = rs2_option( 0 ); option < RS2_OPTION_COUNT; option = rs2_option( option + 1 ) )
-        map[get_string( option )] = option;
-    return std::move( map );
-}();
+// Only registered (custom) options: built-in names are in a table made at compile time (see to-string.cpp), and
+// looked up there, so nothing is built when the library loads
+static std::map< std::string, rs2_option > _option_by_name;
 static std::vector< std::string > _name_by_index;
 static std::mutex _mutex;
 
@@ -47,10 +41,17 @@ inline rs2_option index_to_option( size_t index )
 }
 
 
+inline rs2_option find_builtin( std::string const & option_name )
+{
+    for( auto option = rs2_option( 0 ); option < RS2_OPTION_COUNT; option = rs2_option( option + 1 ) )
+        if( option_name == get_builtin_option_name( option ) )
+            return option;
+    return RS2_OPTION_COUNT;
+}
+
+
 inline size_t new_index()
 {
-    // _name_by_index and _option_by_name do not have the same size:
-    // _option_by_name is also populated with non-registered options names!
     auto const index = _name_by_index.size();
     // We have to return strings by reference, which means we cannot control access simply with a mutex!
     // The mutex will still be able to control registration, but otherwise we want to ensure that the names stay
@@ -70,6 +71,15 @@ rs2_option options_registry::register_option_by_name( std::string const & option
     if( option_name.empty() )
         throw invalid_value_exception( "cannot register an empty option name" );
 
+    // No custom option can take the name of a built-in one
+    auto const builtin = by_name::find_builtin( option_name );
+    if( builtin != RS2_OPTION_COUNT )
+    {
+        if( ! ok_if_there )
+            throw invalid_value_exception( "option '" + option_name + "' was already registered" );
+        return builtin;
+    }
+
     std::lock_guard< std::mutex > lock( by_name::_mutex );
     auto const index = by_name::new_index();
     auto const option = by_name::index_to_option( index );
@@ -89,6 +99,10 @@ rs2_option options_registry::register_option_by_name( std::string const & option
 rs2_option options_registry::find_option_by_name( std::string const & option_name )
 {
     // Both regular and by-name options are supported
+    auto const builtin = by_name::find_builtin( option_name );
+    if( builtin != RS2_OPTION_COUNT )
+        return builtin;
+
     std::lock_guard< std::mutex > lock( by_name::_mutex );
     auto it = by_name::_option_by_name.find( option_name );
     if( it == by_name::_option_by_name.end() )
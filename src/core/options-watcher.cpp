@@ -14,6 +14,9 @@ namespace librealsense {
 options_watcher::options_watcher( std::chrono::milliseconds update_interval )
     : _update_interval( update_interval )
     , _destructing( false )
+    , _wheel( rsutils::concurrency::timer_wheel::shared() )
+    , _task( 0 )
+    , _has_values( false )
 {
 }
 
@@ -65,55 +68,56 @@ bool options_watcher::should_stop() const
     return _on_values_changed.size() == 0 || _options.size() == 0 || _destructing;
 }
 
+void options_watcher::set_update_interval( std::chrono::milliseconds update_interval )
+{
+    std::lock_guard< std::mutex > lock( _task_mutex );
+    _update_interval = update_interval;
+    if( _task )
+        _wheel->set_period( _task, update_interval );
+}
+
 void options_watcher::start()
 {
-    if( ! _updater.joinable() ) // If not already started
+    std::lock_guard< std::mutex > lock( _task_mutex );
+    if( ! _task ) // If not already started
     {
-        _updater = std::thread( [this]() {
-            update_options();
-            thread_loop();
-        } );
+        // The first update, right away, only gets the values to compare with
+        _has_values = false;
+        _task = _wheel->add( [this]() { poll(); }, _update_interval, false );
     }
 }
 
 void options_watcher::stop()
 {
-    _stopping.notify_all();
-    if( _updater.joinable() )
+    rsutils::concurrency::timer_wheel::task_id task;
     {
-        try
-        {
-            _updater.join();
-        }
-        catch( ... )
-        {
-            // Nothing to do on error
-        }
+        std::lock_guard< std::mutex > lock( _task_mutex );
+        task = _task;
+        _task = 0;
     }
+    // Outside the lock: this waits for a poll in progress, which may be stopping us itself
+    if( task )
+        _wheel->remove( task );
 }
 
-void options_watcher::thread_loop()
+void options_watcher::poll()
 {
     // Checking should_stop because subscriptions can be canceled without us knowing
-    while( ! should_stop() )
+    if( should_stop() )
     {
-        {
-            std::unique_lock< std::mutex > lock( _mutex );
-            _stopping.wait_for( lock, _update_interval );
-        }
-
-        // Checking for stop conditions after sleep.
-        if( should_stop() )
-            break;
+        stop();
+        return;
+    }
 
-        auto updated_options = update_options();
+    auto updated_options = update_options();
 
-        // Checking stop conditions after update, if stop requested no need to notify.
-        if( should_stop() )
-            break;
+    // Checking stop conditions after update, if stop requested no need to notify.
+    if( should_stop() )
+        return;
 
+    if( _has_values )
         notify( updated_options );
-    }
+    _has_values = true;
 }
 
 options_watcher::options_and_values options_watcher::update_options()
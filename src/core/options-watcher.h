@@ -7,6 +7,7 @@
 
 #include <rsutils/signal.h>
 #include <rsutils/concurrency/concurrency.h>
+#include <rsutils/concurrency/timer-wheel.h>
 #include <rsutils/json-fwd.h>
 
 #include <map>
@@ -22,8 +23,8 @@ namespace librealsense {
 
 // Watches registered options value and notifies interested users.
 // When a user subscribes to notification the options_watcher will automatically update (query) registered options
-// values in set time intervals (creates a thread). If one or more of the values have changed the watcher will notify
-// through the callback subscription.
+// values in set time intervals (on the shared timer wheel). If one or more of the values have changed the watcher will
+// notify through the callback subscription.
 class options_watcher
 {
 public:
@@ -45,24 +46,27 @@ public:
 
     rsutils::subscription subscribe( callback && cb );
 
-    void set_update_interval( std::chrono::milliseconds update_interval ) { _update_interval = update_interval; }
+    void set_update_interval( std::chrono::milliseconds update_interval );
 
 protected:
     bool should_start() const;
     bool should_stop() const;
     void start();
     void stop();
-    void thread_loop();
+    void poll();
     virtual options_and_values update_options();
     void notify( options_and_values const & updated_options );
 
     options_and_values _options;
     rsutils::signal< options_and_values const & > _on_values_changed;
     std::chrono::milliseconds _update_interval;
-    std::thread _updater;
     std::mutex _mutex;
-    std::condition_variable _stopping;
     std::atomic_bool _destructing;
+
+    std::shared_ptr< rsutils::concurrency::timer_wheel > _wheel;
+    std::mutex _task_mutex;
+    rsutils::concurrency::timer_wheel::task_id _task;  // 0 when not watching; guarded by _task_mutex
+    bool _has_values;                                  // updated once since started: changes are notified from then on
 };
 
 
@@ -28,10 +28,24 @@ public:
     virtual void set_output_callback( rs2_frame_callback_sptr callback ) = 0;
     virtual void invoke( frame_holder frame ) = 0;
     virtual synthetic_source_interface & get_source() = 0;
+
+    // Finishes the frames still queued for asynchronous processing (RS2_OPTION_ASYNC_PROCESSING), and processes any
+    // further ones synchronously. Owners call this before they let go of the block: by the time its base destructor
+    // runs, the derived class the queued frames would be processed by is already gone.
+    virtual void stop() = 0;
 };
 
 
 using processing_blocks = std::vector< std::shared_ptr< processing_block_interface > >;
 
 
+// Stops the blocks no one else holds anymore, before they are let go
+inline void stop_unshared( processing_blocks const & blocks )
+{
+    for( auto & block : blocks )
+        if( block && block.use_count() == 1 )
+            block->stop();
+}
+
+
 }  // namespace librealsense
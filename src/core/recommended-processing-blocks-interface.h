@@ -33,6 +33,7 @@ public:
         : _blocks( blocks )
     {
     }
+    ~recommended_proccesing_blocks_snapshot() { stop_unshared( _blocks ); }
 
     virtual processing_blocks get_recommended_processing_blocks() const override { return _blocks; }
 
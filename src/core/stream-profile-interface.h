@@ -15,6 +15,9 @@
 namespace librealsense {
 
 
+struct stream_stats;
+
+
 class stream_profile_interface
     : public stream_interface
     , public recordable< stream_profile_interface >
@@ -32,6 +35,9 @@ public:
     virtual std::shared_ptr< stream_profile_interface > clone() const = 0;
     virtual rs2_stream_profile * get_c_wrapper() const = 0;
     virtual void set_c_wrapper( rs2_stream_profile * wrapper ) = 0;
+
+    // The latency and drop stats of the stream's unique ID (see latency-stats.h), looked up only once
+    virtual stream_stats & get_stats() const = 0;
 };
 
 
@@ -39,11 +39,24 @@ namespace librealsense
                                                       int new_stride = 0,
                                                       rs2_extension frame_type = RS2_EXTENSION_VIDEO_FRAME) = 0;
 
+        // Same, but the frame's data is that of 'original' from 'offset' on, without a copy (see frame::set_data_view).
+        // Returns null if it would not fit in the original's data.
+        virtual frame_interface* allocate_video_frame_view(std::shared_ptr<stream_profile_interface> stream,
+                                                           frame_interface* original,
+                                                           size_t offset,
+                                                           int new_bpp,
+                                                           int new_width,
+                                                           int new_height,
+                                                           int new_stride,
+                                                           rs2_extension frame_type = RS2_EXTENSION_VIDEO_FRAME) = 0;
+
         virtual frame_interface* allocate_motion_frame(std::shared_ptr<stream_profile_interface> stream,
                                                        frame_interface* original,
                                                        rs2_extension frame_type = RS2_EXTENSION_MOTION_FRAME) = 0;
 
         virtual frame_interface* allocate_composite_frame(std::vector<frame_holder> frames) = 0;
+        // Same, but moves the holders out of [frames, frames + count) so the caller can reuse its own storage
+        virtual frame_interface* allocate_composite_frame(frame_holder* frames, size_t count) = 0;
 
         virtual frame_interface* allocate_points(std::shared_ptr<stream_profile_interface> stream, 
             frame_interface* original, 
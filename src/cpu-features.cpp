@@ -0,0 +1,133 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "cpu-features.h"
+
+#include <src/librealsense-exception.h>
+
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <atomic>
+
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __i386__ ) || defined( _M_IX86 )
+#define RS2_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+
+namespace librealsense
+{
+#ifdef RS2_X86
+    static void cpuid( int info[4], int leaf )
+    {
+#ifdef _MSC_VER
+        __cpuidex( info, leaf, 0 );
+#else
+        __cpuid_count( leaf, 0, info[0], info[1], info[2], info[3] );
+#endif
+    }
+
+    // Whether the OS saves the AVX (YMM) registers on context switches
+    static bool os_saves_ymm()
+    {
+#ifdef _MSC_VER
+        return ( _xgetbv( 0 ) & 6 ) == 6;
+#else
+        unsigned eax, edx;
+        __asm__( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+        return ( eax & 6 ) == 6;
+#endif
+    }
+#endif
+
+
+    static simd_level detect_simd_level()
+    {
+#ifdef RS2_X86
+        int info[4];
+        cpuid( info, 0 );
+        int const max_leaf = info[0];
+        if( max_leaf < 1 )
+            return simd_level::none;
+
+        cpuid( info, 1 );
+        bool const ssse3 = ( info[2] & ( 1 << 9 ) ) != 0;
+        bool const osxsave = ( info[2] & ( 1 << 27 ) ) != 0;
+        bool const avx = ( info[2] & ( 1 << 28 ) ) != 0;
+        if( ! ssse3 )
+            return simd_level::none;
+
+        if( max_leaf >= 7 && osxsave && avx && os_saves_ymm() )
+        {
+            cpuid( info, 7 );
+            if( info[1] & ( 1 << 5 ) )
+                return simd_level::avx2;
+        }
+        return simd_level::simd128;
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+        // The compiler is free to use NEON anywhere in a binary built for it, so it is known to be there
+        return simd_level::simd128;
+#else
+        return simd_level::none;
+#endif
+    }
+
+
+    simd_level get_supported_simd_level()
+    {
+        static simd_level const level = []
+        {
+            auto const level = detect_simd_level();
+            LOG_DEBUG( "CPU SIMD level: " << get_string( level ) );
+            return level;
+        }();
+        return level;
+    }
+
+
+    static std::atomic< int > simd_level_limit( int( simd_level::avx2 ) );
+
+
+    simd_level get_simd_level()
+    {
+        auto const supported = get_supported_simd_level();
+        auto const limit = simd_level( simd_level_limit.load( std::memory_order_relaxed ) );
+        return limit < supported ? limit : supported;
+    }
+
+
+    void limit_simd_level( simd_level level )
+    {
+        simd_level_limit = int( level );
+        LOG_DEBUG( "SIMD level limited to " << get_string( level ) << "; using " << get_string( get_simd_level() ) );
+    }
+
+
+    simd_level parse_simd_level( std::string const & name )
+    {
+        if( name == "none" )
+            return simd_level::none;
+        if( name == "simd128" || name == "ssse3" || name == "neon" )
+            return simd_level::simd128;
+        if( name == "avx2" || name == "auto" )
+            return simd_level::avx2;
+        throw invalid_value_exception( "invalid SIMD level '" + name + "'; expected none, ssse3, neon, avx2 or auto" );
+    }
+
+
+    char const * get_string( simd_level level )
+    {
+        switch( level )
+        {
+        case simd_level::none: return "none";
+        case simd_level::simd128: return "simd128";
+        case simd_level::avx2: return "avx2";
+        }
+        return "unknown";
+    }
+}
@@ -0,0 +1,36 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <string>
+
+
+namespace librealsense
+{
+    // The SIMD kernel families processing blocks choose between at run time, in increasing order.
+    //
+    // A kernel is used only if it was compiled into this binary AND the running CPU supports it: the AVX2 kernels, for
+    // example, are built separately (with -mavx2) so that binaries built for baseline CPUs still carry them.
+    enum class simd_level
+    {
+        none,     // generic code only
+        simd128,  // SSSE3 on x86, NEON on ARM
+        avx2,
+    };
+
+    // What the running CPU supports, detected once
+    simd_level get_supported_simd_level();
+
+    // What kernels should use: the supported level, unless capped by limit_simd_level()
+    simd_level get_simd_level();
+
+    // Caps the level kernels use (process-wide), e.g. to test the generic code paths; a limit above what the CPU
+    // supports has no effect
+    void limit_simd_level( simd_level );
+
+    // "none", "simd128" (or "ssse3"/"neon"), "avx2", or "auto" for the supported level
+    simd_level parse_simd_level( std::string const & );
+
+    char const * get_string( simd_level );
+}
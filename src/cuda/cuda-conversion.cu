@@ -5,293 +5,273 @@
 #include "cuda-conversion.cuh"
 #include <iostream>
 #include <iomanip>
+#include <cstring>
+#include <string>
 #include "rscuda_utils.cuh"
-/*
-// conversion to Y8 is currently not available in the API
-__global__ void kernel_unpack_yuy2_y8_cuda(const uint8_t * src, uint8_t *dst, int superPixCount)
-{
-    int i = blockDim.x * blockIdx.x + threadIdx.x;
-
-    if (i >= superPixCount)
-        return;
-
-    int idx = i * 4;
-
-    dst[idx] = src[idx];
-    dst[idx + 1] = src[idx + 2];
-    dst[idx + 2] = src[idx + 4];
-    dst[idx + 3] = src[idx + 6];
-    dst[idx + 4] = src[idx + 8];
-    dst[idx + 5] = src[idx + 10];
-    dst[idx + 6] = src[idx + 12];
-    dst[idx + 7] = src[idx + 14];
-    dst[idx + 8] = src[idx + 16];
-    dst[idx + 9] = src[idx + 18];
-    dst[idx + 10] = src[idx + 20];
-    dst[idx + 11] = src[idx + 22];
-    dst[idx + 12] = src[idx + 24];
-    dst[idx + 13] = src[idx + 26];
-    dst[idx + 14] = src[idx + 28];
-    dst[idx + 15] = src[idx + 30];
-}
-*/
 
-__global__ void kernel_unpack_yuy2_y16_cuda(const uint8_t * src, uint8_t *dst, int superPixCount)
+namespace
 {
-    int i = blockDim.x * blockIdx.x + threadIdx.x;
-    int stride = blockDim.x * gridDim.x;
+    using rscuda::check_cuda;
 
-    if (i >= superPixCount)
-        return;
-
-    for (; i < superPixCount; i += stride) {
+    int blocks_for(int count)
+    {
+        return (count + RS2_CUDA_THREADS_PER_BLOCK - 1) / RS2_CUDA_THREADS_PER_BLOCK;
+    }
 
-        int idx = i * 4;
+    // The stream and buffers the conversions of one thread go through.
+    //
+    // Frames arrive and leave in pageable host memory, so every conversion is staged through pinned buffers: the copies
+    // to and from the device are then plain DMA on the stream, and nothing is allocated once the buffers have grown to
+    // the largest frame seen. A non-blocking stream keeps the conversions of different processing threads from
+    // serializing each other, as they would on the legacy default stream.
+    struct conversion_context
+    {
+        enum { source = 0, max_outputs = 2 };
+
+        static conversion_context& get()
+        {
+            static thread_local conversion_context context;
+            return context;
+        }
+
+        rscuda::cuda_stream stream;
+        rscuda::device_buffer device[1 + max_outputs];
+        rscuda::pinned_buffer pinned[1 + max_outputs];
+    };
+
+    // Copies the source to the device, has 'launch' write the outputs there, and copies them back into 'dst', all in
+    // order on the thread's stream; only the final synchronization blocks.
+    template<class LAUNCH>
+    void convert_on_device(const void* src, size_t src_size, int outputs, void* const dst[], const size_t dst_size[], LAUNCH launch)
+    {
+        auto& context = conversion_context::get();
+        cudaStream_t stream = context.stream;
+
+        auto staged_src = context.pinned[conversion_context::source].get(src_size);
+        memcpy(staged_src, src, src_size);
+        auto d_src = context.device[conversion_context::source].get(src_size);
+        check_cuda(cudaMemcpyAsync(d_src, staged_src, src_size, cudaMemcpyHostToDevice, stream), "cudaMemcpyAsync");
+
+        uint8_t* d_dst[conversion_context::max_outputs];
+        uint8_t* staged_dst[conversion_context::max_outputs];
+        for (int i = 0; i < outputs; ++i)
+        {
+            d_dst[i] = context.device[1 + i].get(dst_size[i]);
+            staged_dst[i] = context.pinned[1 + i].get(dst_size[i]);
+        }
+
+        launch(d_src, d_dst, stream);
+        check_cuda(cudaGetLastError(), "kernel launch");
+
+        for (int i = 0; i < outputs; ++i)
+            check_cuda(cudaMemcpyAsync(staged_dst[i], d_dst[i], dst_size[i], cudaMemcpyDeviceToHost, stream), "cudaMemcpyAsync");
+        check_cuda(cudaStreamSynchronize(stream), "cudaStreamSynchronize");
+
+        for (int i = 0; i < outputs; ++i)
+            memcpy(dst[i], staged_dst[i], dst_size[i]);
+    }
 
-        dst[idx] = 0;
-        dst[idx + 1] = src[idx + 0];
-        dst[idx + 2] = 0;
-        dst[idx + 3] = src[idx + 2];
+    int bytes_per_pixel(rs2_format format)
+    {
+        switch (format)
+        {
+        case RS2_FORMAT_Y8: return 1;
+        case RS2_FORMAT_Y16: return 2;
+        case RS2_FORMAT_RGB8:
+        case RS2_FORMAT_BGR8: return 3;
+        case RS2_FORMAT_RGBA8:
+        case RS2_FORMAT_BGRA8: return 4;
+        default: throw std::runtime_error(std::string("unsupported CUDA conversion to ") + rs2_format_to_string(format));
+        }
     }
 }
 
 
-__global__ void kernel_unpack_yuy2_rgb8_cuda(const uint8_t * src, uint8_t *dst, int superPixCount)
+/////////////////////////////
+// YUV unpacking kernels   //
+/////////////////////////////
+// Each thread converts the 2 (or, for Y411, 4) pixels that share one chroma sample, with the same integer math as the
+// generic CPU code. Destination pixel 'pixel' of a FORMAT image is written from its y, u, v.
+template<rs2_format FORMAT> __device__ void store_yuv(uint8_t* dst, int pixel, int y, int u, int v)
 {
-    int i = blockDim.x * blockIdx.x + threadIdx.x;
-    int stride = blockDim.x * gridDim.x;
-
-    if (i >= superPixCount)
+    if (FORMAT == RS2_FORMAT_Y8)
+    {
+        dst[pixel] = y;
+        return;
+    }
+    if (FORMAT == RS2_FORMAT_Y16)
+    {
+        // Y16 is little-endian: we output Y << 8
+        dst[pixel * 2] = 0;
+        dst[pixel * 2 + 1] = y;
         return;
-
-    for (; i < superPixCount; i += stride) {
-
-        int idx = i * 4;
-
-        uint8_t y0 = src[idx];
-        uint8_t u0 = src[idx + 1];
-        uint8_t y1 = src[idx + 2];
-        uint8_t v0 = src[idx + 3];
-
-        int16_t c = y0 - 16;
-        int16_t d = u0 - 128;
-        int16_t e = v0 - 128;
-
-        int32_t t;
-#define clamp(x)  ((t=(x)) > 255 ? 255 : t < 0 ? 0 : t)
-
-        int odx = i * 6;
-
-        dst[odx] = clamp((298 * c + 409 * e + 128) >> 8);
-        dst[odx + 1] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
-        dst[odx + 2] = clamp((298 * c + 516 * d + 128) >> 8);
-
-        c = y1 - 16;
-
-        dst[odx + 3] = clamp((298 * c + 409 * e + 128) >> 8);
-        dst[odx + 4] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
-        dst[odx + 5] = clamp((298 * c + 516 * d + 128) >> 8);
-
-#undef clamp
-
     }
+
+    int c = y - 16;
+    int d = u - 128;
+    int e = v - 128;
+    int r = min(max((298 * c + 409 * e + 128) >> 8, 0), 255);
+    int g = min(max((298 * c - 100 * d - 208 * e + 128) >> 8, 0), 255);
+    int b = min(max((298 * c + 516 * d + 128) >> 8, 0), 255);
+
+    bool const bgr = FORMAT == RS2_FORMAT_BGR8 || FORMAT == RS2_FORMAT_BGRA8;
+    bool const alpha = FORMAT == RS2_FORMAT_RGBA8 || FORMAT == RS2_FORMAT_BGRA8;
+    uint8_t* out = dst + pixel * (alpha ? 4 : 3);
+    out[0] = bgr ? b : r;
+    out[1] = g;
+    out[2] = bgr ? r : b;
+    if (alpha)
+        out[3] = 255;
 }
 
-__global__ void kernel_unpack_yuy2_bgr8_cuda(const uint8_t * src, uint8_t *dst, int superPixCount)
+// YUY2 is y0 u y1 v, UYVY is u y0 v y1
+template<rs2_format FORMAT, bool UYVY> __global__ void kernel_unpack_yuyv_cuda(const uint8_t* src, uint8_t* dst, int superPixCount)
 {
     int i = blockDim.x * blockIdx.x + threadIdx.x;
-    int stride = blockDim.x * gridDim.x;
 
     if (i >= superPixCount)
         return;
 
-    for (; i < superPixCount; i += stride) {
-
-        int idx = i * 4;
-
-        uint8_t y0 = src[idx];
-        uint8_t u0 = src[idx + 1];
-        uint8_t y1 = src[idx + 2];
-        uint8_t v0 = src[idx + 3];
-
-        int16_t c = y0 - 16;
-        int16_t d = u0 - 128;
-        int16_t e = v0 - 128;
-
-        int32_t t;
-#define clamp(x)  ((t=(x)) > 255 ? 255 : t < 0 ? 0 : t)
-
-        int odx = i * 6;
-
-        dst[odx + 2] = clamp((298 * c + 409 * e + 128) >> 8);
-        dst[odx + 1] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
-        dst[odx] = clamp((298 * c + 516 * d + 128) >> 8);
-
-        c = y1 - 16;
-
-        dst[odx + 5] = clamp((298 * c + 409 * e + 128) >> 8);
-        dst[odx + 4] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
-        dst[odx + 3] = clamp((298 * c + 516 * d + 128) >> 8);
+    const uint8_t* s = src + i * 4;
+    int y0 = UYVY ? s[1] : s[0];
+    int u = UYVY ? s[0] : s[1];
+    int y1 = UYVY ? s[3] : s[2];
+    int v = UYVY ? s[2] : s[3];
 
-#undef clamp
-    }
+    store_yuv<FORMAT>(dst, i * 2, y0, u, v);
+    store_yuv<FORMAT>(dst, i * 2 + 1, y1, u, v);
 }
 
-
-__global__ void kernel_unpack_yuy2_rgba8_cuda(const uint8_t * src, uint8_t *dst, int superPixCount)
+// M420 is two lines of Y followed by the line of interleaved U,V they share
+template<rs2_format FORMAT> __global__ void kernel_unpack_m420_cuda(const uint8_t* src, uint8_t* dst, int width, int height)
 {
     int i = blockDim.x * blockIdx.x + threadIdx.x;
-    int stride = blockDim.x * gridDim.x;
+    int pairs_per_line = width / 2;
 
-    if (i >= superPixCount)
+    if (i >= pairs_per_line * height)
         return;
 
-    for (; i < superPixCount; i += stride) {
-
-        int idx = i * 4;
-
-        uint8_t y0 = src[idx];
-        uint8_t u0 = src[idx + 1];
-        uint8_t y1 = src[idx + 2];
-        uint8_t v0 = src[idx + 3];
-
-        int16_t c = y0 - 16;
-        int16_t d = u0 - 128;
-        int16_t e = v0 - 128;
-
-        int32_t t;
-#define clamp(x)  ((t=(x)) > 255 ? 255 : t < 0 ? 0 : t)
+    int line = i / pairs_per_line;
+    int x = (i % pairs_per_line) * 2;
+    const uint8_t* block = src + (line / 2) * 3 * width;
+    const uint8_t* y = block + (line % 2) * width + x;
+    const uint8_t* uv = block + 2 * width + x;
 
-        int odx = i * 8;
-
-        dst[odx] = clamp((298 * c + 409 * e + 128) >> 8);
-        dst[odx + 1] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
-        dst[odx + 2] = clamp((298 * c + 516 * d + 128) >> 8);
-        dst[odx + 3] = 255;
-
-        c = y1 - 16;
-
-        dst[odx + 4] = clamp((298 * c + 409 * e + 128) >> 8);
-        dst[odx + 5] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
-        dst[odx + 6] = clamp((298 * c + 516 * d + 128) >> 8);
-        dst[odx + 7] = 255;
-
-#undef clamp
-    }
+    store_yuv<FORMAT>(dst, line * width + x, y[0], uv[0], uv[1]);
+    store_yuv<FORMAT>(dst, line * width + x + 1, y[1], uv[0], uv[1]);
 }
 
-__global__ void kernel_unpack_yuy2_bgra8_cuda(const uint8_t * src, uint8_t *dst, int superPixCount)
+// Y411 groups are [u y0 y1 v y2 y3], with y0 y1 on one line and y2 y3 below them (see y411-converter.cpp)
+__global__ void kernel_unpack_y411_rgb8_cuda(const uint8_t* src, uint8_t* dst, int width, int height)
 {
     int i = blockDim.x * blockIdx.x + threadIdx.x;
-    int stride = blockDim.x * gridDim.x;
+    int groups_per_line_pair = width / 2;
 
-    if (i >= superPixCount)
+    if (i >= groups_per_line_pair * (height / 2))
         return;
 
-    for (; i < superPixCount; i += stride) {
-
-        int idx = i * 4;
+    int line = (i / groups_per_line_pair) * 2;
+    int x = (i % groups_per_line_pair) * 2;
+    const uint8_t* s = src + i * 6;
 
-        uint8_t y0 = src[idx];
-        uint8_t u0 = src[idx + 1];
-        uint8_t y1 = src[idx + 2];
-        uint8_t v0 = src[idx + 3];
-
-        int16_t c = y0 - 16;
-        int16_t d = u0 - 128;
-        int16_t e = v0 - 128;
-
-        int32_t t;
-
-#define clamp(x)  ((t=(x)) > 255 ? 255 : t < 0 ? 0 : t)
-
-        int odx = i * 8;
-
-        dst[odx + 3] = 255;
-        dst[odx + 2] = clamp((298 * c + 409 * e + 128) >> 8);
-        dst[odx + 1] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
-        dst[odx] = clamp((298 * c + 516 * d + 128) >> 8);
+    store_yuv<RS2_FORMAT_RGB8>(dst, line * width + x, s[1], s[0], s[3]);
+    store_yuv<RS2_FORMAT_RGB8>(dst, line * width + x + 1, s[2], s[0], s[3]);
+    store_yuv<RS2_FORMAT_RGB8>(dst, (line + 1) * width + x, s[4], s[0], s[3]);
+    store_yuv<RS2_FORMAT_RGB8>(dst, (line + 1) * width + x + 1, s[5], s[0], s[3]);
+}
 
-        c = y1 - 16;
 
-        dst[odx + 7] = 255;
-        dst[odx + 6] = clamp((298 * c + 409 * e + 128) >> 8);
-        dst[odx + 5] = clamp((298 * c - 100 * d - 208 * e + 128) >> 8);
-        dst[odx + 4] = clamp((298 * c + 516 * d + 128) >> 8);
+template<bool UYVY> static void unpack_yuyv_cuda_helper(const uint8_t* h_src, uint8_t* h_dst, int n, rs2_format format)
+{
+    // How many super pixels do we have?
+    int superPix = n / 2;
+    void* dst[] = { h_dst };
+    size_t dst_size[] = { size_t(n) * bytes_per_pixel(format) };
 
-#undef clamp
-    }
+    convert_on_device(h_src, size_t(superPix) * 4, 1, dst, dst_size, [&](const uint8_t* src, uint8_t* const out[], cudaStream_t stream)
+    {
+        int numBlocks = blocks_for(superPix);
+        switch (format)
+        {
+        case RS2_FORMAT_Y8:
+            kernel_unpack_yuyv_cuda<RS2_FORMAT_Y8, UYVY><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], superPix);
+            break;
+        case RS2_FORMAT_Y16:
+            kernel_unpack_yuyv_cuda<RS2_FORMAT_Y16, UYVY><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], superPix);
+            break;
+        case RS2_FORMAT_RGB8:
+            kernel_unpack_yuyv_cuda<RS2_FORMAT_RGB8, UYVY><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], superPix);
+            break;
+        case RS2_FORMAT_BGR8:
+            kernel_unpack_yuyv_cuda<RS2_FORMAT_BGR8, UYVY><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], superPix);
+            break;
+        case RS2_FORMAT_RGBA8:
+            kernel_unpack_yuyv_cuda<RS2_FORMAT_RGBA8, UYVY><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], superPix);
+            break;
+        case RS2_FORMAT_BGRA8:
+            kernel_unpack_yuyv_cuda<RS2_FORMAT_BGRA8, UYVY><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], superPix);
+            break;
+        default:
+            break;
+        }
+    });
 }
 
-
 void rscuda::unpack_yuy2_cuda_helper(const uint8_t* h_src, uint8_t* h_dst, int n, rs2_format format)
 {
-    /*    cudaEvent_t start, stop;
-        cudaEventCreate(&start);
-        cudaEventCreate(&stop);
-        cudaEventRecord(start); */
-
-        // How many super pixels do we have?
-    int superPix = n / 2;
-    std::shared_ptr<uint8_t> d_dst;
-    std::shared_ptr<uint8_t> d_src = alloc_dev<uint8_t>(superPix * 4);
+    unpack_yuyv_cuda_helper<false>(h_src, h_dst, n, format);
+}
 
-    auto result = cudaMemcpy(d_src.get(), h_src, superPix * sizeof(uint8_t) * 4, cudaMemcpyHostToDevice);
-    assert(result == cudaSuccess);
+void rscuda::unpack_uyvy_cuda_helper(const uint8_t* h_src, uint8_t* h_dst, int n, rs2_format format)
+{
+    unpack_yuyv_cuda_helper<true>(h_src, h_dst, n, format);
+}
 
-    int numBlocks = superPix / RS2_CUDA_THREADS_PER_BLOCK;
-    int size;
+void rscuda::unpack_m420_cuda_helper(const uint8_t* h_src, uint8_t* h_dst, int width, int height, rs2_format format)
+{
+    int count = width / 2 * height;
+    void* dst[] = { h_dst };
+    size_t dst_size[] = { size_t(width) * height * bytes_per_pixel(format) };
 
-    switch (format)
+    convert_on_device(h_src, size_t(width) * height * 3 / 2, 1, dst, dst_size, [&](const uint8_t* src, uint8_t* const out[], cudaStream_t stream)
     {
-        // conversion to Y8 is currently not available in the API
-        /*	case RS2_FORMAT_Y8:
-            size = 1;
-             d_dst = alloc_dev<uint8_t>(n * size);
-            kernel_unpack_yuy2_y8_cuda<<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK>>>(devSrc, devDst, superPix);
+        int numBlocks = blocks_for(count);
+        switch (format)
+        {
+        case RS2_FORMAT_Y8:
+            kernel_unpack_m420_cuda<RS2_FORMAT_Y8><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], width, height);
             break;
-        */
-    case RS2_FORMAT_Y16:
-        size = 2;
-        d_dst = alloc_dev<uint8_t>(n * size);
-        kernel_unpack_yuy2_y16_cuda << <numBlocks, RS2_CUDA_THREADS_PER_BLOCK >> > (d_src.get(), d_dst.get(), superPix);
-        break;
-    case RS2_FORMAT_RGB8:
-        size = 3;
-        d_dst = alloc_dev<uint8_t>(n * size);
-        kernel_unpack_yuy2_rgb8_cuda << <numBlocks, RS2_CUDA_THREADS_PER_BLOCK >> > (d_src.get(), d_dst.get(), superPix);
-        break;
-    case RS2_FORMAT_BGR8:
-        size = 3;
-        d_dst = alloc_dev<uint8_t>(n * size);
-        kernel_unpack_yuy2_bgr8_cuda << <numBlocks, RS2_CUDA_THREADS_PER_BLOCK >> > (d_src.get(), d_dst.get(), superPix);
-        break;
-    case RS2_FORMAT_RGBA8:
-        size = 4;
-        d_dst = alloc_dev<uint8_t>(n * size);
-        kernel_unpack_yuy2_rgba8_cuda << <numBlocks, RS2_CUDA_THREADS_PER_BLOCK >> > (d_src.get(), d_dst.get(), superPix);
-        break;
-    case RS2_FORMAT_BGRA8:
-        size = 4;
-        d_dst = alloc_dev<uint8_t>(n * size);
-        kernel_unpack_yuy2_bgra8_cuda << <numBlocks, RS2_CUDA_THREADS_PER_BLOCK >> > (d_src.get(), d_dst.get(), superPix);
-        break;
-    default:
-        assert(false);
-    }
-    result = cudaGetLastError();
-    assert(result == cudaSuccess);
-
-    cudaStreamSynchronize(0);
+        case RS2_FORMAT_Y16:
+            kernel_unpack_m420_cuda<RS2_FORMAT_Y16><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], width, height);
+            break;
+        case RS2_FORMAT_RGB8:
+            kernel_unpack_m420_cuda<RS2_FORMAT_RGB8><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], width, height);
+            break;
+        case RS2_FORMAT_BGR8:
+            kernel_unpack_m420_cuda<RS2_FORMAT_BGR8><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], width, height);
+            break;
+        case RS2_FORMAT_RGBA8:
+            kernel_unpack_m420_cuda<RS2_FORMAT_RGBA8><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], width, height);
+            break;
+        case RS2_FORMAT_BGRA8:
+            kernel_unpack_m420_cuda<RS2_FORMAT_BGRA8><<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], width, height);
+            break;
+        default:
+            break;
+        }
+    });
+}
 
-    result = cudaMemcpy(h_dst, d_dst.get(), n * sizeof(uint8_t) * size, cudaMemcpyDeviceToHost);
-    assert(result == cudaSuccess);
+void rscuda::unpack_y411_cuda_helper(const uint8_t* h_src, uint8_t* h_dst, int width, int height)
+{
+    int count = width / 2 * (height / 2);
+    void* dst[] = { h_dst };
+    size_t dst_size[] = { size_t(width) * height * 3 };
 
-    /*	cudaEventRecord(stop);
-        cudaEventSynchronize(stop);
-        float milliseconds = 0;
-        cudaEventElapsedTime(&milliseconds, start, stop);
-        std::cout << milliseconds << "\n"; */
+    convert_on_device(h_src, size_t(count) * 6, 1, dst, dst_size, [&](const uint8_t* src, uint8_t* const out[], cudaStream_t stream)
+    {
+        kernel_unpack_y411_rgb8_cuda<<<blocks_for(count), RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(src, out[0], width, height);
+    });
 }
 
 
@@ -308,38 +288,14 @@ __global__ void kernel_split_frame_y8_y8_from_y8i_cuda(uint8_t* a, uint8_t* b, i
 
 void rscuda::y8_y8_from_y8i_cuda_helper(uint8_t* const dest[], int count, const rscuda::y8i_pixel * source)
 {
-    /*    cudaEvent_t start, stop;
-        cudaEventCreate(&start);
-        cudaEventCreate(&stop);
-        cudaEventRecord(start); */
-
-    int numBlocks = count / RS2_CUDA_THREADS_PER_BLOCK;
-    uint8_t* a = dest[0];
-    uint8_t* b = dest[1];
-
-    auto d_src = alloc_dev<rscuda::y8i_pixel>(count);
-    auto d_dst_0 = alloc_dev<uint8_t>(count);
-    auto d_dst_1 = alloc_dev<uint8_t>(count);
-
-    auto result = cudaMemcpy(d_src.get(), source, count * sizeof(rscuda::y8i_pixel), cudaMemcpyHostToDevice);
-    assert(result == cudaSuccess);
-
-    kernel_split_frame_y8_y8_from_y8i_cuda << <numBlocks, RS2_CUDA_THREADS_PER_BLOCK >> > (d_dst_0.get(), d_dst_1.get(), count, d_src.get());
-    cudaStreamSynchronize(0);
-
-    result = cudaGetLastError();
-    assert(result == cudaSuccess);
-
-    result = cudaMemcpy(a, d_dst_0.get(), count * sizeof(uint8_t), cudaMemcpyDeviceToHost);
-    assert(result == cudaSuccess);
-    result = cudaMemcpy(b, d_dst_1.get(), count * sizeof(uint8_t), cudaMemcpyDeviceToHost);
-    assert(result == cudaSuccess);
-
-    /*    cudaEventRecord(stop);
-        cudaEventSynchronize(stop);
-        float milliseconds = 0;
-        cudaEventElapsedTime(&milliseconds, start, stop);
-        std::cout << milliseconds << std::endl; */
+    void* dst[] = { dest[0], dest[1] };
+    size_t dst_size[] = { size_t(count), size_t(count) };
+
+    convert_on_device(source, count * sizeof(rscuda::y8i_pixel), 2, dst, dst_size, [&](const uint8_t* src, uint8_t* const out[], cudaStream_t stream)
+    {
+        kernel_split_frame_y8_y8_from_y8i_cuda<<<blocks_for(count), RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(
+            out[0], out[1], count, reinterpret_cast<const rscuda::y8i_pixel*>(src));
+    });
 }
 
 __global__ void kernel_split_frame_y16_y16_from_y12i_cuda(uint16_t* a, uint16_t* b, int count, const rscuda::y12i_pixel * source)
@@ -356,44 +312,14 @@ __global__ void kernel_split_frame_y16_y16_from_y12i_cuda(uint16_t* a, uint16_t*
 
 void rscuda::y16_y16_from_y12i_10_cuda_helper(uint8_t* const dest[], int count, const rscuda::y12i_pixel * source)
 {
-    /*
-        cudaEvent_t start, stop;
-        cudaEventCreate(&start);
-        cudaEventCreate(&stop);
-        cudaEventRecord(start); */
-
-    source = reinterpret_cast<const y12i_pixel*>(source);
-
-    int numBlocks = count / RS2_CUDA_THREADS_PER_BLOCK;
-    uint16_t* a = reinterpret_cast<uint16_t*>(dest[0]);
-    uint16_t* b = reinterpret_cast<uint16_t*>(dest[1]);
-
-    auto d_src = alloc_dev<rscuda::y12i_pixel>(count);
-    auto d_dst_0 = alloc_dev<uint16_t>(count);
-    auto d_dst_1 = alloc_dev<uint16_t>(count);
-
-
-    auto result = cudaMemcpy(d_src.get(), source, count * sizeof(rscuda::y12i_pixel), cudaMemcpyHostToDevice);
-    assert(result == cudaSuccess);
-
-    kernel_split_frame_y16_y16_from_y12i_cuda <<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK>>> (d_dst_0.get(), d_dst_1.get(), count, d_src.get());
-    cudaStreamSynchronize(0);
-
-    result = cudaGetLastError();
-    assert(result == cudaSuccess);
+    void* dst[] = { dest[0], dest[1] };
+    size_t dst_size[] = { count * sizeof(uint16_t), count * sizeof(uint16_t) };
 
-    result = cudaMemcpy(a, d_dst_0.get(), count * sizeof(uint16_t), cudaMemcpyDeviceToHost);
-    assert(result == cudaSuccess);
-    result = cudaMemcpy(b, d_dst_1.get(), count * sizeof(uint16_t), cudaMemcpyDeviceToHost);
-    assert(result == cudaSuccess);
-
-    /*
-    cudaEventRecord(stop);
-    cudaEventSynchronize(stop);
-    float milliseconds = 0;
-    cudaEventElapsedTime(&milliseconds, start, stop);
-    std::cout << milliseconds << std::endl;
-    */
+    convert_on_device(source, count * sizeof(rscuda::y12i_pixel), 2, dst, dst_size, [&](const uint8_t* src, uint8_t* const out[], cudaStream_t stream)
+    {
+        kernel_split_frame_y16_y16_from_y12i_cuda<<<blocks_for(count), RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(
+            reinterpret_cast<uint16_t*>(out[0]), reinterpret_cast<uint16_t*>(out[1]), count, reinterpret_cast<const rscuda::y12i_pixel*>(src));
+    });
 }
 
 
@@ -409,33 +335,17 @@ __global__ void kernel_z16_y8_from_sr300_inzi_cuda(const uint16_t* source, uint8
 
 void rscuda::unpack_z16_y8_from_sr300_inzi_cuda(uint8_t * const dest, const uint16_t * source, int count)
 {
-    /*  cudaEvent_t start, stop;
-        cudaEventCreate(&start);
-        cudaEventCreate(&stop);
-        cudaEventRecord(start); */
-
-    auto d_src = alloc_dev<uint16_t>(count);
-    auto d_dst = alloc_dev<uint8_t>(count);
-
-    int numBlocks = count / RS2_CUDA_THREADS_PER_BLOCK;
-
-    auto result = cudaMemcpy(d_src.get(), source, count * sizeof(uint16_t), cudaMemcpyHostToDevice);
-    assert(result == cudaSuccess);
-
-    kernel_z16_y8_from_sr300_inzi_cuda <<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK >>> (d_src.get(), d_dst.get(), count);
-    cudaStreamSynchronize(0);
-
-    result = cudaMemcpy(dest, d_dst.get(), count * sizeof(uint8_t), cudaMemcpyDeviceToHost);
-    assert(result == cudaSuccess);
+    void* dst[] = { dest };
+    size_t dst_size[] = { size_t(count) };
 
-    /*  cudaEventRecord(stop);
-        cudaEventSynchronize(stop);
-        float milliseconds = 0;
-        cudaEventElapsedTime(&milliseconds, start, stop);
-        std::cout << milliseconds << std::endl; */
+    convert_on_device(source, count * sizeof(uint16_t), 1, dst, dst_size, [&](const uint8_t* src, uint8_t* const out[], cudaStream_t stream)
+    {
+        kernel_z16_y8_from_sr300_inzi_cuda<<<blocks_for(count), RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(
+            reinterpret_cast<const uint16_t*>(src), out[0], count);
+    });
 }
 
-__global__ void kernel_z16_y16_from_sr300_inzi_cuda(uint16_t* const source, uint16_t* const dest, int count)
+__global__ void kernel_z16_y16_from_sr300_inzi_cuda(const uint16_t* source, uint16_t* const dest, int count)
 {
     int i = blockDim.x * blockIdx.x + threadIdx.x;
 
@@ -447,30 +357,14 @@ __global__ void kernel_z16_y16_from_sr300_inzi_cuda(uint16_t* const source, uint
 
 void rscuda::unpack_z16_y16_from_sr300_inzi_cuda(uint16_t * const dest, const uint16_t * source, int count)
 {
-    /*  cudaEvent_t start, stop;
-        cudaEventCreate(&start);
-        cudaEventCreate(&stop);
-        cudaEventRecord(start); */
-
-    auto d_src = alloc_dev<uint16_t>(count);
-    auto d_dst = alloc_dev<uint16_t>(count);
-
-    int numBlocks = count / RS2_CUDA_THREADS_PER_BLOCK;
-
-    auto result = cudaMemcpy(d_src.get(), source, count * sizeof(uint16_t), cudaMemcpyHostToDevice);
-    assert(result == cudaSuccess);
+    void* dst[] = { dest };
+    size_t dst_size[] = { count * sizeof(uint16_t) };
 
-    kernel_z16_y16_from_sr300_inzi_cuda << <numBlocks, RS2_CUDA_THREADS_PER_BLOCK >> > (d_src.get(), d_dst.get(), count);
-    cudaStreamSynchronize(0);
-
-    result = cudaMemcpy(dest, d_dst.get(), count * sizeof(uint16_t), cudaMemcpyDeviceToHost);
-    assert(result == cudaSuccess);
-
-    /*	cudaEventRecord(stop);
-        cudaEventSynchronize(stop);
-        float milliseconds = 0;
-        cudaEventElapsedTime(&milliseconds, start, stop);
-        std::cout << milliseconds << std::endl; */
+    convert_on_device(source, count * sizeof(uint16_t), 1, dst, dst_size, [&](const uint8_t* src, uint8_t* const out[], cudaStream_t stream)
+    {
+        kernel_z16_y16_from_sr300_inzi_cuda<<<blocks_for(count), RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(
+            reinterpret_cast<const uint16_t*>(src), reinterpret_cast<uint16_t*>(out[0]), count);
+    });
 }
 
 #endif
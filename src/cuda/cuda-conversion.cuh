@@ -28,7 +28,12 @@ namespace rscuda
     struct y12i_pixel { uint8_t rl : 8, rh : 4, ll : 4, lh : 8; __host__ __device__ int l() const { return lh << 4 | ll; } __host__ __device__ int r() const { return rh << 8 | rl; } };
     void y8_y8_from_y8i_cuda_helper(uint8_t* const dest[], int count, const y8i_pixel * source);
     void y16_y16_from_y12i_10_cuda_helper(uint8_t* const dest[], int count, const rscuda::y12i_pixel * source);
+    // Each conversion runs on a CUDA stream of the calling thread, through device and pinned staging buffers that are
+    // kept (and grown as needed) across frames. They return once 'dst' holds the result.
     void unpack_yuy2_cuda_helper(const uint8_t* src, uint8_t* dst, int n, rs2_format format);
+    void unpack_uyvy_cuda_helper(const uint8_t* src, uint8_t* dst, int n, rs2_format format);
+    void unpack_m420_cuda_helper(const uint8_t* src, uint8_t* dst, int width, int height, rs2_format format);
+    void unpack_y411_cuda_helper(const uint8_t* src, uint8_t* dst, int width, int height);
     
     template<rs2_format FORMAT> void unpack_yuy2_cuda(uint8_t * const d[], const uint8_t * s, int n)
     {
@@ -37,6 +42,16 @@ namespace rscuda
 
         unpack_yuy2_cuda_helper(src, dst, n, FORMAT);
     }
+
+    template<rs2_format FORMAT> void unpack_uyvy_cuda(uint8_t * const d[], const uint8_t * s, int n)
+    {
+        unpack_uyvy_cuda_helper(s, d[0], n, FORMAT);
+    }
+
+    template<rs2_format FORMAT> void unpack_m420_cuda(uint8_t * const d[], const uint8_t * s, int width, int height)
+    {
+        unpack_m420_cuda_helper(s, d[0], width, height, FORMAT);
+    }
     
     template<class SOURCE> void split_frame_y8_y8_from_y8i_cuda(uint8_t* const dest[], int count, const SOURCE * source)
     {
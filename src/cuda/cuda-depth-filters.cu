@@ -0,0 +1,680 @@
+#ifdef RS2_USE_CUDA
+
+#include "cuda-depth-filters.cuh"
+#include "../../include/librealsense2/rs.h"
+#include "rscuda_utils.cuh"
+#include <cfloat>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+using namespace rscuda;
+
+#define RS2_CUDA_THREADS_PER_BLOCK 256
+
+namespace
+{
+    int blocks_for(int count)
+    {
+        return (count + RS2_CUDA_THREADS_PER_BLOCK - 1) / RS2_CUDA_THREADS_PER_BLOCK;
+    }
+
+    // Moves frames between the host and the device through one page-locked buffer, so the copies can be asynchronous
+    // on the helper's stream
+    struct staging
+    {
+        pinned_buffer pinned;
+
+        void upload(void * device, const void * host, size_t size, cudaStream_t stream)
+        {
+            auto p = pinned.get(size);
+            memcpy(p, host, size);
+            check_cuda(cudaMemcpyAsync(device, p, size, cudaMemcpyHostToDevice, stream), "cudaMemcpyAsync");
+        }
+
+        // Waits for everything queued on the stream, then copies the result to the host
+        void download(void * host, const void * device, size_t size, cudaStream_t stream)
+        {
+            auto p = pinned.get(size);
+            check_cuda(cudaGetLastError(), "kernel launch");
+            check_cuda(cudaMemcpyAsync(p, device, size, cudaMemcpyDeviceToHost, stream), "cudaMemcpyAsync");
+            check_cuda(cudaStreamSynchronize(stream), "cudaStreamSynchronize");
+            memcpy(host, p, size);
+        }
+    };
+
+    // a * alpha + b * (1 - alpha), rounded as the CPU code does it: without fusing the multiplications into the addition
+    __device__ inline float blend(float a, float b, float alpha, float one_minus_alpha)
+    {
+        return __fadd_rn(__fmul_rn(a, alpha), __fmul_rn(b, one_minus_alpha));
+    }
+
+    __device__ inline uint16_t abs_diff(uint16_t a, uint16_t b) { return uint16_t(a > b ? a - b : b - a); }
+    __device__ inline float abs_diff(float a, float b) { return fabsf(a - b); }
+
+    // The CPU code tests the bits of floating-point values, so -0 is not empty and only positive values are valid
+    __device__ inline bool is_empty(float x) { return __float_as_int(x) == 0; }
+    __device__ inline bool is_empty(uint16_t x) { return x == 0; }
+    __device__ inline bool is_valid_disparity(float x) { return __float_as_int(x) > 0; }
+
+    // std::isnormal()
+    __device__ inline bool is_normal(float x)
+    {
+        float const a = fabsf(x);
+        return a >= FLT_MIN && a <= FLT_MAX;
+    }
+}
+
+
+// Decimation
+
+__global__
+void kernel_decimate_depth(const uint16_t * in, uint16_t * out, int width_in, int scale,
+    int real_width, int real_height, int padded_width, int padded_height)
+{
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    int j = blockIdx.y * blockDim.y + threadIdx.y;
+    if (i >= padded_width || j >= padded_height)
+        return;
+
+    uint16_t result = 0;
+    if (i < real_width && j < real_height)
+    {
+        const uint16_t * block = in + (size_t)j * scale * width_in + i * scale;
+        if (scale == 2 || scale == 3)
+        {
+            // Insertion-sort the non-zero values; the median networks of the CPU code pick the same one
+            uint16_t values[9];
+            int n = 0;
+            for (int y = 0; y < scale; ++y)
+                for (int x = 0; x < scale; ++x)
+                {
+                    uint16_t v = block[y * width_in + x];
+                    if (!v)
+                        continue;
+                    int k = n++;
+                    for (; k > 0 && values[k - 1] > v; --k)
+                        values[k] = values[k - 1];
+                    values[k] = v;
+                }
+            if (n)
+                result = values[(n - 1) / 2];
+        }
+        else
+        {
+            int sum = 0;
+            int counter = 0;
+            for (int y = 0; y < scale; ++y)
+                for (int x = 0; x < scale; ++x)
+                {
+                    uint16_t v = block[y * width_in + x];
+                    sum += v;
+                    counter += (v != 0);
+                }
+            result = uint16_t(counter == 0 ? 0 : sum / counter);
+        }
+    }
+    out[(size_t)j * padded_width + i] = result;
+}
+
+struct rscuda::decimation_cuda_helper::buffers
+{
+    cuda_stream stream;
+    staging staged;
+    device_buffer in, out;
+};
+
+rscuda::decimation_cuda_helper::decimation_cuda_helper()
+    : _buffers(new buffers())
+{
+}
+
+rscuda::decimation_cuda_helper::~decimation_cuda_helper() = default;
+
+void rscuda::decimation_cuda_helper::decimate_depth(const uint16_t * in, uint16_t * out, int width_in, int height_in, int scale,
+    int real_width, int real_height, int padded_width, int padded_height)
+{
+    auto & b = *_buffers;
+    size_t in_size = (size_t)width_in * height_in * sizeof(uint16_t);
+    size_t out_size = (size_t)padded_width * padded_height * sizeof(uint16_t);
+
+    auto d_in = b.in.get(in_size);
+    auto d_out = b.out.get(out_size);
+    b.staged.upload(d_in, in, in_size, b.stream);
+
+    dim3 threads(16, 16);
+    dim3 blocks((padded_width + threads.x - 1) / threads.x, (padded_height + threads.y - 1) / threads.y);
+    kernel_decimate_depth<<<blocks, threads, 0, b.stream>>>(reinterpret_cast<const uint16_t *>(d_in), reinterpret_cast<uint16_t *>(d_out),
+        width_in, scale, real_width, real_height, padded_width, padded_height);
+
+    b.staged.download(out, d_out, out_size, b.stream);
+}
+
+
+// Disparity transform
+
+template<typename TIN, typename TOUT>
+__global__
+void kernel_disparity_convert(const TIN * in, TOUT * out, int count, float d2d_convert_factor, float round)
+{
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= count)
+        return;
+
+    float input = in[i];
+    out[i] = is_normal(input) ? static_cast<TOUT>(__fadd_rn(__fdiv_rn(d2d_convert_factor, input), round)) : TOUT(0);
+}
+
+struct rscuda::disparity_cuda_helper::buffers
+{
+    cuda_stream stream;
+    staging staged;
+    device_buffer in, out;
+};
+
+rscuda::disparity_cuda_helper::disparity_cuda_helper()
+    : _buffers(new buffers())
+{
+}
+
+rscuda::disparity_cuda_helper::~disparity_cuda_helper() = default;
+
+void rscuda::disparity_cuda_helper::depth_to_disparity(const uint16_t * in, float * out, int count, float d2d_convert_factor)
+{
+    auto & b = *_buffers;
+    auto d_in = b.in.get(count * sizeof(uint16_t));
+    auto d_out = b.out.get(count * sizeof(float));
+    b.staged.upload(d_in, in, count * sizeof(uint16_t), b.stream);
+    kernel_disparity_convert<<<blocks_for(count), RS2_CUDA_THREADS_PER_BLOCK, 0, b.stream>>>(
+        reinterpret_cast<const uint16_t *>(d_in), reinterpret_cast<float *>(d_out), count, d2d_convert_factor, 0.f);
+    b.staged.download(out, d_out, count * sizeof(float), b.stream);
+}
+
+void rscuda::disparity_cuda_helper::disparity_to_depth(const float * in, uint16_t * out, int count, float d2d_convert_factor)
+{
+    auto & b = *_buffers;
+    auto d_in = b.in.get(count * sizeof(float));
+    auto d_out = b.out.get(count * sizeof(uint16_t));
+    b.staged.upload(d_in, in, count * sizeof(float), b.stream);
+    kernel_disparity_convert<<<blocks_for(count), RS2_CUDA_THREADS_PER_BLOCK, 0, b.stream>>>(
+        reinterpret_cast<const float *>(d_in), reinterpret_cast<uint16_t *>(d_out), count, d2d_convert_factor, 0.5f);
+    b.staged.download(out, d_out, count * sizeof(uint16_t), b.stream);
+}
+
+
+// Spatial filter
+
+// One step of the disparity recursion, for the next pixel 'x'; returns the value to store back. Whether the previous
+// pixel is valid is what the CPU code tracks as its CurrentlyValid/CurrentlyInvalid state (see spatial-filter-simd.h).
+__device__ inline float dxf_step(float x, float & state, float & previous, float alpha, float one_minus_alpha, float delta)
+{
+    bool const x_valid = is_valid_disparity(x);
+    float const diff = previous - x;
+    bool const smooth = x_valid && is_valid_disparity(previous) && diff < delta && diff > -delta;
+    float const filtered = blend(x, state, alpha, one_minus_alpha);
+    state = smooth ? filtered : (x_valid ? x : state);
+    previous = x;
+    return smooth ? filtered : x;
+}
+
+__global__
+void kernel_dxf_horizontal_disparity(float * image, int width, int height, float alpha, float delta)
+{
+    int v = blockIdx.x * blockDim.x + threadIdx.x;
+    if (v >= height)
+        return;
+
+    float * row = image + (size_t)v * width;
+    float const one_minus_alpha = 1.0f - alpha;
+
+    float state = row[0], previous = state;
+    for (int u = 1; u < width; u++)
+        row[u] = dxf_step(row[u], state, previous, alpha, one_minus_alpha, delta);
+
+    state = previous = row[width - 1];
+    for (int u = width - 2; u >= 0; u--)
+        row[u] = dxf_step(row[u], state, previous, alpha, one_minus_alpha, delta);
+}
+
+__global__
+void kernel_dxf_vertical_disparity(float * image, int width, int height, float alpha, float delta)
+{
+    int u = blockIdx.x * blockDim.x + threadIdx.x;
+    if (u >= width)
+        return;
+
+    float * col = image + u;
+    float const one_minus_alpha = 1.0f - alpha;
+
+    float state = col[0], previous = state;
+    for (int v = 1; v < height; v++)
+        col[(size_t)v * width] = dxf_step(col[(size_t)v * width], state, previous, alpha, one_minus_alpha, delta);
+
+    state = previous = col[(size_t)(height - 1) * width];
+    for (int v = height - 2; v >= 0; v--)
+        col[(size_t)v * width] = dxf_step(col[(size_t)v * width], state, previous, alpha, one_minus_alpha, delta);
+}
+
+// spatial_filter::intertial_holes_fill(), one row per thread
+__global__
+void kernel_dxf_holes_fill_disparity(float * image, int width, int height, int radius)
+{
+    int v = blockIdx.x * blockDim.x + threadIdx.x;
+    if (v >= height)
+        return;
+
+    float * row = image + (size_t)v * width;
+    int cur_fill = 0;
+    for (int u = 1; u < width; u++)
+    {
+        if (is_empty(row[u]))
+        {
+            if (++cur_fill < radius)
+                row[u] = row[u - 1];
+        }
+        else
+            cur_fill = 0;
+    }
+
+    // As in the CPU code, this pass goes from the last pixel to the second, and the last one takes after the first
+    // pixel of the next row (which neither pass changes)
+    bool const last_row = v + 1 == height;
+    cur_fill = 0;
+    for (int u = width - 1; u >= 1; u--)
+    {
+        if (is_empty(row[u]))
+        {
+            if (++cur_fill < radius && (u + 1 < width || !last_row))
+                row[u] = row[u + 1];
+        }
+        else
+            cur_fill = 0;
+    }
+}
+
+// spatial_filter::recursive_filter_horizontal<uint16_t>(), one row per thread
+__global__
+void kernel_dxf_horizontal_depth(uint16_t * image, int width, int height, float alpha, uint16_t delta_z, int holes_fill_radius)
+{
+    int v = blockIdx.x * blockDim.x + threadIdx.x;
+    if (v >= height)
+        return;
+
+    uint16_t * row = image + (size_t)v * width;
+    float const one_minus_alpha = 1.0f - alpha;
+
+    // left to right
+    uint16_t val0 = row[0];
+    int cur_fill = 0;
+    for (int u = 1; u < width - 1; u++)
+    {
+        uint16_t val1 = row[u];
+        if (val0 >= 1)
+        {
+            if (val1 >= 1)
+            {
+                cur_fill = 0;
+                uint16_t diff = abs_diff(val1, val0);
+                if (diff >= 1 && diff <= delta_z)
+                {
+                    val1 = static_cast<uint16_t>(__fadd_rn(blend(val1, val0, alpha, one_minus_alpha), 0.5f));
+                    row[u] = val1;
+                }
+            }
+            else if (holes_fill_radius && ++cur_fill < holes_fill_radius)
+                row[u] = val1 = val0;
+        }
+        val0 = val1;
+    }
+
+    // right to left
+    uint16_t val1 = row[width - 1];
+    cur_fill = 0;
+    for (int u = width - 2; u >= 0; u--)
+    {
+        uint16_t val0 = row[u];
+        if (val1 >= 1)
+        {
+            if (val0 > 1)
+            {
+                cur_fill = 0;
+                uint16_t diff = abs_diff(val1, val0);
+                if (diff <= delta_z)
+                {
+                    val0 = static_cast<uint16_t>(__fadd_rn(blend(val0, val1, alpha, one_minus_alpha), 0.5f));
+                    row[u] = val0;
+                }
+            }
+            else if (holes_fill_radius && ++cur_fill < holes_fill_radius)
+                row[u] = val0 = val1;
+        }
+        val1 = val0;
+    }
+}
+
+// spatial_filter::recursive_filter_vertical<uint16_t>(), one column per thread
+__global__
+void kernel_dxf_vertical_depth(uint16_t * image, int width, int height, float alpha, uint16_t delta_z)
+{
+    int u = blockIdx.x * blockDim.x + threadIdx.x;
+    if (u >= width)
+        return;
+
+    uint16_t * col = image + u;
+    float const one_minus_alpha = 1.0f - alpha;
+
+    // top to bottom
+    for (int v = 1; v < height; v++)
+    {
+        uint16_t im0 = col[(size_t)(v - 1) * width];
+        uint16_t imw = col[(size_t)v * width];
+        if (abs_diff(im0, imw) < delta_z)
+            col[(size_t)v * width] = static_cast<uint16_t>(__fadd_rn(blend(imw, im0, alpha, one_minus_alpha), 0.5f));
+    }
+
+    // bottom to top
+    for (int v = height - 2; v >= 0; v--)
+    {
+        uint16_t im0 = col[(size_t)v * width];
+        uint16_t imw = col[(size_t)(v + 1) * width];
+        if (im0 >= 1 && imw >= 1 && abs_diff(im0, imw) < delta_z)
+            col[(size_t)v * width] = static_cast<uint16_t>(__fadd_rn(blend(im0, imw, alpha, one_minus_alpha), 0.5f));
+    }
+}
+
+struct rscuda::spatial_filter_cuda_helper::buffers
+{
+    cuda_stream stream;
+    staging staged;
+    device_buffer image;
+};
+
+rscuda::spatial_filter_cuda_helper::spatial_filter_cuda_helper()
+    : _buffers(new buffers())
+{
+}
+
+rscuda::spatial_filter_cuda_helper::~spatial_filter_cuda_helper() = default;
+
+void rscuda::spatial_filter_cuda_helper::smooth_disparity(float * image, int width, int height, float alpha, float delta, int iterations,
+    int holes_fill_radius)
+{
+    auto & b = *_buffers;
+    size_t size = (size_t)width * height * sizeof(float);
+    auto d_image = reinterpret_cast<float *>(b.image.get(size));
+    b.staged.upload(d_image, image, size, b.stream);
+
+    for (int i = 0; i < iterations; i++)
+    {
+        kernel_dxf_horizontal_disparity<<<blocks_for(height), RS2_CUDA_THREADS_PER_BLOCK, 0, b.stream>>>(d_image, width, height, alpha, delta);
+        kernel_dxf_vertical_disparity<<<blocks_for(width), RS2_CUDA_THREADS_PER_BLOCK, 0, b.stream>>>(d_image, width, height, alpha, delta);
+    }
+    if (holes_fill_radius)
+        kernel_dxf_holes_fill_disparity<<<blocks_for(height), RS2_CUDA_THREADS_PER_BLOCK, 0, b.stream>>>(d_image, width, height, holes_fill_radius);
+
+    b.staged.download(image, d_image, size, b.stream);
+}
+
+void rscuda::spatial_filter_cuda_helper::smooth_depth(uint16_t * image, int width, int height, float alpha, float delta, int iterations,
+    int holes_fill_radius)
+{
+    auto & b = *_buffers;
+    size_t size = (size_t)width * height * sizeof(uint16_t);
+    auto d_image = reinterpret_cast<uint16_t *>(b.image.get(size));
+    b.staged.upload(d_image, image, size, b.stream);
+
+    uint16_t delta_z = static_cast<uint16_t>(delta);
+    for (int i = 0; i < iterations; i++)
+    {
+        kernel_dxf_horizontal_depth<<<blocks_for(height), RS2_CUDA_THREADS_PER_BLOCK, 0, b.stream>>>(d_image, width, height, alpha, delta_z, holes_fill_radius);
+        kernel_dxf_vertical_depth<<<blocks_for(width), RS2_CUDA_THREADS_PER_BLOCK, 0, b.stream>>>(d_image, width, height, alpha, delta_z);
+    }
+
+    b.staged.download(image, d_image, size, b.stream);
+}
+
+
+// Temporal filter
+
+// Passed by value, so the table needs no copy of its own
+struct persistence_table
+{
+    uint8_t credible[256];
+};
+
+// Reads the frame from 'in' and writes the result to 'out', which may be the same buffer
+template<typename T>
+__global__
+void kernel_temporal_smooth(const T * in, T * out, T * last_frame, uint8_t * history, int count, float alpha, T delta_z,
+    uint8_t mask, persistence_table table)
+{
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= count)
+        return;
+
+    T cur_val = in[i];
+    T prev_val = last_frame[i];
+    T result = cur_val;
+
+    if (cur_val)
+    {
+        if (!prev_val)
+        {
+            last_frame[i] = cur_val;
+            history[i] = mask;
+        }
+        else if (abs_diff(cur_val, prev_val) < delta_z)
+        {  // old and new val agree
+            history[i] |= mask;
+            result = static_cast<T>(blend(cur_val, prev_val, alpha, 1.f - alpha));
+            last_frame[i] = result;
+        }
+        else
+        {
+            last_frame[i] = cur_val;
+            history[i] = mask;
+        }
+    }
+    else
+    {  // no cur_val
+        if (prev_val && (table.credible[history[i]] & mask))
+            result = prev_val;
+        history[i] &= ~mask;
+    }
+    out[i] = result;
+}
+
+struct rscuda::temporal_filter_cuda_helper::buffers
+{
+    cuda_stream stream;
+    staging staged;
+    device_buffer frame, last_frame, history;
+    size_t state_size = 0;  // Of the last frame; 0 when it needs clearing
+
+    template<typename T>
+    void prepare_state(int count)
+    {
+        size_t size = count * sizeof(T);
+        auto d_last_frame = last_frame.get(size);
+        auto d_history = history.get(count);
+        if (state_size != size)
+        {
+            check_cuda(cudaMemsetAsync(d_last_frame, 0, size, stream), "cudaMemsetAsync");
+            check_cuda(cudaMemsetAsync(d_history, 0, count, stream), "cudaMemsetAsync");
+            state_size = size;
+        }
+    }
+
+    template<typename T>
+    void launch(const T * d_in, T * d_out, int count, float alpha, uint8_t delta, const uint8_t * persistence_map,
+        int cur_frame_index)
+    {
+        persistence_table table;
+        memcpy(table.credible, persistence_map, sizeof(table.credible));
+        kernel_temporal_smooth<T><<<blocks_for(count), RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(d_in, d_out,
+            reinterpret_cast<T *>(last_frame.get(state_size)), history.get(count), count,
+            alpha, static_cast<T>(delta), uint8_t(1 << cur_frame_index), table);
+    }
+
+    template<typename T>
+    void smooth(T * host_frame, int count, float alpha, uint8_t delta, const uint8_t * persistence_map, int cur_frame_index)
+    {
+        size_t size = count * sizeof(T);
+        prepare_state<T>(count);
+        auto d_frame = reinterpret_cast<T *>(frame.get(size));
+        staged.upload(d_frame, host_frame, size, stream);
+        launch<T>(d_frame, d_frame, count, alpha, delta, persistence_map, cur_frame_index);
+        staged.download(host_frame, d_frame, size, stream);
+    }
+
+    template<typename T>
+    void smooth_to_device(const T * host_in, const T * d_in, T * d_out, int count, float alpha, uint8_t delta,
+        const uint8_t * persistence_map, int cur_frame_index)
+    {
+        prepare_state<T>(count);
+        if (!d_in)
+        {
+            // The result goes to 'd_out', so the input can be uploaded there and filtered in place
+            staged.upload(d_out, host_in, count * sizeof(T), stream);
+            d_in = d_out;
+        }
+        launch<T>(d_in, d_out, count, alpha, delta, persistence_map, cur_frame_index);
+        check_cuda(cudaGetLastError(), "kernel launch");
+        check_cuda(cudaStreamSynchronize(stream), "cudaStreamSynchronize");
+    }
+};
+
+rscuda::temporal_filter_cuda_helper::temporal_filter_cuda_helper()
+    : _buffers(new buffers())
+{
+}
+
+rscuda::temporal_filter_cuda_helper::~temporal_filter_cuda_helper() = default;
+
+void rscuda::temporal_filter_cuda_helper::reset()
+{
+    _buffers->state_size = 0;
+}
+
+void rscuda::temporal_filter_cuda_helper::smooth_disparity(float * frame, int count, float alpha, uint8_t delta,
+    const uint8_t * persistence_map, int cur_frame_index)
+{
+    _buffers->smooth(frame, count, alpha, delta, persistence_map, cur_frame_index);
+}
+
+void rscuda::temporal_filter_cuda_helper::smooth_depth(uint16_t * frame, int count, float alpha, uint8_t delta,
+    const uint8_t * persistence_map, int cur_frame_index)
+{
+    _buffers->smooth(frame, count, alpha, delta, persistence_map, cur_frame_index);
+}
+
+void rscuda::temporal_filter_cuda_helper::smooth_depth_to_device(const uint16_t * input, const uint16_t * d_input,
+    uint16_t * d_output, int count, float alpha, uint8_t delta, const uint8_t * persistence_map, int cur_frame_index)
+{
+    _buffers->smooth_to_device(input, d_input, d_output, count, alpha, delta, persistence_map, cur_frame_index);
+}
+
+
+// Hole filling
+
+// hole_filling_filter::holes_fill_left(), one row per thread
+template<typename T>
+__global__
+void kernel_holes_fill_left(T * image, int width, int height)
+{
+    int v = blockIdx.x * blockDim.x + threadIdx.x;
+    if (v >= height)
+        return;
+
+    T * row = image + (size_t)v * width;
+    for (int u = 1; u < width; u++)
+        if (is_empty(row[u]))
+            row[u] = row[u - 1];
+}
+
+// hole_filling_filter::holes_fill_farest() and holes_fill_nearest(), which fill in raster order: a pixel sees the
+// filled values above it and to its left, but the original ones below it. Each thread takes rows, and row r handles
+// column c at step c + 2r, after all of these and before the pixels below it are touched. The steps are synchronized
+// within one block, so there is a single block.
+template<typename T, bool NEAREST>
+__global__
+void kernel_holes_fill_around(T * image, int width, int height)
+{
+    int const steps = width + 2 * height;
+    for (int t = 0; t < steps; t++)
+    {
+        for (int r = 1 + threadIdx.x; r < height - 1; r += blockDim.x)
+        {
+            int c = t - 2 * r;
+            if (c < 1 || c >= width)
+                continue;
+
+            T * p = image + (size_t)r * width + c;
+            if (!is_empty(*p))
+                continue;
+
+            T const around[] = { *(p - width - 1), *(p - 1), *(p + width - 1), *(p + width) };
+            T tmp = *(p - width);
+            for (T q : around)
+            {
+                if (NEAREST ? (!is_empty(q) && q < tmp) : (q > tmp))
+                    tmp = q;
+            }
+            *p = tmp;
+        }
+        __syncthreads();
+    }
+}
+
+struct rscuda::hole_filling_cuda_helper::buffers
+{
+    cuda_stream stream;
+    staging staged;
+    device_buffer image;
+
+    template<typename T>
+    void fill(T * host_image, int width, int height, int mode)
+    {
+        // Same values as holes_filling_types
+        enum { fill_from_left, farest_from_around, nearest_from_around };
+        if (mode < fill_from_left || mode > nearest_from_around)
+            throw std::runtime_error("Unsupported hole filling mode: " + std::to_string(mode) + " is out of range.");
+
+        size_t size = (size_t)width * height * sizeof(T);
+        auto d_image = reinterpret_cast<T *>(image.get(size));
+        staged.upload(d_image, host_image, size, stream);
+
+        int rows = height - 2;
+        if (mode == fill_from_left)
+            kernel_holes_fill_left<T><<<blocks_for(height), RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(d_image, width, height);
+        else if (rows > 0)
+        {
+            int threads = rows < 1024 ? rows : 1024;
+            if (mode == farest_from_around)
+                kernel_holes_fill_around<T, false><<<1, threads, 0, stream>>>(d_image, width, height);
+            else
+                kernel_holes_fill_around<T, true><<<1, threads, 0, stream>>>(d_image, width, height);
+        }
+
+        staged.download(host_image, d_image, size, stream);
+    }
+};
+
+rscuda::hole_filling_cuda_helper::hole_filling_cuda_helper()
+    : _buffers(new buffers())
+{
+}
+
+rscuda::hole_filling_cuda_helper::~hole_filling_cuda_helper() = default;
+
+void rscuda::hole_filling_cuda_helper::fill_disparity(float * image, int width, int height, int mode)
+{
+    _buffers->fill(image, width, height, mode);
+}
+
+void rscuda::hole_filling_cuda_helper::fill_depth(uint16_t * image, int width, int height, int mode)
+{
+    _buffers->fill(image, width, height, mode);
+}
+
+#endif // RS2_USE_CUDA
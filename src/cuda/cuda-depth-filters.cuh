@@ -0,0 +1,119 @@
+#pragma once
+#ifndef LIBREALSENSE_CUDA_DEPTH_FILTERS_H
+#define LIBREALSENSE_CUDA_DEPTH_FILTERS_H
+
+#ifdef RS2_USE_CUDA
+
+// Types
+#include <stdint.h>
+#include <memory>
+
+#ifdef _MSC_VER
+// Add library dependencies if using VS
+#pragma comment(lib, "cudart_static")
+#endif
+
+// GPU versions of the depth post-processing filters of the recommended D400 chain.
+//
+// Each helper belongs to one filter block and does its work on the block's own stream, keeping its device and pinned
+// staging buffers across frames (as pointcloud_cuda_helper does): a frame costs an upload, the kernels and a download.
+// The results are the same as the CPU code's, which is still what runs without CUDA.
+namespace rscuda
+{
+    // Same as decimation_filter::decimate_depth(): the median of the non-zero values of each scale x scale block for
+    // scales 2 and 3 (the lower of the middle two for an even number of them), their mean for larger scales, and zeros
+    // in the padding
+    class decimation_cuda_helper
+    {
+    public:
+        decimation_cuda_helper();
+        ~decimation_cuda_helper();
+
+        void decimate_depth(const uint16_t * in, uint16_t * out, int width_in, int height_in, int scale,
+            int real_width, int real_height, int padded_width, int padded_height);
+
+    private:
+        struct buffers;
+        std::unique_ptr<buffers> _buffers;
+    };
+
+    // Same as disparity_transform::convert(), in either direction
+    class disparity_cuda_helper
+    {
+    public:
+        disparity_cuda_helper();
+        ~disparity_cuda_helper();
+
+        void depth_to_disparity(const uint16_t * in, float * out, int count, float d2d_convert_factor);
+        void disparity_to_depth(const float * in, uint16_t * out, int count, float d2d_convert_factor);
+
+    private:
+        struct buffers;
+        std::unique_ptr<buffers> _buffers;
+    };
+
+    // Same as spatial_filter::dxf_smooth(), in place: rows are filtered by one thread each, and so are columns
+    class spatial_filter_cuda_helper
+    {
+    public:
+        spatial_filter_cuda_helper();
+        ~spatial_filter_cuda_helper();
+
+        // 'holes_fill_radius' is that of the hole filling pass that follows the iterations; 0 for none
+        void smooth_disparity(float * image, int width, int height, float alpha, float delta, int iterations,
+            int holes_fill_radius);
+        // 'holes_fill_radius' is that of the hole filling done by the horizontal passes
+        void smooth_depth(uint16_t * image, int width, int height, float alpha, float delta, int iterations,
+            int holes_fill_radius);
+
+    private:
+        struct buffers;
+        std::unique_ptr<buffers> _buffers;
+    };
+
+    // Same as temporal_filter::temp_jw_smooth(), in place. The last frame and the history are kept on the device,
+    // from one frame to the next, until reset(), and are never read back; with smooth_depth_to_device(), neither is the
+    // frame itself.
+    class temporal_filter_cuda_helper
+    {
+    public:
+        temporal_filter_cuda_helper();
+        ~temporal_filter_cuda_helper();
+
+        // 'persistence_map' is the 256-entry table of temporal_filter::recalc_persistence_map()
+        void smooth_disparity(float * frame, int count, float alpha, uint8_t delta,
+            const uint8_t * persistence_map, int cur_frame_index);
+        void smooth_depth(uint16_t * frame, int count, float alpha, uint8_t delta,
+            const uint8_t * persistence_map, int cur_frame_index);
+        // Same, from the device at 'd_input' (or from the host at 'input', if 'd_input' is null) to the device at
+        // 'd_output', where the result is left; nothing is copied back to the host
+        void smooth_depth_to_device(const uint16_t * input, const uint16_t * d_input, uint16_t * d_output, int count,
+            float alpha, uint8_t delta, const uint8_t * persistence_map, int cur_frame_index);
+
+        // Start over with no last frame and an empty history
+        void reset();
+
+    private:
+        struct buffers;
+        std::unique_ptr<buffers> _buffers;
+    };
+
+    // Same as hole_filling_filter::apply_hole_filling(), in place; 'mode' is one of holes_filling_types
+    class hole_filling_cuda_helper
+    {
+    public:
+        hole_filling_cuda_helper();
+        ~hole_filling_cuda_helper();
+
+        void fill_disparity(float * image, int width, int height, int mode);
+        void fill_depth(uint16_t * image, int width, int height, int mode);
+
+    private:
+        struct buffers;
+        std::unique_ptr<buffers> _buffers;
+    };
+}
+
+#endif // RS2_USE_CUDA
+
+#endif // LIBREALSENSE_CUDA_DEPTH_FILTERS_H
@@ -0,0 +1,55 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#ifdef RS2_USE_CUDA
+
+#include "cuda-frame.h"
+#include "rscuda_utils.cuh"
+
+
+namespace librealsense
+{
+    struct cuda_section::buffer
+    {
+        rscuda::device_buffer device;
+    };
+
+    cuda_section::cuda_section()
+        : _buffer( new buffer() )
+    {
+    }
+
+    cuda_section::~cuda_section() = default;
+
+    void * cuda_section::device_output( size_t size )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _size = size;
+        _on_device = true;
+        _fetched = false;
+        return _buffer->device.get( size );
+    }
+
+    const void * cuda_section::device_data() const
+    {
+        return _on_device ? _buffer->device.get( _size ) : nullptr;
+    }
+
+    void cuda_section::fetch( void * host )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( ! _on_device || _fetched )
+            return;
+        rscuda::check_cuda( cudaMemcpy( host, _buffer->device.get( _size ), _size, cudaMemcpyDeviceToHost ), "cudaMemcpy" );
+        _fetched = true;
+    }
+
+    void cuda_section::on_unpublish()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _on_device = false;
+        _fetched = false;
+    }
+}
+
+#endif
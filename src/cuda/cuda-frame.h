@@ -0,0 +1,110 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "core/video-frame.h"
+#include "core/depth-frame.h"
+
+#include <librealsense2/hpp/rs_frame.hpp>
+
+#include <memory>
+#include <mutex>
+
+// Archive ids for frame_source::add_extension(), after those of the GL extension (see synthetic-stream-gl.h)
+#define RS2_EXTENSION_VIDEO_FRAME_CUDA (rs2_extension)(RS2_EXTENSION_COUNT + 2)
+#define RS2_EXTENSION_DEPTH_FRAME_CUDA (rs2_extension)(RS2_EXTENSION_COUNT + 3)
+
+
+namespace librealsense
+{
+    // The device memory of a frame produced by a CUDA block.
+    //
+    // The block writes its result to device_output() and leaves the host data alone; the next CUDA block can read it
+    // from device_data() without a round trip over PCIe. The host data is only filled in, once, when something asks
+    // for it through get_frame_data(). The device buffer belongs to the frame, so it is reused when the archive recycles
+    // the frame.
+    class cuda_section
+    {
+    public:
+        cuda_section();
+        ~cuda_section();
+
+        // Where the block writes the frame's 'size' bytes of content; the result must be complete (the block's stream
+        // synchronized) before the frame is published
+        void * device_output( size_t size );
+
+        // The content on the device, or null if it was not produced there
+        const void * device_data() const;
+
+        // Copies the content into 'host', unless it is already there
+        void fetch( void * host );
+
+        // The frame is back in its archive, to be reused for new content
+        void on_unpublish();
+
+    private:
+        struct buffer;
+        std::unique_ptr< buffer > _buffer;
+        std::mutex _mutex;
+        size_t _size = 0;
+        bool _on_device = false;
+        bool _fetched = false;
+    };
+
+    class cuda_addon_interface
+    {
+    public:
+        virtual cuda_section & get_cuda_section() = 0;
+        virtual ~cuda_addon_interface() = default;
+    };
+
+    template< class T >
+    class cuda_addon : public T, public cuda_addon_interface
+    {
+    public:
+        cuda_section & get_cuda_section() override { return _section; }
+        void unpublish() override
+        {
+            _section.on_unpublish();
+            T::unpublish();
+        }
+        const uint8_t * get_frame_data() const override
+        {
+            auto res = T::get_frame_data();
+            _section.fetch( (void *)res );
+            return res;
+        }
+        cuda_addon() : T(), _section() {}
+        cuda_addon( cuda_addon && other )
+            : T( (T &&)std::move( other ) )
+        {
+        }
+        cuda_addon & operator=( cuda_addon && other )
+        {
+            return (cuda_addon &)T::operator=( (T &&)std::move( other ) );
+        }
+
+    private:
+        mutable cuda_section _section;
+    };
+
+    class cuda_video_frame : public cuda_addon< video_frame > {};
+    class cuda_depth_frame : public cuda_addon< depth_frame > {};
+
+    // The device content of a frame, if it is a CUDA frame whose content is on the device; null otherwise
+    inline const void * get_device_data( const rs2::frame & f )
+    {
+        if( auto addon = dynamic_cast< cuda_addon_interface * >( (frame_interface *)f.get() ) )
+            return addon->get_cuda_section().device_data();
+        return nullptr;
+    }
+
+    // The device buffer a CUDA block writes frame 'f' into (see cuda_section::device_output)
+    inline void * get_device_output( const rs2::frame & f, size_t size )
+    {
+        if( auto addon = dynamic_cast< cuda_addon_interface * >( (frame_interface *)f.get() ) )
+            return addon->get_cuda_section().device_output( size );
+        return nullptr;
+    }
+}
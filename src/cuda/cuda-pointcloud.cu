@@ -1,8 +1,12 @@
 #ifdef RS2_USE_CUDA
 
 #include "cuda-pointcloud.cuh"
+#include "rscuda_utils.cuh"
 #include <iostream>
 #include <chrono>
+#include <cstring>
+
+using namespace rscuda;
 
 
 __device__
@@ -61,55 +65,63 @@ void deproject_pixel_to_point_cuda(float points[3], const struct rs2_intrinsics
 __global__
 //void kernel_deproject_depth_cuda(float * points, const rs2_intrinsics & intrin, const uint16_t * depth, std::function<uint16_t(float)> map_depth)
 
-void kernel_deproject_depth_cuda(float * points, const rs2_intrinsics* intrin, const uint16_t * depth, float depth_scale)
+void kernel_deproject_depth_cuda(float * points, const rs2_intrinsics intrin, const uint16_t * depth, float depth_scale)
 {
     int i = blockDim.x * blockIdx.x + threadIdx.x;
-    
-    if (i >= (*intrin).height * (*intrin).width) {
+
+    if (i >= intrin.height * intrin.width) {
         return;
     }
-    int stride = blockDim.x * gridDim.x;
-    int a, b;
-    
-    for (int j = i; j < (*intrin).height * (*intrin).width; j += stride) {
-        b = j / (*intrin).width;
-        a = j - b * (*intrin).width;
-        const float pixel[] = { (float)a, (float)b };
-        deproject_pixel_to_point_cuda(points + j * 3, intrin, pixel, depth_scale * depth[j]);               
-   }
+    int b = i / intrin.width;
+    int a = i - b * intrin.width;
+    const float pixel[] = { (float)a, (float)b };
+    deproject_pixel_to_point_cuda(points + i * 3, &intrin, pixel, depth_scale * depth[i]);
 }
 
 
-void rscuda::deproject_depth_cuda(float * points, const rs2_intrinsics & intrin, const uint16_t * depth, float depth_scale)
+struct rscuda::pointcloud_cuda_helper::buffers
+{
+    cuda_stream stream;
+    device_buffer depth, points;
+    pinned_buffer staged_depth, staged_points;
+};
+
+rscuda::pointcloud_cuda_helper::pointcloud_cuda_helper()
+    : _buffers(new buffers())
+{
+}
+
+rscuda::pointcloud_cuda_helper::~pointcloud_cuda_helper() = default;
+
+void rscuda::pointcloud_cuda_helper::deproject_depth(float * points, const rs2_intrinsics & intrin, const uint16_t * depth, float depth_scale,
+    const uint16_t * device_depth)
 {
     int count = intrin.height * intrin.width;
-    int numBlocks = count / RS2_CUDA_THREADS_PER_BLOCK;
-    
-    float *dev_points = 0;	
-    uint16_t *dev_depth = 0;
-    rs2_intrinsics* dev_intrin = 0;
-    cudaError_t result;
-
-    result = cudaMalloc(&dev_points, count * sizeof(float) * 3);
-    assert(result == cudaSuccess);
-    result = cudaMalloc(&dev_depth, count * sizeof(uint16_t));
-    assert(result == cudaSuccess);
-    result = cudaMalloc(&dev_intrin, sizeof(rs2_intrinsics));
-    assert(result == cudaSuccess);
-       
-    result = cudaMemcpy(dev_depth, depth, count * sizeof(uint16_t), cudaMemcpyHostToDevice);
-    assert(result == cudaSuccess); 
-    result = cudaMemcpy(dev_intrin, &intrin, sizeof(rs2_intrinsics), cudaMemcpyHostToDevice);
-    assert(result == cudaSuccess); 
-     
-    kernel_deproject_depth_cuda<<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK>>>(dev_points, dev_intrin, dev_depth, depth_scale); 
-
-     result = cudaMemcpy(points, dev_points, count * sizeof(float) * 3, cudaMemcpyDeviceToHost);
-     assert(result == cudaSuccess);
-
-    cudaFree(dev_points);
-    cudaFree(dev_depth);
-    cudaFree(dev_intrin);
+    int numBlocks = (count + RS2_CUDA_THREADS_PER_BLOCK - 1) / RS2_CUDA_THREADS_PER_BLOCK;
+    size_t depth_size = count * sizeof(uint16_t);
+    size_t points_size = count * sizeof(float) * 3;
+
+    auto& b = *_buffers;
+    cudaStream_t stream = b.stream;
+
+    // The buffers only grow, so they stay allocated while the profile does not change
+    if (!device_depth)
+    {
+        auto staged_depth = b.staged_depth.get(depth_size);
+        memcpy(staged_depth, depth, depth_size);
+        auto dev_depth = b.depth.get(depth_size);
+        check_cuda(cudaMemcpyAsync(dev_depth, staged_depth, depth_size, cudaMemcpyHostToDevice, stream), "cudaMemcpyAsync");
+        device_depth = reinterpret_cast<const uint16_t*>(dev_depth);
+    }
+
+    auto dev_points = reinterpret_cast<float*>(b.points.get(points_size));
+    kernel_deproject_depth_cuda<<<numBlocks, RS2_CUDA_THREADS_PER_BLOCK, 0, stream>>>(dev_points, intrin, device_depth, depth_scale);
+    check_cuda(cudaGetLastError(), "kernel launch");
+
+    auto staged_points = b.staged_points.get(points_size);
+    check_cuda(cudaMemcpyAsync(staged_points, dev_points, points_size, cudaMemcpyDeviceToHost, stream), "cudaMemcpyAsync");
+    check_cuda(cudaStreamSynchronize(stream), "cudaStreamSynchronize");
+    memcpy(points, staged_points, points_size);
 }
 
 #endif
@@ -10,6 +10,7 @@
 #include "assert.h"
 #include "../../include/librealsense2/rsutil.h"
 #include <functional>
+#include <memory>
 
 // CUDA headers
 #include <cuda_runtime.h>
@@ -23,8 +24,22 @@
 
 namespace rscuda
 {
-    void deproject_depth_cuda(float * points, const rs2_intrinsics & intrin, const uint16_t * depth, float depth_scale);
-
+    // Deprojects the frames of one pointcloud block. The device buffers, the pinned staging buffers and the stream are
+    // kept for as long as the block lives, so a frame costs two copies and a kernel rather than allocations.
+    class pointcloud_cuda_helper
+    {
+    public:
+        pointcloud_cuda_helper();
+        ~pointcloud_cuda_helper();
+
+        // A non-null 'device_depth' is the depth already on the device, used instead of uploading 'depth'
+        void deproject_depth(float * points, const rs2_intrinsics & intrin, const uint16_t * depth, float depth_scale,
+            const uint16_t * device_depth = nullptr);
+
+    private:
+        struct buffers;
+        std::unique_ptr<buffers> _buffers;
+    };
 }
 
 #endif // RS2_USE_CUDA
@@ -4,6 +4,8 @@
 #include <stdexcept>
 #include <memory>
 #include <cassert>
+#include <string>
+#include <stdint.h>
 
 // CUDA headers
 #include <cuda_runtime.h>
@@ -25,6 +27,70 @@ namespace rscuda
         return std::shared_ptr<T>(d_data, [](T* p) { cudaFree(p); });
     }
 
+    inline void check_cuda(cudaError_t result, const char* what)
+    {
+        if (result != cudaSuccess)
+            throw std::runtime_error(std::string(what) + " failed: " + cudaGetErrorString(result));
+    }
+
+    // A device (or, with PINNED, page-locked host) allocation kept across frames: get() only reallocates when asked
+    // for more than it holds, so once it has grown to the frame size there is no allocation per frame.
+    template<bool PINNED>
+    class reusable_buffer
+    {
+    public:
+        reusable_buffer() = default;
+        reusable_buffer(const reusable_buffer&) = delete;
+        reusable_buffer& operator=(const reusable_buffer&) = delete;
+        ~reusable_buffer() { release(); }
+
+        uint8_t* get(size_t size)
+        {
+            if (_size >= size)
+                return _ptr;
+            release();
+            void* p;
+            if (PINNED)
+                check_cuda(cudaMallocHost(&p, size), "cudaMallocHost");
+            else
+                check_cuda(cudaMalloc(&p, size), "cudaMalloc");
+            _ptr = static_cast<uint8_t*>(p);
+            _size = size;
+            return _ptr;
+        }
+
+    private:
+        void release()
+        {
+            if (_ptr)
+                PINNED ? cudaFreeHost(_ptr) : cudaFree(_ptr);
+            _ptr = nullptr;
+            _size = 0;
+        }
+
+        uint8_t* _ptr = nullptr;
+        size_t _size = 0;
+    };
+
+    typedef reusable_buffer<false> device_buffer;
+    typedef reusable_buffer<true> pinned_buffer;
+
+    // A stream that does not synchronize with the legacy default stream, so users of different streams do not wait on
+    // each other
+    class cuda_stream
+    {
+    public:
+        cuda_stream() { check_cuda(cudaStreamCreateWithFlags(&_stream, cudaStreamNonBlocking), "cudaStreamCreateWithFlags"); }
+        cuda_stream(const cuda_stream&) = delete;
+        cuda_stream& operator=(const cuda_stream&) = delete;
+        ~cuda_stream() { cudaStreamDestroy(_stream); }
+
+        operator cudaStream_t() const { return _stream; }
+
+    private:
+        cudaStream_t _stream;
+    };
+
     template<typename  T>
     std::shared_ptr<T> make_device_copy(T obj)
     {
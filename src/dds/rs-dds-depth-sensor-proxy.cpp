@@ -5,6 +5,7 @@
 #include "rs-dds-option.h"
 
 #include <realdds/topics/dds-topic-names.h>
+#include <realdds/topics/image-msg.h>
 
 #include <src/librealsense-exception.h>
 #include <rsutils/json.h>
@@ -53,4 +54,13 @@ void dds_depth_sensor_proxy::add_frame_metadata( frame * const f, rsutils::json
 }
 
 
+void dds_depth_sensor_proxy::add_frame_metadata( frame * const f,
+                                                 realdds::topics::image_metadata const & dds_md,
+                                                 streaming_impl & streaming )
+{
+    f->additional_data.depth_units = dds_md.depth_units > 0.f ? dds_md.depth_units : get_depth_scale();
+    super::add_frame_metadata( f, dds_md, streaming );
+}
+
+
 }  // namespace librealsense
@@ -19,8 +19,11 @@
 #include <src/stream.h>
 
 #include <src/proc/color-formats-converter.h>
+#include <src/proc/mjpeg-decoder.h>
 
 #include <rsutils/json.h>
+#include <rsutils/string/from.h>
+#include <rsutils/image/depth-codec.h>
 using rsutils::json;
 
 
@@ -41,6 +44,32 @@ dds_sensor_proxy::dds_sensor_proxy( std::string const & sensor_name,
         auto interval = interval_j.get< uint32_t >();  // NOTE: can throw!
         _options_watcher.set_update_interval( std::chrono::milliseconds( interval ) );
     }
+    register_info( RS2_CAMERA_INFO_STREAM_STATS, std::string() );
+}
+
+
+const std::string & dds_sensor_proxy::get_info( rs2_camera_info info ) const
+{
+    if( info != RS2_CAMERA_INFO_STREAM_STATS )
+        return super::get_info( info );
+
+    // E.g.: "Depth: received 300, lost 2, 27.6 MB/s, latency avg 3.1 ms, max 9.4 ms; Color: ..."
+    rsutils::string::from text;
+    char const * separator = "";
+    for( auto & sidx_stream : _streams )
+    {
+        auto & stream = sidx_stream.second;
+        if( ! stream->is_open() )
+            continue;
+        auto const stats = stream->get_statistics();
+        text << separator << stream->name() << ": received " << stats.received << ", lost " << stats.lost << ", "
+             << stats.bytes_per_second() / 1e6 << " MB/s, latency avg " << stats.mean_latency_ms << " ms, max "
+             << stats.max_latency_ms << " ms";
+        separator = "; ";
+    }
+    std::lock_guard< std::mutex > lock( _stats_text_mutex );
+    _stats_text = text;
+    return _stats_text;
 }
 
 
@@ -283,6 +312,12 @@ void dds_sensor_proxy::handle_video_data( realdds::topics::image_msg && dds_fram
     if( ! vid_profile )
         throw invalid_value_exception( "non-video profile provided to on_video_frame" );
 
+    // Compressed images have the format after the stream encoding; the profile is for the raw pixels
+    auto const format_pos = dds_frame.encoding.find( "; " );
+    if( format_pos != std::string::npos
+        && ! decompress( dds_frame, dds_frame.encoding.substr( format_pos + 2 ), streaming ) )
+        return;
+
     auto stride = static_cast< int >( dds_frame.height > 0 ? dds_frame.raw_data.size() / dds_frame.height
                                                            : dds_frame.raw_data.size() );
     auto bpp = dds_frame.width > 0 ? stride / dds_frame.width : stride;
@@ -293,7 +328,15 @@ void dds_sensor_proxy::handle_video_data( realdds::topics::image_msg && dds_fram
     auto new_frame = static_cast< frame * >( new_frame_interface );
     new_frame->data = std::move( dds_frame.raw_data );
 
-    if( _md_enabled )
+    if( dds_frame.metadata )
+    {
+        // The metadata came with the image: nothing to wait for
+        add_frame_metadata( new_frame, *dds_frame.metadata, streaming );
+        invoke_new_frame( new_frame,
+                          nullptr,    // pixels are already inside new_frame->data
+                          nullptr );  // so no deleter is necessary
+    }
+    else if( _md_enabled )
     {
         streaming.syncer.enqueue_frame( dds_frame.timestamp.to_ns(), streaming.syncer.hold( new_frame ) );
     }
@@ -307,6 +350,47 @@ void dds_sensor_proxy::handle_video_data( realdds::topics::image_msg && dds_fram
 }
 
 
+bool dds_sensor_proxy::decompress( realdds::topics::image_msg & dds_frame,
+                                   std::string const & format,
+                                   streaming_impl & streaming ) const
+{
+    std::vector< uint8_t > pixels;
+    try
+    {
+        if( format == rsutils::image::depth_codec::FORMAT )
+        {
+            auto const info
+                = rsutils::image::depth_codec::decode_info( dds_frame.raw_data.data(), dds_frame.raw_data.size() );
+            if( info.width != uint32_t( dds_frame.width ) || info.height != uint32_t( dds_frame.height ) )
+                throw std::runtime_error( "encoded image size does not match" );
+            pixels.resize( size_t( info.step ) * info.height );
+            rsutils::image::depth_codec::decode( dds_frame.raw_data.data(), dds_frame.raw_data.size(), pixels.data() );
+        }
+        else if( format == "jpeg" )
+        {
+            if( ! streaming.jpeg_decoder )
+                streaming.jpeg_decoder = mjpeg_decoder::create();
+            pixels.resize( size_t( dds_frame.width ) * dds_frame.height * 3 );
+            if( ! streaming.jpeg_decoder->decode_rgb8( dds_frame.raw_data.data(),
+                                                       dds_frame.raw_data.size(),
+                                                       pixels.data(),
+                                                       dds_frame.width,
+                                                       dds_frame.height ) )
+                throw std::runtime_error( "failed to decode" );
+        }
+        else
+            throw std::runtime_error( "unknown format" );
+    }
+    catch( std::exception const & e )
+    {
+        LOG_ERROR( "Dropping '" << dds_frame.encoding << "' frame: " << e.what() );
+        return false;
+    }
+    dds_frame.raw_data = std::move( pixels );
+    return true;
+}
+
+
 void dds_sensor_proxy::handle_motion_data( realdds::topics::imu_msg && imu,
                                            const std::shared_ptr< stream_profile_interface > & profile,
                                            streaming_impl & streaming )
@@ -372,6 +456,38 @@ void dds_sensor_proxy::add_no_metadata( frame * const f, streaming_impl & stream
 }
 
 
+void dds_sensor_proxy::set_frame_number( frame * const f, streaming_impl & streaming )
+{
+    f->additional_data.last_frame_number = streaming.last_frame_number.exchange( f->additional_data.frame_number );
+    if( f->additional_data.frame_number != f->additional_data.last_frame_number + 1
+        && f->additional_data.last_frame_number )
+    {
+        LOG_DEBUG( "frame drop? expecting " << f->additional_data.last_frame_number + 1 << "; got "
+                                            << f->additional_data.frame_number );
+    }
+}
+
+
+void dds_sensor_proxy::add_frame_metadata( frame * const f,
+                                           realdds::topics::image_metadata const & dds_md,
+                                           streaming_impl & streaming )
+{
+    // Same as the json metadata, but always with a frame number and domain (it comes from rs-dds-adapter)
+    f->additional_data.frame_number = dds_md.frame_number;
+    set_frame_number( f, streaming );
+    f->additional_data.timestamp_domain = static_cast< rs2_timestamp_domain >( dds_md.timestamp_domain );
+
+    auto & metadata = reinterpret_cast< metadata_array & >( f->additional_data.metadata_blob );
+    f->additional_data.metadata_size = sizeof( metadata );  // what is copied along with the frame
+    for( auto const & kv : dds_md.values )
+    {
+        // Metadata fields that are unknown by librealsense will be ignored
+        if( kv.first < RS2_FRAME_METADATA_COUNT )
+            metadata[kv.first] = { true, kv.second };
+    }
+}
+
+
 void dds_sensor_proxy::add_frame_metadata( frame * const f,
                                            json const & dds_md,
                                            streaming_impl & streaming )
@@ -385,15 +501,7 @@ void dds_sensor_proxy::add_frame_metadata( frame * const f,
     // Note that if we have no metadata, we have no frame-numbers! So we need a way of generating them
     if( md_header.nested( realdds::topics::metadata::header::key::frame_number )
             .get_ex( f->additional_data.frame_number ) )
-    {
-        f->additional_data.last_frame_number = streaming.last_frame_number.exchange( f->additional_data.frame_number );
-        if( f->additional_data.frame_number != f->additional_data.last_frame_number + 1
-            && f->additional_data.last_frame_number )
-        {
-            LOG_DEBUG( "frame drop? expecting " << f->additional_data.last_frame_number + 1 << "; got "
-                                                << f->additional_data.frame_number );
-        }
-    }
+        set_frame_number( f, streaming );
     else
     {
         f->additional_data.last_frame_number = streaming.last_frame_number.fetch_add( 1 );
@@ -411,6 +519,7 @@ void dds_sensor_proxy::add_frame_metadata( frame * const f,
     {
         // Other metadata fields. Metadata fields that are present but unknown by librealsense will be ignored.
         auto & metadata = reinterpret_cast< metadata_array & >( f->additional_data.metadata_blob );
+        f->additional_data.metadata_size = sizeof( metadata );
         for( size_t i = 0; i < static_cast< size_t >( RS2_FRAME_METADATA_COUNT ); ++i )
         {
             auto key = static_cast< rs2_frame_metadata_value >( i );
@@ -23,6 +23,7 @@ class dds_video_stream_profile;
 class dds_motion_stream_profile;
 namespace topics {
 class image_msg;
+struct image_metadata;
 class imu_msg;
 }  // namespace topics
 }  // namespace realdds
@@ -32,6 +33,7 @@ namespace librealsense {
 
 
 class dds_device_proxy;
+class mjpeg_decoder;
 
 
 class dds_sensor_proxy : public software_sensor
@@ -51,6 +53,7 @@ protected:
     {
         syncer_type syncer;
         std::atomic< unsigned long long > last_frame_number{ 0 };
+        std::shared_ptr< mjpeg_decoder > jpeg_decoder;  // Created with the first JPEG-compressed image
     };
 
 private:
@@ -59,6 +62,9 @@ private:
 
     formats_converter _formats_converter;
 
+    mutable std::mutex _stats_text_mutex;
+    mutable std::string _stats_text;  // RS2_CAMERA_INFO_STREAM_STATS, generated on each query
+
 public:
     dds_sensor_proxy( std::string const & sensor_name,
                       software_device * owner,
@@ -84,6 +90,10 @@ public:
 public:
     rsutils::subscription register_options_changed_callback( options_watcher::callback && ) override;
 
+    // info_interface
+public:
+    const std::string & get_info( rs2_camera_info info ) const override;
+
 protected:
     void register_basic_converters();
     stream_profiles init_stream_profiles() override;
@@ -97,6 +107,8 @@ protected:
     void handle_video_data( realdds::topics::image_msg && dds_frame,
                             const std::shared_ptr< stream_profile_interface > &,
                             streaming_impl & streaming );
+    // Replaces a compressed image's data with the pixels; returns false if it cannot be decoded
+    bool decompress( realdds::topics::image_msg & dds_frame, std::string const & format, streaming_impl & ) const;
     void handle_motion_data( realdds::topics::imu_msg &&,
                              const std::shared_ptr< stream_profile_interface > &,
                              streaming_impl & );
@@ -105,6 +117,10 @@ protected:
 
     virtual void add_no_metadata( frame *, streaming_impl & );
     virtual void add_frame_metadata( frame *, rsutils::json const & metadata, streaming_impl & );
+    // Metadata that came inside the image, rather than from the metadata topic
+    virtual void add_frame_metadata( frame *, realdds::topics::image_metadata const & metadata, streaming_impl & );
+    // Update the last frame number from the frame's, which the server provided
+    void set_frame_number( frame *, streaming_impl & );
 
     friend class dds_device_proxy;  // Currently calls handle_new_metadata
 };
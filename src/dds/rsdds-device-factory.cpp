@@ -82,21 +82,51 @@ static std::mutex domain_context_by_id_mutex;
 
 rsdds_device_factory::rsdds_device_factory( std::shared_ptr< context > const & ctx, callback && cb )
     : super( ctx )
+    , _dds_settings( ctx->get_settings().nested( std::string( "dds", 3 ) ) )
+    , _callback( std::move( cb ) )
 {
-    auto dds_settings = ctx->get_settings().nested( std::string( "dds", 3 ) );
-    if( ! dds_settings.exists()
-        || dds_settings.is_object() && dds_settings.nested( std::string( "enabled", 7 ) ).default_value( true ) )
+    // Asked for explicitly: start right away, so conflicting participant settings throw from the context
+    if( _dds_settings.is_object() && _dds_settings.nested( std::string( "enabled", 7 ) ).default_value( true ) )
+        start();
+}
+
+
+void rsdds_device_factory::on_callback_registered()
+{
+    // By default (without settings), we're enabled but only start once someone's watching for devices; nobody asked
+    // for DDS, so failures should not fail the callback registration
+    if( ! _dds_settings.exists() )
     {
-        auto domain_id = dds_settings.nested( std::string( "domain", 6 ) ).default_value< realdds::dds_domain_id >( 0 );
-        auto participant_name_j = dds_settings.nested( std::string( "participant", 11 ) );
-        auto participant_name = participant_name_j.default_value( rsutils::os::executable_name() );
+        try
+        {
+            start();
+        }
+        catch( std::exception const & e )
+        {
+            LOG_ERROR( "Failed to start DDS device discovery: " << e.what() );
+        }
+    }
+}
+
 
-        std::lock_guard< std::mutex > lock( domain_context_by_id_mutex );
+void rsdds_device_factory::start()
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    if( _watcher_singleton )
+        return;
+
+    auto domain_id = _dds_settings.nested( std::string( "domain", 6 ) ).default_value< realdds::dds_domain_id >( 0 );
+    auto participant_name_j = _dds_settings.nested( std::string( "participant", 11 ) );
+    auto participant_name = participant_name_j.default_value( rsutils::os::executable_name() );
+
+    std::shared_ptr< rsdds_watcher_singleton > watcher_singleton;
+    {
+        std::lock_guard< std::mutex > domains_lock( domain_context_by_id_mutex );
         auto & domain = domain_context_by_id[domain_id];
         _participant = domain.participant.instance();
         if( ! _participant->is_valid() )
         {
-            _participant->init( domain_id, participant_name, dds_settings.default_object() );
+            _participant->init( domain_id, participant_name, _dds_settings.default_object() );
         }
         else if( participant_name_j.exists() && participant_name != _participant->name() )
         {
@@ -104,25 +134,26 @@ rsdds_device_factory::rsdds_device_factory( std::shared_ptr< context > const & c
                                       << "A DDS participant '" << _participant->name() << "' already exists in domain "
                                       << domain_id << "; cannot create '" << participant_name << "'" );
         }
-        _watcher_singleton = domain.device_watcher.instance( _participant );
-        _subscription = _watcher_singleton->subscribe(
-            [liveliness = std::weak_ptr< context >( ctx ),
-             cb = std::move( cb )]( std::shared_ptr< realdds::dds_device > const & dev, bool added )
-            {
-                // the factory should be alive as long as the context is alive
-                auto ctx = liveliness.lock();
-                if( ! ctx )
-                    return;
-                std::vector< std::shared_ptr< device_info > > infos_added;
-                std::vector< std::shared_ptr< device_info > > infos_removed;
-                auto dev_info = std::make_shared< dds_device_info >( ctx, dev );
-                if( added )
-                    infos_added.push_back( dev_info );
-                else
-                    infos_removed.push_back( dev_info );
-                cb( infos_removed, infos_added );
-            } );
+        watcher_singleton = domain.device_watcher.instance( _participant );
     }
+    _subscription = watcher_singleton->subscribe(
+        [liveliness = std::weak_ptr< context >( get_context() ),
+         cb = std::move( _callback )]( std::shared_ptr< realdds::dds_device > const & dev, bool added )
+        {
+            // the factory should be alive as long as the context is alive
+            auto ctx = liveliness.lock();
+            if( ! ctx )
+                return;
+            std::vector< std::shared_ptr< device_info > > infos_added;
+            std::vector< std::shared_ptr< device_info > > infos_removed;
+            auto dev_info = std::make_shared< dds_device_info >( ctx, dev );
+            if( added )
+                infos_added.push_back( dev_info );
+            else
+                infos_removed.push_back( dev_info );
+            cb( infos_removed, infos_added );
+        } );
+    _watcher_singleton = watcher_singleton;
 }
 
 
@@ -132,11 +163,16 @@ rsdds_device_factory::~rsdds_device_factory() {}
 std::vector< std::shared_ptr< device_info > > rsdds_device_factory::query_devices( unsigned requested_mask ) const
 {
     std::vector< std::shared_ptr< device_info > > list;
-    if( _watcher_singleton )
+    std::shared_ptr< rsdds_watcher_singleton > watcher_singleton;
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        watcher_singleton = _watcher_singleton;
+    }
+    if( watcher_singleton )
     {
         unsigned const mask = context::combine_device_masks( requested_mask, get_context()->get_device_mask() );
 
-        _watcher_singleton->get_device_watcher()->foreach_device(
+        watcher_singleton->get_device_watcher()->foreach_device(
             [&]( std::shared_ptr< realdds::dds_device > const & dev ) -> bool
             {
                 if( ! dev->is_ready() )
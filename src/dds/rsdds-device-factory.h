@@ -5,6 +5,9 @@
 
 #include <rscore/device-factory.h>
 #include <rsutils/subscription.h>
+#include <rsutils/json.h>
+
+#include <mutex>
 
 
 namespace realdds {
@@ -25,10 +28,18 @@ class rsdds_watcher_singleton;
 //
 // Any devices created here will have a device-info that derives from dds_device_info.
 //
+// Unless the context settings ask for DDS explicitly (with a "dds" object), the participant and device-watcher (and
+// their threads) are only started once a devices-changed callback is registered; until then, no DDS devices are
+// returned.
+//
 class rsdds_device_factory : public device_factory
 {
     typedef device_factory super;
 
+    rsutils::json const _dds_settings;
+    callback _callback;  // until started
+
+    mutable std::mutex _mutex;
     std::shared_ptr< realdds::dds_participant > _participant;
     std::shared_ptr< rsdds_watcher_singleton > _watcher_singleton;
     rsutils::subscription _subscription;
@@ -41,6 +52,11 @@ public:
     // Devices will match both the requested mask and the device-mask from the context settings
     //
     std::vector< std::shared_ptr< device_info > > query_devices( unsigned mask ) const override;
+
+    void on_callback_registered() override;
+
+private:
+    void start();
 };
 
 
@@ -91,7 +91,8 @@ namespace librealsense
                                               rs2_rs400_visual_preset preset, uint16_t device_pid,
                                               const firmware_version& fw_version)
     {
-        auto p = get_all();
+        auto const current = get_all();
+        auto p = current;
         res_type res;
         // configuration is empty before first streaming - so set default res
         if (configuration.empty())
@@ -197,7 +198,7 @@ namespace librealsense
             throw invalid_value_exception( rsutils::string::from()
                                             << "apply_preset(...) failed! Invalid preset! (" << preset << ")" );
         }
-        set_all(p);
+        set_all(p, &current);
     }
 
     void ds_advanced_mode_base::get_depth_control_group(STDepthControlGroup* ptr, int mode) const
@@ -722,9 +723,10 @@ namespace librealsense
             throw wrong_api_call_sequence_exception( rsutils::string::from()
                                                      << "load_json(...) failed! Device is not in Advanced-Mode." );
 
-        auto p = get_all();
+        auto const current = get_all();
+        auto p = current;
         update_structs(_depth_sensor.get_device(),  json_content, p);
-        set_all(p);
+        set_all(p, &current);
         _preset_opt->set(RS2_RS400_VISUAL_PRESET_CUSTOM);
     }
 
@@ -766,30 +768,37 @@ namespace librealsense
         return p;
     }
 
-    void ds_advanced_mode_base::set_all( const preset & p )
+    void ds_advanced_mode_base::set_all( const preset & p, const preset * current )
     {
-        set_all_depth( p );
-        if( should_set_rgb_preset() )
-            set_all_rgb( p );
+        // Dozens of commands: keep the device powered up between them
+        _hw_monitor->invoke_powered( [&]()
+        {
+            set_all_depth( p, current );
+            if( should_set_rgb_preset() )
+                set_all_rgb( p );
+        } );
     }
 
-    void ds_advanced_mode_base::set_all_depth(const preset& p)
+    void ds_advanced_mode_base::set_all_depth( const preset & p, const preset * current )
     {
-        set(p.depth_controls, advanced_mode_traits<STDepthControlGroup>::group);
-        set(p.rsm           , advanced_mode_traits<STRsm>::group);
-        set(p.rsvc          , advanced_mode_traits<STRauSupportVectorControl>::group);
-        set(p.hdad          , advanced_mode_traits<STHdad>::group);
+#define SET_CHANGED( FIELD, T ) set_changed( p.FIELD, current ? &current->FIELD : nullptr, advanced_mode_traits< T >::group )
+        SET_CHANGED( depth_controls, STDepthControlGroup );
+        SET_CHANGED( rsm, STRsm );
+        SET_CHANGED( rsvc, STRauSupportVectorControl );
+        SET_CHANGED( hdad, STHdad );
 
         // Setting auto-white-balance control before colorCorrection parameters
+        settle();
         set_depth_auto_white_balance(p.depth_auto_white_balance);
-        set(p.cc            , advanced_mode_traits<STColorCorrection>::group);
+        SET_CHANGED( cc, STColorCorrection );
 
-        set(p.depth_table   , advanced_mode_traits<STDepthTableControl>::group);
-        set(p.ae            , advanced_mode_traits<STAEControl>::group);
-        set(p.census        , advanced_mode_traits<STCensusRadius>::group);
+        SET_CHANGED( depth_table, STDepthTableControl );
+        SET_CHANGED( ae, STAEControl );
+        SET_CHANGED( census, STCensusRadius );
         if (*_amplitude_factor_support)
-            set(p.amplitude_factor, advanced_mode_traits<STAFactor>::group);
+            SET_CHANGED( amplitude_factor, STAFactor );
 
+        settle();
         set_laser_state(p.laser_state);
         if (p.laser_state.was_set && p.laser_state.laser_state == 1) // 1 - on
             set_laser_power(p.laser_power);
@@ -802,14 +811,16 @@ namespace librealsense
         }
 
         // Depth sensor related even though they have color in the name. Probably color from left IR imager.
-        set( p.color_control, advanced_mode_traits< STColorControl >::group );
-        set( p.rctc         , advanced_mode_traits< STRauColorThresholdsControl >::group );
-        set( p.sctc         , advanced_mode_traits< STSloColorThresholdsControl >::group );
-        set( p.spc          , advanced_mode_traits< STSloPenaltyControl >::group );
+        SET_CHANGED( color_control, STColorControl );
+        SET_CHANGED( rctc, STRauColorThresholdsControl );
+        SET_CHANGED( sctc, STSloColorThresholdsControl );
+        SET_CHANGED( spc, STSloPenaltyControl );
+#undef SET_CHANGED
     }
 
     void ds_advanced_mode_base::set_all_rgb( const preset & p )
     {
+        settle();
         set_color_auto_exposure(p.color_auto_exposure);
         if (p.color_auto_exposure.was_set && p.color_auto_exposure.auto_exposure == 0)
         {
@@ -842,6 +853,7 @@ namespace librealsense
 
     std::vector<uint8_t> ds_advanced_mode_base::send_receive(const std::vector<uint8_t>& input) const
     {
+        settle();
         auto res = _hw_monitor->send(input);
         if (res.empty())
         {
@@ -1829,6 +1829,7 @@ namespace librealsense
         command write_calib(cmd, static_cast<int>(tbl_id), param2);
         write_calib.data = _curr_calibration;
         _hw_monitor->send(write_calib);
+        on_calibration_written();
 
         LOG_DEBUG("Flashing " << ((tbl_id == d400_calibration_table_id::coefficients_table_id) ? "Depth" : "RGB") << " calibration table");
 
@@ -1851,6 +1852,7 @@ namespace librealsense
                 try
                 {
                     _hw_monitor->send(write_calib);
+                    on_calibration_written();
                 }
                 catch(...)
                 {
@@ -1871,6 +1873,7 @@ namespace librealsense
     {
         command cmd(ds::fw_cmd::CAL_RESTORE_DFLT);
         _hw_monitor->send(cmd);
+        on_calibration_written();
     }
 
     void auto_calibrated::get_target_rect_info(rs2_frame_queue* frames, float rect_sides[4], float& fx, float& fy, int progress, rs2_update_progress_callback_sptr progress_callback)
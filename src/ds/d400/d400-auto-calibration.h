@@ -62,6 +62,10 @@ namespace librealsense
             float target_width, float target_height, rs2_update_progress_callback_sptr progress_callback) override;
         void set_hw_monitor_for_auto_calib(std::shared_ptr<hw_monitor> hwm);
 
+    protected:
+        // After a calibration table was written to (or restored on) the device
+        virtual void on_calibration_written() const {}
+
     private:
         std::vector<uint8_t> get_calibration_results(float* const health = nullptr) const;
         std::vector<uint8_t> get_PyRxFL_calibration_results(float* const health = nullptr, float* health_fl = nullptr) const;
@@ -228,6 +228,7 @@ namespace librealsense
         if (_pid != ds::RS457_PID)
         {
             color_ep.register_processing_block(processing_block_factory::create_pbf_vector<yuy2_converter>(RS2_FORMAT_YUYV, map_supported_color_formats(RS2_FORMAT_YUYV), RS2_STREAM_COLOR));
+            color_ep.register_processing_block(processing_block_factory::create_multi_target_pbf<yuy2_multi_converter>(RS2_FORMAT_YUYV, { RS2_FORMAT_RGB8, RS2_FORMAT_Y8 }, RS2_STREAM_COLOR));
             color_ep.register_processing_block(processing_block_factory::create_id_pbf(RS2_FORMAT_RAW16, RS2_STREAM_COLOR));
         }
         else
@@ -241,6 +242,7 @@ namespace librealsense
             else
             {
                 color_ep.register_processing_block(processing_block_factory::create_pbf_vector<yuy2_converter>(RS2_FORMAT_YUYV, map_supported_color_formats(RS2_FORMAT_YUYV), RS2_STREAM_COLOR));
+                color_ep.register_processing_block(processing_block_factory::create_multi_target_pbf<yuy2_multi_converter>(RS2_FORMAT_YUYV, { RS2_FORMAT_RGB8, RS2_FORMAT_Y8 }, RS2_STREAM_COLOR));
             }
         }        
     }
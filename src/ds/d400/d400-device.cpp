@@ -13,6 +13,7 @@
 #include "d400-options.h"
 #include "d400-info.h"
 #include "ds/ds-timestamp.h"
+#include "ds/ds-calib-cache.h"
 #include <src/stream.h>
 #include <src/environment.h>
 #include <src/depth-sensor.h>
@@ -86,7 +87,10 @@ namespace librealsense
 
     std::vector<uint8_t> d400_device::send_receive_raw_data(const std::vector<uint8_t>& input)
     {
-        return _hw_monitor->send(input);
+        auto res = _hw_monitor->send(input);
+        if (is_calibration_write(input))
+            invalidate_cached_calibrations(*this);
+        return res;
     }
     
     std::vector<uint8_t> d400_device::build_command(uint32_t opcode,
@@ -413,20 +417,43 @@ namespace librealsense
 
     std::vector<uint8_t> d400_device::get_d400_raw_calibration_table(ds::d400_calibration_table_id table_id) const
     {
-        command cmd(ds::GETINTCAL, static_cast<int>(table_id));
-        return _hw_monitor->send(cmd);
+        auto fetch = [&]()
+        {
+            command cmd(ds::GETINTCAL, static_cast<int>(table_id));
+            return _hw_monitor->send(cmd);
+        };
+        switch (table_id)
+        {
+        case ds::d400_calibration_table_id::coefficients_table_id:
+            return get_cached_calibration(*this, "depth", fetch);
+        case ds::d400_calibration_table_id::rgb_calibration_id:
+            // With thermal compensation, the FW updates the RGB table as the temperature changes
+            if (_pid != ds::RS455_PID)
+                return get_cached_calibration(*this, "rgb", fetch);
+            // fall through
+        default:
+            return fetch();
+        }
     }
 
     std::vector<uint8_t> d400_device::get_new_calibration_table() const
     {
         if (_fw_version >= firmware_version("5.11.9.5"))
         {
-            command cmd(ds::RECPARAMSGET);
-            return _hw_monitor->send(cmd);
+            return get_cached_calibration(*this, "rectification", [this]()
+            {
+                command cmd(ds::RECPARAMSGET);
+                return _hw_monitor->send(cmd);
+            });
         }
         return {};
     }
 
+    void d400_device::on_calibration_written() const
+    {
+        invalidate_cached_calibrations(*this);
+    }
+
     ds::ds_caps d400_device::parse_device_capabilities( const std::vector<uint8_t> &gvd_buf ) const
     {
         using namespace ds;
@@ -757,14 +784,15 @@ namespace librealsense
                     std::map<float, std::string>{ {0.f, "0"}, { 1.f, "1" }, { 2.f, "2" }, { 3.f, "3" } });
                 depth_sensor.register_option(RS2_OPTION_SEQUENCE_NAME, hdr_id_option);
 
-                option_range hdr_sequence_size_range = { 2.f /*min*/, 2.f /*max*/, 1.f /*step*/, 2.f /*default*/ };
+                option_range hdr_sequence_size_range = { 2.f /*min*/, 4.f /*max*/, 1.f /*step*/, 2.f /*default*/ };
                 auto hdr_sequence_size_option = std::make_shared<hdr_option>(hdr_cfg, RS2_OPTION_SEQUENCE_SIZE, hdr_sequence_size_range,
-                    std::map<float, std::string>{ { 2.f, "2" } });
+                    std::map<float, std::string>{ { 2.f, "2" }, { 3.f, "3" }, { 4.f, "4" } });
                 depth_sensor.register_option(RS2_OPTION_SEQUENCE_SIZE, hdr_sequence_size_option);
 
-                option_range hdr_sequ_id_range = { 0.f /*min*/, 2.f /*max*/, 1.f /*step*/, 0.f /*default*/ };
+                // Sub-presets past the sequence size are rejected by hdr_config
+                option_range hdr_sequ_id_range = { 0.f /*min*/, 4.f /*max*/, 1.f /*step*/, 0.f /*default*/ };
                 auto hdr_sequ_id_option = std::make_shared<hdr_option>(hdr_cfg, RS2_OPTION_SEQUENCE_ID, hdr_sequ_id_range,
-                    std::map<float, std::string>{ {0.f, "UVC"}, { 1.f, "1" }, { 2.f, "2" } });
+                    std::map<float, std::string>{ {0.f, "UVC"}, { 1.f, "1" }, { 2.f, "2" }, { 3.f, "3" }, { 4.f, "4" } });
                 depth_sensor.register_option(RS2_OPTION_SEQUENCE_ID, hdr_sequ_id_option);
 
                 option_range hdr_enable_range = { 0.f /*min*/, 1.f /*max*/, 1.f /*step*/, 0.f /*default*/ };
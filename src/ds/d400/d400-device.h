@@ -72,6 +72,7 @@ namespace librealsense
 
         std::vector<uint8_t> get_d400_raw_calibration_table(ds::d400_calibration_table_id table_id) const;
         std::vector<uint8_t> get_new_calibration_table() const;
+        void on_calibration_written() const override;
 
         bool is_camera_in_advanced_mode() const;
 
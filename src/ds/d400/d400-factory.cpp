@@ -857,6 +857,7 @@ namespace librealsense
                 if (res)
                 {
                     LOG_WARNING("RGB stream extrinsic successfully recovered");
+                    on_calibration_written();
                     _color_calib_table_raw.reset();
                     _color_extrinsic.get()->reset();
                     environment::get_instance().get_extrinsics_graph().register_extrinsics(*_color_stream, *_depth_stream, _color_extrinsic);
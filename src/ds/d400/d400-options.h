@@ -212,6 +212,7 @@ namespace librealsense
             _record_action = record_action;
         }
         virtual bool is_read_only() const override;
+        bool can_set_while_streaming() const override { return false; }
 
     private:
         float _value;
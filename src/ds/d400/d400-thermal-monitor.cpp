@@ -11,10 +11,8 @@ namespace librealsense
 {
     d400_thermal_monitor::d400_thermal_monitor(std::shared_ptr<option> temp_option,
                                              std::shared_ptr<option> tl_toggle) :
-        _monitor([this](dispatcher::cancellable_timer cancellable_timer)
-            {
-                polling(cancellable_timer);
-            }),
+        _wheel(rsutils::concurrency::timer_wheel::shared()),
+        _task(0),
         _poll_intervals_ms(2000), // Temperature check routine to be invoked every 2 sec
         _thermal_threshold_deg(2.f),
         _temp_base(0.f),
@@ -26,84 +24,81 @@ namespace librealsense
 
     d400_thermal_monitor::~d400_thermal_monitor()
     {
-        _monitor.stop();
+        if (_task)
+            _wheel->remove(_task);
         _temp_base = 0.f;
         _hw_loop_on = false;
     }
 
     void d400_thermal_monitor::update(bool on)
     {
-        if (on != _monitor.is_active())
+        std::lock_guard<std::mutex> lock(_task_mutex);
+        if (on != (_task != 0))
         {
             if (!on)
             {
-                _monitor.stop();
+                _wheel->remove(_task);
+                _task = 0;
+                LOG_DEBUG_THERMAL_LOOP("Thermal Compensation is being shut-down");
                 _hw_loop_on = false;
                 notify(0);
             }
             else
             {
-                _monitor.start();
+                _task = _wheel->add([this]() { polling(); }, std::chrono::milliseconds(_poll_intervals_ms));
             }
         }
     }
 
-    void d400_thermal_monitor::polling(dispatcher::cancellable_timer cancellable_timer)
+    void d400_thermal_monitor::polling()
     {
-        if (cancellable_timer.try_sleep( std::chrono::milliseconds( _poll_intervals_ms )))
+        try
         {
-            try
+            // Verify TL is active on FW level
+            if (auto tl_active = _tl_activation.lock())
             {
-                // Verify TL is active on FW level
-                if (auto tl_active = _tl_activation.lock())
+                bool tl_state = (std::fabs(tl_active->query()) > std::numeric_limits< float >::epsilon());
+                if (tl_state != _hw_loop_on)
                 {
-                    bool tl_state = (std::fabs(tl_active->query()) > std::numeric_limits< float >::epsilon());
-                    if (tl_state != _hw_loop_on)
-                    {
-                        _hw_loop_on = tl_state;
-                        if (!_hw_loop_on)
-                            notify(0);
-
-                    }
+                    _hw_loop_on = tl_state;
+                    if (!_hw_loop_on)
+                        notify(0);
 
-                    if (!tl_state)
-                        return;
                 }
 
-                // Track temperature and update on temperature changes
-                auto ts = (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
-                if( auto temp = _temperature_sensor.lock() )
+                if (!tl_state)
+                    return;
+            }
+
+            // Track temperature and update on temperature changes
+            auto ts = (uint64_t)std::chrono::high_resolution_clock::now().time_since_epoch().count();
+            if( auto temp = _temperature_sensor.lock() )
+            {
+                if( temp->is_enabled() )
                 {
-                    if( temp->is_enabled() )
+                    auto cur_temp = temp->query();
+                    if( fabs( _temp_base - cur_temp ) >= _thermal_threshold_deg )
                     {
-                        auto cur_temp = temp->query();
-                        if( fabs( _temp_base - cur_temp ) >= _thermal_threshold_deg )
-                        {
-                            LOG_DEBUG_THERMAL_LOOP( "Thermal calibration adjustment is triggered on change from "
-                                                    << std::dec << std::setprecision( 1 ) << _temp_base << " to "
-                                                    << cur_temp << " deg (C)" );
+                        LOG_DEBUG_THERMAL_LOOP( "Thermal calibration adjustment is triggered on change from "
+                                                << std::dec << std::setprecision( 1 ) << _temp_base << " to "
+                                                << cur_temp << " deg (C)" );
 
-                            notify( cur_temp );
-                        }
+                        notify( cur_temp );
                     }
                 }
-                else
-                {
-                    LOG_ERROR("Thermal Compensation: temperature sensor option is not present");
-                }
-            }
-            catch (const std::exception& ex)
-            {
-                LOG_ERROR("Error during thermal compensation handling: " << ex.what());
             }
-            catch (...)
+            else
             {
-                LOG_ERROR("Unresolved error during Thermal Compensation handling");
+                LOG_ERROR("Thermal Compensation: temperature sensor option is not present");
             }
         }
-        else
+        catch (const std::exception& ex)
+        {
+            LOG_ERROR("Error during thermal compensation handling: " << ex.what());
+        }
+        catch (...)
         {
-            LOG_DEBUG_THERMAL_LOOP("Thermal Compensation is being shut-down");
+            LOG_ERROR("Unresolved error during Thermal Compensation handling");
         }
     }
 
@@ -4,6 +4,7 @@
 
 #include "sensor.h"
 #include "device-calibration.h"
+#include <rsutils/concurrency/timer-wheel.h>
 #include <set>
 
 
@@ -27,11 +28,13 @@ namespace librealsense
         d400_thermal_monitor(const d400_thermal_monitor&) = delete;       // disable copy and assignment ctors
         d400_thermal_monitor& operator=(const d400_thermal_monitor&) = delete;
 
-        // Active Object's main routine
-        void polling(dispatcher::cancellable_timer cancellable_timer);
+        // Run by the timer wheel every _poll_intervals_ms, while on
+        void polling();
         void notify(float  temperature);
 
-        active_object<> _monitor;
+        std::shared_ptr<rsutils::concurrency::timer_wheel> _wheel;
+        std::mutex _task_mutex;
+        rsutils::concurrency::timer_wheel::task_id _task; // 0 when off; guarded by _task_mutex
         unsigned int _poll_intervals_ms;
         float _thermal_threshold_deg;
         float _temp_base;
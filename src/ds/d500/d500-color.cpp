@@ -116,6 +116,10 @@ namespace librealsense
                 RS2_FORMAT_YUYV,
                 map_supported_color_formats( RS2_FORMAT_YUYV ),
                 RS2_STREAM_COLOR ) );
+            color_ep.register_processing_block(
+                processing_block_factory::create_multi_target_pbf< yuy2_multi_converter >( RS2_FORMAT_YUYV,
+                                                                                          { RS2_FORMAT_RGB8, RS2_FORMAT_Y8 },
+                                                                                          RS2_STREAM_COLOR ) );
             break;
         case RS2_FORMAT_M420:
             color_ep.register_processing_block( processing_block_factory::create_pbf_vector< m420_converter >(
@@ -12,6 +12,7 @@
 #include "d500-info.h"
 #include "ds/ds-options.h"
 #include "ds/ds-timestamp.h"
+#include "ds/ds-calib-cache.h"
 #include <src/depth-sensor.h>
 #include "stream.h"
 #include "environment.h"
@@ -75,7 +76,10 @@ namespace librealsense
 
     std::vector<uint8_t> d500_device::send_receive_raw_data(const std::vector<uint8_t>& input)
     {
-        return _hw_monitor->send(input);
+        auto res = _hw_monitor->send(input);
+        if (is_calibration_write(input))
+            invalidate_cached_calibrations(*this);
+        return res;
     }
     
     std::vector<uint8_t> d500_device::build_command(uint32_t opcode,
@@ -278,17 +282,32 @@ namespace librealsense
     std::vector<uint8_t> d500_device::get_d500_raw_calibration_table(ds::d500_calibration_table_id table_id) const // to be d500 adapted
     {
         using namespace ds;
-        command cmd(GET_HKR_CONFIG_TABLE, 
-            static_cast<int>(d500_calib_location::d500_calib_flash_memory),
-            static_cast<int>(table_id),
-            static_cast<int>(d500_calib_type::d500_calib_dynamic));
-        return _hw_monitor->send(cmd);
+        auto fetch = [&]()
+        {
+            command cmd(GET_HKR_CONFIG_TABLE, 
+                static_cast<int>(d500_calib_location::d500_calib_flash_memory),
+                static_cast<int>(table_id),
+                static_cast<int>(d500_calib_type::d500_calib_dynamic));
+            return _hw_monitor->send(cmd);
+        };
+        switch (table_id)
+        {
+        case d500_calibration_table_id::depth_calibration_id:
+            return get_cached_calibration(*this, "depth", fetch);
+        case d500_calibration_table_id::rgb_calibration_id:
+            return get_cached_calibration(*this, "rgb", fetch);
+        default:
+            return fetch();
+        }
     }
 
     std::vector<uint8_t> d500_device::get_new_calibration_table() const // to be d500 adapted
     {
-        command cmd(ds::RECPARAMSGET);
-        return _hw_monitor->send(cmd);
+        return get_cached_calibration(*this, "rectification", [this]()
+        {
+            command cmd(ds::RECPARAMSGET);
+            return _hw_monitor->send(cmd);
+        });
     }
 
     // The GVD structure is currently only partialy parsed
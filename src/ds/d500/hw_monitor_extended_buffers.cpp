@@ -3,6 +3,8 @@
 
 #include "hw_monitor_extended_buffers.h"
 #include <ds/ds-private.h>
+#include <ds/ds-calib-cache.h>
+#include <ds/d500/d500-private.h>
 
 
 namespace librealsense
@@ -33,6 +35,9 @@ namespace librealsense
     // - buffer bigger than 1 KB expected to be sent => iterate the hw_monitor, while iterating over the input
     std::vector<uint8_t> hw_monitor_extended_buffers::send(command const & cmd, hwmon_response* p_response, bool locked_transfer) const
     {
+        if (is_calibration_write_opcode(cmd.cmd))
+            invalidate_tables();
+
         hwm_buffer_type buffer_type = get_buffer_type(cmd);
         switch( buffer_type)
         {
@@ -49,36 +54,73 @@ namespace librealsense
         return std::vector<uint8_t>();
     }
 
-    std::vector<uint8_t> hw_monitor_extended_buffers::extended_receive(command cmd, hwmon_response* p_response, bool locked_transfer) const
+    bool hw_monitor_extended_buffers::is_cacheable(command const & cmd)
+    {
+        // RAM tables are the live copies, which the FW may change by itself
+        return cmd.param1 != static_cast< uint32_t >( ds::d500_calib_location::d500_calib_ram_memory );
+    }
+
+    void hw_monitor_extended_buffers::invalidate_tables() const
     {
-        std::vector< uint8_t > recv_msg;
+        std::lock_guard< std::mutex > lock( _tables_mutex );
+        _tables.clear();
+    }
 
-        // send first command with 0/0 on param4, this should get the first chunk withoud knowing
-        // the actual table size, actual size will be returned as part for the response header and
-        // will be used to calculate the extended loop range
-        auto ans = hw_monitor::send(cmd, p_response, locked_transfer);
-        recv_msg.insert(recv_msg.end(), ans.begin(), ans.end());
+    std::vector<uint8_t> hw_monitor_extended_buffers::extended_receive(command cmd, hwmon_response* p_response, bool locked_transfer) const
+    {
+        table_key const key = { cmd.param1, cmd.param2, cmd.param3 };
+        bool const cacheable = is_cacheable( cmd );
+        if( cacheable )
+        {
+            std::lock_guard< std::mutex > lock( _tables_mutex );
+            auto it = _tables.find( key );
+            if( it != _tables.end() )
+            {
+                if( p_response )
+                    *p_response = hwm_Success;
+                return it->second;
+            }
+        }
 
-        if (recv_msg.size() < sizeof(ds::table_header))
-            throw std::runtime_error(rsutils::string::from() << "Table data has invalid size = " << recv_msg.size());
+        // Powered up once for all the chunks, rather than once per chunk
+        auto recv_msg = invoke_powered( [&]()
+        {
+            std::vector< uint8_t > recv_msg;
 
+            // send first command with 0/0 on param4, this should get the first chunk withoud knowing
+            // the actual table size, actual size will be returned as part for the response header and
+            // will be used to calculate the extended loop range
+            auto ans = hw_monitor::send(cmd, p_response, locked_transfer);
 
-        ds::table_header* th = reinterpret_cast<ds::table_header*>( ans.data() );
-        size_t recv_msg_length = sizeof(ds::table_header) + th->table_size;
+            if (ans.size() < sizeof(ds::table_header))
+                throw std::runtime_error(rsutils::string::from() << "Table data has invalid size = " << ans.size());
 
-        if (recv_msg_length > HW_MONITOR_BUFFER_SIZE)
-        {
-            uint16_t overall_chunks = get_number_of_chunks( recv_msg_length );
+            ds::table_header* th = reinterpret_cast<ds::table_header*>( ans.data() );
+            size_t recv_msg_length = sizeof(ds::table_header) + th->table_size;
+            recv_msg.reserve( std::max( recv_msg_length, ans.size() ) );
+            recv_msg.insert(recv_msg.end(), ans.begin(), ans.end());
 
-            // Since we already have the first chunk we start the loop from index 1
-            for( int i = 1; i < overall_chunks; ++i )
+            if (recv_msg_length > HW_MONITOR_BUFFER_SIZE)
             {
-                // chunk number is in param4
-                cmd.param4 = compute_chunks_param( overall_chunks, i );
+                uint16_t overall_chunks = get_number_of_chunks( recv_msg_length );
 
-                auto ans = hw_monitor::send( cmd, p_response, locked_transfer );
-                recv_msg.insert( recv_msg.end(), ans.begin(), ans.end() );
+                // Since we already have the first chunk we start the loop from index 1
+                for( int i = 1; i < overall_chunks; ++i )
+                {
+                    // chunk number is in param4
+                    cmd.param4 = compute_chunks_param( overall_chunks, i );
+
+                    auto ans = hw_monitor::send( cmd, p_response, locked_transfer );
+                    recv_msg.insert( recv_msg.end(), ans.begin(), ans.end() );
+                }
             }
+            return recv_msg;
+        } );
+
+        if( cacheable && ( ! p_response || *p_response == hwm_Success ) )
+        {
+            std::lock_guard< std::mutex > lock( _tables_mutex );
+            _tables[key] = recv_msg;
         }
         return recv_msg;
     }
@@ -89,16 +131,18 @@ namespace librealsense
         auto table_data = cmd.data;
         uint16_t overall_chunks = get_number_of_chunks(table_data.size());
 
-        std::vector<uint8_t> answer;
-        for (int i = 0; i < overall_chunks; ++i)
+        invoke_powered( [&]()
         {
-            // preparing data to be sent in current chunk
-            cmd.data = std::move(get_data_for_current_iteration(table_data, i));
-            // chunk number is in param4
-            cmd.param4 = compute_chunks_param(overall_chunks, i);
+            for (int i = 0; i < overall_chunks; ++i)
+            {
+                // preparing data to be sent in current chunk
+                cmd.data = get_data_for_current_iteration(table_data, i);
+                // chunk number is in param4
+                cmd.param4 = compute_chunks_param(overall_chunks, i);
 
-            hw_monitor::send(cmd, p_response, locked_transfer);
-        }
+                hw_monitor::send(cmd, p_response, locked_transfer);
+            }
+        } );
     }
 
     std::vector<uint8_t> hw_monitor_extended_buffers::get_data_for_current_iteration(const std::vector<uint8_t>& table_data, int iteration) const
@@ -119,7 +163,11 @@ namespace librealsense
 
         hwm_buffer_type buffer_type = get_buffer_type(cmd);
         if (buffer_type == hwm_buffer_type::standard)
+        {
+            if (is_calibration_write(data))
+                invalidate_tables();
             return hw_monitor::send(data);
+        }
 
         // returning the hwmc answer with 4 bytes for opcode as header
         // this is needed because the hw_monitor::send with command is used, while
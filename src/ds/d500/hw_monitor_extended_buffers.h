@@ -5,12 +5,22 @@
 
 #include "hw-monitor.h"
 
+#include <array>
+#include <map>
+#include <mutex>
+
 namespace librealsense
 {
     // The aim of this class is to permit to send and receive buffers that are bigger than 1KB via the hw monitor mechanism
     // A protocol has been defined using an additional parameter in each message, 
     // that will indicate which chunk of the whole message is currently sent/received 
     // (see following private method compute_chunks_param)
+    //
+    // The monitor takes one command at a time, so the chunks of a table cannot overlap on the wire; instead, all the
+    // chunks of a table go with the device powered up once, and whole tables read from flash or EEPROM are kept
+    // (keyed by location, id and type) until a command that writes calibration is sent through this monitor. The
+    // monitor lives as long as the device, which is re-created after a FW update, so a kept table always matches the
+    // running FW.
     class hw_monitor_extended_buffers : public hw_monitor
     {
     public:
@@ -49,5 +59,12 @@ namespace librealsense
         { return ((overall_chunks - 1) << 16) | iteration; }
 
         std::vector<uint8_t> get_data_for_current_iteration(const std::vector<uint8_t>& table_data, int iteration) const;
+
+        using table_key = std::array< uint32_t, 3 >;  // param1..3: location, table id, type
+        static bool is_cacheable(command const & cmd);
+        void invalidate_tables() const;
+
+        mutable std::mutex _tables_mutex;
+        mutable std::map< table_key, std::vector< uint8_t > > _tables;
     };
 }
@@ -0,0 +1,169 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "ds-calib-cache.h"
+#include <src/device.h>
+#include <src/context.h>
+#include "ds-private.h"
+
+#include <rsutils/os/special-folder.h>
+#include <rsutils/number/crc32.h>
+#include <rsutils/easylogging/easyloggingpp.h>
+#include <rsutils/json.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+
+
+namespace librealsense {
+
+
+namespace {
+
+
+// Every table name get_cached_calibration() is called with, so they can all be invalidated
+char const * const table_names[] = { "depth", "rgb", "rectification", "imu" };
+
+struct entry_header
+{
+    char magic[4];
+    uint32_t size;
+    uint32_t crc32;
+};
+char const MAGIC[4] = { 'R', 'S', 'C', 'C' };
+
+std::mutex cache_mutex;  // between devices of the same process
+
+
+// Where 'dev's table 'name' is cached; empty if it cannot be
+std::string cache_path( device const & dev, char const * name )
+{
+    auto ctx = dev.get_context();
+    if( ! ctx || ! ctx->get_settings().nested( std::string( "calibration-cache", 17 ) ).default_value( false ) )
+        return {};
+    if( ! dev.supports_info( RS2_CAMERA_INFO_SERIAL_NUMBER ) || ! dev.supports_info( RS2_CAMERA_INFO_FIRMWARE_VERSION ) )
+        return {};  // not known yet
+
+    std::string path;
+    try
+    {
+        path = rsutils::os::get_special_folder( rsutils::os::special_folder::app_data );
+    }
+    catch( std::exception const & e )
+    {
+        LOG_DEBUG( "no calibration cache: " << e.what() );
+        return {};
+    }
+    return path + "realsense-calib-" + dev.get_info( RS2_CAMERA_INFO_SERIAL_NUMBER ) + "-"
+         + dev.get_info( RS2_CAMERA_INFO_FIRMWARE_VERSION ) + "-" + name + ".bin";
+}
+
+
+bool read_entry( std::string const & path, std::vector< uint8_t > & table )
+{
+    std::ifstream f( path, std::ios::binary );
+    entry_header h;
+    if( ! f.read( reinterpret_cast< char * >( &h ), sizeof( h ) ) || std::memcmp( h.magic, MAGIC, sizeof( MAGIC ) ) )
+        return false;
+    table.resize( h.size );
+    if( ! f.read( reinterpret_cast< char * >( table.data() ), h.size ) )
+        return false;
+    // A partial or corrupt file is as good as a missing one
+    return rsutils::number::calc_crc32( table.data(), table.size() ) == h.crc32;
+}
+
+
+void write_entry( std::string const & path, std::vector< uint8_t > const & table )
+{
+    // Written aside and renamed into place, so other processes never read half a table
+    auto const tmp = path + ".tmp";
+    {
+        std::ofstream f( tmp, std::ios::binary | std::ios::trunc );
+        entry_header h;
+        std::memcpy( h.magic, MAGIC, sizeof( MAGIC ) );
+        h.size = uint32_t( table.size() );
+        h.crc32 = rsutils::number::calc_crc32( table.data(), table.size() );
+        f.write( reinterpret_cast< char const * >( &h ), sizeof( h ) );
+        f.write( reinterpret_cast< char const * >( table.data() ), table.size() );
+        if( ! f )
+        {
+            LOG_DEBUG( "failed to write calibration cache " << tmp );
+            return;
+        }
+    }
+    std::remove( path.c_str() );  // rename() does not replace on Windows
+    if( std::rename( tmp.c_str(), path.c_str() ) )
+        std::remove( tmp.c_str() );
+}
+
+
+}  // namespace
+
+
+std::vector< uint8_t > get_cached_calibration( device const & dev,
+                                               char const * name,
+                                               std::function< std::vector< uint8_t >() > const & fetch )
+{
+    auto const path = cache_path( dev, name );
+    if( path.empty() )
+        return fetch();
+
+    std::vector< uint8_t > table;
+    {
+        std::lock_guard< std::mutex > lock( cache_mutex );
+        if( read_entry( path, table ) )
+            return table;
+    }
+
+    table = fetch();
+    if( ! table.empty() )
+    {
+        std::lock_guard< std::mutex > lock( cache_mutex );
+        write_entry( path, table );
+    }
+    return table;
+}
+
+
+void invalidate_cached_calibrations( device const & dev )
+{
+    std::lock_guard< std::mutex > lock( cache_mutex );
+    for( auto name : table_names )
+    {
+        auto const path = cache_path( dev, name );
+        if( ! path.empty() )
+            std::remove( path.c_str() );
+    }
+}
+
+
+bool is_calibration_write( std::vector< uint8_t > const & command )
+{
+    // As laid out by hw_monitor::fill_usb_buffer(): size, magic, then the opcode
+    if( command.size() < 8 )
+        return false;
+    uint32_t opcode;
+    std::memcpy( &opcode, command.data() + 4, sizeof( opcode ) );
+    return is_calibration_write_opcode( opcode );
+}
+
+
+bool is_calibration_write_opcode( uint32_t opcode )
+{
+    switch( opcode )
+    {
+    case ds::SETINTCAL:
+    case ds::SETINTCALNEW:
+    case ds::CALIBRECALC:
+    case ds::CAL_RESTORE_DFLT:
+    case ds::SET_HKR_CONFIG_TABLE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+
+}  // namespace librealsense
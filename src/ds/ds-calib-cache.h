@@ -0,0 +1,39 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+
+namespace librealsense {
+
+
+class device;
+
+
+// Calibration tables are stored on disk per device, so that reconnecting to it does not read them over USB again.
+// Off unless the "calibration-cache" context setting is true.
+//
+// Entries are keyed by serial number and firmware version. A device whose calibration changes without a FW update
+// must call invalidate_cached_calibrations() after the change. Tables written by other processes are not seen.
+
+
+// Returns table 'name' of 'dev' from the cache; if it is not there (or the cache is off), fetch() it and store it
+std::vector< uint8_t > get_cached_calibration( device const & dev,
+                                               char const * name,
+                                               std::function< std::vector< uint8_t >() > const & fetch );
+
+// Drops all the tables cached for 'dev', after any of its calibration was written
+void invalidate_cached_calibrations( device const & dev );
+
+// True if the raw HW-monitor command (e.g., from send_receive_raw_data()) writes or resets calibration
+bool is_calibration_write( std::vector< uint8_t > const & command );
+
+// Same, from the opcode of a command
+bool is_calibration_write_opcode( uint32_t opcode );
+
+
+}  // namespace librealsense
@@ -3,6 +3,7 @@
 
 #include "ds-calib-parsers.h"
 #include "ds-private.h"
+#include "ds-calib-cache.h"
 
 #include "ds/d400/d400-private.h"
 
@@ -10,10 +11,12 @@ namespace librealsense
 {
     using namespace ds;
 
-    mm_calib_handler::mm_calib_handler(std::shared_ptr<hw_monitor> hw_monitor, uint16_t pid) :
-        _hw_monitor(hw_monitor), _pid(pid)
+    mm_calib_handler::mm_calib_handler(std::shared_ptr<hw_monitor> hw_monitor, uint16_t pid, const device* owner) :
+        _hw_monitor(hw_monitor), _pid(pid), _owner(owner)
     {
         _imu_eeprom_raw = [this]() {
+            if (_owner)
+                return get_cached_calibration(*_owner, "imu", [this]() { return get_imu_eeprom_raw(); });
             return get_imu_eeprom_raw();
         };
 
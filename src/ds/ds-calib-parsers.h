@@ -21,7 +21,8 @@ namespace librealsense
     class mm_calib_handler
     {
     public:
-        mm_calib_handler(std::shared_ptr<hw_monitor> hw_monitor, uint16_t pid);
+        // With an 'owner', the IMU table is cached with its other calibration tables (see get_cached_calibration())
+        mm_calib_handler(std::shared_ptr<hw_monitor> hw_monitor, uint16_t pid, const device* owner = nullptr);
         ~mm_calib_handler() {}
 
         ds::imu_intrinsic get_intrinsic(rs2_stream);
@@ -35,6 +36,7 @@ namespace librealsense
         std::vector<uint8_t>            get_imu_eeprom_raw() const;
         rsutils::lazy< std::vector< uint8_t > > _fisheye_calibration_table_raw;
         uint16_t _pid;
+        const device* _owner;
     };
 
     class tm1_imu_calib_parser : public mm_calib_parser
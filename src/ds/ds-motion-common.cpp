@@ -24,6 +24,7 @@
 #include <src/stream.h>
 #include <src/fourcc.h>
 #include <src/metadata-parser.h>
+#include <src/motion-sample-ring.h>
 
 #include <cstddef>
 
@@ -132,6 +133,8 @@ namespace librealsense
                                         device * owner )
         : synthetic_sensor( name, sensor, owner )
         , _owner( owner )
+        , _accel_samples( std::make_shared< motion_sample_ring >() )
+        , _gyro_samples( std::make_shared< motion_sample_ring >() )
     {
     }
 
@@ -142,9 +145,29 @@ namespace librealsense
                                         const std::map< uint32_t, rs2_stream > & motion_fourcc_to_rs2_stream )
         : synthetic_sensor( name, sensor, owner, motion_fourcc_to_rs2_format, motion_fourcc_to_rs2_stream )
         , _owner( owner )
+        , _accel_samples( std::make_shared< motion_sample_ring >() )
+        , _gyro_samples( std::make_shared< motion_sample_ring >() )
     {
     }
 
+    std::shared_ptr< motion_sample_ring > ds_motion_sensor::get_sample_ring( rs2_stream stream ) const
+    {
+        switch( stream )
+        {
+        case RS2_STREAM_ACCEL: return _accel_samples;
+        case RS2_STREAM_GYRO: return _gyro_samples;
+        default: return nullptr;
+        }
+    }
+
+    size_t ds_motion_sensor::get_motion_samples( rs2_stream stream, double from, double to, rs2_motion_sample * samples, size_t max ) const
+    {
+        auto ring = get_sample_ring( stream );
+        if( ! ring )
+            throw invalid_value_exception( "no motion samples are kept for stream " + std::string( get_string( stream ) ) );
+        return ring->copy( from, to, samples, max );
+    }
+
     rs2_motion_device_intrinsic ds_motion_sensor::get_motion_intrinsics(rs2_stream stream) const
     {
         if (auto dev = dynamic_cast<const d400_motion*>(_owner))
@@ -219,6 +242,9 @@ namespace librealsense
             librealsense::ds::FISHEYE_EXPOSURE, "Exposure time of Fisheye camera");
 
         auto ae_state = std::make_shared<auto_exposure_state>();
+        if (auto context = _owner->get_context())
+            ae_state->set_auto_exposure_sample_rate(
+                context->get_settings().nested(std::string("auto-exposure-sample-rate", 25)).default_value(1u));
         auto auto_exposure = std::make_shared<auto_exposure_mechanism>(*gain_option, *exposure_option, *ae_state);
 
         auto auto_exposure_option = std::make_shared<enable_auto_exposure_option>(ep,
@@ -287,7 +313,7 @@ namespace librealsense
                                  { unsigned(odr::IMU_FPS_400),  hid_fps_translation.at(odr::IMU_FPS_400)}}} };
 
         // motion correction
-        _mm_calib = std::make_shared<mm_calib_handler>(_hw_monitor, _owner->get_pid());
+        _mm_calib = std::make_shared<mm_calib_handler>(_hw_monitor, _owner->get_pid(), _owner);
     }
 
     rs2_motion_device_intrinsic ds_motion_common::get_motion_intrinsics(rs2_stream stream) const
@@ -511,8 +537,11 @@ namespace librealsense
         hid_ep->register_processing_block(
             { {RS2_FORMAT_MOTION_XYZ32F, RS2_STREAM_ACCEL} },
             { {RS2_FORMAT_MOTION_XYZ32F, RS2_STREAM_ACCEL} },
-            [&, mm_correct_opt, high_accuracy]()
-            { return std::make_shared< acceleration_transform >( _mm_calib, mm_correct_opt, high_accuracy );
+            [&, mm_correct_opt, high_accuracy, ring = hid_ep->get_sample_ring( RS2_STREAM_ACCEL )]()
+            {
+                auto block = std::make_shared< acceleration_transform >( _mm_calib, mm_correct_opt, high_accuracy );
+                block->set_sample_ring( ring );
+                return block;
             });
 
         //TODO this FW version is relevant for d400 devices. Need to change for propre d500 devices support.
@@ -521,10 +550,35 @@ namespace librealsense
         hid_ep->register_processing_block(
             { {RS2_FORMAT_MOTION_XYZ32F, RS2_STREAM_GYRO} },
             { {RS2_FORMAT_MOTION_XYZ32F, RS2_STREAM_GYRO} },
-                                           [&, mm_correct_opt, gyro_scale_factor]() {
-                                               return std::make_shared< gyroscope_transform >( _mm_calib, mm_correct_opt, gyro_scale_factor );
+            [&, mm_correct_opt, gyro_scale_factor, ring = hid_ep->get_sample_ring( RS2_STREAM_GYRO )]()
+            {
+                auto block = std::make_shared< gyroscope_transform >( _mm_calib, mm_correct_opt, gyro_scale_factor );
+                block->set_sample_ring( ring );
+                return block;
             });
 
+        // Opt-in: the same samples, several per frame
+        auto batch_size = std::make_shared< motion_batch_size_option >();
+        hid_ep->register_option( RS2_OPTION_MOTION_BATCH_SIZE, batch_size );
+        hid_ep->register_processing_block(
+            { {RS2_FORMAT_MOTION_XYZ32F, RS2_STREAM_ACCEL} },
+            { {RS2_FORMAT_MOTION_BATCH, RS2_STREAM_ACCEL} },
+            [&, mm_correct_opt, high_accuracy, batch_size, ring = hid_ep->get_sample_ring( RS2_STREAM_ACCEL )]()
+            {
+                auto block = motion_batch_transform::accel( _mm_calib, mm_correct_opt, high_accuracy, batch_size );
+                block->set_sample_ring( ring );
+                return block;
+            } );
+        hid_ep->register_processing_block(
+            { {RS2_FORMAT_MOTION_XYZ32F, RS2_STREAM_GYRO} },
+            { {RS2_FORMAT_MOTION_BATCH, RS2_STREAM_GYRO} },
+            [&, mm_correct_opt, gyro_scale_factor, batch_size, ring = hid_ep->get_sample_ring( RS2_STREAM_GYRO )]()
+            {
+                auto block = motion_batch_transform::gyro( _mm_calib, mm_correct_opt, gyro_scale_factor, batch_size );
+                block->set_sample_ring( ring );
+                return block;
+            } );
+
         return hid_ep;
     }
 
@@ -533,7 +587,7 @@ namespace librealsense
         if (!is_infos_empty)
         {
             // motion correction
-            _mm_calib = std::make_shared< mm_calib_handler >( _hw_monitor, _owner->get_pid() );
+            _mm_calib = std::make_shared< mm_calib_handler >( _hw_monitor, _owner->get_pid(), _owner );
 
             _accel_intrinsic = std::make_shared< rsutils::lazy< ds::imu_intrinsic > >(
                 [this]() { return _mm_calib->get_intrinsic( RS2_STREAM_ACCEL ); } );
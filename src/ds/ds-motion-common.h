@@ -78,6 +78,8 @@ namespace librealsense
         device* _owner;
     };
 
+    class motion_sample_ring;
+
     class ds_motion_sensor : public synthetic_sensor,
                           public motion_sensor
     {
@@ -96,11 +98,17 @@ namespace librealsense
 
         stream_profiles init_stream_profiles() override;
 
+        size_t get_motion_samples( rs2_stream, double from, double to, rs2_motion_sample *, size_t max ) const override;
+        // Where the stream's processing blocks record their samples
+        std::shared_ptr< motion_sample_ring > get_sample_ring( rs2_stream ) const;
+
     private:
         std::shared_ptr<stream_interface> get_accel_stream() const;
         std::shared_ptr<stream_interface> get_gyro_stream() const;
 
         const device* _owner;
+        std::shared_ptr< motion_sample_ring > _accel_samples;
+        std::shared_ptr< motion_sample_ring > _gyro_samples;
     };
 
     class global_time_option;
@@ -205,6 +205,7 @@ namespace librealsense
         virtual option_range get_range() const override;
         virtual bool is_enabled() const override { return true; }
         virtual bool is_read_only() const override;
+        bool can_set_while_streaming() const override { return _ver == 1; }
         const char* get_description() const override;
 
         void enable_recording(std::function<void(const option &)> record_action) override
@@ -232,6 +233,7 @@ namespace librealsense
         {
             return "Emitter On/Off Mode: 0:disabled(default), 1:enabled(emitter toggles between on and off). Can only be set before streaming";
         }
+        bool can_set_while_streaming() const override { return false; }
         virtual void enable_recording(std::function<void(const option &)> record_action) override {_record_action = record_action;}
 
     private:
@@ -67,6 +67,7 @@ namespace librealsense
 
         _extrinsics[from_idx][to_idx] = extr;
         _extrinsics[to_idx][from_idx] = std::shared_ptr< rsutils::lazy< rs2_extrinsics > >( nullptr );
+        invalidate_cache();
     }
 
     void extrinsics_graph::register_extrinsics(const stream_interface & from, const stream_interface & to, rs2_extrinsics extr)
@@ -101,6 +102,7 @@ namespace librealsense
 
         auto & lazy_extr = *sp;
         lazy_extr = [=]() { return extr; };
+        invalidate_cache();
     }
 
     void extrinsics_graph::cleanup_extrinsics()
@@ -132,6 +134,8 @@ namespace librealsense
             }
         }
 
+        if (!invalid_ids.empty())
+            invalidate_cache();
         if (!invalid_ids.empty())
             LOG_INFO("Found " << invalid_ids.size() << " unreachable streams, " << std::dec << counter << " extrinsics deleted");
     }
@@ -153,8 +157,40 @@ namespace librealsense
 
     }
 
+    void extrinsics_graph::invalidate_cache()
+    {
+        std::atomic_store( &_cache, std::shared_ptr< const extrinsics_cache >() );
+    }
+
+    bool extrinsics_graph::try_fetch_cached( const stream_interface & from, const stream_interface & to, rs2_extrinsics * extr ) const
+    {
+        auto cache = std::atomic_load( &_cache );
+        if( ! cache )
+            return false;
+        auto it = cache->find( { &from, &to } );
+        if( it == cache->end() )
+            return false;
+        auto const & entry = it->second;
+        // Profiles can die and others be created at the same address, and edges can be let go of by their devices
+        if( entry.from.lock().get() != &from || entry.to.lock().get() != &to )
+            return false;
+        for( auto const & edge : entry.path )
+            if( edge.expired() )
+                return false;
+        *extr = entry.extr;
+        return true;
+    }
+
     bool extrinsics_graph::try_fetch_extrinsics(const stream_interface& from, const stream_interface& to, rs2_extrinsics* extr)
     {
+        if (&from == &to)
+        {
+            *extr = identity_matrix();
+            return true;
+        }
+        if (try_fetch_cached(from, to, extr))
+            return true;
+
         std::lock_guard<std::mutex> lock(_mutex);
         cleanup_extrinsics();
         auto from_idx = find_stream_profile(from);
@@ -167,10 +203,23 @@ namespace librealsense
         }
 
         std::set<int> visited;
-        return try_fetch_extrinsics(from_idx, to_idx, visited, extr);
+        std::vector<edge_ptr> path;
+        if (!try_fetch_extrinsics(from_idx, to_idx, visited, extr, path))
+            return false;
+
+        // Add to a copy of the snapshot: readers may be using the current one
+        auto cache = std::atomic_load(&_cache);
+        auto updated = cache ? std::make_shared<extrinsics_cache>(*cache) : std::make_shared<extrinsics_cache>();
+        auto& entry = (*updated)[{ &from, &to }];
+        entry.from = from.shared_from_this();
+        entry.to = to.shared_from_this();
+        entry.path.assign(path.begin(), path.end());
+        entry.extr = *extr;
+        std::atomic_store(&_cache, std::shared_ptr<const extrinsics_cache>(std::move(updated)));
+        return true;
     }
 
-    bool extrinsics_graph::try_fetch_extrinsics(int from, int to, std::set<int>& visited, rs2_extrinsics* extr)
+    bool extrinsics_graph::try_fetch_extrinsics(int from, int to, std::set<int>& visited, rs2_extrinsics* extr, std::vector<edge_ptr>& path)
     {
         if (visited.count(from)) return false;
 
@@ -188,6 +237,7 @@ namespace librealsense
                 else
                     *extr = inverse(back_edge->operator*());
 
+                path.push_back(fwd_edge.get() ? fwd_edge : back_edge);
                 return true;
             }
             else
@@ -203,7 +253,7 @@ namespace librealsense
                     fwd_edge = fetch_edge(from, new_from);
 
                     if ((back_edge.get() || fwd_edge.get()) &&
-                        try_fetch_extrinsics(new_from, to, visited, extr))
+                        try_fetch_extrinsics(new_from, to, visited, extr, path))
                     {
                         const auto local = [&]() {
                             if (fwd_edge.get())
@@ -214,6 +264,7 @@ namespace librealsense
 
                         auto pose = to_pose(*extr) * to_pose(local);
                         *extr = from_pose(pose);
+                        path.push_back(fwd_edge.get() ? fwd_edge : back_edge);
                         return true;
                     }
                 }
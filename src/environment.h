@@ -10,6 +10,8 @@
 #include <map>
 #include <vector>
 #include <atomic>
+#include <unordered_map>
+#include <utility>
 
 
 namespace librealsense
@@ -41,6 +43,10 @@ namespace librealsense
     * 
     * 
     *        The search in the graph is implemented as DFS, and it is implemented in the try_fetch_extrinsics method
+    *
+    *        Its results are cached, per pair of profiles, in an immutable snapshot that readers look up without taking
+    *        the graph's mutex. Anything that changes the graph starts a new, empty snapshot; an entry is also only used
+    *        while its profiles and every edge on its path are still alive.
     */
     class extrinsics_graph
     {
@@ -84,13 +90,38 @@ namespace librealsense
         std::map<int, std::weak_ptr<const stream_interface>> _streams;
 
     private:
+        typedef std::shared_ptr< rsutils::lazy< rs2_extrinsics > > edge_ptr;
+
+        struct cached_extrinsics
+        {
+            std::weak_ptr< const stream_interface > from, to;
+            std::vector< std::weak_ptr< rsutils::lazy< rs2_extrinsics > > > path;
+            rs2_extrinsics extr;
+        };
+        struct profile_pair_hash
+        {
+            size_t operator()( std::pair< const stream_interface *, const stream_interface * > const & p ) const
+            {
+                return std::hash< const void * >()( p.first ) * 31 + std::hash< const void * >()( p.second );
+            }
+        };
+        typedef std::unordered_map< std::pair< const stream_interface *, const stream_interface * >,
+                                    cached_extrinsics,
+                                    profile_pair_hash >
+            extrinsics_cache;
+
+        bool try_fetch_cached( const stream_interface & from, const stream_interface & to, rs2_extrinsics * extr ) const;
+        void invalidate_cache();
+
+        std::shared_ptr< const extrinsics_cache > _cache;  // accessed with std::atomic_load/store only
+
         std::mutex _mutex;
         std::shared_ptr< rsutils::lazy< rs2_extrinsics > > _id;
         // Required by current implementation to hold the reference instead of the device for certain types. TODO
         std::vector< std::shared_ptr< rsutils::lazy< rs2_extrinsics > > > _external_extrinsics;
 
         std::shared_ptr< rsutils::lazy< rs2_extrinsics > > fetch_edge( int from, int to );
-        bool try_fetch_extrinsics(int from, int to, std::set<int>& visited, rs2_extrinsics* extr);
+        bool try_fetch_extrinsics(int from, int to, std::set<int>& visited, rs2_extrinsics* extr, std::vector<edge_ptr>& path);
         void cleanup_extrinsics();
         int find_stream_profile(const stream_interface& p, bool add_if_not_there = true);
 
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "archive.h"
+#include "frame-buffer-pool.h"
+#include "frame-memory-budget.h"
 #include <src/core/frame-interface.h>
 
 #include <atomic>
@@ -18,54 +20,64 @@ namespace librealsense
     {
         std::atomic<uint32_t>* max_frame_queue_size;
         std::atomic<uint32_t> published_frames_count;
-        small_heap<T, RS2_USER_QUEUE_SIZE> published_frames;
+        lock_free_heap<T, RS2_USER_QUEUE_SIZE> published_frames;
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
         callbacks_heap callback_inflight;
 
-        std::vector<T> freelist; // return frames here
+        frame_buffer_pool<T> freelist; // return frames here
         std::atomic<bool> recycle_frames;
         int pending_frames = 0;
         std::recursive_mutex mutex;
 
+        rs2_frame_allocator_sptr _allocator;
+
+        frame_memory_budget::priority _priority;
+        int _reclaimer_id;
+
         std::weak_ptr<sensor_interface> _sensor;
         std::shared_ptr<sensor_interface> get_sensor() const override { return _sensor.lock(); }
         void set_sensor( const std::weak_ptr< sensor_interface > & s ) override { _sensor = s; }
 
-        T alloc_frame(const size_t size, frame_additional_data && additional_data, bool requires_memory)
+        T alloc_frame(const size_t size, frame_additional_data && additional_data, bool requires_memory, bool zero_fill)
         {
             T backbuffer;
-            //const size_t size = modes[stream].get_image_size(stream);
+            if (requires_memory && ! allocate_with_user_allocator(size, backbuffer))
             {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-
-                if (requires_memory)
+                // Attempt to obtain a buffer of the appropriate size from the freelist
+                if (! freelist.get(size, backbuffer))
                 {
-                    // Attempt to obtain a buffer of the appropriate size from the freelist
-                    for (auto it = begin(freelist); it != end(freelist); ++it)
-                    {
-                        if (it->data.size() == size)
-                        {
-                            backbuffer = std::move(*it);
-                            freelist.erase(it);
-                            break;
-                        }
-                    }
-                }
-
-                // Discard buffers that have been in the freelist for longer than 1s
-                for (auto it = begin(freelist); it != end(freelist);)
-                {
-                    if (additional_data.timestamp > it->additional_data.timestamp + 1000) it = freelist.erase(it);
-                    else ++it;
+                    if (zero_fill)
+                        backbuffer.data.resize(size, 0);
+                    else
+                        backbuffer.set_allocated_data(new uint8_t[size], size, nullptr);  // no value-initialization
                 }
             }
+            backbuffer.additional_data = std::move( additional_data );
+            return backbuffer;
+        }
+
+        bool allocate_with_user_allocator(const size_t size, T& f)
+        {
+            auto allocator = std::atomic_load(&_allocator);
+            if (! allocator)
+                return false;
 
-            if (requires_memory)
+            void * buffer = nullptr;
+            try
             {
-                backbuffer.data.resize(size, 0); // TODO: Allow users to provide a custom allocator for frame buffers
+                buffer = allocator->allocate(size);
             }
-            backbuffer.additional_data = std::move( additional_data );
-            return backbuffer;
+            catch (...)
+            {
+                LOG_ERROR("Received an exception from frame allocation callback!");
+            }
+            if (! buffer)
+            {
+                LOG_DEBUG("Frame allocation callback did not provide a buffer; using default allocation");
+                return false;
+            }
+            f.set_allocated_data(static_cast<uint8_t *>(buffer), size, std::move(allocator));
+            return true;
         }
 
         frame_interface* track_frame(T& f)
@@ -92,9 +104,15 @@ namespace librealsense
 
                 fi->keep();
 
+                if (f->budgeted_size)
+                {
+                    frame_memory_budget::instance().release(f->budgeted_size);
+                    f->budgeted_size = 0;
+                }
+
                 if (recycle_frames)
                 {
-                    freelist.push_back(std::move(*f));
+                    freelist.put(std::move(*f));
                 }
                 lock.unlock();
 
@@ -122,12 +140,13 @@ namespace librealsense
                 LOG_DEBUG("User didn't release frame resource.");
                 return nullptr;
             }
-            auto new_frame = (max_frames ? published_frames.allocate() : new T());
+            // Even with no limit (max_frames==0, e.g. software sensors) the wrappers come from the fixed heap while it
+            // has room, rather than a new/delete per frame
+            auto new_frame = published_frames.allocate();
 
             if (new_frame)
             {
-                if (max_frames)
-                    new_frame->mark_fixed();
+                new_frame->mark_fixed();
             }
             else
             {
@@ -142,16 +161,27 @@ namespace librealsense
 
         std::shared_ptr<metadata_parser_map> get_md_parsers() const override { return _metadata_parsers; };
 
+        void set_frame_allocator(rs2_frame_allocator_sptr allocator) override
+        {
+            std::atomic_store(&_allocator, std::move(allocator));
+        }
+
         friend class frame;
 
     public:
         explicit frame_archive( std::atomic< uint32_t > * in_max_frame_queue_size,
-                                std::shared_ptr< metadata_parser_map > const & parsers )
+                                std::shared_ptr< metadata_parser_map > const & parsers,
+                                frame_memory_budget::priority priority = frame_memory_budget::priority::normal )
             : max_frame_queue_size( in_max_frame_queue_size )
             , recycle_frames( true )
             , _metadata_parsers( parsers )
+            , _priority( priority )
         {
             published_frames_count = 0;
+
+            auto & budget = frame_memory_budget::instance();
+            freelist.set_observer( [&budget]( std::ptrdiff_t bytes ) { budget.add_pooled( bytes ); } );
+            _reclaimer_id = budget.register_reclaimer( [this]() { freelist.clear(); } );
         }
 
         callback_invocation_holder begin_callback() override
@@ -164,10 +194,28 @@ namespace librealsense
             ref->release();
         }
 
-        frame_interface* alloc_and_track(const size_t size, frame_additional_data && additional_data, bool requires_memory) override
+        frame_interface* alloc_and_track(const size_t size, frame_additional_data && additional_data, bool requires_memory, bool zero_fill) override
         {
-            auto frame = alloc_frame( size, std::move( additional_data ), requires_memory );
-            return track_frame(frame);
+            auto & budget = frame_memory_budget::instance();
+            if( requires_memory && size )
+            {
+                if( ! budget.acquire( size, _priority ) )
+                {
+                    LOG_DEBUG( "Frame memory budget exhausted; dropping a frame of " << size << " bytes" );
+                    return nullptr;
+                }
+            }
+
+            auto frame = alloc_frame( size, std::move( additional_data ), requires_memory, zero_fill );
+            if( requires_memory )
+                frame.budgeted_size = size;
+            auto published = track_frame(frame);
+            if( ! published && frame.budgeted_size )
+            {
+                budget.release( frame.budgeted_size );
+                frame.budgeted_size = 0;
+            }
+            return published;
         }
 
         void flush() override
@@ -201,6 +249,11 @@ namespace librealsense
 
         ~frame_archive()
         {
+            auto & budget = frame_memory_budget::instance();
+            budget.unregister_reclaimer( _reclaimer_id );
+            freelist.clear();
+            freelist.set_observer( nullptr );
+
             if (pending_frames > 0)
             {
                 LOG_DEBUG("All frames from stream 0x"
@@ -0,0 +1,129 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "frame-batch.h"
+#include "archive.h"
+#include "core/video-frame.h"
+#include "core/stream-profile-interface.h"
+#include "librealsense-exception.h"
+
+#include <rsutils/string/from.h>
+
+#include <cstring>
+
+
+namespace librealsense {
+
+
+// How many channels a pixel of the format has, and of how many bytes each; false if they are not all alike
+static bool get_channels( rs2_format format, int & channels, size_t & channel_size )
+{
+    switch( format )
+    {
+    case RS2_FORMAT_Y8:
+    case RS2_FORMAT_RAW8:
+        channels = 1, channel_size = 1;
+        return true;
+    case RS2_FORMAT_Z16:
+    case RS2_FORMAT_Y16:
+    case RS2_FORMAT_RAW16:
+    case RS2_FORMAT_DISPARITY16:
+        channels = 1, channel_size = 2;
+        return true;
+    case RS2_FORMAT_DISPARITY32:
+    case RS2_FORMAT_DISTANCE:
+        channels = 1, channel_size = 4;
+        return true;
+    case RS2_FORMAT_RGB8:
+    case RS2_FORMAT_BGR8:
+        channels = 3, channel_size = 1;
+        return true;
+    case RS2_FORMAT_RGBA8:
+    case RS2_FORMAT_BGRA8:
+        channels = 4, channel_size = 1;
+        return true;
+    default:
+        return false;
+    }
+}
+
+
+frame_interface * pack_frames_nchw( frame_interface * const * frames, size_t count )
+{
+    if( ! count )
+        throw invalid_value_exception( "no frames to pack" );
+
+    auto first = dynamic_cast< video_frame * >( frames[0] );
+    if( ! first || ! first->get_stream() )
+        throw invalid_value_exception( "only video frames can be packed" );
+    auto const profile = first->get_stream();
+    int channels;
+    size_t channel_size;
+    if( ! get_channels( profile->get_format(), channels, channel_size ) )
+        throw invalid_value_exception( rsutils::string::from()
+                                       << "frames of format " << profile->get_format() << " cannot be packed" );
+
+    int const width = first->get_width();
+    int const height = first->get_height();
+    for( size_t i = 1; i < count; ++i )
+    {
+        auto vf = dynamic_cast< video_frame * >( frames[i] );
+        if( ! vf || ! vf->get_stream() || vf->get_stream()->get_unique_id() != profile->get_unique_id()
+            || vf->get_width() != width || vf->get_height() != height )
+            throw invalid_value_exception( "only frames of the same stream profile can be packed together" );
+    }
+
+    auto owner = first->get_owner();
+    if( ! owner )
+        throw invalid_value_exception( "the frames have no frame pool to allocate from" );
+
+    size_t const row_size = width * channel_size;
+    size_t const plane_size = row_size * height;
+    size_t const frame_size = plane_size * channels;
+    frame_additional_data data = first->additional_data;
+    auto res = owner->alloc_and_track( frame_size * count, std::move( data ), true, false );
+    if( ! res )
+        throw wrong_api_call_sequence_exception( "Out of frame resources!" );
+    auto packed = dynamic_cast< video_frame * >( res );
+    if( ! packed )
+    {
+        res->release();
+        throw std::runtime_error( "Frame is not video frame" );
+    }
+    packed->metadata_parsers = first->metadata_parsers;
+    packed->assign( width, int( count ) * channels * height, int( row_size ), int( channel_size * 8 ) );
+    packed->set_sensor( first->get_sensor() );
+    packed->set_stream( profile );
+
+    auto out = const_cast< uint8_t * >( packed->get_frame_data() );
+    for( size_t i = 0; i < count; ++i, out += frame_size )
+    {
+        auto vf = static_cast< video_frame * >( frames[i] );
+        auto const in = vf->get_frame_data();
+        size_t const stride = vf->get_stride();
+        if( channels == 1 )
+        {
+            if( stride == row_size )
+                std::memcpy( out, in, plane_size );
+            else
+                for( int y = 0; y < height; ++y )
+                    std::memcpy( out + y * row_size, in + y * stride, row_size );
+            continue;
+        }
+        // Byte channels, interleaved: split them into their planes
+        for( int y = 0; y < height; ++y )
+        {
+            auto src = in + y * stride;
+            for( int c = 0; c < channels; ++c )
+            {
+                auto dst = out + c * plane_size + y * row_size;
+                for( int x = 0; x < width; ++x )
+                    dst[x] = src[x * channels + c];
+            }
+        }
+    }
+    return res;
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,25 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+
+
+namespace librealsense {
+
+
+class frame_interface;
+
+
+// Packs video frames of one stream profile into a single new frame, as an N x C x H x W tensor: frame after frame, and
+// within each frame, a plane per channel (so RGB8 becomes three planes of R, G and B bytes). The channels keep their
+// type; only formats whose channels are all alike can be packed.
+//
+// The frame comes from the archive of the first frame (its frame pool and memory budget), with its metadata, and the
+// same profile: it is W wide and N*C*H high, with a stride of W channels.
+//
+frame_interface * pack_frames_nchw( frame_interface * const * frames, size_t count );
+
+
+}  // namespace librealsense
@@ -0,0 +1,158 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace librealsense {
+
+
+// Pool of released frames, kept so their data buffers can be reused by the next frame of the same size.
+//
+// Frames are bucketed by the exact size of their data, so get() and put() are O(1). Within a bucket the most recently
+// returned frame is handed out first (its memory is more likely to still be in cache), while aging is done from the
+// other end: buffers that have not been reused for 'max_age' are dropped, at most every max_age/2, whenever frames are
+// requested or returned -- a stream whose frames are held by the user still sheds its idle buffers as it allocates new
+// ones. Once 'high_water_mark' frames are pooled, additional ones are simply not kept.
+//
+// An observer can follow the bytes pooled: it is told of every change, with the pool locked.
+//
+template< class T >
+class frame_buffer_pool
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    static constexpr size_t DEFAULT_HIGH_WATER_MARK = 32;
+
+    explicit frame_buffer_pool( size_t high_water_mark = DEFAULT_HIGH_WATER_MARK,
+                                clock::duration max_age = std::chrono::seconds( 1 ) )
+        : _high_water_mark( high_water_mark )
+        , _max_age( max_age )
+    {
+    }
+
+    // Move a pooled frame whose data is exactly 'size' bytes into 'out'; returns false if there isn't one. Its contents
+    // are whatever the previous frame left there.
+    bool get( size_t size, T & out )
+    {
+        std::deque< entry > expired;  // destroyed only after we release the lock
+        std::lock_guard< std::mutex > lock( _mutex );
+        maybe_trim( clock::now(), expired );
+        auto it = _buckets.find( size );
+        if( it == _buckets.end() || it->second.empty() )
+            return false;
+        out = std::move( it->second.back().f );
+        it->second.pop_back();
+        --_count;
+        add_bytes( -std::ptrdiff_t( size ) );
+        return true;
+    }
+
+    void put( T && f )
+    {
+        auto const now = clock::now();
+        std::deque< entry > expired;  // destroyed only after we release the lock
+        std::lock_guard< std::mutex > lock( _mutex );
+        maybe_trim( now, expired );
+        if( _count >= _high_water_mark )
+            return;
+        auto const size = f.get_reusable_data_size();
+        if( ! size )
+            return;
+        _buckets[size].push_back( { std::move( f ), now } );
+        ++_count;
+        add_bytes( std::ptrdiff_t( size ) );
+    }
+
+    void clear()
+    {
+        std::unordered_map< size_t, std::deque< entry > > buckets;
+        std::lock_guard< std::mutex > lock( _mutex );
+        std::swap( buckets, _buckets );
+        _count = 0;
+        add_bytes( -std::ptrdiff_t( _bytes ) );
+    }
+
+    void set_observer( std::function< void( std::ptrdiff_t bytes_added ) > observer )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _observer = std::move( observer );
+        if( _observer && _bytes )
+            _observer( std::ptrdiff_t( _bytes ) );
+    }
+
+    size_t bytes() const
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        return _bytes;
+    }
+
+    size_t size() const
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        return _count;
+    }
+
+private:
+    struct entry
+    {
+        T f;
+        clock::time_point returned;
+    };
+
+    // Requires the lock
+    void maybe_trim( clock::time_point now, std::deque< entry > & expired )
+    {
+        if( now - _last_trim >= _max_age / 2 )
+            trim( now, expired );
+    }
+
+    // Requires the lock. Oldest entries are at the front of each bucket, so this only touches expired ones.
+    void trim( clock::time_point now, std::deque< entry > & expired )
+    {
+        for( auto it = _buckets.begin(); it != _buckets.end(); )
+        {
+            auto & bucket = it->second;
+            while( ! bucket.empty() && now - bucket.front().returned > _max_age )
+            {
+                expired.push_back( std::move( bucket.front() ) );
+                bucket.pop_front();
+                --_count;
+                add_bytes( -std::ptrdiff_t( it->first ) );
+            }
+            if( bucket.empty() )
+                it = _buckets.erase( it );
+            else
+                ++it;
+        }
+        _last_trim = now;
+    }
+
+    // Requires the lock
+    void add_bytes( std::ptrdiff_t bytes )
+    {
+        _bytes += bytes;
+        if( _observer )
+            _observer( bytes );
+    }
+
+    mutable std::mutex _mutex;
+    std::unordered_map< size_t, std::deque< entry > > _buckets;
+    size_t _count = 0;
+    size_t _bytes = 0;
+    std::function< void( std::ptrdiff_t ) > _observer;
+    size_t const _high_water_mark;
+    clock::duration const _max_age;
+    clock::time_point _last_trim;
+};
+
+
+}  // namespace librealsense
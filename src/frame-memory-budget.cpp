@@ -0,0 +1,133 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "frame-memory-budget.h"
+
+#include <rsutils/json.h>
+
+#include <algorithm>
+
+
+namespace librealsense {
+
+
+frame_memory_budget & frame_memory_budget::instance()
+{
+    static frame_memory_budget budget;
+    return budget;
+}
+
+
+void frame_memory_budget::set_limit( uint64_t bytes )
+{
+    _limit = bytes;
+}
+
+
+uint64_t frame_memory_budget::allowance( priority p ) const
+{
+    uint64_t const limit = _limit;
+    switch( p )
+    {
+    case priority::low:
+        return limit - limit / 4;
+    case priority::normal:
+        return limit - limit / 8;
+    default:
+        return limit;
+    }
+}
+
+
+bool frame_memory_budget::reserve( size_t size, uint64_t allowed, uint64_t & in_use )
+{
+    // Checking and adding in one step, or frames of other streams may pass the same check and overshoot together
+    auto current = _in_use.load();
+    do
+    {
+        if( current + std::max< int64_t >( _pooled, 0 ) + size > allowed )
+            return false;
+    }
+    while( ! _in_use.compare_exchange_weak( current, current + size ) );
+    in_use = current + size;
+    return true;
+}
+
+
+bool frame_memory_budget::acquire( size_t size, priority p )
+{
+    uint64_t in_use;
+    if( ! _limit )
+        in_use = _in_use += size;
+    else
+    {
+        auto const allowed = allowance( p );
+        if( ! reserve( size, allowed, in_use ) )
+        {
+            // The freelists make up the difference, if they can
+            if( _pooled > 0 )
+            {
+                reclaim();
+                ++_reclaims;
+            }
+            if( ! reserve( size, allowed, in_use ) )
+            {
+                ++_dropped[int( p )];
+                return false;
+            }
+        }
+    }
+
+    auto peak = _peak.load();
+    while( in_use > peak && ! _peak.compare_exchange_weak( peak, in_use ) )
+    {
+    }
+    return true;
+}
+
+
+void frame_memory_budget::release( size_t size )
+{
+    _in_use -= size;
+}
+
+
+int frame_memory_budget::register_reclaimer( reclaimer r )
+{
+    std::lock_guard< std::mutex > lock( _reclaimers_mutex );
+    _reclaimers[++_next_reclaimer] = std::move( r );
+    return _next_reclaimer;
+}
+
+
+void frame_memory_budget::unregister_reclaimer( int id )
+{
+    std::lock_guard< std::mutex > lock( _reclaimers_mutex );
+    _reclaimers.erase( id );
+}
+
+
+void frame_memory_budget::reclaim()
+{
+    std::lock_guard< std::mutex > lock( _reclaimers_mutex );
+    for( auto & r : _reclaimers )
+        r.second();
+}
+
+
+rsutils::json frame_memory_budget::get_usage() const
+{
+    auto const mb = []( double bytes ) { return bytes / 1e6; };
+    return rsutils::json::object( { { "limit", mb( double( _limit ) ) },
+                                    { "in-use", mb( double( _in_use ) ) },
+                                    { "pooled", mb( double( std::max< int64_t >( _pooled, 0 ) ) ) },
+                                    { "peak", mb( double( _peak ) ) },
+                                    { "dropped",
+                                      rsutils::json::object( { { "low", _dropped[0].load() },
+                                                               { "normal", _dropped[1].load() },
+                                                               { "high", _dropped[2].load() } } ) },
+                                    { "reclaims", _reclaims.load() } } );
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,85 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <rsutils/json-fwd.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+
+
+namespace librealsense {
+
+
+// A process-wide limit, in bytes, on the memory that frame data takes: that held by frames that are alive, in every
+// frame_archive (sensors' and processing blocks' alike), and that kept in their freelists for reuse.
+//
+// RS2_OPTION_FRAMES_QUEUE_SIZE bounds the frames of each stream, but not the sum over streams: with several slow
+// consumers, each within its bound, the total can still grow past what the machine has. Once the budget is short,
+// pooled buffers are given up first; if that is not enough, new frames are dropped -- those of low-priority streams
+// already when the budget is 3/4 used, of normal ones at 7/8, and of high-priority ones only when it is exhausted.
+//
+class frame_memory_budget
+{
+public:
+    enum class priority
+    {
+        low,     // recomputable or bulky: point clouds
+        normal,  // color, infrared, ...
+        high,    // depth, and motion and pose (which are tiny)
+    };
+
+    static frame_memory_budget & instance();
+
+    // 0 (the default) for no limit
+    void set_limit( uint64_t bytes );
+    uint64_t get_limit() const { return _limit; }
+
+    // Accounts for a new frame holding 'size' bytes. Returns false, accounting for nothing, if the frame should be
+    // dropped instead.
+    bool acquire( size_t size, priority );
+    void release( size_t size );
+
+    // Bytes added to (or, if negative, taken from) the freelists
+    void add_pooled( int64_t bytes ) { _pooled += bytes; }
+
+    // Freelists register a function that empties them, to reclaim their memory when the budget is short
+    using reclaimer = std::function< void() >;
+    int register_reclaimer( reclaimer );
+    void unregister_reclaimer( int id );
+
+    // Empties all the freelists
+    void reclaim();
+
+    uint64_t get_in_use() const { return _in_use; }
+    uint64_t get_pooled() const { return _pooled; }
+
+    // { "limit", "in-use", "pooled", "peak" (MB), "dropped": { "low", "normal", "high" }, "reclaims" }
+    rsutils::json get_usage() const;
+
+private:
+    frame_memory_budget() = default;
+
+    uint64_t allowance( priority ) const;
+    // Adds 'size' to the bytes in use, if they then fit within 'allowed'; 'in_use' is the new total
+    bool reserve( size_t size, uint64_t allowed, uint64_t & in_use );
+
+    std::atomic< uint64_t > _limit{ 0 };
+    std::atomic< uint64_t > _in_use{ 0 };
+    std::atomic< int64_t > _pooled{ 0 };
+    std::atomic< uint64_t > _peak{ 0 };
+    std::atomic< uint64_t > _dropped[3]{};
+    std::atomic< uint64_t > _reclaims{ 0 };
+
+    std::mutex _reclaimers_mutex;
+    std::map< int, reclaimer > _reclaimers;
+    int _next_reclaimer = 0;
+};
+
+
+}  // namespace librealsense
@@ -0,0 +1,198 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "frame-trace.h"
+#include "core/frame-interface.h"
+#include "core/stream-profile-interface.h"
+#include "core/time-service.h"
+#include "core/enum-helpers.h"
+
+#include <rsutils/easylogging/easyloggingpp.h>
+#include <rsutils/json.h>
+
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace librealsense {
+
+
+std::atomic< bool > frame_trace::_enabled( false );
+
+
+namespace {
+
+
+struct trace_event
+{
+    std::string what;
+    frame_trace::frame_tag tag;
+    double start_ms;
+    double end_ms;  // negative for an instant
+    int thread;
+};
+
+
+class trace_session
+{
+public:
+    std::mutex mutex;
+    std::string filename;
+    std::vector< trace_event > events;
+    size_t max_events = 0;
+    size_t lost = 0;
+    double origin_ms = 0;
+
+    static trace_session & instance()
+    {
+        static trace_session session;
+        return session;
+    }
+
+    void add( trace_event && e )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        if( ! frame_trace::enabled() )
+            return;
+        if( events.size() < max_events )
+            events.push_back( std::move( e ) );
+        else
+            ++lost;
+    }
+};
+
+
+// Small, stable thread IDs for the trace, in the order threads first show up in it
+int this_thread_trace_id()
+{
+    static std::atomic< int > next( 1 );
+    thread_local int const id = next++;
+    return id;
+}
+
+
+}  // namespace
+
+
+frame_trace::frame_tag::frame_tag( frame_interface const * f )
+{
+    if( ! f )
+        return;
+    number = f->get_frame_number();
+    if( auto profile = f->get_stream() )
+    {
+        stream = profile->get_stream_type();
+        index = profile->get_stream_index();
+    }
+}
+
+
+bool frame_trace::start( std::string const & filename, size_t max_events )
+{
+    auto & session = trace_session::instance();
+    std::lock_guard< std::mutex > lock( session.mutex );
+    if( enabled() )
+        return false;
+    session.filename = filename;
+    session.max_events = max_events;
+    session.events.clear();
+    session.events.reserve( std::min< size_t >( max_events, 1 << 16 ) );
+    session.lost = 0;
+    session.origin_ms = time_service::get_time();
+    _enabled = true;
+    LOG_INFO( "Frame trace started, to " << filename );
+    return true;
+}
+
+
+void frame_trace::stop()
+{
+    auto & session = trace_session::instance();
+    std::vector< trace_event > events;
+    std::string filename;
+    size_t lost;
+    double origin_ms;
+    {
+        std::lock_guard< std::mutex > lock( session.mutex );
+        if( ! enabled() )
+            return;
+        _enabled = false;
+        events.swap( session.events );
+        filename = session.filename;
+        lost = session.lost;
+        origin_ms = session.origin_ms;
+    }
+
+    // Events are streamed out one by one: a trace of a few minutes is too large to build as a single json first
+    std::ofstream out( filename );
+    if( ! out )
+    {
+        LOG_ERROR( "Failed to write frame trace to " << filename );
+        return;
+    }
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    for( auto & e : events )
+    {
+        rsutils::json j = rsutils::json::object();
+        j["name"] = e.what;
+        j["cat"] = "frame";
+        j["pid"] = 1;
+        j["tid"] = e.thread;
+        j["ts"] = ( e.start_ms - origin_ms ) * 1000;  // in us
+        if( e.end_ms < 0 )
+        {
+            j["ph"] = "i";
+            j["s"] = "t";
+        }
+        else
+        {
+            j["ph"] = "X";
+            j["dur"] = ( e.end_ms - e.start_ms ) * 1000;
+        }
+        auto & args = j["args"] = rsutils::json::object();
+        if( e.tag.stream != RS2_STREAM_ANY )
+            args["stream"] = std::string( get_string( e.tag.stream ) ) + ' ' + std::to_string( e.tag.index );
+        args["frame"] = e.tag.number;
+        out << ( first ? "" : ",\n" ) << j.dump();
+        first = false;
+    }
+    out << "\n]}\n";
+    LOG_INFO( "Frame trace of " << events.size() << " events written to " << filename
+                                << ( lost ? " (" + std::to_string( lost ) + " more did not fit)" : std::string() ) );
+}
+
+
+void frame_trace::instant( char const * what, frame_tag const & tag, double time_ms )
+{
+    if( ! enabled() )
+        return;
+    trace_session::instance().add( { what, tag, time_ms, -1., this_thread_trace_id() } );
+}
+
+
+void frame_trace::complete( std::string what, frame_tag const & tag, double start_ms, double end_ms )
+{
+    if( ! enabled() )
+        return;
+    trace_session::instance().add( { std::move( what ), tag, start_ms, end_ms, this_thread_trace_id() } );
+}
+
+
+double frame_trace::scope::begin( frame_interface const * f )
+{
+    _tag = frame_tag( f );
+    return time_service::get_time();
+}
+
+
+void frame_trace::scope::end()
+{
+    complete( _what, _tag, _start, time_service::get_time() );
+}
+
+
+}  // namespace librealsense
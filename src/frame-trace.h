@@ -0,0 +1,88 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+
+namespace librealsense {
+
+
+class frame_interface;
+
+
+// A process-wide trace of each frame's way from the backend to the user, for offline analysis: where it was, from when
+// to when, on which thread, tagged with its stream and frame number. It is written as a Chrome trace (JSON), which
+// Perfetto (ui.perfetto.dev) and chrome://tracing open.
+//
+// Off unless the "frame-trace" context setting names a file, e.g. { "frame-trace": { "file": "lrs.json" } }; it is
+// written when that context is destroyed. While off, each trace point costs one relaxed load. While on, events are
+// kept in memory (up to "max-events", beyond which they are counted but not kept), so the trace itself does not write
+// anything until it is done.
+//
+class frame_trace
+{
+public:
+    // What identifies a frame in the trace; taken when an event starts, as the frame may be gone by its end
+    struct frame_tag
+    {
+        rs2_stream stream = RS2_STREAM_ANY;  // none yet, in the backend
+        int index = 0;
+        unsigned long long number = 0;
+
+        frame_tag() = default;
+        explicit frame_tag( unsigned long long number_ ) : number( number_ ) {}
+        frame_tag( rs2_stream stream_, int index_, unsigned long long number_ )
+            : stream( stream_ ), index( index_ ), number( number_ ) {}
+        explicit frame_tag( frame_interface const * );
+    };
+
+    static bool enabled() { return _enabled.load( std::memory_order_relaxed ); }
+
+    // Returns false if a trace is already being taken
+    static bool start( std::string const & filename, size_t max_events );
+    // Writes the trace to its file, if one is being taken
+    static void stop();
+
+    // Something that happened to the frame at a point in time (time_service::get_time(), in ms)
+    static void instant( char const * what, frame_tag const &, double time_ms );
+    // Something that was done with the frame, from start to end
+    static void complete( std::string what, frame_tag const &, double start_ms, double end_ms );
+
+    // Traces the duration of a scope, if it started while the trace was on
+    class scope
+    {
+    public:
+        scope( char const * what, frame_interface const * f )
+            : _what( what )
+            , _start( enabled() ? begin( f ) : 0 )
+        {
+        }
+        ~scope()
+        {
+            if( _start )
+                end();
+        }
+        scope( scope const & ) = delete;
+        scope & operator=( scope const & ) = delete;
+
+    private:
+        double begin( frame_interface const * );
+        void end();
+
+        char const * _what;
+        frame_tag _tag;
+        double _start;
+    };
+
+private:
+    static std::atomic< bool > _enabled;
+};
+
+
+}  // namespace librealsense
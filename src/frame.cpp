@@ -7,10 +7,10 @@
 #include "archive.h"
 #include "metadata-parser.h"
 #include "core/enum-helpers.h"
+#include "proc/depth-kernels.h"
 
 #include <rsutils/string/from.h>
 
-
 namespace librealsense {
 
 
@@ -74,11 +74,17 @@ frame::frame( frame && r )
 frame & frame::operator=( frame && r )
 {
     data = std::move( r.data );
+    release_allocated_data();
+    std::swap( _allocated_data, r._allocated_data );
+    std::swap( _allocated_size, r._allocated_size );
+    std::swap( _allocator, r._allocator );
     owner = r.owner;
     ref_count = r.ref_count.exchange( 0 );
     _kept = r._kept.exchange( false );
     on_release = std::move( r.on_release );
     additional_data = std::move( r.additional_data );
+    budgeted_size = r.budgeted_size;
+    r.budgeted_size = 0;
     r.owner.reset();
     if( owner )
         metadata_parsers = owner->get_md_parsers();
@@ -86,6 +92,69 @@ frame & frame::operator=( frame && r )
         metadata_parsers = std::move( r.metadata_parsers );
     return *this;
 }
+
+void frame::set_allocated_data( uint8_t * buffer, size_t size, std::shared_ptr< rs2_frame_allocator > allocator )
+{
+    release_allocated_data();
+    _allocated_data = buffer;
+    _allocated_size = size;
+    _allocator = std::move( allocator );
+}
+
+namespace {
+
+// Holds the frame whose data another frame is a view of, until that one is done with it
+class parent_frame_reference : public rs2_frame_allocator
+{
+    frame_holder _parent;
+
+public:
+    explicit parent_frame_reference( frame_interface * parent )
+        : _parent( frame_holder::acquire( parent ) )
+    {
+    }
+
+    void * allocate( size_t ) override { return nullptr; }
+    void deallocate( void *, size_t ) override { _parent.reset(); }
+    void release() override { delete this; }
+};
+
+}  // namespace
+
+void frame::set_data_view( frame_interface * parent, size_t offset, size_t size )
+{
+    set_allocated_data( const_cast< uint8_t * >( parent->get_frame_data() ) + offset,
+                        size,
+                        std::make_shared< parent_frame_reference >( parent ) );
+}
+
+bool frame::is_data_view() const
+{
+    return _allocated_data && dynamic_cast< parent_frame_reference * >( _allocator.get() );
+}
+
+void frame::release_allocated_data()
+{
+    if( _allocated_data && _allocator )
+    {
+        try
+        {
+            _allocator->deallocate( _allocated_data, _allocated_size );
+        }
+        catch( ... )
+        {
+            LOG_ERROR( "Received an exception from frame deallocation callback!" );
+        }
+    }
+    else
+    {
+        delete[] _allocated_data;
+    }
+    _allocated_data = nullptr;
+    _allocated_size = 0;
+    _allocator.reset();
+}
+
 archive_interface * frame::get_owner() const
 {
     return owner.get();
@@ -111,12 +180,38 @@ void frame::release()
 {
     if( ref_count.fetch_sub( 1 ) == 1 && owner )
     {
+        // Nothing can look results up anymore; release them before the frame goes back to its pool
+        std::vector< std::pair< std::string, frame_holder > > results;
+        {
+            std::lock_guard< std::mutex > lock( _results_mutex );
+            results.swap( _results );
+        }
+        results.clear();
+
         unpublish();
         on_release();
         owner->unpublish_frame( this );
     }
 }
 
+frame_holder frame::find_result( std::string const & key ) const
+{
+    std::lock_guard< std::mutex > lock( _results_mutex );
+    for( auto & result : _results )
+        if( result.first == key )
+            return result.second.clone();
+    return {};
+}
+
+void frame::keep_result( std::string const & key, frame_holder && output )
+{
+    std::lock_guard< std::mutex > lock( _results_mutex );
+    for( auto & result : _results )
+        if( result.first == key )
+            return;  // an equivalent block got there first
+    _results.emplace_back( key, std::move( output ) );
+}
+
 void frame::keep()
 {
     if( ! _kept.exchange( true ))
@@ -135,6 +230,16 @@ frame_interface * frame::publish( std::shared_ptr< archive_interface > new_owner
 
 bool frame::find_metadata( rs2_frame_metadata_value frame_metadata, rs2_metadata_type * p_value ) const
 {
+    if( auto const decoded_metadata = additional_data.decoded_metadata.get() )
+    {
+        if( frame_metadata < 0 || size_t( frame_metadata ) >= decoded_metadata->size() )
+            return false;
+        auto const & decoded = ( *decoded_metadata )[frame_metadata];
+        if( decoded.is_valid && p_value )
+            *p_value = decoded.value;
+        return decoded.is_valid;
+    }
+
     if( ! metadata_parsers )
         return false;
     auto parsers = metadata_parsers->equal_range( frame_metadata );
@@ -147,14 +252,40 @@ bool frame::find_metadata( rs2_frame_metadata_value frame_metadata, rs2_metadata
     return value_retrieved;
 }
 
+void frame::decode_metadata()
+{
+    if( additional_data.decoded_metadata || ! metadata_parsers )
+        return;
+
+    auto decoded_metadata = std::make_shared< metadata_array >();
+    auto & decoded = *decoded_metadata;
+    try
+    {
+        // Same order as find_metadata(): the last parser to find a value wins
+        for( auto const & parser : *metadata_parsers )
+        {
+            rs2_metadata_type value;
+            if( size_t( parser.first ) < decoded.size() && parser.second->find( *this, &value ) )
+                decoded[parser.first] = { true, value };
+        }
+    }
+    catch( ... )
+    {
+        return;
+    }
+    additional_data.decoded_metadata = std::move( decoded_metadata );
+}
+
 int frame::get_frame_data_size() const
 {
+    if( _allocated_data )
+        return (int)_allocated_size;
     return (int)data.size();
 }
 
 const uint8_t * frame::get_frame_data() const
 {
-    const uint8_t * frame_data = data.data();
+    const uint8_t * frame_data = _allocated_data ? _allocated_data : data.data();
 
     if( on_release.get_data() )
     {
@@ -226,5 +357,55 @@ float depth_frame::get_distance( int x, int y ) const
     return pixel * get_units();
 }
 
+void depth_frame::get_distances( const int * pixels, size_t count, float * distances ) const
+{
+    if( _original && get_stream()->get_format() != RS2_FORMAT_Z16 )
+        return ( (depth_frame *)_original.frame )->get_distances( pixels, count, distances );
+
+    int const width = get_width(), height = get_height();
+    for( size_t i = 0; i < count; ++i )
+    {
+        int const x = pixels[2 * i], y = pixels[2 * i + 1];
+        if( x < 0 || x >= width || y < 0 || y >= height )
+            throw invalid_value_exception( rsutils::string::from() << "pixel " << i << " (" << x << ", " << y
+                                                                  << ") is outside the " << width << "x" << height
+                                                                  << " frame" );
+    }
+
+    if( get_bpp() != 16 )
+    {
+        for( size_t i = 0; i < count; ++i )
+            distances[i] = get_distance( pixels[2 * i], pixels[2 * i + 1] );
+        return;
+    }
+
+    auto const depth = reinterpret_cast< const uint16_t * >( get_frame_data() );
+    auto const units = get_units();
+    for( size_t i = 0; i < count; ++i )
+        distances[i] = depth[pixels[2 * i + 1] * width + pixels[2 * i]] * units;
+}
+
+void depth_frame::get_distances( float * distances ) const
+{
+    if( _original && get_stream()->get_format() != RS2_FORMAT_Z16 )
+        return ( (depth_frame *)_original.frame )->get_distances( distances );
+
+    size_t const width = get_width(), height = get_height();
+    if( get_bpp() != 16 )
+    {
+        for( size_t y = 0; y < height; ++y )
+            for( size_t x = 0; x < width; ++x )
+                *distances++ = get_distance( int( x ), int( y ) );
+        return;
+    }
+
+    depth_to_meters( reinterpret_cast< const uint16_t * >( get_frame_data() ), width * height, get_units(), distances );
+}
+
+void depth_frame::depth_to_meters( const uint16_t * depth, size_t count, float units, float * meters )
+{
+    librealsense::depth_to_meters( depth, count, units, meters );
+}
+
 
 }  // namespace librealsense
@@ -6,10 +6,16 @@
 #include "core/frame-interface.h"
 #include "core/frame-continuation.h"
 #include "core/frame-additional-data.h"
+#include "core/frame-holder.h"
 #include "basics.h"
 #include <atomic>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <string>
+
+
+struct rs2_frame_allocator;
 
 
 namespace librealsense {
@@ -22,6 +28,8 @@ public:
     std::vector< uint8_t > data;
     frame_additional_data additional_data;
     std::shared_ptr< metadata_parser_map > metadata_parsers = nullptr;
+    // What the frame is accounted for in the frame_memory_budget, returned by its archive when it is released
+    size_t budgeted_size = 0;
     
     explicit frame()
         : ref_count( 0 )
@@ -36,9 +44,17 @@ public:
     frame & operator=( const frame & r ) = delete;
     frame & operator=( frame && r );
 
-    virtual ~frame() { on_release.reset(); }
+    virtual ~frame()
+    {
+        on_release.reset();
+        release_allocated_data();
+    }
     frame_header const & get_header() const override { return additional_data; }
     bool find_metadata( rs2_frame_metadata_value, rs2_metadata_type * p_output_value ) const override;
+
+    // Run all the metadata parsers once, so that find_metadata() becomes a table lookup. Must be done before the frame
+    // is shared between threads. If a parser throws, the frame is left to parse on every query, as before.
+    void decode_metadata();
     int get_frame_data_size() const override;
     const uint8_t * get_frame_data() const override;
     rs2_time_t get_frame_timestamp() const override;
@@ -63,6 +79,7 @@ public:
 
     void acquire() override { ref_count.fetch_add( 1 ); }
     void release() override;
+    bool is_shared() const override { return ref_count > 1; }
     void keep() override;
 
     frame_interface * publish( std::shared_ptr< archive_interface > new_owner ) override;
@@ -84,7 +101,33 @@ public:
     void set_blocking( bool state ) override { additional_data.is_blocking = state; }
     bool is_blocking() const override { return additional_data.is_blocking; }
 
+    // Use a buffer for the frame data instead of 'data': either obtained from a user-supplied allocator (see
+    // rs2_set_frame_allocator), which gets it back when the frame is destroyed, or, with no allocator, an uninitialized
+    // buffer from new[] that the frame owns
+    void set_allocated_data( uint8_t * buffer, size_t size, std::shared_ptr< rs2_frame_allocator > allocator );
+
+    // Use 'size' bytes of another frame's data, from 'offset', as this frame's, without a copy: 'parent' is held until
+    // this frame is released. The data is shared with the parent (and any other views of it), so it must not be written.
+    void set_data_view( frame_interface * parent, size_t offset, size_t size );
+    bool is_data_view() const;
+
+    // Outputs processing blocks computed from this frame, for equivalent blocks to reuse, by a key that identifies the
+    // block and the settings it had (see generic_processing_block::share_result). They are dropped when the frame is
+    // released, so an output must not hold this frame itself, or the two would keep each other alive.
+    frame_holder find_result( std::string const & key ) const;
+    void keep_result( std::string const & key, frame_holder && output );
+
+    // Size of the data memory owned by the library that can be reused for another frame (0 if none)
+    size_t get_reusable_data_size() const
+    {
+        if( _allocated_data )
+            return _allocator ? 0 : _allocated_size;
+        return data.size();
+    }
+
 private:
+    void release_allocated_data();
+
     // TODO: check boost::intrusive_ptr or an alternative
     std::atomic< int > ref_count;  // the reference count is on how many times this placeholder has
                                    // been observed (not lifetime, not content)
@@ -94,6 +137,11 @@ private:
     bool _fixed = false;
     std::atomic_bool _kept;
     std::shared_ptr< stream_profile_interface > stream;
+    uint8_t * _allocated_data = nullptr;
+    size_t _allocated_size = 0;
+    std::shared_ptr< rs2_frame_allocator > _allocator;
+    mutable std::mutex _results_mutex;
+    std::vector< std::pair< std::string, frame_holder > > _results;
 };
 
 
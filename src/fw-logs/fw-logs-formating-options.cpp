@@ -80,7 +80,7 @@ namespace librealsense
             }
         }
 
-        std::unordered_map<string, std::vector<kvp>> fw_logs_formating_options::get_enums() const
+        const std::unordered_map<string, std::vector<kvp>>& fw_logs_formating_options::get_enums() const
         {
             return _fw_logs_enum_names_list;
         }
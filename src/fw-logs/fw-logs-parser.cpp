@@ -1,10 +1,8 @@
 // License: Apache 2.0. See LICENSE file in root directory.
 // Copyright(c) 2019 Intel Corporation. All Rights Reserved.
 #include "fw-logs-parser.h"
-#include <regex>
-#include <sstream>
-#include "fw-string-formatter.h"
 #include "stdint.h"
+#include <algorithm>
 
 using namespace std;
 
@@ -18,6 +16,10 @@ namespace librealsense
             _timestamp_factor(0.00001)
         {
             _fw_logs_formating_options.initialize_from_xml();
+
+            auto& enums = _fw_logs_formating_options.get_enums();
+            for (auto& event : _fw_logs_formating_options.get_events())
+                _formats.emplace(event.first, fw_log_format(event.second.line, std::min<size_t>(event.second.num_of_params, 3), enums));
         }
 
 
@@ -35,12 +37,20 @@ namespace librealsense
             log_data = fill_log_data(fw_log_msg);
 
             //message
-            fw_string_formatter reg_exp(_fw_logs_formating_options.get_enums());
-            fw_log_event log_event_data;
-            _fw_logs_formating_options.get_event_data(log_data._event_id, &log_event_data);
-
             uint32_t params[3] = { log_data._p1, log_data._p2, log_data._p3 };
-            reg_exp.generate_message(log_event_data.line, log_event_data.num_of_params, params, &log_data._message);
+            auto format_it = _formats.find(log_data._event_id);
+            if (format_it != _formats.end())
+            {
+                log_data._message.reserve(128);
+                format_it->second.format(params, log_data._message);
+            }
+            else
+            {
+                fw_log_event log_event_data;
+                _fw_logs_formating_options.get_event_data(log_data._event_id, &log_event_data);
+                fw_log_format(log_event_data.line, log_event_data.num_of_params, _fw_logs_formating_options.get_enums())
+                    .format(params, log_data._message);
+            }
 
             //file_name
             _fw_logs_formating_options.get_file_name(log_data._file_id, &log_data._file_name);
@@ -6,6 +6,8 @@
 #include <memory>
 #include "fw-logs-formating-options.h"
 #include "fw-log-data.h"
+#include "fw-string-formatter.h"
+#include <unordered_map>
 
 namespace librealsense
 {
@@ -24,6 +26,7 @@ namespace librealsense
             fw_log_data fill_log_data(const fw_logs_binary_data* fw_log_msg);
 
             fw_logs_formating_options _fw_logs_formating_options;
+            std::unordered_map<int, fw_log_format> _formats;  // by event id, compiled once from the XML
             uint64_t _last_timestamp;
             const double _timestamp_factor;
         };
@@ -5,10 +5,11 @@
 #include "fw-logs-formating-options.h"
 #include <rsutils/easylogging/easyloggingpp.h>
 
-#include <regex>
 #include <sstream>
-#include <iomanip>
-#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <cctype>
 #include <cmath>
 
 using namespace std;
@@ -17,133 +18,149 @@ namespace librealsense
 {
     namespace fw_logs
     {
-        fw_string_formatter::fw_string_formatter(std::unordered_map<std::string, std::vector<kvp>> enums)
-            :_enums(enums)
+        fw_log_format::fw_log_format(const string& line, size_t num_of_params, const fw_log_enums& enums)
+            : _num_of_params(num_of_params)
         {
-        }
-
-
-        fw_string_formatter::~fw_string_formatter(void)
-        {
-        }
-
-        bool fw_string_formatter::generate_message(const string& source, size_t num_of_params, const uint32_t* params, string* dest)
-        {
-            map<string, string> exp_replace_map;
-            map<string, int> enum_replace_map;
-
-            if (params == nullptr && num_of_params > 0) return false;
-
-            for (size_t i = 0; i < num_of_params; i++)
+            _text.reserve(line.size());
+            auto add_text = [&](size_t from, size_t to)
             {
-                string regular_exp[4];
-                string replacement[4];
-                stringstream st_regular_exp[4];
-                stringstream st_replacement[4];
-
-                st_regular_exp[0] << "\\{\\b(" << i << ")\\}";
-                regular_exp[0] = st_regular_exp[0].str();
-
-                st_replacement[0] << params[i];
-                replacement[0] = st_replacement[0].str();
-
-                exp_replace_map[regular_exp[0]] = replacement[0];
-
-
-                st_regular_exp[1] << "\\{\\b(" << i << "):x\\}";
-                regular_exp[1] = st_regular_exp[1].str();
-
-                st_replacement[1] << hex << setw(2) << setfill('0') << params[i];
-                replacement[1] = st_replacement[1].str();
-
-                exp_replace_map[regular_exp[1]] = replacement[1];
-
-                st_regular_exp[2] << "\\{\\b(" << i << "):f\\}";
-                regular_exp[2] = st_regular_exp[2].str();
-                // Parse int32_t as 4 raw bytes of float
-                float tmp = *reinterpret_cast< const float * >( &params[i] );
-                if( std::isfinite( tmp ) )
-                    st_replacement[2] << tmp;
+                if (from == to)
+                    return;
+                auto begin = _text.size();
+                _text.append(line, from, to - from);
+                if (!_segments.empty() && _segments.back().type == TEXT)
+                    _segments.back().end = _text.size();
                 else
+                    _segments.push_back({ TEXT, 0, begin, _text.size(), nullptr });
+            };
+
+            size_t pos = 0, text_start = 0;
+            while ((pos = line.find('{', pos)) != string::npos)
+            {
+                // {<param>}, {<param>:x}, {<param>:f} or {<param>,<EnumName>}
+                size_t i = pos + 1;
+                size_t param = 0;
+                while (i < line.size() && isdigit(static_cast<unsigned char>(line[i])))
+                    param = param * 10 + (line[i++] - '0');
+                if (i == pos + 1 || i == line.size() || param >= num_of_params)
                 {
-                    LOG_ERROR( "Expecting a number, received infinite or NaN" );
-                    st_replacement[2] << "0x" << hex << setw( 2 ) << setfill( '0' ) << params[i];
+                    ++pos;
+                    continue;
                 }
-                replacement[2] = st_replacement[2].str();
-                exp_replace_map[regular_exp[2]] = replacement[2];
 
+                segment seg = { DECIMAL, param, 0, 0, nullptr };
+                size_t end = string::npos;
+                if (line[i] == '}')
+                    end = i;
+                else if (line[i] == ':' && i + 2 < line.size() && line[i + 2] == '}' && (line[i + 1] == 'x' || line[i + 1] == 'f'))
+                {
+                    seg.type = line[i + 1] == 'x' ? HEX : FLOAT;
+                    end = i + 2;
+                }
+                else if (line[i] == ',')
+                {
+                    size_t name = i + 1;
+                    size_t j = name;
+                    while (j < line.size() && isalpha(static_cast<unsigned char>(line[j])))
+                        ++j;
+                    if (j > name && j < line.size() && line[j] == '}')
+                    {
+                        auto it = enums.find(line.substr(name, j - name));
+                        if (it != enums.end())
+                        {
+                            seg.type = ENUM;
+                            seg.values = &it->second;
+                            end = j;
+                        }
+                    }
+                }
+                if (end == string::npos)
+                {
+                    // Not a reference we know: left in the text as-is
+                    ++pos;
+                    continue;
+                }
 
-                st_regular_exp[3] << "\\{\\b(" << i << "),[a-zA-Z]+\\}";
-                regular_exp[3] = st_regular_exp[3].str();
-
-                enum_replace_map[regular_exp[3]] = params[i];
+                add_text(text_start, pos);
+                _segments.push_back(seg);
+                pos = text_start = end + 1;
             }
-
-            return replace_params(source, exp_replace_map, enum_replace_map, dest);
+            add_text(text_start, line.size());
         }
 
-        bool fw_string_formatter::replace_params(const string& source, const map<string, string>& exp_replace_map, const map<string, int>& enum_replace_map, string* dest)
+        void fw_log_format::format(const uint32_t* params, string& dest) const
         {
-            string source_temp(source);
-
-            for (auto exp_replace_it = exp_replace_map.begin(); exp_replace_it != exp_replace_map.end(); exp_replace_it++)
+            char buf[32];
+            for (auto const& seg : _segments)
             {
-                string destTemp;
-                regex e(exp_replace_it->first);
-                auto res = regex_replace(back_inserter(destTemp), source_temp.begin(), source_temp.end(), e, exp_replace_it->second);
-                source_temp = destTemp;
-            }
-
-            for (auto exp_replace_it = enum_replace_map.begin(); exp_replace_it != enum_replace_map.end(); exp_replace_it++)
-            {
-                string destTemp;
-                regex e(exp_replace_it->first);
-                std::smatch m;
-                std::regex_search(source_temp, m, std::regex(e));
+                switch (seg.type)
+                {
+                case TEXT:
+                    dest.append(_text, seg.begin, seg.end - seg.begin);
+                    break;
 
-                string enum_name;
+                case DECIMAL:
+                    dest.append(buf, snprintf(buf, sizeof(buf), "%u", params[seg.param]));
+                    break;
 
-                string st_regular_exp = "[a-zA-Z]+";
-                regex e1(st_regular_exp);
+                case HEX:
+                    dest.append(buf, snprintf(buf, sizeof(buf), "%02x", params[seg.param]));
+                    break;
 
-                for (size_t exp = 0; exp < m.size(); exp++)
+                case FLOAT:
                 {
-                    string str = m[exp];
-
-                    std::smatch m1;
-
-                    regex e2 = e1;
-                    std::regex_search(str, m1, std::regex(e2));
+                    // Parse int32_t as 4 raw bytes of float
+                    float tmp;
+                    memcpy(&tmp, &params[seg.param], sizeof(tmp));
+                    if (std::isfinite(tmp))
+                        dest.append(buf, snprintf(buf, sizeof(buf), "%g", tmp));
+                    else
+                    {
+                        LOG_ERROR("Expecting a number, received infinite or NaN");
+                        dest.append(buf, snprintf(buf, sizeof(buf), "0x%02x", params[seg.param]));
+                    }
+                    break;
+                }
 
-                    for (size_t exp = 0; exp < m1.size(); exp++)
+                case ENUM:
+                {
+                    // Verify the value is within the enumerated range
+                    int val = static_cast<int>(params[seg.param]);
+                    auto it = std::find_if(seg.values->begin(), seg.values->end(), [val](const kvp& entry) { return entry.first == val; });
+                    if (it != seg.values->end())
+                        dest.append(it->second);
+                    else
                     {
-                        enum_name = m1[exp];
-                        if (_enums.size() > 0 && _enums.find(enum_name) != _enums.end())
-                        {
-                            auto vec = _enums[enum_name];
-                            regex e3 = e;
-                            // Verify user's input is within the enumerated range
-                            int val = exp_replace_it->second;
-                            auto it = std::find_if(vec.begin(), vec.end(), [val](kvp& entry) { return entry.first == val; });
-                            if (it != vec.end())
-                            {
-                                regex_replace(back_inserter(destTemp), source_temp.begin(), source_temp.end(), e3, it->second);
-                            }
-                            else
-                            {
-                                stringstream s;
-                                s << "Protocol Error recognized!\nImproper log message received: " << source_temp
-                                    << ", invalid parameter: " << exp_replace_it->second << ".\n The range of supported values is \n";
-                                for_each(vec.begin(), vec.end(), [&s](kvp& entry) { s << entry.first << ":" << entry.second << " ,"; });
-                                std::cout << s.str().c_str() << std::endl;;
-                            }
-                            source_temp = destTemp;
-                        }
+                        stringstream s;
+                        s << "Protocol Error recognized!\nImproper log message received, invalid parameter: " << val
+                          << ".\n The range of supported values is \n";
+                        for_each(seg.values->begin(), seg.values->end(), [&s](const kvp& entry) { s << entry.first << ":" << entry.second << " ,"; });
+                        LOG_ERROR(s.str());
+                        dest.append(buf, snprintf(buf, sizeof(buf), "%d", val));
                     }
+                    break;
+                }
                 }
             }
+        }
+
+
+        fw_string_formatter::fw_string_formatter(fw_log_enums enums)
+            :_enums(std::move(enums))
+        {
+        }
+
+
+        fw_string_formatter::~fw_string_formatter(void)
+        {
+        }
+
+        bool fw_string_formatter::generate_message(const string& source, size_t num_of_params, const uint32_t* params, string* dest)
+        {
+            if (params == nullptr && num_of_params > 0) return false;
 
-            *dest = source_temp;
+            dest->clear();
+            fw_log_format(source, num_of_params, _enums).format(params, *dest);
             return true;
         }
     }
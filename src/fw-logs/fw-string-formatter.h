@@ -11,18 +11,48 @@ namespace librealsense
 {
     namespace fw_logs
     {
+        typedef std::unordered_map<std::string, std::vector<std::pair<int, std::string>>> fw_log_enums;
+
+        // A log line, e.g. "Temperature {0:f}, state {1,StateEnum}", compiled once into literal text and references to
+        // parameters ({i} decimal, {i:x} hex, {i:f} float bits, {i,Enum} enum value name), so generating a message is a
+        // single pass with no regex, stream or temporary strings.
+        // Enum references point into the enums given, which must outlive the format.
+        class fw_log_format
+        {
+        public:
+            fw_log_format() = default;
+            fw_log_format(const std::string& line, size_t num_of_params, const fw_log_enums& enums);
+
+            // Appends the message to dest; params must hold the num_of_params given on construction
+            void format(const uint32_t* params, std::string& dest) const;
+
+            size_t get_num_of_params() const { return _num_of_params; }
+
+        private:
+            enum segment_type { TEXT, DECIMAL, HEX, FLOAT, ENUM };
+            struct segment
+            {
+                segment_type type;
+                size_t param;           // not for TEXT
+                size_t begin, end;      // TEXT: range in _text
+                const std::vector<std::pair<int, std::string>>* values;  // ENUM
+            };
+
+            std::string _text;
+            std::vector<segment> _segments;
+            size_t _num_of_params = 0;
+        };
+
         class fw_string_formatter
         {
         public:
-            fw_string_formatter(std::unordered_map<std::string, std::vector<std::pair<int, std::string>>> enums);
+            fw_string_formatter(fw_log_enums enums);
             ~fw_string_formatter(void);
 
             bool generate_message(const std::string& source, size_t num_of_params, const uint32_t* params, std::string* dest);
 
         private:
-            bool replace_params(const std::string& source, const std::map<std::string, std::string>& exp_replace_map, const std::map<std::string, int>& enum_replace_map, std::string* dest);
-
-            std::unordered_map<std::string, std::vector<std::pair<int, std::string>>> _enums;
+            fw_log_enums _enums;
         };
     }
 }
@@ -85,6 +85,10 @@ namespace librealsense
     {
         std::chrono::milliseconds elapsed_milliseconds;
         auto start = std::chrono::system_clock::now();
+        // FW doesn't set the bwPollTimeout value, therefore it is wrong to use status.bwPollTimeout.
+        // A block is usually programmed within a few ms, so poll quickly at first and back off: sleeping a flat
+        // DEFAULT_TIMEOUT whenever the device is still busy is what used to dominate update time
+        auto poll_interval = std::chrono::milliseconds( 1 );
         do {
             dfu_status_payload status;
             uint32_t transferred = 0;
@@ -102,8 +106,8 @@ namespace librealsense
                 return false;
             }
 
-            // FW doesn't set the bwPollTimeout value, therefore it is wrong to use status.bwPollTimeout
-            std::this_thread::sleep_for(std::chrono::milliseconds(DEFAULT_TIMEOUT));
+            std::this_thread::sleep_for( poll_interval );
+            poll_interval = std::min( poll_interval * 2, std::chrono::milliseconds( DEFAULT_TIMEOUT ) );
 
             auto curr = std::chrono::system_clock::now();
             elapsed_milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(curr - start);
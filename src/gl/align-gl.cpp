@@ -269,6 +269,9 @@ align_gl::align_gl(rs2_stream to_stream) : align(to_stream, "Align (GLSL)")
         0, 1, 0, 1, &_enabled, "GLSL enabled"); 
     register_option(RS2_OPTION_COUNT, opt);
 
+    // The shaders cover the whole frame in about the time of its upload, so there is no region of interest
+    processing_roi::unregister_options(*this);
+
     initialize();
 }
 
@@ -350,6 +350,8 @@ namespace librealsense
 
                     glBindTexture(GL_TEXTURE_2D, 0);
 
+                    gf->get_gpu_section().begin_fetch();
+
                     if (!f.is<rs2::gl::gpu_frame>())
                     {
                         if (_equalize)
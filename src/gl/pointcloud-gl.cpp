@@ -411,6 +411,9 @@ pointcloud_gl::pointcloud_gl()
         0, 1, 0, 1, &_enabled, "GLSL enabled"); 
     register_option(RS2_OPTION_COUNT, opt);
 
+    // The shaders cover the whole frame in about the time of its upload, so there is no region of interest
+    processing_roi::unregister_options(*this);
+
     initialize();
 }
 
@@ -13,8 +13,15 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+#ifdef RS2_GL_HEADLESS
+#define EGL_NO_X11  // keep the X11 headers (and their macros) out
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
 #include <iostream>
 #include <future>
+#include <algorithm>
 
 namespace librealsense
 {
@@ -46,6 +53,69 @@ namespace librealsense
             throw std::runtime_error("Selected RealSense format cannot be converted to GL format!");
         }
 
+        upload_pbo::upload_pbo(int count)
+            : _ids(count, 0), _fences(count, nullptr), _sizes(count, 0)
+        {
+        }
+
+        void upload_pbo::tex_image(uint32_t internal_format, int width, int height, uint32_t format, uint32_t type,
+            const void* data, size_t size)
+        {
+            if (!_ids[0])
+                glGenBuffers((GLsizei)_ids.size(), _ids.data());
+
+            auto i = _index;
+            _index = (_index + 1) % _ids.size();
+
+            // Uploaded from _ids.size() frames ago, so normally long done
+            if (_fences[i])
+            {
+                glClientWaitSync(_fences[i], GL_SYNC_FLUSH_COMMANDS_BIT, sync_timeout_ns);
+                glDeleteSync(_fences[i]);
+                _fences[i] = nullptr;
+            }
+
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _ids[i]);
+            if (_sizes[i] != size)
+            {
+                glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+                _sizes[i] = size;
+            }
+
+            // The fence says the GPU is done with the buffer, so there is nothing to synchronize with
+            auto dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size,
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+            if (dst)
+            {
+                memcpy(dst, data, size);
+                if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE)
+                {
+                    glTexImage2D(GL_TEXTURE_2D, 0, internal_format, width, height, 0, format, type, nullptr);
+                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                    _fences[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                    return;
+                }
+            }
+
+            // Could not map (or the content was lost): upload from client memory, as without the buffers
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            glTexImage2D(GL_TEXTURE_2D, 0, internal_format, width, height, 0, format, type, data);
+        }
+
+        void upload_pbo::reset()
+        {
+            for (auto&& fence : _fences)
+            {
+                if (fence) glDeleteSync(fence);
+                fence = nullptr;
+            }
+            if (_ids[0])
+                glDeleteBuffers((GLsizei)_ids.size(), _ids.data());
+            std::fill(_ids.begin(), _ids.end(), 0);
+            std::fill(_sizes.begin(), _sizes.end(), 0);
+            _index = 0;
+        }
+
         void gpu_section::ensure_init()
         {
             if (!initialized)
@@ -126,15 +196,30 @@ namespace librealsense
         }
 
         void processing_lane::init(GLFWwindow* share_with, glfw_binding binding, bool use_glsl)
+        {
+            init([&]() { return std::make_shared<context>(share_with, binding); }, use_glsl);
+        }
+
+        void processing_lane::init_headless(bool use_glsl)
+        {
+#ifdef RS2_GL_HEADLESS
+            init([]() { return std::make_shared<context>(); }, use_glsl);
+#else
+            throw std::runtime_error("Headless GL processing is not available: librealsense was built without BUILD_GL_HEADLESS");
+#endif
+        }
+
+        void processing_lane::init(std::function<std::shared_ptr<context>()> create_context, bool use_glsl)
         {
             std::lock_guard<std::mutex> lock(_data.mutex);
 
             LOG_DEBUG("Initializing processing, GLSL=" << use_glsl);
 
+            // Created first, so a failure leaves the GL blocks on their CPU fallbacks
+            _ctx = create_context();
             _data.active = true;
             _data.use_glsl = use_glsl;
 
-            _ctx = std::make_shared<context>(share_with, binding);
             auto session = _ctx->begin_session();
 
             for (auto&& obj : _data.objs)
@@ -173,6 +258,18 @@ namespace librealsense
                 backup = std::unique_ptr<uint8_t[]>(new uint8_t[get_frame_size()]);
                 fetch_frame(backup.get());
             }
+            fetch_pending = false;
+            if (readback_fence)
+            {
+                glDeleteSync(readback_fence);
+                readback_fence = nullptr;
+            }
+            if (readback_pbo)
+            {
+                glDeleteBuffers(1, &readback_pbo);
+                readback_pbo = 0;
+                readback_size = 0;
+            }
             for (int i = 0; i < MAX_TEXTURES; i++)
             {
                 if (textures[i])
@@ -224,6 +321,11 @@ namespace librealsense
         void gpu_section::on_publish()
         {
             ensure_init();
+            // The frame is being reused: a readback still pending holds the previous content. The fence is left for
+            // begin_fetch() or cleanup to delete, since there may be no GL context here.
+            fetch_pending = false;
+            prefetch = fetched;
+            fetched = false;
             for (int i = 0; i < MAX_TEXTURES; i++)
             {
                 loaded[i] = false;
@@ -280,6 +382,99 @@ namespace librealsense
             return res;
         }
 
+        void gpu_section::read_textures(void* to)
+        {
+            // 'to' is an offset into the bound GL_PIXEL_PACK_BUFFER when there is one
+            auto offset = reinterpret_cast<uintptr_t>(to);
+
+            for (int i = 0; i < MAX_TEXTURES; i++)
+            if (textures[i] && loaded[i])
+            {
+                auto& vis = get_texture_visualizer();
+                //rs2::visualizer_2d vis;
+                rs2::fbo fbo(width, height);
+                uint32_t res;
+                glGenTextures(1, &res);
+                glBindTexture(GL_TEXTURE_2D, res);
+
+                auto textype = gl_format_mapping(types[i]);
+                if (textype.size)
+                    glTexImage2D(GL_TEXTURE_2D, 0, textype.internal_format, 
+                        width, height, 0, textype.gl_format, textype.data_type, nullptr);
+
+                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, res, 0);
+
+                fbo.bind();
+                glViewport(0, 0, width, height);
+                glClearColor(0, 0, 0, 1);
+                glClear(GL_COLOR_BUFFER_BIT);
+                vis.draw_texture(textures[i]);
+                glReadBuffer(GL_COLOR_ATTACHMENT0);
+
+                if (textype.size)
+                {
+                    glReadPixels(0, 0, width, height, textype.gl_format, textype.data_type,
+                        reinterpret_cast<void*>(offset));
+                    offset += width * height * textype.size;
+                }
+                
+                glDeleteTextures(1, &res);
+                
+                fbo.unbind();
+            }
+        }
+
+        void gpu_section::begin_fetch()
+        {
+            // Only worth the bandwidth if the last frame in this section was read back as well
+            if (preloaded || !prefetch) return;
+
+            ensure_init();
+
+            size_t size = get_frame_size();
+            if (!size) return;
+
+            if (!readback_pbo)
+                glGenBuffers(1, &readback_pbo);
+            if (readback_fence)
+            {
+                glDeleteSync(readback_fence);
+                readback_fence = nullptr;
+            }
+
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readback_pbo);
+            if (readback_size != size)
+            {
+                glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+                readback_size = size;
+            }
+            read_textures(nullptr);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+            readback_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            fetch_pending = readback_fence != nullptr;
+        }
+
+        bool gpu_section::finish_fetch(void* to)
+        {
+            if (!fetch_pending) return false;
+            fetch_pending = false;
+
+            glClientWaitSync(readback_fence, GL_SYNC_FLUSH_COMMANDS_BIT, sync_timeout_ns);
+            glDeleteSync(readback_fence);
+            readback_fence = nullptr;
+
+            bool done = false;
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readback_pbo);
+            if (auto data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, readback_size, GL_MAP_READ_BIT))
+            {
+                memcpy(to, data, readback_size);
+                done = glUnmapBuffer(GL_PIXEL_PACK_BUFFER) == GL_TRUE;
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            return done;
+        }
+
         void gpu_section::fetch_frame(void* to)
         {
             if (preloaded) return;
@@ -292,45 +487,12 @@ namespace librealsense
 
             if (need_to_fetch)
             {
+                fetched = true;
                 perform_gl_action([&]{
-                    auto ptr = (uint8_t*)to;
-
-                    for (int i = 0; i < MAX_TEXTURES; i++)
-                    if (textures[i] && loaded[i])
-                    {
-                        auto& vis = get_texture_visualizer();
-                        //rs2::visualizer_2d vis;
-                        rs2::fbo fbo(width, height);
-                        uint32_t res;
-                        glGenTextures(1, &res);
-                        glBindTexture(GL_TEXTURE_2D, res);
-
-                        auto textype = gl_format_mapping(types[i]);
-                        if (textype.size)
-                            glTexImage2D(GL_TEXTURE_2D, 0, textype.internal_format, 
-                                width, height, 0, textype.gl_format, textype.data_type, nullptr);
-
-                        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, res, 0);
-
-                        fbo.bind();
-                        glViewport(0, 0, width, height);
-                        glClearColor(0, 0, 0, 1);
-                        glClear(GL_COLOR_BUFFER_BIT);
-                        vis.draw_texture(textures[i]);
-                        glReadBuffer(GL_COLOR_ATTACHMENT0);
-
-                        if (textype.size)
-                        {
-                            glReadPixels(0, 0, width, height, textype.gl_format, textype.data_type, ptr);
-                            ptr += width * height * textype.size;
-                        }
-                        
-                        glDeleteTextures(1, &res);
-                        
-                        fbo.unbind();
-
-                        preloaded = true;
-                    }
+                    // A readback started by begin_fetch() is normally complete by now; otherwise read synchronously
+                    if (!finish_fetch(to))
+                        read_textures(to);
+                    preloaded = true;
                 }, [&]{
                     memcpy(to, backup.get(), get_frame_size());
                 });
@@ -363,8 +525,111 @@ namespace librealsense
             binding.glfwMakeContextCurrent(curr);
         }
 
+#ifdef RS2_GL_HEADLESS
+        // Prefer a GPU device of its own (EGL_EXT_platform_device), which works without any display server
+        static EGLDisplay get_headless_display()
+        {
+            auto query_devices = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+            auto get_platform_display = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+            if (query_devices && get_platform_display)
+            {
+                EGLDeviceEXT devices[8];
+                EGLint count = 0;
+                if (query_devices(8, devices, &count))
+                {
+                    for (EGLint i = 0; i < count; i++)
+                    {
+                        auto display = get_platform_display(EGL_PLATFORM_DEVICE_EXT, devices[i], nullptr);
+                        if (display != EGL_NO_DISPLAY && eglInitialize(display, nullptr, nullptr))
+                            return display;
+                    }
+                }
+            }
+
+            auto display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+            if (display != EGL_NO_DISPLAY && eglInitialize(display, nullptr, nullptr))
+                return display;
+            return EGL_NO_DISPLAY;
+        }
+
+        context::context()
+        {
+            auto display = get_headless_display();
+            if (display == EGL_NO_DISPLAY)
+                throw std::runtime_error("Could not initialize EGL display for headless context!");
+            _egl_display = display;
+
+            if (!eglBindAPI(EGL_OPENGL_API))
+                throw std::runtime_error("EGL does not support desktop OpenGL!");
+
+            const EGLint config_attribs[] = {
+                EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+                EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+                EGL_NONE
+            };
+            EGLConfig config;
+            EGLint configs = 0;
+            if (!eglChooseConfig(display, config_attribs, &config, 1, &configs) || configs < 1)
+                throw std::runtime_error("Could not find an EGL configuration for headless context!");
+
+            // Blocks render into their own framebuffers; the surface only has to exist
+            const EGLint pbuffer_attribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+            _egl_surface = eglCreatePbufferSurface(display, config, pbuffer_attribs);
+            if (_egl_surface == EGL_NO_SURFACE)
+                throw std::runtime_error("Could not create EGL surface for headless context!");
+
+            _egl_context = eglCreateContext(display, config, EGL_NO_CONTEXT, nullptr);
+            if (_egl_context == EGL_NO_CONTEXT)
+            {
+                eglDestroySurface(display, _egl_surface);
+                throw std::runtime_error("Could not create EGL headless context!");
+            }
+
+            auto curr_context = eglGetCurrentContext();
+            auto curr_draw = eglGetCurrentSurface(EGL_DRAW);
+            auto curr_read = eglGetCurrentSurface(EGL_READ);
+            auto curr_display = eglGetCurrentDisplay();
+            eglMakeCurrent(display, _egl_surface, _egl_surface, _egl_context);
+
+            if (glShaderSource == nullptr)
+            {
+                gladLoadGLLoader((GLADloadproc)eglGetProcAddress);
+            }
+
+            _vis = std::make_shared<rs2::visualizer_2d>();
+
+            if (curr_display != EGL_NO_DISPLAY)
+                eglMakeCurrent(curr_display, curr_draw, curr_read, curr_context);
+            else
+                eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        }
+#endif
+
         std::shared_ptr<void> context::begin_session()
         {
+#ifdef RS2_GL_HEADLESS
+            if (_egl_context)
+            {
+                auto curr_context = eglGetCurrentContext();
+                if (curr_context == _egl_context) return nullptr;
+
+                _lock.lock();
+
+                auto curr_draw = eglGetCurrentSurface(EGL_DRAW);
+                auto curr_read = eglGetCurrentSurface(EGL_READ);
+                auto curr_display = eglGetCurrentDisplay();
+                eglMakeCurrent(_egl_display, _egl_surface, _egl_surface, _egl_context);
+                auto me = shared_from_this();
+                return std::shared_ptr<void>(nullptr, [curr_display, curr_draw, curr_read, curr_context, me](void*){
+                    if (curr_display != EGL_NO_DISPLAY)
+                        eglMakeCurrent(curr_display, curr_draw, curr_read, curr_context);
+                    else
+                        eglMakeCurrent(me->_egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+                    me->_lock.unlock();
+                });
+            }
+#endif
             auto curr = _binding.glfwGetCurrentContext();
             if (curr == _ctx) return nullptr;
 
@@ -380,6 +645,18 @@ namespace librealsense
 
         context::~context()
         {
+#ifdef RS2_GL_HEADLESS
+            if (_egl_context)
+            {
+                // Not through begin_session(): shared_from_this() is no longer available
+                eglMakeCurrent(_egl_display, _egl_surface, _egl_surface, _egl_context);
+                _vis.reset();
+                eglMakeCurrent(_egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+                eglDestroyContext(_egl_display, _egl_context);
+                eglDestroySurface(_egl_display, _egl_surface);
+                return;
+            }
+#endif
             _vis.reset();
             _binding.glfwDestroyWindow(_ctx);
         }
@@ -18,6 +18,7 @@
 #include <thread>
 #include <deque>
 #include <unordered_set>
+#include <vector>
 
 
 #define RS2_EXTENSION_VIDEO_FRAME_GL (rs2_extension)(RS2_EXTENSION_COUNT)
@@ -113,6 +114,31 @@ namespace librealsense
             int index = 0;
         };
 
+        // How long to wait on a fence of the buffers below before going ahead anyway, in nanoseconds
+        const uint64_t sync_timeout_ns = 1000000000ull;
+
+        // A ring of pixel unpack buffers for texture uploads: copying a frame into a buffer does not wait on the GPU,
+        // and the transfer into the texture happens while the frames before it are still being processed. A buffer is
+        // written again only once the fence of its last upload has signaled, 'count' uploads later.
+        class upload_pbo
+        {
+        public:
+            explicit upload_pbo(int count = 3);
+
+            // Same as glTexImage2D() of 'size' bytes at 'data' into the texture bound to GL_TEXTURE_2D
+            void tex_image(uint32_t internal_format, int width, int height, uint32_t format, uint32_t type,
+                const void* data, size_t size);
+
+            // Release the buffers; they are created again on the next upload
+            void reset();
+
+        private:
+            std::vector<uint32_t> _ids;
+            std::vector<GLsync> _fences;
+            std::vector<size_t> _sizes;
+            size_t _index = 0;
+        };
+
         texture_mapping& rs_format_to_gl_format(rs2_format type);
 
         class gpu_object;
@@ -123,6 +149,11 @@ namespace librealsense
         {
         public:
             context(GLFWwindow* share_with, glfw_binding binding);
+#ifdef RS2_GL_HEADLESS
+            // Headless context, on an EGL pbuffer: needs neither a window system nor GLFW. Textures cannot be shared
+            // with the application's own contexts.
+            context();
+#endif
 
             std::shared_ptr<void> begin_session();
 
@@ -132,8 +163,15 @@ namespace librealsense
 
         private:
             std::shared_ptr<rs2::visualizer_2d> _vis;
-            GLFWwindow* _ctx;
-            glfw_binding _binding;
+            GLFWwindow* _ctx = nullptr;
+            glfw_binding _binding {};
+#ifdef RS2_GL_HEADLESS
+            // EGLDisplay, EGLSurface and EGLContext, kept opaque here so EGL (and the window system headers it may
+            // pull in) stays out of this header
+            void* _egl_display = nullptr;
+            void* _egl_surface = nullptr;
+            void* _egl_context = nullptr;
+#endif
             std::recursive_mutex _lock;
         };
 
@@ -216,6 +254,9 @@ namespace librealsense
 
             void init(GLFWwindow* share_with, glfw_binding binding, bool use_glsl);
 
+            // Same, with a headless context of its own; throws if the library was built without RS2_GL_HEADLESS
+            void init_headless(bool use_glsl);
+
             void shutdown();
 
             bool is_active() const { return _data.active; }
@@ -225,6 +266,8 @@ namespace librealsense
             }
             bool glsl_enabled() const { return _data.use_glsl; }
         private:
+            void init(std::function<std::shared_ptr<context>()> create_context, bool use_glsl);
+
             lane _data;
             std::shared_ptr<context> _ctx;
         };
@@ -350,6 +393,10 @@ namespace librealsense
             void on_publish();
             void on_unpublish();
             void fetch_frame(void* to);
+            // Start reading the output textures back into a pixel pack buffer, for fetch_frame() to pick up without
+            // a GPU round-trip; called by the blocks once the textures are rendered. Does nothing unless the last
+            // frame in this section was fetched, so frames that stay on the GPU cost no bandwidth.
+            void begin_fetch();
 
             bool input_texture(int id, uint32_t* tex);
             void output_texture(int id, uint32_t* tex, texture_type type);
@@ -374,7 +421,15 @@ namespace librealsense
             bool preloaded = false;
             bool initialized = false;
             std::unique_ptr<uint8_t[]> backup;
+            uint32_t readback_pbo = 0;
+            size_t readback_size = 0;
+            GLsync readback_fence = nullptr;
+            bool fetch_pending = false;     // readback_pbo holds the content of this frame, once the fence signals
+            bool fetched = false;           // this frame was read back to the CPU
+            bool prefetch = false;          // ... and so was the last one
             void ensure_init();
+            void read_textures(void* to);
+            bool finish_fetch(void* to);
         };
 
         class gpu_addon_interface
@@ -454,6 +509,7 @@ namespace librealsense
                 option_range get_range() const override { return get().get_range(); }
                 bool is_enabled() const override { return get().is_enabled(); }
                 bool is_read_only() const override { return get().is_read_only(); }
+                bool can_set_while_streaming() const override { return get().can_set_while_streaming(); }
                 const char* get_description() const override { return get().get_description(); }
                 const char* get_value_description(float v) const override { return get().get_value_description(v); }
                 void enable_recording(std::function<void(const option &)> record_action) override {}
@@ -514,6 +570,12 @@ namespace librealsense
             {
                 return get().get_source();
             }
+            void stop() override
+            {
+                for (auto&& pb : _blocks) pb->stop();
+                processing_block::stop();
+            }
+            ~dual_processing_block() { stop(); }
         protected:
             std::vector<std::shared_ptr<processing_block>> _blocks;
             int index = 0;
@@ -58,6 +58,7 @@ namespace librealsense
 
         void upload::cleanup_gpu_resources()
         {
+            _pbo.reset();
             _enabled = false;
         }
         void upload::create_gpu_resources()
@@ -89,11 +90,49 @@ namespace librealsense
 
                         gf->get_gpu_section().output_texture(0, &output_yuv, TEXTYPE_UINT16);
                         glBindTexture(GL_TEXTURE_2D, output_yuv);
-                        glTexImage2D(GL_TEXTURE_2D, 0, GL_RG8, width, height, 0, GL_RG, GL_UNSIGNED_BYTE, f.get_data());
+                        _pbo.tex_image(GL_RG8, width, height, GL_RG, GL_UNSIGNED_BYTE, f.get_data(), width * height * 2);
                         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
                         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 
                         gf->get_gpu_section().set_size(width, height);
+                        gf->get_gpu_section().begin_fetch();
+
+                        res = new_f;
+                    }, [&]() {
+                        _enabled = false;
+                    });
+                }
+
+                // Y411 is uploaded the way y411_2rgb reads it: 12 bits a pixel, as RGB texels of half the height.
+                // RGB8 goes up as is, for align and the renderers.
+                auto format = f.get_profile().format();
+                if (format == RS2_FORMAT_Y411 || format == RS2_FORMAT_RGB8)
+                {
+                    auto vf = f.as<rs2::video_frame>();
+                    auto width = vf.get_width();
+                    auto height = vf.get_height();
+                    auto tex_height = format == RS2_FORMAT_Y411 ? height / 2 : height;
+                    auto new_f = source.allocate_video_frame(f.get_profile(), f,
+                        vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_VIDEO_FRAME_GL);
+
+                    if (new_f) perform_gl_action([&]()
+                    {
+                        auto gf = dynamic_cast<gpu_addon_interface*>((frame_interface*)new_f.get());
+                        if (!gf)
+                            throw std::runtime_error("Frame is not gpu_addon_interface, cannot output texture");
+
+                        uint32_t output_rgb;
+
+                        gf->get_gpu_section().output_texture(0, &output_rgb, TEXTYPE_RGB);
+                        glBindTexture(GL_TEXTURE_2D, output_rgb);
+                        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+                        _pbo.tex_image(GL_RGB, width, tex_height, GL_RGB, GL_UNSIGNED_BYTE, f.get_data(),
+                            width * tex_height * 3);
+                        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+                        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+                        gf->get_gpu_section().set_size(width, tex_height);
+                        gf->get_gpu_section().begin_fetch();
 
                         res = new_f;
                     }, [&]() {
@@ -143,7 +182,7 @@ namespace librealsense
                             uint32_t depth_texture;
                             gf->get_gpu_section().output_texture(0, &depth_texture, TEXTYPE_UINT16);
                             glBindTexture(GL_TEXTURE_2D, depth_texture);
-                            glTexImage2D(GL_TEXTURE_2D, 0, GL_RG8, width, height, 0, GL_RG, GL_UNSIGNED_BYTE, f.get_data());
+                            _pbo.tex_image(GL_RG8, width, height, GL_RG, GL_UNSIGNED_BYTE, f.get_data(), width * height * 2);
                             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
                             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 
@@ -40,6 +40,7 @@ namespace librealsense
             int* _hist_data;
             float* _fhist_data;
             bool _enabled = false;
+            upload_pbo _pbo;    // Shared by all the formats: only one of them is uploaded per frame
         };
     }
 }
@@ -227,6 +227,8 @@ rs2::frame y411_2rgb::process_frame(const rs2::frame_source& src, const rs2::fra
 
         glBindTexture(GL_TEXTURE_2D, 0);
 
+        gf->get_gpu_section().begin_fetch();
+
         if (!f.is<rs2::gl::gpu_frame>())
         {
             glDeleteTextures(1, &yuy_texture);
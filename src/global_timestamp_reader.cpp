@@ -115,12 +115,35 @@ namespace librealsense
         }
     }
 
-    double CLinearCoefficients::calc_value(double x) const
+    CLinearCoefficients::conversion CLinearCoefficients::get_conversion() const
     {
-        double a, b;
-        get_a_b(x, a, b);
-        double y(a * (x - _base_sample._x) + b + _base_sample._y);
-        //LOG_DEBUG(__FUNCTION__ << ": " << x << " -> " << y << " with coefs:" << a << ", " << b << ", " << _base_sample._x << ", " << _base_sample._y);
+        return { _base_sample._x, _base_sample._y,
+                 _prev_a, _prev_b, _dest_a, _dest_b,
+                 _prev_time, _time_span_ms,
+                 _last_values.front()._x };
+    }
+
+    double CLinearCoefficients::calc_value(conversion const& c, double x)
+    {
+        // Same as update_samples_base() would do, were the device clock to have wrapped around since the last sample,
+        // but without changing anything
+        static const double max_device_time(pow(2, 32) * TIMESTAMP_USEC_TO_MSEC);
+        if ((c.last_x - x) > max_device_time / 2)
+            x += max_device_time;
+        else if ((x - c.last_x) > max_device_time / 2)
+            x -= max_device_time;
+
+        // As get_a_b()
+        double a = c.dest_a;
+        double b = c.dest_b;
+        if (x - c.prev_time < c.time_span_ms)
+        {
+            double dt((x - c.prev_time) / c.time_span_ms);
+            a = c.dest_a * dt + c.prev_a * (1 - dt);
+            b = c.dest_b * dt + c.prev_b * (1 - dt);
+        }
+        double y(a * (x - c.base_x) + b + c.base_y);
+        //LOG_DEBUG(__FUNCTION__ << ": " << x << " -> " << y << " with coefs:" << a << ", " << b << ", " << c.base_x << ", " << c.base_y);
         return y;
     }
 
@@ -161,10 +184,13 @@ namespace librealsense
         _users_count(0),
         _is_ready(false),
         _min_command_delay(1000),
-        _active_object([this](dispatcher::cancellable_timer cancellable_timer)
-            {
-                polling(cancellable_timer);
-            })
+        _published(published_conversion{ false, {} }),
+        _last_request_time(0),
+        // A wheel of our own, not the shared one: a control transfer stuck on another device must not hold back our
+        // samples, nor ours theirs, since their timing is what the conversion is built on
+        _wheel(std::make_shared< rsutils::concurrency::timer_wheel >(1)),
+        _task(0),
+        _polling_slowly(false)
     {
         //LOG_DEBUG("start new time_diff_keeper ");
     }
@@ -174,7 +200,12 @@ namespace librealsense
         std::lock_guard<std::recursive_mutex> lock(_enable_mtx);
         _users_count++;
         LOG_DEBUG("time_diff_keeper::start: _users_count = " << _users_count);
-        _active_object.start();
+        if (!_task)
+        {
+            // The first sample is taken right away, for frames to get the global time as soon as possible
+            _polling_slowly = false;
+            _task = _wheel->add([this]() { polling(); }, std::chrono::milliseconds(_poll_intervals_ms), false);
+        }
     }
 
     void time_diff_keeper::stop()
@@ -188,15 +219,21 @@ namespace librealsense
         if (_users_count == 0)
         {
             LOG_DEBUG("time_diff_keeper::stop: stop object.");
-            _active_object.stop();
+            _wheel->remove(_task);
+            _task = 0;
+            std::lock_guard<std::recursive_mutex> read_lock(_read_mtx);
             _coefs.reset();
             _is_ready = false;
+            _published.store({ false, {} });
+            _last_request_time = 0;
         }
     }
 
     time_diff_keeper::~time_diff_keeper()
     {
-        _active_object.stop();
+        std::lock_guard<std::recursive_mutex> lock(_enable_mtx);
+        if (_task)
+            _wheel->remove(_task);
     }
 
     bool time_diff_keeper::update_diff_time()
@@ -221,9 +258,12 @@ namespace librealsense
             {
                 _coefs.update_samples_base(sample_hw_time);
             }
+            if (auto last_request_time = _last_request_time.load(std::memory_order_relaxed))
+                _coefs.update_last_sample_time(last_request_time);
             CSample crnt_sample(sample_hw_time, system_time);
             _coefs.add_value(crnt_sample);
             _is_ready = true;
+            _published.store({ true, _coefs.get_conversion() });
             return true;
         }
         catch (const io_exception& ex)
@@ -245,28 +285,27 @@ namespace librealsense
         return false;
     }
 
-    void time_diff_keeper::polling(dispatcher::cancellable_timer cancellable_timer)
+    void time_diff_keeper::polling()
     {
         update_diff_time();
-        unsigned int time_to_sleep = _poll_intervals_ms + _coefs.is_full() * (9 * _poll_intervals_ms);
-        if (!cancellable_timer.try_sleep( std::chrono::milliseconds( time_to_sleep )))
+        // Ten times slower once there are enough samples
+        if (_coefs.is_full() != _polling_slowly)
         {
-            LOG_DEBUG("Notification: time_diff_keeper polling loop is being shut-down");
+            _polling_slowly = !_polling_slowly;
+            _wheel->set_period(_task, std::chrono::milliseconds(_poll_intervals_ms * (_polling_slowly ? 10 : 1)));
         }
     }
 
     double time_diff_keeper::get_system_hw_time(double crnt_hw_time, bool& is_ready)
     {
-        std::lock_guard<std::recursive_mutex> lock(_read_mtx);
-        is_ready = _is_ready;
-        if (_is_ready)
-        {
-            _coefs.update_samples_base(crnt_hw_time);
-            _coefs.update_last_sample_time(crnt_hw_time);
-            return _coefs.calc_value(crnt_hw_time);
-        }
-        else
+        // Called for every frame: no locking, and nothing written but the time of the request (which the polling
+        // thread uses to smooth the change-over to new coefficients)
+        auto const published = _published.load();
+        is_ready = published.is_ready;
+        if (!is_ready)
             return crnt_hw_time;
+        _last_request_time.store(crnt_hw_time, std::memory_order_relaxed);
+        return CLinearCoefficients::calc_value(published.conversion, crnt_hw_time);
     }
 
     global_timestamp_reader::global_timestamp_reader(std::unique_ptr<frame_timestamp_reader> device_timestamp_reader,
@@ -287,7 +326,11 @@ namespace librealsense
         {
             auto sp = _time_diff_keeper.lock();
             if (sp)
-                frame_time = sp->get_system_hw_time(frame_time, _ts_is_ready);
+            {
+                bool is_ready;
+                frame_time = sp->get_system_hw_time(frame_time, is_ready);
+                _ts_is_ready = is_ready;
+            }
             else
                 LOG_DEBUG("Notification: global_timestamp_reader - time_diff_keeper is being shut-down");
         }
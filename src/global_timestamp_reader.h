@@ -6,6 +6,9 @@
 #include "sensor.h"
 #include "error-handling.h"
 #include "option.h"
+#include <rsutils/concurrency/seqlock.h>
+#include <rsutils/concurrency/timer-wheel.h>
+#include <atomic>
 #include <deque>
 
 namespace librealsense
@@ -34,13 +37,23 @@ namespace librealsense
     class CLinearCoefficients
     {
     public:
+        // Everything needed to convert a hardware time, so it can be copied out and used without the samples
+        struct conversion
+        {
+            double base_x, base_y;
+            double prev_a, prev_b, dest_a, dest_b;
+            double prev_time, time_span_ms;
+            double last_x;  // of the latest sample, to detect the device clock wrapping around
+        };
+
         CLinearCoefficients(unsigned int buffer_size);
         void reset();
         void add_value(CSample val);
         void add_const_y_coefs(double dy);
         bool update_samples_base(double x);
         void update_last_sample_time(double x);
-        double calc_value(double x) const;
+        conversion get_conversion() const;  // must have at least one value
+        static double calc_value(conversion const& c, double x);
         bool is_full() const;
 
     private:
@@ -73,19 +86,31 @@ namespace librealsense
 
     private:
         bool update_diff_time();
-        void polling(dispatcher::cancellable_timer cancellable_timer);
+        void polling();
 
     private:
         global_time_interface* _device;
         unsigned int _poll_intervals_ms;
         int             _users_count;
         std::shared_ptr<global_time_option> _option_is_enabled;
-        active_object<> _active_object;
-        mutable std::recursive_mutex _read_mtx; // Watch only 1 reader at a time.
+        std::shared_ptr< rsutils::concurrency::timer_wheel > _wheel;
+        std::atomic< rsutils::concurrency::timer_wheel::task_id > _task;  // 0 when stopped; set under _enable_mtx
+        bool _polling_slowly;  // once the coefficients are full
+        mutable std::recursive_mutex _read_mtx; // Watch only 1 coefficients update at a time.
         mutable std::recursive_mutex _enable_mtx; // Watch only 1 start/stop operation at a time.
         CLinearCoefficients _coefs;
         double _min_command_delay;
         bool _is_ready;
+
+        // The coefficients are published here whenever they change, so frames can be converted without locking or
+        // touching anything the polling thread writes to in between
+        struct published_conversion
+        {
+            bool is_ready;
+            CLinearCoefficients::conversion conversion;
+        };
+        rsutils::concurrency::seqlock< published_conversion > _published;
+        std::atomic< double > _last_request_time;  // by the frames; 0 if none since we started
     };
 
     class global_timestamp_reader : public frame_timestamp_reader
@@ -103,9 +128,8 @@ namespace librealsense
     private:
         std::unique_ptr<frame_timestamp_reader> _device_timestamp_reader;
         std::weak_ptr<time_diff_keeper> _time_diff_keeper;
-        mutable std::recursive_mutex _mtx;
         std::shared_ptr<global_time_option> _option_is_enabled;
-        bool _ts_is_ready;
+        std::atomic< bool > _ts_is_ready;
     };
 
     class global_time_interface
@@ -83,57 +83,52 @@ namespace librealsense
     {
         // parsing subpreset pattern, considering:
         // SubPresetHeader::iterations always equals 0 (continuous subpreset)
-        // SubPresetHeader::numOfItems always equals 2 - for gain and exposure
+        // SubPresetHeader::numOfItems is the sequence size, 2 to MAX_HDR_SEQUENCE_SIZE
+        // SubPresetItemHeader::numOfControls always equals 2 - for gain and exposure
         // SubPresetItemHeader::iterations always equals 1 - only one frame on each sequence ID in the sequence
         const int size_of_subpreset_header = 5;
         const int size_of_subpreset_item_header = 4;
         const int size_of_control_id = 1;
         const int size_of_control_value = 4;
 
-        int subpreset_size = size_of_subpreset_header + 2 * (size_of_subpreset_item_header +
+        if (current_subpreset.size() < size_of_subpreset_header)
+            return false;
+        int sequence_size = current_subpreset[4];
+        if (sequence_size < 2 || sequence_size > MAX_HDR_SEQUENCE_SIZE)
+            return false;
+
+        int subpreset_size = size_of_subpreset_header + sequence_size * (size_of_subpreset_item_header +
             2 * (size_of_control_id + size_of_control_value));
 
         if (current_subpreset.size() != subpreset_size)
             return false;
 
+        std::vector<hdr_params> params(sequence_size);
         int offset = 0;
         offset += size_of_subpreset_header;
-        offset += size_of_subpreset_item_header;
-
-        if (current_subpreset[offset] != CONTROL_ID_EXPOSURE)
-            return false;
-        offset += size_of_control_id;
-        float exposure_0
-            = (float)*reinterpret_cast< const uint32_t * >( &( current_subpreset[offset] ) );
-        offset += size_of_control_value;
-
-        if (current_subpreset[offset] != CONTROL_ID_GAIN)
-            return false;
-        offset += size_of_control_id;
-        float gain_0
-            = (float)*reinterpret_cast< const uint32_t * >( &( current_subpreset[offset] ) );
-        offset += size_of_control_value;
-
-        offset += size_of_subpreset_item_header;
-
-        if (current_subpreset[offset] != CONTROL_ID_EXPOSURE)
-            return false;
-        offset += size_of_control_id;
-        float exposure_1
-            = (float)*reinterpret_cast< const uint32_t * >( &( current_subpreset[offset] ) );
-        offset += size_of_control_value;
-
-        if (current_subpreset[offset] != CONTROL_ID_GAIN)
-            return false;
-        offset += size_of_control_id;
-        float gain_1
-            = (float)*reinterpret_cast< const uint32_t * >( &( current_subpreset[offset] ) );
-        offset += size_of_control_value;
+        for (int i = 0; i < sequence_size; ++i)
+        {
+            offset += size_of_subpreset_item_header;
+
+            if (current_subpreset[offset] != CONTROL_ID_EXPOSURE)
+                return false;
+            offset += size_of_control_id;
+            float exposure
+                = (float)*reinterpret_cast< const uint32_t * >( &( current_subpreset[offset] ) );
+            offset += size_of_control_value;
+
+            if (current_subpreset[offset] != CONTROL_ID_GAIN)
+                return false;
+            offset += size_of_control_id;
+            float gain
+                = (float)*reinterpret_cast< const uint32_t * >( &( current_subpreset[offset] ) );
+            offset += size_of_control_value;
+
+            params[i] = hdr_params(i, exposure, gain);
+        }
 
-        _hdr_sequence_params[0]._exposure = exposure_0;
-        _hdr_sequence_params[0]._gain = gain_0;
-        _hdr_sequence_params[1]._exposure = exposure_1;
-        _hdr_sequence_params[1]._gain = gain_1;
+        _hdr_sequence_params = params;
+        _sequence_size = sequence_size;
 
         return true;
     }
@@ -485,15 +480,22 @@ namespace librealsense
     void hdr_config::set_sequence_size(float value)
     {
         size_t new_size = static_cast<size_t>(value);
-        if (new_size > 3 || new_size < 2)
+        if (new_size > MAX_HDR_SEQUENCE_SIZE || new_size < 2)
             throw invalid_value_exception(
                 rsutils::string::from()
-                << "hdr_config::set_sequence_size(...) failed! Only size 2 or 3 are supported." );
+                << "hdr_config::set_sequence_size(...) failed! Only sizes 2 to " << MAX_HDR_SEQUENCE_SIZE
+                << " are supported." );
 
         if (new_size != _sequence_size)
         {
-            _hdr_sequence_params.resize(new_size);
+            // Sub-presets added to the sequence start as copies of its last, until they are configured
+            auto const last = _hdr_sequence_params.back();
+            _hdr_sequence_params.resize(new_size, last);
+            for (size_t i = 0; i < new_size; ++i)
+                _hdr_sequence_params[i]._sequence_id = int(i);
             _sequence_size = new_size;
+            if (_current_hdr_sequence_index >= int(new_size))
+                _current_hdr_sequence_index = DEFAULT_CURRENT_HDR_SEQUENCE_INDEX;
         }
     }
 
@@ -52,6 +52,7 @@ namespace librealsense
         const int DEFAULT_HDR_ID = 0;
         const int DEFAULT_CURRENT_HDR_SEQUENCE_INDEX = -1;
         const int DEFAULT_HDR_SEQUENCE_SIZE = 2;
+        const int MAX_HDR_SEQUENCE_SIZE = 4;
 
         // exposure value has been set to fit the 30 fps (default fps)
         const float PRE_ENABLE_HDR_EXPOSURE = 30000.f;
@@ -2,9 +2,13 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 #include "hw-monitor.h"
 #include "types.h"
+#include <rsutils/concurrency/thread-policy.h>
+#include <condition_variable>
+#include <deque>
 #include <iomanip>
 #include <limits>
 #include <sstream>
+#include <thread>
 
 
 static inline uint32_t pack( uint8_t c0, uint8_t c1, uint8_t c2, uint8_t c3 )
@@ -137,6 +141,87 @@ namespace librealsense
         update_cmd_details(details, receivedCmdLen, outputBuffer);
     }
 
+    struct hw_monitor::async_queue
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque< std::pair< command, std::promise< std::vector< uint8_t > > > > commands;
+        bool stopping = false;
+        std::thread th;
+    };
+
+    hw_monitor::~hw_monitor()
+    {
+        if( ! _async )
+            return;
+        {
+            std::lock_guard< std::mutex > lock( _async->mutex );
+            _async->stopping = true;
+        }
+        _async->cv.notify_all();
+        _async->th.join();
+    }
+
+    std::future< std::vector< uint8_t > > hw_monitor::send_async( command cmd ) const
+    {
+        std::lock_guard< std::mutex > lock( _async_mutex );
+        if( ! _async )
+        {
+            auto q = std::make_shared< async_queue >();
+            q->th = std::thread( [this, q = q.get()]()
+            {
+                rsutils::concurrency::apply_thread_policy( nullptr );
+                std::unique_lock< std::mutex > lock( q->mutex );
+                while( true )
+                {
+                    q->cv.wait( lock, [q] { return q->stopping || ! q->commands.empty(); } );
+                    if( q->stopping )
+                        return;
+                    auto batch = std::move( q->commands );
+                    q->commands.clear();
+                    lock.unlock();
+
+                    size_t sent = 0;
+                    try
+                    {
+                        invoke_powered( [&]()
+                        {
+                            for( ; sent < batch.size(); ++sent )
+                            {
+                                auto & c = batch[sent];
+                                try
+                                {
+                                    c.second.set_value( send( c.first ) );
+                                }
+                                catch( ... )
+                                {
+                                    c.second.set_exception( std::current_exception() );
+                                }
+                            }
+                        } );
+                    }
+                    catch( ... )
+                    {
+                        // Could not power up the device
+                        for( ; sent < batch.size(); ++sent )
+                            batch[sent].second.set_exception( std::current_exception() );
+                    }
+                    lock.lock();
+                }
+            } );
+            _async = std::move( q );
+        }
+
+        std::promise< std::vector< uint8_t > > promise;
+        auto future = promise.get_future();
+        {
+            std::lock_guard< std::mutex > qlock( _async->mutex );
+            _async->commands.emplace_back( std::move( cmd ), std::move( promise ) );
+        }
+        _async->cv.notify_one();
+        return future;
+    }
+
     std::vector< uint8_t > hw_monitor::send( std::vector< uint8_t > const & data ) const
     {
         return _locked_transfer->send_receive( data.data(), data.size() );
@@ -6,8 +6,10 @@
 #include "uvc-sensor.h"
 #include <mutex>
 #include "platform/command-transfer.h"
+#include "small-heap.h"
 #include <string>
 #include <algorithm>
+#include <future>
 #include <vector>
 
 
@@ -226,6 +228,17 @@ namespace librealsense
                 });
         }
 
+        // Runs 'action' with the device powered throughout, so that the send_receive() calls it makes do not each
+        // power it up and down again. Other threads' commands may still go in between.
+        template< class T >
+        auto invoke_powered( T action ) -> decltype( action() )
+        {
+            auto strong_uvc = _uvc_sensor_base.lock();
+            if( ! strong_uvc )
+                return action();
+            return strong_uvc->invoke_powered( [&]( platform::uvc_device & ) { return action(); } );
+        }
+
         ~locked_transfer()
         {
             try
@@ -291,10 +304,16 @@ namespace librealsense
 
         static const size_t size_of_command_without_data = 24U;
 
+    private:
+        struct async_queue;
+        mutable std::mutex _async_mutex;
+        mutable std::shared_ptr< async_queue > _async;  // started by the first send_async()
+
     public:
         explicit hw_monitor(std::shared_ptr<locked_transfer> locked_transfer)
             : _locked_transfer(std::move(locked_transfer))
         {}
+        virtual ~hw_monitor();
 
         static void fill_usb_buffer( int opCodeNumber,
                                       int p1,
@@ -310,6 +329,19 @@ namespace librealsense
 
         virtual std::vector<uint8_t> send( std::vector<uint8_t> const & data ) const;
         virtual std::vector<uint8_t> send( command const & cmd, hwmon_response * = nullptr, bool locked_transfer = false ) const;
+
+        // Queues the command, to be sent from a thread of the monitor's instead of the caller's. Commands queued
+        // meanwhile are then sent back-to-back, with the device powered up once for all of them. The future gets
+        // what send() would have returned, or thrown. Commands not yet sent when the monitor is destroyed are
+        // abandoned (std::future_error) -- but do not destroy it while one is being sent.
+        std::future< std::vector< uint8_t > > send_async( command cmd ) const;
+
+        // Runs 'action' with the device powered throughout: see locked_transfer::invoke_powered()
+        template< class T >
+        auto invoke_powered( T action ) const -> decltype( action() )
+        {
+            return _locked_transfer->invoke_powered( std::move( action ) );
+        }
         static std::vector<uint8_t> build_command(uint32_t opcode,
             uint32_t param1 = 0,
             uint32_t param2 = 0,
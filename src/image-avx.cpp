@@ -272,6 +272,30 @@
         {
             unpack_yuy2<RS2_FORMAT_BGRA8>(d, s, n);
         }
+
+        // Each 5-byte block holds the 8 MSBs of 4 pixels, then their 2 LSBs. Two blocks fit in each 128-bit lane: a byte
+        // shuffle puts each pixel's MSBs in the high byte of its word and the LSBs byte in the low one, and the low byte is
+        // then shifted left (by multiplying) to bring the pixel's own 2 LSBs to bits 6-7.
+        int unpack_y10bpack_avx( uint16_t * d, const uint8_t * s, int blocks )
+        {
+            const __m256i shuffle = _mm256_setr_epi8(4, 0, 4, 1, 4, 2, 4, 3, 9, 5, 9, 6, 9, 7, 9, 8,
+                                                     4, 0, 4, 1, 4, 2, 4, 3, 9, 5, 9, 6, 9, 7, 9, 8);
+            const __m256i lsb_shift = _mm256_setr_epi16(64, 16, 4, 1, 64, 16, 4, 1, 64, 16, 4, 1, 64, 16, 4, 1);
+            const __m256i msb_mask = _mm256_set1_epi16(short(0xFF00));
+            const __m256i lsb_mask = _mm256_set1_epi16(0x00C0);
+
+            // 4 blocks per step; each load reads 6 bytes past its 2 blocks, hence the margin
+            int i = 0;
+            for (; i + 6 <= blocks; i += 4, s += 20, d += 16)
+            {
+                __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)s)),
+                                                    _mm_loadu_si128((const __m128i *)(s + 10)), 1);
+                v = _mm256_shuffle_epi8(v, shuffle);
+                __m256i lsb = _mm256_and_si256(_mm256_mullo_epi16(v, lsb_shift), lsb_mask);
+                _mm256_storeu_si256((__m256i *)d, _mm256_or_si256(_mm256_and_si256(v, msb_mask), lsb));
+            }
+            return i;
+        }
     }
 
     #pragma pack(pop)
@@ -10,13 +10,18 @@
 namespace librealsense
 {
 #ifndef ANDROID
-    #if defined(__SSSE3__) && defined(__AVX2__)
+    // image-avx.cpp is built with AVX2 enabled (RS2_AVX2_KERNELS) even when the rest of the library is not; callers
+    // must check get_simd_level() before using these
+    #if defined(__SSSE3__) && (defined(__AVX2__) || defined(RS2_AVX2_KERNELS))
+    #define RS2_AVX2_UNPACK
     void unpack_yuy2_avx_y8(uint8_t * const d[], const uint8_t * s, int n);
     void unpack_yuy2_avx_y16(uint8_t * const d[], const uint8_t * s, int n);
     void unpack_yuy2_avx_rgb8(uint8_t * const d[], const uint8_t * s, int n);
     void unpack_yuy2_avx_rgba8(uint8_t * const d[], const uint8_t * s, int n);
     void unpack_yuy2_avx_bgr8(uint8_t * const d[], const uint8_t * s, int n);
     void unpack_yuy2_avx_bgra8(uint8_t * const d[], const uint8_t * s, int n);
+    // W10 into Y10BPACK; returns how many of the 5-byte blocks were unpacked, leaving the last few to the caller
+    int unpack_y10bpack_avx(uint16_t * d, const uint8_t * s, int blocks);
     #endif
 #endif
 }
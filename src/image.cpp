@@ -26,6 +26,7 @@ namespace librealsense
         case RS2_FORMAT_DISPARITY16: return 16;
         case RS2_FORMAT_DISPARITY32: return 32;
         case RS2_FORMAT_XYZ32F: return 12 * 8;
+        case RS2_FORMAT_XYZ16: return 6 * 8;
         case RS2_FORMAT_YUYV:  return 16;
         case RS2_FORMAT_M420:  return 12; // 16 pixels are represented with 24 bytes (16 of Y and 8 of Cr, Cb) - 24 / 16 * 8 = 12
         case RS2_FORMAT_RGB8: return 24;
@@ -42,6 +43,7 @@ namespace librealsense
         case RS2_FORMAT_GPIO_RAW: return 1;
         case RS2_FORMAT_MOTION_RAW: return 1;
         case RS2_FORMAT_MOTION_XYZ32F: return 1;
+        case RS2_FORMAT_MOTION_BATCH: return 1;
         case RS2_FORMAT_6DOF: return 1;
         case RS2_FORMAT_MJPEG: return 8;
         case RS2_FORMAT_Y8I: return 16;
@@ -4,22 +4,95 @@
 
 #include "types.h"
 
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 namespace librealsense
 {
     size_t           get_image_size                 (int width, int height, rs2_format format);
     int              get_image_bpp                  (rs2_format format);
 
-    template<class SOURCE, class SPLIT_A, class SPLIT_B> void split_frame( uint8_t * const dest[], int count, const SOURCE * source, SPLIT_A split_a, SPLIT_B split_b)
+    // Calls unpack( w, h ) with the frame dimensions. When built with RS2_FIXED_RESOLUTION_UNPACK
+    // (BUILD_FIXED_RESOLUTION_UNPACKERS), the most common stream resolutions are passed as std::integral_constant<int>
+    // instead, so the unpacker gets a copy compiled for each with constant loop bounds; others get plain ints.
+    template<class UNPACK> void with_resolution( int width, int height, UNPACK && unpack )
+    {
+#ifdef RS2_FIXED_RESOLUTION_UNPACK
+        typedef std::integral_constant< int, 480 > h480;
+        if( width == 848 && height == 480 )
+            return unpack( std::integral_constant< int, 848 >(), h480() );
+        if( width == 1280 && height == 720 )
+            return unpack( std::integral_constant< int, 1280 >(), std::integral_constant< int, 720 >() );
+        if( width == 640 && height == 480 )
+            return unpack( std::integral_constant< int, 640 >(), h480() );
+#endif
+        unpack( width, height );
+    }
+
+    // width * height, kept a compile-time constant for with_resolution()'s fixed resolutions
+    inline int pixel_count( int width, int height ) { return width * height; }
+    template<int W, int H> std::integral_constant<int, W * H> pixel_count( std::integral_constant<int, W>, std::integral_constant<int, H> ) { return {}; }
+
+    // COUNT is an int, or a std::integral_constant<int> from pixel_count()
+    template<class SOURCE, class SPLIT_A, class SPLIT_B, class COUNT> void split_frame( uint8_t * const dest[], COUNT count, const SOURCE * source, SPLIT_A split_a, SPLIT_B split_b)
     {
         if (dest)
         {
             auto a = reinterpret_cast<decltype(split_a(SOURCE()))*>(dest[0]);
             auto b = reinterpret_cast<decltype(split_b(SOURCE()))*>(dest[1]);
-            for (int i = 0; i < count; ++i)
+            for (int i = 0; i < int(count); ++i)
             {
                 *a++ = split_a(*source);
                 *b++ = split_b(*source++);
             }
         }
     }
+
+    // split_frame() and a decimation of both halves in a single pass over the source: each output pixel is the mean of
+    // a factor x factor block of split pixels, as the decimation filter computes it for Y8/Y16. The outputs are
+    // out_width x out_height (see interleaved_functional_processing_block::decimated_size); the padding past the last
+    // whole block is zeroed.
+    template<class SOURCE, class SPLIT_A, class SPLIT_B> void split_frame_decimated( uint8_t * const dest[], int width, int height, int factor,
+        int out_width, int out_height, const SOURCE * source, SPLIT_A split_a, SPLIT_B split_b)
+    {
+        typedef decltype(split_a(SOURCE())) A;
+        typedef decltype(split_b(SOURCE())) B;
+        auto a = reinterpret_cast<A*>(dest[0]);
+        auto b = reinterpret_cast<B*>(dest[1]);
+        int const real_width = width / factor;
+        int const real_height = height / factor;
+        int const patch_size = factor * factor;
+
+        // Sums for the row of blocks being read; the source rows are read in order, once
+        std::vector<int> sum_a(real_width), sum_b(real_width);
+        for (int j = 0; j < real_height; ++j)
+        {
+            std::fill(sum_a.begin(), sum_a.end(), 0);
+            std::fill(sum_b.begin(), sum_b.end(), 0);
+            for (int n = 0; n < factor; ++n)
+            {
+                const SOURCE * p = source + size_t(j * factor + n) * width;
+                for (int i = 0; i < real_width; ++i)
+                {
+                    for (int m = 0; m < factor; ++m, ++p)
+                    {
+                        sum_a[i] += split_a(*p);
+                        sum_b[i] += split_b(*p);
+                    }
+                }
+            }
+            for (int i = 0; i < real_width; ++i)
+            {
+                a[i] = A(sum_a[i] / patch_size);
+                b[i] = B(sum_b[i] / patch_size);
+            }
+            std::fill(a + real_width, a + out_width, A(0));
+            std::fill(b + real_width, b + out_width, B(0));
+            a += out_width;
+            b += out_width;
+        }
+        std::fill(a, a + size_t(out_height - real_height) * out_width, A(0));
+        std::fill(b, b + size_t(out_height - real_height) * out_width, B(0));
+    }
 }
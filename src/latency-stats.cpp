@@ -0,0 +1,249 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "latency-stats.h"
+#include "core/extension.h"
+#include "composite-frame.h"
+#include "core/stream-profile-interface.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+
+
+namespace librealsense {
+
+
+static int highest_bit( uint64_t x )
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+    return 63 - __builtin_clzll( x );
+#else
+    int bit = 0;
+    while( x >>= 1 )
+        ++bit;
+    return bit;
+#endif
+}
+
+
+int latency_histogram::bucket_of( uint64_t us )
+{
+    if( us < SUB_BUCKETS )
+        return int( us );
+    if( us >= ( uint64_t( 1 ) << 32 ) )
+        return BUCKETS - 1;
+    int const e = highest_bit( us );  // >= SUB_BUCKET_BITS
+    int const sub = int( us >> ( e - SUB_BUCKET_BITS ) ) & ( SUB_BUCKETS - 1 );
+    return ( e - SUB_BUCKET_BITS + 1 ) * SUB_BUCKETS + sub;
+}
+
+
+uint64_t latency_histogram::bucket_low( int bucket )
+{
+    if( bucket < SUB_BUCKETS )
+        return uint64_t( bucket );
+    int const e = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    int const sub = bucket % SUB_BUCKETS;
+    return uint64_t( SUB_BUCKETS + sub ) << ( e - SUB_BUCKET_BITS );
+}
+
+
+uint64_t latency_histogram::bucket_high( int bucket )
+{
+    if( bucket < SUB_BUCKETS )
+        return uint64_t( bucket ) + 1;
+    int const e = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    return bucket_low( bucket ) + ( uint64_t( 1 ) << ( e - SUB_BUCKET_BITS ) );
+}
+
+
+void latency_histogram::record( double ms )
+{
+    uint64_t const us = ms > 0 ? uint64_t( ms * 1000. ) : 0;
+    _buckets[bucket_of( us )].fetch_add( 1, std::memory_order_relaxed );
+    _count.fetch_add( 1, std::memory_order_relaxed );
+    _total_us.fetch_add( us, std::memory_order_relaxed );
+    auto max = _max_us.load( std::memory_order_relaxed );
+    while( us > max && ! _max_us.compare_exchange_weak( max, us, std::memory_order_relaxed ) )
+    {
+    }
+}
+
+
+void latency_histogram::reset()
+{
+    for( auto & b : _buckets )
+        b.store( 0, std::memory_order_relaxed );
+    _count = 0;
+    _total_us = 0;
+    _max_us = 0;
+}
+
+
+rs2_latency_stats latency_histogram::get_stats() const
+{
+    rs2_latency_stats stats = {};
+    // Recording may be going on while we read: use our own snapshot of the buckets so percentiles are consistent
+    uint32_t counts[BUCKETS];
+    uint64_t count = 0;
+    for( int b = 0; b < BUCKETS; ++b )
+    {
+        counts[b] = _buckets[b].load( std::memory_order_relaxed );
+        count += counts[b];
+    }
+    if( ! count )
+        return stats;
+
+    stats.count = count;
+    stats.mean_ms = float( _total_us.load( std::memory_order_relaxed ) / 1000. / _count.load( std::memory_order_relaxed ) );
+    stats.max_ms = float( _max_us.load( std::memory_order_relaxed ) / 1000. );
+
+    // Each percentile is reported as the middle of the bucket it falls in
+    struct
+    {
+        double fraction;
+        float * out;
+    } const percentiles[] = { { .5, &stats.p50_ms }, { .9, &stats.p90_ms }, { .99, &stats.p99_ms } };
+    uint64_t seen = 0;
+    size_t p = 0;
+    for( int b = 0; b < BUCKETS && p < sizeof( percentiles ) / sizeof( *percentiles ); ++b )
+    {
+        seen += counts[b];
+        while( p < sizeof( percentiles ) / sizeof( *percentiles ) && seen >= percentiles[p].fraction * count )
+        {
+            *percentiles[p].out = float( ( bucket_low( b ) + bucket_high( b ) ) / 2000. );
+            ++p;
+        }
+    }
+    return stats;
+}
+
+
+void frame_drop_counters::queue_depth( rs2_frame_drop_stage stage, size_t depth, size_t capacity )
+{
+    auto & max = _max_queue_depth[stage];
+    auto current = max.load( std::memory_order_relaxed );
+    while( depth > current && ! max.compare_exchange_weak( current, uint32_t( depth ), std::memory_order_relaxed ) )
+    {
+    }
+    if( capacity )
+        _queue_fill[stage].store( uint32_t( std::min( depth, capacity ) * 100 / capacity ), std::memory_order_relaxed );
+}
+
+
+unsigned frame_drop_counters::queue_fill() const
+{
+    uint32_t fill = 0;
+    for( auto & f : _queue_fill )
+        fill = std::max( fill, f.load( std::memory_order_relaxed ) );
+    return fill;
+}
+
+
+void frame_drop_counters::decimated( unsigned scale )
+{
+    _decimated.fetch_add( 1, std::memory_order_relaxed );
+    _decimation_scale.store( scale, std::memory_order_relaxed );
+}
+
+
+void frame_drop_counters::metadata_sync( uint64_t mismatches, uint64_t metadata_dropped )
+{
+    if( mismatches )
+        _metadata_mismatches.fetch_add( mismatches, std::memory_order_relaxed );
+    if( metadata_dropped )
+        _metadata_dropped.fetch_add( metadata_dropped, std::memory_order_relaxed );
+}
+
+
+void frame_drop_counters::reset()
+{
+    for( auto & d : _dropped )
+        d.store( 0, std::memory_order_relaxed );
+    for( auto & d : _max_queue_depth )
+        d.store( 0, std::memory_order_relaxed );
+    for( auto & f : _queue_fill )
+        f.store( 0, std::memory_order_relaxed );
+    _decimated.store( 0, std::memory_order_relaxed );
+    _decimation_scale.store( 0, std::memory_order_relaxed );
+    _metadata_mismatches.store( 0, std::memory_order_relaxed );
+    _metadata_dropped.store( 0, std::memory_order_relaxed );
+    _latency_cutoffs.store( 0, std::memory_order_relaxed );
+}
+
+
+rs2_frame_drops frame_drop_counters::get_stats() const
+{
+    rs2_frame_drops stats;
+    for( int stage = 0; stage < RS2_FRAME_DROP_STAGE_COUNT; ++stage )
+    {
+        stats.dropped[stage] = _dropped[stage].load( std::memory_order_relaxed );
+        stats.max_queue_depth[stage] = _max_queue_depth[stage].load( std::memory_order_relaxed );
+        stats.queue_fill[stage] = _queue_fill[stage].load( std::memory_order_relaxed );
+    }
+    stats.decimated = _decimated.load( std::memory_order_relaxed );
+    stats.decimation_scale = _decimation_scale.load( std::memory_order_relaxed );
+    stats.metadata_mismatches = _metadata_mismatches.load( std::memory_order_relaxed );
+    stats.metadata_dropped = _metadata_dropped.load( std::memory_order_relaxed );
+    stats.latency_cutoffs = _latency_cutoffs.load( std::memory_order_relaxed );
+    return stats;
+}
+
+
+void stream_stats::drop( frame_interface const * f, rs2_frame_drop_stage stage )
+{
+    if( auto composite = dynamic_cast< composite_frame const * >( f ) )
+    {
+        for( size_t i = 0; i < composite->get_embedded_frames_count(); ++i )
+            drop( composite->get_frame( int( i ) ), stage );
+        return;
+    }
+    if( ! f )
+        return;
+    auto profile = f->get_stream();
+    if( profile )
+        profile->get_stats().drops.drop( stage );
+}
+
+
+bool stream_stats::exposure_midpoint( frame_interface const * f, double & host_ms )
+{
+    if( ! f || f->get_frame_timestamp_domain() != RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME )
+        return false;
+
+    rs2_metadata_type frame_us, sensor_us, exposure_us;
+    if( f->find_metadata( RS2_FRAME_METADATA_FRAME_TIMESTAMP, &frame_us )
+        && f->find_metadata( RS2_FRAME_METADATA_SENSOR_TIMESTAMP, &sensor_us ) )
+    {
+        // Both on the device clock, which wraps around at 32 bits
+        auto const before_frame_us = uint32_t( frame_us - sensor_us );
+        if( before_frame_us > 1000000 )
+            return false;
+        host_ms = f->get_frame_timestamp() - before_frame_us / 1000.;
+        return true;
+    }
+    if( f->find_metadata( RS2_FRAME_METADATA_ACTUAL_EXPOSURE, &exposure_us ) && exposure_us >= 0 )
+    {
+        host_ms = f->get_frame_timestamp() - exposure_us / 2000.;
+        return true;
+    }
+    return false;
+}
+
+
+stream_stats & stream_stats::get( int unique_id )
+{
+    static std::mutex mutex;
+    static std::map< int, std::unique_ptr< stream_stats > > all;
+
+    std::lock_guard< std::mutex > lock( mutex );
+    auto & stats = all[unique_id];
+    if( ! stats )
+        stats.reset( new stream_stats );
+    return *stats;
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,114 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// Lock-free histogram of latencies, cheap enough to record every frame.
+//
+// Values are kept in microseconds, in log-linear buckets: four per power of two, so any value is known to within 25%
+// no matter its magnitude (the same idea as an HDR histogram, with a fixed precision). Recording is a handful of
+// relaxed atomic increments; percentiles are only computed when the statistics are queried.
+//
+class latency_histogram
+{
+public:
+    static constexpr int SUB_BUCKET_BITS = 2;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr int BUCKETS = ( 32 - SUB_BUCKET_BITS + 1 ) * SUB_BUCKETS;  // values up to 2^32 us (71 minutes)
+
+    latency_histogram() { reset(); }
+
+    void record( double ms );
+    void reset();
+    rs2_latency_stats get_stats() const;
+
+    static int bucket_of( uint64_t us );
+    // The range [low, high) of values that fall into a bucket
+    static uint64_t bucket_low( int bucket );
+    static uint64_t bucket_high( int bucket );
+
+private:
+    std::atomic< uint32_t > _buckets[BUCKETS];
+    std::atomic< uint64_t > _count;
+    std::atomic< uint64_t > _total_us;
+    std::atomic< uint64_t > _max_us;
+};
+
+
+// Frames dropped, by the stage that dropped them, and the deepest the queue of each stage got. Relaxed atomics: drops
+// are counted where they happen, queue depths wherever frames are enqueued.
+//
+// Bounded queues also report their capacity, so how full each is right now is known: this is the backpressure that the
+// adaptive decimation filter reacts to, and it reports back the frames it decimated further instead.
+//
+class frame_drop_counters
+{
+public:
+    frame_drop_counters() { reset(); }
+
+    void drop( rs2_frame_drop_stage stage, uint64_t frames = 1 ) { _dropped[stage].fetch_add( frames, std::memory_order_relaxed ); }
+    // With a capacity, the fill of the queue is updated as well
+    void queue_depth( rs2_frame_drop_stage, size_t depth, size_t capacity = 0 );
+    // The fullest any queue of the stream is, in percent, as of the last frame to enter each
+    unsigned queue_fill() const;
+    // The scale the adaptive decimation filter used on the last frame; decimated() if further than asked
+    void decimated( unsigned scale );
+    void decimation_scale( unsigned scale ) { _decimation_scale.store( scale, std::memory_order_relaxed ); }
+    // Video/metadata pairing in the backend: out-of-step heads, and metadata buffers it gave back unpaired
+    void metadata_sync( uint64_t mismatches, uint64_t metadata_dropped );
+    // A syncer released a frameset without the stream, not to exceed its max latency
+    void latency_cutoff() { _latency_cutoffs.fetch_add( 1, std::memory_order_relaxed ); }
+    void reset();
+    rs2_frame_drops get_stats() const;
+
+private:
+    std::atomic< uint64_t > _dropped[RS2_FRAME_DROP_STAGE_COUNT];
+    std::atomic< uint32_t > _max_queue_depth[RS2_FRAME_DROP_STAGE_COUNT];
+    std::atomic< uint32_t > _queue_fill[RS2_FRAME_DROP_STAGE_COUNT];
+    std::atomic< uint64_t > _decimated;
+    std::atomic< uint32_t > _decimation_scale;
+    std::atomic< uint64_t > _metadata_mismatches;
+    std::atomic< uint64_t > _metadata_dropped;
+    std::atomic< uint64_t > _latency_cutoffs;
+};
+
+
+class frame_interface;
+
+
+// Where the time goes for each stream on its way from the backend to the user
+struct stream_stats
+{
+    latency_histogram arrival_to_publish;  // backend arrival -> the sensor hands the frame to its callback
+    latency_histogram publish_to_sync;     // sensor publish -> the syncer releases it in a frameset
+    latency_histogram processing;          // time spent inside each processing block the stream's frames go through
+    latency_histogram exposure_to_callback;  // middle of the exposure -> sensor publish (see exposure_midpoint())
+    frame_drop_counters drops;
+
+    // Count a frame as dropped, against its stream (or each frame of a frameset, against theirs); frames that have no
+    // stream yet are not counted
+    static void drop( frame_interface const *, rs2_frame_drop_stage );
+
+    // When the middle of the frame's exposure was, in host time (ms, as time_service::get_time()). Only known for
+    // frames whose timestamp is in the global time domain: from the sensor timestamp metadata (the middle of the
+    // exposure, on the device clock) relative to the frame timestamp metadata; or else, from the actual exposure,
+    // taking the frame's timestamp as the end of the exposure.
+    static bool exposure_midpoint( frame_interface const *, double & host_ms );
+
+    // Stats for the stream with the given unique ID; created on first use and never removed, so the reference stays
+    // valid
+    static stream_stats & get( int unique_id );
+};
+
+
+}  // namespace librealsense
@@ -8,6 +8,7 @@
 #include "basics.h"  // LRS_EXTENSION_API
 
 #include <exception>
+#include <cstring>
 #include <string>
 
 
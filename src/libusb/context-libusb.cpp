@@ -3,6 +3,7 @@
 
 #include "context-libusb.h"
 #include "../types.h"
+#include <rsutils/concurrency/thread-policy.h>
 
 namespace librealsense
 {
@@ -42,6 +43,7 @@ namespace librealsense
                     _kill_handler_thread = 0;
                 }
                 _event_handler = std::thread([this]() {
+                    rsutils::concurrency::apply_thread_policy( "usb" );
                     while (!_kill_handler_thread)
                         libusb_handle_events_completed(_ctx, &_kill_handler_thread);
                 });
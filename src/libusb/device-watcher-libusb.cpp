@@ -0,0 +1,134 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "device-watcher-libusb.h"
+#include "../types.h"
+#include <rsutils/concurrency/thread-policy.h>
+#include <rsutils/string/from.h>
+
+
+namespace librealsense {
+namespace platform {
+
+
+bool device_watcher_libusb::is_supported()
+{
+    return libusb_has_capability( LIBUSB_CAP_HAS_HOTPLUG ) != 0;
+}
+
+
+device_watcher_libusb::device_watcher_libusb( const backend * backend_ref )
+    : _backend( backend_ref )
+    , _active( false )
+    , _changed( false )
+{
+    // A context of our own: its events are handled only by our thread
+    auto sts = libusb_init( &_ctx );
+    if( sts != LIBUSB_SUCCESS )
+    {
+        LOG_ERROR( "libusb_init failed: " << libusb_error_name( sts ) );
+        _ctx = nullptr;
+    }
+    _devices_data = { _backend->query_uvc_devices(), _backend->query_usb_devices(), _backend->query_hid_devices() };
+}
+
+
+device_watcher_libusb::~device_watcher_libusb()
+{
+    stop();
+    if( _ctx )
+        libusb_exit( _ctx );
+}
+
+
+int LIBUSB_CALL device_watcher_libusb::on_hotplug( libusb_context *, libusb_device *, libusb_hotplug_event, void * user )
+{
+    // Called from libusb_handle_events, where no enumeration may take place: just note it for run()
+    auto self = static_cast< device_watcher_libusb * >( user );
+    self->_last_change = std::chrono::steady_clock::now();
+    self->_changed = true;
+    return 0;  // stay registered
+}
+
+
+void device_watcher_libusb::start( device_changed_callback callback )
+{
+    stop();
+    if( ! _ctx )
+        throw std::runtime_error( "libusb context is not available for hotplug" );
+
+    _callback = std::move( callback );
+    _changed = false;
+
+    auto sts = libusb_hotplug_register_callback( _ctx,
+                                                 libusb_hotplug_event( LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED
+                                                                       | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT ),
+                                                 LIBUSB_HOTPLUG_NO_FLAGS,
+                                                 LIBUSB_HOTPLUG_MATCH_ANY,
+                                                 LIBUSB_HOTPLUG_MATCH_ANY,
+                                                 LIBUSB_HOTPLUG_MATCH_ANY,
+                                                 &device_watcher_libusb::on_hotplug,
+                                                 this,
+                                                 &_hotplug_handle );
+    if( sts != LIBUSB_SUCCESS )
+        throw std::runtime_error( rsutils::string::from() << "libusb_hotplug_register_callback failed: "
+                                                          << libusb_error_name( sts ) );
+
+    // Anything that changed while we were not watching
+    _last_change = std::chrono::steady_clock::now();
+    _changed = true;
+
+    _active = true;
+    _event_thread = std::thread( [this]() { run(); } );
+}
+
+
+void device_watcher_libusb::stop()
+{
+    if( ! _active.exchange( false ) )
+        return;
+
+    // Deregistering wakes up the event thread, which then sees it is no longer active
+    libusb_hotplug_deregister_callback( _ctx, _hotplug_handle );
+    if( _event_thread.joinable() )
+        _event_thread.join();
+
+    _callback_inflight.wait_until_empty();
+}
+
+
+void device_watcher_libusb::run()
+{
+    rsutils::concurrency::apply_thread_policy( "usb-hotplug" );
+    while( _active )
+    {
+        timeval tv = { 0, HOTPLUG_SETTLE_MS * 1000 };
+        libusb_handle_events_timeout_completed( _ctx, &tv, nullptr );
+
+        if( ! _changed || ! _active )
+            continue;
+        // Wait for the events of a device to settle, so it is enumerated once and complete
+        if( std::chrono::steady_clock::now() - _last_change < std::chrono::milliseconds( HOTPLUG_SETTLE_MS ) )
+            continue;
+        _changed = false;
+
+        backend_device_group curr( _backend->query_uvc_devices(),
+                                   _backend->query_usb_devices(),
+                                   _backend->query_hid_devices() );
+        if( list_changed( _devices_data.uvc_devices, curr.uvc_devices )
+            || list_changed( _devices_data.usb_devices, curr.usb_devices )
+            || list_changed( _devices_data.hid_devices, curr.hid_devices ) )
+        {
+            callback_invocation_holder callback = { _callback_inflight.allocate(), &_callback_inflight };
+            if( callback )
+            {
+                _callback( _devices_data, curr );
+                _devices_data = curr;
+            }
+        }
+    }
+}
+
+
+}  // namespace platform
+}  // namespace librealsense
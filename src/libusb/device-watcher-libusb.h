@@ -0,0 +1,56 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "../backend.h"
+#include "../platform/device-watcher.h"
+#include "../callback-invocation.h"
+#include "libusb.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+
+namespace librealsense {
+namespace platform {
+
+
+// This device_watcher enumerates the devices only when libusb reports that a USB device arrived or left, instead of
+// every POLLING_DEVICES_INTERVAL_MS like polling_device_watcher: enumerating touches every device on the bus. It
+// needs hotplug support from libusb (see is_supported()), which e.g. Windows does not have.
+//
+class device_watcher_libusb : public device_watcher
+{
+public:
+    static bool is_supported();
+
+    device_watcher_libusb( const backend * backend_ref );
+    ~device_watcher_libusb();
+
+    void start( device_changed_callback callback ) override;
+    void stop() override;
+    bool is_stopped() const override { return ! _active; }
+
+private:
+    static int LIBUSB_CALL on_hotplug( libusb_context *, libusb_device *, libusb_hotplug_event, void * user );
+    void run();
+
+    const backend * _backend;
+    libusb_context * _ctx = nullptr;
+    libusb_hotplug_callback_handle _hotplug_handle = 0;
+
+    std::atomic< bool > _active;
+    std::atomic< bool > _changed;
+    std::chrono::steady_clock::time_point _last_change;   // event thread only
+    std::thread _event_thread;
+
+    callbacks_heap _callback_inflight;
+    backend_device_group _devices_data;
+    device_changed_callback _callback;
+};
+
+
+}  // namespace platform
+}  // namespace librealsense
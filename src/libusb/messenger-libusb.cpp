@@ -4,10 +4,34 @@
 #include "messenger-libusb.h"
 #include "device-libusb.h"
 #include "handle-libusb.h"
+
+#include <algorithm>
+#include <cstring>
+
 namespace librealsense
 {
     namespace platform
     {
+        // Control transfers the device may be working on at once; the rest wait in the queue
+        static const size_t MAX_ACTIVE_CONTROL_TRANSFERS = 8;
+
+        struct usb_messenger_libusb::control_request
+        {
+            usb_messenger_libusb* owner;
+            libusb_transfer* transfer = nullptr;
+            std::vector<uint8_t> data;  // the setup packet, then the payload
+            uint8_t* buffer;
+            uint32_t length;
+            bool in;
+            control_transfer_callback callback;
+
+            ~control_request()
+            {
+                if (transfer)
+                    libusb_free_transfer(transfer);
+            }
+        };
+
         usb_messenger_libusb::usb_messenger_libusb(const std::shared_ptr<usb_device_libusb>& device,
                                                    std::shared_ptr<handle_libusb> handle)
                 : _device(device), _handle(handle)
@@ -17,7 +41,119 @@ namespace librealsense
 
         usb_messenger_libusb::~usb_messenger_libusb()
         {
+            std::deque<std::shared_ptr<control_request>> queued;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _closing = true;
+                queued.swap(_queued_controls);
+                for (auto&& r : _active_controls)
+                    libusb_cancel_transfer(r->transfer);
+                // The cancelled transfers complete on the event handler thread
+                if (!_controls_done.wait_for(lock, std::chrono::seconds(2), [this]() { return _active_controls.empty(); }))
+                    LOG_ERROR("active control transfers didn't return on time");
+            }
+            for (auto&& r : queued)
+                complete(r, RS2_USB_STATUS_INTERRUPTED, 0);
+        }
 
+        void usb_messenger_libusb::complete(const std::shared_ptr<control_request>& request, usb_status status, uint32_t transferred)
+        {
+            if (status == RS2_USB_STATUS_SUCCESS && request->in)
+                std::memcpy(request->buffer, request->data.data() + LIBUSB_CONTROL_SETUP_SIZE, transferred);
+            request->callback(status, transferred);
+        }
+
+        void usb_messenger_libusb::control_transfer_async(int request_type, int request, int value, int index, uint8_t* buffer, uint32_t length, uint32_t timeout_ms, control_transfer_callback callback)
+        {
+            auto r = std::make_shared<control_request>();
+            r->owner = this;
+            r->buffer = buffer;
+            r->length = length;
+            r->in = (request_type & LIBUSB_ENDPOINT_DIR_MASK) == LIBUSB_ENDPOINT_IN;
+            r->callback = std::move(callback);
+            r->transfer = libusb_alloc_transfer(0);
+            if (!r->transfer)
+            {
+                r->callback(RS2_USB_STATUS_NO_MEM, 0);
+                return;
+            }
+            r->data.resize(LIBUSB_CONTROL_SETUP_SIZE + length);
+            libusb_fill_control_setup(r->data.data(), uint8_t(request_type), uint8_t(request), uint16_t(value), uint16_t(index), uint16_t(length));
+            if (!r->in && length)
+                std::memcpy(r->data.data() + LIBUSB_CONTROL_SETUP_SIZE, buffer, length);
+            libusb_fill_control_transfer(r->transfer, _handle->get(), r->data.data(), control_transfer_done, r.get(), timeout_ms);
+
+            std::vector<std::shared_ptr<control_request>> failed;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_closing)
+                    failed.push_back(r);
+                else
+                {
+                    _queued_controls.push_back(r);
+                    submit_queued_controls(failed);
+                }
+            }
+            for (auto&& f : failed)
+                complete(f, RS2_USB_STATUS_IO, 0);
+        }
+
+        void usb_messenger_libusb::submit_queued_controls(std::vector<std::shared_ptr<control_request>>& failed)
+        {
+            while (!_closing && !_queued_controls.empty() && _active_controls.size() < MAX_ACTIVE_CONTROL_TRANSFERS)
+            {
+                auto r = _queued_controls.front();
+                _queued_controls.pop_front();
+                auto sts = libusb_submit_transfer(r->transfer);
+                if (sts < 0)
+                {
+                    LOG_WARNING("control_transfer_async failed to submit, index: " << int(libusb_control_transfer_get_setup(r->transfer)->wIndex)
+                        << ", error: " << libusb_error_name(sts));
+                    failed.push_back(r);
+                    continue;
+                }
+                _active_controls.push_back(r);
+            }
+        }
+
+        void LIBUSB_CALL usb_messenger_libusb::control_transfer_done(libusb_transfer* transfer)
+        {
+            auto raw = reinterpret_cast<control_request*>(transfer->user_data);
+            auto owner = raw->owner;
+
+            usb_status sts;
+            switch (transfer->status)
+            {
+            case LIBUSB_TRANSFER_COMPLETED: sts = RS2_USB_STATUS_SUCCESS; break;
+            case LIBUSB_TRANSFER_TIMED_OUT: sts = RS2_USB_STATUS_TIMEOUT; break;
+            case LIBUSB_TRANSFER_STALL: sts = RS2_USB_STATUS_PIPE; break;
+            case LIBUSB_TRANSFER_NO_DEVICE: sts = RS2_USB_STATUS_NO_DEVICE; break;
+            case LIBUSB_TRANSFER_OVERFLOW: sts = RS2_USB_STATUS_OVERFLOW; break;
+            case LIBUSB_TRANSFER_CANCELLED: sts = RS2_USB_STATUS_INTERRUPTED; break;
+            default: sts = RS2_USB_STATUS_IO; break;
+            }
+
+            std::shared_ptr<control_request> r;
+            {
+                std::lock_guard<std::mutex> lock(owner->_mutex);
+                auto it = std::find_if(owner->_active_controls.begin(), owner->_active_controls.end(),
+                    [raw](const std::shared_ptr<control_request>& a) { return a.get() == raw; });
+                if (it == owner->_active_controls.end())
+                    return;
+                r = *it;
+            }
+            complete(r, sts, sts == RS2_USB_STATUS_SUCCESS ? uint32_t(transfer->actual_length) : 0);
+
+            // The request stays active until its callback returns, which the owner's destructor waits for
+            std::vector<std::shared_ptr<control_request>> failed;
+            {
+                std::lock_guard<std::mutex> lock(owner->_mutex);
+                owner->_active_controls.remove(r);
+                owner->submit_queued_controls(failed);
+                owner->_controls_done.notify_all();
+            }
+            for (auto&& f : failed)
+                complete(f, RS2_USB_STATUS_IO, 0);
         }
 
         usb_status usb_messenger_libusb::reset_endpoint(const rs_usb_endpoint& endpoint, uint32_t timeout_ms)
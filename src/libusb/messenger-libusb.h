@@ -8,6 +8,10 @@
 #include "request-libusb.h"
 #include "handle-libusb.h"
 
+#include <condition_variable>
+#include <deque>
+#include <list>
+
 namespace librealsense
 {
     namespace platform
@@ -21,6 +25,7 @@ namespace librealsense
             virtual ~usb_messenger_libusb() override;
 
             virtual usb_status control_transfer(int request_type, int request, int value, int index, uint8_t* buffer, uint32_t length, uint32_t& transferred, uint32_t timeout_ms) override;
+            virtual void control_transfer_async(int request_type, int request, int value, int index, uint8_t* buffer, uint32_t length, uint32_t timeout_ms, control_transfer_callback callback) override;
             virtual usb_status bulk_transfer(const rs_usb_endpoint&  endpoint, uint8_t* buffer, uint32_t length, uint32_t& transferred, uint32_t timeout_ms) override;
             virtual usb_status reset_endpoint(const rs_usb_endpoint& endpoint, uint32_t timeout_ms) override;
             virtual usb_status submit_request(const rs_usb_request& request) override;
@@ -28,9 +33,21 @@ namespace librealsense
             virtual rs_usb_request create_request(rs_usb_endpoint endpoint) override;
 
         private:
+            struct control_request;
+            static void LIBUSB_CALL control_transfer_done(libusb_transfer* transfer);
+            // Submits queued control transfers while there is room; called with _mutex held
+            void submit_queued_controls(std::vector<std::shared_ptr<control_request>>& failed);
+            static void complete(const std::shared_ptr<control_request>& request, usb_status status, uint32_t transferred);
+
             const std::shared_ptr<usb_device_libusb> _device;
             std::mutex _mutex;
             std::shared_ptr<handle_libusb> _handle;
+
+            // Asynchronous control transfers, waiting and submitted
+            std::deque<std::shared_ptr<control_request>> _queued_controls;
+            std::list<std::shared_ptr<control_request>> _active_controls;
+            std::condition_variable _controls_done;
+            bool _closing = false;
         };
     }
 }
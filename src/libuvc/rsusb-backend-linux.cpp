@@ -4,6 +4,7 @@
 #include "rsusb-backend-linux.h"
 #include "types.h"
 #include "../polling-device-watcher.h"
+#include "../libusb/device-watcher-libusb.h"
 #include "../uvc/uvc-device.h"
 
 namespace librealsense
@@ -17,6 +18,8 @@ namespace librealsense
 
         std::shared_ptr<device_watcher> rs_backend_linux::create_device_watcher() const
         {
+            if (device_watcher_libusb::is_supported())
+                return std::make_shared<device_watcher_libusb>(this);
             return std::make_shared<polling_device_watcher>(this);
         }
     }
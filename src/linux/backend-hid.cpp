@@ -7,6 +7,7 @@
 #include "types.h"
 
 #include <rsutils/string/from.h>
+#include <rsutils/concurrency/thread-policy.h>
 
 #include <thread>
 #include <chrono>
@@ -14,6 +15,8 @@
 #include <dirent.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 
 #pragma GCC diagnostic ignored "-Woverflow"
 
@@ -255,6 +258,7 @@ namespace librealsense
             _callback = sensor_callback;
             _is_capturing = true;
             _hid_thread = std::unique_ptr<std::thread>(new std::thread([this, read_device_path_str](){
+                rsutils::concurrency::apply_thread_policy( "hid" );
                 const uint32_t channel_size = 24; // TODO: why 24?
                 std::vector<uint8_t> raw_data(channel_size * hid_buf_len);
 
@@ -453,7 +457,7 @@ namespace librealsense
             }
         }
 
-        iio_hid_sensor::iio_hid_sensor(const std::string& device_path, uint32_t frequency, float sensitivity)
+        iio_hid_sensor::iio_hid_sensor(const std::string& device_path, uint32_t frequency, float sensitivity, uint32_t watermark)
             : _stop_pipe_fd{},
               _fd(0),
               _iio_device_number(0),
@@ -464,7 +468,7 @@ namespace librealsense
               _is_capturing(false),
               _pm_dispatcher(16)    // queue for async power management commands
         {
-            init(frequency, sensitivity);
+            init(frequency, sensitivity, watermark);
         }
 
         iio_hid_sensor::~iio_hid_sensor()
@@ -526,6 +530,28 @@ namespace librealsense
                 throw linux_backend_exception("open() failed with all retries!");
             }
 
+            _callback = sensor_callback;
+            _channel_size = get_channel_size();
+            _raw_data.resize(_channel_size * hid_buf_len);
+            _has_metadata = has_metadata();
+
+            if (_reactor)
+            {
+                _is_capturing = true;
+                try
+                {
+                    _reactor->add(this, _fd);
+                }
+                catch (...)
+                {
+                    _is_capturing = false;
+                    close(_fd);
+                    _channels.clear();
+                    throw;
+                }
+                return;
+            }
+
             if (pipe(_stop_pipe_fd) < 0)
             {
                 close(_fd);
@@ -533,15 +559,9 @@ namespace librealsense
                 throw linux_backend_exception("iio_hid_sensor: Cannot create pipe!");
             }
 
-            _callback = sensor_callback;
             _is_capturing = true;
             _hid_thread = std::unique_ptr<std::thread>(new std::thread([this](){
-                const uint32_t channel_size = get_channel_size();
-                size_t raw_data_size = channel_size*hid_buf_len;
-
-                std::vector<uint8_t> raw_data(raw_data_size);
-                auto metadata = has_metadata();
-
+                rsutils::concurrency::apply_thread_policy( "hid" );
                 do {
                     fd_set fds;
                     FD_ZERO(&fds);
@@ -550,7 +570,6 @@ namespace librealsense
 
                     int max_fd = std::max(_stop_pipe_fd[0], _fd);
 
-                    ssize_t read_size = 0;
                     struct timeval tv = {5, 0};
                     LOG_DEBUG_HID("HID IIO Select initiated");
                     auto val = select(max_fd + 1, &fds, nullptr, nullptr, &tv);
@@ -574,9 +593,7 @@ namespace librealsense
                         }
                         else if (FD_ISSET(_fd, &fds))
                         {
-                            read_size = read(_fd, raw_data.data(), raw_data_size);
-                            if (read_size < 0 )
-                                continue;
+                            poll_ready();
                         }
                         else
                         {
@@ -584,66 +601,82 @@ namespace librealsense
                             LOG_WARNING("HID IIO unresolved event : after select->FD_ISSET");
                             continue;
                         }
-
-                        auto sz= read_size / channel_size;
-                        if (sz > 2)
-                        {
-                            LOG_DEBUG("HID: Going to handle " <<  sz << " packets");
-                        }
-                        // TODO: code refactoring to reduce latency
-                        for (auto i = 0; i < sz; ++i)
-                        {
-                            auto now_ts = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
-                            auto p_raw_data = raw_data.data() + channel_size * i;
-                            sensor_data sens_data{};
-                            sens_data.sensor = hid_sensor{get_sensor_name()};
-
-                            auto hid_data_size = channel_size - (metadata ? HID_METADATA_SIZE : 0);
-                            // Populate HID IMU data - Header
-                            metadata_hid_raw meta_data{};
-                            meta_data.header.report_type = md_hid_report_type::hid_report_imu;
-                            meta_data.header.length = hid_header_size + metadata_imu_report_size;
-                            meta_data.header.timestamp = *(reinterpret_cast<uint64_t *>(&p_raw_data[16]));
-                            // Payload:
-                            meta_data.report_type.imu_report.header.md_type_id = md_type::META_DATA_HID_IMU_REPORT_ID;
-                            meta_data.report_type.imu_report.header.md_size = metadata_imu_report_size;
-//                            meta_data.report_type.imu_report.flags = static_cast<uint8_t>( md_hid_imu_attributes::custom_timestamp_attirbute |
-//                                                                                            md_hid_imu_attributes::imu_counter_attribute |
-//                                                                                            md_hid_imu_attributes::usb_counter_attribute);
-//                            meta_data.report_type.imu_report.custom_timestamp = meta_data.header.timestamp;
-//                            meta_data.report_type.imu_report.imu_counter = p_raw_data[30];
-//                            meta_data.report_type.imu_report.usb_counter = p_raw_data[31];
-
-                            sens_data.fo = {hid_data_size, metadata? meta_data.header.length: uint8_t(0),
-                                            p_raw_data,  metadata? &meta_data : nullptr, now_ts};
-                            //Linux HID provides timestamps in nanosec. Convert to usec (FW default)
-                            if (metadata)
-                            {
-                                //auto* ts_nsec = reinterpret_cast<uint64_t*>(const_cast<void*>(sens_data.fo.metadata));
-                                //*ts_nsec /=1000;
-                                meta_data.header.timestamp /=1000;
-                            }
-
-//                            for (auto i=0ul; i<channel_size; i++)
-//                                std::cout << std::hex << int(p_raw_data[i]) << " ";
-//                            std::cout << std::dec << std::endl;
-
-                            this->_callback(sens_data);
-                        }
-                        if (sz > 2)
-                        {
-                            LOG_DEBUG("HID: Finished to handle " <<  sz << " packets");
-                        }
                     }
                     else
                     {
-                        LOG_WARNING("iio_hid_sensor: Frames didn't arrived within the predefined interval");
+                        notify_frames_timeout();
                         std::this_thread::sleep_for(std::chrono::milliseconds(2));
                     }
                 } while(this->_is_capturing);
             }));
         }
 
+        void iio_hid_sensor::poll_ready()
+        {
+            auto const channel_size = _channel_size;
+            auto const metadata = _has_metadata;
+            auto & raw_data = _raw_data;
+
+            ssize_t read_size = read(_fd, raw_data.data(), raw_data.size());
+            if (read_size < 0 )
+                return;
+
+            auto sz= read_size / channel_size;
+            if (sz > 2)
+            {
+                LOG_DEBUG("HID: Going to handle " <<  sz << " packets");
+            }
+            // TODO: code refactoring to reduce latency
+            for (auto i = 0; i < sz; ++i)
+            {
+                auto now_ts = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
+                auto p_raw_data = raw_data.data() + channel_size * i;
+                sensor_data sens_data{};
+                sens_data.sensor = hid_sensor{get_sensor_name()};
+
+                auto hid_data_size = channel_size - (metadata ? HID_METADATA_SIZE : 0);
+                // Populate HID IMU data - Header
+                metadata_hid_raw meta_data{};
+                meta_data.header.report_type = md_hid_report_type::hid_report_imu;
+                meta_data.header.length = hid_header_size + metadata_imu_report_size;
+                meta_data.header.timestamp = *(reinterpret_cast<uint64_t *>(&p_raw_data[16]));
+                // Payload:
+                meta_data.report_type.imu_report.header.md_type_id = md_type::META_DATA_HID_IMU_REPORT_ID;
+                meta_data.report_type.imu_report.header.md_size = metadata_imu_report_size;
+//                meta_data.report_type.imu_report.flags = static_cast<uint8_t>( md_hid_imu_attributes::custom_timestamp_attirbute |
+//                                                                                md_hid_imu_attributes::imu_counter_attribute |
+//                                                                                md_hid_imu_attributes::usb_counter_attribute);
+//                meta_data.report_type.imu_report.custom_timestamp = meta_data.header.timestamp;
+//                meta_data.report_type.imu_report.imu_counter = p_raw_data[30];
+//                meta_data.report_type.imu_report.usb_counter = p_raw_data[31];
+
+                sens_data.fo = {hid_data_size, metadata? meta_data.header.length: uint8_t(0),
+                                p_raw_data,  metadata? &meta_data : nullptr, now_ts};
+                //Linux HID provides timestamps in nanosec. Convert to usec (FW default)
+                if (metadata)
+                {
+                    //auto* ts_nsec = reinterpret_cast<uint64_t*>(const_cast<void*>(sens_data.fo.metadata));
+                    //*ts_nsec /=1000;
+                    meta_data.header.timestamp /=1000;
+                }
+
+//                for (auto i=0ul; i<channel_size; i++)
+//                    std::cout << std::hex << int(p_raw_data[i]) << " ";
+//                std::cout << std::dec << std::endl;
+
+                this->_callback(sens_data);
+            }
+            if (sz > 2)
+            {
+                LOG_DEBUG("HID: Finished to handle " <<  sz << " packets");
+            }
+        }
+
+        void iio_hid_sensor::notify_frames_timeout()
+        {
+            LOG_WARNING("iio_hid_sensor: Frames didn't arrived within the predefined interval");
+        }
+
         void iio_hid_sensor::stop_capture()
         {
             if (!_is_capturing)
@@ -651,8 +684,20 @@ namespace librealsense
 
             _is_capturing = false;
             set_power(false);
+            if (!_hid_thread)
+            {
+                _reactor->remove(this);
+                _callback = nullptr;
+                _channels.clear();
+
+                if(::close(_fd) < 0)
+                    throw linux_backend_exception("iio_hid_sensor: close(_fd) failed");
+                _fd = 0;
+                return;
+            }
             signal_stop();
             _hid_thread->join();
+            _hid_thread.reset();
             _callback = nullptr;
             _channels.clear();
 
@@ -779,7 +824,7 @@ namespace librealsense
         }
 
         // initialize the device sensor. reading its name and all of its inputs.
-        void iio_hid_sensor::init(uint32_t frequency, float sensitivity)
+        void iio_hid_sensor::init(uint32_t frequency, float sensitivity, uint32_t watermark)
         {
             std::ifstream iio_device_file(_iio_device_path + "/name");
 
@@ -818,6 +863,7 @@ namespace librealsense
             std::string current_trigger = _sensor_name + "-dev" + _iio_device_path.back();
             std::string path = _iio_device_path + "/trigger/current_trigger";
             _pm_thread = std::unique_ptr<std::thread>(new std::thread([path,current_trigger](){
+                rsutils::concurrency::apply_thread_policy( "hid" );
                 bool retry =true;
                 while (retry) {
                     try {
@@ -847,6 +893,13 @@ namespace librealsense
             set_frequency(frequency);
             set_sensitivity( sensitivity );
             write_fs_attribute(_iio_device_path + "/buffer/length", hid_buf_len);
+            // Fewer wakeups, each reading several samples; it can only be changed while the buffer is disabled
+            if (watermark)
+            {
+                auto const samples = std::min(watermark, hid_buf_len);
+                if (!write_fs_attribute(_iio_device_path + "/buffer/watermark", samples))
+                    LOG_WARNING("HID: cannot set the buffer watermark of " << _iio_device_path << " to " << samples);
+            }
         }
 
         // calculate the storage size of a scan
@@ -1066,7 +1119,8 @@ namespace librealsense
                         if (frequency == 0)
                             continue;
 
-                        auto device = std::unique_ptr<iio_hid_sensor>(new iio_hid_sensor(device_info.device_path, frequency, sensitivity));
+                        auto device = std::unique_ptr<iio_hid_sensor>(new iio_hid_sensor(device_info.device_path, frequency, sensitivity, _watermark));
+                        device->set_poll_reactor(_reactor);
                         _iio_hid_sensors.push_back(std::move(device));
                     }
                 }
@@ -1336,5 +1390,162 @@ namespace librealsense
 
             return valid;
         }
+
+        static const auto HID_FRAMES_TIMEOUT = std::chrono::seconds(5);
+
+        iio_hid_reactor::iio_hid_reactor(int threads)
+        {
+            _epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+            if (_epoll_fd < 0)
+                throw linux_backend_exception("iio_hid_reactor: epoll_create1 failed");
+
+            _stop_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            epoll_event ev = {};
+            ev.events = EPOLLIN;  // level-triggered, so every thread sees it
+            ev.data.u64 = 0;
+            if (_stop_fd < 0 || epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _stop_fd, &ev) < 0)
+            {
+                if (_stop_fd >= 0) ::close(_stop_fd);
+                ::close(_epoll_fd);
+                throw linux_backend_exception("iio_hid_reactor: cannot create stop event");
+            }
+
+            _next_timeout_check = std::chrono::steady_clock::now() + HID_FRAMES_TIMEOUT;
+            for (int i = 0; i < threads; ++i)
+                _threads.emplace_back([this]() {
+                    rsutils::concurrency::apply_thread_policy( "hid" );
+                    run();
+                });
+        }
+
+        iio_hid_reactor::~iio_hid_reactor()
+        {
+            uint64_t one = 1;
+            if (write(_stop_fd, &one, sizeof(one)) < 0)
+                LOG_ERROR("iio_hid_reactor: cannot signal the polling threads to stop");
+            for (auto && t : _threads)
+                if (t.joinable()) t.join();
+            ::close(_stop_fd);
+            ::close(_epoll_fd);
+        }
+
+        void iio_hid_reactor::add(iio_hid_sensor * sensor, int fd)
+        {
+            auto reg = std::make_shared<registration>();
+            reg->sensor = sensor;
+            reg->fd = fd;
+            reg->last_event = std::chrono::steady_clock::now();
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto id = _next_id++;
+            // One-shot: the fd is disabled once reported, until we rearm it after the sensor is done with it
+            epoll_event ev = {};
+            ev.events = EPOLLIN | EPOLLONESHOT;
+            ev.data.u64 = id;
+            if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+                throw linux_backend_exception(rsutils::string::from() << "iio_hid_reactor: cannot add fd " << fd
+                                                                      << ", error " << errno);
+            _registrations[id] = reg;
+        }
+
+        void iio_hid_reactor::remove(iio_hid_sensor * sensor)
+        {
+            std::shared_ptr<registration> reg;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto it = std::find_if(_registrations.begin(), _registrations.end(),
+                                       [sensor](const std::pair<const uint64_t, std::shared_ptr<registration>> & r)
+                                       { return r.second->sensor == sensor; });
+                if (it == _registrations.end())
+                    return;
+                reg = it->second;
+                _registrations.erase(it);
+            }
+
+            // Wait for any thread currently handling the sensor
+            std::lock_guard<std::mutex> lock(reg->mutex);
+            reg->active = false;
+            epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, reg->fd, nullptr);
+        }
+
+        void iio_hid_reactor::run()
+        {
+            while (true)
+            {
+                // One event at a time, so that ready sensors are spread between the threads
+                epoll_event ev = {};
+                int n = epoll_wait(_epoll_fd, &ev, 1, 1000);
+                if (n < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    LOG_ERROR("iio_hid_reactor: epoll_wait failed, error " << errno);
+                    return;
+                }
+                if (n > 0)
+                {
+                    if (!ev.data.u64)
+                        return;  // stop event
+                    dispatch(ev.data.u64);
+                }
+                check_timeouts();
+            }
+        }
+
+        void iio_hid_reactor::dispatch(uint64_t id)
+        {
+            std::shared_ptr<registration> reg;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto it = _registrations.find(id);
+                if (it == _registrations.end())
+                    return;  // removed after the event was reported
+                reg = it->second;
+            }
+
+            std::lock_guard<std::mutex> lock(reg->mutex);
+            if (!reg->active)
+                return;
+            reg->last_event = std::chrono::steady_clock::now();
+            try
+            {
+                reg->sensor->poll_ready();
+            }
+            catch (const std::exception & ex)
+            {
+                LOG_ERROR("iio_hid_reactor: " << ex.what());
+            }
+
+            epoll_event ev = {};
+            ev.events = EPOLLIN | EPOLLONESHOT;
+            ev.data.u64 = id;
+            if (epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, reg->fd, &ev) < 0)
+                LOG_ERROR("iio_hid_reactor: cannot rearm fd " << reg->fd << ", error " << errno);
+        }
+
+        void iio_hid_reactor::check_timeouts()
+        {
+            auto now = std::chrono::steady_clock::now();
+            std::vector<std::shared_ptr<registration>> regs;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (now < _next_timeout_check)
+                    return;
+                _next_timeout_check = now + std::chrono::seconds(1);
+                for (auto && r : _registrations)
+                    regs.push_back(r.second);
+            }
+
+            for (auto && reg : regs)
+            {
+                // A sensor that is being handled right now has not timed out
+                std::unique_lock<std::mutex> lock(reg->mutex, std::try_to_lock);
+                if (lock && reg->active && now - reg->last_event >= HID_FRAMES_TIMEOUT)
+                {
+                    reg->last_event = now;
+                    reg->sensor->notify_frames_timeout();
+                }
+            }
+        }
     }
 }
@@ -6,7 +6,10 @@
 #include "types.h"
 
 #include <limits.h>
+#include <chrono>
 #include <list>
+#include <map>
+#include <mutex>
 
 namespace librealsense
 {
@@ -129,10 +132,49 @@ namespace librealsense
             std::unique_ptr<std::thread> _hid_thread;
         };
 
+        class iio_hid_sensor;
+
+        // Services the IIO buffers of many HID sensors, across devices, from a small, fixed pool of threads using
+        // epoll, instead of a select() thread per sensor. A sensor is only ever handled by one thread at a time.
+        // Enabled via the "hid-poll-threads" context setting; by default each sensor polls on its own thread.
+        class iio_hid_reactor
+        {
+        public:
+            explicit iio_hid_reactor(int threads);
+            ~iio_hid_reactor();
+
+            void add(iio_hid_sensor * sensor, int fd);
+            // Once this returns, the sensor will not be called again
+            void remove(iio_hid_sensor * sensor);
+
+        private:
+            struct registration
+            {
+                iio_hid_sensor * sensor;
+                int fd;
+                std::mutex mutex;       // held while the sensor is being handled
+                bool active = true;
+                std::chrono::steady_clock::time_point last_event;
+            };
+
+            void run();
+            void dispatch(uint64_t id);
+            void check_timeouts();
+
+            int _epoll_fd = -1;
+            int _stop_fd = -1;  // eventfd, signalled once on destruction to release all threads
+            std::vector<std::thread> _threads;
+            std::mutex _mutex;
+            uint64_t _next_id = 1;  // 0 is reserved for _stop_fd
+            std::map<uint64_t, std::shared_ptr<registration>> _registrations;
+            std::chrono::steady_clock::time_point _next_timeout_check;
+        };
+
         // declare device sensor with all of its inputs.
         class iio_hid_sensor {
         public:
-            iio_hid_sensor(const std::string& device_path, uint32_t frequency, float sensitivity);
+            // A non-zero 'watermark' is the number of samples the IIO buffer collects before waking its reader
+            iio_hid_sensor(const std::string& device_path, uint32_t frequency, float sensitivity, uint32_t watermark = 0);
 
             ~iio_hid_sensor();
 
@@ -143,6 +185,12 @@ namespace librealsense
 
             const std::string& get_sensor_name() const { return _sensor_name; }
 
+            void set_poll_reactor(std::shared_ptr<iio_hid_reactor> reactor) { _reactor = std::move(reactor); }
+
+            // Reads the samples waiting in the IIO buffer, and calls back with each
+            void poll_ready();
+            void notify_frames_timeout();
+
         private:
             void clear_buffer();
 
@@ -159,7 +207,7 @@ namespace librealsense
             void create_channel_array();
 
             // initialize the device sensor. reading its name and all of its inputs.
-            void init(uint32_t frequency, float sensitivity);
+            void init(uint32_t frequency, float sensitivity, uint32_t watermark);
 
             // calculate the storage size of a scan
             uint32_t get_channel_size() const;
@@ -185,7 +233,11 @@ namespace librealsense
             std::list<hid_input*> _channels;
             hid_callback _callback;
             std::atomic<bool> _is_capturing;
-            std::unique_ptr<std::thread> _hid_thread;
+            std::unique_ptr<std::thread> _hid_thread;   // unless polled by _reactor
+            std::shared_ptr<iio_hid_reactor> _reactor;
+            std::vector<uint8_t> _raw_data;             // room for a full IIO buffer, while capturing
+            uint32_t _channel_size = 0;
+            bool _has_metadata = false;
             std::unique_ptr<std::thread> _pm_thread;    // Delayed initialization due to power-up sequence
             dispatcher                  _pm_dispatcher; // Asynchronous power management
         };
@@ -217,6 +269,9 @@ namespace librealsense
 
             void set_gyro_scale_factor( double scale_factor ) override{};
 
+            void set_poll_reactor(std::shared_ptr<iio_hid_reactor> reactor) { _reactor = std::move(reactor); }
+            void set_watermark(uint32_t watermark) { _watermark = watermark; }
+
         private:
             static bool get_hid_device_info(const char* dev_path, hid_device_info& device_info);
 
@@ -226,6 +281,8 @@ namespace librealsense
             std::vector<std::unique_ptr<hid_custom_sensor>> _hid_custom_sensors;
             std::vector<iio_hid_sensor*> _streaming_iio_sensors;
             std::vector<hid_custom_sensor*> _streaming_custom_sensors;
+            std::shared_ptr<iio_hid_reactor> _reactor;
+            uint32_t _watermark = 0;
             static constexpr const char* custom_id{"custom"};
         };
     }
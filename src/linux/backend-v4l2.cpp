@@ -6,6 +6,7 @@
 #include <src/platform/hid-data.h>
 #include <src/core/time-service.h>
 #include <src/core/notification.h>
+#include <src/frame-trace.h>
 #include "backend-hid.h"
 #include "backend.h"
 #include "types.h"
@@ -13,11 +14,14 @@
 #include "udev-device-watcher.h"
 #else
 #include "../polling-device-watcher.h"
+#include "../proc/worker-pool.h"
 #endif
 #include "usb/usb-enumerator.h"
 #include "usb/usb-device.h"
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
+#include <rsutils/concurrency/thread-policy.h>
 
 #include <cassert>
 #include <cstdlib>
@@ -57,6 +61,11 @@
 #include <cstddef> // offsetof
 
 #include <sys/signalfd.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <poll.h>
 #include <signal.h>
 #pragma GCC diagnostic ignored "-Woverflow"
 
@@ -527,6 +536,63 @@ namespace librealsense
             return res;
         }
 
+        // The NUMA node of the (PCI) USB host controller a sysfs device is under, or -1 if unknown:
+        // /sys/devices/pci0000:80/0000:80:14.0/usb3/3-1/3-1:1.0/video4linux/video0 is on 0000:80:14.0/numa_node
+        static int get_numa_node(const std::string & sysfs_path)
+        {
+            char actual_path[PATH_MAX] = {0};
+            if (realpath(sysfs_path.c_str(), actual_path) == nullptr)
+                return -1;
+            std::string path(actual_path);
+            while (path.size() > 1)
+            {
+                int node = -1;
+                if (std::ifstream(path + "/numa_node") >> node)
+                    return node;
+                path.resize(path.find_last_of('/'));
+            }
+            return -1;
+        }
+
+        // Keeps the calling thread, and the memory it allocates, on the given NUMA node: the thread is restricted to
+        // the node's CPUs (within whatever affinity it already has), and its allocations prefer the node's memory
+        static void bind_thread_to_numa_node(int node)
+        {
+            std::string cpulist;
+            if (!(std::ifstream("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist") >> cpulist))
+            {
+                LOG_WARNING("Cannot read the CPUs of NUMA node " << node);
+                return;
+            }
+
+            cpu_set_t current, node_cpus;
+            CPU_ZERO(&node_cpus);
+            std::istringstream ss(cpulist);  // e.g., "0-7,16-23"
+            for (std::string range; std::getline(ss, range, ',');)
+            {
+                auto const dash = range.find('-');
+                int const first = std::atoi(range.c_str());
+                int const last = dash == std::string::npos ? first : std::atoi(range.c_str() + dash + 1);
+                for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu)
+                    CPU_SET(cpu, &node_cpus);
+            }
+            if (pthread_getaffinity_np(pthread_self(), sizeof(current), &current) == 0)
+            {
+                CPU_AND(&current, &current, &node_cpus);
+                if (CPU_COUNT(&current) && pthread_setaffinity_np(pthread_self(), sizeof(current), &current) != 0)
+                    LOG_WARNING("Cannot move capture thread to the CPUs of NUMA node " << node);
+            }
+
+            // Not through libnuma, which we do not depend on
+            unsigned long nodemask[16] = {};
+            auto const bits = sizeof(nodemask[0]) * 8;
+            if (node >= int(sizeof(nodemask) * 8))
+                return;
+            nodemask[node / bits] = 1UL << (node % bits);
+            if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, nodemask, sizeof(nodemask) * 8) != 0)
+                LOG_WARNING("Cannot set the memory policy of the capture thread to NUMA node " << node << ", error " << errno);
+        }
+
         // Retrieve device video capabilities to discriminate video capturing and metadata nodes
         static v4l2_capability get_dev_capabilities(const std::string dev_name)
         {
@@ -911,9 +977,14 @@ namespace librealsense
 
         void v4l_uvc_device::foreach_uvc_device(
                 std::function<void(const uvc_device_info&,
-                                   const std::string&)> action)
+                                   const std::string&)> action,
+                std::function<bool(const std::string&)> filter)
         {
             std::vector<std::string> video_paths = get_video_paths();
+            if (filter)
+                video_paths.erase(std::remove_if(video_paths.begin(), video_paths.end(),
+                                                 [&](const std::string& path) { return !filter(path); }),
+                                  video_paths.end());
             typedef std::pair<uvc_device_info,std::string> node_info;
             std::vector<node_info> uvc_nodes,uvc_devices;
             std::vector<node_info> mipi_rs_enum_nodes;
@@ -921,7 +992,7 @@ namespace librealsense
             std::vector<std::string> video_sensors = {"depth", "color", "ir", "imu"};
             const int MAX_V4L2_DEVICES = 8; // assume maximum 8 mipi devices
 
-            for ( int i = 0; i < MAX_V4L2_DEVICES; i++ ) {
+            for ( int i = 0; i < MAX_V4L2_DEVICES && !filter; i++ ) {  // MIPI nodes never pass a filter
                 for (const auto &vs: video_sensors) {
                     int vfd = -1;
                     std::string device_path = "video-rs-" + vs + "-" + std::to_string(i);
@@ -992,9 +1063,12 @@ namespace librealsense
             }
 
             // Collect UVC nodes info to bundle metadata and video
-
-            for(auto&& video_path : video_paths)
+            // Every node means several sysfs reads and a QUERYCAP; with many cameras connected, they are collected in
+            // parallel, then kept in video_paths order
+            std::vector< std::unique_ptr< node_info > > collected( video_paths.size() );
+            auto collect = [&]( size_t i )
             {
+                auto const & video_path = video_paths[i];
                 // following line grabs video0 from
                 auto name = video_path.substr(video_path.find_last_of('/') + 1);
 
@@ -1011,25 +1085,36 @@ namespace librealsense
                         static const std::regex rs_mipi_compatible(".vi:|ipu6");
                         info = get_info_from_mipi_device_path(video_path, name);
                         if (!regex_search(info.unique_id, rs_mipi_compatible)) {
-                            continue;
+                            return;
                         }
                     }
                     else // continue as we already have mipi nodes enumerated by rs links in uvc_nodes
                     {
-                        continue;
+                        return;
                     }
 
                     std::string dev_name;
                     if (get_devname_from_video_path(video_path, dev_name))
                     {
-                        uvc_nodes.emplace_back(info, dev_name);
+                        collected[i].reset( new node_info( info, dev_name ) );
                     }
                 }
                 catch(const std::exception & e)
                 {
                     LOG_INFO("Not a USB video device: " << e.what());
                 }
-            }
+            };
+            // A single camera has a handful of nodes: not worth waking any threads for
+            static const size_t NODES_PER_THREAD = 4;
+            worker_pool::shared()->parallel_for( 0, video_paths.size(), video_paths.size() / NODES_PER_THREAD,
+                                                 [&]( size_t begin, size_t end )
+                                                 {
+                                                     for( auto i = begin; i < end; ++i )
+                                                         collect( i );
+                                                 } );
+            for( auto & node : collected )
+                if( node )
+                    uvc_nodes.push_back( std::move( *node ) );
 
             // Matching video and metadata nodes
             // Assume uvc_nodes is already sorted according to videoXX (video0, then video1...)
@@ -1170,6 +1255,7 @@ namespace librealsense
         v4l_uvc_device::~v4l_uvc_device()
         {
             _is_capturing = false;
+            if (_reactor) _reactor->remove(this);
             if (_thread && _thread->joinable()) _thread->join();
             for (auto&& fd : _fds)
             {
@@ -1179,6 +1265,19 @@ namespace librealsense
 
         void v4l_uvc_device::probe_and_commit(stream_profile profile, frame_callback callback, int buffers)
         {
+            if (_parked && !_is_capturing && !_callback)
+            {
+                if (profile == _profile && _buffers.size() == static_cast<size_t>(buffers))
+                {
+                    // Warm restart: the format, frame rate and buffers are still those of this profile
+                    LOG_DEBUG("Reusing kernel buffers of " << _name);
+                    _parked = false;
+                    _callback = callback;
+                    return;
+                }
+                release_parked();
+            }
+
             if(!_is_capturing && !_callback)
             {
                 v4l2_fmtdesc pixel_format = {};
@@ -1267,10 +1366,25 @@ namespace librealsense
                 streamon();
 
                 _is_capturing = true;
-                _thread = std::unique_ptr<std::thread>(new std::thread([this](){ capture_loop(); }));
 
                 // Starting the video/metadata syncer
                 _video_md_syncer.start();
+
+                if (_reactor)
+                {
+                    std::vector<int> fds;
+                    std::copy_if(_fds.begin(), _fds.end(), std::back_inserter(fds),
+                                 [this](int fd) { return fd != _stop_pipe_fd[0] && fd != _stop_pipe_fd[1]; });
+                    _reactor->add(this, fds);
+                }
+                else
+                    _thread = std::unique_ptr<std::thread>(new std::thread([this](){
+                        rsutils::concurrency::apply_thread_policy( "v4l2" );
+                        // Frames are allocated on this thread, so this keeps them local to the USB controller
+                        if (_numa_node >= 0)
+                            bind_thread_to_numa_node(_numa_node);
+                        capture_loop();
+                    }));
             }
         }
 
@@ -1285,10 +1399,18 @@ namespace librealsense
             _is_started = false;
 
             // Stop nn-demand frames polling
-            signal_stop();
+            if (_reactor)
+            {
+                _video_md_syncer.stop();
+                _reactor->remove(this);
+            }
+            else
+            {
+                signal_stop();
 
-            _thread->join();
-            _thread.reset();
+                _thread->join();
+                _thread.reset();
+            }
 
             // Notify kernel
             streamoff();
@@ -1321,6 +1443,38 @@ namespace librealsense
 
                 _callback = nullptr;
             }
+            release_parked();
+        }
+
+        void v4l_uvc_device::park(stream_profile)
+        {
+            if(_is_capturing)
+            {
+                stop_data_capture();
+            }
+
+            if (_callback)
+            {
+                // STREAMOFF took all the buffers back from the kernel; they are queued again by the next stream_on()
+                detach_io_buffers();
+                _callback = nullptr;
+                _parked = true;
+            }
+        }
+
+        void v4l_uvc_device::release_parked()
+        {
+            if (!_parked)
+                return;
+            _parked = false;
+            allocate_io_buffers(0);
+            negotiate_kernel_buffers(0);
+        }
+
+        void v4l_uvc_device::detach_io_buffers()
+        {
+            for (auto&& buf : _buffers)
+                buf->detach_buffer();
         }
 
         std::string v4l_uvc_device::fourcc_to_string(uint32_t id) const
@@ -1435,223 +1589,262 @@ namespace librealsense
                     }
                     else // Check and acquire data buffers from kernel
                     {
-                        bool md_extracted = false;
-                        bool keep_md = false;
-                        bool wa_applied = false;
-                        buffers_mgr buf_mgr(_use_memory_map);
-                        if (_buf_dispatch.metadata_size())
-                        {
-                            buf_mgr = _buf_dispatch;    // Handle over MD buffer from the previous cycle
-                            md_extracted = true;
-                            wa_applied = true;
-                            _buf_dispatch.set_md_attributes(0,nullptr);
-                        }
+                        handle_ready_buffers(fds);
+                    }
+                }
+                else // (val==0)
+                {
+                    notify_frames_timeout();
+                }
+            }
+        }
 
-                        // Relax the required frame size for compressed formats, i.e. MJPG, Z16H
-                        bool compressed_format = val_in_range(_profile.format, { 0x4d4a5047U , 0x5a313648U});
+        void v4l_uvc_device::poll_ready()
+        {
+            try
+            {
+                // The reactor only tells us something is ready; find out exactly what, without waiting
+                std::vector<pollfd> pfds;
+                for (auto fd : _fds)
+                    if (fd != _stop_pipe_fd[0] && fd != _stop_pipe_fd[1])
+                        pfds.push_back({ fd, POLLIN, 0 });
+                if (!_is_capturing || ::poll(pfds.data(), pfds.size(), 0) <= 0)
+                    return;
 
-                        // METADATA STREAM
-                        // Read metadata. Metadata node performs a blocking call to ensure video and metadata sync
-                        acquire_metadata(buf_mgr,fds,compressed_format);
-                        md_extracted = true;
+                fd_set fds{};
+                FD_ZERO(&fds);
+                for (auto & pfd : pfds)
+                    if (pfd.revents & POLLIN)
+                        FD_SET(pfd.fd, &fds);
+                handle_ready_buffers(fds);
+            }
+            catch (const std::exception& ex)
+            {
+                LOG_ERROR(ex.what());
 
-                        if (wa_applied)
-                        {
-                            auto fn = *(uint32_t*)((char*)(buf_mgr.metadata_start())+28);
-                            LOG_DEBUG_V4L("Extracting md buff, fn = " << fn);
-                        }
+                librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_UNKNOWN_ERROR, 0, RS2_LOG_SEVERITY_ERROR, ex.what()};
+
+                _error_handler(n);
+            }
+        }
+
+        void v4l_uvc_device::notify_frames_timeout()
+        {
+            LOG_WARNING("Frames didn't arrived within 5 seconds");
+            librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_FRAMES_TIMEOUT, 0, RS2_LOG_SEVERITY_WARN,  "Frames didn't arrived within 5 seconds"};
+
+            _error_handler(n);
+        }
+
+        void v4l_uvc_device::handle_ready_buffers(fd_set & fds)
+        {
+            bool md_extracted = false;
+            bool keep_md = false;
+            bool wa_applied = false;
+            buffers_mgr buf_mgr(_use_memory_map);
+            if (_buf_dispatch.metadata_size())
+            {
+                buf_mgr = _buf_dispatch;    // Handle over MD buffer from the previous cycle
+                md_extracted = true;
+                wa_applied = true;
+                _buf_dispatch.set_md_attributes(0,nullptr);
+            }
 
-                        // VIDEO STREAM
-                        if(FD_ISSET(_fd, &fds))
+            // Relax the required frame size for compressed formats, i.e. MJPG, Z16H
+            bool compressed_format = val_in_range(_profile.format, { 0x4d4a5047U , 0x5a313648U});
+
+            // METADATA STREAM
+            // Read metadata. Metadata node performs a blocking call to ensure video and metadata sync
+            acquire_metadata(buf_mgr,fds,compressed_format);
+            md_extracted = true;
+
+            if (wa_applied)
+            {
+                auto fn = *(uint32_t*)((char*)(buf_mgr.metadata_start())+28);
+                LOG_DEBUG_V4L("Extracting md buff, fn = " << fn);
+            }
+
+            // VIDEO STREAM
+            if(FD_ISSET(_fd, &fds))
+            {
+                FD_CLR(_fd,&fds);
+                v4l2_buffer buf = {};
+                struct v4l2_plane planes[VIDEO_MAX_PLANES] = {};
+                buf.type = _dev.buf_type;
+                buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+                if (_dev.buf_type == V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE) {
+                    buf.m.planes = planes;
+                    buf.length = VIDEO_MAX_PLANES;
+                }
+                if(xioctl(_fd, VIDIOC_DQBUF, &buf) < 0)
+                {
+                    LOG_DEBUG_V4L("Dequeued empty buf for fd " << std::dec << _fd);
+                }
+                LOG_DEBUG_V4L("Dequeued buf " << std::dec << buf.index << " for fd " << _fd << " seq " << buf.sequence);
+                buf.type = _dev.buf_type;
+                buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+                if (_dev.buf_type == V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE) {
+                    buf.bytesused = buf.m.planes[0].bytesused;
+                }
+                auto buffer = _buffers[buf.index];
+                buf_mgr.handle_buffer(e_video_buf, _fd, buf, buffer);
+
+                if (_is_started)
+                {
+                    if(buf.bytesused == 0)
+                    {
+                        LOG_DEBUG_V4L("Empty video frame arrived, index " << buf.index);
+                        return;
+                    }
+
+                    // Drop partial and overflow frames (assumes D4XX metadata only)
+                    bool partial_frame = (!compressed_format && (buf.bytesused < buffer->get_full_length() - MAX_META_DATA_SIZE));
+                    bool overflow_frame = (buf.bytesused ==  buffer->get_length_frame_only() + MAX_META_DATA_SIZE);
+                    if (_dev.buf_type == V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE) {
+                        /* metadata size is one line of profile, temporary disable validation */
+                        partial_frame = false;
+                        overflow_frame = false;
+                    }
+                    if (partial_frame || overflow_frame)
+                    {
+                        auto percentage = (100 * buf.bytesused) / buffer->get_full_length();
+                        std::stringstream s;
+                        if (partial_frame)
                         {
-                            FD_CLR(_fd,&fds);
-                            v4l2_buffer buf = {};
-                            struct v4l2_plane planes[VIDEO_MAX_PLANES] = {};
-                            buf.type = _dev.buf_type;
-                            buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
-                            if (_dev.buf_type == V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE) {
-                                buf.m.planes = planes;
-                                buf.length = VIDEO_MAX_PLANES;
-                            }
-                            if(xioctl(_fd, VIDIOC_DQBUF, &buf) < 0)
+                            s << "Incomplete video frame detected!\nSize " << buf.bytesused
+                                << " out of " << buffer->get_full_length() << " bytes (" << percentage << "%)";
+                            if (overflow_frame)
                             {
-                                LOG_DEBUG_V4L("Dequeued empty buf for fd " << std::dec << _fd);
-                            }
-                            LOG_DEBUG_V4L("Dequeued buf " << std::dec << buf.index << " for fd " << _fd << " seq " << buf.sequence);
-                            buf.type = _dev.buf_type;
-                            buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
-                            if (_dev.buf_type == V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE) {
-                                buf.bytesused = buf.m.planes[0].bytesused;
+                                s << ". Overflow detected: payload size " << buffer->get_length_frame_only();
+                                LOG_ERROR("Corrupted UVC frame data, underflow and overflow reported:\n" << s.str().c_str());
                             }
-                            auto buffer = _buffers[buf.index];
-                            buf_mgr.handle_buffer(e_video_buf, _fd, buf, buffer);
+                        }
+                        else
+                        {
+                            if (overflow_frame)
+                                s << "overflow video frame detected!\nSize " << buf.bytesused
+                                    << ", payload size " << buffer->get_length_frame_only();
+                        }
+                        LOG_DEBUG("Incomplete frame received: " << s.str()); // Ev -try1
+                        bool kpi_violated = _frame_drop_monitor.update_and_check_kpi(_profile, buf.timestamp);
+                        if (kpi_violated)
+                        {
+                            librealsense::notification n = { RS2_NOTIFICATION_CATEGORY_FRAME_CORRUPTED, 0, RS2_LOG_SEVERITY_WARN, s.str() };
+                            _error_handler(n);
+                        }
 
-                            if (_is_started)
+                        // Check if metadata was already allocated
+                        if (buf_mgr.metadata_size())
+                        {
+                            LOG_WARNING("Metadata was present when partial frame arrived, mark md as extracted");
+                            md_extracted = true;
+                            LOG_DEBUG_V4L("Discarding md due to invalid video payload");
+                            auto md_buf = buf_mgr.get_buffers().at(e_metadata_buf);
+                            md_buf._data_buf->request_next_frame(md_buf._file_desc,true);
+                        }
+                    }
+                    else
+                    {
+                        if (!_info.has_metadata_node)
+                        {
+                            if(has_metadata())
                             {
-                                if(buf.bytesused == 0)
+                                auto timestamp = (double)buf.timestamp.tv_sec*1000.f + (double)buf.timestamp.tv_usec/1000.f;
+                                timestamp = monotonic_to_realtime(timestamp);
+
+                                // Read metadata. Metadata node performs a blocking call to ensure video and metadata sync
+                                acquire_metadata(buf_mgr,fds,compressed_format);
+                                md_extracted = true;
+
+                                if (wa_applied)
                                 {
-                                    LOG_DEBUG_V4L("Empty video frame arrived, index " << buf.index);
-                                    return;
+                                    auto fn = *(uint32_t*)((char*)(buf_mgr.metadata_start())+28);
+                                    LOG_DEBUG_V4L("Extracting md buff, fn = " << fn);
                                 }
 
-                                // Drop partial and overflow frames (assumes D4XX metadata only)
-                                bool partial_frame = (!compressed_format && (buf.bytesused < buffer->get_full_length() - MAX_META_DATA_SIZE));
-                                bool overflow_frame = (buf.bytesused ==  buffer->get_length_frame_only() + MAX_META_DATA_SIZE);
-                                if (_dev.buf_type == V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE) {
-                                    /* metadata size is one line of profile, temporary disable validation */
-                                    partial_frame = false;
-                                    overflow_frame = false;
+                                auto frame_sz = buf_mgr.md_node_present() ? buf.bytesused :
+                                                    std::min(buf.bytesused - buf_mgr.metadata_size(), buffer->get_length_frame_only());
+                                frame_object fo{ frame_sz, buf_mgr.metadata_size(),
+                                                 buffer->get_frame_start(), buf_mgr.metadata_start(), timestamp };
+
+                                buffer->attach_buffer(buf);
+                                buf_mgr.handle_buffer(e_video_buf,-1); // transfer new buffer request to the frame callback
+
+                                if (buf_mgr.verify_vd_md_sync())
+                                {
+                                    //Invoke user callback and enqueue next frame
+                                    _callback(_profile, fo, [buf_mgr]() mutable {
+                                        buf_mgr.request_next_frame();
+                                    });
                                 }
-                                if (partial_frame || overflow_frame)
+                                else
                                 {
-                                    auto percentage = (100 * buf.bytesused) / buffer->get_full_length();
-                                    std::stringstream s;
-                                    if (partial_frame)
-                                    {
-                                        s << "Incomplete video frame detected!\nSize " << buf.bytesused
-                                            << " out of " << buffer->get_full_length() << " bytes (" << percentage << "%)";
-                                        if (overflow_frame)
-                                        {
-                                            s << ". Overflow detected: payload size " << buffer->get_length_frame_only();
-                                            LOG_ERROR("Corrupted UVC frame data, underflow and overflow reported:\n" << s.str().c_str());
-                                        }
-                                    }
-                                    else
-                                    {
-                                        if (overflow_frame)
-                                            s << "overflow video frame detected!\nSize " << buf.bytesused
-                                                << ", payload size " << buffer->get_length_frame_only();
-                                    }
-                                    LOG_DEBUG("Incomplete frame received: " << s.str()); // Ev -try1
-                                    bool kpi_violated = _frame_drop_monitor.update_and_check_kpi(_profile, buf.timestamp);
-                                    if (kpi_violated)
-                                    {
-                                        librealsense::notification n = { RS2_NOTIFICATION_CATEGORY_FRAME_CORRUPTED, 0, RS2_LOG_SEVERITY_WARN, s.str() };
-                                        _error_handler(n);
-                                    }
-                                    
-                                    // Check if metadata was already allocated
-                                    if (buf_mgr.metadata_size())
+                                    LOG_WARNING("Video frame dropped, video and metadata buffers inconsistency");
+                                }
+                            }
+                            else // when metadata is not enabled at all, streaming only video
+                            {
+                                auto timestamp = (double)buf.timestamp.tv_sec * 1000.f + (double)buf.timestamp.tv_usec / 1000.f;
+                                timestamp = monotonic_to_realtime(timestamp);
+
+                                LOG_DEBUG_V4L("no metadata streamed");
+                                if (buf_mgr.verify_vd_md_sync())
+                                {
+                                    buffer->attach_buffer(buf);
+                                    buf_mgr.handle_buffer(e_video_buf, -1); // transfer new buffer request to the frame callback
+
+
+                                    auto frame_sz = buf_mgr.md_node_present() ? buf.bytesused :
+                                                        std::min(buf.bytesused - buf_mgr.metadata_size(),
+                                                                 buffer->get_length_frame_only());
+
+                                    uint8_t md_size = buf_mgr.metadata_size();
+                                    void* md_start = buf_mgr.metadata_start();
+
+                                    // D457 development - hid over uvc - md size for IMU is 64
+                                    metadata_hid_raw meta_data{};
+                                    if (md_size == 0 && buffer->get_length_frame_only() <= 64)
                                     {
-                                        LOG_WARNING("Metadata was present when partial frame arrived, mark md as extracted");
-                                        md_extracted = true;
-                                        LOG_DEBUG_V4L("Discarding md due to invalid video payload");
-                                        auto md_buf = buf_mgr.get_buffers().at(e_metadata_buf);
-                                        md_buf._data_buf->request_next_frame(md_buf._file_desc,true);
+                                        // Populate HID IMU data - Header
+                                        populate_imu_data(meta_data, buffer->get_frame_start(), md_size, &md_start);
                                     }
+
+                                    frame_object fo{ frame_sz, md_size,
+                                                buffer->get_frame_start(), md_start, timestamp };
+
+                                    //Invoke user callback and enqueue next frame
+                                    _callback(_profile, fo, [buf_mgr]() mutable {
+                                        buf_mgr.request_next_frame();
+                                    });
                                 }
                                 else
                                 {
-                                    if (!_info.has_metadata_node)
-                                    {
-                                        if(has_metadata())
-                                        {
-                                            auto timestamp = (double)buf.timestamp.tv_sec*1000.f + (double)buf.timestamp.tv_usec/1000.f;
-                                            timestamp = monotonic_to_realtime(timestamp);
-
-                                            // Read metadata. Metadata node performs a blocking call to ensure video and metadata sync
-                                            acquire_metadata(buf_mgr,fds,compressed_format);
-                                            md_extracted = true;
-
-                                            if (wa_applied)
-                                            {
-                                                auto fn = *(uint32_t*)((char*)(buf_mgr.metadata_start())+28);
-                                                LOG_DEBUG_V4L("Extracting md buff, fn = " << fn);
-                                            }
-
-                                            auto frame_sz = buf_mgr.md_node_present() ? buf.bytesused :
-                                                                std::min(buf.bytesused - buf_mgr.metadata_size(), buffer->get_length_frame_only());
-                                            frame_object fo{ frame_sz, buf_mgr.metadata_size(),
-                                                             buffer->get_frame_start(), buf_mgr.metadata_start(), timestamp };
-
-                                            buffer->attach_buffer(buf);
-                                            buf_mgr.handle_buffer(e_video_buf,-1); // transfer new buffer request to the frame callback
-
-                                            if (buf_mgr.verify_vd_md_sync())
-                                            {
-                                                //Invoke user callback and enqueue next frame
-                                                _callback(_profile, fo, [buf_mgr]() mutable {
-                                                    buf_mgr.request_next_frame();
-                                                });
-                                            }
-                                            else
-                                            {
-                                                LOG_WARNING("Video frame dropped, video and metadata buffers inconsistency");
-                                            }
-                                        }
-                                        else // when metadata is not enabled at all, streaming only video
-                                        {
-                                            auto timestamp = (double)buf.timestamp.tv_sec * 1000.f + (double)buf.timestamp.tv_usec / 1000.f;
-                                            timestamp = monotonic_to_realtime(timestamp);
-
-                                            LOG_DEBUG_V4L("no metadata streamed");
-                                            if (buf_mgr.verify_vd_md_sync())
-                                            {
-                                                buffer->attach_buffer(buf);
-                                                buf_mgr.handle_buffer(e_video_buf, -1); // transfer new buffer request to the frame callback
-
-
-                                                auto frame_sz = buf_mgr.md_node_present() ? buf.bytesused :
-                                                                    std::min(buf.bytesused - buf_mgr.metadata_size(),
-                                                                             buffer->get_length_frame_only());
-
-                                                uint8_t md_size = buf_mgr.metadata_size();
-                                                void* md_start = buf_mgr.metadata_start();
-
-                                                // D457 development - hid over uvc - md size for IMU is 64
-                                                metadata_hid_raw meta_data{};
-                                                if (md_size == 0 && buffer->get_length_frame_only() <= 64)
-                                                {
-                                                    // Populate HID IMU data - Header
-                                                    populate_imu_data(meta_data, buffer->get_frame_start(), md_size, &md_start);
-                                                }
-
-                                                frame_object fo{ frame_sz, md_size,
-                                                            buffer->get_frame_start(), md_start, timestamp };
-
-                                                //Invoke user callback and enqueue next frame
-                                                _callback(_profile, fo, [buf_mgr]() mutable {
-                                                    buf_mgr.request_next_frame();
-                                                });
-                                            }
-                                            else
-                                            {
-                                                LOG_WARNING("Video frame dropped, video and metadata buffers inconsistency");
-                                            }
-                                        }
-                                    }
-                                    else
-                                    {
-                                        // saving video buffer to syncer
-                                        _video_md_syncer.push_video({std::make_shared<v4l2_buffer>(buf), _fd, buf.index});
-                                        buf_mgr.handle_buffer(e_video_buf, -1);
-                                    }
+                                    LOG_WARNING("Video frame dropped, video and metadata buffers inconsistency");
                                 }
                             }
-                            else
-                            {
-                                LOG_DEBUG_V4L("Video frame arrived in idle mode."); // TODO - verification
-                            }
                         }
                         else
                         {
-                            if (_is_started)
-                                keep_md = true;
-                            LOG_DEBUG("FD_ISSET: no data on video node sink");
+                            // saving video buffer to syncer
+                            _video_md_syncer.push_video({buf, _fd, buf.index});
+                            buf_mgr.handle_buffer(e_video_buf, -1);
                         }
-
-                        // pulling synchronized video and metadata and uploading them to user's callback
-                        upload_video_and_metadata_from_syncer(buf_mgr);
                     }
                 }
-                else // (val==0)
+                else
                 {
-                    LOG_WARNING("Frames didn't arrived within 5 seconds");
-                    librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_FRAMES_TIMEOUT, 0, RS2_LOG_SEVERITY_WARN,  "Frames didn't arrived within 5 seconds"};
-
-                    _error_handler(n);
+                    LOG_DEBUG_V4L("Video frame arrived in idle mode."); // TODO - verification
                 }
             }
+            else
+            {
+                if (_is_started)
+                    keep_md = true;
+                LOG_DEBUG("FD_ISSET: no data on video node sink");
+            }
+
+            // pulling synchronized video and metadata and uploading them to user's callback
+            upload_video_and_metadata_from_syncer(buf_mgr);
         }
 
         void v4l_uvc_device::populate_imu_data(metadata_hid_raw& meta_data, uint8_t* frame_start, uint8_t& md_size, void** md_start) const
@@ -1671,58 +1864,73 @@ namespace librealsense
         void v4l_uvc_device::upload_video_and_metadata_from_syncer(buffers_mgr& buf_mgr)
         {
             // uploading to user's callback
-            std::shared_ptr<v4l2_buffer> video_v4l2_buffer;
-            std::shared_ptr<v4l2_buffer> md_v4l2_buffer;
+            v4l2_buffer video_v4l2_buffer = {};
+            v4l2_buffer md_v4l2_buffer = {};
 
             if (_is_started && is_metadata_streamed())
             {
                 int video_fd = -1, md_fd = -1;
-                if (_video_md_syncer.pull_video_with_metadata(video_v4l2_buffer, md_v4l2_buffer, video_fd, md_fd))
+                if (!_video_md_syncer.pull_video_with_metadata(video_v4l2_buffer, md_v4l2_buffer, video_fd, md_fd))
+                {
+                    LOG_DEBUG("video_md_syncer - synchronized video and md could not be pulled");
+                    return;
+                }
+
+                // Drain every pair that is ready, not just one per wakeup; pairs after the first did not arrive on the
+                // current polling iteration, so they get their own buffers manager
+                std::unique_ptr<buffers_mgr> extra_buf_mgr;
+                buffers_mgr * mgr = &buf_mgr;
+                do
                 {
+                    if (frame_trace::enabled())
+                        frame_trace::instant("metadata pairing", frame_trace::frame_tag(video_v4l2_buffer.sequence),
+                                             time_service::get_time());
+
                     // Preparing video buffer
-                    auto video_buffer = get_video_buffer(video_v4l2_buffer->index);
-                    video_buffer->attach_buffer(*video_v4l2_buffer);
+                    auto video_buffer = get_video_buffer(video_v4l2_buffer.index);
+                    video_buffer->attach_buffer(video_v4l2_buffer);
 
                     // happens when the video did not arrive on
                     // the current polling iteration (was taken from the syncer's video queue)
-                    if (buf_mgr.get_buffers()[e_video_buf]._file_desc == -1)
+                    if (mgr->get_buffers()[e_video_buf]._file_desc == -1)
                     {
-                        buf_mgr.handle_buffer(e_video_buf, video_fd, *video_v4l2_buffer, video_buffer);
+                        mgr->handle_buffer(e_video_buf, video_fd, video_v4l2_buffer, video_buffer);
                     }
-                    buf_mgr.handle_buffer(e_video_buf, -1); // transfer new buffer request to the frame callback
+                    mgr->handle_buffer(e_video_buf, -1); // transfer new buffer request to the frame callback
 
                     // Preparing metadata buffer
-                    auto metadata_buffer = get_md_buffer(md_v4l2_buffer->index);
-                    set_metadata_attributes(buf_mgr, md_v4l2_buffer->bytesused, metadata_buffer->get_frame_start());
-                    metadata_buffer->attach_buffer(*md_v4l2_buffer);
+                    auto metadata_buffer = get_md_buffer(md_v4l2_buffer.index);
+                    set_metadata_attributes(*mgr, md_v4l2_buffer.bytesused, metadata_buffer->get_frame_start());
+                    metadata_buffer->attach_buffer(md_v4l2_buffer);
 
-                    if (buf_mgr.get_buffers()[e_metadata_buf]._file_desc == -1)
+                    if (mgr->get_buffers()[e_metadata_buf]._file_desc == -1)
                     {
-                        buf_mgr.handle_buffer(e_metadata_buf, md_fd, *md_v4l2_buffer, metadata_buffer);
+                        mgr->handle_buffer(e_metadata_buf, md_fd, md_v4l2_buffer, metadata_buffer);
                     }
-                    buf_mgr.handle_buffer(e_metadata_buf, -1); // transfer new buffer request to the frame callback
+                    mgr->handle_buffer(e_metadata_buf, -1); // transfer new buffer request to the frame callback
 
-                    auto frame_sz = buf_mgr.md_node_present() ? video_v4l2_buffer->bytesused :
-                                        std::min(video_v4l2_buffer->bytesused - buf_mgr.metadata_size(),
+                    auto frame_sz = mgr->md_node_present() ? video_v4l2_buffer.bytesused :
+                                        std::min(video_v4l2_buffer.bytesused - mgr->metadata_size(),
                                                  video_buffer->get_length_frame_only());
 
-                    auto timestamp = (double)video_v4l2_buffer->timestamp.tv_sec * 1000.f + (double)video_v4l2_buffer->timestamp.tv_usec / 1000.f;
+                    auto timestamp = (double)video_v4l2_buffer.timestamp.tv_sec * 1000.f + (double)video_v4l2_buffer.timestamp.tv_usec / 1000.f;
                     timestamp = monotonic_to_realtime(timestamp);
 
                     // D457 work - to work with "normal camera", use frame_sz as the first input to the following frame_object:
                     //frame_object fo{ buf.bytesused - MAX_META_DATA_SIZE, buf_mgr.metadata_size(),
-                    frame_object fo{ frame_sz, buf_mgr.metadata_size(),
-                                     video_buffer->get_frame_start(), buf_mgr.metadata_start(), timestamp };
+                    frame_object fo{ frame_sz, mgr->metadata_size(),
+                                     video_buffer->get_frame_start(), mgr->metadata_start(), timestamp };
+                    _video_md_syncer.report_unpaired(fo);
 
                     //Invoke user callback and enqueue next frame
-                    _callback(_profile, fo, [buf_mgr]() mutable {
+                    _callback(_profile, fo, [buf_mgr = *mgr]() mutable {
                         buf_mgr.request_next_frame();
                     });
+
+                    extra_buf_mgr.reset(new buffers_mgr(_use_memory_map));
+                    mgr = extra_buf_mgr.get();
                 }
-                else
-                {
-                    LOG_DEBUG("video_md_syncer - synchronized video and md could not be pulled");
-                }
+                while (_is_started && _video_md_syncer.pull_video_with_metadata(video_v4l2_buffer, md_v4l2_buffer, video_fd, md_fd));
             }
         }
 
@@ -2373,6 +2581,13 @@ namespace librealsense
             }
         }
 
+        void v4l_uvc_meta_device::detach_io_buffers()
+        {
+            v4l_uvc_device::detach_io_buffers();
+            for (auto&& buf : _md_buffers)
+                buf->detach_buffer();
+        }
+
         void v4l_uvc_meta_device::map_device_descriptor()
         {
             v4l_uvc_device::map_device_descriptor();
@@ -2541,7 +2756,7 @@ namespace librealsense
                 buf_mgr.handle_buffer(e_metadata_buf, _md_fd, buf, buffer);
 
                 // pushing metadata buffer to syncer
-                _video_md_syncer.push_metadata({std::make_shared<v4l2_buffer>(buf), _md_fd, buf.index});
+                _video_md_syncer.push_metadata({buf, _md_fd, buf.index});
                 buf_mgr.handle_buffer(e_metadata_buf, -1);
             }
         }
@@ -2759,9 +2974,19 @@ namespace librealsense
         std::shared_ptr<uvc_device> v4l_backend::create_uvc_device(uvc_device_info info) const
         {
             bool mipi_device = 0xABCD == info.pid; // D457 development. Not for upstream
-            auto v4l_uvc_dev =        mipi_device ?         std::make_shared<v4l_mipi_device>(info) :
+            std::shared_ptr<v4l_uvc_device> v4l_uvc_dev =
+                                      mipi_device ?         std::make_shared<v4l_mipi_device>(info) :
                               ((!info.has_metadata_node) ?  std::make_shared<v4l_uvc_device>(info) :
                                                             std::make_shared<v4l_uvc_meta_device>(info));
+            v4l_uvc_dev->set_poll_reactor(get_poll_reactor());
+            // Only for devices on their own capture thread: the reactor's threads are shared by all devices
+            bool numa_local_frames;
+            {
+                std::lock_guard<std::mutex> lock(_reactor_mutex);
+                numa_local_frames = _numa_local_frames && !_poll_threads;
+            }
+            if (numa_local_frames)
+                v4l_uvc_dev->set_numa_node(get_numa_node(info.device_path));
 
             return std::make_shared<platform::retry_controls_work_around>(v4l_uvc_dev);
         }
@@ -2778,6 +3003,29 @@ namespace librealsense
             return uvc_nodes;
         }
 
+        std::vector<uvc_device_info> v4l_backend::query_uvc_devices_at(const std::vector<std::string>& devpaths) const
+        {
+            std::vector<uvc_device_info> uvc_nodes;
+            v4l_uvc_device::foreach_uvc_device(
+            [&uvc_nodes](const uvc_device_info& i, const std::string&)
+            {
+                uvc_nodes.push_back(i);
+            },
+            [&devpaths](const std::string& video_path)
+            {
+                // e.g., /sys/devices/pci0000:00/0000:00:14.0/usb2/2-2/2-2:1.0/video4linux/video0 is of .../usb2/2-2
+                for (auto& devpath : devpaths)
+                {
+                    auto const prefix = "/sys" + devpath + "/";
+                    if (video_path.compare(0, prefix.size(), prefix) == 0)
+                        return true;
+                }
+                return false;
+            });
+
+            return uvc_nodes;
+        }
+
         std::shared_ptr<command_transfer> v4l_backend::create_usb_device(usb_device_info info) const
         {
             auto dev = usb_enumerator::create_usb_device(info);
@@ -2794,7 +3042,11 @@ namespace librealsense
 
         std::shared_ptr<hid_device> v4l_backend::create_hid_device(hid_device_info info) const
         {
-            return std::make_shared<v4l_hid_device>(info);
+            auto dev = std::make_shared<v4l_hid_device>(info);
+            std::lock_guard<std::mutex> lock(_reactor_mutex);
+            dev->set_watermark(_hid_watermark);
+            dev->set_poll_reactor(get_hid_reactor());
+            return dev;
         }
 
         std::vector<hid_device_info> v4l_backend::query_hid_devices() const
@@ -2815,6 +3067,249 @@ namespace librealsense
 #endif
         }
 
+        void v4l_backend::apply_settings(const rsutils::json & settings)
+        {
+            std::lock_guard<std::mutex> lock(_reactor_mutex);
+            int threads = settings.nested(std::string("v4l2-poll-threads", 17)).default_value(_poll_threads);
+            if (threads < 0)
+                throw linux_backend_exception("v4l2-poll-threads cannot be negative");
+            _poll_threads = threads;
+
+            int hid_threads = settings.nested(std::string("hid-poll-threads", 16)).default_value(_hid_poll_threads);
+            if (hid_threads < 0)
+                throw linux_backend_exception("hid-poll-threads cannot be negative");
+            _hid_poll_threads = hid_threads;
+            _hid_watermark = settings.nested(std::string("hid-watermark", 13)).default_value(_hid_watermark);
+            _numa_local_frames = settings.nested(std::string("numa-local-frames", 17)).default_value(_numa_local_frames);
+        }
+
+        std::shared_ptr<v4l2_poll_reactor> v4l_backend::get_poll_reactor() const
+        {
+            std::lock_guard<std::mutex> lock(_reactor_mutex);
+            if (!_poll_threads)
+                return nullptr;
+            // Shared by all devices, and alive only while any of them are
+            auto reactor = _reactor.lock();
+            if (!reactor)
+            {
+                reactor = std::make_shared<v4l2_poll_reactor>(_poll_threads);
+                _reactor = reactor;
+            }
+            return reactor;
+        }
+
+        // Called with _reactor_mutex held
+        std::shared_ptr<iio_hid_reactor> v4l_backend::get_hid_reactor() const
+        {
+            if (!_hid_poll_threads)
+                return nullptr;
+            // Shared by all HID devices, and alive only while any of them are
+            auto reactor = _hid_reactor.lock();
+            if (!reactor)
+            {
+                reactor = std::make_shared<iio_hid_reactor>(_hid_poll_threads);
+                _hid_reactor = reactor;
+            }
+            return reactor;
+        }
+
+        static const auto FRAMES_TIMEOUT = std::chrono::seconds(5);
+
+        v4l2_poll_reactor::v4l2_poll_reactor(int threads)
+        {
+            _epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+            if (_epoll_fd < 0)
+                throw linux_backend_exception("v4l2_poll_reactor: epoll_create1 failed");
+
+            _stop_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            epoll_event ev = {};
+            ev.events = EPOLLIN;  // level-triggered, so every thread sees it
+            ev.data.u64 = 0;
+            if (_stop_fd < 0 || epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _stop_fd, &ev) < 0)
+            {
+                if (_stop_fd >= 0) ::close(_stop_fd);
+                ::close(_epoll_fd);
+                throw linux_backend_exception("v4l2_poll_reactor: cannot create stop event");
+            }
+
+            _next_timeout_check = std::chrono::steady_clock::now() + FRAMES_TIMEOUT;
+            for (int i = 0; i < threads; ++i)
+                _threads.emplace_back([this]() {
+                    rsutils::concurrency::apply_thread_policy( "v4l2" );
+                    run();
+                });
+        }
+
+        v4l2_poll_reactor::~v4l2_poll_reactor()
+        {
+            uint64_t one = 1;
+            if (write(_stop_fd, &one, sizeof(one)) < 0)
+                LOG_ERROR("v4l2_poll_reactor: cannot signal the polling threads to stop");
+            for (auto && t : _threads)
+                if (t.joinable()) t.join();
+            ::close(_stop_fd);
+            ::close(_epoll_fd);
+        }
+
+        void v4l2_poll_reactor::add(v4l_uvc_device * dev, const std::vector<int> & fds)
+        {
+            auto reg = std::make_shared<registration>();
+            reg->dev = dev;
+            reg->fds = fds;
+            reg->last_event = std::chrono::steady_clock::now();
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto id = _next_id++;
+            for (auto fd : fds)
+            {
+                // One-shot: the fd is disabled once reported, until we rearm it after the device is done with it
+                epoll_event ev = {};
+                ev.events = EPOLLIN | EPOLLONESHOT;
+                ev.data.u64 = id;
+                if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+                {
+                    for (auto added : fds)
+                    {
+                        if (added == fd) break;
+                        epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, added, nullptr);
+                    }
+                    throw linux_backend_exception(rsutils::string::from() << "v4l2_poll_reactor: cannot add fd " << fd
+                                                                          << ", error " << errno);
+                }
+            }
+            _registrations[id] = reg;
+        }
+
+        void v4l2_poll_reactor::remove(v4l_uvc_device * dev)
+        {
+            std::shared_ptr<registration> reg;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto it = std::find_if(_registrations.begin(), _registrations.end(),
+                                       [dev](const std::pair<const uint64_t, std::shared_ptr<registration>> & r)
+                                       { return r.second->dev == dev; });
+                if (it == _registrations.end())
+                    return;
+                reg = it->second;
+                _registrations.erase(it);
+            }
+
+            // Called back from the device while we handle it: we already hold its lock, and whoever is handling it
+            // unregisters it once the device returns
+            if (reg->handler.load() == std::this_thread::get_id())
+            {
+                reg->active = false;
+                return;
+            }
+
+            // Wait for any thread currently handling the device
+            std::lock_guard<std::mutex> lock(reg->mutex);
+            reg->active = false;
+            unregister(*reg);
+        }
+
+        void v4l2_poll_reactor::unregister(const registration & reg) const
+        {
+            for (auto fd : reg.fds)
+                epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        }
+
+        void v4l2_poll_reactor::run()
+        {
+            while (true)
+            {
+                // One event at a time, so that ready devices are spread between the threads
+                epoll_event ev = {};
+                int n = epoll_wait(_epoll_fd, &ev, 1, 1000);
+                if (n < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    LOG_ERROR("v4l2_poll_reactor: epoll_wait failed, error " << errno);
+                    return;
+                }
+                if (n > 0)
+                {
+                    if (!ev.data.u64)
+                        return;  // stop event
+                    dispatch(ev.data.u64);
+                }
+                check_timeouts();
+            }
+        }
+
+        void v4l2_poll_reactor::dispatch(uint64_t id)
+        {
+            std::shared_ptr<registration> reg;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto it = _registrations.find(id);
+                if (it == _registrations.end())
+                    return;  // removed after the event was reported
+                reg = it->second;
+            }
+
+            std::lock_guard<std::mutex> lock(reg->mutex);
+            if (!reg->active)
+                return;
+            reg->last_event = std::chrono::steady_clock::now();
+            reg->handler = std::this_thread::get_id();
+            reg->dev->poll_ready();
+            reg->handler = std::thread::id();
+            if (reg->active)
+                rearm(*reg, id);
+            else
+                unregister(*reg);  // removed from within poll_ready()
+        }
+
+        void v4l2_poll_reactor::rearm(const registration & reg, uint64_t id) const
+        {
+            for (auto fd : reg.fds)
+            {
+                epoll_event ev = {};
+                ev.events = EPOLLIN | EPOLLONESHOT;
+                ev.data.u64 = id;
+                if (epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, fd, &ev) < 0)
+                    LOG_ERROR("v4l2_poll_reactor: cannot rearm fd " << fd << ", error " << errno);
+            }
+        }
+
+        void v4l2_poll_reactor::check_timeouts()
+        {
+            auto now = std::chrono::steady_clock::now();
+            std::vector<std::shared_ptr<registration>> regs;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (now < _next_timeout_check)
+                    return;
+                _next_timeout_check = now + std::chrono::seconds(1);
+                for (auto && r : _registrations)
+                    regs.push_back(r.second);
+            }
+
+            for (auto && reg : regs)
+            {
+                // A device that is being handled right now has not timed out
+                std::unique_lock<std::mutex> lock(reg->mutex, std::try_to_lock);
+                if (lock && reg->active && now - reg->last_event >= FRAMES_TIMEOUT)
+                {
+                    reg->last_event = now;
+                    reg->handler = std::this_thread::get_id();
+                    try
+                    {
+                        reg->dev->notify_frames_timeout();
+                    }
+                    catch (const std::exception & ex)
+                    {
+                        LOG_ERROR(ex.what());
+                    }
+                    reg->handler = std::thread::id();
+                    if (!reg->active)
+                        unregister(*reg);  // removed from within notify_frames_timeout()
+                }
+            }
+        }
+
         std::shared_ptr<backend> create_backend()
         {
             return std::make_shared<v4l_backend>();
@@ -2829,7 +3324,7 @@ namespace librealsense
                 return;
             }
             _video_queue.push(video_buffer);
-            LOG_DEBUG_V4L("video_md_syncer - video pushed with sequence " << video_buffer._v4l2_buf->sequence << ", buf " << video_buffer._buffer_index);
+            LOG_DEBUG_V4L("video_md_syncer - video pushed with sequence " << video_buffer._v4l2_buf.sequence << ", buf " << video_buffer._buffer_index);
 
             // remove old video_buffer
             if (_video_queue.size() > 2)
@@ -2848,13 +3343,13 @@ namespace librealsense
                 return;
             }
             // override front buffer if it has the same sequence that the new buffer - happens with metadata sequence 0
-            if (_md_queue.size() > 0 && _md_queue.front()._v4l2_buf->sequence == md_buffer._v4l2_buf->sequence)
+            if (_md_queue.size() > 0 && _md_queue.front()._v4l2_buf.sequence == md_buffer._v4l2_buf.sequence)
             {
                 LOG_DEBUG_V4L("video_md_syncer - calling enqueue_front_buffer_before_throwing_it - md buf " << md_buffer._buffer_index << " and md buf " << _md_queue.front()._buffer_index << " have same sequence");
                 enqueue_front_buffer_before_throwing_it(_md_queue);
             }
             _md_queue.push(md_buffer);
-            LOG_DEBUG_V4L("video_md_syncer - md pushed with sequence " << md_buffer._v4l2_buf->sequence << ", buf " << md_buffer._buffer_index);
+            LOG_DEBUG_V4L("video_md_syncer - md pushed with sequence " << md_buffer._v4l2_buf.sequence << ", buf " << md_buffer._buffer_index);
             LOG_DEBUG_V4L("video_md_syncer - md queue size = " << _md_queue.size());
 
             // remove old md_buffer
@@ -2866,7 +3361,7 @@ namespace librealsense
             }
         }
 
-        bool v4l2_video_md_syncer::pull_video_with_metadata(std::shared_ptr<v4l2_buffer>& video_buffer, std::shared_ptr<v4l2_buffer>& md_buffer,
+        bool v4l2_video_md_syncer::pull_video_with_metadata(v4l2_buffer& video_buffer, v4l2_buffer& md_buffer,
                                                             int& video_fd, int& md_fd)
         {
             std::lock_guard<std::mutex> lock(_syncer_mutex);
@@ -2895,88 +3390,99 @@ namespace librealsense
             md_fd = md_candidate._fd;
 
             // sync is ok if latest video and md have the same sequence
-            if (video_candidate._v4l2_buf->sequence == md_candidate._v4l2_buf->sequence)
+            if (video_candidate._v4l2_buf.sequence == md_candidate._v4l2_buf.sequence)
             {
                 video_buffer = video_candidate._v4l2_buf;
                 md_buffer = md_candidate._v4l2_buf;
                 // removing from queues
                 _video_queue.pop();
                 _md_queue.pop();
-                LOG_DEBUG_V4L("video_md_syncer - video and md pulled with sequence " << video_candidate._v4l2_buf->sequence);
+                LOG_DEBUG_V4L("video_md_syncer - video and md pulled with sequence " << video_candidate._v4l2_buf.sequence);
                 return true;
             }
 
-            LOG_DEBUG_V4L("video_md_syncer - video_candidate seq " << video_candidate._v4l2_buf->sequence << ", md_candidate seq " << md_candidate._v4l2_buf->sequence);
+            ++_mismatches;
+            LOG_DEBUG_V4L("video_md_syncer - video_candidate seq " << video_candidate._v4l2_buf.sequence << ", md_candidate seq " << md_candidate._v4l2_buf.sequence);
 
-            if (video_candidate._v4l2_buf->sequence > md_candidate._v4l2_buf->sequence && _md_queue.size() > 1)
+            if (video_candidate._v4l2_buf.sequence > md_candidate._v4l2_buf.sequence && _md_queue.size() > 1)
             {
                 // Enqueue of md buffer before throwing its content away
-                enqueue_buffer_before_throwing_it(md_candidate);
+                enqueue_buffer_before_throwing_it(md_candidate, false);
                 _md_queue.pop();
 
                 // checking remaining metadata buffer in queue
                 auto alternative_md_candidate = _md_queue.front();
                 // sync is ok if latest video and md have the same sequence
-                if (video_candidate._v4l2_buf->sequence == alternative_md_candidate._v4l2_buf->sequence)
+                if (video_candidate._v4l2_buf.sequence == alternative_md_candidate._v4l2_buf.sequence)
                 {
                     video_buffer = video_candidate._v4l2_buf;
                     md_buffer = alternative_md_candidate._v4l2_buf;
                     // removing from queues
                     _video_queue.pop();
                     _md_queue.pop();
-                    LOG_DEBUG_V4L("video_md_syncer - video and md pulled with sequence " << video_candidate._v4l2_buf->sequence);
+                    LOG_DEBUG_V4L("video_md_syncer - video and md pulled with sequence " << video_candidate._v4l2_buf.sequence);
                     return true;
                 }
             }
-            if (video_candidate._v4l2_buf->sequence < md_candidate._v4l2_buf->sequence && _video_queue.size() > 1)
+            if (video_candidate._v4l2_buf.sequence < md_candidate._v4l2_buf.sequence && _video_queue.size() > 1)
             {
                 // Enqueue of md buffer before throwing its content away
-                enqueue_buffer_before_throwing_it(video_candidate);
+                enqueue_buffer_before_throwing_it(video_candidate, true);
                 _video_queue.pop();
 
                 // checking remaining video buffer in queue
                 auto alternative_video_candidate = _video_queue.front();
                 // sync is ok if latest video and md have the same sequence
-                if (alternative_video_candidate._v4l2_buf->sequence == md_candidate._v4l2_buf->sequence)
+                if (alternative_video_candidate._v4l2_buf.sequence == md_candidate._v4l2_buf.sequence)
                 {
                     video_buffer = alternative_video_candidate._v4l2_buf;
                     md_buffer = md_candidate._v4l2_buf;
                     // removing from queues
                     _video_queue.pop();
                     _md_queue.pop();
-                    LOG_DEBUG_V4L("video_md_syncer - video and md pulled with sequence " << md_candidate._v4l2_buf->sequence);
+                    LOG_DEBUG_V4L("video_md_syncer - video and md pulled with sequence " << md_candidate._v4l2_buf.sequence);
                     return true;
                 }
             }
             return false;
         }
 
-        void v4l2_video_md_syncer::enqueue_buffer_before_throwing_it(const sync_buffer& sb) const
+        void v4l2_video_md_syncer::enqueue_buffer_before_throwing_it(const sync_buffer& sb, bool video)
         {
             // Enqueue of buffer before throwing its content away
             LOG_DEBUG_V4L("video_md_syncer - Enqueue buf " << std::dec << sb._buffer_index << " for fd " << sb._fd << " before dropping it");
-            if (xioctl(sb._fd, VIDIOC_QBUF, sb._v4l2_buf.get()) < 0)
+            ++(video ? _video_drops : _md_drops);
+            v4l2_buffer buf = sb._v4l2_buf;
+            if (xioctl(sb._fd, VIDIOC_QBUF, &buf) < 0)
             {
                 LOG_ERROR("xioctl(VIDIOC_QBUF) failed when requesting new frame! fd: " << sb._fd << " error: " << strerror(errno));
             }
         }
 
-        void v4l2_video_md_syncer::enqueue_front_buffer_before_throwing_it(std::queue<sync_buffer>& sync_queue)
+        void v4l2_video_md_syncer::enqueue_front_buffer_before_throwing_it(sync_queue& sync_queue)
         {
-            // Enqueue of buffer before throwing its content away
-            LOG_DEBUG_V4L("video_md_syncer - Enqueue buf " << std::dec << sync_queue.front()._buffer_index << " for fd " << sync_queue.front()._fd << " before dropping it");
-            if (xioctl(sync_queue.front()._fd, VIDIOC_QBUF, sync_queue.front()._v4l2_buf.get()) < 0)
-            {
-                LOG_ERROR("xioctl(VIDIOC_QBUF) failed when requesting new frame! fd: " << sync_queue.front()._fd << " error: " << strerror(errno));
-            }
+            enqueue_buffer_before_throwing_it(sync_queue.front(), &sync_queue == &_video_queue);
             sync_queue.pop();
         }
 
+        void v4l2_video_md_syncer::report_unpaired(frame_object & fo)
+        {
+            std::lock_guard<std::mutex> lock(_syncer_mutex);
+            uint64_t const mismatches = _mismatches, video_drops = _video_drops, md_drops = _md_drops;
+            fo.pairing_mismatches = uint32_t(mismatches - _reported_mismatches);
+            fo.unpaired_frames = uint32_t(video_drops - _reported_video_drops);
+            fo.unpaired_metadata = uint32_t(md_drops - _reported_md_drops);
+            _reported_mismatches = mismatches;
+            _reported_video_drops = video_drops;
+            _reported_md_drops = md_drops;
+        }
+
 
         void v4l2_video_md_syncer::stop()
         {
              _is_ready = false;
              flush_queues();
+             LOG_DEBUG_V4L("video_md_syncer - stopped after " << _mismatches << " sequence mismatches, " << get_drop_count() << " dropped buffers");
         }
 
         void v4l2_video_md_syncer::flush_queues()
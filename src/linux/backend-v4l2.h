@@ -25,6 +25,8 @@
 #include <chrono>
 #include <thread>
 #include <atomic>
+#include <map>
+#include <mutex>
 
 #include <dirent.h>
 #include <fcntl.h>
@@ -257,11 +259,11 @@ namespace librealsense
         class v4l2_video_md_syncer
         {
         public:
-            v4l2_video_md_syncer() : _is_ready(false){}
+            v4l2_video_md_syncer() : _is_ready(false), _mismatches(0), _video_drops(0), _md_drops(0){}
 
             struct sync_buffer
             {
-                std::shared_ptr<v4l2_buffer> _v4l2_buf;
+                v4l2_buffer _v4l2_buf;
                 int _fd;
                 __u32 _buffer_index;
             };
@@ -274,20 +276,59 @@ namespace librealsense
             // pulling synced data
             // if returned value is true - the data could have been pulled
             // if returned value is false - no data is returned via the inout params because data could not be synced
-            bool pull_video_with_metadata(std::shared_ptr<v4l2_buffer>& video_buffer, std::shared_ptr<v4l2_buffer>& md_buffer, int& video_fd, int& md_fd);
+            bool pull_video_with_metadata(v4l2_buffer& video_buffer, v4l2_buffer& md_buffer, int& video_fd, int& md_fd);
 
             inline void start() {_is_ready = true;}
             void stop();
 
+            // Number of times the video and metadata heads had different sequence numbers
+            uint64_t get_mismatch_count() const { return _mismatches; }
+            // Number of buffers given back to the kernel without being delivered
+            uint64_t get_drop_count() const { return _video_drops + _md_drops; }
+            // Adds what was given up on since the last call to the frame about to be delivered, for the drop stats
+            void report_unpaired(frame_object & fo);
+
         private:
-            void enqueue_buffer_before_throwing_it(const sync_buffer& sb) const;
-            void enqueue_front_buffer_before_throwing_it(std::queue<sync_buffer>& sync_queue);
+            // Fixed-capacity FIFO: each queue is trimmed to 2 buffers after every push, so it never allocates
+            class sync_queue
+            {
+            public:
+                bool empty() const { return !_size; }
+                size_t size() const { return _size; }
+                sync_buffer& front() { return _buffers[_head]; }
+                void push(const sync_buffer& sb)
+                {
+                    assert(_size < CAPACITY);
+                    _buffers[(_head + _size++) % CAPACITY] = sb;
+                }
+                void pop()
+                {
+                    _head = (_head + 1) % CAPACITY;
+                    --_size;
+                }
+
+            private:
+                static constexpr size_t CAPACITY = 4;
+                std::array<sync_buffer, CAPACITY> _buffers;
+                size_t _head = 0;
+                size_t _size = 0;
+            };
+
+            void enqueue_buffer_before_throwing_it(const sync_buffer& sb, bool video);
+            void enqueue_front_buffer_before_throwing_it(sync_queue& sync_queue);
             void flush_queues();
 
+            // Pushes and pulls all happen on the device's polling thread; the lock is only contended by stop()
             std::mutex _syncer_mutex;
-            std::queue<sync_buffer> _video_queue;
-            std::queue<sync_buffer> _md_queue;
+            sync_queue _video_queue;
+            sync_queue _md_queue;
             bool _is_ready;
+            std::atomic<uint64_t> _mismatches;
+            std::atomic<uint64_t> _video_drops;
+            std::atomic<uint64_t> _md_drops;
+            uint64_t _reported_mismatches = 0;
+            uint64_t _reported_video_drops = 0;
+            uint64_t _reported_md_drops = 0;
         };
 
         // The aim of the frame_drop_monitor is to check the frames drops kpi - which requires
@@ -310,12 +351,57 @@ namespace librealsense
             double _kpi_frames_drops_pct;
         };
 
+        class v4l_uvc_device;
+        class iio_hid_reactor;
+
+        // Services the video and metadata nodes of many devices from a small, fixed pool of threads using epoll,
+        // instead of a select() thread per device. A device is only ever handled by one thread at a time.
+        // Enabled via the "v4l2-poll-threads" context setting; by default each device polls on its own thread.
+        class v4l2_poll_reactor
+        {
+        public:
+            explicit v4l2_poll_reactor(int threads);
+            ~v4l2_poll_reactor();
+
+            void add(v4l_uvc_device * dev, const std::vector<int> & fds);
+            // Once this returns, the device will not be called again. It may be called from within the device's own
+            // callbacks, on a reactor thread: the device is then let go when its current callback returns.
+            void remove(v4l_uvc_device * dev);
+
+        private:
+            struct registration
+            {
+                v4l_uvc_device * dev;
+                std::vector<int> fds;
+                std::mutex mutex;       // held while the device is being handled
+                std::atomic<std::thread::id> handler;  // the thread holding the mutex, while it handles the device
+                bool active = true;
+                std::chrono::steady_clock::time_point last_event;
+            };
+
+            void run();
+            void dispatch(uint64_t id);
+            void rearm(const registration & reg, uint64_t id) const;
+            void unregister(const registration & reg) const;
+            void check_timeouts();
+
+            int _epoll_fd = -1;
+            int _stop_fd = -1;  // eventfd, signalled once on destruction to release all threads
+            std::vector<std::thread> _threads;
+            std::mutex _mutex;
+            uint64_t _next_id = 1;  // 0 is reserved for _stop_fd
+            std::map<uint64_t, std::shared_ptr<registration>> _registrations;
+            std::chrono::steady_clock::time_point _next_timeout_check;
+        };
+
         class v4l_uvc_device : public uvc_device, public v4l_uvc_interface
         {
         public:
+            // With a 'filter', only the (USB) video nodes whose sysfs path it accepts are looked at
             static void foreach_uvc_device(
                     std::function<void(const uvc_device_info&,
-                                       const std::string&)> action);
+                                       const std::string&)> action,
+                    std::function<bool(const std::string&)> filter = nullptr);
 
             static std::vector<std::string> get_video_paths();
 
@@ -345,12 +431,22 @@ namespace librealsense
 
             void close(stream_profile) override;
 
+            void park(stream_profile) override;
+
             std::string fourcc_to_string(uint32_t id) const;
 
             void signal_stop();
 
             void poll();
 
+            // When set, frames are polled by the shared reactor rather than by a thread of our own
+            void set_poll_reactor(std::shared_ptr<v4l2_poll_reactor> reactor) { _reactor = std::move(reactor); }
+            // When set (>= 0), our capture thread, and so the frames it allocates, are kept on this NUMA node
+            void set_numa_node(int node) { _numa_node = node; }
+            // Called by the reactor when any of our nodes is ready
+            void poll_ready();
+            void notify_frames_timeout();
+
             void set_power_state(power_state state) override;
             power_state get_power_state() const override { return _state; }
 
@@ -380,6 +476,10 @@ namespace librealsense
 
             virtual void capture_loop() override;
 
+            // Buffers the kernel dequeues no longer go back to it; used before releasing or parking them
+            virtual void detach_io_buffers();
+            void release_parked();
+
             virtual bool has_metadata() const override;
 
             virtual void streamon() const override;
@@ -398,6 +498,7 @@ namespace librealsense
             void unsubscribe_from_ctrl_event(uint32_t control_id);
             bool pend_for_ctrl_status_event();
             void upload_video_and_metadata_from_syncer(buffers_mgr& buf_mgr);
+            void handle_ready_buffers(fd_set & fds);
             void populate_imu_data(metadata_hid_raw& meta_data, uint8_t* frame_start, uint8_t& md_size, void** md_start) const;
             // checking if metadata is streamed
             virtual inline bool is_metadata_streamed() const { return false;}
@@ -413,10 +514,13 @@ namespace librealsense
             std::vector<std::shared_ptr<buffer>> _buffers;
             stream_profile _profile;
             frame_callback _callback;
+            bool _parked = false;               // _buffers (and the format) are still set up for _profile, see park()
             std::atomic<bool> _is_capturing;
             std::atomic<bool> _is_alive;
             std::atomic<bool> _is_started;
             std::unique_ptr<std::thread> _thread;
+            std::shared_ptr<v4l2_poll_reactor> _reactor;
+            int _numa_node = -1;
             std::unique_ptr<named_mutex> _named_mtx;
             struct device {
                 enum v4l2_buf_type buf_type;
@@ -453,6 +557,7 @@ namespace librealsense
             void streamoff() const;
             void negotiate_kernel_buffers(size_t num) const;
             void allocate_io_buffers(size_t num);
+            void detach_io_buffers() override;
             void map_device_descriptor();
             void unmap_device_descriptor();
             void set_format(stream_profile profile);
@@ -494,6 +599,8 @@ namespace librealsense
         public:
             std::shared_ptr<uvc_device> create_uvc_device(uvc_device_info info) const override;
             std::vector<uvc_device_info> query_uvc_devices() const override;
+            // Same, but only for the USB devices at the given sysfs paths (as in udev's DEVPATH, without the "/sys")
+            std::vector<uvc_device_info> query_uvc_devices_at(const std::vector<std::string>& devpaths) const;
 
             std::shared_ptr<command_transfer> create_usb_device(usb_device_info info) const override;
             std::vector<usb_device_info> query_usb_devices() const override;
@@ -502,6 +609,20 @@ namespace librealsense
             std::vector<hid_device_info> query_hid_devices() const override;
 
             std::shared_ptr<device_watcher> create_device_watcher() const override;
+
+            void apply_settings(const rsutils::json & settings) override;
+
+        private:
+            std::shared_ptr<v4l2_poll_reactor> get_poll_reactor() const;
+            std::shared_ptr<iio_hid_reactor> get_hid_reactor() const;
+
+            mutable std::mutex _reactor_mutex;
+            int _poll_threads = 0;
+            mutable std::weak_ptr<v4l2_poll_reactor> _reactor;
+            int _hid_poll_threads = 0;
+            uint32_t _hid_watermark = 0;  // IIO buffer watermark, in samples; 0 leaves the driver's
+            bool _numa_local_frames = false;  // capture threads stay on the USB controller's NUMA node
+            mutable std::weak_ptr<iio_hid_reactor> _hid_reactor;
         };
     }
 }
@@ -2,11 +2,13 @@
 // Copyright(c) 2021 Intel Corporation. All Rights Reserved.
 
 #include "udev-device-watcher.h"
+#include "backend-v4l2.h"
 
 #include <poll.h>
 
 #include <string>
 #include <exception>
+#include <algorithm>
 
 using std::string;
 using std::runtime_error;
@@ -112,19 +114,26 @@ udev_device_watcher::udev_device_watcher( const platform::backend * backend )
                 // On remove events, we get all the device interfaces first, and lastly we get the device.
                 // On add events, we get the device first and only then the device interfaces.
                 // In any case, we get lots of adds/removes for each device. And we only want to do one enumeration --
-                // so we wait for things to calm down and just remember that enumeration is needed...
-                _changed = true;
+                // so we wait for things to calm down and just remember what needs enumerating...
+                if( udev_action == "remove" )
+                    _removed = true;
+                else
+                {
+                    char const * devtype = udev_device_get_devtype( udev_dev );
+                    char const * devpath = udev_device_get_devpath( udev_dev );
+                    if( devtype && devpath && ! strcmp( devtype, "usb_device" )
+                        && std::find( _added.begin(), _added.end(), devpath ) == _added.end() )
+                        _added.push_back( devpath );
+                }
             }
 
             udev_device_unref( udev_dev );
         }
-        else if( _changed )
+        else if( _removed || ! _added.empty() )
         {
             // Something's changed but nothing's happened in the last polling period -- let's enumerate!
             LOG_DEBUG( "[udev] checking ..." );
-            platform::backend_device_group curr( _backend->query_uvc_devices(),
-                                                 _backend->query_usb_devices(),
-                                                 _backend->query_hid_devices() );
+            auto curr = enumerate();
             if( list_changed( _devices_data.uvc_devices, curr.uvc_devices )
                 || list_changed( _devices_data.usb_devices, curr.usb_devices )
                 || list_changed( _devices_data.hid_devices, curr.hid_devices ) )
@@ -135,7 +144,8 @@ udev_device_watcher::udev_device_watcher( const platform::backend * backend )
                     _callback( _devices_data, curr );
                 _devices_data = curr;
             }
-            _changed = false;
+            _removed = false;
+            _added.clear();
         }
     } )
 {
@@ -200,6 +210,44 @@ udev_device_watcher::~udev_device_watcher()
 }
 
 
+// Only what changed since the last enumeration is probed, so the other cameras' nodes are not touched
+platform::backend_device_group udev_device_watcher::enumerate() const
+{
+    auto v4l = dynamic_cast< platform::v4l_backend const * >( _backend );
+    if( ! v4l || ( _removed && ! _added.empty() ) )
+    {
+        // Node names of removed devices may have been reused by the added ones: start over
+        return { _backend->query_uvc_devices(), _backend->query_usb_devices(), _backend->query_hid_devices() };
+    }
+
+    auto const exists = []( std::string const & path ) { return access( path.c_str(), F_OK ) == 0; };
+
+    platform::backend_device_group curr;
+    curr.usb_devices = _backend->query_usb_devices();  // from the descriptors the kernel caches; no device I/O
+
+    // The sysfs nodes of removed devices are gone
+    for( auto & uvc : _devices_data.uvc_devices )
+        if( exists( uvc.device_path ) )
+            curr.uvc_devices.push_back( uvc );
+
+    if( _added.empty() )
+    {
+        for( auto & hid : _devices_data.hid_devices )
+            if( exists( hid.device_path ) )
+                curr.hid_devices.push_back( hid );
+    }
+    else
+    {
+        for( auto & uvc : v4l->query_uvc_devices_at( _added ) )
+            if( std::find( curr.uvc_devices.begin(), curr.uvc_devices.end(), uvc ) == curr.uvc_devices.end() )
+                curr.uvc_devices.push_back( uvc );
+        // A handful of sysfs attributes per IIO device: cheap enough to redo
+        curr.hid_devices = _backend->query_hid_devices();
+    }
+    return curr;
+}
+
+
 // Scan devices using udev
 void udev_device_watcher::foreach_device( std::function< void( struct udev_device * udev_dev ) > callback )
 {
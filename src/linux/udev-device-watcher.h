@@ -27,7 +27,10 @@ class udev_device_watcher : public librealsense::platform::device_watcher
     struct udev * _udev_ctx;
     struct udev_monitor * _udev_monitor;
     int _udev_monitor_fd;
-    bool _changed = false;
+
+    // Since the last enumeration:
+    std::vector< std::string > _added;  // DEVPATHs of USB devices that were added
+    bool _removed = false;              // whether any were removed
 
 public:
     udev_device_watcher( platform::backend const * );
@@ -51,6 +54,7 @@ public:
     bool is_stopped() const override { return ! _active_object.is_active(); }
 
 private:
+    platform::backend_device_group enumerate() const;
     void foreach_device( std::function< void( struct udev_device* udev_dev ) > );
 };
 
@@ -0,0 +1,158 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "librealsense-exception.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace librealsense {
+
+
+// Same contract as small_heap, but allocate() and deallocate() never take a lock: slot ownership is kept in an atomic
+// bitmap and claimed with a CAS. The mutex and condition-variable are only used by wait_until_empty(), which is called
+// when a stream is flushed, and by the deallocation that brings the heap back to empty.
+//
+template < class T, int C >
+class lock_free_heap
+{
+    static constexpr int BITS_PER_WORD = 64;
+    static constexpr int WORDS = ( C + BITS_PER_WORD - 1 ) / BITS_PER_WORD;
+
+    T buffer[C];
+    std::atomic< uint64_t > in_use[WORDS];  // bit set == slot allocated
+    std::atomic< int > size;
+    std::atomic< int > hint;  // word to start searching from; just an optimization
+    std::atomic< bool > keep_allocating;
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    // Bits past C in the last word are permanently "in use" so they're never handed out
+    static constexpr uint64_t initial_word( int w )
+    {
+        return ( w == WORDS - 1 && C % BITS_PER_WORD ) ? ~( ( uint64_t( 1 ) << ( C % BITS_PER_WORD ) ) - 1 ) : 0;
+    }
+
+    static int lowest_zero_bit( uint64_t word )
+    {
+        uint64_t const free_bits = ~word;
+#if defined( __GNUC__ ) || defined( __clang__ )
+        return __builtin_ctzll( free_bits );
+#else
+        int bit = 0;
+        while( ! ( free_bits & ( uint64_t( 1 ) << bit ) ) )
+            ++bit;
+        return bit;
+#endif
+    }
+
+    T * try_claim()
+    {
+        int const first = hint.load( std::memory_order_relaxed );
+        for( int n = 0; n < WORDS; ++n )
+        {
+            int const w = ( first + n ) % WORDS;
+            uint64_t word = in_use[w].load( std::memory_order_relaxed );
+            while( word != ~uint64_t( 0 ) )
+            {
+                int const bit = lowest_zero_bit( word );
+                if( in_use[w].compare_exchange_weak( word,
+                                                     word | ( uint64_t( 1 ) << bit ),
+                                                     std::memory_order_acquire,
+                                                     std::memory_order_relaxed ) )
+                {
+                    if( w != first )
+                        hint.store( w, std::memory_order_relaxed );
+                    return &buffer[w * BITS_PER_WORD + bit];
+                }
+                // 'word' was refreshed by the failed CAS; try again
+            }
+        }
+        return nullptr;
+    }
+
+    void on_released()
+    {
+        if( size.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+        {
+            // Take the lock so we can't slip between wait_until_empty()'s predicate check and its wait
+            std::lock_guard< std::mutex > lock( mutex );
+            cv.notify_all();
+        }
+    }
+
+public:
+    static const int CAPACITY = C;
+
+    lock_free_heap()
+        : size( 0 )
+        , hint( 0 )
+        , keep_allocating( true )
+    {
+        for( auto w = 0; w < WORDS; w++ )
+            in_use[w] = initial_word( w );
+        for( auto i = 0; i < C; i++ )
+            buffer[i] = std::move( T() );
+    }
+
+    T * allocate()
+    {
+        // Reserve first, so that wait_until_empty() sees us even before we've claimed a slot
+        size.fetch_add( 1, std::memory_order_acq_rel );
+        if( ! keep_allocating.load( std::memory_order_acquire ) )
+        {
+            on_released();
+            return nullptr;
+        }
+
+        auto item = try_claim();
+        if( ! item )
+            on_released();
+        return item;
+    }
+
+    void deallocate( T * item )
+    {
+        if( item < buffer || item >= buffer + C )
+        {
+            throw invalid_value_exception( "Trying to return item to a heap that didn't allocate it!" );
+        }
+        auto i = item - buffer;
+        auto old_value = std::move( buffer[i] );
+        buffer[i] = std::move( T() );
+
+        auto const w = i / BITS_PER_WORD;
+        in_use[w].fetch_and( ~( uint64_t( 1 ) << ( i % BITS_PER_WORD ) ), std::memory_order_release );
+        on_released();
+    }
+
+    void stop_allocation() { keep_allocating = false; }
+
+    void wait_until_empty()
+    {
+        std::unique_lock< std::mutex > lock( mutex );
+
+        const auto ready = [this]() {
+            return is_empty();
+        };
+        if( ! ready()
+            && ! cv.wait_for( lock,
+                              std::chrono::hours( 1000 ),
+                              ready ) )  // for some reason passing std::chrono::duration::max makes it return instantly
+        {
+            throw invalid_value_exception( "Could not flush one of the user controlled objects!" );
+        }
+    }
+
+    bool is_empty() const { return size.load( std::memory_order_acquire ) == 0; }
+    int get_size() const { return size.load( std::memory_order_acquire ); }
+};
+
+
+}  // namespace librealsense
@@ -100,6 +100,9 @@ namespace librealsense
 
         void open() const
         {
+            // Messages already logged go out with the configuration they were logged under
+            rsutils::async_debug_log::flush();
+
             el::Configurations defaultConf;
             defaultConf.setToDefault();
             // To set GLOBAL configurations you may use
@@ -157,6 +160,10 @@ namespace librealsense
             {
                 open_def();
             }
+
+            // Hand LOG_DEBUG messages to a background thread rather than dispatching them inline
+            if( auto async = getenv( "LRS_LOG_ASYNC" ) )
+                rsutils::async_debug_log::enable( std::string( async ) != "0" );
         }
 
         static bool try_get_log_severity(rs2_log_severity& severity)
@@ -264,6 +271,7 @@ namespace librealsense
         // Stop logging and reset logger to initial configurations
         void reset_logger()
         {
+            rsutils::async_debug_log::flush();
             el::Loggers::reconfigureLogger(log_id, el::ConfigurationType::ToFile, "false");
             el::Loggers::reconfigureLogger(log_id, el::ConfigurationType::ToStandardOutput, "false");
             el::Loggers::reconfigureLogger(log_id, el::ConfigurationType::MaxLogFileSize, "0");
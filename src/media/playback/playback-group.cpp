@@ -0,0 +1,100 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "playback-group.h"
+#include "playback_device.h"
+#include "../../proc/worker-pool.h"
+
+#include <algorithm>
+#include <thread>
+
+
+namespace librealsense {
+
+
+// Reading and decompressing is mostly I/O bound: a few threads keep many files ahead
+static size_t get_pool_size()
+{
+    size_t const threads = std::thread::hardware_concurrency();
+    return std::max< size_t >( 1, std::min< size_t >( threads / 2, 4 ) );
+}
+
+
+playback_group::playback_group()
+    : _pool( std::make_shared< worker_pool >( get_pool_size() ) )
+{
+}
+
+
+void playback_group::add( std::shared_ptr< playback_device > const & dev )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    _devices.push_back( dev );
+}
+
+
+void playback_group::remove( playback_device const * dev )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    _devices.erase( std::remove_if( _devices.begin(),
+                                    _devices.end(),
+                                    [dev]( std::weak_ptr< playback_device > const & wp )
+                                    {
+                                        auto sp = wp.lock();
+                                        return ! sp || sp.get() == dev;
+                                    } ),
+                    _devices.end() );
+}
+
+
+std::vector< std::shared_ptr< playback_device > > playback_group::get_devices() const
+{
+    std::vector< std::shared_ptr< playback_device > > devices;
+    std::lock_guard< std::mutex > lock( _mutex );
+    for( auto & wp : _devices )
+        if( auto dev = wp.lock() )
+            devices.push_back( std::move( dev ) );
+    return devices;
+}
+
+
+void playback_group::reset_time_base()
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    _time_base_set = false;
+}
+
+
+void playback_group::on_started()
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    if( ! _playing++ )
+        _time_base_set = false;
+}
+
+
+void playback_group::on_stopped()
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    if( _playing )
+        --_playing;
+}
+
+
+void playback_group::take_time_base( device_serializer::nanoseconds timestamp,
+                                     std::chrono::high_resolution_clock::time_point & base_sys_time,
+                                     device_serializer::nanoseconds & base_timestamp )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    if( ! _time_base_set )
+    {
+        _base_sys_time = std::chrono::high_resolution_clock::now();
+        _base_timestamp = timestamp;
+        _time_base_set = true;
+    }
+    base_sys_time = _base_sys_time;
+    base_timestamp = _base_timestamp;
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,63 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "../../core/serialization.h"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace librealsense {
+
+
+class playback_device;
+class worker_pool;
+
+
+// Playback devices synced with each other (see playback_device::sync) share one of these.
+//
+// They pace their frames by the same clock: the first member to take the time base after a reset sets it, and the
+// rest follow it instead of starting their own, so that samples with the same timestamp -- relative to the start of
+// their file -- are delivered at the same time whichever file they come from. The read-ahead of all members runs on a
+// single pool of threads, sized to the machine rather than to the number of files.
+//
+class playback_group
+{
+public:
+    playback_group();
+
+    void add( std::shared_ptr< playback_device > const & dev );
+    void remove( playback_device const * dev );
+    std::vector< std::shared_ptr< playback_device > > get_devices() const;
+
+    std::shared_ptr< worker_pool > const & get_pool() const { return _pool; }
+
+    // The next take_time_base() sets the clock again
+    void reset_time_base();
+
+    // Called when a member starts or stops playing; the clock is reset when the first of them starts
+    void on_started();
+    void on_stopped();
+
+    // The time base for a member whose next sample is at 'timestamp': the clock's, or (now, timestamp) if not set
+    void take_time_base( device_serializer::nanoseconds timestamp,
+                         std::chrono::high_resolution_clock::time_point & base_sys_time,
+                         device_serializer::nanoseconds & base_timestamp );
+
+private:
+    mutable std::mutex _mutex;
+    std::vector< std::weak_ptr< playback_device > > _devices;
+    std::shared_ptr< worker_pool > _pool;
+
+    bool _time_base_set = false;
+    std::chrono::high_resolution_clock::time_point _base_sys_time;
+    device_serializer::nanoseconds _base_timestamp{ 0 };
+    size_t _playing = 0;
+};
+
+
+}  // namespace librealsense
@@ -9,11 +9,13 @@
 #include "media/ros/ros_reader.h"
 #include "environment.h"
 #include "sync.h"
+#include "proc/worker-pool.h"
 #include <src/depth-sensor.h>
 #include <src/color-sensor.h>
 #include <src/pose.h>
 
 #include <rsutils/string/from.h>
+#include <rsutils/concurrency/thread-policy.h>
 
 
 using namespace librealsense;
@@ -136,6 +138,7 @@ std::map<uint32_t, std::shared_ptr<playback_sensor>> playback_device::create_pla
         {
             (*m_read_thread)->invoke([this, filters](dispatcher::cancellable_timer c)
             {
+                stop_prefetching(false);
                 m_reader->enable_stream(filters);
             });
         } );
@@ -144,6 +147,7 @@ std::map<uint32_t, std::shared_ptr<playback_sensor>> playback_device::create_pla
         {
             (*m_read_thread)->invoke([this, filters](dispatcher::cancellable_timer c)
             {
+                stop_prefetching(false);
                 m_reader->disable_stream(filters);
             });
         } );
@@ -196,6 +200,9 @@ playback_device::~playback_device()
     }
 
     (*m_read_thread)->stop();
+    stop_prefetching(true);
+    if (auto group = get_group())
+        group->remove(this);
 }
 
 std::shared_ptr<context> playback_device::get_context() const
@@ -267,6 +274,11 @@ void playback_device::set_frame_rate(double rate)
         throw invalid_value_exception( rsutils::string::from() << "Failed to set frame rate to "
                                                                << std::to_string( rate ) << ", value is less than 0" );
     }
+    for_each_synced([rate](playback_device& dev) { dev.set_frame_rate_one(rate); });
+}
+
+void playback_device::set_frame_rate_one(double rate)
+{
     (*m_read_thread)->invoke([this, rate](dispatcher::cancellable_timer t)
     {
         LOG_INFO("Changing playback frame rate to: " << rate);
@@ -275,12 +287,26 @@ void playback_device::set_frame_rate(double rate)
     });
 }
 
+unsigned long long playback_device::get_dropped_frames() const
+{
+    unsigned long long dropped = 0;
+    for (auto&& sensor : m_sensors)
+        dropped += sensor.second->get_dropped_frames();
+    return dropped;
+}
+
 void playback_device::seek_to_time(std::chrono::nanoseconds time)
 {
     LOG_INFO("Request to seek to: " << time.count());
+    for_each_synced([time](playback_device& dev) { dev.seek_to_time_one(time); });
+}
+
+void playback_device::seek_to_time_one(std::chrono::nanoseconds time)
+{
     (*m_read_thread)->invoke([this, time](dispatcher::cancellable_timer t)
     {
         LOG_INFO("Seek to time: " << time.count());
+        stop_prefetching(true);
         m_reader->seek_to_time(time);
         m_device_description = m_reader->query_device_description(time);
         update_extensions(m_device_description);
@@ -334,6 +360,11 @@ uint64_t playback_device::get_duration() const
 }
 
 void playback_device::pause()
+{
+    for_each_synced([](playback_device& dev) { dev.pause_one(); });
+}
+
+void playback_device::pause_one()
 {
     LOG_DEBUG("Playback Pause called");
 
@@ -371,6 +402,11 @@ void playback_device::pause()
 }
 
 void playback_device::resume()
+{
+    for_each_synced([](playback_device& dev) { dev.resume_one(); });
+}
+
+void playback_device::resume_one()
 {
     LOG_DEBUG("Playback resume called");
     (*m_read_thread)->invoke([this](dispatcher::cancellable_timer t)
@@ -382,6 +418,7 @@ void playback_device::resume()
         auto total_duration = m_reader->query_duration();
         if (m_last_published_timestamp >= total_duration)
             m_last_published_timestamp = device_serializer::nanoseconds(0);
+        stop_prefetching(true);
         m_reader->reset();
         m_reader->seek_to_time(m_last_published_timestamp);
         while (m_last_published_timestamp != device_serializer::nanoseconds(0) && !m_reader->read_next_data()->is<serialized_frame>());
@@ -410,6 +447,214 @@ bool playback_device::is_real_time() const
     return m_real_time;
 }
 
+void playback_device::set_prefetch_depth(size_t depth)
+{
+    depth = std::min(depth, MAX_PREFETCH_DEPTH);
+    LOG_INFO("Set prefetch depth to " << depth);
+    (*m_read_thread)->invoke([this, depth](dispatcher::cancellable_timer t)
+    {
+        // Anything already read ahead stays queued; the new depth applies from here on
+        stop_prefetching(false);
+        m_prefetch_depth = depth;
+    });
+    if ((*m_read_thread)->flush() == false)
+    {
+        LOG_ERROR("Error - timeout waiting for set_prefetch_depth, possible deadlock detected");
+    }
+}
+
+void playback_device::sync(std::shared_ptr<playback_device> const& a, std::shared_ptr<playback_device> const& b)
+{
+    if (a == b)
+        return;
+    auto group_a = a->get_group();
+    auto group_b = b->get_group();
+    if (group_a && group_a == group_b)
+        return;
+
+    auto group = group_a ? group_a : group_b ? group_b : std::make_shared<playback_group>();
+    std::vector<std::shared_ptr<playback_device>> joining;
+    for (auto& dev : { a, b })
+    {
+        auto current = dev->get_group();
+        if (!current)
+            joining.push_back(dev);
+        else if (current != group)
+            for (auto& member : current->get_devices())  // merge the other group into this one
+                joining.push_back(member);
+    }
+    for (auto& dev : joining)
+    {
+        dev->join_group(group);
+        group->add(dev);
+    }
+    LOG_INFO("Playback of " << a->get_file_name() << " synced with " << b->get_file_name());
+}
+
+void playback_device::join_group(std::shared_ptr<playback_group> const& group)
+{
+    (*m_read_thread)->invoke([this, group](dispatcher::cancellable_timer t)
+    {
+        // The read-ahead moves to the group's pool; reading each sample on the playback thread would serialize the
+        // files' I/O with their delivery, so read-ahead is turned on if it was not
+        stop_prefetching(false);
+        if (m_is_started && !m_is_paused)
+            group->on_started();
+        {
+            std::lock_guard<std::mutex> lock(m_group_mutex);
+            m_group = group;
+        }
+        std::lock_guard<std::mutex> lock(m_prefetch_mutex);
+        if (!m_prefetch_depth)
+            m_prefetch_depth = MAX_PREFETCH_DEPTH / 2;
+    });
+    if ((*m_read_thread)->flush() == false)
+    {
+        LOG_ERROR("Error - timeout waiting for sync, possible deadlock detected");
+    }
+}
+
+std::shared_ptr<playback_group> playback_device::get_group() const
+{
+    std::lock_guard<std::mutex> lock(m_group_mutex);
+    return m_group;
+}
+
+// Runs the action on this device, or on all the devices it is synced with, which then take a new time base together
+template <typename T>
+void playback_device::for_each_synced(T action)
+{
+    auto group = get_group();
+    if (!group)
+    {
+        action(*this);
+        return;
+    }
+    group->reset_time_base();
+    for (auto& dev : group->get_devices())
+        action(*dev);
+}
+
+// Called from the reading thread
+std::shared_ptr<serialized_data> playback_device::read_next_data()
+{
+    std::unique_lock<std::mutex> lock(m_prefetch_mutex);
+    if (m_prefetch_depth == 0 && m_prefetched.empty())
+    {
+        lock.unlock();
+        return m_reader->read_next_data();
+    }
+    if (m_prefetched.empty() && !m_prefetch_running && m_prefetch_depth)
+    {
+        if (m_prefetch_thread.joinable())  // it ran into the end of the file, or an error
+        {
+            lock.unlock();
+            m_prefetch_thread.join();
+            lock.lock();
+        }
+        if (m_prefetch_error)
+        {
+            auto error = m_prefetch_error;
+            m_prefetch_error = nullptr;
+            std::rethrow_exception(error);
+        }
+        start_prefetching();
+    }
+    m_prefetch_cv.wait(lock, [this]() { return !m_prefetched.empty() || !m_prefetch_running; });
+    if (m_prefetched.empty())
+    {
+        lock.unlock();
+        return read_next_data();  // let the above pick up the error
+    }
+    auto data = std::move(m_prefetched.front());
+    m_prefetched.pop_front();
+    m_prefetch_cv.notify_all();
+
+    // On the group's pool the read-ahead gives back its thread once the queue is full: top it up before it runs dry
+    if (m_group && !m_prefetch_running && !m_prefetch_error && m_prefetched.size() <= m_prefetch_depth / 2
+        && (m_prefetched.empty() || !m_prefetched.back()->is<serialized_end_of_file>()))
+    {
+        start_prefetching();
+    }
+    return data;
+}
+
+// With m_prefetch_mutex held, and any previous m_prefetch_thread joined
+void playback_device::start_prefetching()
+{
+    m_prefetch_running = true;
+    if (m_group)
+    {
+        m_group->get_pool()->post([this]() { prefetch_loop(); });
+        return;
+    }
+    m_prefetch_thread = std::thread([this]() {
+        rsutils::concurrency::apply_thread_policy( nullptr );
+        prefetch_loop();
+    });
+}
+
+void playback_device::prefetch_loop()
+{
+    std::unique_lock<std::mutex> lock(m_prefetch_mutex);
+    while (true)
+    {
+        if (m_group)
+        {
+            // Don't hold on to a pool thread while the queue is full
+            if (m_prefetch_stop || m_prefetched.size() >= m_prefetch_depth)
+                break;
+        }
+        else
+            m_prefetch_cv.wait(lock, [this]() { return m_prefetch_stop || m_prefetched.size() < m_prefetch_depth; });
+        if (m_prefetch_stop)
+            break;
+        lock.unlock();
+        std::shared_ptr<serialized_data> data;
+        try
+        {
+            data = m_reader->read_next_data();
+        }
+        catch (...)
+        {
+            lock.lock();
+            m_prefetch_error = std::current_exception();
+            break;
+        }
+        lock.lock();
+        bool const end_of_file = data->is<serialized_end_of_file>();
+        m_prefetched.push_back(std::move(data));
+        m_prefetch_cv.notify_all();
+        if (end_of_file)
+            break;
+    }
+    m_prefetch_running = false;
+    m_prefetch_cv.notify_all();
+}
+
+// Called from the reading thread, before anything else touches the reader. The reader itself is left wherever the
+// read-ahead got to, so unless 'discard' is set whatever was queued is still delivered first.
+void playback_device::stop_prefetching(bool discard)
+{
+    std::deque<std::shared_ptr<serialized_data>> discarded;  // frames released outside the lock
+    {
+        std::unique_lock<std::mutex> lock(m_prefetch_mutex);
+        m_prefetch_stop = true;
+        m_prefetch_cv.notify_all();
+        m_prefetch_cv.wait(lock, [this]() { return !m_prefetch_running; });  // a task on the group's pool
+    }
+    if (m_prefetch_thread.joinable())
+        m_prefetch_thread.join();
+
+    std::lock_guard<std::mutex> lock(m_prefetch_mutex);
+    m_prefetch_stop = false;
+    if (discard)
+    {
+        discarded.swap(m_prefetched);
+        m_prefetch_error = nullptr;
+    }
+}
+
 std::shared_ptr< const device_info > playback_device::get_device_info() const
 {
     return m_device_info;
@@ -427,8 +672,13 @@ bool playback_device::is_valid() const
 
 void playback_device::update_time_base(device_serializer::nanoseconds base_timestamp)
 {
-    m_base_sys_time = std::chrono::high_resolution_clock::now();
-    m_base_timestamp = base_timestamp;
+    if (auto group = get_group())
+        group->take_time_base(base_timestamp, m_base_sys_time, m_base_timestamp);
+    else
+    {
+        m_base_sys_time = std::chrono::high_resolution_clock::now();
+        m_base_timestamp = base_timestamp;
+    }
     LOG_DEBUG("Updating Time Base... m_base_sys_time " << m_base_sys_time.time_since_epoch().count() << " m_base_timestamp " << m_base_timestamp.count());
 }
 
@@ -444,7 +694,8 @@ device_serializer::nanoseconds playback_device::calc_sleep_time(device_serialize
     //Sometimes the first stream skip the first frame on the ros reader
     //and the second stream go back to the first frame so its timestamp is smaller then the base timestamp
     //in this case we need to restart the m_base_timestamp again
-    if(timestamp < m_base_timestamp)
+    //(when synced with other devices, the base is shared: a sample from before it is just late)
+    if(timestamp < m_base_timestamp && !get_group())
     {
         update_time_base(timestamp);
     }
@@ -480,6 +731,8 @@ void playback_device::start()
         return; //nothing to do
 
     m_is_started = true;
+    if (auto group = get_group())
+        group->on_started();
     catch_up();
     try_looping();
     LOG_INFO("Playback started");
@@ -512,7 +765,10 @@ void playback_device::stop_internal()
 
     m_is_started = false;
     m_is_paused = false;
+    if (auto group = get_group())
+        group->on_stopped();
 
+    stop_prefetching(true);
     m_reader->reset();
     m_prev_timestamp = std::chrono::nanoseconds(0);
     catch_up();
@@ -606,7 +862,7 @@ void playback_device::try_looping()
 
         //Read next data from the serializer, on success: 'obj' will be a valid object that came from
         // sensor number 'sensor_index' with a timestamp equal to 'timestamp'
-        std::shared_ptr<serialized_data> data = m_reader->read_next_data();
+        std::shared_ptr<serialized_data> data = read_next_data();
         if (data->as<serialized_end_of_file>())
         {
             LOG_INFO("End of file reached");
@@ -3,6 +3,10 @@
 
 #pragma once
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <thread>
 #include "../../core/roi.h"
 #include "../../core/extension.h"
 #include "../../core/serialization.h"
@@ -10,6 +14,7 @@
 #include "../../archive.h"
 #include "../../sensor.h"
 #include "playback_sensor.h"
+#include "playback-group.h"
 
 #include <rsutils/lazy.h>
 #include <rsutils/signal.h>
@@ -36,6 +41,7 @@ namespace librealsense
         std::shared_ptr<matcher> create_matcher(const frame_holder& frame) const override;
 
         void set_frame_rate(double rate);
+        unsigned long long get_dropped_frames() const;
         void seek_to_time(std::chrono::nanoseconds time);
         rs2_playback_status get_current_status() const;
         uint64_t get_duration() const;
@@ -44,6 +50,10 @@ namespace librealsense
         void stop();
         void set_real_time(bool real_time);
         bool is_real_time() const;
+        void set_prefetch_depth(size_t depth);
+        // Play 'a' and 'b' on one clock, along with whatever either is already synced with; pause, resume, seek and
+        // set_frame_rate on any of them then apply to all
+        static void sync(std::shared_ptr<playback_device> const& a, std::shared_ptr<playback_device> const& b);
         const std::string& get_file_name() const;
         uint64_t get_position() const;
         rsutils::public_signal< playback_device, rs2_playback_status > playback_status_changed;
@@ -63,6 +73,14 @@ namespace librealsense
         bool contradicts(const stream_profile_interface* a, const std::vector<stream_profile>& others) const override { return false; }
 
     private:
+        void set_frame_rate_one(double rate);
+        void seek_to_time_one(std::chrono::nanoseconds time);
+        void pause_one();
+        void resume_one();
+        template <typename T> void for_each_synced(T action);
+        std::shared_ptr<playback_group> get_group() const;
+        void join_group(std::shared_ptr<playback_group> const& group);
+        void start_prefetching();
         void update_time_base(device_serializer::nanoseconds base_timestamp);
         device_serializer::nanoseconds calc_sleep_time(device_serializer::nanoseconds  timestamp);
         void start();
@@ -77,6 +95,9 @@ namespace librealsense
         void register_extrinsics(const device_serializer::device_snapshot& device_description);
         void update_extensions(const device_serializer::device_snapshot& device_description);
         bool prefetch_done();
+        std::shared_ptr<device_serializer::serialized_data> read_next_data();
+        void prefetch_loop();
+        void stop_prefetching(bool discard);
 
     private:
         rsutils::lazy< std::shared_ptr< dispatcher > > m_read_thread;
@@ -97,6 +118,23 @@ namespace librealsense
         device_serializer::nanoseconds m_last_published_timestamp;
         std::mutex m_last_published_timestamp_mutex;
         std::mutex _active_sensors_mutex;
+
+        // Read-ahead (see set_prefetch_depth): while it runs (m_prefetch_running), only it touches m_reader; everyone
+        // else (all on m_read_thread) stops it first with stop_prefetching()
+        static constexpr size_t MAX_PREFETCH_DEPTH = 16;  // well below what the reader's frame pool can hold
+        size_t m_prefetch_depth = 0;
+        std::thread m_prefetch_thread;
+        std::mutex m_prefetch_mutex;
+        std::condition_variable m_prefetch_cv;
+        std::deque<std::shared_ptr<device_serializer::serialized_data>> m_prefetched;
+        std::exception_ptr m_prefetch_error;
+        bool m_prefetch_running = false;
+        bool m_prefetch_stop = false;
+
+        // Set once synced with other devices (see sync()); the read-ahead then runs on the group's pool, a batch at a
+        // time, instead of on m_prefetch_thread
+        std::shared_ptr<playback_group> m_group;
+        mutable std::mutex m_group_mutex;
     };
 
     MAP_EXTENSION(RS2_EXTENSION_PLAYBACK, playback_device);
@@ -33,7 +33,8 @@ playback_sensor::playback_sensor(device_interface& parent_device, const device_s
     m_sensor_description(sensor_description),
     m_sensor_id(sensor_description.get_sensor_index()),
     m_parent_device(parent_device),
-    _default_queue_size(1)
+    _default_queue_size(1),
+    m_dropped_frames(0)
 {
     register_sensor_streams(m_sensor_description.get_stream_profiles());
     register_sensor_infos(m_sensor_description);
@@ -89,8 +90,9 @@ void playback_sensor::open(const stream_profiles& requests)
     //For each stream, create a dedicated dispatching thread
     for (auto&& profile : requests)
     {
-        auto on_drop_callback = [profile]( dispatcher::action act ) {
+        auto on_drop_callback = [this, profile]( dispatcher::action act ) {
             LOG_DEBUG( "Dropping frame from dispatcher " << profile_to_string( profile ) );
+            ++m_dropped_frames;
         };
 
         m_dispatchers.emplace( std::make_pair(
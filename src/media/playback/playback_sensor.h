@@ -51,6 +51,7 @@ namespace librealsense
         bool extend_to(rs2_extension extension_type, void** ext) override;
         device_interface& get_device() override;
         void update_option(rs2_option id, std::shared_ptr<option> option);
+        unsigned long long get_dropped_frames() const { return m_dropped_frames; }
         void stop(bool invoke_required);
         void flush_pending_frames();
         void update(const device_serializer::sensor_snapshot& sensor_snapshot);
@@ -106,6 +107,7 @@ namespace librealsense
         stream_profiles m_active_streams;
         mutable std::mutex m_active_profile_mutex;
         const unsigned int _default_queue_size;
+        std::atomic<unsigned long long> m_dropped_frames;  // frames the dispatchers could not deliver
 
     public:
         //handle frame use 3 lambda functions that determines if and when a frame should be published.
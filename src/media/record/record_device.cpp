@@ -6,12 +6,16 @@
 #include <core/advanced_mode.h>
 #include "record_device.h"
 #include <src/platform/backend-device-group.h>
+#include <src/latency-stats.h>
+
+#include <algorithm>
 
 using namespace librealsense;
 
 librealsense::record_device::record_device(std::shared_ptr<librealsense::device_interface> device,
                                       std::shared_ptr<librealsense::device_serializer::writer> serializer):
     m_write_thread([](){return std::make_shared<dispatcher>(std::numeric_limits<unsigned int>::max());}),
+    m_dropped_frames(0),
     m_is_recording(true),
     m_record_total_pause_duration(0)
 {
@@ -65,6 +69,12 @@ librealsense::record_device::~record_device()
     {
         s->disable_recording();
     }
+    {
+        // Release any sensor thread still waiting for room in the queue
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_queue_closed = true;
+    }
+    m_queue_cv.notify_all();
     if ((*m_write_thread)->flush() == false)
     {
         LOG_ERROR("Error - timeout waiting for flush, possible deadlock detected");
@@ -152,7 +162,17 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
     //TODO: remove usage of shared pointer when frame_holder is copyable
     auto frame_holder_ptr = std::make_shared<frame_holder>();
     *frame_holder_ptr = std::move(frame);
+    if (!queue_frame(frame_holder_ptr))
+    {
+        LOG_DEBUG("Recorder write queue is full, frame dropped");
+        return;
+    }
     (*m_write_thread)->invoke([this, frame_holder_ptr, sensor_index, capture_time/*, data_size*/, on_error](dispatcher::cancellable_timer t) {
+        frame_holder f;
+        if (!unqueue_frame(frame_holder_ptr, f))
+        {
+            return; //Dropped to make room for newer frames
+        }
         if (m_is_recording == false)
         {
             return; //Recording is paused
@@ -173,9 +193,9 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
         try
         {
             const uint32_t device_index = 0;
-            auto stream_type = frame_holder_ptr->frame->get_stream()->get_stream_type();
-            auto stream_index = static_cast<uint32_t>(frame_holder_ptr->frame->get_stream()->get_stream_index());
-            m_ros_writer->write_frame({ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index }, capture_time, std::move(*frame_holder_ptr));
+            auto stream_type = f->get_stream()->get_stream_type();
+            auto stream_index = static_cast<uint32_t>(f->get_stream()->get_stream_index());
+            m_ros_writer->write_frame({ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index }, capture_time, std::move(f));
             //TODO: restore: std::lock_guard<std::mutex> locker(m_mutex);  m_cached_data_size -= data_size;
         }
         catch(std::exception& e)
@@ -185,6 +205,70 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
     });
 }
 
+bool librealsense::record_device::queue_frame(std::shared_ptr<frame_holder> const& f)
+{
+    frame_holder dropped; // released only after we let go of the lock
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    if (m_max_queued_frames && m_queued_frames.size() >= m_max_queued_frames)
+    {
+        switch (m_queue_policy)
+        {
+        case RS2_RECORD_QUEUE_POLICY_DROP_NEWEST:
+            ++m_dropped_frames;
+            stream_stats::drop(f->frame, RS2_FRAME_DROP_STAGE_RECORDER);
+            return false;
+
+        case RS2_RECORD_QUEUE_POLICY_BLOCK:
+            m_queue_cv.wait(lock, [this]() {
+                return m_queue_closed || !m_max_queued_frames || m_queued_frames.size() < m_max_queued_frames;
+            });
+            if (m_queue_closed)
+            {
+                ++m_dropped_frames;
+                stream_stats::drop(f->frame, RS2_FRAME_DROP_STAGE_RECORDER);
+                return false;
+            }
+            break;
+
+        default:
+            dropped = std::move(*m_queued_frames.front());
+            m_queued_frames.pop_front();
+            ++m_dropped_frames;
+            stream_stats::drop(dropped.frame, RS2_FRAME_DROP_STAGE_RECORDER);
+            break;
+        }
+    }
+    m_queued_frames.push_back(f);
+    if (auto profile = (*f)->get_stream())
+        profile->get_stats().drops.queue_depth(RS2_FRAME_DROP_STAGE_RECORDER, m_queued_frames.size(), m_max_queued_frames);
+    return true;
+}
+
+bool librealsense::record_device::unqueue_frame(std::shared_ptr<frame_holder> const& f, frame_holder& out)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        // Usually the front, unless two sensors raced between queue_frame() and invoke()
+        auto it = std::find(m_queued_frames.begin(), m_queued_frames.end(), f);
+        if (it == m_queued_frames.end())
+            return false;
+        out = std::move(**it);
+        m_queued_frames.erase(it);
+    }
+    m_queue_cv.notify_one();
+    return true;
+}
+
+void librealsense::record_device::set_write_queue_limit(size_t max_frames, rs2_record_queue_policy policy)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_max_queued_frames = max_frames;
+        m_queue_policy = policy;
+    }
+    m_queue_cv.notify_all();
+}
+
 const std::string& librealsense::record_device::get_info(rs2_camera_info info) const
 {
     return m_device->get_info(info);
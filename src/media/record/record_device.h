@@ -12,6 +12,10 @@
 #include <rsutils/concurrency/concurrency.h>
 #include <rsutils/lazy.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+
 
 namespace librealsense
 {
@@ -41,6 +45,8 @@ namespace librealsense
         void pause_recording();
         void resume_recording();
         const std::string& get_filename() const;
+        void set_write_queue_limit(size_t max_frames, rs2_record_queue_policy policy);
+        unsigned long long get_dropped_frames() const { return m_dropped_frames; }
         std::shared_ptr< const device_info > get_device_info() const override;
         std::pair<uint32_t, rs2_extrinsics> get_extrinsics(const stream_interface& stream) const override;
         bool is_valid() const override;
@@ -57,6 +63,8 @@ namespace librealsense
         void write_header();
         std::chrono::nanoseconds get_capture_time() const;
         void write_data(size_t sensor_index, frame_holder f, std::function<void(std::string const&)> on_error);
+        bool queue_frame(std::shared_ptr<frame_holder> const& f);
+        bool unqueue_frame(std::shared_ptr<frame_holder> const& f, frame_holder& out);
         void write_sensor_extension_snapshot(size_t sensor_index, rs2_extension ext, std::shared_ptr<extension_snapshot> snapshot, std::function<void(std::string const&)> on_error);
         void write_notification(size_t sensor_index, const notification& n);
         std::vector<std::shared_ptr<record_sensor>> create_record_sensors(std::shared_ptr<device_interface> m_device);
@@ -68,6 +76,16 @@ namespace librealsense
         rsutils::lazy< std::shared_ptr< dispatcher > > m_write_thread;
         std::shared_ptr<device_serializer::writer> m_ros_writer;
 
+        // Frames whose write was handed to m_write_thread but did not start yet. A frame dropped to make room is
+        // removed from here and emptied, so its (still scheduled) write finds nothing to do.
+        std::deque<std::shared_ptr<frame_holder>> m_queued_frames;
+        std::mutex m_queue_mutex;
+        std::condition_variable m_queue_cv;
+        size_t m_max_queued_frames = 0;  // 0 == unbounded
+        rs2_record_queue_policy m_queue_policy = RS2_RECORD_QUEUE_POLICY_DROP_OLDEST;
+        bool m_queue_closed = false;
+        std::atomic<unsigned long long> m_dropped_frames;
+
         std::chrono::high_resolution_clock::time_point m_capture_time_base;
         std::chrono::high_resolution_clock::duration m_record_total_pause_duration;
         std::chrono::high_resolution_clock::time_point m_time_of_pause;
@@ -0,0 +1,42 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "ros_depth_codec.h"
+
+#include <src/librealsense-exception.h>
+
+#include <stdexcept>
+
+
+namespace librealsense {
+namespace ros_depth_codec {
+
+
+image_info decode_info( uint8_t const * data, size_t size )
+{
+    try
+    {
+        return rsutils::image::depth_codec::decode_info( data, size );
+    }
+    catch( std::runtime_error const & e )
+    {
+        throw io_exception( e.what() );
+    }
+}
+
+
+void decode( uint8_t const * data, size_t size, uint8_t * pixels )
+{
+    try
+    {
+        rsutils::image::depth_codec::decode( data, size, pixels );
+    }
+    catch( std::runtime_error const & e )
+    {
+        throw io_exception( e.what() );
+    }
+}
+
+
+}  // namespace ros_depth_codec
+}  // namespace librealsense
@@ -0,0 +1,27 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <rsutils/image/depth-codec.h>
+
+
+namespace librealsense
+{
+    // Lossless encoding of Z16 depth images, for recording: see rsutils::image::depth_codec.
+    //
+    // Encoded images are recorded as sensor_msgs::CompressedImage with format FORMAT. Readers that don't
+    // know the format fail on the unknown message type instead of misinterpreting the data.
+    namespace ros_depth_codec
+    {
+        using rsutils::image::depth_codec::FORMAT;
+        using rsutils::image::depth_codec::image_info;
+        using rsutils::image::depth_codec::encode;
+
+        // Throws io_exception if the data is not a valid encoding
+        image_info decode_info( uint8_t const * data, size_t size );
+
+        // 'pixels' must have room for step * height bytes; row padding past the pixels themselves is zeroed
+        void decode( uint8_t const * data, size_t size, uint8_t * pixels );
+    }
+}
@@ -8,6 +8,7 @@
 #include "sensor_msgs/image_encodings.h"
 #include "sensor_msgs/Imu.h"
 #include "sensor_msgs/Image.h"
+#include "sensor_msgs/CompressedImage.h"
 #include "diagnostic_msgs/KeyValue.h"
 #include "std_msgs/UInt32.h"
 #include "std_msgs/Float32.h"
@@ -0,0 +1,93 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "sensor_msgs/Image.h"
+
+#include <cstring>
+
+
+namespace librealsense
+{
+    // A sensor_msgs::Image whose pixels are referenced rather than owned.
+    //
+    // It serializes to exactly the same bytes (and is registered under the same type and MD5), so readers cannot tell
+    // the difference, but writing a frame no longer copies its data into a temporary std::vector first: the bag
+    // serializes straight from the frame's buffer, which only has to stay alive for the duration of the write.
+    struct ros_image_view
+    {
+        std_msgs::Header header;
+        uint32_t height = 0;
+        uint32_t width = 0;
+        std::string encoding;
+        uint8_t is_bigendian = 0;
+        uint32_t step = 0;
+        uint8_t const * data = nullptr;
+        uint32_t data_size = 0;
+        float depth_units = 0;
+    };
+}
+
+namespace rs2rosinternal
+{
+namespace message_traits
+{
+    template<> struct IsMessage< librealsense::ros_image_view > : std::true_type {};
+    template<> struct HasHeader< librealsense::ros_image_view > : std::true_type {};
+
+    template<> struct MD5Sum< librealsense::ros_image_view >
+    {
+        static const char* value() { return MD5Sum< sensor_msgs::Image >::value(); }
+        static const char* value(const librealsense::ros_image_view&) { return value(); }
+    };
+
+    template<> struct DataType< librealsense::ros_image_view >
+    {
+        static const char* value() { return DataType< sensor_msgs::Image >::value(); }
+        static const char* value(const librealsense::ros_image_view&) { return value(); }
+    };
+
+    template<> struct Definition< librealsense::ros_image_view >
+    {
+        static const char* value() { return Definition< sensor_msgs::Image >::value(); }
+        static const char* value(const librealsense::ros_image_view&) { return value(); }
+    };
+} // namespace message_traits
+
+namespace serialization
+{
+    // Same layout as Serializer< sensor_msgs::Image >; only writing is supported
+    template<> struct Serializer< librealsense::ros_image_view >
+    {
+        template<typename Stream> inline static void write(Stream& stream, const librealsense::ros_image_view& m)
+        {
+            stream.next(m.header);
+            stream.next(m.height);
+            stream.next(m.width);
+            stream.next(m.encoding);
+            stream.next(m.is_bigendian);
+            stream.next(m.step);
+            stream.next(m.data_size);
+            if (m.data_size)
+                memcpy(stream.advance(m.data_size), m.data, m.data_size);
+            if (!m.header.version.compare("1"))
+                stream.next(m.depth_units);
+        }
+
+        inline static uint32_t serializedLength(const librealsense::ros_image_view& m)
+        {
+            uint32_t size = serializationLength(m.header)
+                          + serializationLength(m.height)
+                          + serializationLength(m.width)
+                          + serializationLength(m.encoding)
+                          + serializationLength(m.is_bigendian)
+                          + serializationLength(m.step)
+                          + serializationLength(m.data_size) + m.data_size;
+            if (!m.header.version.compare("1"))
+                size += serializationLength(m.depth_units);
+            return size;
+        }
+    };
+} // namespace serialization
+} // namespace rs2rosinternal
@@ -0,0 +1,112 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "std_msgs/Header.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace librealsense
+{
+    // Several consecutive samples of one motion stream, recorded as a single message.
+    //
+    // A motion stream otherwise takes one sensor_msgs::Imu per sample, plus a diagnostic_msgs::KeyValue per metadata
+    // attribute, each with its own record and index entry in the bag; at IMU rates that overhead is most of the file.
+    // Here each field of the samples is stored as an array (structure-of-arrays), so a batch is little more than the
+    // samples themselves. All the samples of a batch share the timestamp domain and the set of metadata attributes.
+    //
+    // The message is written at the recording time of its last sample, on the stream's usual data topic.
+    struct ros_imu_batch
+    {
+        std_msgs::Header header;                // seq and stamp of the first sample
+        std::string timestamp_domain;
+        std::vector< int64_t > record_time;     // time of each sample in the recording, in nanoseconds
+        std::vector< uint64_t > frame_number;
+        std::vector< double > timestamp;        // frame timestamp, in milliseconds
+        std::vector< double > system_time;      // in milliseconds
+        std::vector< float > x;
+        std::vector< float > y;
+        std::vector< float > z;
+        std::vector< uint32_t > metadata_type;  // rs2_frame_metadata_value of each attribute the samples have
+        std::vector< int64_t > metadata;        // all the samples' values of metadata_type[0], then of [1], ...
+
+        size_t size() const { return frame_number.size(); }
+
+        typedef std::shared_ptr< ros_imu_batch > Ptr;
+        typedef std::shared_ptr< ros_imu_batch const > ConstPtr;
+    };
+}
+
+namespace rs2rosinternal
+{
+namespace message_traits
+{
+    template<> struct IsMessage< librealsense::ros_imu_batch > : std::true_type {};
+    template<> struct HasHeader< librealsense::ros_imu_batch > : std::true_type {};
+
+    template<> struct MD5Sum< librealsense::ros_imu_batch >
+    {
+        static const char* value() { return "60fe868941fb8a9b2e46b64c010a43fe"; }
+        static const char* value(const librealsense::ros_imu_batch&) { return value(); }
+    };
+
+    template<> struct DataType< librealsense::ros_imu_batch >
+    {
+        static const char* value() { return "realsense_msgs/ImuBatch"; }
+        static const char* value(const librealsense::ros_imu_batch&) { return value(); }
+    };
+
+    template<> struct Definition< librealsense::ros_imu_batch >
+    {
+        static const char* value()
+        {
+            return "Header header\n\
+string timestamp_domain\n\
+int64[] record_time\n\
+uint64[] frame_number\n\
+float64[] timestamp\n\
+float64[] system_time\n\
+float32[] x\n\
+float32[] y\n\
+float32[] z\n\
+uint32[] metadata_type\n\
+int64[] metadata\n\
+\n\
+================================================================================\n\
+MSG: std_msgs/Header\n\
+uint32 seq\n\
+time stamp\n\
+string frame_id\n\
+";
+        }
+        static const char* value(const librealsense::ros_imu_batch&) { return value(); }
+    };
+} // namespace message_traits
+
+namespace serialization
+{
+    template<> struct Serializer< librealsense::ros_imu_batch >
+    {
+        template<typename Stream, typename T> inline static void allInOne(Stream& stream, T m)
+        {
+            stream.next(m.header);
+            stream.next(m.timestamp_domain);
+            stream.next(m.record_time);
+            stream.next(m.frame_number);
+            stream.next(m.timestamp);
+            stream.next(m.system_time);
+            stream.next(m.x);
+            stream.next(m.y);
+            stream.next(m.z);
+            stream.next(m.metadata_type);
+            stream.next(m.metadata);
+        }
+
+        ROS_DECLARE_ALLINONE_SERIALIZER
+    };
+} // namespace serialization
+} // namespace rs2rosinternal
@@ -2,6 +2,7 @@
 // Copyright(c) 2019 Intel Corporation. All Rights Reserved.
 
 #include "ros_reader.h"
+#include "ros_depth_codec.h"
 #include "ds/ds-device-common.h"
 #include "ds/d400/d400-private.h"
 #include "std_msgs/Float32MultiArray.h"
@@ -25,7 +26,8 @@ namespace librealsense
         m_file_path(file),
         m_context(ctx),
         m_version(0),
-        m_legacy_depth_units(0)
+        m_legacy_depth_units(0),
+        m_memory_mapped(ctx && ctx->get_settings().nested(std::string("playback-memory-mapped", 22)).default_value(false))
     {
         try
         {
@@ -46,6 +48,9 @@ namespace librealsense
 
     std::shared_ptr<serialized_data> ros_reader::read_next_data()
     {
+        if (m_motion_batch)
+            return read_next_batched_motion_sample();
+
         if (m_samples_view == nullptr || m_samples_itrator == m_samples_view->end())
         {
             LOG_DEBUG("End of file reached");
@@ -56,6 +61,7 @@ namespace librealsense
         ++m_samples_itrator;
 
         if (next_msg.isType<sensor_msgs::Image>()
+            || next_msg.isType<sensor_msgs::CompressedImage>()
             || next_msg.isType<sensor_msgs::Imu>()
             || next_msg.isType<realsense_legacy_msgs::pose>()
             || next_msg.isType<geometry_msgs::Transform>())
@@ -64,6 +70,15 @@ namespace librealsense
             return create_frame(next_msg);
         }
 
+        if (next_msg.isType<ros_imu_batch>())
+        {
+            LOG_DEBUG("Next message is a batch of motion frames");
+            m_motion_batch = instantiate_msg<ros_imu_batch>(next_msg);
+            m_motion_batch_topic = next_msg.getTopic();
+            m_motion_batch_next = 0;
+            return read_next_batched_motion_sample();
+        }
+
         if (m_version >= 3)
         {
             if (next_msg.isType<std_msgs::Float32>())
@@ -103,6 +118,8 @@ namespace librealsense
         auto seek_time_as_rostime = rs2rosinternal::Time(seek_time_as_secs.count());
 
         m_samples_view.reset(new rosbag::View(m_file, FalseQuery()));
+        m_motion_batch.reset();
+        m_motion_batch_start = seek_time;
 
         //Using cached topics here and not querying them (before reseting) since a previous call to seek
         // could have changed the view and some streams that should be streaming were dropped.
@@ -117,33 +134,59 @@ namespace librealsense
     std::vector<std::shared_ptr<serialized_data>> ros_reader::fetch_last_frames(const nanoseconds& seek_time)
     {
         std::vector<std::shared_ptr<serialized_data>> result;
-        rosbag::View view(m_file, FalseQuery());
         auto as_rostime = to_rostime(seek_time);
         auto start_time = to_rostime(get_static_file_info_timestamp());
 
         for (auto topic : m_enabled_streams_topics)
         {
-            view.addQuery(m_file, rosbag::TopicQuery(topic), start_time, as_rostime);
-        }
-        std::map<device_serializer::stream_identifier, rs2rosinternal::Time> last_frames;
-        for (auto&& m : view)
-        {
-            if (m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::Imu>())
+            // The last frame at or before seek_time, from the index rather than by walking all the frames before it
+            auto const& times = get_frame_times(topic);
+            auto it = std::upper_bound(times.begin(), times.end(), as_rostime);
+            if (it == times.begin() || *--it < start_time)
+                continue;
+            rosbag::View view(m_file, rosbag::TopicQuery(topic), *it, *it);
+            auto msg = view.begin();
+            if ((*msg).isType<ros_imu_batch>())
             {
-                auto id = ros_topic::get_stream_identifier(m.getTopic());
-                last_frames[id] = m.getTime();
+                // The batch ends at or before seek_time, so its last sample is the one
+                auto batch = instantiate_msg<ros_imu_batch>(*msg);
+                if (batch->size() == 0)
+                    continue;
+                auto stream_id = ros_topic::get_stream_identifier(topic);
+                auto const last = batch->size() - 1;
+                auto frame = create_motion_sample(stream_id, *batch, last);
+                nanoseconds timestamp(batch->record_time[last]);
+                if (frame.frame == nullptr)
+                    result.push_back(std::make_shared<serialized_invalid_frame>(timestamp, stream_id));
+                else
+                    result.push_back(std::make_shared<serialized_frame>(timestamp, stream_id, std::move(frame)));
+                continue;
             }
-        }
-        for (auto&& kvp : last_frames)
-        {
-            auto topic = ros_topic::frame_data_topic(kvp.first);
-            rosbag::View view(m_file, rosbag::TopicQuery(topic), kvp.second, kvp.second);
-            auto msg = view.begin();
             auto new_frame = create_frame(*msg);
             result.push_back(new_frame);
         }
         return result;
     }
+
+    const std::vector<rs2rosinternal::Time>& ros_reader::get_frame_times(const std::string& topic)
+    {
+        auto it = m_frame_times.find(topic);
+        if (it != m_frame_times.end())
+            return it->second;
+
+        // Only the bag's index is read (it's loaded when the file is opened), never the chunks themselves
+        std::vector<rs2rosinternal::Time> times;
+        rosbag::View view(m_file, rosbag::TopicQuery(topic));
+        times.reserve(view.size());
+        for (auto&& m : view)
+        {
+            if (m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::CompressedImage>() || m.isType<sensor_msgs::Imu>()
+                || m.isType<ros_imu_batch>())
+                times.push_back(m.getTime());
+        }
+        return m_frame_times.emplace(topic, std::move(times)).first->second;
+    }
+
     nanoseconds ros_reader::query_duration() const
     {
         return m_total_duration;
@@ -152,9 +195,13 @@ namespace librealsense
     void ros_reader::reset()
     {
         m_file.close();
+        m_file.setMemoryMapped(m_memory_mapped);
         m_file.open(m_file_path, rosbag::BagMode::Read);
         m_version = read_file_version(m_file);
         m_samples_view = nullptr;
+        m_frame_times.clear();
+        m_motion_batch.reset();
+        m_motion_batch_start = nanoseconds(0);
         m_frame_source = std::make_shared<frame_source>(m_version == 1 ? 128 : 32);
         m_frame_source->init(m_metadata_parser_map);
         m_initial_device_description = read_device_description(get_static_file_info_timestamp(), true);
@@ -237,6 +284,12 @@ namespace librealsense
         }
         m_samples_itrator = m_samples_view->begin();
         m_enabled_streams_topics = get_topics(m_samples_view);
+        if (m_motion_batch
+            && std::find(m_enabled_streams_topics.begin(), m_enabled_streams_topics.end(), m_motion_batch_topic)
+                   == m_enabled_streams_topics.end())
+        {
+            m_motion_batch.reset();
+        }
     }
 
     const std::string& ros_reader::get_file_name() const
@@ -264,6 +317,10 @@ namespace librealsense
         {
             frame = create_image_from_message(msg);
         }
+        else if (msg.isType<sensor_msgs::CompressedImage>())
+        {
+            frame = create_image_from_encoded_depth(msg);
+        }
         else if (msg.isType<sensor_msgs::Imu>())
         {
             frame = create_motion_sample(msg);
@@ -346,6 +403,7 @@ namespace librealsense
                 LOG_WARNING("Failed to get timestamp_domain. Error: " << e.what());
             }
         }
+        additional_data.metadata_size = total_md_size;
     }
 
     std::map<std::string, std::string> ros_reader::get_frame_metadata(const rosbag::Bag& bag,
@@ -409,13 +467,46 @@ namespace librealsense
     {
         LOG_DEBUG("Trying to create an image frame from message");
         auto msg = instantiate_msg<sensor_msgs::Image>(image_data);
+        rs2_format stream_format;
+        convert(msg->encoding, stream_format);
+        return create_video_frame(image_data, msg->header, msg->depth_units, msg->width, msg->height, msg->step, stream_format,
+                                  [&](std::vector<uint8_t>& data) { data = std::move(msg->data); });
+    }
+
+    frame_holder ros_reader::create_image_from_encoded_depth(const rosbag::MessageInstance &image_data) const
+    {
+        LOG_DEBUG("Trying to create an image frame from an encoded depth message");
+        auto msg = instantiate_msg<sensor_msgs::CompressedImage>(image_data);
+        if (msg->format != ros_depth_codec::FORMAT)
+        {
+            throw io_exception( rsutils::string::from()
+                                << "Unsupported compressed image format \"" << msg->format
+                                << "\" (Topic: " << image_data.getTopic() << ")" );
+        }
+        auto info = ros_depth_codec::decode_info(msg->data.data(), msg->data.size());
+        return create_video_frame(image_data, msg->header, info.depth_units, info.width, info.height, info.step, RS2_FORMAT_Z16,
+                                  [&](std::vector<uint8_t>& data) {
+                                      data.resize(size_t(info.step) * info.height);
+                                      ros_depth_codec::decode(msg->data.data(), msg->data.size(), data.data());
+                                  });
+    }
+
+    frame_holder ros_reader::create_video_frame(const rosbag::MessageInstance& image_data,
+                                                const std_msgs::Header& header,
+                                                float depth_units,
+                                                uint32_t width,
+                                                uint32_t height,
+                                                uint32_t step,
+                                                rs2_format stream_format,
+                                                std::function<void(std::vector<uint8_t>&)> fill_data) const
+    {
         frame_additional_data additional_data{};
-        std::chrono::duration<double, std::milli> timestamp_ms(std::chrono::duration<double>(msg->header.stamp.toSec()));
+        std::chrono::duration<double, std::milli> timestamp_ms(std::chrono::duration<double>(header.stamp.toSec()));
         additional_data.timestamp = timestamp_ms.count();
-        additional_data.frame_number = msg->header.seq;
+        additional_data.frame_number = header.seq;
         additional_data.fisheye_ae_mode = false;
-        if (msg->depth_units)
-            additional_data.depth_units = msg->depth_units;
+        if (depth_units)
+            additional_data.depth_units = depth_units;
         else
             additional_data.depth_units = m_legacy_depth_units; // for old rosbag
 
@@ -436,7 +527,7 @@ namespace librealsense
 
         frame_interface * frame = m_frame_source->alloc_frame(
             { stream_id.stream_type, stream_id.stream_index, frame_source::stream_to_frame_types( stream_id.stream_type ) },
-            msg->data.size(),
+            size_t(step) * height,
             std::move( additional_data ),
             true );
 
@@ -446,16 +537,14 @@ namespace librealsense
             return nullptr;
         }
         librealsense::video_frame* video_frame = static_cast<librealsense::video_frame*>(frame);
-        video_frame->assign(msg->width, msg->height, msg->step, msg->step / msg->width * 8);
-        rs2_format stream_format;
-        convert(msg->encoding, stream_format);
+        video_frame->assign(width, height, step, step / width * 8);
         //attaching a temp stream to the frame. Playback sensor should assign the real stream
         frame->set_stream( std::make_shared< video_stream_profile >() );
         frame->get_stream()->set_format(stream_format);
         frame->get_stream()->set_stream_index(int(stream_id.stream_index));
         frame->get_stream()->set_stream_type(stream_id.stream_type);
-        video_frame->data = std::move(msg->data);
         librealsense::frame_holder fh{ video_frame };
+        fill_data(video_frame->data);
         LOG_DEBUG("Created image frame: " << stream_id << " " << video_frame->get_width() << "x" << video_frame->get_height() << " " << stream_format);
 
         return fh;
@@ -488,6 +577,79 @@ namespace librealsense
             get_frame_metadata(m_file, info_topic, stream_id, motion_data, additional_data);
         }
 
+        auto const& axes = stream_id.stream_type == RS2_STREAM_ACCEL ? msg->linear_acceleration : msg->angular_velocity;
+        float3 xyz{ static_cast<float>(axes.x), static_cast<float>(axes.y), static_cast<float>(axes.z) };
+        return create_motion_frame(stream_id, std::move(additional_data), xyz);
+    }
+
+    frame_holder ros_reader::create_motion_sample(const stream_identifier& stream_id, const ros_imu_batch& batch, size_t index) const
+    {
+        auto const count = batch.size();
+        if (batch.record_time.size() != count || batch.timestamp.size() != count || batch.system_time.size() != count
+            || batch.x.size() != count || batch.y.size() != count || batch.z.size() != count
+            || batch.metadata.size() != batch.metadata_type.size() * count)
+        {
+            throw io_exception( rsutils::string::from() << "Invalid batch of motion frames for stream " << stream_id );
+        }
+
+        frame_additional_data additional_data{};
+        additional_data.timestamp = batch.timestamp[index];
+        additional_data.frame_number = batch.frame_number[index];
+        additional_data.system_time = batch.system_time[index];
+        additional_data.fisheye_ae_mode = false;
+        safe_convert(batch.timestamp_domain, additional_data.timestamp_domain);
+
+        // Same layout as get_frame_metadata()
+        uint32_t total_md_size = 0;
+        for (size_t i = 0; i < batch.metadata_type.size(); ++i)
+        {
+            auto type = static_cast<rs2_frame_metadata_value>(batch.metadata_type[i]);
+            rs2_metadata_type md = batch.metadata[i * count + index];
+            if (total_md_size + sizeof(type) + sizeof(md) > 255)
+                break;
+            memcpy(additional_data.metadata_blob.data() + total_md_size, &type, sizeof(type));
+            total_md_size += static_cast<uint32_t>(sizeof(type));
+            memcpy(additional_data.metadata_blob.data() + total_md_size, &md, sizeof(md));
+            total_md_size += static_cast<uint32_t>(sizeof(md));
+        }
+        additional_data.metadata_size = total_md_size;
+
+        return create_motion_frame(stream_id, std::move(additional_data), { batch.x[index], batch.y[index], batch.z[index] });
+    }
+
+    std::shared_ptr<serialized_data> ros_reader::read_next_batched_motion_sample()
+    {
+        auto stream_id = ros_topic::get_stream_identifier(m_motion_batch_topic);
+        auto batch = m_motion_batch;
+        while (m_motion_batch_next < batch->size()
+               && nanoseconds(batch->record_time[m_motion_batch_next]) < m_motion_batch_start)
+        {
+            ++m_motion_batch_next;
+        }
+        if (m_motion_batch_next >= batch->size())
+        {
+            m_motion_batch.reset();
+            return read_next_data();
+        }
+
+        auto const index = m_motion_batch_next++;
+        if (m_motion_batch_next == batch->size())
+            m_motion_batch.reset();
+
+        nanoseconds timestamp(batch->record_time[index]);
+        auto frame = create_motion_sample(stream_id, *batch, index);
+        if (frame.frame == nullptr)
+            return std::make_shared<serialized_invalid_frame>(timestamp, stream_id);
+        return std::make_shared<serialized_frame>(timestamp, stream_id, std::move(frame));
+    }
+
+    frame_holder ros_reader::create_motion_frame(const stream_identifier& stream_id, frame_additional_data&& additional_data, const float3& xyz) const
+    {
+        if (stream_id.stream_type != RS2_STREAM_ACCEL && stream_id.stream_type != RS2_STREAM_GYRO)
+        {
+            throw io_exception( rsutils::string::from() << "Unsupported stream type " << stream_id.stream_type );
+        }
+
         frame_interface * frame = m_frame_source->alloc_frame(
             { stream_id.stream_type, stream_id.stream_index, RS2_EXTENSION_MOTION_FRAME },
             3 * sizeof( float ),
@@ -504,26 +666,11 @@ namespace librealsense
         frame->get_stream()->set_format(RS2_FORMAT_MOTION_XYZ32F);
         frame->get_stream()->set_stream_index(stream_id.stream_index);
         frame->get_stream()->set_stream_type(stream_id.stream_type);
-        if (stream_id.stream_type == RS2_STREAM_ACCEL)
-        {
-            auto data = reinterpret_cast<float*>(motion_frame->data.data());
-            data[0] = static_cast<float>(msg->linear_acceleration.x);
-            data[1] = static_cast<float>(msg->linear_acceleration.y);
-            data[2] = static_cast<float>(msg->linear_acceleration.z);
-            LOG_DEBUG("RS2_STREAM_ACCEL " << motion_frame);
-        }
-        else if (stream_id.stream_type == RS2_STREAM_GYRO)
-        {
-            auto data = reinterpret_cast<float*>(motion_frame->data.data());
-            data[0] = static_cast<float>(msg->angular_velocity.x);
-            data[1] = static_cast<float>(msg->angular_velocity.y);
-            data[2] = static_cast<float>(msg->angular_velocity.z);
-            LOG_DEBUG("RS2_STREAM_GYRO " << motion_frame);
-        }
-        else
-        {
-            throw io_exception( rsutils::string::from() << "Unsupported stream type " << stream_id.stream_type );
-        }
+        auto data = reinterpret_cast<float*>(motion_frame->data.data());
+        data[0] = xyz.x;
+        data[1] = xyz.y;
+        data[2] = xyz.z;
+        LOG_DEBUG((stream_id.stream_type == RS2_STREAM_ACCEL ? "RS2_STREAM_ACCEL " : "RS2_STREAM_GYRO ") << motion_frame);
         librealsense::frame_holder fh{ motion_frame };
         LOG_DEBUG("Created motion frame: " << stream_id);
 
@@ -6,6 +6,7 @@
 #include <core/serialization.h>
 #include "rosbag/view.h"
 #include "ros_file_format.h"
+#include "ros_imu_batch.h"
 
 #include <rsutils/string/from.h>
 
@@ -24,6 +25,7 @@ namespace librealsense
     class ros_reader: public device_serializer::reader
     {
     public:
+        // "playback-memory-mapped" in the context settings reads uncompressed chunks straight from a mapping of the file
         ros_reader(const std::string& file, const std::shared_ptr<context>& ctx);
         device_snapshot query_device_description(const nanoseconds& time) override;
         std::shared_ptr<serialized_data> read_next_data() override;
@@ -78,8 +80,16 @@ namespace librealsense
             const device_serializer::stream_identifier& stream_id,
             const rosbag::MessageInstance &msg,
             frame_additional_data& additional_data);
+        const std::vector<rs2rosinternal::Time>& get_frame_times(const std::string& topic);
         frame_holder create_image_from_message(const rosbag::MessageInstance &image_data) const;
+        frame_holder create_image_from_encoded_depth(const rosbag::MessageInstance &image_data) const;
+        frame_holder create_video_frame(const rosbag::MessageInstance& image_data, const std_msgs::Header& header, float depth_units,
+                                        uint32_t width, uint32_t height, uint32_t step, rs2_format stream_format,
+                                        std::function<void(std::vector<uint8_t>&)> fill_data) const;
         frame_holder create_motion_sample(const rosbag::MessageInstance &motion_data) const;
+        frame_holder create_motion_sample(const stream_identifier& stream_id, const ros_imu_batch& batch, size_t index) const;
+        frame_holder create_motion_frame(const stream_identifier& stream_id, frame_additional_data&& additional_data, const float3& xyz) const;
+        std::shared_ptr<serialized_data> read_next_batched_motion_sample();
         static inline float3 to_float3(const geometry_msgs::Vector3& v);
         static inline float4 to_float4(const geometry_msgs::Quaternion& q);
         frame_holder create_pose_sample(const rosbag::MessageInstance &msg) const;
@@ -137,5 +147,13 @@ namespace librealsense
         std::shared_ptr<context>                m_context;
         uint32_t                                m_version;
         float                                   m_legacy_depth_units;
+        bool                                    m_memory_mapped;  // read uncompressed chunks from a mapping of the file
+        // Time of every frame in each stream topic, sorted; built the first time a stream is seeked on
+        std::map<std::string, std::vector<rs2rosinternal::Time>> m_frame_times;
+        // The ros_imu_batch read_next_data() is handing out, one sample at a time
+        ros_imu_batch::ConstPtr                 m_motion_batch;
+        std::string                             m_motion_batch_topic;
+        size_t                                  m_motion_batch_next = 0;
+        nanoseconds                             m_motion_batch_start{ 0 };  // samples before this (the seek time) are skipped
     };
 }
@@ -10,6 +10,7 @@
 #include "proc/hdr-merge.h"
 #include "proc/sequence-id-filter.h"
 #include "ros_writer.h"
+#include "ros_depth_codec.h"
 #include "core/pose-frame.h"
 #include "core/motion-frame.h"
 #include <src/core/sensor-interface.h>
@@ -17,23 +18,218 @@
 
 #include <rsutils/string/from.h>
 
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <thread>
+
 namespace librealsense
 {
     using namespace device_serializer;
 
-    ros_writer::ros_writer(const std::string& file, bool compress_while_record) : m_file_path(file)
+    ros_writer::ros_writer(const std::string& file, bool compress_while_record)
+        : ros_writer(file, compress_while_record, rsutils::json::object())
+    {
+    }
+
+    ros_writer::ros_writer(const std::string& file, bool compress_while_record, rsutils::json const& settings)
+        : m_file_path(file)
+        , m_compress(compress_while_record)
+        , m_first_file_path(file)
     {
         LOG_INFO("Compression while record is set to " << (compress_while_record ? "ON" : "OFF"));
-        m_bag.open(file, rosbag::BagMode::Write);
         if (compress_while_record)
         {
-            m_bag.setCompression(rosbag::CompressionType::LZ4);
+            // Chunks are compressed in the background, in parallel, so compression doesn't hold back the writer
+            uint32_t const default_threads = std::max(1u, std::min(4u, std::thread::hardware_concurrency() / 2));
+            m_compression_threads
+                = settings.nested(std::string("record-compression-threads", 26)).default_value(default_threads);
+        }
+        m_encode_depth = settings.nested(std::string("record-depth-codec", 18)).default_value(false);
+        if (auto chunk_size = settings.nested(std::string("record-chunk-size", 17)))
+        {
+            m_chunk_size = chunk_size.get<uint32_t>();  // NOTE: can throw!
+        }
+        m_motion_batch_size = settings.nested(std::string("record-motion-batch", 19)).default_value(0u);
+        if (m_motion_batch_size == 1)
+            m_motion_batch_size = 0;
+
+        for (int i = RS2_STREAM_ANY + 1; i < RS2_STREAM_COUNT; ++i)
+        {
+            auto const stream = static_cast<rs2_stream>(i);
+            std::string name = librealsense::get_string(stream);
+            std::transform(name.begin(), name.end(), name.begin(), [](char c) { return char(std::tolower(c)); });
+            double const fps = settings.nested(std::string("record-fps", 10), name).default_value(0.);
+            if (fps > 0)
+                m_record_periods[stream] = nanoseconds(static_cast<int64_t>(1e9 / fps));
+        }
+        auto const split = settings.nested(std::string("record-split", 12));
+        m_split_size = static_cast<uint64_t>(split.nested(std::string("size", 4)).default_value(0.) * 1e6);
+        m_split_duration = nanoseconds(static_cast<int64_t>(split.nested(std::string("duration", 8)).default_value(0.) * 1e9));
+
+        m_bag = open_bag(file);
+        write_file_version();
+        open_next_bag();
+    }
+
+    ros_writer::~ros_writer()
+    {
+        // Whatever samples are left
+        write_motion_batches();
+
+        // A next file that was not needed
+        if (m_next_bag.valid())
+        {
+            try
+            {
+                m_next_bag.get()->close();
+                std::remove(m_next_file_path.c_str());
+            }
+            catch (std::exception const& e)
+            {
+                LOG_WARNING("Failed to open " << m_next_file_path << ": " << e.what());
+            }
+        }
+        for (auto&& closing : m_closing_bags)
+            closing.wait();
+    }
+
+    std::unique_ptr<rosbag::Bag> ros_writer::open_bag(const std::string& file) const
+    {
+        std::unique_ptr<rosbag::Bag> bag(new rosbag::Bag());
+        bag->open(file, rosbag::BagMode::Write);
+        if (m_compress)
+        {
+            bag->setCompression(rosbag::CompressionType::LZ4);
+            bag->setCompressionThreads(m_compression_threads);
+        }
+        if (m_chunk_size)
+            bag->setChunkThreshold(m_chunk_size);
+        return bag;
+    }
+
+    std::string ros_writer::get_split_file_name(unsigned index) const
+    {
+        auto const dot = m_first_file_path.find_last_of('.');
+        auto const slash = m_first_file_path.find_last_of("/\\");
+        auto const has_extension = dot != std::string::npos && (slash == std::string::npos || dot > slash);
+        std::string const base = has_extension ? m_first_file_path.substr(0, dot) : m_first_file_path;
+        std::string const extension = has_extension ? m_first_file_path.substr(dot) : std::string(".bag");
+        char number[16];
+        snprintf(number, sizeof(number), "_%03u", index);
+        return base + number + extension;
+    }
+
+    void ros_writer::open_next_bag()
+    {
+        if (!m_split_size && m_split_duration.count() <= 0)
+            return;
+        m_next_file_path = get_split_file_name(m_file_index + 1);
+        auto file = m_next_file_path;
+        m_next_bag = std::async(std::launch::async, [this, file]() { return open_bag(file); });
+    }
+
+    bool ros_writer::should_record(const stream_identifier& stream_id, const nanoseconds& timestamp)
+    {
+        auto period = m_record_periods.find(stream_id.stream_type);
+        if (period == m_record_periods.end())
+            return true;
+
+        // Frames are taken on a fixed schedule, so that the rate is right on average whatever the jitter
+        auto next = m_next_record_time.find(stream_id);
+        if (next == m_next_record_time.end())
+        {
+            m_next_record_time[stream_id] = timestamp + period->second;
+            return true;
+        }
+        if (timestamp < next->second)
+            return false;
+        next->second += period->second;
+        if (timestamp >= next->second)  // fell behind, e.g. after a pause
+            next->second = timestamp + period->second;
+        return true;
+    }
+
+    bool ros_writer::should_split(const nanoseconds& timestamp) const
+    {
+        if (!m_next_bag.valid())
+            return false;
+        if (m_split_size && m_bag->getSize() >= m_split_size)
+            return true;
+        return m_split_duration.count() > 0 && timestamp - m_file_start_time >= m_split_duration;
+    }
+
+    void ros_writer::split(const nanoseconds& timestamp)
+    {
+        write_motion_batches();
+
+        std::unique_ptr<rosbag::Bag> next;
+        try
+        {
+            next = m_next_bag.get();
         }
+        catch (std::exception const& e)
+        {
+            // Keep writing to the current file, and try another next time
+            LOG_ERROR("Failed to open " << m_next_file_path << " to split the recording: " << e.what());
+            open_next_bag();
+            return;
+        }
+
+        m_closing_bags.erase(std::remove_if(m_closing_bags.begin(), m_closing_bags.end(),
+            [](std::future<void> const& f) { return f.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }),
+            m_closing_bags.end());
+        std::shared_ptr<rosbag::Bag> previous(std::move(m_bag));
+        m_closing_bags.push_back(std::async(std::launch::async, [previous]() { previous->close(); }));
+
+        m_bag = std::move(next);
+        m_file_path = m_next_file_path;
+        ++m_file_index;
+        m_file_start_time = timestamp;
+        LOG_INFO("Recording continues in " << m_file_path);
+
+        // Everything needed to play the file on its own
         write_file_version();
+        m_extrinsics_msgs.clear();  // written again with the next frame of each stream
+        m_written_options_descriptions.clear();
+        if (m_device_description)
+            write_device_description(*m_device_description);
+        auto snapshots = m_snapshots;
+        for (auto&& snapshot : snapshots)
+        {
+            auto const& key = snapshot.first;
+            // Written when they were taken, or at the start of this file
+            auto const time = snapshot.second.first == get_static_file_info_timestamp()
+                ? snapshot.second.first
+                : std::max(snapshot.second.first, timestamp);
+            write_extension_snapshot(std::get<0>(key), std::get<1>(key), time, std::get<2>(key), snapshot.second.second);
+        }
+
+        open_next_bag();
+    }
+
+    void ros_writer::write_motion_batches()
+    {
+        while (!m_motion_batches.empty())
+        {
+            auto stream_id = m_motion_batches.begin()->first;
+            try
+            {
+                write_motion_batch(stream_id);
+            }
+            catch (std::exception const& e)
+            {
+                LOG_WARNING("Failed to write motion samples of " << stream_id << ". Exception: " << e.what());
+                m_motion_batches.erase(stream_id);
+            }
+        }
     }
 
     void ros_writer::write_device_description(const librealsense::device_snapshot& device_description)
     {
+        if (!m_device_description || &device_description != m_device_description.get())
+            m_device_description.reset(new device_snapshot(device_description));
+
         for (auto&& device_extension_snapshot : device_description.get_device_extensions_snapshots().get_snapshots())
         {
             write_extension_snapshot(get_device_index(), get_static_file_info_timestamp(), device_extension_snapshot.first, device_extension_snapshot.second);
@@ -50,6 +246,11 @@ namespace librealsense
 
     void ros_writer::write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
     {
+        if (!should_record(stream_id, timestamp))
+            return;
+        if (should_split(timestamp))
+            split(timestamp);
+
         if (Is<video_frame>(frame.frame))
         {
             write_video_frame(stream_id, timestamp, std::move(frame));
@@ -76,6 +277,17 @@ namespace librealsense
 
     void ros_writer::write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot)
     {
+        if (m_next_bag.valid())
+        {
+            // Kept for the next files
+            snapshot_key key{ sensor_id.device_index, sensor_id.sensor_index, type, -1, -1 };
+            if (auto profile = As<stream_profile_interface>(snapshot))
+            {
+                std::get<3>(key) = profile->get_stream_type();
+                std::get<4>(key) = profile->get_stream_index();
+            }
+            m_snapshots[key] = { timestamp, snapshot };
+        }
         write_extension_snapshot(sensor_id.device_index, sensor_id.sensor_index, timestamp, type, snapshot);
     }
 
@@ -175,19 +387,25 @@ namespace librealsense
 
     void ros_writer::write_video_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
     {
-        sensor_msgs::Image image;
+        ros_image_view image;
         auto vid_frame = dynamic_cast<librealsense::video_frame*>(frame.frame);
         if (!vid_frame)
             throw std::runtime_error("Frame is not video frame");
 
+        if (m_encode_depth && vid_frame->get_stream()->get_format() == RS2_FORMAT_Z16)
+        {
+            write_encoded_depth_frame(stream_id, timestamp, vid_frame);
+            return;
+        }
+
         image.width = static_cast<uint32_t>(vid_frame->get_width());
         image.height = static_cast<uint32_t>(vid_frame->get_height());
         image.step = static_cast<uint32_t>(vid_frame->get_stride());
         convert(vid_frame->get_stream()->get_format(), image.encoding);
         image.is_bigendian = is_big_endian();
-        auto size = vid_frame->get_stride() * vid_frame->get_height();
-        auto p_data = vid_frame->get_frame_data();
-        image.data.assign(p_data, p_data + size);
+        // Serialized directly from the frame, which we hold until write_message() returns
+        image.data = vid_frame->get_frame_data();
+        image.data_size = static_cast<uint32_t>(vid_frame->get_stride() * vid_frame->get_height());
         image.header.seq = static_cast<uint32_t>(vid_frame->get_frame_number());
         std::chrono::duration<double, std::milli> timestamp_ms(vid_frame->get_frame_timestamp());
         image.header.stamp = rs2rosinternal::Time(std::chrono::duration<double>(timestamp_ms).count());
@@ -200,6 +418,27 @@ namespace librealsense
         write_additional_frame_messages(stream_id, timestamp, frame);
     }
 
+    void ros_writer::write_encoded_depth_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, video_frame* vid_frame)
+    {
+        sensor_msgs::CompressedImage image;
+        image.header.seq = static_cast<uint32_t>(vid_frame->get_frame_number());
+        std::chrono::duration<double, std::milli> timestamp_ms(vid_frame->get_frame_timestamp());
+        image.header.stamp = rs2rosinternal::Time(std::chrono::duration<double>(timestamp_ms).count());
+        image.header.version = "1"; // the field is unused and therefore assigned for ROSbag versions control
+        image.format = ros_depth_codec::FORMAT;
+
+        ros_depth_codec::image_info info;
+        info.width = static_cast<uint32_t>(vid_frame->get_width());
+        info.height = static_cast<uint32_t>(vid_frame->get_height());
+        info.step = static_cast<uint32_t>(vid_frame->get_stride());
+        auto df = dynamic_cast<librealsense::depth_frame*>(vid_frame);
+        info.depth_units = df ? df->get_units() : 0.f;
+        ros_depth_codec::encode(info, vid_frame->get_frame_data(), image.data);
+
+        write_message(ros_topic::frame_data_topic(stream_id), timestamp, image);
+        write_additional_frame_messages(stream_id, timestamp, vid_frame);
+    }
+
     void ros_writer::write_motion_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
     {
         sensor_msgs::Imu imu_msg;
@@ -208,6 +447,12 @@ namespace librealsense
             throw io_exception("Null frame passed to write_motion_frame");
         }
 
+        if (m_motion_batch_size)
+        {
+            add_to_motion_batch(stream_id, timestamp, frame.frame);
+            return;
+        }
+
         imu_msg.header.seq = static_cast<uint32_t>(frame.frame->get_frame_number());
         std::chrono::duration<double, std::milli> timestamp_ms(frame.frame->get_frame_timestamp());
         imu_msg.header.stamp = rs2rosinternal::Time(std::chrono::duration<double>(timestamp_ms).count());
@@ -236,6 +481,93 @@ namespace librealsense
         write_additional_frame_messages(stream_id, timestamp, frame);
     }
 
+    void ros_writer::add_to_motion_batch(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame)
+    {
+        if (stream_id.stream_type != RS2_STREAM_ACCEL && stream_id.stream_type != RS2_STREAM_GYRO)
+        {
+            throw io_exception("Unsupported stream type for a motion frame");
+        }
+
+        std::vector<uint32_t> metadata_type;
+        std::vector<int64_t> metadata;
+        for (int i = 0; i < static_cast<rs2_frame_metadata_value>(rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT); i++)
+        {
+            rs2_metadata_type md;
+            if (frame->find_metadata(static_cast<rs2_frame_metadata_value>(i), &md))
+            {
+                metadata_type.push_back(i);
+                metadata.push_back(md);
+            }
+        }
+        std::string timestamp_domain = librealsense::get_string(frame->get_frame_timestamp_domain());
+
+        auto it = m_motion_batches.find(stream_id);
+        if (it != m_motion_batches.end()
+            && (it->second.second.metadata_type != metadata_type || it->second.second.timestamp_domain != timestamp_domain))
+        {
+            write_motion_batch(stream_id);
+            it = m_motion_batches.end();
+        }
+        if (it == m_motion_batches.end())
+        {
+            it = m_motion_batches.emplace(stream_id, std::make_pair(timestamp, ros_imu_batch())).first;
+            auto& batch = it->second.second;
+            batch.header.seq = static_cast<uint32_t>(frame->get_frame_number());
+            std::chrono::duration<double, std::milli> timestamp_ms(frame->get_frame_timestamp());
+            batch.header.stamp = rs2rosinternal::Time(std::chrono::duration<double>(timestamp_ms).count());
+            batch.header.version = "1";
+            batch.timestamp_domain = std::move(timestamp_domain);
+            batch.metadata_type = std::move(metadata_type);
+            batch.metadata.resize(batch.metadata_type.size() * m_motion_batch_size);
+        }
+
+        auto& batch = it->second.second;
+        auto const index = batch.size();
+        auto data_ptr = reinterpret_cast<const float*>(frame->get_frame_data());
+        it->second.first = timestamp;
+        batch.record_time.push_back(static_cast<int64_t>(timestamp.count()));
+        batch.frame_number.push_back(frame->get_frame_number());
+        batch.timestamp.push_back(frame->get_frame_timestamp());
+        batch.system_time.push_back(frame->get_frame_system_time());
+        batch.x.push_back(data_ptr[0]);
+        batch.y.push_back(data_ptr[1]);
+        batch.z.push_back(data_ptr[2]);
+        for (size_t i = 0; i < metadata.size(); ++i)
+            batch.metadata[i * m_motion_batch_size + index] = metadata[i];
+
+        try
+        {
+            write_extrinsics(stream_id, frame);
+        }
+        catch (std::exception const& e)
+        {
+            LOG_WARNING("Failed to write stream extrinsics for " << stream_id.stream_type << ". Exception: " << e.what());
+        }
+
+        if (batch.size() == m_motion_batch_size)
+            write_motion_batch(stream_id);
+    }
+
+    void ros_writer::write_motion_batch(const stream_identifier& stream_id)
+    {
+        auto it = m_motion_batches.find(stream_id);
+        if (it == m_motion_batches.end())
+            return;
+        auto time = it->second.first;
+        auto batch = std::move(it->second.second);
+        m_motion_batches.erase(it);
+
+        // The metadata was laid out for a full batch
+        auto const count = batch.size();
+        if (count < m_motion_batch_size)
+        {
+            for (size_t i = 1; i < batch.metadata_type.size(); ++i)
+                std::copy_n(batch.metadata.begin() + i * m_motion_batch_size, count, batch.metadata.begin() + i * count);
+            batch.metadata.resize(batch.metadata_type.size() * count);
+        }
+        write_message(ros_topic::frame_data_topic(stream_id), time, batch);
+    }
+
     inline geometry_msgs::Vector3 ros_writer::to_vector3(const float3& f)
     {
         geometry_msgs::Vector3 v;
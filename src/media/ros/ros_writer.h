@@ -4,8 +4,15 @@
 #pragma once
 #include "rosbag/bag.h"
 #include "ros_file_format.h"
+#include "ros_image_view.h"
+#include "ros_imu_batch.h"
 
 #include <rsutils/string/from.h>
+#include <rsutils/json.h>
+
+#include <future>
+#include <memory>
+#include <tuple>
 
 
 namespace librealsense
@@ -13,11 +20,21 @@ namespace librealsense
     using namespace device_serializer;
 
     class recommended_proccesing_blocks_interface;
+    class video_frame;
 
     class ros_writer: public writer
     {
     public:
         explicit ros_writer(const std::string& file, bool compress_while_record);
+        // Also applies "record-compression-threads", "record-chunk-size", "record-depth-codec" and "record-motion-batch"
+        // from the context settings, and:
+        //     "record-fps": { "<stream>": fps, ... } to record only that many frames per second of a stream type
+        //         ("color", "depth", "gyro", ...), whatever it streams at
+        //     "record-split": { "size": MB, "duration": seconds } to go on in a new file (<name>_001.bag, ...) when the
+        //         current one reaches either; each file gets the device and stream information and can be played on
+        //         its own, with its times starting at 0
+        ros_writer(const std::string& file, bool compress_while_record, rsutils::json const& settings);
+        ~ros_writer();
         void write_device_description(const librealsense::device_snapshot& device_description) override;
         void write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame) override;
         void write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
@@ -25,6 +42,13 @@ namespace librealsense
         const std::string& get_file_name() const override;
 
     private:
+        std::unique_ptr<rosbag::Bag> open_bag(const std::string& file) const;
+        std::string get_split_file_name(unsigned index) const;
+        void open_next_bag();
+        bool should_record(const stream_identifier& stream_id, const nanoseconds& timestamp);
+        bool should_split(const nanoseconds& timestamp) const;
+        void split(const nanoseconds& timestamp);
+        void write_motion_batches();
         void write_file_version();
         void write_frame_metadata(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame);
         void write_extrinsics(const stream_identifier& stream_id, frame_interface* frame);
@@ -32,7 +56,10 @@ namespace librealsense
         void write_notification(const sensor_identifier& sensor_id, const nanoseconds& timestamp, const notification& n) override;
         void write_additional_frame_messages(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame);
         void write_video_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame);
+        void write_encoded_depth_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, video_frame* frame);
         void write_motion_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame);
+        void add_to_motion_batch(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame);
+        void write_motion_batch(const stream_identifier& stream_id);
         inline geometry_msgs::Vector3 to_vector3(const float3& f);
         inline geometry_msgs::Quaternion to_quaternion(const float4& f);
         void write_pose_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame);
@@ -67,7 +94,9 @@ namespace librealsense
         {
             try
             {
-                m_bag.write(topic, to_rostime(time), msg);
+                // Times are relative to the start of the current file
+                auto const file_time = time == get_static_file_info_timestamp() ? time : time - m_file_start_time;
+                m_bag->write(topic, to_rostime(file_time), msg);
                 LOG_DEBUG("Recorded: \"" << topic << "\" . TS: " << time.count());
             }
             catch (rosbag::BagIOException& e)
@@ -80,7 +109,35 @@ namespace librealsense
         static uint8_t is_big_endian();
         std::map<stream_identifier, geometry_msgs::Transform> m_extrinsics_msgs;
         std::string m_file_path;
-        rosbag::Bag m_bag;
+        std::unique_ptr<rosbag::Bag> m_bag;
         std::map<uint32_t, std::set<rs2_option>> m_written_options_descriptions;
+        bool m_encode_depth = false;  // Z16 frames are written with ros_depth_codec
+        size_t m_motion_batch_size = 0;  // motion samples per ros_imu_batch; 0 writes each sample as its own Imu message
+        std::map<stream_identifier, std::pair<nanoseconds, ros_imu_batch>> m_motion_batches;  // with their last sample's time
+
+        // How bags are opened
+        bool m_compress = false;
+        uint32_t m_compression_threads = 1;
+        uint32_t m_chunk_size = 0;  // 0 for the default
+
+        std::map<rs2_stream, nanoseconds> m_record_periods;  // of streams recorded at a lower rate
+        std::map<stream_identifier, nanoseconds> m_next_record_time;
+
+        // Splitting: the next file is opened in the background while this one is written, and the last one is closed
+        // in the background, so that the frames around the split are not held back
+        uint64_t m_split_size = 0;  // bytes
+        nanoseconds m_split_duration{ 0 };
+        std::string m_first_file_path;
+        unsigned m_file_index = 0;
+        nanoseconds m_file_start_time{ 0 };
+        std::string m_next_file_path;
+        std::future<std::unique_ptr<rosbag::Bag>> m_next_bag;
+        std::vector<std::future<void>> m_closing_bags;
+
+        // What is written to the start of every file: the device description, and the last snapshot of each kind
+        // (per stream, for profiles) of every sensor
+        std::unique_ptr<device_snapshot> m_device_description;
+        using snapshot_key = std::tuple<uint32_t, uint32_t, rs2_extension, int, int>;  // device, sensor, type, stream, index
+        std::map<snapshot_key, std::pair<nanoseconds, std::shared_ptr<extension_snapshot>>> m_snapshots;
     };
 }
@@ -13,6 +13,7 @@
 #include "usb/usb-device.h"
 #include "usb/usb-enumerator.h"
 #include "../types.h"
+#include <rsutils/concurrency/thread-policy.h>
 #include <mfapi.h>
 #include <chrono>
 #include <Windows.h>
@@ -197,7 +198,10 @@ namespace librealsense
                 _last = backend_device_group( _backend->query_uvc_devices(),
                                               _backend->query_usb_devices(),
                                               _backend->query_hid_devices() );
-                _thread = std::thread([this]() { run(); });
+                _thread = std::thread([this]() {
+                    rsutils::concurrency::apply_thread_policy( nullptr );
+                    run();
+                });
             }
 
             void stop() override
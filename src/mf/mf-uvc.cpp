@@ -213,7 +213,10 @@ namespace librealsense
                                 auto profile = stream.profile;
                                 frame_object f{ current_length, metadata_size, byte_buffer, metadata, monotonic_to_realtime(llTimestamp/10000.f) };
 
-                                auto continuation = [buffer, this]()
+                                // The sample is referenced along with its buffer: in zero-copy mode the frame keeps
+                                // pointing into it, and the reader must not recycle it until the frame is released
+                                CComPtr<IMFSample> held_sample = sample;
+                                auto continuation = [buffer, held_sample]()
                                 {
                                     buffer->Unlock();
                                 };
@@ -0,0 +1,134 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+
+namespace librealsense {
+
+
+// The recent samples of a motion stream, for consumers that need "all the samples between t0 and t1" (e.g., visual-
+// inertial odometry) without keeping their own copy of every frame.
+//
+// There is a single writer (the stream's processing thread) and any number of readers, none of which lock: the writer
+// just overwrites the oldest sample, and readers check afterwards whether what they read was overwritten meanwhile.
+//
+// Every sample is stored twice, at its slot and at its slot + CAPACITY, so any run of consecutive samples is contiguous
+// in memory and can be handed out as a span without copying.
+//
+// Timestamps are expected to increase; they are in whatever domain the stream's frames are (the global time domain,
+// when global time is enabled).
+//
+class motion_sample_ring
+{
+public:
+    static constexpr size_t CAPACITY = 1024;  // 2.5 seconds of 400 Hz gyro
+
+    struct span
+    {
+        rs2_motion_sample const * data = nullptr;
+        size_t size = 0;
+        uint64_t first = 0;  // index of data[0] among all samples pushed; for is_valid()
+    };
+
+    motion_sample_ring() = default;
+    motion_sample_ring( motion_sample_ring const & ) = delete;
+
+    // Writer only
+    void push( rs2_motion_sample const & sample )
+    {
+        auto const n = _pushed.load( std::memory_order_relaxed );
+        auto const slot = size_t( n % CAPACITY );
+        // Readers of the slot we're about to overwrite must see it gone before we touch it
+        _overwriting.store( n + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        _samples[slot] = sample;
+        _samples[slot + CAPACITY] = sample;
+        _pushed.store( n + 1, std::memory_order_release );
+    }
+
+    size_t size() const
+    {
+        auto const n = _pushed.load( std::memory_order_acquire );
+        return size_t( n - first_intact( n + 1 ) );  // as find()
+    }
+
+    // The samples with timestamps in [from, to], oldest first. Zero-copy: the span points into the ring and may be
+    // overwritten once the writer laps it, so check is_valid() after reading from it.
+    span find( double from, double to ) const
+    {
+        span s;
+        auto const n = _pushed.load( std::memory_order_acquire );
+        auto lower = first_intact( n + 1 ), upper = n;  // the next push may already be under way
+        auto const at = [this]( uint64_t i ) -> rs2_motion_sample const & { return _samples[size_t( i % CAPACITY )]; };
+        // First sample at or after 'from'
+        for( auto count = upper - lower; count > 0; )
+        {
+            auto const step = count / 2;
+            if( at( lower + step ).timestamp < from )
+            {
+                lower += step + 1;
+                count -= step + 1;
+            }
+            else
+                count = step;
+        }
+        // First sample after 'to'
+        auto last = lower;
+        for( auto count = upper - last; count > 0; )
+        {
+            auto const step = count / 2;
+            if( at( last + step ).timestamp <= to )
+            {
+                last += step + 1;
+                count -= step + 1;
+            }
+            else
+                count = step;
+        }
+        s.first = lower;
+        s.size = size_t( last - lower );
+        s.data = &_samples[size_t( lower % CAPACITY )];
+        return s;
+    }
+
+    // True if none of the span's samples were overwritten since find() returned it
+    bool is_valid( span const & s ) const
+    {
+        std::atomic_thread_fence( std::memory_order_acquire );
+        return s.first >= first_intact( _overwriting.load( std::memory_order_relaxed ) );
+    }
+
+    // Copies up to 'max' of the samples in [from, to] into 'out', retrying if the writer got in the way; returns how
+    // many were copied
+    size_t copy( double from, double to, rs2_motion_sample * out, size_t max ) const
+    {
+        while( true )
+        {
+            auto s = find( from, to );
+            auto const n = std::min( s.size, max );
+            if( n )
+                std::memcpy( out, s.data, n * sizeof( rs2_motion_sample ) );
+            if( is_valid( s ) )
+                return n;
+        }
+    }
+
+private:
+    // Once writing of the 'started'-th sample has begun, the oldest sample whose slot was not reused
+    static uint64_t first_intact( uint64_t started ) { return started > CAPACITY ? started - CAPACITY : 0; }
+
+    rs2_motion_sample _samples[2 * CAPACITY];
+    std::atomic< uint64_t > _pushed{ 0 };       // samples fully written
+    std::atomic< uint64_t > _overwriting{ 0 };  // samples whose writing has started
+};
+
+
+}  // namespace librealsense
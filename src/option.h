@@ -329,6 +329,11 @@ namespace librealsense
             return  _proxy->is_read_only();
         }
 
+        bool can_set_while_streaming() const override
+        {
+            return _proxy->can_set_while_streaming();
+        }
+
         void enable_recording(std::function<void(const option&)> record_action) override
         {
             _recording_function = record_action;
@@ -11,12 +11,16 @@ namespace librealsense
 {
     namespace pipeline
     {
-        aggregator::aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync) :
+        aggregator::aggregator(const std::vector<int>& streams_to_aggregate,
+                               const std::vector<int>& streams_to_sync,
+                               bool latest_only) :
             processing_block("aggregator"),
-            _queue(new single_consumer_frame_queue<frame_holder>(1)),
+            _queue(new single_consumer_frame_queue<frame_holder, lock_free_single_consumer_queue<frame_holder>>(1)),
             _streams_to_aggregate_ids(streams_to_aggregate),
             _streams_to_sync_ids(streams_to_sync),
-            _accepting(true)
+            _accepting(true),
+            _latest_only(latest_only),
+            _latest(nullptr)
         {
             set_processing_callback(
                 make_frame_processor_callback( [&]( frame_holder && frame, synthetic_source_interface * source )
@@ -75,7 +79,7 @@ namespace librealsense
                 source->frame_ready(async_fref.clone());
 
                 // for sync pipeline usage - push the aggregated to the output queue
-                _queue->enqueue(sync_fref.clone());
+                publish(sync_fref.clone());
             }
             else
             {
@@ -95,18 +99,62 @@ namespace librealsense
                         return;
                     }
                     // for sync pipeline usage - push the aggregated to the output queue
-                    _queue->enqueue(sync_fref.clone());
+                    publish(sync_fref.clone());
                 }
             }
         }
 
+        aggregator::~aggregator()
+        {
+            frame_holder unused( _latest.exchange( nullptr ) );
+        }
+
+        void aggregator::publish(frame_holder&& frameset)
+        {
+            if (!_latest_only)
+            {
+                _queue->enqueue(std::move(frameset));
+                return;
+            }
+
+            // Whatever was there and not yet taken is stale now
+            frame_holder stale( _latest.exchange( frameset.frame ) );
+            frameset.frame = nullptr;
+            if (!stale)
+            {
+                // A waiter may be between checking the mailbox and going to sleep; the lock makes sure it isn't
+                std::lock_guard<std::mutex> lock(_latest_mutex);
+                _latest_cv.notify_all();
+            }
+        }
+
+        bool aggregator::take_latest(frame_holder* item)
+        {
+            auto f = _latest.exchange( nullptr );
+            if (!f)
+                return false;
+            *item = frame_holder( f );
+            return true;
+        }
+
         bool aggregator::dequeue(frame_holder* item, unsigned int timeout_ms)
         {
-            return _queue->dequeue(item, timeout_ms);
+            if (!_latest_only)
+                return _queue->dequeue(item, timeout_ms);
+
+            if (take_latest(item))
+                return true;
+            std::unique_lock<std::mutex> lock(_latest_mutex);
+            _latest_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]() {
+                return !_accepting || _latest.load() != nullptr;
+            });
+            return take_latest(item);
         }
 
         bool aggregator::try_dequeue(frame_holder* item)
         {
+            if (_latest_only)
+                return take_latest(item);
             return _queue->try_dequeue(item);
         }
 
@@ -119,6 +167,9 @@ namespace librealsense
         {
             _accepting = false;
             _queue->stop();
+            frame_holder unused( _latest.exchange( nullptr ) );
+            std::lock_guard<std::mutex> lock(_latest_mutex);
+            _latest_cv.notify_all();
         }
     }
 }
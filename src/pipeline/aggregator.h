@@ -8,6 +8,7 @@
 #include <memory>
 #include <map>
 #include <mutex>
+#include <condition_variable>
 #include <atomic>
 
 
@@ -22,13 +23,27 @@ namespace librealsense
         {
             std::mutex _mutex;
             std::map<int /*stream_id*/, frame_holder> _last_set;
-            std::unique_ptr<single_consumer_frame_queue<frame_holder>> _queue;
+            std::unique_ptr<single_consumer_frame_queue<frame_holder, lock_free_single_consumer_queue<frame_holder>>> _queue;
             std::vector<int> _streams_to_aggregate_ids;
             std::vector<int> _streams_to_sync_ids;
             std::atomic<bool> _accepting;
+
+            // "Latest only" mode: instead of _queue, a single-slot mailbox that each new frameset overwrites, so
+            // dequeue never returns a set older than the last one published. Taking from it is a single exchange; the
+            // mutex and condition-variable are only for waiting when it is empty.
+            bool const _latest_only;
+            std::atomic<frame_interface*> _latest;
+            std::mutex _latest_mutex;
+            std::condition_variable _latest_cv;
+            void publish(frame_holder&& frameset);
+            bool take_latest(frame_holder* item);
+
             void handle_frame(frame_holder frame, synthetic_source_interface* source);
         public:
-            aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync);
+            aggregator(const std::vector<int>& streams_to_aggregate,
+                       const std::vector<int>& streams_to_sync,
+                       bool latest_only = false);
+            ~aggregator();
             bool dequeue(frame_holder* item, unsigned int timeout_ms);
             bool try_dequeue(frame_holder* item);
             void start();
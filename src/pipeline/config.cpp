@@ -72,6 +72,25 @@ namespace librealsense
             return _resolved_profile;
         }
 
+        std::string config::get_resolve_key()
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            if (!_device_request.filename.empty() || !_device_request.record_output.empty())
+                return {};
+
+            rsutils::string::from key;
+            key << _device_request.serial << '|' << _enable_all_streams;
+            for (auto&& req : _stream_requests)
+            {
+                auto& r = req.second;
+                key << '|' << r.stream << ',' << r.index << ',' << r.width << 'x' << r.height << ',' << r.format << ','
+                    << r.fps;
+            }
+            for (auto&& st : _streams_to_disable)
+                key << "|-" << st.first << ',' << st.second;
+            return key;
+        }
+
         void config::disable_stream(rs2_stream stream, int index)
         {
             std::lock_guard<std::mutex> lock(_mtx);
@@ -32,6 +32,9 @@ namespace librealsense
 
             //Non top level API
             std::shared_ptr<profile> get_cached_resolved_profile();
+            // Identifies what this config asks for, so that equivalent configs resolve to the same profile; empty if
+            // the result must not be reused (recording or playback, where the profile owns a file)
+            std::string get_resolve_key();
 
             config(const config& other)
             {
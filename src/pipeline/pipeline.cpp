@@ -9,6 +9,7 @@
 #include "media/ros/ros_writer.h"
 #include <src/proc/syncer-processing-block.h>
 #include <src/core/frame-callback.h>
+#include <src/context.h>
 
 #include <rsutils/string/from.h>
 
@@ -65,10 +66,15 @@ namespace librealsense
             std::shared_ptr<profile> profile = nullptr;
             //first try to get the previously resolved profile (if exists)
             auto cached_profile = conf->get_cached_resolved_profile();
+            auto const key = conf->get_resolve_key();
             if (cached_profile)
             {
                 profile = cached_profile;
             }
+            else if (auto previous = find_resolved_profile(key))
+            {
+                profile = previous;
+            }
             else
             {
                 const int NUM_TIMES_TO_RETRY = 3;
@@ -85,6 +91,12 @@ namespace librealsense
                             throw;
                     }
                 }
+                if (!key.empty())
+                {
+                    if (_resolved_profiles.size() >= MAX_RESOLVED_PROFILES)
+                        _resolved_profiles.clear();
+                    _resolved_profiles[key] = profile;
+                }
             }
 
             assert(profile);
@@ -123,6 +135,22 @@ namespace librealsense
             _prev_conf = std::make_shared<config>(*conf);
         }
 
+        std::shared_ptr<profile> pipeline::find_resolved_profile(std::string const & key)
+        {
+            if (key.empty())
+                return nullptr;
+            auto it = _resolved_profiles.find(key);
+            if (it == _resolved_profiles.end())
+                return nullptr;
+            if (!_hub->is_connected(*it->second->get_device()))
+            {
+                // The device was disconnected (maybe reconnected as a new object): resolve from scratch
+                _resolved_profiles.erase(it);
+                return nullptr;
+            }
+            return it->second;
+        }
+
         void pipeline::stop()
         {
             std::lock_guard<std::mutex> lock(_mtx);
@@ -191,8 +219,13 @@ namespace librealsense
                     _streams_to_sync_ids.push_back(s->get_unique_id());
             }
 
+            // With "pipeline-latest-only", wait_for_frames/poll_for_frames only ever return the newest frameset
+            bool const latest_only
+                = _ctx->get_settings().nested( std::string( "pipeline-latest-only", 20 ) ).default_value( false );
+
             _syncer = std::unique_ptr<syncer_process_unit>(new syncer_process_unit());
-            _aggregator = std::unique_ptr<aggregator>(new aggregator(_streams_to_aggregate_ids, _streams_to_sync_ids));
+            _aggregator = std::unique_ptr<aggregator>(
+                new aggregator(_streams_to_aggregate_ids, _streams_to_sync_ids, latest_only));
 
             if (_streams_callback)
                 _aggregator->set_output_callback(_streams_callback);
@@ -262,6 +295,30 @@ namespace librealsense
             throw std::runtime_error( rsutils::string::from() << "Frame didn't arrive within " << timeout_ms );
         }
 
+        size_t pipeline::wait_for_frames(frame_holder* framesets, size_t count, unsigned int timeout_ms)
+        {
+            if (!count)
+                return 0;
+
+            auto const deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+            framesets[0] = wait_for_frames(timeout_ms);
+
+            // The rest are taken as they come, without letting go of the pipeline in between
+            std::lock_guard<std::mutex> lock(_mtx);
+            size_t n = 1;
+            while (n < count && _active_profile)
+            {
+                auto const now = std::chrono::steady_clock::now();
+                if (now >= deadline)
+                    break;
+                auto const remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count();
+                if (!_aggregator->dequeue(&framesets[n], unsigned(remaining)))
+                    break;
+                ++n;
+            }
+            return n;
+        }
+
         bool pipeline::poll_for_frames(frame_holder* frame)
         {
             std::lock_guard<std::mutex> lock(_mtx);
@@ -29,6 +29,8 @@ namespace librealsense
             void stop();
             std::shared_ptr<profile> get_active_profile() const;
             frame_holder wait_for_frames(unsigned int timeout_ms);
+            // Up to 'count' framesets, all within the timeout; throws only if not even one arrives
+            size_t wait_for_frames(frame_holder* framesets, size_t count, unsigned int timeout_ms);
             bool poll_for_frames(frame_holder* frame);
             bool try_wait_for_frames(frame_holder* frame, unsigned int timeout_ms);
 
@@ -61,6 +63,13 @@ namespace librealsense
 
             rs2_frame_callback_sptr _streams_callback;
             std::vector<rs2_stream> _synced_streams;
+
+            // Profiles resolved by previous starts, by config::get_resolve_key(), so that restarting with an
+            // equivalent config doesn't enumerate and match every sensor's profiles again. An entry is only reused
+            // while its device is still connected.
+            static constexpr size_t MAX_RESOLVED_PROFILES = 16;
+            std::map< std::string, std::shared_ptr< profile > > _resolved_profiles;
+            std::shared_ptr< profile > find_resolved_profile( std::string const & key );
         };
     }
 }
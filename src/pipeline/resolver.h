@@ -12,6 +12,7 @@
 #include "sensor.h"
 #include "types.h"
 #include "stream.h"
+#include "usb-bandwidth.h"
 #include <src/core/device-interface.h>
 
 namespace librealsense
@@ -345,21 +346,46 @@ namespace librealsense
                 return sort_highest_framerate(lhs, rhs);
             }
 
-            static void auto_complete(std::vector<stream_profile> &requests, stream_profiles candidates, const device_interface* dev)
+            static double payload_rate(const stream_profile& r)
             {
+                return usb_bandwidth::get_payload_rate(r.format, r.width, r.height, r.fps);
+            }
+
+            // Wildcards are filled with the first candidate that fits in what's left of the bandwidth budget (which is
+            // then reduced by what's chosen), or with the first candidate at all if none fits
+            static void auto_complete(std::vector<stream_profile> &requests, stream_profiles candidates, const device_interface* dev, double& budget)
+            {
+                for (auto & request : requests)
+                    if (!has_wildcards(request))
+                        budget -= payload_rate(request);
+
                 for (auto & request : requests)
                 {
                     if (!has_wildcards(request)) continue;
+                    stream_profile first_match = request;
                     for (auto candidate : candidates)
                     {
                         if (match(candidate.get(), request) && !dev->contradicts(candidate.get(), requests))
                         {
-                            request = to_request(candidate.get());
-                            break;
+                            auto completed = to_request(candidate.get());
+                            if (has_wildcards(first_match))
+                                first_match = completed;
+                            if (payload_rate(completed) <= budget)
+                            {
+                                request = completed;
+                                break;
+                            }
                         }
                     }
+                    if (has_wildcards(request) && !has_wildcards(first_match))
+                    {
+                        LOG_WARNING("No " << get_string(request.stream) << " profile fits in the USB bandwidth left ("
+                                    << budget / 1e6 << " MB/s); expect frame drops");
+                        request = first_match;
+                    }
                     if (has_wildcards(request))
                         throw std::runtime_error(std::string("Couldn't autocomplete request for subdevice"));
+                    budget -= payload_rate(request);
                 }
             }
 
@@ -383,7 +409,7 @@ namespace librealsense
                 return r;
             }
 
-            stream_profiles map_sub_device(stream_profiles profiles,const device_interface* dev) const
+            stream_profiles map_sub_device(stream_profiles profiles,const device_interface* dev, double& budget) const
             {
                 stream_profiles rv;
                 std::set<index_type> satisfied_streams;
@@ -410,7 +436,7 @@ namespace librealsense
 
                     if (targets.size() > 0) // if subdevice is handling any streams
                     {
-                        auto_complete(targets, profiles, dev);
+                        auto_complete(targets, profiles, dev, budget);
 
                         for (auto && t : targets)
                         {
@@ -436,17 +462,24 @@ namespace librealsense
             {
                 std::multimap<int, std::shared_ptr<stream_profile_interface>> out;
 
+                // What the other devices on our USB bus leave us, shared by all of our sensors
+                double budget = usb_bandwidth::get_headroom(*dev);
+
                 // Algorithm assumes get_adjacent_devices always
                 // returns the devices in the same order
                 for (size_t i = 0; i < dev->get_sensors_count(); ++i)
                 {
                     auto&& sub = dev->get_sensor(i);
 
-                    auto default_profiles = map_sub_device(sub.get_stream_profiles(profile_tag::PROFILE_TAG_SUPERSET), dev);
-                    auto any_profiles = map_sub_device(sub.get_stream_profiles(profile_tag::PROFILE_TAG_ANY), dev);
+                    auto default_budget = budget;
+                    auto any_budget = budget;
+                    auto default_profiles = map_sub_device(sub.get_stream_profiles(profile_tag::PROFILE_TAG_SUPERSET), dev, default_budget);
+                    auto any_profiles = map_sub_device(sub.get_stream_profiles(profile_tag::PROFILE_TAG_ANY), dev, any_budget);
 
                     //use any streams if default streams wasn't satisfy
-                    auto profiles = default_profiles.size() == any_profiles.size() ? default_profiles : any_profiles;
+                    bool const use_default = default_profiles.size() == any_profiles.size();
+                    auto profiles = use_default ? default_profiles : any_profiles;
+                    budget = use_default ? default_budget : any_budget;
 
                     for (auto p : profiles)
                         out.emplace((int)i, p);
@@ -20,6 +20,11 @@ struct frame_object
     const void * pixels;
     const void * metadata;
     rs2_time_t backend_time;
+
+    // What the backend gave up on since its previous frame, while pairing video and metadata buffers (V4L2 only)
+    uint32_t unpaired_frames = 0;     // video buffers given back: frames lost
+    uint32_t unpaired_metadata = 0;   // metadata buffers given back
+    uint32_t pairing_mismatches = 0;  // times the next video and metadata buffers were out of step
 };
 
 
@@ -123,6 +123,9 @@ public:
     virtual void start_callbacks() = 0;
     virtual void stop_callbacks() = 0;
     virtual void close( stream_profile profile ) = 0;
+    // Like close(), but keeps what was set up for the profile (format, buffers) for a probe_and_commit() of the same
+    // profile to reuse. Anything else -- another profile, close(), D3 -- releases it first.
+    virtual void park( stream_profile profile ) { close( profile ); }
 
     virtual void set_power_state( power_state state ) = 0;
     virtual power_state get_power_state() const = 0;
@@ -178,6 +181,8 @@ public:
 
     void close( stream_profile profile ) override { _dev->close( profile ); }
 
+    void park( stream_profile profile ) override { _dev->park( profile ); }
+
     void set_power_state( power_state state ) override { _dev->set_power_state( state ); }
 
     power_state get_power_state() const override { return _dev->get_power_state(); }
@@ -302,6 +307,13 @@ public:
         _configured_indexes.erase( dev_index );
     }
 
+    void park( stream_profile profile ) override
+    {
+        auto dev_index = get_dev_index_by_profiles( profile );
+        _dev[dev_index]->park( profile );
+        _configured_indexes.erase( dev_index );
+    }
+
     void set_power_state( power_state state ) override
     {
         for( auto & elem : _dev )
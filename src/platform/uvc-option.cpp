@@ -49,12 +49,13 @@ void uvc_pu_option::set(float value)
     if( ! ep )
         throw invalid_value_exception( "Cannot set option, UVC sensor is not alive" );
     ep->invoke_powered(
-        [this, value](platform::uvc_device& dev)
+        [this, value, &ep](platform::uvc_device& dev)
         {
             if (!dev.set_pu(_id, static_cast<int32_t>(value)))
             throw invalid_value_exception( rsutils::string::from()
                                            << "set_pu(id=" << std::to_string( _id ) << ") failed!"
                                            << " Last Error: " << strerror( errno ) );
+            _cache.written( *ep, static_cast< float >( static_cast< int32_t >( value ) ) );
             _record(*this);
         });
 }
@@ -65,17 +66,19 @@ float uvc_pu_option::query() const
     auto ep = _ep.lock();
     if( ! ep )
         throw invalid_value_exception( "Cannot query option, UVC sensor is not alive" );
-    return static_cast<float>(ep->invoke_powered(
-        [this](platform::uvc_device& dev)
-        {
-            int32_t value = 0;
-            if (!dev.get_pu(_id, value))
-                throw invalid_value_exception( rsutils::string::from()
-                                               << "get_pu(id=" << std::to_string( _id ) << ") failed!"
-                                               << " Last Error: " << strerror( errno ) );
+    return _cache.get( *ep, [&]() {
+        return static_cast<float>(ep->invoke_powered(
+            [this](platform::uvc_device& dev)
+            {
+                int32_t value = 0;
+                if (!dev.get_pu(_id, value))
+                    throw invalid_value_exception( rsutils::string::from()
+                                                   << "get_pu(id=" << std::to_string( _id ) << ") failed!"
+                                                   << " Last Error: " << strerror( errno ) );
 
-            return static_cast<float>(value);
-        }));
+                return static_cast<float>(value);
+            }));
+    } );
 }
 
 
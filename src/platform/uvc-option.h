@@ -9,10 +9,67 @@
 #include <src/uvc-sensor.h>
 #include <rsutils/time/timer.h>
 
+#include <chrono>
+#include <mutex>
+
 
 namespace librealsense {
 
 
+// The last value read from or written to a control, so that frequent queries (UI, telemetry, the options_watcher) do
+// not each become a USB control transfer. Writes go through to the device and update it.
+//
+// Values expire after the sensor's staleness window, since the FW changes some of them on its own (e.g., under
+// auto-exposure), and immediately once anything is written to the sensor. The cache is off if the window is 0.
+//
+class option_value_cache
+{
+    mutable std::mutex _mutex;
+    mutable float _value = 0;
+    mutable uint64_t _generation = 0;
+    mutable std::chrono::steady_clock::time_point _updated;
+    mutable bool _valid = false;
+
+    void update( uint64_t generation, float value ) const
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _value = value;
+        _generation = generation;
+        _updated = std::chrono::steady_clock::now();
+        _valid = true;
+    }
+
+public:
+    // The cached value if still fresh, otherwise the result of 'query()', which is then cached
+    template< class Query >
+    float get( uvc_sensor const & ep, Query && query ) const
+    {
+        auto const staleness = ep.get_option_cache_staleness();
+        if( staleness.count() <= 0 )
+            return query();
+
+        // Read before querying: a write meanwhile must leave what we got marked stale
+        auto const generation = ep.get_option_generation();
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            if( _valid && _generation == generation && std::chrono::steady_clock::now() - _updated < staleness )
+                return _value;
+        }
+        auto const value = query();
+        update( generation, value );
+        return value;
+    }
+
+    // After 'value' was written: drops everything cached for the sensor, except this value
+    void written( uvc_sensor & ep, float value )
+    {
+        ep.invalidate_option_cache();
+        if( ep.get_option_cache_staleness().count() > 0 )
+            update( ep.get_option_generation(), value );
+    }
+};
+
+
 class uvc_pu_option : public option
 {
     std::weak_ptr< uvc_sensor > _ep;
@@ -20,6 +77,7 @@ class uvc_pu_option : public option
     const std::map< float, std::string > _description_per_value;
     std::function< void( const option & ) > _record = []( const option & ) {};
     rsutils::lazy< option_range > _range;
+    option_value_cache _cache;
 
 public:
     void set( float value ) override;
@@ -62,13 +120,14 @@ public:
             throw invalid_value_exception( "setting this option during streaming is not allowed!" );
 
         ep->invoke_powered(
-            [this, value]( platform::uvc_device & dev )
+            [this, value, &ep]( platform::uvc_device & dev )
             {
                 T t = static_cast< T >( value );
                 if( ! dev.set_xu( _xu, _id, reinterpret_cast< uint8_t * >( &t ), sizeof( T ) ) )
                     throw invalid_value_exception( rsutils::string::from()
                                                    << "set_xu(id=" << std::to_string( _id ) << ") failed!"
                                                    << " Last Error: " << strerror( errno ) );
+                _cache.written( *ep, static_cast< float >( t ) );
                 _recording_function( *this );
             } );
     }
@@ -79,17 +138,7 @@ public:
         if( ! ep )
             return static_cast< float >( T() );
 
-        return static_cast< float >( ep->invoke_powered(
-            [this]( platform::uvc_device & dev )
-            {
-                T t;
-                if( ! dev.get_xu( _xu, _id, reinterpret_cast< uint8_t * >( &t ), sizeof( T ) ) )
-                    throw invalid_value_exception( rsutils::string::from()
-                                                   << "get_xu(id=" << std::to_string( _id ) << ") failed!"
-                                                   << " Last Error: " << strerror( errno ) );
-
-                return static_cast< float >( t );
-            } ) );
+        return _cache.get( *ep, [&]() { return query_device( *ep ); } );
     }
 
     option_range get_range() const override
@@ -115,6 +164,7 @@ public:
     }
 
     bool is_enabled() const override { return true; }
+    bool can_set_while_streaming() const override { return _allow_set_while_streaming; }
 
     uvc_xu_option( const std::weak_ptr< uvc_sensor > & ep,
                    platform::extension_unit xu,
@@ -157,6 +207,22 @@ public:
     }
 
 protected:
+    // Always from the device, bypassing the cache
+    float query_device( uvc_sensor & ep ) const
+    {
+        return static_cast< float >( ep.invoke_powered(
+            [this]( platform::uvc_device & dev )
+            {
+                T t;
+                if( ! dev.get_xu( _xu, _id, reinterpret_cast< uint8_t * >( &t ), sizeof( T ) ) )
+                    throw invalid_value_exception( rsutils::string::from()
+                                                   << "get_xu(id=" << std::to_string( _id ) << ") failed!"
+                                                   << " Last Error: " << strerror( errno ) );
+
+                return static_cast< float >( t );
+            } ) );
+    }
+
     std::weak_ptr < uvc_sensor > _ep;
     platform::extension_unit _xu;
     uint8_t _id;
@@ -165,6 +231,7 @@ protected:
     };
     const std::map< float, std::string > _description_per_value;
     bool _allow_set_while_streaming;
+    option_value_cache _cache;
 };
 
 
@@ -243,7 +310,11 @@ public:
         {
             std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
 
-            float current_value = uvc_xu_option< T >::query();
+            // From the device: the cache would just give back what we wrote
+            auto ep = this->_ep.lock();
+            if( ! ep )
+                break;
+            float current_value = this->query_device( *ep );
             if( current_value == value )
                 return;
         }
@@ -7,6 +7,8 @@
 #include "core/frame-holder.h"
 #include "librealsense-exception.h"
 #include <fstream>
+#include <sstream>
+#include <cstring>
 #include <cmath>
 
 #define MIN_DISTANCE 1e-6
@@ -15,6 +17,8 @@ namespace librealsense {
 
 float3 * points::get_vertices()
 {
+    if( is_compact() )
+        throw librealsense::invalid_value_exception( "compact points have no float vertices; use the frame data" );
     get_frame_data();  // call GetData to ensure data is in main memory
     auto xyz = (float3 *)data.data();
     return xyz;
@@ -45,30 +49,36 @@ void points::export_to_ply( const std::string & fname, const frame_holder & text
         throw librealsense::invalid_value_exception( "stream must be video stream" );
     const auto vertices = get_vertices();
     const auto texcoords = get_texture_coordinates();
-    std::vector< float3 > new_vertices;
-    std::vector< std::tuple< uint8_t, uint8_t, uint8_t > > new_tex;
-    std::map< int, int > index2reducedIndex;
-
-    new_vertices.reserve( get_vertex_count() );
-    new_tex.reserve( get_vertex_count() );
-    assert( get_vertex_count() );
-    for( int i = 0; i < get_vertex_count(); ++i )
+    const size_t count = get_vertex_count();
+    assert( count );
+
+    // Vertex records (x, y, z[, r, g, b]) go straight into the output buffer, after the header that is written last
+    const size_t vertex_size = 3 * sizeof( float ) + ( texture ? 3 : 0 );
+    std::vector< char > body;
+    body.reserve( count * vertex_size );
+    std::vector< int > reduced_index( count, -1 );
+    int n_vertices = 0;
+    for( size_t i = 0; i < count; ++i )
         if( fabs( vertices[i].x ) >= MIN_DISTANCE || fabs( vertices[i].y ) >= MIN_DISTANCE
             || fabs( vertices[i].z ) >= MIN_DISTANCE )
         {
-            index2reducedIndex[i] = (int)new_vertices.size();
-            new_vertices.push_back( { vertices[i].x, -1 * vertices[i].y, -1 * vertices[i].z } );
+            reduced_index[i] = n_vertices++;
+            // we assume little endian architecture on your device
+            float const xyz[3] = { vertices[i].x, -1 * vertices[i].y, -1 * vertices[i].z };
+            body.insert( body.end(), reinterpret_cast< const char * >( xyz ), reinterpret_cast< const char * >( xyz + 3 ) );
             if( texture )
             {
-                auto color = get_texcolor( texture, texcoords[i].x, texcoords[i].y );
-                new_tex.push_back( color );
+                uint8_t rgb[3];
+                std::tie( rgb[0], rgb[1], rgb[2] ) = get_texcolor( texture, texcoords[i].x, texcoords[i].y );
+                body.insert( body.end(), rgb, rgb + 3 );
             }
         }
 
     const auto threshold = 0.05f;
     auto width = video_stream_profile->get_width();
-    std::vector< std::tuple< int, int, int > > faces;
-    for( uint32_t x = 0; x < width - 1; ++x )
+    size_t n_faces = 0;
+    // Faces connect neighboring pixels, so there are none when only the valid points were kept
+    for( uint32_t x = 0; ! is_valid_only() && x < width - 1; ++x )
     {
         for( uint32_t y = 0; y < video_stream_profile->get_height() - 1; ++y )
         {
@@ -80,81 +90,99 @@ void points::export_to_ply( const std::string & fname, const frame_holder & text
                 && std::abs( vertices[b].z - vertices[d].z ) < threshold
                 && std::abs( vertices[c].z - vertices[d].z ) < threshold )
             {
-                if( index2reducedIndex.count( a ) == 0 || index2reducedIndex.count( b ) == 0
-                    || index2reducedIndex.count( c ) == 0 || index2reducedIndex.count( d ) == 0 )
+                if( reduced_index[a] < 0 || reduced_index[b] < 0 || reduced_index[c] < 0 || reduced_index[d] < 0 )
                     continue;
 
-                faces.emplace_back( index2reducedIndex[a],
-                                    index2reducedIndex[d],
-                                    index2reducedIndex[b] );
-                faces.emplace_back( index2reducedIndex[d],
-                                    index2reducedIndex[a],
-                                    index2reducedIndex[c] );
+                char face[2][1 + 3 * sizeof( int )];
+                int const indices[2][3] = { { reduced_index[a], reduced_index[d], reduced_index[b] },
+                                            { reduced_index[d], reduced_index[a], reduced_index[c] } };
+                for( int f = 0; f < 2; ++f )
+                {
+                    face[f][0] = 3;
+                    memcpy( face[f] + 1, indices[f], sizeof( indices[f] ) );
+                }
+                body.insert( body.end(), face[0], face[0] + sizeof( face ) );
+                n_faces += 2;
             }
         }
     }
 
-    std::ofstream out( fname );
-    out << "ply\n";
-    out << "format binary_little_endian 1.0\n";
-    out << "comment pointcloud saved from Realsense Viewer\n";
-    out << "element vertex " << new_vertices.size() << "\n";
-    out << "property float" << sizeof( float ) * 8 << " x\n";
-    out << "property float" << sizeof( float ) * 8 << " y\n";
-    out << "property float" << sizeof( float ) * 8 << " z\n";
+    std::ostringstream header;
+    header << "ply\n";
+    header << "format binary_little_endian 1.0\n";
+    header << "comment pointcloud saved from Realsense Viewer\n";
+    header << "element vertex " << n_vertices << "\n";
+    header << "property float" << sizeof( float ) * 8 << " x\n";
+    header << "property float" << sizeof( float ) * 8 << " y\n";
+    header << "property float" << sizeof( float ) * 8 << " z\n";
     if( texture )
     {
-        out << "property uchar red\n";
-        out << "property uchar green\n";
-        out << "property uchar blue\n";
-    }
-    out << "element face " << faces.size() << "\n";
-    out << "property list uchar int vertex_indices\n";
-    out << "end_header\n";
-    out.close();
-
-    out.open( fname, std::ios_base::app | std::ios_base::binary );
-    for( int i = 0; i < new_vertices.size(); ++i )
-    {
-        // we assume little endian architecture on your device
-        out.write( reinterpret_cast< const char * >( &( new_vertices[i].x ) ), sizeof( float ) );
-        out.write( reinterpret_cast< const char * >( &( new_vertices[i].y ) ), sizeof( float ) );
-        out.write( reinterpret_cast< const char * >( &( new_vertices[i].z ) ), sizeof( float ) );
-
-        if( texture )
-        {
-            uint8_t x, y, z;
-            std::tie( x, y, z ) = new_tex[i];
-            out.write( reinterpret_cast< const char * >( &x ), sizeof( uint8_t ) );
-            out.write( reinterpret_cast< const char * >( &y ), sizeof( uint8_t ) );
-            out.write( reinterpret_cast< const char * >( &z ), sizeof( uint8_t ) );
-        }
-    }
-    auto size = faces.size();
-    for( int i = 0; i < size; ++i )
-    {
-        int three = 3;
-        out.write( reinterpret_cast< const char * >( &three ), sizeof( uint8_t ) );
-        out.write( reinterpret_cast< const char * >( &( std::get< 0 >( faces[i] ) ) ),
-                   sizeof( int ) );
-        out.write( reinterpret_cast< const char * >( &( std::get< 1 >( faces[i] ) ) ),
-                   sizeof( int ) );
-        out.write( reinterpret_cast< const char * >( &( std::get< 2 >( faces[i] ) ) ),
-                   sizeof( int ) );
+        header << "property uchar red\n";
+        header << "property uchar green\n";
+        header << "property uchar blue\n";
     }
+    header << "element face " << n_faces << "\n";
+    header << "property list uchar int vertex_indices\n";
+    header << "end_header\n";
+
+    std::ofstream out( fname, std::ios_base::binary );
+    auto const h = header.str();
+    out.write( h.data(), h.size() );
+    out.write( body.data(), body.size() );
+    if( ! out )
+        throw librealsense::io_exception( "failed to write " + fname );
 }
 
 size_t points::get_vertex_count() const
 {
+    return _valid_only ? _valid_count : get_capacity();
+}
+
+size_t points::get_capacity() const
+{
+    if( is_compact() )
+        return data.size() / ( 5 * sizeof( int16_t ) );
     return data.size() / ( sizeof( float3 ) + sizeof( int2 ) );
 }
 
 float2 * points::get_texture_coordinates()
 {
+    if( is_compact() )
+        throw librealsense::invalid_value_exception( "compact points have no float texture coordinates; use the frame data" );
     get_frame_data();  // call GetData to ensure data is in main memory
     auto xyz = (float3 *)data.data();
-    auto ijs = (float2 *)( xyz + get_vertex_count() );
+    auto ijs = (float2 *)( xyz + get_capacity() );
     return ijs;
 }
 
+bool points::is_compact() const
+{
+    auto profile = get_stream();
+    return profile && profile->get_format() == RS2_FORMAT_XYZ16;
+}
+
+int16_t * points::get_compact_vertices()
+{
+    get_frame_data();  // call GetData to ensure data is in main memory
+    return (int16_t *)data.data();
+}
+
+int16_t * points::get_compact_texture_coordinates()
+{
+    return get_compact_vertices() + 3 * get_capacity();
+}
+
+void points::set_valid_only( size_t count )
+{
+    _valid_only = true;
+    _valid_count = count;
+}
+
+void points::reset_valid_only()
+{
+    _valid_only = false;
+    _valid_count = 0;
+    _pixel_indices.clear();
+}
+
 }  // namespace librealsense
@@ -7,6 +7,7 @@
 #include "float3.h"
 
 #include <string>
+#include <vector>
 
 
 namespace librealsense {
@@ -18,10 +19,34 @@ class frame_holder;
 class points : public frame
 {
 public:
+    // Texture coordinates of RS2_FORMAT_XYZ16 points are stored multiplied by this
+    static constexpr float COMPACT_TEXCOORD_SCALE = 8192.f;
+
     float3 * get_vertices();
     void export_to_ply( const std::string & fname, const frame_holder & texture );
     size_t get_vertex_count() const;
     float2 * get_texture_coordinates();
+
+    // RS2_FORMAT_XYZ16 points hold int16 vertices and texture coordinates, which are only reachable through the frame
+    // data; get_vertices() and get_texture_coordinates() throw for them
+    bool is_compact() const;
+    int16_t * get_compact_vertices();
+    int16_t * get_compact_texture_coordinates();
+
+    // Number of points the frame has room for: one per depth pixel
+    size_t get_capacity() const;
+
+    // When only the valid points are kept, they are packed at the start of the vertex and texture coordinate arrays
+    // and get_vertex_count() returns how many there are. The depth pixel index of each may be kept as well.
+    bool is_valid_only() const { return _valid_only; }
+    void set_valid_only( size_t count );
+    void reset_valid_only();  // back to one point per pixel; done whenever the frame is allocated
+    std::vector< int > & get_pixel_indices() { return _pixel_indices; }  // empty unless kept
+
+private:
+    bool _valid_only = false;
+    size_t _valid_count = 0;
+    std::vector< int > _pixel_indices;  // kept when the frame is pooled, so its memory is reused
 };
 
 MAP_EXTENSION( RS2_EXTENSION_POINTS, librealsense::points );
@@ -10,6 +10,9 @@
 #include "environment.h"
 #include "align.h"
 #include "stream.h"
+#include "option.h"
+
+#include <algorithm>
 
 #if defined(RS2_USE_CUDA)
 #include "proc/cuda/cuda-align.h"
@@ -32,16 +35,28 @@ namespace librealsense
         #endif
     }
 
+    std::shared_ptr<align> align::create_align(const std::vector<rs2_stream>& align_to)
+    {
+        #if defined(RS2_USE_CUDA)
+            return std::make_shared<librealsense::align_cuda>(align_to);
+        #elif defined(__SSSE3__)
+            return std::make_shared<librealsense::align_sse>(align_to);
+        #else
+            return std::make_shared<librealsense::align>(align_to);
+        #endif
+    }
+
     template<class GET_DEPTH, class TRANSFER_PIXEL>
     void align_images(const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other,
-        const rs2_intrinsics& other_intrin, GET_DEPTH get_depth, TRANSFER_PIXEL transfer_pixel)
+        const rs2_intrinsics& other_intrin, GET_DEPTH get_depth, TRANSFER_PIXEL transfer_pixel,
+        const region_of_interest& roi)
     {
-        // Iterate over the pixels of the depth image
+        // Iterate over the pixels of the depth image, in the region of interest
 #pragma omp parallel for schedule(dynamic)
-        for (int depth_y = 0; depth_y < depth_intrin.height; ++depth_y)
+        for (int depth_y = roi.min_y; depth_y <= roi.max_y; ++depth_y)
         {
-            int depth_pixel_index = depth_y * depth_intrin.width;
-            for (int depth_x = 0; depth_x < depth_intrin.width; ++depth_x, ++depth_pixel_index)
+            int depth_pixel_index = depth_y * depth_intrin.width + roi.min_x;
+            for (int depth_x = roi.min_x; depth_x <= roi.max_x; ++depth_x, ++depth_pixel_index)
             {
                 // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
                 if (float depth = get_depth(depth_pixel_index))
@@ -78,9 +93,77 @@ namespace librealsense
         }
     }
 
+    // align_images() for several other images at once: each depth pixel is deprojected once, then mapped onto all of
+    // them; transfer_pixel() gets the index of the other image first
+    template<class GET_DEPTH, class TRANSFER_PIXEL>
+    void align_images(const rs2_intrinsics& depth_intrin, const std::vector<rs2_extrinsics>& depth_to_others,
+        const std::vector<rs2_intrinsics>& other_intrins, GET_DEPTH get_depth, TRANSFER_PIXEL transfer_pixel,
+        const region_of_interest& roi)
+    {
+#pragma omp parallel for schedule(dynamic)
+        for (int depth_y = roi.min_y; depth_y <= roi.max_y; ++depth_y)
+        {
+            int depth_pixel_index = depth_y * depth_intrin.width + roi.min_x;
+            for (int depth_x = roi.min_x; depth_x <= roi.max_x; ++depth_x, ++depth_pixel_index)
+            {
+                if (float depth = get_depth(depth_pixel_index))
+                {
+                    // The top-left and bottom-right corners of the depth pixel
+                    float depth_pixel[2] = { depth_x - 0.5f, depth_y - 0.5f }, top_left[3], bottom_right[3];
+                    rs2_deproject_pixel_to_point(top_left, &depth_intrin, depth_pixel, depth);
+                    depth_pixel[0] = depth_x + 0.5f; depth_pixel[1] = depth_y + 0.5f;
+                    rs2_deproject_pixel_to_point(bottom_right, &depth_intrin, depth_pixel, depth);
+
+                    for (size_t i = 0; i < other_intrins.size(); ++i)
+                    {
+                        auto& other_intrin = other_intrins[i];
+                        float other_point[3], other_pixel[2];
+                        rs2_transform_point_to_point(other_point, &depth_to_others[i], top_left);
+                        rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
+                        const int other_x0 = static_cast<int>(other_pixel[0] + 0.5f);
+                        const int other_y0 = static_cast<int>(other_pixel[1] + 0.5f);
+
+                        rs2_transform_point_to_point(other_point, &depth_to_others[i], bottom_right);
+                        rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
+                        const int other_x1 = static_cast<int>(other_pixel[0] + 0.5f);
+                        const int other_y1 = static_cast<int>(other_pixel[1] + 0.5f);
+
+                        if (other_x0 < 0 || other_y0 < 0 || other_x1 >= other_intrin.width || other_y1 >= other_intrin.height)
+                            continue;
+
+                        for (int y = other_y0; y <= other_y1; ++y)
+                        {
+                            for (int x = other_x0; x <= other_x1; ++x)
+                            {
+                                transfer_pixel(i, depth_pixel_index, y * other_intrin.width + x);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     align::align(rs2_stream to_stream) : align(to_stream, "Align")
     {}
 
+    align::align(const std::vector<rs2_stream>& to_streams) : align(to_streams, "Align")
+    {}
+
+    align::align(rs2_stream to_stream, const char* name)
+        : align(std::vector<rs2_stream>{ to_stream }, name)
+    {}
+
+    align::align(const std::vector<rs2_stream>& to_streams, const char* name)
+        : generic_processing_block(name),
+          _to_stream_type(to_streams.front()), _to_streams(to_streams), _depth_scale(0)
+    {
+        register_processing_threads_option();
+
+        _roi.register_options(*this);
+        register_share_results_option();
+    }
+
     void align::align_z_to_other(rs2::video_frame& aligned, 
         const rs2::video_frame& depth, const rs2::video_stream_profile& other_profile, float z_scale)
     {
@@ -104,37 +187,69 @@ namespace librealsense
             out_z[other_pixel_index] = out_z[other_pixel_index] ?
                 std::min((int)out_z[other_pixel_index], (int)z_pixels[z_pixel_index]) :
                 z_pixels[z_pixel_index];
-        });
+        }, _roi.get(z_intrin.width, z_intrin.height));
+    }
+
+    void align::align_z_to_others(std::vector<rs2::video_frame>& aligned,
+        const rs2::video_frame& depth, const std::vector<rs2::video_stream_profile>& other_profiles, float z_scale)
+    {
+        auto depth_profile = depth.get_profile().as<rs2::video_stream_profile>();
+        auto z_intrin = depth_profile.get_intrinsics();
+
+        std::vector<uint16_t *> out_z;
+        std::vector<rs2_intrinsics> other_intrins;
+        std::vector<rs2_extrinsics> z_to_others;
+        for (size_t i = 0; i < aligned.size(); ++i)
+        {
+            uint8_t * aligned_data = reinterpret_cast<uint8_t *>(const_cast<void*>(aligned[i].get_data()));
+            auto aligned_profile = aligned[i].get_profile().as<rs2::video_stream_profile>();
+            memset(aligned_data, 0, aligned_profile.height() * aligned_profile.width() * aligned[i].get_bytes_per_pixel());
+            out_z.push_back((uint16_t *)(aligned_data));
+            other_intrins.push_back(other_profiles[i].get_intrinsics());
+            z_to_others.push_back(depth_profile.get_extrinsics_to(other_profiles[i]));
+        }
+
+        auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
+
+        align_images(z_intrin, z_to_others, other_intrins,
+            [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
+            [&out_z, z_pixels](size_t other, int z_pixel_index, int other_pixel_index)
+        {
+            auto out = out_z[other];
+            out[other_pixel_index] = out[other_pixel_index] ?
+                std::min((int)out[other_pixel_index], (int)z_pixels[z_pixel_index]) :
+                z_pixels[z_pixel_index];
+        }, _roi.get(z_intrin.width, z_intrin.height));
     }
 
     template<int N, class GET_DEPTH>
-    void align_other_to_depth_bytes( uint8_t * other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, const uint8_t * other_pixels)
+    void align_other_to_depth_bytes( uint8_t * other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, const uint8_t * other_pixels, const region_of_interest& roi)
     {
         auto in_other = (const bytes<N> *)(other_pixels);
         auto out_other = (bytes<N> *)(other_aligned_to_depth);
         align_images(depth_intrin, depth_to_other, other_intrin, get_depth,
-            [out_other, in_other](int depth_pixel_index, int other_pixel_index) { out_other[depth_pixel_index] = in_other[other_pixel_index]; });
+            [out_other, in_other](int depth_pixel_index, int other_pixel_index) { out_other[depth_pixel_index] = in_other[other_pixel_index]; }, roi);
     }
 
     template<class GET_DEPTH>
-    void align_other_to_depth( uint8_t * other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics & depth_to_other, const rs2_intrinsics& other_intrin, const uint8_t * other_pixels, rs2_format other_format)
+    void align_other_to_depth( uint8_t * other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics & depth_to_other, const rs2_intrinsics& other_intrin, const uint8_t * other_pixels, rs2_format other_format, const region_of_interest& roi)
     {
         switch (other_format)
         {
         case RS2_FORMAT_Y8:
-            align_other_to_depth_bytes<1>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<1>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels, roi);
             break;
         case RS2_FORMAT_Y16:
         case RS2_FORMAT_Z16:
-            align_other_to_depth_bytes<2>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<2>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels, roi);
             break;
         case RS2_FORMAT_RGB8:
         case RS2_FORMAT_BGR8:
-            align_other_to_depth_bytes<3>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<3>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels, roi);
             break;
         case RS2_FORMAT_RGBA8:
         case RS2_FORMAT_BGRA8:
-            align_other_to_depth_bytes<4>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<4>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels, roi);
             break;
         default:
             assert(false); // NOTE: rs2_align_other_to_depth_bytes<2>(...) is not appropriate for RS2_FORMAT_YUYV/RS2_FORMAT_RAW10 images, no logic prevents U/V channels from being written to one another
@@ -158,7 +273,7 @@ namespace librealsense
         auto other_pixels = reinterpret_cast<const uint8_t *>(other.get_data());
 
         align_other_to_depth(aligned_data, [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
-            z_intrin, z_to_other, other_intrin, other_pixels, other_profile.format());
+            z_intrin, z_to_other, other_intrin, other_pixels, other_profile.format(), _roi.get(z_intrin.width, z_intrin.height));
     }
 
     std::shared_ptr<rs2::video_stream_profile> align::create_aligned_profile(
@@ -207,9 +322,14 @@ namespace librealsense
         rs2_format format = profile.format();
         int index = profile.stream_index();
 
-        //process composite frame only if it contains both a depth frame and the requested texture frame
+        //process composite frame only if it contains both a depth frame and the requested texture frame (any of them, when
+        //aligning to several)
         bool has_tex = false, has_depth = false;
-        set.foreach_rs([this, &has_tex](const rs2::frame& frame) { if (frame.get_profile().stream_type() == _to_stream_type) has_tex = true; });
+        set.foreach_rs([this, &has_tex](const rs2::frame& frame)
+        {
+            if (std::find(_to_streams.begin(), _to_streams.end(), frame.get_profile().stream_type()) != _to_streams.end())
+                has_tex = true;
+        });
         set.foreach_rs([&has_depth](const rs2::frame& frame)
             { if (frame.get_profile().stream_type() == RS2_STREAM_DEPTH && frame.get_profile().format() == RS2_FORMAT_Z16) has_depth = true; });
         if (!has_tex || !has_depth)
@@ -254,18 +374,41 @@ namespace librealsense
 
         auto aligned_profile = aligned.get_profile().as<rs2::video_stream_profile>();
 
+        // With a region of interest the variants' full-frame kernels are passed over for the generic ones, which
+        // skip the rest of the depth frame
+        bool const roi = _roi.active();
         if (to_profile.stream_type() == RS2_STREAM_DEPTH)
         {
-            align_other_to_z(aligned, to, from, _depth_scale);
+            if (roi)
+                align::align_other_to_z(aligned, to, from, _depth_scale);
+            else
+                align_other_to_z(aligned, to, from, _depth_scale);
         }
         else
         {
-            align_z_to_other(aligned, from, to_profile, _depth_scale);
+            if (roi)
+                align::align_z_to_other(aligned, from, to_profile, _depth_scale);
+            else
+                align_z_to_other(aligned, from, to_profile, _depth_scale);
         }
     }
 
+    // The targets, in order, make up the state; with a single one, that is its stream type
+    size_t align::shared_result_state() const
+    {
+        size_t state = 0;
+        for (auto stream : _to_streams)
+            state = state * RS2_STREAM_COUNT + size_t(stream);
+        return state;
+    }
+
     rs2::frame align::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
+        // The aligned frames reference the frames in the set, not the set itself, so they can be kept with it
+        auto const state = shared_result_state();
+        if (auto shared = find_shared_result(f, state))
+            return shared;
+
         rs2::frame rv;
         std::vector<rs2::frame> output_frames;
         std::vector<rs2::frame> other_frames;
@@ -275,6 +418,30 @@ namespace librealsense
 
         _depth_scale = ((librealsense::depth_frame*)depth.get())->get_units();
 
+        if (_to_streams.size() > 1)
+        {
+            std::vector<rs2::video_frame> aligned_frames;
+            std::vector<rs2::video_stream_profile> to_profiles;
+            for (auto stream : _to_streams)
+            {
+                auto to = frames.first_or_default(stream).as<rs2::video_frame>();
+                if (!to)
+                    continue;
+                aligned_frames.push_back(allocate_aligned_frame(source, depth, to));
+                to_profiles.push_back(to.get_profile().as<rs2::video_stream_profile>());
+            }
+
+            if (_roi.active())
+                align::align_z_to_others(aligned_frames, depth, to_profiles, _depth_scale);
+            else
+                align_z_to_others(aligned_frames, depth, to_profiles, _depth_scale);
+
+            auto new_composite = source.allocate_composite_frame(
+                std::vector<rs2::frame>(aligned_frames.begin(), aligned_frames.end()));
+            share_result(f, state, new_composite);
+            return new_composite;
+        }
+
         if (_to_stream_type == RS2_STREAM_DEPTH)
             frames.foreach_rs([&other_frames](const rs2::frame& f) {if ((f.get_profile().stream_type() != RS2_STREAM_DEPTH) && f.is<rs2::video_frame>()) other_frames.push_back(f); });
         else
@@ -298,6 +465,7 @@ namespace librealsense
         }
 
         auto new_composite = source.allocate_composite_frame(std::move(output_frames));
+        share_result(f, state, new_composite);
         return new_composite;
     }
 }
@@ -3,10 +3,13 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "worker-pool.h"
+#include "processing-roi.h"
 
 #include <src/basics.h>
 #include <map>
 #include <utility>
+#include <vector>
 
 
 namespace librealsense
@@ -15,13 +18,14 @@ namespace librealsense
     {
     public:
         align(rs2_stream to_stream);
+        align(const std::vector<rs2_stream>& to_streams);
         static std::shared_ptr<align> create_align(rs2_stream align_to);
+        // Depth aligned to each of the streams, in one pass over the depth frame; none of them can be depth
+        static std::shared_ptr<align> create_align(const std::vector<rs2_stream>& align_to);
 
     protected:
-        align(rs2_stream to_stream, const char* name)
-            : generic_processing_block(name),
-              _to_stream_type(to_stream), _depth_scale(0)
-        {}
+        align(rs2_stream to_stream, const char* name);
+        align(const std::vector<rs2_stream>& to_streams, const char* name);
 
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
@@ -38,19 +42,29 @@ namespace librealsense
                                       const rs2::video_frame& other, 
                                       float z_scale);
 
+        // Depth aligned to several streams at once: every depth pixel is deprojected once, for all of them. Variants
+        // that have no such kernel can align to each in turn.
+        virtual void align_z_to_others(std::vector<rs2::video_frame>& aligned,
+                                       const rs2::video_frame& depth,
+                                       const std::vector<rs2::video_stream_profile>& other_profiles,
+                                       float z_scale);
+
         virtual rs2_extension select_extension(const rs2::frame& input);
 
         std::shared_ptr<rs2::video_stream_profile> create_aligned_profile(
             rs2::video_stream_profile& original_profile,
             rs2::video_stream_profile& to_profile);
 
-        rs2_stream _to_stream_type;
+        rs2_stream _to_stream_type;  // the first of _to_streams
+        std::vector<rs2_stream> _to_streams;
         std::map<std::pair<stream_profile_interface*, stream_profile_interface*>, std::shared_ptr<rs2::video_stream_profile>> _align_stream_unique_ids;
         rs2::stream_profile _source_stream_profile;
         float _depth_scale;
+        processing_roi _roi;  // in depth pixels; the rest of the depth frame maps to nothing
 
     private:
         rs2::video_frame allocate_aligned_frame(const rs2::frame_source& source, const rs2::video_frame& from, const rs2::video_frame& to);
         void align_frames(rs2::video_frame& aligned, const rs2::video_frame& from, const rs2::video_frame& to);
+        size_t shared_result_state() const;
     };
 }
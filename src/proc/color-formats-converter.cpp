@@ -6,10 +6,10 @@
 #include "option.h"
 #include "image-avx.h"
 #include "image.h"
-
-#define STB_IMAGE_STATIC
-#define STB_IMAGE_IMPLEMENTATION
-#include "../third-party/stb_image.h"
+#include "color-formats-neon.h"
+#include "cpu-features.h"
+#include "stream.h"
+#include <src/core/frame-processor-callback.h>
 
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
@@ -18,32 +18,6 @@
 #include <tmmintrin.h> // For SSSE3 intrinsics
 #endif
 
-#if defined (ANDROID) || (defined (__linux__) && !defined (__x86_64__)) || (defined (__APPLE__) && !defined (__x86_64__))
-
-bool has_avx() { return false; }
-
-#else
-
-#ifdef _WIN32
-#include <intrin.h>
-#define cpuid(info, x)    __cpuidex(info, x, 0)
-#else
-#include <cpuid.h>
-void cpuid(int info[4], int info_type) {
-    __cpuid_count(info_type, 0, info[0], info[1], info[2], info[3]);
-}
-#endif
-
-bool has_avx()
-{
-    int info[4];
-    cpuid(info, 0);
-    cpuid(info, 0x80000000);
-    return (info[2] & ((int)1 << 28)) != 0;
-}
-
-#endif
-
 namespace librealsense 
 {
     /////////////////////////////
@@ -59,11 +33,10 @@ namespace librealsense
         rscuda::unpack_yuy2_cuda<FORMAT>(d, s, n);
         return;
 #endif
+        auto const simd = get_simd_level();
 #if defined __SSSE3__ && ! defined ANDROID
-        static bool do_avx = has_avx();
-#ifdef __AVX2__
-
-        if (do_avx)
+#ifdef RS2_AVX2_UNPACK
+        if (simd >= simd_level::avx2)
         {
             if (FORMAT == RS2_FORMAT_Y8) unpack_yuy2_avx_y8(d, s, n);
             if (FORMAT == RS2_FORMAT_Y16) unpack_yuy2_avx_y16(d, s, n);
@@ -71,9 +44,10 @@ namespace librealsense
             if (FORMAT == RS2_FORMAT_RGBA8) unpack_yuy2_avx_rgba8(d, s, n);
             if (FORMAT == RS2_FORMAT_BGR8) unpack_yuy2_avx_bgr8(d, s, n);
             if (FORMAT == RS2_FORMAT_BGRA8) unpack_yuy2_avx_bgra8(d, s, n);
+            return;
         }
-        else
 #endif
+        if (simd >= simd_level::simd128)
         {
             auto src = reinterpret_cast<const __m128i *>(s);
             auto dst = reinterpret_cast<__m128i *>(d[0]);
@@ -219,8 +193,16 @@ namespace librealsense
                     }
                 }
             }
+            return;
+        }
+#elif defined RS2_YUV_NEON
+        if (simd >= simd_level::simd128)
+        {
+            yuv_neon::unpack_yuy2<FORMAT>(d[0], s, n);
+            return;
         }
-#else  // Generic code for when SSSE3 is not available.
+#endif
+        // Generic code for when SSSE3 is not available.
         auto src = reinterpret_cast<const uint8_t *>(s);
         auto dst = reinterpret_cast<uint8_t *>(d[0]);
         for (; n; n -= 16, src += 32)
@@ -352,7 +334,6 @@ namespace librealsense
                 continue;
             }
         }
-#endif
     }
 
     template<rs2_format FORMAT>
@@ -619,76 +600,99 @@ namespace librealsense
     {
         auto n = width * height;
         assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
+#ifdef RS2_USE_CUDA
+        rscuda::unpack_m420_cuda<FORMAT>(d, s, width, height);
+        return;
+#endif
 
+        auto const simd = get_simd_level();
 #if defined __SSSE3__ && ! defined ANDROID
-        static bool do_avx = has_avx();
-
-        auto src = reinterpret_cast<const __m128i*>(s);
-        auto dst = reinterpret_cast<__m128i*>(d[0]);
+        if (simd >= simd_level::simd128)
+        {
+            auto src = reinterpret_cast<const __m128i*>(s);
+            auto dst = reinterpret_cast<__m128i*>(d[0]);
 
-        __m128i* source_chunks_y = new __m128i[2 * width / 16];
-        __m128i* source_chunks_uv = new __m128i[width / 16];
+            __m128i* source_chunks_y = new __m128i[2 * width / 16];
+            __m128i* source_chunks_uv = new __m128i[width / 16];
 
 #pragma omp parallel for
-        for (int j = 0; j < height / 2; ++j)
-        {
-#pragma omp parallel for
-            for (int i = 0; i < 2 * width / 16; ++i)
+            for (int j = 0; j < height / 2; ++j)
             {
-                auto offset_to_current_2_y_lines_for_src = (3 * width * j) / 16;
+#pragma omp parallel for
+                for (int i = 0; i < 2 * width / 16; ++i)
+                {
+                    auto offset_to_current_2_y_lines_for_src = (3 * width * j) / 16;
 
-                source_chunks_y[i] = _mm_loadu_si128(&src[offset_to_current_2_y_lines_for_src + i]);
+                    source_chunks_y[i] = _mm_loadu_si128(&src[offset_to_current_2_y_lines_for_src + i]);
 
-                if (FORMAT == RS2_FORMAT_Y8)
-                {
-                    auto offset_to_current_2_y_lines_for_dst = (2 * width * j) / 16;
-                    // Align all Y components and output 2 lines of Y at once
-                    _mm_storeu_si128(&dst[offset_to_current_2_y_lines_for_dst + i], source_chunks_y[i]);
-                    continue;
-                }
+                    if (FORMAT == RS2_FORMAT_Y8)
+                    {
+                        auto offset_to_current_2_y_lines_for_dst = (2 * width * j) / 16;
+                        // Align all Y components and output 2 lines of Y at once
+                        _mm_storeu_si128(&dst[offset_to_current_2_y_lines_for_dst + i], source_chunks_y[i]);
+                        continue;
+                    }
 
-                if (FORMAT == RS2_FORMAT_Y16)
-                {
-                    auto bpp = 2;
-                    auto offset_to_current_2_y_lines_for_dst = (2 * width * j) / 16 * bpp;
-                    const __m128i zero = _mm_set1_epi8(0);
-                    __m128i y16__0_7 = _mm_unpacklo_epi8(source_chunks_y[i], zero);
-                    __m128i y16__8_F = _mm_unpackhi_epi8(source_chunks_y[i], zero);
-                    __m128i y16_0_7_epi_16 = _mm_slli_epi16(y16__0_7, 8);
-                    __m128i y16_8_F_epi_16 = _mm_slli_epi16(y16__8_F, 8);
-                    // Align all Y components and output 2 _m128i of Y at once
-                    _mm_storeu_si128(&dst[offset_to_current_2_y_lines_for_dst + i * 2], y16_0_7_epi_16);
-                    _mm_storeu_si128(&dst[offset_to_current_2_y_lines_for_dst + i * 2 + 1], y16_8_F_epi_16);
-                    continue;
+                    if (FORMAT == RS2_FORMAT_Y16)
+                    {
+                        auto bpp = 2;
+                        auto offset_to_current_2_y_lines_for_dst = (2 * width * j) / 16 * bpp;
+                        const __m128i zero = _mm_set1_epi8(0);
+                        __m128i y16__0_7 = _mm_unpacklo_epi8(source_chunks_y[i], zero);
+                        __m128i y16__8_F = _mm_unpackhi_epi8(source_chunks_y[i], zero);
+                        __m128i y16_0_7_epi_16 = _mm_slli_epi16(y16__0_7, 8);
+                        __m128i y16_8_F_epi_16 = _mm_slli_epi16(y16__8_F, 8);
+                        // Align all Y components and output 2 _m128i of Y at once
+                        _mm_storeu_si128(&dst[offset_to_current_2_y_lines_for_dst + i * 2], y16_0_7_epi_16);
+                        _mm_storeu_si128(&dst[offset_to_current_2_y_lines_for_dst + i * 2 + 1], y16_8_F_epi_16);
+                        continue;
+                    }
+
+                    auto offset_to_current_uv_line_for_src = offset_to_current_2_y_lines_for_src + 2 * width / 16;
+                    if (i < width / 16)
+                        source_chunks_uv[i] = _mm_load_si128(&src[offset_to_current_uv_line_for_src + i]);
                 }
 
-                auto offset_to_current_uv_line_for_src = offset_to_current_2_y_lines_for_src + 2 * width / 16;
-                if (i < width / 16)
-                    source_chunks_uv[i] = _mm_load_si128(&src[offset_to_current_uv_line_for_src + i]);
-            }
+                if (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_RGBA8 || FORMAT == RS2_FORMAT_BGR8 || FORMAT == RS2_FORMAT_BGRA8)
+                {
+                    int bpp = 3;
+                    if (FORMAT == RS2_FORMAT_RGBA8 || FORMAT == RS2_FORMAT_BGRA8)
+                        bpp = 4;
 
-            if (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_RGBA8 || FORMAT == RS2_FORMAT_BGR8 || FORMAT == RS2_FORMAT_BGRA8)
-            {
-                int bpp = 3;
-                if (FORMAT == RS2_FORMAT_RGBA8 || FORMAT == RS2_FORMAT_BGRA8)
-                    bpp = 4;
+                    auto offset_to_current_first_line_for_dst = (2 * width * j) / 16 * bpp;
+                    auto offset_to_current_second_line_for_dst = offset_to_current_first_line_for_dst + width * bpp / 16;
 
-                auto offset_to_current_first_line_for_dst = (2 * width * j) / 16 * bpp;
-                auto offset_to_current_second_line_for_dst = offset_to_current_first_line_for_dst + width * bpp / 16;
+                    auto line_length = width / 16;
+                    auto first_line_y = source_chunks_y;
+                    auto second_line_y = source_chunks_y + line_length;
 
-                auto line_length = width / 16;
-                auto first_line_y = source_chunks_y;
-                auto second_line_y = source_chunks_y + line_length;
+                    m420_sse_parse_one_line<FORMAT>(first_line_y, source_chunks_uv, &dst[offset_to_current_first_line_for_dst], line_length);
+                    m420_sse_parse_one_line<FORMAT>(second_line_y, source_chunks_uv, &dst[offset_to_current_second_line_for_dst], line_length);
+                }
+            }
 
-                m420_sse_parse_one_line<FORMAT>(first_line_y, source_chunks_uv, &dst[offset_to_current_first_line_for_dst], line_length);
-                m420_sse_parse_one_line<FORMAT>(second_line_y, source_chunks_uv, &dst[offset_to_current_second_line_for_dst], line_length);
+            delete[] source_chunks_y;
+            delete[] source_chunks_uv;
+            return;
+        }
+#elif defined RS2_YUV_NEON
+        if (simd >= simd_level::simd128)
+        {
+            auto dst = d[0];
+            for (int j = 0; j < height / 2; ++j)
+            {
+                // 2 lines of y followed by the line of uv they share
+                auto first_line_y = s + 3 * width * j;
+                auto second_line_y = first_line_y + width;
+                auto line_uv = second_line_y + width;
+                dst = yuv_neon::unpack_m420_line<FORMAT>(dst, first_line_y, line_uv, width);
+                dst = yuv_neon::unpack_m420_line<FORMAT>(dst, second_line_y, line_uv, width);
             }
+            return;
         }
+#endif
 
-        delete[] source_chunks_y;
-        delete[] source_chunks_uv;
-
-#else
+        // Generic code for when SSSE3 is not available.
         auto src = reinterpret_cast<const uint8_t*>(s);
         auto dst = reinterpret_cast<uint8_t*>(d[0]);
 
@@ -741,8 +745,6 @@ namespace librealsense
             m420_parse_one_line<FORMAT>(start_of_y, start_of_uv, &dst, width);
             m420_parse_one_line<FORMAT>(start_of_second_line, start_of_uv, &dst, width);
         }
-        return;
-#endif // __SSSE3__
     }
 
     void unpack_yuy2(rs2_format dst_format, rs2_stream dst_stream, uint8_t * const d[], const uint8_t * s, int w, int h, int actual_size)
@@ -811,134 +813,150 @@ namespace librealsense
     {
         auto n = width * height;
         assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
+#ifdef RS2_USE_CUDA
+        rscuda::unpack_uyvy_cuda<FORMAT>(d, s, n);
+        return;
+#endif
+        auto const simd = get_simd_level();
 #ifdef __SSSE3__
-        auto src = reinterpret_cast<const __m128i *>(s);
-        auto dst = reinterpret_cast<__m128i *>(d[0]);
-        for (; n; n -= 16)
+        if (simd >= simd_level::simd128)
         {
-            const __m128i zero = _mm_set1_epi8(0);
-            const __m128i n100 = _mm_set1_epi16(100 << 4);
-            const __m128i n208 = _mm_set1_epi16(208 << 4);
-            const __m128i n298 = _mm_set1_epi16(298 << 4);
-            const __m128i n409 = _mm_set1_epi16(409 << 4);
-            const __m128i n516 = _mm_set1_epi16(516 << 4);
-            const __m128i evens_odds = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+            auto src = reinterpret_cast<const __m128i *>(s);
+            auto dst = reinterpret_cast<__m128i *>(d[0]);
+            for (; n; n -= 16)
+            {
+                const __m128i zero = _mm_set1_epi8(0);
+                const __m128i n100 = _mm_set1_epi16(100 << 4);
+                const __m128i n208 = _mm_set1_epi16(208 << 4);
+                const __m128i n298 = _mm_set1_epi16(298 << 4);
+                const __m128i n409 = _mm_set1_epi16(409 << 4);
+                const __m128i n516 = _mm_set1_epi16(516 << 4);
+                const __m128i evens_odds = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
 
-            // Load 8 UYVY pixels each into two 16-byte registers
-            __m128i s0 = _mm_loadu_si128(src++);
-            __m128i s1 = _mm_loadu_si128(src++);
+                // Load 8 UYVY pixels each into two 16-byte registers
+                __m128i s0 = _mm_loadu_si128(src++);
+                __m128i s1 = _mm_loadu_si128(src++);
 
 
-            // Shuffle all Y components to the low order bytes of the register, and all U/V components to the high order bytes
-            const __m128i evens_odd1s_odd3s = _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, 0, 4, 8, 12, 2, 6, 10, 14); // to get yyyyyyyyuuuuvvvv
-            __m128i yyyyyyyyuuuuvvvv0 = _mm_shuffle_epi8(s0, evens_odd1s_odd3s);
-            __m128i yyyyyyyyuuuuvvvv8 = _mm_shuffle_epi8(s1, evens_odd1s_odd3s);
+                // Shuffle all Y components to the low order bytes of the register, and all U/V components to the high order bytes
+                const __m128i evens_odd1s_odd3s = _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, 0, 4, 8, 12, 2, 6, 10, 14); // to get yyyyyyyyuuuuvvvv
+                __m128i yyyyyyyyuuuuvvvv0 = _mm_shuffle_epi8(s0, evens_odd1s_odd3s);
+                __m128i yyyyyyyyuuuuvvvv8 = _mm_shuffle_epi8(s1, evens_odd1s_odd3s);
 
-            // Retrieve all 16 Y components as 16-bit values (8 components per register))
-            __m128i y16__0_7 = _mm_unpacklo_epi8(yyyyyyyyuuuuvvvv0, zero);         // convert to 16 bit
-            __m128i y16__8_F = _mm_unpacklo_epi8(yyyyyyyyuuuuvvvv8, zero);         // convert to 16 bit
+                // Retrieve all 16 Y components as 16-bit values (8 components per register))
+                __m128i y16__0_7 = _mm_unpacklo_epi8(yyyyyyyyuuuuvvvv0, zero);         // convert to 16 bit
+                __m128i y16__8_F = _mm_unpacklo_epi8(yyyyyyyyuuuuvvvv8, zero);         // convert to 16 bit
 
 
-            // Retrieve all 16 U and V components as 16-bit values (8 components per register)
-            __m128i uv = _mm_unpackhi_epi32(yyyyyyyyuuuuvvvv0, yyyyyyyyuuuuvvvv8); // uuuuuuuuvvvvvvvv
-            __m128i u = _mm_unpacklo_epi8(uv, uv);                                 //  uu uu uu uu uu uu uu uu  u's duplicated
-            __m128i v = _mm_unpackhi_epi8(uv, uv);                                 //  vv vv vv vv vv vv vv vv
-            __m128i u16__0_7 = _mm_unpacklo_epi8(u, zero);                         // convert to 16 bit
-            __m128i u16__8_F = _mm_unpackhi_epi8(u, zero);                         // convert to 16 bit
-            __m128i v16__0_7 = _mm_unpacklo_epi8(v, zero);                         // convert to 16 bit
-            __m128i v16__8_F = _mm_unpackhi_epi8(v, zero);                         // convert to 16 bit
+                // Retrieve all 16 U and V components as 16-bit values (8 components per register)
+                __m128i uv = _mm_unpackhi_epi32(yyyyyyyyuuuuvvvv0, yyyyyyyyuuuuvvvv8); // uuuuuuuuvvvvvvvv
+                __m128i u = _mm_unpacklo_epi8(uv, uv);                                 //  uu uu uu uu uu uu uu uu  u's duplicated
+                __m128i v = _mm_unpackhi_epi8(uv, uv);                                 //  vv vv vv vv vv vv vv vv
+                __m128i u16__0_7 = _mm_unpacklo_epi8(u, zero);                         // convert to 16 bit
+                __m128i u16__8_F = _mm_unpackhi_epi8(u, zero);                         // convert to 16 bit
+                __m128i v16__0_7 = _mm_unpacklo_epi8(v, zero);                         // convert to 16 bit
+                __m128i v16__8_F = _mm_unpackhi_epi8(v, zero);                         // convert to 16 bit
 
-                                                                                   // Compute R, G, B values for first 8 pixels
-            __m128i c16__0_7 = _mm_slli_epi16(_mm_subs_epi16(y16__0_7, _mm_set1_epi16(16)), 4);
-            __m128i d16__0_7 = _mm_slli_epi16(_mm_subs_epi16(u16__0_7, _mm_set1_epi16(128)), 4); // perhaps could have done these u,v to d,e before the duplication
-            __m128i e16__0_7 = _mm_slli_epi16(_mm_subs_epi16(v16__0_7, _mm_set1_epi16(128)), 4);
-            __m128i r16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(e16__0_7, n409))))));                                                 // (298 * c + 409 * e + 128) ; //
-            __m128i g16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_sub_epi16(_mm_sub_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(d16__0_7, n100)), _mm_mulhi_epi16(e16__0_7, n208)))))); // (298 * c - 100 * d - 208 * e + 128)
-            __m128i b16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(d16__0_7, n516))))));                                                 // clampbyte((298 * c + 516 * d + 128) >> 8);
+                                                                                       // Compute R, G, B values for first 8 pixels
+                __m128i c16__0_7 = _mm_slli_epi16(_mm_subs_epi16(y16__0_7, _mm_set1_epi16(16)), 4);
+                __m128i d16__0_7 = _mm_slli_epi16(_mm_subs_epi16(u16__0_7, _mm_set1_epi16(128)), 4); // perhaps could have done these u,v to d,e before the duplication
+                __m128i e16__0_7 = _mm_slli_epi16(_mm_subs_epi16(v16__0_7, _mm_set1_epi16(128)), 4);
+                __m128i r16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(e16__0_7, n409))))));                                                 // (298 * c + 409 * e + 128) ; //
+                __m128i g16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_sub_epi16(_mm_sub_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(d16__0_7, n100)), _mm_mulhi_epi16(e16__0_7, n208)))))); // (298 * c - 100 * d - 208 * e + 128)
+                __m128i b16__0_7 = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__0_7, n298), _mm_mulhi_epi16(d16__0_7, n516))))));                                                 // clampbyte((298 * c + 516 * d + 128) >> 8);
 
-                                                                                                                                                                                                                             // Compute R, G, B values for second 8 pixels
-            __m128i c16__8_F = _mm_slli_epi16(_mm_subs_epi16(y16__8_F, _mm_set1_epi16(16)), 4);
-            __m128i d16__8_F = _mm_slli_epi16(_mm_subs_epi16(u16__8_F, _mm_set1_epi16(128)), 4); // perhaps could have done these u,v to d,e before the duplication
-            __m128i e16__8_F = _mm_slli_epi16(_mm_subs_epi16(v16__8_F, _mm_set1_epi16(128)), 4);
-            __m128i r16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(e16__8_F, n409))))));                                                 // (298 * c + 409 * e + 128) ; //
-            __m128i g16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_sub_epi16(_mm_sub_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(d16__8_F, n100)), _mm_mulhi_epi16(e16__8_F, n208)))))); // (298 * c - 100 * d - 208 * e + 128)
-            __m128i b16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(d16__8_F, n516))))));                                                 // clampbyte((298 * c + 516 * d + 128) >> 8);
+                                                                                                                                                                                                                                 // Compute R, G, B values for second 8 pixels
+                __m128i c16__8_F = _mm_slli_epi16(_mm_subs_epi16(y16__8_F, _mm_set1_epi16(16)), 4);
+                __m128i d16__8_F = _mm_slli_epi16(_mm_subs_epi16(u16__8_F, _mm_set1_epi16(128)), 4); // perhaps could have done these u,v to d,e before the duplication
+                __m128i e16__8_F = _mm_slli_epi16(_mm_subs_epi16(v16__8_F, _mm_set1_epi16(128)), 4);
+                __m128i r16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(e16__8_F, n409))))));                                                 // (298 * c + 409 * e + 128) ; //
+                __m128i g16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_sub_epi16(_mm_sub_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(d16__8_F, n100)), _mm_mulhi_epi16(e16__8_F, n208)))))); // (298 * c - 100 * d - 208 * e + 128)
+                __m128i b16__8_F = _mm_min_epi16(_mm_set1_epi16(255), _mm_max_epi16(zero, ((_mm_add_epi16(_mm_mulhi_epi16(c16__8_F, n298), _mm_mulhi_epi16(d16__8_F, n516))))));                                                 // clampbyte((298 * c + 516 * d + 128) >> 8);
 
-            if (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_RGBA8)
-            {
-                // Shuffle separate R, G, B values into four registers storing four pixels each in (R, G, B, A) order
-                __m128i rg8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__0_7, evens_odds), _mm_shuffle_epi8(g16__0_7, evens_odds)); // hi to take the odds which are the upper bytes we care about
-                __m128i ba8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__0_7, evens_odds), _mm_set1_epi8(-1));
-                __m128i rgba_0_3 = _mm_unpacklo_epi16(rg8__0_7, ba8__0_7);
-                __m128i rgba_4_7 = _mm_unpackhi_epi16(rg8__0_7, ba8__0_7);
+                if (FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_RGBA8)
+                {
+                    // Shuffle separate R, G, B values into four registers storing four pixels each in (R, G, B, A) order
+                    __m128i rg8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__0_7, evens_odds), _mm_shuffle_epi8(g16__0_7, evens_odds)); // hi to take the odds which are the upper bytes we care about
+                    __m128i ba8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__0_7, evens_odds), _mm_set1_epi8(-1));
+                    __m128i rgba_0_3 = _mm_unpacklo_epi16(rg8__0_7, ba8__0_7);
+                    __m128i rgba_4_7 = _mm_unpackhi_epi16(rg8__0_7, ba8__0_7);
 
-                __m128i rg8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__8_F, evens_odds), _mm_shuffle_epi8(g16__8_F, evens_odds)); // hi to take the odds which are the upper bytes we care about
-                __m128i ba8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__8_F, evens_odds), _mm_set1_epi8(-1));
-                __m128i rgba_8_B = _mm_unpacklo_epi16(rg8__8_F, ba8__8_F);
-                __m128i rgba_C_F = _mm_unpackhi_epi16(rg8__8_F, ba8__8_F);
+                    __m128i rg8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__8_F, evens_odds), _mm_shuffle_epi8(g16__8_F, evens_odds)); // hi to take the odds which are the upper bytes we care about
+                    __m128i ba8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__8_F, evens_odds), _mm_set1_epi8(-1));
+                    __m128i rgba_8_B = _mm_unpacklo_epi16(rg8__8_F, ba8__8_F);
+                    __m128i rgba_C_F = _mm_unpackhi_epi16(rg8__8_F, ba8__8_F);
 
-                if (FORMAT == RS2_FORMAT_RGBA8)
-                {
-                    // Store 16 pixels (64 bytes) at once
-                    _mm_storeu_si128(dst++, rgba_0_3);
-                    _mm_storeu_si128(dst++, rgba_4_7);
-                    _mm_storeu_si128(dst++, rgba_8_B);
-                    _mm_storeu_si128(dst++, rgba_C_F);
-                }
+                    if (FORMAT == RS2_FORMAT_RGBA8)
+                    {
+                        // Store 16 pixels (64 bytes) at once
+                        _mm_storeu_si128(dst++, rgba_0_3);
+                        _mm_storeu_si128(dst++, rgba_4_7);
+                        _mm_storeu_si128(dst++, rgba_8_B);
+                        _mm_storeu_si128(dst++, rgba_C_F);
+                    }
 
-                if (FORMAT == RS2_FORMAT_RGB8)
-                {
-                    // Shuffle rgb triples to the start and end of each register
-                    __m128i rgb0 = _mm_shuffle_epi8(rgba_0_3, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
-                    __m128i rgb1 = _mm_shuffle_epi8(rgba_4_7, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
-                    __m128i rgb2 = _mm_shuffle_epi8(rgba_8_B, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
-                    __m128i rgb3 = _mm_shuffle_epi8(rgba_C_F, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
+                    if (FORMAT == RS2_FORMAT_RGB8)
+                    {
+                        // Shuffle rgb triples to the start and end of each register
+                        __m128i rgb0 = _mm_shuffle_epi8(rgba_0_3, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
+                        __m128i rgb1 = _mm_shuffle_epi8(rgba_4_7, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
+                        __m128i rgb2 = _mm_shuffle_epi8(rgba_8_B, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
+                        __m128i rgb3 = _mm_shuffle_epi8(rgba_C_F, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
 
-                    // Align registers and store 16 pixels (48 bytes) at once
-                    _mm_storeu_si128(dst++, _mm_alignr_epi8(rgb1, rgb0, 4));
-                    _mm_storeu_si128(dst++, _mm_alignr_epi8(rgb2, rgb1, 8));
-                    _mm_storeu_si128(dst++, _mm_alignr_epi8(rgb3, rgb2, 12));
+                        // Align registers and store 16 pixels (48 bytes) at once
+                        _mm_storeu_si128(dst++, _mm_alignr_epi8(rgb1, rgb0, 4));
+                        _mm_storeu_si128(dst++, _mm_alignr_epi8(rgb2, rgb1, 8));
+                        _mm_storeu_si128(dst++, _mm_alignr_epi8(rgb3, rgb2, 12));
+                    }
                 }
-            }
 
-            if (FORMAT == RS2_FORMAT_BGR8 || FORMAT == RS2_FORMAT_BGRA8)
-            {
-                // Shuffle separate R, G, B values into four registers storing four pixels each in (B, G, R, A) order
-                __m128i bg8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__0_7, evens_odds), _mm_shuffle_epi8(g16__0_7, evens_odds)); // hi to take the odds which are the upper bytes we care about
-                __m128i ra8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__0_7, evens_odds), _mm_set1_epi8(-1));
-                __m128i bgra_0_3 = _mm_unpacklo_epi16(bg8__0_7, ra8__0_7);
-                __m128i bgra_4_7 = _mm_unpackhi_epi16(bg8__0_7, ra8__0_7);
+                if (FORMAT == RS2_FORMAT_BGR8 || FORMAT == RS2_FORMAT_BGRA8)
+                {
+                    // Shuffle separate R, G, B values into four registers storing four pixels each in (B, G, R, A) order
+                    __m128i bg8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__0_7, evens_odds), _mm_shuffle_epi8(g16__0_7, evens_odds)); // hi to take the odds which are the upper bytes we care about
+                    __m128i ra8__0_7 = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__0_7, evens_odds), _mm_set1_epi8(-1));
+                    __m128i bgra_0_3 = _mm_unpacklo_epi16(bg8__0_7, ra8__0_7);
+                    __m128i bgra_4_7 = _mm_unpackhi_epi16(bg8__0_7, ra8__0_7);
 
-                __m128i bg8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__8_F, evens_odds), _mm_shuffle_epi8(g16__8_F, evens_odds)); // hi to take the odds which are the upper bytes we care about
-                __m128i ra8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__8_F, evens_odds), _mm_set1_epi8(-1));
-                __m128i bgra_8_B = _mm_unpacklo_epi16(bg8__8_F, ra8__8_F);
-                __m128i bgra_C_F = _mm_unpackhi_epi16(bg8__8_F, ra8__8_F);
+                    __m128i bg8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(b16__8_F, evens_odds), _mm_shuffle_epi8(g16__8_F, evens_odds)); // hi to take the odds which are the upper bytes we care about
+                    __m128i ra8__8_F = _mm_unpacklo_epi8(_mm_shuffle_epi8(r16__8_F, evens_odds), _mm_set1_epi8(-1));
+                    __m128i bgra_8_B = _mm_unpacklo_epi16(bg8__8_F, ra8__8_F);
+                    __m128i bgra_C_F = _mm_unpackhi_epi16(bg8__8_F, ra8__8_F);
 
-                if (FORMAT == RS2_FORMAT_BGRA8)
-                {
-                    // Store 16 pixels (64 bytes) at once
-                    _mm_storeu_si128(dst++, bgra_0_3);
-                    _mm_storeu_si128(dst++, bgra_4_7);
-                    _mm_storeu_si128(dst++, bgra_8_B);
-                    _mm_storeu_si128(dst++, bgra_C_F);
-                }
+                    if (FORMAT == RS2_FORMAT_BGRA8)
+                    {
+                        // Store 16 pixels (64 bytes) at once
+                        _mm_storeu_si128(dst++, bgra_0_3);
+                        _mm_storeu_si128(dst++, bgra_4_7);
+                        _mm_storeu_si128(dst++, bgra_8_B);
+                        _mm_storeu_si128(dst++, bgra_C_F);
+                    }
 
-                if (FORMAT == RS2_FORMAT_BGR8)
-                {
-                    // Shuffle rgb triples to the start and end of each register
-                    __m128i bgr0 = _mm_shuffle_epi8(bgra_0_3, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
-                    __m128i bgr1 = _mm_shuffle_epi8(bgra_4_7, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
-                    __m128i bgr2 = _mm_shuffle_epi8(bgra_8_B, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
-                    __m128i bgr3 = _mm_shuffle_epi8(bgra_C_F, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
+                    if (FORMAT == RS2_FORMAT_BGR8)
+                    {
+                        // Shuffle rgb triples to the start and end of each register
+                        __m128i bgr0 = _mm_shuffle_epi8(bgra_0_3, _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
+                        __m128i bgr1 = _mm_shuffle_epi8(bgra_4_7, _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
+                        __m128i bgr2 = _mm_shuffle_epi8(bgra_8_B, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
+                        __m128i bgr3 = _mm_shuffle_epi8(bgra_C_F, _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
 
-                    // Align registers and store 16 pixels (48 bytes) at once
-                    _mm_storeu_si128(dst++, _mm_alignr_epi8(bgr1, bgr0, 4));
-                    _mm_storeu_si128(dst++, _mm_alignr_epi8(bgr2, bgr1, 8));
-                    _mm_storeu_si128(dst++, _mm_alignr_epi8(bgr3, bgr2, 12));
+                        // Align registers and store 16 pixels (48 bytes) at once
+                        _mm_storeu_si128(dst++, _mm_alignr_epi8(bgr1, bgr0, 4));
+                        _mm_storeu_si128(dst++, _mm_alignr_epi8(bgr2, bgr1, 8));
+                        _mm_storeu_si128(dst++, _mm_alignr_epi8(bgr3, bgr2, 12));
+                    }
                 }
             }
+            return;
         }
-#else  // Generic code for when SSSE3 is not available.
+#elif defined RS2_YUV_NEON
+        if (simd >= simd_level::simd128)
+        {
+            yuv_neon::unpack_uyvy<FORMAT>(d[0], s, n);
+            return;
+        }
+#endif
+        // Generic code for when SSSE3 is not available.
         auto src = reinterpret_cast<const uint8_t *>(s);
         auto dst = reinterpret_cast<uint8_t *>(d[0]);
         for (; n; n -= 16, src += 32)
@@ -1043,7 +1061,6 @@ namespace librealsense
                 continue;
             }
         }
-#endif
     }
 
     void unpack_uyvyc(rs2_format dst_format, rs2_stream dst_stream, uint8_t * const d[], const uint8_t * s, int w, int h, int actual_size)
@@ -1068,23 +1085,6 @@ namespace librealsense
         }
     }
 
-    /////////////////////////////
-    // MJPEG unpacking routines //
-    /////////////////////////////
-    void unpack_mjpeg( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
-    {
-        int w, h, bpp;
-        auto uncompressed_rgb = stbi_load_from_memory(source, actual_size, &w, &h, &bpp, false);
-        if (uncompressed_rgb)
-        {
-            auto uncompressed_size = w * h * bpp;
-            std::memcpy( dest[0], uncompressed_rgb, uncompressed_size );
-            stbi_image_free(uncompressed_rgb);
-        }
-        else
-            LOG_ERROR("jpeg decode failed");
-    }
-
     /////////////////////////////
     // BGR unpacking routines //
     /////////////////////////////
@@ -1106,6 +1106,74 @@ namespace librealsense
         unpack_yuy2(_target_format, _target_stream, dest, source, width, height, actual_size);
     }
 
+    yuy2_multi_converter::yuy2_multi_converter(const char* name, std::vector<rs2_format> target_formats) :
+        processing_block(name), _target_formats(std::move(target_formats))
+    {
+        configure_processing_callback();
+    }
+
+    void yuy2_multi_converter::configure_processing_callback()
+    {
+        auto process_callback = [&](frame_holder && frame, synthetic_source_interface* source)
+        {
+            auto profile = As<video_stream_profile, stream_profile_interface>(frame.frame->get_stream());
+            if (!profile || profile->get_format() != RS2_FORMAT_YUYV)
+            {
+                source->frame_ready(std::move(frame));
+                return;
+            }
+
+            if (profile.get() != _source_stream_profile.get())
+            {
+                _source_stream_profile = profile;
+                _target_stream_profiles.clear();
+                for (auto format : _target_formats)
+                {
+                    auto target = profile->clone();
+                    target->set_format(format);
+                    target->set_stream_type(RS2_STREAM_COLOR);
+                    target->set_stream_index(profile->get_stream_index());
+                    _target_stream_profiles.push_back(target);
+                }
+            }
+
+            int const w = profile->get_width();
+            int const h = profile->get_height();
+            std::vector<frame_holder> outputs;
+            std::vector<int> bpps;
+            for (size_t i = 0; i < _target_formats.size(); ++i)
+            {
+                int const bpp = get_image_bpp(_target_formats[i]) / 8;
+                bpps.push_back(bpp);
+                outputs.emplace_back(source->allocate_video_frame(_target_stream_profiles[i], frame, bpp,
+                    w, h, w * bpp, RS2_EXTENSION_VIDEO_FRAME));
+            }
+
+            // 16 lines keep the strip a multiple of the 16 pixels the unpackers work in, and its source (61KB for
+            // 1920 pixels) within L2
+#ifdef RS2_USE_CUDA
+            int const strip = h;  // the CUDA unpackers process whole frames
+#else
+            int const strip = 16;
+#endif
+            auto src = (const uint8_t *)frame->get_frame_data();
+            for (int y = 0; y < h; y += strip)
+            {
+                int const rows = std::min(strip, h - y);
+                for (size_t i = 0; i < outputs.size(); ++i)
+                {
+                    uint8_t * planes[1] = { (uint8_t *)outputs[i]->get_frame_data() + size_t(y) * w * bpps[i] };
+                    unpack_yuy2(_target_formats[i], RS2_STREAM_COLOR, planes, src + size_t(y) * w * 2, w, rows, w * rows * bpps[i]);
+                }
+            }
+
+            for (auto & output : outputs)
+                source->frame_ready(std::move(output));
+        };
+
+        set_processing_callback( make_frame_processor_callback( std::move( process_callback ) ) );
+    }
+
     void uyvy_converter::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
     {
         unpack_uyvyc(_target_format, _target_stream, dest, source, width, height, actual_size);
@@ -1113,7 +1181,8 @@ namespace librealsense
 
     void mjpeg_converter::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
     {
-        unpack_mjpeg(dest, source, width, height, actual_size, input_size);
+        if (!_decoder->decode_rgb8(source, actual_size, dest[0], width, height))
+            LOG_ERROR("jpeg decode failed (" << _decoder->get_name() << ")");
     }
 
     void bgr_to_rgb::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
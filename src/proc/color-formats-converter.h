@@ -4,6 +4,9 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "mjpeg-decoder.h"
+
+#include <vector>
 
 namespace librealsense
 {
@@ -26,6 +29,25 @@ namespace librealsense
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
     };
 
+    // Converts YUY2 into several formats at once, e.g. RGB8 for display and Y8 for feature tracking, and outputs one frame
+    // per format for every source frame.
+    // The source is converted in strips of rows small enough to stay in cache, so it is read from memory once however
+    // many formats are produced.
+    class LRS_EXTENSION_API yuy2_multi_converter : public processing_block
+    {
+    public:
+        yuy2_multi_converter(std::vector<rs2_format> target_formats) :
+            yuy2_multi_converter("YUY Multi-Format Converter", std::move(target_formats)) {};
+
+    protected:
+        yuy2_multi_converter(const char* name, std::vector<rs2_format> target_formats);
+        void configure_processing_callback();
+
+        std::vector<rs2_format> _target_formats;
+        std::shared_ptr<stream_profile_interface> _source_stream_profile;
+        std::vector<std::shared_ptr<stream_profile_interface>> _target_stream_profiles;
+    };
+
     class LRS_EXTENSION_API uyvy_converter : public color_converter
     {
     public:
@@ -46,8 +68,10 @@ namespace librealsense
 
     protected:
         mjpeg_converter(const char* name, rs2_format target_format) :
-            color_converter(name, target_format) {};
+            color_converter(name, target_format), _decoder(mjpeg_decoder::create()) {};
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
+
+        std::shared_ptr< mjpeg_decoder > _decoder;
     };
 
     class LRS_EXTENSION_API bgr_to_rgb : public color_converter
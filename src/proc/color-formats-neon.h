@@ -0,0 +1,160 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+// NEON versions of the YUY2/UYVY/M420/Y411 unpacking loops, for ARM hosts.
+//
+// Each step converts 16 pixels: the luma and chroma are de-interleaved with structure loads, the chroma of each pair
+// of pixels is duplicated with a single transpose, and the results are interleaved again by vst3/vst4. The arithmetic is
+// done in 32 bits with the same coefficients, rounding and clamping as the generic code, so the output is identical.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+
+#include <cstdint>
+
+#if defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#include <arm_neon.h>
+#define RS2_YUV_NEON
+#endif
+
+
+#ifdef RS2_YUV_NEON
+
+namespace librealsense {
+namespace yuv_neon {
+
+
+// ( x >> 8 ), clamped to [0,255]
+inline uint8x8_t shift_and_clamp( int32x4_t lo, int32x4_t hi )
+{
+    return vqmovun_s16( vcombine_s16( vshrn_n_s32( lo, 8 ), vshrn_n_s32( hi, 8 ) ) );
+}
+
+// r = (298 * c + 409 * e + 128) >> 8, g = (298 * c - 100 * d - 208 * e + 128) >> 8, b = (298 * c + 516 * d + 128) >> 8
+inline void yuv_to_rgb( uint8x8_t y, uint8x8_t u, uint8x8_t v, uint8x8_t & r, uint8x8_t & g, uint8x8_t & b )
+{
+    int16x8_t const c = vreinterpretq_s16_u16( vsubl_u8( y, vdup_n_u8( 16 ) ) );
+    int16x8_t const d = vreinterpretq_s16_u16( vsubl_u8( u, vdup_n_u8( 128 ) ) );
+    int16x8_t const e = vreinterpretq_s16_u16( vsubl_u8( v, vdup_n_u8( 128 ) ) );
+    int16x4_t const c_lo = vget_low_s16( c ), c_hi = vget_high_s16( c );
+    int16x4_t const d_lo = vget_low_s16( d ), d_hi = vget_high_s16( d );
+    int16x4_t const e_lo = vget_low_s16( e ), e_hi = vget_high_s16( e );
+
+    int32x4_t const round = vdupq_n_s32( 128 );
+    int32x4_t const y_lo = vmlal_n_s16( round, c_lo, 298 );
+    int32x4_t const y_hi = vmlal_n_s16( round, c_hi, 298 );
+
+    r = shift_and_clamp( vmlal_n_s16( y_lo, e_lo, 409 ), vmlal_n_s16( y_hi, e_hi, 409 ) );
+    g = shift_and_clamp( vmlsl_n_s16( vmlsl_n_s16( y_lo, d_lo, 100 ), e_lo, 208 ),
+                         vmlsl_n_s16( vmlsl_n_s16( y_hi, d_hi, 100 ), e_hi, 208 ) );
+    b = shift_and_clamp( vmlal_n_s16( y_lo, d_lo, 516 ), vmlal_n_s16( y_hi, d_hi, 516 ) );
+}
+
+// Converts and stores 16 pixels. 'uv' holds the interleaved chroma of their 8 pairs: u0 v0 u1 v1 ...
+// Returns the destination past the pixels written.
+template< rs2_format FORMAT > uint8_t * convert( uint8x16_t y, uint8x16_t uv, uint8_t * dst )
+{
+    if( FORMAT == RS2_FORMAT_Y8 )
+    {
+        vst1q_u8( dst, y );
+        return dst + 16;
+    }
+    if( FORMAT == RS2_FORMAT_Y16 )
+    {
+        // Y16 is little-endian: we output Y << 8
+        uint8x16x2_t out = { { vdupq_n_u8( 0 ), y } };
+        vst2q_u8( dst, out );
+        return dst + 32;
+    }
+
+    // u0 u0 u1 u1 ... and v0 v0 v1 v1 ...
+    uint8x16x2_t const uu_vv = vtrnq_u8( uv, uv );
+    uint8x8_t r_lo, g_lo, b_lo, r_hi, g_hi, b_hi;
+    yuv_to_rgb( vget_low_u8( y ), vget_low_u8( uu_vv.val[0] ), vget_low_u8( uu_vv.val[1] ), r_lo, g_lo, b_lo );
+    yuv_to_rgb( vget_high_u8( y ), vget_high_u8( uu_vv.val[0] ), vget_high_u8( uu_vv.val[1] ), r_hi, g_hi, b_hi );
+    uint8x16_t const r = vcombine_u8( r_lo, r_hi );
+    uint8x16_t const g = vcombine_u8( g_lo, g_hi );
+    uint8x16_t const b = vcombine_u8( b_lo, b_hi );
+
+    if( FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_BGR8 )
+    {
+        uint8x16x3_t out = { { r, g, b } };
+        if( FORMAT == RS2_FORMAT_BGR8 )
+        {
+            out.val[0] = b;
+            out.val[2] = r;
+        }
+        vst3q_u8( dst, out );
+        return dst + 16 * 3;
+    }
+    if( FORMAT == RS2_FORMAT_RGBA8 || FORMAT == RS2_FORMAT_BGRA8 )
+    {
+        uint8x16x4_t out = { { r, g, b, vdupq_n_u8( 255 ) } };
+        if( FORMAT == RS2_FORMAT_BGRA8 )
+        {
+            out.val[0] = b;
+            out.val[2] = r;
+        }
+        vst4q_u8( dst, out );
+        return dst + 16 * 4;
+    }
+    return dst;
+}
+
+
+// n pixels of YUY2 (y0 u0 y1 v0 ...); n is a multiple of 16
+template< rs2_format FORMAT > void unpack_yuy2( uint8_t * dst, uint8_t const * src, int n )
+{
+    for( ; n > 0; n -= 16, src += 32 )
+    {
+        uint8x16x2_t const s = vld2q_u8( src );  // y..., u v u v ...
+        dst = convert< FORMAT >( s.val[0], s.val[1], dst );
+    }
+}
+
+// n pixels of UYVY (u0 y0 v0 y1 ...); n is a multiple of 16
+template< rs2_format FORMAT > void unpack_uyvy( uint8_t * dst, uint8_t const * src, int n )
+{
+    for( ; n > 0; n -= 16, src += 32 )
+    {
+        uint8x16x2_t const s = vld2q_u8( src );  // u v u v ..., y...
+        dst = convert< FORMAT >( s.val[1], s.val[0], dst );
+    }
+}
+
+// One line of M420: 'width' Y values, and the line of interleaved U,V values it shares with the next line
+template< rs2_format FORMAT > uint8_t * unpack_m420_line( uint8_t * dst, uint8_t const * y, uint8_t const * uv, int width )
+{
+    for( int x = 0; x < width; x += 16 )
+        dst = convert< FORMAT >( vld1q_u8( y + x ), vld1q_u8( uv + x ), dst );
+    return dst;
+}
+
+
+// Y411 (see y411-converter.cpp) into RGB8: each 6-byte group [u y0 y1 v y2 y3] holds 2 pixels of a line and the 2 below
+// them, so every 48 bytes make 16 pixels of two lines. 'width' is a multiple of 16, 'height' of 2.
+inline void unpack_y411_rgb8( uint8_t * dst, uint8_t const * src, int width, int height )
+{
+    for( int line = 0; line < height; line += 2 )
+    {
+        uint8_t * line0 = dst + line * width * 3;
+        uint8_t * line1 = line0 + width * 3;
+        for( int x = 0; x < width; x += 16, src += 48 )
+        {
+            uint8x16x3_t const s = vld3q_u8( src );  // u v u v ..., y0 y2 y0 y2 ..., y1 y3 y1 y3 ...
+            uint8x8x2_t const left = vuzp_u8( vget_low_u8( s.val[1] ), vget_high_u8( s.val[1] ) );
+            uint8x8x2_t const right = vuzp_u8( vget_low_u8( s.val[2] ), vget_high_u8( s.val[2] ) );
+            uint8x8x2_t const y0 = vzip_u8( left.val[0], right.val[0] );
+            uint8x8x2_t const y1 = vzip_u8( left.val[1], right.val[1] );
+            line0 = convert< RS2_FORMAT_RGB8 >( vcombine_u8( y0.val[0], y0.val[1] ), s.val[0], line0 );
+            line1 = convert< RS2_FORMAT_RGB8 >( vcombine_u8( y1.val[0], y1.val[1] ), s.val[0], line1 );
+        }
+    }
+}
+
+
+}  // namespace yuv_neon
+}  // namespace librealsense
+
+#endif  // RS2_YUV_NEON
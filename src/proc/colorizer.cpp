@@ -11,6 +11,8 @@
 #include "colorizer.h"
 #include "disparity-transform.h"
 
+#include <rsutils/string/from.h>
+
 namespace librealsense
 {
     static color_map hue{ {
@@ -238,6 +240,45 @@ namespace librealsense
         register_option(RS2_OPTION_VISUAL_PRESET, preset_opt);
 
         register_option(RS2_OPTION_HISTOGRAM_EQUALIZATION_ENABLED, hist_opt);
+
+        // RGBA8 can be uploaded to a texture as-is
+        auto format_opt = std::make_shared<ptr_option<int>>(RS2_FORMAT_RGB8, RS2_FORMAT_RGBA8, 1, RS2_FORMAT_RGB8, &_output_format, "Output format");
+        format_opt->set_description(float(RS2_FORMAT_RGB8), "RGB8");
+        format_opt->set_description(float(RS2_FORMAT_RGBA8), "RGBA8");
+        format_opt->on_set([](float val)
+        {
+            if (int(val) != RS2_FORMAT_RGB8 && int(val) != RS2_FORMAT_RGBA8)
+                throw invalid_value_exception( rsutils::string::from() << "Unsupported colorizer output format " << val );
+        });
+        register_option(RS2_OPTION_OUTPUT_FORMAT, format_opt);
+
+        register_processing_threads_option();
+    }
+
+    void colorizer::make_rgb_data_from_lut(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height)
+    {
+        auto lut = _lut.data();
+        for_each_range(size_t(width) * height, [&](size_t begin, size_t end)
+        {
+            if (_output_bpp == 4)
+            {
+                auto out = reinterpret_cast<uint32_t*>(rgb_data);
+                auto table = reinterpret_cast<const uint32_t*>(lut);
+                for (auto i = begin; i < end; ++i)
+                    out[i] = table[depth_data[i]];
+            }
+            else
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    auto c = lut + depth_data[i] * 3;
+                    auto out = rgb_data + i * 3;
+                    out[0] = c[0];
+                    out[1] = c[1];
+                    out[2] = c[2];
+                }
+            }
+        });
     }
 
     bool colorizer::should_process(const rs2::frame& frame)
@@ -255,10 +296,11 @@ namespace librealsense
     {
         if (f.as<rs2::depth_frame>())
             _depth_units = ((depth_frame*)f.get())->get_units();
-        if (f.get_profile().get() != _source_stream_profile.get())
+        if (f.get_profile().get() != _source_stream_profile.get() || _target_stream_profile.format() != _output_format)
         {
             _source_stream_profile = f.get_profile();
-            _target_stream_profile = f.get_profile().clone(RS2_STREAM_DEPTH, f.get_profile().stream_index(), RS2_FORMAT_RGB8);
+            _target_stream_profile = f.get_profile().clone(RS2_STREAM_DEPTH, f.get_profile().stream_index(), rs2_format(_output_format));
+            _output_bpp = _output_format == RS2_FORMAT_RGBA8 ? 4 : 3;
 
             // workaround for D457
             //auto info = disparity_info::update_info_from_frame(f);
@@ -280,14 +322,15 @@ namespace librealsense
             if (depth_format == RS2_FORMAT_DISPARITY32)
             {
                 auto depth_data = reinterpret_cast<const float*>(depth.get_data());
-                update_histogram(_hist_data, depth_data, w, h);
+                build_histogram(depth_data, w, h);
                 make_rgb_data<float>(depth_data, rgb_data, w, h, coloring_function);
             }
             else if (depth_format == RS2_FORMAT_Z16)
             {
                 auto depth_data = reinterpret_cast<const uint16_t*>(depth.get_data());
-                update_histogram(_hist_data, depth_data, w, h);
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                build_histogram(depth_data, w, h);
+                update_lut(coloring_function, true);
+                make_rgb_data_from_lut(depth_data, rgb_data, w, h);
             }
         };
 
@@ -320,14 +363,15 @@ namespace librealsense
                     if (min >= max) return 0.f;
                     return (data * _depth_units - min) / (max - min);
                 };
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                update_lut(coloring_function, false);
+                make_rgb_data_from_lut(depth_data, rgb_data, w, h);
             }
         };
 
         rs2::frame ret;
 
         auto vf = f.as<rs2::video_frame>();
-        ret = source.allocate_video_frame(_target_stream_profile, f, 3, vf.get_width(), vf.get_height(), vf.get_width() * 3, RS2_EXTENSION_VIDEO_FRAME);
+        ret = source.allocate_video_frame(_target_stream_profile, f, _output_bpp, vf.get_width(), vf.get_height(), vf.get_width() * _output_bpp, RS2_EXTENSION_VIDEO_FRAME);
 
         if (_equalize)
             make_equalized_histogram(f, ret);
@@ -3,7 +3,9 @@
 #pragma once
 
 #include <src/float3.h>
+#include "worker-pool.h"
 
+#include <atomic>
 #include <map>
 #include <vector>
 
@@ -124,36 +126,113 @@ namespace librealsense {
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
+        // Same as update_histogram(), using per-thread partial histograms when _threads > 1
+        template<typename T>
+        void build_histogram(const T* depth_data, int w, int h)
+        {
+            if (_threads <= 1)
+            {
+                update_histogram(_hist_data, depth_data, w, h);
+                return;
+            }
+
+            _partial_histograms.resize(_threads);
+            std::atomic<size_t> next_partial(0);
+            for_each_range(size_t(w) * h, [&](size_t begin, size_t end)
+            {
+                auto & partial = _partial_histograms[next_partial++];
+                partial.assign(MAX_DEPTH, 0);
+                for (auto i = begin; i < end; ++i)
+                    partial[static_cast<int>(depth_data[i])] += 1;
+            });
+            for_each_range(MAX_DEPTH, [&](size_t begin, size_t end)
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    int sum = 0;
+                    for (auto & partial : _partial_histograms)
+                        if (!partial.empty())
+                            sum += partial[i];
+                    _hist_data[i] = sum;
+                }
+            });
+            for (auto & partial : _partial_histograms)
+                partial.clear();
+
+            for (auto i = 2; i < MAX_DEPTH; ++i) _hist_data[i] += _hist_data[i - 1]; // Build a cumulative histogram for the indices in [1,0xFFFF]
+        }
+
         template<typename T, typename F>
         void make_rgb_data(const T* depth_data, uint8_t* rgb_data, int width, int height, F coloring_func)
         {
             auto cm = _maps[_map_index];
-            for (auto i = 0; i < width*height; ++i)
+            for_each_range(size_t(width) * height, [&](size_t begin, size_t end)
             {
-                auto d = depth_data[i];
-                colorize_pixel(rgb_data, i, cm, d, coloring_func);
-            }
+                for (auto i = begin; i < end; ++i)
+                {
+                    auto d = depth_data[i];
+                    colorize_pixel(rgb_data, int(i), cm, d, coloring_func);
+                }
+            });
         }
 
         template<typename T, typename F>
         void colorize_pixel(uint8_t* rgb_data, int idx, color_map* cm, T data, F coloring_func)
         {
+            auto out = rgb_data + idx * _output_bpp;
             if (data)
             {
                 auto f = coloring_func(data); // 0-255 based on histogram locationcolorize_pixel
                 auto c = cm->get(f);
-                rgb_data[idx * 3 + 0] = (uint8_t)c.x;
-                rgb_data[idx * 3 + 1] = (uint8_t)c.y;
-                rgb_data[idx * 3 + 2] = (uint8_t)c.z;
+                out[0] = (uint8_t)c.x;
+                out[1] = (uint8_t)c.y;
+                out[2] = (uint8_t)c.z;
             }
             else
             {
-                rgb_data[idx * 3 + 0] = 0;
-                rgb_data[idx * 3 + 1] = 0;
-                rgb_data[idx * 3 + 2] = 0;
+                out[0] = 0;
+                out[1] = 0;
+                out[2] = 0;
             }
+            if (_output_bpp == 4)
+                out[3] = 0xff;
         }
 
+        // Z16 frames are colorized through a table with the color of every possible depth value. It only depends
+        // on the histogram when equalizing, so otherwise it is rebuilt only when the range, units, map or output
+        // format change.
+        struct lut_key
+        {
+            float min, max, depth_units;
+            int map_index, bpp;
+
+            bool operator==(const lut_key& other) const
+            {
+                return min == other.min && max == other.max && depth_units == other.depth_units
+                    && map_index == other.map_index && bpp == other.bpp;
+            }
+        };
+
+        template<typename F>
+        void update_lut(F coloring_func, bool equalized)
+        {
+            lut_key key{ _min, _max, _depth_units, _map_index, _output_bpp };
+            if (!equalized && _lut_valid && key == _lut_key)
+                return;
+
+            _lut.resize(size_t(MAX_DEPTH) * _output_bpp);
+            auto cm = _maps[_map_index];
+            for_each_range(MAX_DEPTH, [&](size_t begin, size_t end)
+            {
+                for (auto d = begin; d < end; ++d)
+                    colorize_pixel(_lut.data(), int(d), cm, uint16_t(d), coloring_func);
+            });
+            _lut_key = key;
+            _lut_valid = !equalized;
+        }
+
+        void make_rgb_data_from_lut(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height);
+
         float _min, _max;
         bool _equalize;
 
@@ -169,5 +248,14 @@ namespace librealsense {
 
         float   _depth_units = 0.f;
         float   _d2d_convert_factor = 0.f;
+
+        int     _output_format = RS2_FORMAT_RGB8;   // RGB8 or RGBA8
+        int     _output_bpp = 3;
+
+        std::vector<uint8_t> _lut;
+        lut_key _lut_key{};
+        bool    _lut_valid = false;
+
+        std::vector<std::vector<int>> _partial_histograms;
     };
 }
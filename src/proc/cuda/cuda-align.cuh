@@ -15,13 +15,17 @@ namespace librealsense
             _d_other_in(nullptr),
             _d_aligned_out(nullptr) {}
 
+        // The images named d_* are on the device: a non-null 'd_depth_in' is used instead of uploading 'h_depth_in', and
+        // a non-null 'd_aligned_out' receives the result instead of 'h_aligned_out' (which may then be null)
         void align_other_to_depth(unsigned char* h_aligned_out, const uint16_t* h_depth_in,
             float depth_scale, const rs2_intrinsics& h_depth_intrin, const rs2_extrinsics& h_depth_to_other,
-            const rs2_intrinsics& h_other_intrin, const unsigned char* h_other_in, rs2_format other_format, int other_bytes_per_pixel);
+            const rs2_intrinsics& h_other_intrin, const unsigned char* h_other_in, rs2_format other_format, int other_bytes_per_pixel,
+            const uint16_t* d_depth_in = nullptr, unsigned char* d_aligned_out = nullptr);
 
         void align_depth_to_other(unsigned char* h_aligned_out, const uint16_t* h_depth_in,
             float depth_scale, const rs2_intrinsics& h_depth_intrin, const rs2_extrinsics& h_depth_to_other,
-            const rs2_intrinsics& h_other_intrin);
+            const rs2_intrinsics& h_other_intrin,
+            const uint16_t* d_depth_in = nullptr, unsigned char* d_aligned_out = nullptr);
 
     private:
         std::shared_ptr<uint16_t>       _d_depth_in;
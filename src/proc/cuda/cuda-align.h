@@ -5,6 +5,7 @@
 
 #include "proc/align.h"
 #include "cuda-align.cuh"
+#include "cuda/cuda-frame.h"
 #include <memory>
 #include <stdint.h>
 
@@ -13,9 +14,21 @@ namespace librealsense
     class align_cuda : public align
     {
     public:
-        align_cuda(rs2_stream align_to) : align(align_to, "Align (CUDA)") {}
+        align_cuda(rs2_stream align_to) : align_cuda(std::vector<rs2_stream>{ align_to }) {}
+
+        align_cuda(const std::vector<rs2_stream>& align_to) : align(align_to, "Align (CUDA)")
+        {
+            // Aligned frames stay on the device, for the next CUDA block to use without a copy
+            _source.add_extension<cuda_video_frame>(RS2_EXTENSION_VIDEO_FRAME_CUDA);
+            _source.add_extension<cuda_depth_frame>(RS2_EXTENSION_DEPTH_FRAME_CUDA);
+        }
 
     protected:
+        rs2_extension select_extension(const rs2::frame& input) override
+        {
+            return input.is<rs2::depth_frame>() ? RS2_EXTENSION_DEPTH_FRAME_CUDA : RS2_EXTENSION_VIDEO_FRAME_CUDA;
+        }
+
         void reset_cache(rs2_stream from, rs2_stream to) override
         {
             aligners[std::tuple<rs2_stream, rs2_stream>(from, to)] = align_cuda_helper();
@@ -23,9 +36,12 @@ namespace librealsense
 
         void align_z_to_other(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_stream_profile& other_profile, float z_scale) override
         {
-            uint8_t * aligned_data = reinterpret_cast<uint8_t *>(const_cast<void*>(aligned.get_data()));
             auto aligned_profile = aligned.get_profile().as<rs2::video_stream_profile>();
-            memset(aligned_data, 0, aligned_profile.height() * aligned_profile.width() * aligned.get_bytes_per_pixel());
+            size_t aligned_size = aligned_profile.height() * aligned_profile.width() * aligned.get_bytes_per_pixel();
+            auto d_aligned = static_cast<uint8_t *>(get_device_output(aligned, aligned_size));
+            uint8_t * aligned_data = nullptr;
+            if (!d_aligned)
+                aligned_data = reinterpret_cast<uint8_t *>(const_cast<void*>(aligned.get_data()));
 
             auto depth_profile = depth.get_profile().as<rs2::video_stream_profile>();
 
@@ -33,17 +49,30 @@ namespace librealsense
             auto other_intrin = other_profile.get_intrinsics();
             auto z_to_other = depth_profile.get_extrinsics_to(other_profile);
 
-            auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
+            // Only bring the depth to the host if it is not already on the device
+            auto d_z_pixels = static_cast<const uint16_t*>(get_device_data(depth));
+            auto z_pixels = d_z_pixels ? nullptr : reinterpret_cast<const uint16_t*>(depth.get_data());
             auto& aligner = aligners[std::tuple<rs2_stream, rs2_stream>(RS2_STREAM_DEPTH, other_profile.stream_type())];
-            aligner.align_depth_to_other(aligned_data, z_pixels, z_scale, z_intrin, z_to_other, other_intrin);
+            aligner.align_depth_to_other(aligned_data, z_pixels, z_scale, z_intrin, z_to_other, other_intrin, d_z_pixels, d_aligned);
+        }
+
+        // The kernel maps onto one image at a time
+        void align_z_to_others(std::vector<rs2::video_frame>& aligned, const rs2::video_frame& depth,
+                               const std::vector<rs2::video_stream_profile>& other_profiles, float z_scale) override
+        {
+            for (size_t i = 0; i < aligned.size(); ++i)
+                align_z_to_other(aligned[i], depth, other_profiles[i], z_scale);
         }
 
         void align_other_to_z(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_frame& other, float z_scale) override
         {
-            uint8_t * aligned_data = reinterpret_cast<uint8_t *>(const_cast<void*>(aligned.get_data()));
             auto aligned_profile = aligned.get_profile().as<rs2::video_stream_profile>();
-            memset(aligned_data, 0, aligned_profile.height() * aligned_profile.width() * aligned.get_bytes_per_pixel());
-            
+            size_t aligned_size = aligned_profile.height() * aligned_profile.width() * aligned.get_bytes_per_pixel();
+            auto d_aligned = static_cast<uint8_t *>(get_device_output(aligned, aligned_size));
+            uint8_t * aligned_data = nullptr;
+            if (!d_aligned)
+                aligned_data = reinterpret_cast<uint8_t *>(const_cast<void*>(aligned.get_data()));
+
             auto depth_profile = depth.get_profile().as<rs2::video_stream_profile>();
             auto other_profile = other.get_profile().as<rs2::video_stream_profile>();
 
@@ -51,12 +80,14 @@ namespace librealsense
             auto other_intrin = other_profile.get_intrinsics();
             auto z_to_other = depth_profile.get_extrinsics_to(other_profile);
 
-            auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
+            auto d_z_pixels = static_cast<const uint16_t*>(get_device_data(depth));
+            auto z_pixels = d_z_pixels ? nullptr : reinterpret_cast<const uint16_t*>(depth.get_data());
             auto other_pixels = reinterpret_cast<const uint8_t *>(other.get_data());
 
             auto& aligner = aligners[std::tuple<rs2_stream, rs2_stream>(other_profile.stream_type(), RS2_STREAM_DEPTH)];
             aligner.align_other_to_depth(
-                aligned_data, z_pixels, z_scale, z_intrin, z_to_other, other_intrin, other_pixels, other_profile.format(), other.get_bytes_per_pixel());
+                aligned_data, z_pixels, z_scale, z_intrin, z_to_other, other_intrin, other_pixels, other_profile.format(), other.get_bytes_per_pixel(),
+                d_z_pixels, d_aligned);
         }
 
     private:
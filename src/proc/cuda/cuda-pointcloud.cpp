@@ -2,10 +2,6 @@
 // Copyright(c) 2019 Intel Corporation. All Rights Reserved.
 #include "proc/cuda/cuda-pointcloud.h"
 
-#ifdef RS2_USE_CUDA
-#include "../../cuda/cuda-pointcloud.cuh"
-#endif
-
 namespace librealsense
 {
     pointcloud_cuda::pointcloud_cuda() : pointcloud("Pointcloud (CUDA)") {}
@@ -16,10 +12,12 @@ namespace librealsense
         const rs2::depth_frame& depth_frame)
     {
         auto image = output.get_vertices();
-        auto depth_data = (uint16_t*)depth_frame.get_data();
         auto depth_scale = depth_frame.get_units();
 #ifdef RS2_USE_CUDA
-        rscuda::deproject_depth_cuda((float*)image, depth_intrinsics, depth_data, depth_scale);
+        // Depth from a CUDA block (e.g., align) is read where it is, without a copy back to the host
+        auto device_depth = static_cast<const uint16_t*>(get_device_data(depth_frame));
+        auto depth_data = device_depth ? nullptr : (const uint16_t*)depth_frame.get_data();
+        _helper.deproject_depth((float*)image, depth_intrinsics, depth_data, depth_scale, device_depth);
 #endif
         return (float3*)image;
     }
@@ -4,6 +4,11 @@
 #pragma once
 #include "../pointcloud.h"
 
+#ifdef RS2_USE_CUDA
+#include "../../cuda/cuda-pointcloud.cuh"
+#include "../../cuda/cuda-frame.h"
+#endif
+
 namespace librealsense
 {
     class pointcloud_cuda : public pointcloud
@@ -15,5 +20,9 @@ namespace librealsense
             rs2::points output,
             const rs2_intrinsics &depth_intrinsics,
             const rs2::depth_frame& depth_frame) override;
+
+#ifdef RS2_USE_CUDA
+        rscuda::pointcloud_cuda_helper _helper;
+#endif
     };
 }
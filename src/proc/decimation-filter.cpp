@@ -12,9 +12,14 @@
 #include "core/video.h"
 #include "proc/synthetic-stream.h"
 #include "proc/decimation-filter.h"
+#include "latency-stats.h"
 
 #include <rsutils/string/from.h>
 
+#ifdef __SSSE3__
+#include <tmmintrin.h> // For SSSE3 intrinsics
+#endif
+
 
 #define PIX_SORT(a,b) { if ((a)>(b)) PIX_SWAP((a),(b)); }
 #define PIX_SWAP(a,b) { pixelvalue temp=(a);(a)=(b);(b)=temp; }
@@ -201,6 +206,13 @@ namespace librealsense
     const uint8_t decimation_default_val = 2;
     const uint8_t decimation_step = 1;    // Linear decimation
 
+    // Adaptive mode hysteresis: the scale goes up one step after a few frames find the stream's queues more than 3/4
+    // full, and back down one step only after a second's worth of frames find them less than 1/4 full
+    const unsigned adaptive_high_fill = 75;
+    const unsigned adaptive_low_fill = 25;
+    const uint16_t adaptive_up_frames = 3;
+    const uint16_t adaptive_down_frames = 30;
+
     decimation_filter::decimation_filter() :
         stream_filter_processing_block("Decimation Filter"),
         _decimation_factor(decimation_default_val),
@@ -212,7 +224,11 @@ namespace librealsense
         _padded_width(0),
         _padded_height(0),
         _recalc_profile(false),
-        _options_changed(false)
+        _options_changed(false),
+        _adaptive(false),
+        _adaptive_scale(decimation_default_val),
+        _pressed_frames(0),
+        _calm_frames(0)
     {
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
@@ -246,6 +262,25 @@ namespace librealsense
         });
 
         register_option(RS2_OPTION_FILTER_MAGNITUDE, decimation_control);
+
+        register_processing_threads_option();
+
+        auto adaptive = std::make_shared<ptr_option<bool>>(false, true, true, false, &_adaptive,
+            "Raise the scale, up to 8, while frames back up in the stream's queues, and lower it back once they drain");
+        adaptive->on_set([this](float val)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            // Start over from the scale that was asked
+            _adaptive_scale = _control_val;
+            _pressed_frames = _calm_frames = 0;
+            if (_patch_size != _control_val)
+            {
+                _patch_size = _decimation_factor = _control_val;
+                _kernel_size = _patch_size * _patch_size;
+                _options_changed = true;
+            }
+        });
+        register_option(RS2_OPTION_ADAPTIVE_DECIMATION, adaptive);
     }
 
     rs2::frame decimation_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -267,9 +302,16 @@ namespace librealsense
         {
             if (format == RS2_FORMAT_Z16)
             {
+#ifdef RS2_USE_CUDA
+                _cuda_helper.decimate_depth(static_cast<const uint16_t*>(src.get_data()),
+                    static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())),
+                    src.get_width(), src.get_height(), this->_patch_size,
+                    _real_width, _real_height, _padded_width, _padded_height);
+#else
                 decimate_depth(static_cast<const uint16_t*>(src.get_data()),
                     static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())),
                     src.get_width(), src.get_height(), this->_patch_size);
+#endif
             }
             else
             {
@@ -282,8 +324,56 @@ namespace librealsense
         return f;
     }
 
+    void decimation_filter::adapt_scale(const rs2::frame& f)
+    {
+        // The queues the frames go through, before and after the filter, report how full they are against the streams
+        auto & stats = f.get_profile().get()->profile->get_stats();
+        auto fill = stats.drops.queue_fill();
+        if (_target_stream_profile)
+            fill = std::max(fill, _target_stream_profile.get()->profile->get_stats().drops.queue_fill());
+
+        _adaptive_scale = std::max(_adaptive_scale, _control_val);
+        if (fill >= adaptive_high_fill)
+        {
+            _calm_frames = 0;
+            if (++_pressed_frames >= adaptive_up_frames)
+            {
+                _pressed_frames = 0;
+                if (_adaptive_scale < decimation_max_val)
+                    ++_adaptive_scale;
+            }
+        }
+        else if (fill <= adaptive_low_fill)
+        {
+            _pressed_frames = 0;
+            if (++_calm_frames >= adaptive_down_frames)
+            {
+                _calm_frames = 0;
+                if (_adaptive_scale > _control_val)
+                    --_adaptive_scale;
+            }
+        }
+        else
+            _pressed_frames = _calm_frames = 0;  // Hold the scale in between
+
+        if (_adaptive_scale != _patch_size)
+        {
+            _patch_size = _decimation_factor = _adaptive_scale;
+            _kernel_size = _patch_size * _patch_size;
+            _options_changed = true;
+        }
+
+        if (_adaptive_scale > _control_val)
+            stats.drops.decimated(_adaptive_scale);
+        else
+            stats.drops.decimation_scale(_adaptive_scale);
+    }
+
     void  decimation_filter::update_output_profile(const rs2::frame& f)
     {
+        if (_adaptive)
+            adapt_scale(f);
+
         if (_options_changed || f.get_profile().get() != _source_stream_profile.get())
         {
             _options_changed = false;
@@ -373,19 +463,129 @@ namespace librealsense
         return ret;
     }
 
+    // Mean of the non-zero values in each SxS block; same results as decimate_depth_rows() with the same scale, but
+    // with the block size known at compile time so the loops over it unroll
+    template<size_t S>
+    void decimation_filter::decimate_depth_mean(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+        size_t width_in, size_t row_begin, size_t row_end)
+    {
+        for (size_t j = row_begin; j < row_end; j++)
+        {
+            const uint16_t * block = frame_data_in + S * j * width_in;
+            uint16_t * out = frame_data_out + j * _padded_width;
+            for (size_t i = 0; i < _real_width; i++, block += S)
+            {
+                int sum = 0;
+                int counter = 0;
+                for (size_t n = 0; n < S; ++n)
+                {
+                    const uint16_t * p = block + n * width_in;
+                    for (size_t m = 0; m < S; ++m)
+                    {
+                        sum += p[m];
+                        counter += (p[m] != 0);
+                    }
+                }
+                out[i] = uint16_t(counter == 0 ? 0 : sum / counter);
+            }
+
+            // Fill-in the padded colums with zeros
+            std::fill(out + _real_width, out + _padded_width, uint16_t(0));
+        }
+    }
+
     void decimation_filter::decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
         size_t width_in, size_t height_in, size_t scale)
+    {
+        // Output rows only depend on their own block of input rows, so they can be split between threads
+        auto decimate = [&](size_t row_begin, size_t row_end)
+        {
+            if (scale == 2)
+                decimate_depth_median2(frame_data_in, frame_data_out, width_in, row_begin, row_end);
+            else if (scale == 4)
+                decimate_depth_mean<4>(frame_data_in, frame_data_out, width_in, row_begin, row_end);
+            else
+                decimate_depth_rows(frame_data_in, frame_data_out, width_in, scale, row_begin, row_end);
+        };
+        for_each_range(_real_height, decimate);
+
+        // Fill-in the padded rows with zeros
+        std::fill(frame_data_out + size_t(_real_height) * _padded_width,
+                  frame_data_out + size_t(_padded_height) * _padded_width, uint16_t(0));
+    }
+
+    // Median of the non-zero values in each 2x2 block, picking the lower of the two middle values when there is an
+    // even number of them; same results as decimate_depth_rows() with scale 2
+    //
+    // Zeros are mapped to the largest value (v - 1, wrapping), so that a sorting network leaves the valid values
+    // first: with at most one zero the answer is the second-smallest value, otherwise the smallest, which for an
+    // all-zero block maps back to 0.
+    void decimation_filter::decimate_depth_median2(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+        size_t width_in, size_t row_begin, size_t row_end)
+    {
+        for (size_t j = row_begin; j < row_end; j++)
+        {
+            const uint16_t * r0 = frame_data_in + 2 * j * width_in;
+            const uint16_t * r1 = r0 + width_in;
+            uint16_t * out = frame_data_out + j * _padded_width;
+            size_t i = 0;
+
+#ifdef __SSSE3__
+            // Signed 16-bit min/max are all SSE2 has, so values are also biased by 0x8000
+            const __m128i bias = _mm_set1_epi16(short(0x7fff));  // (v - 1) ^ 0x8000 == v + 0x7fff
+            const __m128i none = _mm_set1_epi16(short(0x7fff));  // a zero, mapped
+            auto split = [](__m128i lo, __m128i hi, __m128i & even, __m128i & odd)
+            {
+                even = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+                odd = _mm_packs_epi32(_mm_srai_epi32(lo, 16), _mm_srai_epi32(hi, 16));
+            };
+            for (; i + 8 <= _real_width; i += 8)
+            {
+                __m128i a, b, c, d;
+                split(_mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(r0 + 2 * i)), bias),
+                      _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(r0 + 2 * i + 8)), bias), a, b);
+                split(_mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(r1 + 2 * i)), bias),
+                      _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(r1 + 2 * i + 8)), bias), c, d);
+
+                __m128i l1 = _mm_min_epi16(a, b), h1 = _mm_max_epi16(a, b);
+                __m128i l2 = _mm_min_epi16(c, d), h2 = _mm_max_epi16(c, d);
+                __m128i s0 = _mm_min_epi16(l1, l2), m = _mm_max_epi16(l1, l2), n = _mm_min_epi16(h1, h2);
+                __m128i s1 = _mm_min_epi16(m, n), s2 = _mm_max_epi16(m, n);
+
+                __m128i few = _mm_cmpeq_epi16(s2, none);  // two zeros or more
+                __m128i med = _mm_or_si128(_mm_and_si128(few, s0), _mm_andnot_si128(few, s1));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_sub_epi16(med, bias));
+            }
+#endif
+            for (; i < _real_width; i++)
+            {
+                uint16_t a = r0[2 * i] - 1, b = r0[2 * i + 1] - 1, c = r1[2 * i] - 1, d = r1[2 * i + 1] - 1;
+                if (a > b) std::swap(a, b);
+                if (c > d) std::swap(c, d);
+                uint16_t s0 = std::min(a, c), m = std::max(a, c), n = std::min(b, d);
+                uint16_t s1 = std::min(m, n), s2 = std::max(m, n);
+                out[i] = uint16_t((s2 == uint16_t(0xffff) ? s0 : s1) + 1);
+            }
+
+            // Fill-in the padded colums with zeros
+            std::fill(out + _real_width, out + _padded_width, uint16_t(0));
+        }
+    }
+
+    void decimation_filter::decimate_depth_rows(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+        size_t width_in, size_t scale, size_t row_begin, size_t row_end)
     {
         // Use median filtering
         std::vector<uint16_t> working_kernel(_kernel_size);
         auto wk_begin = working_kernel.data();
         auto wk_itr = wk_begin;
         std::vector<uint16_t*> pixel_raws(scale);
-        uint16_t* block_start = const_cast<uint16_t*>(frame_data_in);
+        uint16_t* block_start = const_cast<uint16_t*>(frame_data_in) + row_begin * scale * width_in;
+        frame_data_out += row_begin * _padded_width;
 
         if (scale == 2 || scale == 3)
         {
-            for (int j = 0; j < _real_height; j++)
+            for (size_t j = row_begin; j < row_end; j++)
             {
                 uint16_t *p{};
                 // Mark the beginning of each of the N lines that the filter will run upon
@@ -457,7 +657,7 @@ namespace librealsense
         }
         else
         {
-            for (int j = 0; j < _real_height; j++)
+            for (size_t j = row_begin; j < row_end; j++)
             {
                 uint16_t *p{};
                 // Mark the beginning of each of the N lines that the filter will run upon
@@ -495,13 +695,6 @@ namespace librealsense
                 block_start += width_in * scale;
             }
         }
-
-        // Fill-in the padded rows with zeros
-        for (auto v = _real_height; v < _padded_height; ++v)
-        {
-            for (auto u = 0; u < _padded_width; ++u)
-                *frame_data_out++ = 0;
-        }
     }
 
     void decimation_filter::decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
@@ -6,6 +6,11 @@
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 #include "proc/synthetic-stream.h"
+#include "worker-pool.h"
+
+#ifdef RS2_USE_CUDA
+#include "../cuda/cuda-depth-filters.cuh"
+#endif
 
 namespace librealsense
 {
@@ -21,12 +26,24 @@ namespace librealsense
         void decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
             size_t width_in, size_t height_in, size_t scale);
 
+        // Decimate output rows [row_begin, row_end), including their padding columns
+        void decimate_depth_rows(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+            size_t width_in, size_t scale, size_t row_begin, size_t row_end);
+        void decimate_depth_median2(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+            size_t width_in, size_t row_begin, size_t row_end);
+        template<size_t S>
+        void decimate_depth_mean(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+            size_t width_in, size_t row_begin, size_t row_end);
+
         void decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
             size_t width_in, size_t height_in, size_t scale);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
     private:
+        friend class depth_postprocess;  // uses the kernels and the output profile
         void    update_output_profile(const rs2::frame& f);
+        // Adaptive mode: step the scale with the backpressure on the stream's queues
+        void    adapt_scale(const rs2::frame& f);
 
         uint8_t                 _decimation_factor;
         uint8_t                 _control_val;
@@ -41,6 +58,13 @@ namespace librealsense
         uint16_t                _padded_height;
         bool                    _recalc_profile;
         bool                    _options_changed;   // Tracking changes imposed by user
+        bool                    _adaptive;
+        uint8_t                 _adaptive_scale;    // At least _control_val, while in adaptive mode
+        uint16_t                _pressed_frames;    // Consecutive frames over the high watermark
+        uint16_t                _calm_frames;       // Consecutive frames under the low watermark
+#ifdef RS2_USE_CUDA
+        rscuda::decimation_cuda_helper _cuda_helper;
+#endif
     };
     MAP_EXTENSION(RS2_EXTENSION_DECIMATION_FILTER, librealsense::decimation_filter);
 }
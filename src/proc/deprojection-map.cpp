@@ -0,0 +1,91 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "deprojection-map.h"
+
+#include <cstring>
+#include <map>
+#include <mutex>
+
+
+namespace librealsense {
+
+
+namespace {
+
+struct map_key
+{
+    rs2_intrinsics intrinsics;
+    float offset;
+
+    bool operator<( map_key const & other ) const
+    {
+        // All 4-byte fields, so there is no padding to compare
+        return std::memcmp( this, &other, sizeof( map_key ) ) < 0;
+    }
+};
+
+void compute( deprojection_map & map, rs2_intrinsics const & intrin, float offset )
+{
+    map.x.resize( size_t( intrin.width ) * intrin.height );
+    map.y.resize( size_t( intrin.width ) * intrin.height );
+
+    for( int h = 0; h < intrin.height; ++h )
+    {
+        for( int w = 0; w < intrin.width; ++w )
+        {
+            float x = ( w + offset - intrin.ppx ) / intrin.fx;
+            float y = ( h + offset - intrin.ppy ) / intrin.fy;
+
+            if( intrin.model == RS2_DISTORTION_INVERSE_BROWN_CONRADY )
+            {
+                float r2 = x * x + y * y;
+                float f = 1 + intrin.coeffs[0] * r2 + intrin.coeffs[1] * r2 * r2 + intrin.coeffs[4] * r2 * r2 * r2;
+                float ux = x * f + 2 * intrin.coeffs[2] * x * y + intrin.coeffs[3] * ( r2 + 2 * x * x );
+                float uy = y * f + 2 * intrin.coeffs[3] * x * y + intrin.coeffs[2] * ( r2 + 2 * y * y );
+                x = ux;
+                y = uy;
+            }
+
+            map.x[h * intrin.width + w] = x;
+            map.y[h * intrin.width + w] = y;
+        }
+    }
+}
+
+}  // namespace
+
+
+std::shared_ptr< const deprojection_map > get_deprojection_map( rs2_intrinsics const & intrin, float offset )
+{
+    static std::mutex the_mutex;
+    static std::map< map_key, std::weak_ptr< const deprojection_map > > the_maps;
+
+    map_key key;
+    std::memset( &key, 0, sizeof( key ) );
+    key.intrinsics = intrin;
+    key.offset = offset;
+
+    std::lock_guard< std::mutex > lock( the_mutex );
+    auto & entry = the_maps[key];
+    if( auto map = entry.lock() )
+        return map;
+
+    // Computed under the lock: the others asking for it would only wait for the same map anyway
+    auto map = std::make_shared< deprojection_map >();
+    compute( *map, intrin, offset );
+    entry = map;
+
+    // Drop what nobody holds anymore
+    for( auto it = the_maps.begin(); it != the_maps.end(); )
+    {
+        if( it->second.expired() )
+            it = the_maps.erase( it );
+        else
+            ++it;
+    }
+    return map;
+}
+
+
+}  // namespace librealsense
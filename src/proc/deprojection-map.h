@@ -0,0 +1,32 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_types.h>
+
+#include <memory>
+#include <vector>
+
+
+namespace librealsense {
+
+
+// The normalized (z=1) ray of every pixel of an image, undistorted, as the SSE pointcloud and align precompute them:
+// a point at depth z of pixel i is at (x[i]*z, y[i]*z, z). The offset is added to the pixel coordinates, for the
+// corners rather than the centers of the pixels.
+//
+struct deprojection_map
+{
+    std::vector< float > x;
+    std::vector< float > y;
+};
+
+
+// Maps are shared by every instance that asks for the same intrinsics and offset, so several pointclouds or aligns of
+// the same stream compute and keep only one. A map lives as long as someone holds it; the next to ask for it after
+// that computes it again.
+std::shared_ptr< const deprojection_map > get_deprojection_map( rs2_intrinsics const &, float offset = 0 );
+
+
+}  // namespace librealsense
@@ -4,10 +4,20 @@
 #include "depth-formats-converter.h"
 
 #include "stream.h"
+#include "image-avx.h"
+#include "cpu-features.h"
 
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
 #endif
+#ifdef __SSSE3__
+#include <tmmintrin.h> // For SSSE3 intrinsics
+#endif
+#if defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#include <arm_neon.h>
+#endif
+
+#include <thread>
 
 namespace librealsense
 {
@@ -22,7 +32,8 @@ namespace librealsense
 #else
         for (int i = 0; i < count; ++i) *out_ir++ = *in++ >> 2;
 #endif
-        std::memcpy( dest[0], in, count * 2 );
+        if( dest[0] )  // otherwise, a view of the source
+            std::memcpy( dest[0], in, count * 2 );
     }
 
     void unpack_z16_y16_from_sr300_inzi( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
@@ -36,7 +47,8 @@ namespace librealsense
 #else
         for (int i = 0; i < count; ++i) *out_ir++ = *in++ << 6;
 #endif
-        std::memcpy( dest[0], in, count * 2 );
+        if( dest[0] )  // otherwise, a view of the source
+            std::memcpy( dest[0], in, count * 2 );
     }
 
     void unpack_inzi(rs2_format dst_ir_format, uint8_t * const d[], const uint8_t * s, int width, int height, int actual_size)
@@ -86,12 +98,65 @@ namespace librealsense
         std::memcpy( dest[0], source, size_t( 5.0 * ( count / 4.0 ) ) );
     }
 
+    // Unpacks the first blocks of a W10 image with SIMD, returning how many were done. Each 5-byte block holds the 8
+    // MSBs of 4 pixels, then their 2 LSBs: the MSBs go to the high byte of each output word, and the LSBs byte, shifted
+    // so the pixel's own 2 bits land on bits 6-7, to the low byte. The loads read past the blocks they convert, so the
+    // last few blocks are always left to the caller.
+    static int unpack_y10bpack_simd( uint16_t * to, const uint8_t * from, int count )
+    {
+        int i = 0;
+#if defined RS2_AVX2_UNPACK
+        if (get_simd_level() >= simd_level::avx2)
+            return unpack_y10bpack_avx(to, from, count);
+#endif
+#if defined __SSSE3__
+        if (get_simd_level() >= simd_level::simd128)
+        {
+            const __m128i shuffle = _mm_setr_epi8(4, 0, 4, 1, 4, 2, 4, 3, 9, 5, 9, 6, 9, 7, 9, 8);
+            const __m128i lsb_shift = _mm_setr_epi16(64, 16, 4, 1, 64, 16, 4, 1);
+            const __m128i msb_mask = _mm_set1_epi16(short(0xFF00));
+            const __m128i lsb_mask = _mm_set1_epi16(0x00C0);
+            for (; i + 4 <= count; i += 2, from += 10, to += 8)
+            {
+                __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)from), shuffle);
+                __m128i lsb = _mm_and_si128(_mm_mullo_epi16(v, lsb_shift), lsb_mask);
+                _mm_storeu_si128((__m128i *)to, _mm_or_si128(_mm_and_si128(v, msb_mask), lsb));
+            }
+        }
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+        if (get_simd_level() >= simd_level::simd128)
+        {
+            static const uint8_t msb_index[8] = { 0, 1, 2, 3, 5, 6, 7, 8 };
+            static const uint8_t lsb_index[8] = { 4, 4, 4, 4, 9, 9, 9, 9 };
+            static const int8_t lsb_shift[8] = { 6, 4, 2, 0, 6, 4, 2, 0 };
+            const uint8x8_t msb_idx = vld1_u8(msb_index);
+            const uint8x8_t lsb_idx = vld1_u8(lsb_index);
+            const int8x8_t shift = vld1_s8(lsb_shift);
+            const uint8x8_t lsb_mask = vdup_n_u8(0xC0);
+            for (; i + 4 <= count; i += 2, from += 10, to += 8)
+            {
+                uint8x16_t const v = vld1q_u8(from);
+                uint8x8x2_t const table = { { vget_low_u8(v), vget_high_u8(v) } };
+                uint8x8x2_t const out = { { vand_u8(vshl_u8(vtbl2_u8(table, lsb_idx), shift), lsb_mask),
+                                            vtbl2_u8(table, msb_idx) } };
+                vst2_u8((uint8_t *)to, out);  // little-endian words
+            }
+        }
+#endif
+        return i;
+    }
+
     void unpack_y10bpack( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
     {
         auto count = width * height / 4; // num of pixels
         uint8_t  * from = (uint8_t*)(source);
         uint16_t * to = (uint16_t*)(dest[0]);
 
+        auto const done = unpack_y10bpack_simd(to, from, count);
+        count -= done;
+        from += done * 5;
+        to += done * 4;
+
         // Put the 10 bit into the msb of uint16_t
         for (int i = 0; i < count; i++, from += 5) // traverse macro-pixels
         {
@@ -131,16 +196,48 @@ namespace librealsense
         unpack_inzi(_right_target_format, dest, source, width, height, actual_size);
     }
 
+    bool inzi_converter::output_in_source(int output, int width, int height, size_t & offset) const
+    {
+        // The depth is the second half of the source, after the infrared
+        offset = size_t(width) * height * 2;
+        return output == 0;
+    }
+
     void invi_converter::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
     {
         unpack_invi(_target_format, dest, source, width, height, actual_size);
     }
 
     w10_converter::w10_converter(const char * name, const rs2_format& target_format) :
-        functional_processing_block(name, target_format, RS2_STREAM_INFRARED, RS2_EXTENSION_VIDEO_FRAME) {}
+        functional_processing_block(name, target_format, RS2_STREAM_INFRARED, RS2_EXTENSION_VIDEO_FRAME)
+    {
+        register_processing_threads_option();
+    }
+
+    bool w10_converter::output_in_source(int width, int height, size_t & offset) const
+    {
+        // RAW10 is the W10 data as is
+        offset = 0;
+        return _target_format == RS2_FORMAT_RAW10 || _target_format == RS2_FORMAT_W10;
+    }
 
     void w10_converter::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
     {
-        unpack_w10(_target_format, dest, source, width, height, actual_size);
+        // Lines are whole 5-byte blocks when the width is a multiple of 4
+        if (_threads <= 1 || width % 4)
+        {
+            unpack_w10(_target_format, dest, source, width, height, actual_size);
+            return;
+        }
+
+        size_t const src_line = width / 4 * 5;
+        size_t const dst_line = _target_format == RS2_FORMAT_Y10BPACK ? width * 2 : src_line;
+
+        for_each_range(height, [&](size_t begin, size_t end)
+        {
+            uint8_t * planes[1] = { dest[0] + begin * dst_line };
+            int const lines = int(end - begin);
+            unpack_w10(_target_format, planes, source + begin * src_line, width, lines, int(lines * dst_line));
+        });
     }
 }
@@ -6,6 +6,7 @@
 #include "synthetic-stream.h"
 #include "option.h"
 #include "image.h"
+#include "worker-pool.h"
 
 namespace librealsense
 {
@@ -18,6 +19,7 @@ namespace librealsense
     protected:
         inzi_converter(const char* name, rs2_format target_ir_format);
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
+        bool output_in_source(int output, int width, int height, size_t & offset) const override;
     };
 
     class invi_converter : public functional_processing_block
@@ -41,5 +43,6 @@ namespace librealsense
     protected:
         w10_converter(const char* name, const rs2_format& target_format);
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
+        bool output_in_source(int width, int height, size_t & offset) const override;
     };
 }
@@ -0,0 +1,97 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "depth-kernels.h"
+
+#if defined(__SSSE3__) && defined(__AVX2__)
+#include <immintrin.h>
+#include <cfloat>
+
+namespace librealsense
+{
+    // Depth -> float, for the 8 pixels at p
+    static inline __m256 load_depth( const uint16_t * p )
+    {
+        return _mm256_cvtepi32_ps( _mm256_cvtepu16_epi32( _mm_loadu_si128( reinterpret_cast< const __m128i * >( p ) ) ) );
+    }
+
+    size_t threshold_depth_avx2( const uint16_t * in, uint16_t * out, size_t count, float units, float min, float max )
+    {
+        auto const scale = _mm256_set1_ps( units );
+        auto const lo_limit = _mm256_set1_ps( min );
+        auto const hi_limit = _mm256_set1_ps( max );
+        auto const zero = _mm256_setzero_si256();
+        size_t i = 0;
+        for( ; i + 16 <= count; i += 16 )
+        {
+            auto const d = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( in + i ) );
+            // The unpacks and the pack below both work within 128-bit lanes, so the masks come back in pixel order
+            auto const lo = _mm256_mul_ps( _mm256_cvtepi32_ps( _mm256_unpacklo_epi16( d, zero ) ), scale );
+            auto const hi = _mm256_mul_ps( _mm256_cvtepi32_ps( _mm256_unpackhi_epi16( d, zero ) ), scale );
+            auto const keep_lo = _mm256_and_ps( _mm256_cmp_ps( lo, lo_limit, _CMP_GE_OQ ), _mm256_cmp_ps( lo, hi_limit, _CMP_LE_OQ ) );
+            auto const keep_hi = _mm256_and_ps( _mm256_cmp_ps( hi, lo_limit, _CMP_GE_OQ ), _mm256_cmp_ps( hi, hi_limit, _CMP_LE_OQ ) );
+            auto const keep = _mm256_packs_epi32( _mm256_castps_si256( keep_lo ), _mm256_castps_si256( keep_hi ) );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( out + i ), _mm256_and_si256( d, keep ) );
+        }
+        return i;
+    }
+
+    size_t depth_to_meters_avx2( const uint16_t * depth, size_t count, float units, float * meters )
+    {
+        auto const scale = _mm256_set1_ps( units );
+        size_t i = 0;
+        for( ; i + 8 <= count; i += 8 )
+            _mm256_storeu_ps( meters + i, _mm256_mul_ps( load_depth( depth + i ), scale ) );
+        return i;
+    }
+
+    size_t depth_to_disparity_avx2( const uint16_t * depth, float * disparity, size_t count, float d2d_convert_factor )
+    {
+        auto const factor = _mm256_set1_ps( d2d_convert_factor );
+        auto const two = _mm256_set1_ps( 2.f );
+        auto const zero = _mm256_setzero_ps();
+        size_t i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            auto const d = load_depth( depth + i );
+            // One Newton-Raphson step: r' = r * (2 - d * r)
+            auto r = _mm256_rcp_ps( d );
+            r = _mm256_mul_ps( r, _mm256_sub_ps( two, _mm256_mul_ps( d, r ) ) );
+            // Zero depth gives NaN above, and no disparity
+            auto const valid = _mm256_cmp_ps( d, zero, _CMP_NEQ_OQ );
+            _mm256_storeu_ps( disparity + i, _mm256_and_ps( _mm256_mul_ps( r, factor ), valid ) );
+        }
+        return i;
+    }
+
+    size_t disparity_to_depth_avx2( const float * disparity, uint16_t * depth, size_t count, float d2d_convert_factor )
+    {
+        auto const factor = _mm256_set1_ps( d2d_convert_factor );
+        auto const half = _mm256_set1_ps( 0.5f );
+        auto const abs_mask = _mm256_castsi256_ps( _mm256_set1_epi32( 0x7fffffff ) );
+        auto const min_normal = _mm256_set1_ps( FLT_MIN );
+        auto const max_normal = _mm256_set1_ps( FLT_MAX );
+        auto const low_word = _mm256_set1_epi32( 0xffff );
+
+        // Like static_cast< uint16_t >( float ) does: truncate to int, keep the low 16 bits; 0 unless std::isnormal()
+        auto const convert = [&]( __m256 x ) {
+            auto const a = _mm256_and_ps( x, abs_mask );
+            auto const normal = _mm256_and_ps( _mm256_cmp_ps( a, min_normal, _CMP_GE_OQ ), _mm256_cmp_ps( a, max_normal, _CMP_LE_OQ ) );
+            auto const v = _mm256_cvttps_epi32( _mm256_add_ps( _mm256_div_ps( factor, x ), half ) );
+            return _mm256_and_si256( _mm256_and_si256( v, low_word ), _mm256_castps_si256( normal ) );
+        };
+
+        size_t i = 0;
+        for( ; i + 16 <= count; i += 16 )
+        {
+            auto const lo = convert( _mm256_loadu_ps( disparity + i ) );
+            auto const hi = convert( _mm256_loadu_ps( disparity + i + 8 ) );
+            // The pack interleaves the 128-bit lanes of lo and hi; put them back in order
+            auto const packed = _mm256_permute4x64_epi64( _mm256_packus_epi32( lo, hi ), 0xD8 );
+            _mm256_storeu_si256( reinterpret_cast< __m256i * >( depth + i ), packed );
+        }
+        return i;
+    }
+}
+
+#endif
@@ -0,0 +1,326 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "depth-kernels.h"
+#include "../cpu-features.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#ifdef __SSSE3__
+#include <tmmintrin.h> // For SSSE3 intrinsics
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#include <arm_neon.h>
+#endif
+
+
+namespace librealsense
+{
+#ifdef __SSSE3__
+
+    static size_t threshold_depth_simd128( const uint16_t * in, uint16_t * out, size_t count, float units, float min, float max )
+    {
+        auto const scale = _mm_set1_ps( units );
+        auto const lo_limit = _mm_set1_ps( min );
+        auto const hi_limit = _mm_set1_ps( max );
+        auto const zero = _mm_setzero_si128();
+        size_t i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            auto const d = _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + i ) );
+            auto const lo = _mm_mul_ps( _mm_cvtepi32_ps( _mm_unpacklo_epi16( d, zero ) ), scale );
+            auto const hi = _mm_mul_ps( _mm_cvtepi32_ps( _mm_unpackhi_epi16( d, zero ) ), scale );
+            auto const keep_lo = _mm_and_ps( _mm_cmpge_ps( lo, lo_limit ), _mm_cmple_ps( lo, hi_limit ) );
+            auto const keep_hi = _mm_and_ps( _mm_cmpge_ps( hi, lo_limit ), _mm_cmple_ps( hi, hi_limit ) );
+            auto const keep = _mm_packs_epi32( _mm_castps_si128( keep_lo ), _mm_castps_si128( keep_hi ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i ), _mm_and_si128( d, keep ) );
+        }
+        return i;
+    }
+
+    static size_t depth_to_meters_simd128( const uint16_t * depth, size_t count, float units, float * meters )
+    {
+        auto const scale = _mm_set1_ps( units );
+        auto const zero = _mm_setzero_si128();
+        size_t i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            auto const d = _mm_loadu_si128( reinterpret_cast< const __m128i * >( depth + i ) );
+            _mm_storeu_ps( meters + i, _mm_mul_ps( _mm_cvtepi32_ps( _mm_unpacklo_epi16( d, zero ) ), scale ) );
+            _mm_storeu_ps( meters + i + 4, _mm_mul_ps( _mm_cvtepi32_ps( _mm_unpackhi_epi16( d, zero ) ), scale ) );
+        }
+        return i;
+    }
+
+    static size_t depth_to_disparity_simd128( const uint16_t * depth, float * disparity, size_t count, float d2d_convert_factor )
+    {
+        auto const factor = _mm_set1_ps( d2d_convert_factor );
+        auto const two = _mm_set1_ps( 2.f );
+        auto const zero = _mm_setzero_si128();
+
+        // One Newton-Raphson step: r' = r * (2 - d * r); zero depth gives NaN, and no disparity
+        auto const convert = [&]( __m128 d ) {
+            auto r = _mm_rcp_ps( d );
+            r = _mm_mul_ps( r, _mm_sub_ps( two, _mm_mul_ps( d, r ) ) );
+            return _mm_and_ps( _mm_mul_ps( r, factor ), _mm_cmpneq_ps( d, _mm_setzero_ps() ) );
+        };
+
+        size_t i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            auto const d = _mm_loadu_si128( reinterpret_cast< const __m128i * >( depth + i ) );
+            _mm_storeu_ps( disparity + i, convert( _mm_cvtepi32_ps( _mm_unpacklo_epi16( d, zero ) ) ) );
+            _mm_storeu_ps( disparity + i + 4, convert( _mm_cvtepi32_ps( _mm_unpackhi_epi16( d, zero ) ) ) );
+        }
+        return i;
+    }
+
+    static size_t disparity_to_depth_simd128( const float * disparity, uint16_t * depth, size_t count, float d2d_convert_factor )
+    {
+        auto const factor = _mm_set1_ps( d2d_convert_factor );
+        auto const half = _mm_set1_ps( 0.5f );
+        auto const abs_mask = _mm_castsi128_ps( _mm_set1_epi32( 0x7fffffff ) );
+        auto const min_normal = _mm_set1_ps( FLT_MIN );
+        auto const max_normal = _mm_set1_ps( FLT_MAX );
+        // Gathers the low words of four ints into the low half of the vector (SSE4.1 would be needed to pack them)
+        auto const low_words = _mm_setr_epi8( 0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1 );
+
+        // Like static_cast< uint16_t >( float ) does: truncate to int, keep the low 16 bits; 0 unless std::isnormal()
+        auto const convert = [&]( __m128 x ) {
+            auto const a = _mm_and_ps( x, abs_mask );
+            auto const normal = _mm_and_ps( _mm_cmpge_ps( a, min_normal ), _mm_cmple_ps( a, max_normal ) );
+            auto const v = _mm_cvttps_epi32( _mm_add_ps( _mm_div_ps( factor, x ), half ) );
+            return _mm_shuffle_epi8( _mm_and_si128( v, _mm_castps_si128( normal ) ), low_words );
+        };
+
+        size_t i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            auto const lo = convert( _mm_loadu_ps( disparity + i ) );
+            auto const hi = convert( _mm_loadu_ps( disparity + i + 4 ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( depth + i ), _mm_unpacklo_epi64( lo, hi ) );
+        }
+        return i;
+    }
+
+    // factor / x + 0.5, truncated and saturated to 16 bits, on four pixels; 0 where x is 0
+    static __m128i divide_to_u16( __m128 x, __m128 factor )
+    {
+        auto const q = _mm_min_ps( _mm_add_ps( _mm_div_ps( factor, x ), _mm_set1_ps( 0.5f ) ), _mm_set1_ps( 65535.f ) );
+        auto const v = _mm_and_si128( _mm_cvttps_epi32( q ), _mm_castps_si128( _mm_cmpneq_ps( x, _mm_setzero_ps() ) ) );
+        // Gathers the low words of four ints into the low half of the vector (SSE4.1 would be needed to pack them)
+        return _mm_shuffle_epi8( v, _mm_setr_epi8( 0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1 ) );
+    }
+
+    // For both depth_to_disparity16() and disparity16_to_depth(), which are the same division
+    static size_t divide_u16_simd128( const uint16_t * in, uint16_t * out, size_t count, float d2d_convert_factor )
+    {
+        auto const factor = _mm_set1_ps( d2d_convert_factor );
+        auto const zero = _mm_setzero_si128();
+        size_t i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            auto const d = _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + i ) );
+            auto const lo = divide_to_u16( _mm_cvtepi32_ps( _mm_unpacklo_epi16( d, zero ) ), factor );
+            auto const hi = divide_to_u16( _mm_cvtepi32_ps( _mm_unpackhi_epi16( d, zero ) ), factor );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( out + i ), _mm_unpacklo_epi64( lo, hi ) );
+        }
+        return i;
+    }
+
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+
+    static size_t threshold_depth_simd128( const uint16_t * in, uint16_t * out, size_t count, float units, float min, float max )
+    {
+        auto const lo_limit = vdupq_n_f32( min );
+        auto const hi_limit = vdupq_n_f32( max );
+        auto const keep = [&]( uint16x4_t d ) {
+            auto const dist = vmulq_n_f32( vcvtq_f32_u32( vmovl_u16( d ) ), units );
+            return vmovn_u32( vandq_u32( vcgeq_f32( dist, lo_limit ), vcleq_f32( dist, hi_limit ) ) );
+        };
+        size_t i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            auto const d = vld1q_u16( in + i );
+            vst1q_u16( out + i, vandq_u16( d, vcombine_u16( keep( vget_low_u16( d ) ), keep( vget_high_u16( d ) ) ) ) );
+        }
+        return i;
+    }
+
+    static size_t depth_to_meters_simd128( const uint16_t * depth, size_t count, float units, float * meters )
+    {
+        size_t i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            auto const d = vld1q_u16( depth + i );
+            vst1q_f32( meters + i, vmulq_n_f32( vcvtq_f32_u32( vmovl_u16( vget_low_u16( d ) ) ), units ) );
+            vst1q_f32( meters + i + 4, vmulq_n_f32( vcvtq_f32_u32( vmovl_u16( vget_high_u16( d ) ) ), units ) );
+        }
+        return i;
+    }
+
+    static size_t depth_to_disparity_simd128( const uint16_t * depth, float * disparity, size_t count, float d2d_convert_factor )
+    {
+        // The NEON estimate is only good to ~8 bits, so it takes two Newton-Raphson steps to match SSE's one
+        auto const convert = [&]( uint16x4_t d16 ) {
+            auto const d = vcvtq_f32_u32( vmovl_u16( d16 ) );
+            auto r = vrecpeq_f32( d );
+            r = vmulq_f32( r, vrecpsq_f32( d, r ) );
+            r = vmulq_f32( r, vrecpsq_f32( d, r ) );
+            auto const valid = vtstq_u32( vmovl_u16( d16 ), vmovl_u16( d16 ) );
+            return vreinterpretq_f32_u32( vandq_u32( vreinterpretq_u32_f32( vmulq_n_f32( r, d2d_convert_factor ) ), valid ) );
+        };
+        size_t i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            auto const d = vld1q_u16( depth + i );
+            vst1q_f32( disparity + i, convert( vget_low_u16( d ) ) );
+            vst1q_f32( disparity + i + 4, convert( vget_high_u16( d ) ) );
+        }
+        return i;
+    }
+
+    static size_t disparity_to_depth_simd128( const float * disparity, uint16_t * depth, size_t count, float d2d_convert_factor )
+    {
+        size_t i = 0;
+#if defined( __aarch64__ )  // vector division is only available on 64-bit ARM
+        auto const factor = vdupq_n_f32( d2d_convert_factor );
+        auto const min_normal = vdupq_n_f32( FLT_MIN );
+        auto const max_normal = vdupq_n_f32( FLT_MAX );
+        // Truncate to int, keep the low 16 bits; 0 unless std::isnormal()
+        auto const convert = [&]( float32x4_t x ) {
+            auto const a = vabsq_f32( x );
+            auto const normal = vandq_u32( vcgeq_f32( a, min_normal ), vcleq_f32( a, max_normal ) );
+            auto const v = vreinterpretq_u32_s32( vcvtq_s32_f32( vaddq_f32( vdivq_f32( factor, x ), vdupq_n_f32( 0.5f ) ) ) );
+            return vmovn_u32( vandq_u32( v, normal ) );
+        };
+        for( ; i + 8 <= count; i += 8 )
+            vst1q_u16( depth + i, vcombine_u16( convert( vld1q_f32( disparity + i ) ), convert( vld1q_f32( disparity + i + 4 ) ) ) );
+#endif
+        return i;
+    }
+
+    // For both depth_to_disparity16() and disparity16_to_depth(), which are the same division
+    static size_t divide_u16_simd128( const uint16_t * in, uint16_t * out, size_t count, float d2d_convert_factor )
+    {
+        size_t i = 0;
+#if defined( __aarch64__ )  // vector division is only available on 64-bit ARM
+        auto const factor = vdupq_n_f32( d2d_convert_factor );
+        // vcvtq_u32_f32() and vqmovn_u32() both saturate, so there is no clamping to do
+        auto const convert = [&]( uint16x4_t d16 ) {
+            auto const x = vcvtq_f32_u32( vmovl_u16( d16 ) );
+            auto const v = vcvtq_u32_f32( vaddq_f32( vdivq_f32( factor, x ), vdupq_n_f32( 0.5f ) ) );
+            return vqmovn_u32( vandq_u32( v, vtstq_u32( vmovl_u16( d16 ), vmovl_u16( d16 ) ) ) );
+        };
+        for( ; i + 8 <= count; i += 8 )
+        {
+            auto const d = vld1q_u16( in + i );
+            vst1q_u16( out + i, vcombine_u16( convert( vget_low_u16( d ) ), convert( vget_high_u16( d ) ) ) );
+        }
+#endif
+        return i;
+    }
+
+#endif
+
+
+    void threshold_depth( const uint16_t * in, uint16_t * out, size_t count, float units, float min, float max )
+    {
+        size_t i = 0;
+#ifdef RS2_AVX2_DEPTH_KERNELS
+        if( get_simd_level() >= simd_level::avx2 )
+            i = threshold_depth_avx2( in, out, count, units, min, max );
+        else
+#endif
+#if defined( __SSSE3__ ) || defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+        if( get_simd_level() >= simd_level::simd128 )
+            i = threshold_depth_simd128( in, out, count, units, min, max );
+#endif
+        for( ; i < count; ++i )
+        {
+            auto const dist = units * in[i];
+            out[i] = ( dist >= min && dist <= max ) ? in[i] : 0;
+        }
+    }
+
+    void depth_to_meters( const uint16_t * depth, size_t count, float units, float * meters )
+    {
+        size_t i = 0;
+#ifdef RS2_AVX2_DEPTH_KERNELS
+        if( get_simd_level() >= simd_level::avx2 )
+            i = depth_to_meters_avx2( depth, count, units, meters );
+        else
+#endif
+#if defined( __SSSE3__ ) || defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+        if( get_simd_level() >= simd_level::simd128 )
+            i = depth_to_meters_simd128( depth, count, units, meters );
+#endif
+        for( ; i < count; ++i )
+            meters[i] = depth[i] * units;
+    }
+
+    void depth_to_disparity( const uint16_t * depth, float * disparity, size_t count, float d2d_convert_factor )
+    {
+        size_t i = 0;
+#ifdef RS2_AVX2_DEPTH_KERNELS
+        if( get_simd_level() >= simd_level::avx2 )
+            i = depth_to_disparity_avx2( depth, disparity, count, d2d_convert_factor );
+        else
+#endif
+#if defined( __SSSE3__ ) || defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+        if( get_simd_level() >= simd_level::simd128 )
+            i = depth_to_disparity_simd128( depth, disparity, count, d2d_convert_factor );
+#endif
+        for( ; i < count; ++i )
+        {
+            float const input = depth[i];
+            disparity[i] = std::isnormal( input ) ? d2d_convert_factor / input : 0.f;
+        }
+    }
+
+    void disparity_to_depth( const float * disparity, uint16_t * depth, size_t count, float d2d_convert_factor )
+    {
+        size_t i = 0;
+#ifdef RS2_AVX2_DEPTH_KERNELS
+        if( get_simd_level() >= simd_level::avx2 )
+            i = disparity_to_depth_avx2( disparity, depth, count, d2d_convert_factor );
+        else
+#endif
+#if defined( __SSSE3__ ) || defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+        if( get_simd_level() >= simd_level::simd128 )
+            i = disparity_to_depth_simd128( disparity, depth, count, d2d_convert_factor );
+#endif
+        for( ; i < count; ++i )
+        {
+            float const input = disparity[i];
+            depth[i] = std::isnormal( input ) ? static_cast< uint16_t >( ( d2d_convert_factor / input ) + 0.5f ) : 0;
+        }
+    }
+
+    // factor / x, rounded and saturated to 16 bits, where x is not 0
+    static void divide_u16( const uint16_t * in, uint16_t * out, size_t count, float d2d_convert_factor )
+    {
+        size_t i = 0;
+#if defined( __SSSE3__ ) || defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+        if( get_simd_level() >= simd_level::simd128 )
+            i = divide_u16_simd128( in, out, count, d2d_convert_factor );
+#endif
+        for( ; i < count; ++i )
+        {
+            float const input = in[i];
+            float const q = std::min( d2d_convert_factor / input + 0.5f, 65535.f );
+            out[i] = input ? static_cast< uint16_t >( q ) : 0;
+        }
+    }
+
+    void depth_to_disparity16( const uint16_t * depth, uint16_t * disparity, size_t count, float d2d_convert_factor )
+    {
+        divide_u16( depth, disparity, count, d2d_convert_factor );
+    }
+
+    void disparity16_to_depth( const uint16_t * disparity, uint16_t * depth, size_t count, float d2d_convert_factor )
+    {
+        divide_u16( disparity, depth, count, d2d_convert_factor );
+    }
+}
@@ -0,0 +1,56 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+// Per-pixel kernels of the depth processing blocks (threshold, units and disparity transforms).
+//
+// Each kernel picks its implementation at run time according to get_simd_level(): AVX2 (built separately, in
+// depth-kernels-avx.cpp), SSSE3/NEON, or generic code. All implementations give the same results, except for
+// depth_to_disparity() whose SIMD versions multiply by an approximate reciprocal; see there.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense
+{
+    // Copies the depth values whose distance (depth * units) is within [min, max], zeroing the rest; in and out may be
+    // the same buffer
+    void threshold_depth( const uint16_t * in, uint16_t * out, size_t count, float units, float min, float max );
+
+    // depth * units, per pixel
+    void depth_to_meters( const uint16_t * depth, size_t count, float units, float * meters );
+
+    // d2d_convert_factor / depth, or 0 where there is no depth.
+    // The SIMD versions refine the CPU's reciprocal estimate with one Newton-Raphson step instead of dividing: the
+    // relative error against the division is below 2.5e-7 (a few float ULPs), well under the 1/32 disparity fraction.
+    void depth_to_disparity( const uint16_t * depth, float * disparity, size_t count, float d2d_convert_factor );
+
+    // d2d_convert_factor / disparity rounded to the nearest depth unit, or 0 where the disparity is not a normal
+    // number. This one always divides, so the rounding matches the scalar code exactly.
+    void disparity_to_depth( const float * disparity, uint16_t * depth, size_t count, float d2d_convert_factor );
+
+    // The same conversions for 16-bit fixed-point disparity (RS2_FORMAT_DISPARITY16): d2d_convert_factor already
+    // counts disparity in 1/32 pixel, so this is depth_to_disparity() rounded to the nearest integer, saturated at
+    // 65535; disparities that round to 0 (beyond what the factor can see) leave no disparity. Both always divide, so
+    // all implementations give the same results.
+    //
+    // Rounding the disparity is off by at most 1/64 pixel, half the subpixel step of the D400 matcher: the depth that
+    // comes back from it is within z * z / (2 * d2d_convert_factor) + 0.5 depth units of z, e.g. 12 mm at 4 m for a
+    // D435 at 848x480 with 1 mm units (a factor near 680000), a fraction of the sensor's own error at that distance.
+    // Depths too close for 16 bits (below d2d_convert_factor / 65535) come back as that limit.
+    void depth_to_disparity16( const uint16_t * depth, uint16_t * disparity, size_t count, float d2d_convert_factor );
+    void disparity16_to_depth( const uint16_t * disparity, uint16_t * depth, size_t count, float d2d_convert_factor );
+
+#if defined(__SSSE3__) && (defined(__AVX2__) || defined(RS2_AVX2_KERNELS))
+#define RS2_AVX2_DEPTH_KERNELS
+    // depth-kernels-avx.cpp is built with AVX2 enabled (RS2_AVX2_KERNELS) even when the rest of the library is not;
+    // these return how many pixels they did, leaving the last few to the caller, and must only be called once
+    // get_simd_level() says AVX2 is available
+    size_t threshold_depth_avx2( const uint16_t * in, uint16_t * out, size_t count, float units, float min, float max );
+    size_t depth_to_meters_avx2( const uint16_t * depth, size_t count, float units, float * meters );
+    size_t depth_to_disparity_avx2( const uint16_t * depth, float * disparity, size_t count, float d2d_convert_factor );
+    size_t disparity_to_depth_avx2( const float * disparity, uint16_t * depth, size_t count, float d2d_convert_factor );
+#endif
+}
@@ -0,0 +1,343 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <librealsense2/hpp/rs_sensor.hpp>
+#include <librealsense2/hpp/rs_processing.hpp>
+#include "proc/synthetic-stream.h"
+#include "proc/depth-postprocess.h"
+#include "proc/decimation-filter.h"
+#include "proc/disparity-transform.h"
+#include "proc/depth-kernels.h"
+#include "proc/spatial-filter.h"
+#include "proc/temporal-filter.h"
+#include "proc/hole-filling-filter.h"
+
+#include <rsutils/string/from.h>
+
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+namespace librealsense
+{
+    // Bands of rows are sized so their disparity stays in the L2 cache between stages
+    const size_t band_bytes = 64 * 1024;
+
+    depth_postprocess::depth_postprocess()
+        : stream_filter_processing_block( "Depth Post-Processing" )
+        , _decimation( std::make_shared< decimation_filter >() )
+        , _disparity( std::make_shared< disparity_transform >( true ) )
+        , _spatial( std::make_shared< spatial_filter >() )
+        , _temporal( std::make_shared< temporal_filter >() )
+        , _hole_filling( std::make_shared< hole_filling_filter >() )
+        , _enabled{ true, true, true, true, false }
+    {
+        _stream_filter.stream = RS2_STREAM_DEPTH;
+        _stream_filter.format = RS2_FORMAT_Z16;
+    }
+
+    depth_postprocess::~depth_postprocess()
+    {
+        _source.flush();
+    }
+
+    depth_postprocess::stage_index depth_postprocess::to_index( rs2_extension stage )
+    {
+        switch( stage )
+        {
+        case RS2_EXTENSION_DECIMATION_FILTER: return DECIMATION;
+        case RS2_EXTENSION_DISPARITY_FILTER: return DISPARITY;
+        case RS2_EXTENSION_SPATIAL_FILTER: return SPATIAL;
+        case RS2_EXTENSION_TEMPORAL_FILTER: return TEMPORAL;
+        case RS2_EXTENSION_HOLE_FILLING_FILTER: return HOLE_FILLING;
+        default:
+            throw invalid_value_exception( rsutils::string::from()
+                                           << "Not a stage of the depth post-processing block: " << stage );
+        }
+    }
+
+    std::shared_ptr< processing_block > depth_postprocess::get_stage( rs2_extension stage ) const
+    {
+        switch( to_index( stage ) )
+        {
+        case DECIMATION: return _decimation;
+        case DISPARITY: return _disparity;
+        case SPATIAL: return _spatial;
+        case TEMPORAL: return _temporal;
+        default: return _hole_filling;
+        }
+    }
+
+    void depth_postprocess::enable_stage( rs2_extension stage, bool enable )
+    {
+        auto index = to_index( stage );
+        std::lock_guard< std::mutex > lock( _mutex );
+        _enabled[index] = enable;
+    }
+
+    rs2::frame depth_postprocess::process_frame( const rs2::frame_source & source, const rs2::frame & f )
+    {
+        // The stages' options are set under their own locks; always taken in this order
+        std::lock_guard< std::mutex > lock( _mutex );
+        std::lock_guard< std::mutex > decimation_lock( _decimation->_mutex );
+        std::lock_guard< std::mutex > disparity_lock( _disparity->_mutex );
+        std::lock_guard< std::mutex > spatial_lock( _spatial->_mutex );
+        std::lock_guard< std::mutex > temporal_lock( _temporal->_mutex );
+        std::lock_guard< std::mutex > hole_filling_lock( _hole_filling->_mutex );
+
+        auto in = f.as< rs2::video_frame >();
+        rs2::frame tgt;
+        if( _enabled[DECIMATION] )
+        {
+            _decimation->update_output_profile( f );
+            tgt = _decimation->prepare_target_frame( f, source, RS2_EXTENSION_DEPTH_FRAME );
+        }
+        else
+            tgt = source.allocate_video_frame( f.get_profile(), f, sizeof( uint16_t ), in.get_width(), in.get_height(),
+                                               in.get_width() * int( sizeof( uint16_t ) ), RS2_EXTENSION_DEPTH_FRAME );
+        if( ! tgt )
+            return f;
+
+        auto out = tgt.as< rs2::video_frame >();
+        size_t const width = out.get_width();
+        size_t const height = out.get_height();
+        auto depth = static_cast< uint16_t * >( const_cast< void * >( tgt.get_data() ) );
+
+        // As the disparity stage sees it: the decimated frame, with the decimated intrinsics
+        if( _enabled[DISPARITY] && tgt.get_profile().get() != _info_profile.get() )
+        {
+            auto info = disparity_info::update_info_from_frame( tgt );
+            _stereoscopic_depth = info.stereoscopic_depth;
+            _d2d_convert_factor = info.d2d_convert_factor;
+            _info_profile = tgt.get_profile();
+        }
+
+        // Like the disparity stage, without stereo the frame stays in the depth domain
+        bool const disparity = _enabled[DISPARITY] && _stereoscopic_depth;
+        bool const fixed_point = disparity && _disparity->_fixed_point;
+        configure( width, height, disparity, fixed_point );
+        if( fixed_point )
+            process_disparity( in, depth, width, height, _disparity16_data );
+        else if( disparity )
+            process_disparity( in, depth, width, height, _disparity_data );
+        else
+        {
+            decimate_rows( in, depth, width, 0, height );
+            process_depth( depth );
+        }
+        return tgt;
+    }
+
+    void depth_postprocess::decimate_rows( const rs2::video_frame & in, uint16_t * out, size_t width,
+                                           size_t row_begin, size_t row_end )
+    {
+        auto src = static_cast< const uint16_t * >( in.get_data() );
+        if( ! _enabled[DECIMATION] )
+        {
+            auto const stride = size_t( in.get_stride_in_bytes() );
+            for( size_t j = row_begin; j < row_end; j++ )
+                memcpy( out + j * width, reinterpret_cast< const uint8_t * >( src ) + j * stride, width * sizeof( uint16_t ) );
+            return;
+        }
+
+        // The same kernels decimation_filter::decimate_depth() picks
+        auto & d = *_decimation;
+        size_t const width_in = in.get_width();
+        size_t const real_end = std::min< size_t >( row_end, d._real_height );
+        if( row_begin < real_end )
+        {
+            if( d._patch_size == 2 )
+                d.decimate_depth_median2( src, out, width_in, row_begin, real_end );
+            else if( d._patch_size == 4 )
+                d.decimate_depth_mean< 4 >( src, out, width_in, row_begin, real_end );
+            else
+                d.decimate_depth_rows( src, out, width_in, d._patch_size, row_begin, real_end );
+        }
+
+        // Fill-in the padded rows with zeros
+        size_t const pad_begin = std::max< size_t >( row_begin, d._real_height );
+        if( pad_begin < row_end )
+            std::fill( out + pad_begin * width, out + row_end * width, uint16_t( 0 ) );
+    }
+
+    void depth_postprocess::configure( size_t width, size_t height, bool disparity, bool fixed_point )
+    {
+        size_t const pixels = width * height;
+        size_t const bpp = ( disparity && ! fixed_point ) ? sizeof( float ) : sizeof( uint16_t );
+        auto const extension = disparity ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME;
+
+        auto & s = *_spatial;
+        s._width = width;
+        s._height = height;
+        s._bpp = bpp;
+        s._stride = width * bpp;
+        s._extension_type = extension;
+        s._fixed_point = fixed_point;
+        s._current_frm_size_pixels = pixels;
+        s._spatial_edge_threshold = s._spatial_delta_param;
+
+        // The history is for other frames of the same shape, as when the temporal filter's profile changes
+        auto & t = *_temporal;
+        if( t._width != width || t._height != height || t._extension_type != extension
+            || t._last_frame.size() != pixels * bpp )
+        {
+            t._width = width;
+            t._height = height;
+            t._bpp = bpp;
+            t._stride = width * bpp;
+            t._extension_type = extension;
+            t._current_frm_size_pixels = pixels;
+            t.reset_history();
+            t._last_frame.resize( pixels * bpp );
+            t._history.resize( pixels * bpp );
+        }
+
+        // Hole filling always comes after the conversion back to depth
+        auto & h = *_hole_filling;
+        h._width = width;
+        h._height = height;
+        h._bpp = sizeof( uint16_t );
+        h._stride = width * sizeof( uint16_t );
+        h._extension_type = RS2_EXTENSION_DEPTH_FRAME;
+        h._current_frm_size_pixels = pixels;
+    }
+
+    void depth_postprocess::process_depth( uint16_t * depth )
+    {
+        if( _enabled[SPATIAL] )
+            _spatial->dxf_smooth< uint16_t >( depth, _spatial->_spatial_alpha_param, _spatial->_spatial_edge_threshold,
+                                              _spatial->_spatial_iterations );
+        if( _enabled[TEMPORAL] )
+            _temporal->temp_jw_smooth< uint16_t >( depth, _temporal->_last_frame.data(), _temporal->_history.data() );
+        if( _enabled[HOLE_FILLING] )
+            _hole_filling->apply_hole_filling< uint16_t >( depth );
+    }
+
+    // The conversions and passes of each disparity format
+    static void to_disparity( const uint16_t * depth, float * disparity, size_t count, float factor )
+    {
+        depth_to_disparity( depth, disparity, count, factor );
+    }
+
+    static void to_disparity( const uint16_t * depth, uint16_t * disparity, size_t count, float factor )
+    {
+        depth_to_disparity16( depth, disparity, count, factor );
+    }
+
+    static void to_depth( const float * disparity, uint16_t * depth, size_t count, float factor )
+    {
+        disparity_to_depth( disparity, depth, count, factor );
+    }
+
+    static void to_depth( const uint16_t * disparity, uint16_t * depth, size_t count, float factor )
+    {
+        disparity16_to_depth( disparity, depth, count, factor );
+    }
+
+    template< class T >
+    void depth_postprocess::process_disparity( const rs2::video_frame & in, uint16_t * depth, size_t width, size_t height,
+                                               std::vector< T > & buffer )
+    {
+        bool const fp = std::is_floating_point< T >::value;
+        buffer.resize( width * height );
+        T * disparity = buffer.data();
+        size_t const band = std::max< size_t >( 1, band_bytes / ( width * sizeof( T ) ) );
+        auto & s = *_spatial;
+        auto & t = *_temporal;
+        float const alpha = s._spatial_alpha_param;
+        float const delta = s._spatial_edge_threshold;
+        auto horizontal = [&]( size_t begin, size_t end ) {
+            if( fp )
+                s.recursive_filter_horizontal_fp( disparity, alpha, delta, begin, end );
+            else
+                s.recursive_filter_horizontal_fixed( disparity, alpha, delta, begin, end );
+        };
+        auto vertical = [&]( size_t begin, size_t end ) {
+            if( fp )
+                s.recursive_filter_vertical_fp( disparity, alpha, delta, begin, end );
+            else
+                s.recursive_filter_vertical_fixed( disparity, alpha, delta, begin, end );
+        };
+
+        // Decimation, depth to disparity and the first horizontal pass of the spatial filter only need their own rows
+        for( size_t row_begin = 0; row_begin < height; row_begin += band )
+        {
+            size_t const row_end = std::min( height, row_begin + band );
+            decimate_rows( in, depth, width, row_begin, row_end );
+            to_disparity( depth + row_begin * width, disparity + row_begin * width, ( row_end - row_begin ) * width,
+                          _d2d_convert_factor );
+            if( _enabled[SPATIAL] )
+                horizontal( row_begin, row_end );
+        }
+
+        // The vertical passes run down whole columns; the rest of dxf_smooth<float>() (or dxf_smooth_fixed()) follows
+        // from there
+        if( _enabled[SPATIAL] )
+        {
+            s.for_each_range( width, vertical );
+            for( int i = 1; i < s._spatial_iterations; i++ )
+            {
+                s.for_each_range( height, horizontal );
+                s.for_each_range( width, vertical );
+            }
+            if( s._holes_filling_mode )
+                s.intertial_holes_fill< T >( disparity );
+        }
+
+        // Temporal filtering and disparity to depth are per pixel; hole filling trails by a row, since filling from
+        // around reads the row below
+        size_t filled = 0;  // rows before this one are hole-filled
+        for( size_t row_begin = 0; row_begin < height; row_begin += band )
+        {
+            size_t const row_end = std::min( height, row_begin + band );
+            if( _enabled[TEMPORAL] )
+            {
+                size_t begin = row_begin * width;
+#ifdef __SSSE3__
+                // As temp_jw_smooth() does it for 16-bit values
+                if( ! fp )
+                    begin += t.temp_jw_smooth_sse( reinterpret_cast< uint16_t * >( disparity ) + begin,
+                                                   reinterpret_cast< uint16_t * >( t._last_frame.data() ) + begin,
+                                                   t._history.data() + begin, row_end * width - begin );
+#endif
+                t.temp_jw_smooth_range< T >( disparity, t._last_frame.data(), t._history.data(), begin, row_end * width );
+            }
+            to_depth( disparity + row_begin * width, depth + row_begin * width, ( row_end - row_begin ) * width,
+                      _d2d_convert_factor );
+            if( _enabled[HOLE_FILLING] )
+            {
+                size_t const ready = _hole_filling->_hole_filling_mode == hf_fill_from_left ? row_end : row_end - 1;
+                fill_holes( depth, width, filled, ready );
+                filled = std::max( filled, ready );
+            }
+        }
+        if( _enabled[TEMPORAL] )
+            t._cur_frame_index = ( t._cur_frame_index + 1 ) % 8;  // at end of cycle
+    }
+
+    void depth_postprocess::fill_holes( uint16_t * depth, size_t width, size_t row_begin, size_t row_end )
+    {
+        auto & h = *_hole_filling;
+        switch( h._hole_filling_mode )
+        {
+        case hf_fill_from_left:
+            if( row_begin < row_end )
+                h.holes_fill_left( depth + row_begin * width, width, row_end - row_begin, h._stride );
+            break;
+        // These never touch the first and last rows, and read the rows on either side: 'depth' starts a row early
+        case hf_farest_from_around:
+            row_begin = std::max< size_t >( row_begin, 1 );
+            if( row_begin < row_end )
+                h.holes_fill_farest( depth + ( row_begin - 1 ) * width, width, row_end - row_begin + 2, h._stride );
+            break;
+        case hf_nearest_from_around:
+            row_begin = std::max< size_t >( row_begin, 1 );
+            if( row_begin < row_end )
+                h.holes_fill_nearest( depth + ( row_begin - 1 ) * width, width, row_end - row_begin + 2, h._stride );
+            break;
+        default:
+            throw invalid_value_exception( rsutils::string::from() << "Unsupported hole filling mode: "
+                                                                   << h._hole_filling_mode << " is out of range." );
+        }
+    }
+}
@@ -0,0 +1,84 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+
+#include <memory>
+#include <vector>
+
+namespace librealsense
+{
+    class decimation_filter;
+    class disparity_transform;
+    class spatial_filter;
+    class temporal_filter;
+    class hole_filling_filter;
+
+    // The recommended D400 depth chain - decimation, depth to disparity, spatial, temporal, disparity to depth and hole
+    // filling - as a single block, with the same output as the separate filters.
+    //
+    // The stages are the blocks' own code, run over bands of rows small enough to stay in cache: each band is
+    // decimated, converted to disparity and smoothed horizontally in one go, and later filtered in time, converted back
+    // to depth and hole-filled in one go. Only the vertical passes of the spatial filter (and its further iterations)
+    // need the whole frame in between. Without disparity (a non-stereo sensor, or the stage disabled) the filters run
+    // on the whole frame in the depth domain, as the separate blocks would.
+    //
+    // Each stage is configured through its own block, from get_stage(), which the chain never invokes.
+    class depth_postprocess : public stream_filter_processing_block
+    {
+    public:
+        depth_postprocess();
+        ~depth_postprocess() override;
+
+        // The block of a stage, one of RS2_EXTENSION_DECIMATION_FILTER, _DISPARITY_FILTER, _SPATIAL_FILTER,
+        // _TEMPORAL_FILTER and _HOLE_FILLING_FILTER
+        std::shared_ptr< processing_block > get_stage( rs2_extension stage ) const;
+
+        // All stages but hole filling are enabled to begin with
+        void enable_stage( rs2_extension stage, bool enable );
+
+    protected:
+        rs2::frame process_frame( const rs2::frame_source & source, const rs2::frame & f ) override;
+
+    private:
+        enum stage_index
+        {
+            DECIMATION,
+            DISPARITY,
+            SPATIAL,
+            TEMPORAL,
+            HOLE_FILLING,
+            STAGE_COUNT
+        };
+        static stage_index to_index( rs2_extension stage );
+
+        // Output rows [row_begin, row_end) of the decimation stage, or of the input when it is disabled
+        void decimate_rows( const rs2::video_frame & in, uint16_t * out, size_t width, size_t row_begin, size_t row_end );
+        // The filters' own dimensions, as their update_configuration() would set them for this frame
+        void configure( size_t width, size_t height, bool disparity, bool fixed_point );
+        // The stages after decimation, over the whole frame in the depth domain
+        void process_depth( uint16_t * depth );
+        // The stages after decimation through disparity, a band of rows at a time where possible; in float, or in
+        // 16-bit fixed point when the disparity stage is set to it
+        template< class T >
+        void process_disparity( const rs2::video_frame & in, uint16_t * depth, size_t width, size_t height,
+                                std::vector< T > & buffer );
+        // Hole-fill rows [row_begin, row_end), once the rows around them are final
+        void fill_holes( uint16_t * depth, size_t width, size_t row_begin, size_t row_end );
+
+        std::shared_ptr< decimation_filter > _decimation;
+        std::shared_ptr< disparity_transform > _disparity;
+        std::shared_ptr< spatial_filter > _spatial;
+        std::shared_ptr< temporal_filter > _temporal;
+        std::shared_ptr< hole_filling_filter > _hole_filling;
+        bool _enabled[STAGE_COUNT];
+        std::vector< float > _disparity_data;  // the frame, between the two conversions
+        std::vector< uint16_t > _disparity16_data;  // the same, in fixed point
+
+        rs2::stream_profile _info_profile;  // the profile _stereoscopic_depth and _d2d_convert_factor are for
+        bool _stereoscopic_depth = false;
+        float _d2d_convert_factor = 0.f;
+    };
+}
@@ -10,6 +10,7 @@
 #include "core/video.h"
 #include "proc/synthetic-stream.h"
 #include "proc/disparity-transform.h"
+#include "proc/depth-kernels.h"
 #include "software-device.h"
 #include "environment.h"
 
@@ -18,11 +19,27 @@ namespace librealsense
     disparity_transform::disparity_transform(bool transform_to_disparity):
         generic_processing_block(transform_to_disparity ? "Depth to Disparity" : "Disparity to Depth"),
         _transform_to_disparity(transform_to_disparity),
+        _fixed_point(false),
         _update_target(false),
         _width(0), _height(0), _bpp(0)
     {
         unregister_option(RS2_OPTION_FRAMES_QUEUE_SIZE);
 
+        // Half the memory traffic for the disparity-domain filters that follow; see depth_to_disparity16() for the
+        // precision. The way back to depth takes either format.
+        if (_transform_to_disparity)
+        {
+            auto fixed_point = std::make_shared<ptr_option<bool>>(false, true, true, false, &_fixed_point,
+                "Output 16-bit fixed-point disparity, in 1/32 pixel");
+            fixed_point->on_set([this](float val)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _fixed_point = val != 0.f;
+                on_set_mode(_transform_to_disparity);
+            });
+            register_option(RS2_OPTION_FIXED_POINT_DISPARITY, fixed_point);
+        }
+
         on_set_mode(_transform_to_disparity);
     }
 
@@ -56,11 +73,34 @@ namespace librealsense
         if (_stereoscopic_depth && (tgt = prepare_target_frame(f, source)))
         {
             auto src = f.as<rs2::video_frame>();
-
-            if (_transform_to_disparity)
-                convert<uint16_t, float>(src.get_data(), const_cast<void*>(tgt.get_data()));
+            auto out = const_cast<void*>(tgt.get_data());
+            size_t count = _width * _height;
+
+            // The fixed-point conversions have no GPU version; they are bandwidth-bound on the CPU anyway
+            if (_transform_to_disparity && _fixed_point)
+                depth_to_disparity16(static_cast<const uint16_t*>(src.get_data()), static_cast<uint16_t*>(out), count,
+                    _d2d_convert_factor);
+            else if (!_transform_to_disparity && src.get_profile().format() == RS2_FORMAT_DISPARITY16)
+                disparity16_to_depth(static_cast<const uint16_t*>(src.get_data()), static_cast<uint16_t*>(out), count,
+                    _d2d_convert_factor);
             else
-                convert<float, uint16_t>(src.get_data(), const_cast<void*>(tgt.get_data()));
+            {
+#ifdef RS2_USE_CUDA
+                if (_transform_to_disparity)
+                    _cuda_helper.depth_to_disparity(static_cast<const uint16_t*>(src.get_data()),
+                        static_cast<float*>(out), int(count), _d2d_convert_factor);
+                else
+                    _cuda_helper.disparity_to_depth(static_cast<const float*>(src.get_data()),
+                        static_cast<uint16_t*>(out), int(count), _d2d_convert_factor);
+#else
+                if (_transform_to_disparity)
+                    depth_to_disparity(static_cast<const uint16_t*>(src.get_data()),
+                        static_cast<float*>(out), count, _d2d_convert_factor);
+                else
+                    disparity_to_depth(static_cast<const float*>(src.get_data()),
+                        static_cast<uint16_t*>(out), count, _d2d_convert_factor);
+#endif
+            }
         }
 
         return tgt;
@@ -69,7 +109,7 @@ namespace librealsense
     void disparity_transform::on_set_mode(bool to_disparity)
     {
         _transform_to_disparity = to_disparity;
-        _bpp = _transform_to_disparity ? sizeof(float) : sizeof(uint16_t);
+        _bpp = (_transform_to_disparity && !_fixed_point) ? sizeof(float) : sizeof(uint16_t);
         _update_target = true;
     }
 
@@ -92,7 +132,8 @@ namespace librealsense
         // Adjust the target profile
         if (_update_target)
         {
-            auto tgt_format = _transform_to_disparity ? RS2_FORMAT_DISPARITY32 : RS2_FORMAT_Z16;
+            auto tgt_format = !_transform_to_disparity ? RS2_FORMAT_Z16
+                            : _fixed_point ? RS2_FORMAT_DISPARITY16 : RS2_FORMAT_DISPARITY32;
             _target_stream_profile = _source_stream_profile.clone(RS2_STREAM_DEPTH, 0, tgt_format);
 
             auto src_vspi = dynamic_cast<video_stream_profile_interface*>(_source_stream_profile.get()->profile);
@@ -12,6 +12,10 @@
 #include <src/depth-sensor.h>
 #include "synthetic-stream.h"
 
+#ifdef RS2_USE_CUDA
+#include "../cuda/cuda-depth-filters.cuh"
+#endif
+
 namespace librealsense
 {
     class disparity_transform : public generic_processing_block
@@ -24,38 +28,15 @@ namespace librealsense
     protected:
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
 
-        template<typename Tin, typename Tout>
-        void convert(const void* in_data, void* out_data)
-        {
-            static_assert((std::is_arithmetic<Tin>::value), "disparity transform requires numeric type for input data");
-            static_assert((std::is_arithmetic<Tout>::value), "disparity transform requires numeric type for output data");
-
-            auto in = reinterpret_cast<const Tin*>(in_data);
-            auto out = reinterpret_cast<Tout*>(out_data);
-
-            const bool fp = (std::is_floating_point<Tin>::value);
-            const float round = fp ? 0.5f : 0.f;
-
-            float input{};
-            //TODO SSE optimize
-            for (size_t i = 0; i < _height; i++)
-                for (size_t j = 0; j < _width; j++)
-                {
-                    input = *in;
-                    if (std::isnormal(input))
-                        *out++ = static_cast<Tout>((_d2d_convert_factor / input)+round);
-                    else
-                        *out++ = 0;
-                    in++;
-                }
-        }
-
     private:
+        friend class depth_postprocess;  // converts bands of rows, as set up here
+
         void    update_transformation_profile(const rs2::frame& f);
 
         void    on_set_mode(bool to_disparity);
 
         bool                    _transform_to_disparity;
+        bool                    _fixed_point;           // To RS2_FORMAT_DISPARITY16 rather than RS2_FORMAT_DISPARITY32
         rs2::stream_profile     _source_stream_profile;
         rs2::stream_profile     _target_stream_profile;
         bool                    _update_target;
@@ -64,6 +45,9 @@ namespace librealsense
         float                   _d2d_convert_factor;
         size_t                  _width, _height;
         size_t                  _bpp;
+#ifdef RS2_USE_CUDA
+        rscuda::disparity_cuda_helper _cuda_helper;
+#endif
     };
     MAP_EXTENSION(RS2_EXTENSION_DISPARITY_FILTER, librealsense::disparity_transform);
 
@@ -2,9 +2,12 @@
 // Copyright(c) 2023 Intel Corporation. All Rights Reserved.
 
 #include "proc/formats-converter.h"
+#include "proc/identity-processing-block.h"
 #include "stream.h"
 #include <src/composite-frame.h>
+#include <src/core/video-frame.h>
 #include <src/core/frame-callback.h>
+#include <src/frame-trace.h>
 
 #include <ostream>
 
@@ -248,6 +251,8 @@ void formats_converter::prepare_to_convert( stream_profiles from_profiles )
         // Retrieve source profile from cached map and generate the relevant processing block.
         std::unordered_set< std::shared_ptr< stream_profile_interface > > current_resolved_reqs;
         auto best_pb = factory_of_best_match->generate();
+        if( std::dynamic_pointer_cast< identity_processing_block >( best_pb ) )
+            _identity_converters.insert( best_pb.get() );
         for( const auto & from_profile : from_profiles_of_best_match )
         {
             auto & mapped_raw_profiles = _target_profiles_to_raw_profiles[to_profile( from_profile.get() )];
@@ -260,6 +265,8 @@ void formats_converter::prepare_to_convert( stream_profiles from_profiles )
 
                     // Caching converters to invoke appropriate converters for received frames
                     _raw_profile_to_converters[raw_profile].insert( best_pb );
+                    // And the first requested profile each raw one is for, for frames that are not converted
+                    _raw_profile_to_requested.emplace( raw_profile, from_profile );
                 }
             }
         }
@@ -308,6 +315,8 @@ void formats_converter::cache_from_profiles( const stream_profiles & from_profil
 void formats_converter::clear_active_cache()
 {
     _raw_profile_to_converters.clear();
+    _identity_converters.clear();
+    _raw_profile_to_requested.clear();
     _format_mapping_to_from_profiles.clear();
 }
 
@@ -369,6 +378,13 @@ formats_converter::find_pbf_matching_most_profiles( const stream_profiles & from
     return { best_match_processing_block_factory, best_match_profiles };
 }
 
+static bool resized_by_converter( frame_interface * f, std::shared_ptr< stream_profile_interface > const & requested )
+{
+    auto vf = dynamic_cast< video_frame * >( f );
+    auto vsp = As< video_stream_profile_interface >( requested );
+    return vf && vsp && ( vf->get_width() != int( vsp->get_width() ) || vf->get_height() != int( vsp->get_height() ) );
+}
+
 void formats_converter::set_frames_callback( rs2_frame_callback_sptr callback )
 {
     _converted_frames_callback = callback;
@@ -391,23 +407,7 @@ void formats_converter::set_frames_callback( rs2_frame_callback_sptr callback )
         for( auto & fr : frames_to_be_processed )
         {
             if( ! dynamic_cast< composite_frame * >( fr ) )
-            {
-                // We find a from profile with the same format+index+type as the frame profile and save it back
-                // to the frame. Reason - viewer uses syncher and matcher that uses rs2::stream_profile.clone()
-                // that generates a new ID for the clone and than the match can fail.
-                auto cached_from_profile = find_cached_profile_for_frame( fr );
-
-                if( cached_from_profile )
-                {
-                    fr->set_stream( cached_from_profile );
-                }
-                else
-                    continue;
-
-                fr->acquire();
-                if( _converted_frames_callback )
-                    _converted_frames_callback->on_frame( (rs2_frame *)fr );
-            }
+                publish_converted_frame( fr );
         }
     } );
 
@@ -423,17 +423,61 @@ void formats_converter::set_frames_callback( rs2_frame_callback_sptr callback )
     }
 }
 
+void formats_converter::publish_converted_frame( frame_interface * f )
+{
+    // We find a from profile with the same format+index+type as the frame profile and save it back
+    // to the frame. Reason - viewer uses syncher and matcher that uses rs2::stream_profile.clone()
+    // that generates a new ID for the clone and than the match can fail.
+    auto cached_from_profile = find_cached_profile_for_frame( f );
+
+    if( ! cached_from_profile )
+        return;
+    // A converter that also resized the frame (e.g., decimating while deinterleaving) made a profile with
+    // the matching size and intrinsics; the requested profile would describe the wrong image
+    if( ! resized_by_converter( f, cached_from_profile ) )
+        f->set_stream( cached_from_profile );
+
+    f->acquire();
+    if( _converted_frames_callback )
+        _converted_frames_callback->on_frame( (rs2_frame *)f );
+}
+
 void formats_converter::convert_frame( frame_holder & f )
 {
     if( ! f )
         return;
 
+    // Metadata-only frames (see uvc_sensor) have nothing to convert: they are published once, as the first of the
+    // requested profiles they were opened for
+    if( ! f->get_frame_data_size() )
+    {
+        auto it = _raw_profile_to_requested.find( f->get_stream() );
+        if( it == _raw_profile_to_requested.end() )
+            return;
+        f->set_stream( it->second );
+        f->acquire();
+        if( _converted_frames_callback )
+            _converted_frames_callback->on_frame( (rs2_frame *)f.frame );
+        return;
+    }
+
+    frame_trace::scope trace( "formats conversion", f.frame );
     auto & converters = _raw_profile_to_converters[f->get_stream()];
+    bool identity = false;
     for( auto & converter : converters )
     {
+        if( _identity_converters.count( converter.get() ) )
+        {
+            identity = true;
+            continue;
+        }
         f->acquire();
         converter->invoke( f.frame );
     }
+
+    // Last, since it re-tags the raw frame the other converters read
+    if( identity )
+        publish_converted_frame( f.frame );
 }
 
 std::shared_ptr< stream_profile_interface > formats_converter::find_cached_profile_for_frame( const frame_interface * f )
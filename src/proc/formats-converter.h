@@ -55,6 +55,8 @@ namespace librealsense
             find_pbf_matching_most_profiles( const stream_profiles & profiles );
 
         std::shared_ptr< stream_profile_interface > find_cached_profile_for_frame( const frame_interface * f );
+        // Gives a converted frame the requested profile and passes it on to the frames callback
+        void publish_converted_frame( frame_interface * f );
 
         std::vector< std::shared_ptr< processing_block_factory > > _pb_factories;
         std::unordered_map< processing_block_factory *, stream_profiles > _pbf_supported_profiles;
@@ -62,6 +64,12 @@ namespace librealsense
 
         std::unordered_map< std::shared_ptr< stream_profile_interface >,
                             std::unordered_set< std::shared_ptr< processing_block > > > _raw_profile_to_converters;
+        // Converters that would return their input as-is: their frames are re-tagged and published directly, without
+        // going through the processing block
+        std::unordered_set< processing_block * > _identity_converters;
+        // Frames without a payload to convert are published as the first requested profile of their raw profile
+        std::unordered_map< std::shared_ptr< stream_profile_interface >,
+                            std::shared_ptr< stream_profile_interface > > _raw_profile_to_requested;
         std::unordered_map< rs2_format, stream_profiles > _format_mapping_to_from_profiles;
 
         rs2_frame_callback_sptr _converted_frames_callback;
@@ -0,0 +1,191 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "fused-pointcloud.h"
+#include "worker-pool.h"
+#include <src/core/device-interface.h>
+#include <src/core/frame-interface.h>
+#include <src/core/sensor-interface.h>
+#include <src/option.h>
+#include <src/points.h>
+#include <src/pose.h>
+
+#include <librealsense2/rs.hpp>
+#include <librealsense2/rsutil.h>
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace librealsense
+{
+    fused_pointcloud::fused_pointcloud()
+        : generic_processing_block( "Fused Pointcloud" )
+    {
+        auto voxel = std::make_shared< ptr_option< float > >( 0.f, 1.f, 0.001f, 0.f, &_voxel_size,
+                                                              "Size of the cells points are reduced to, in meters; 0 for no reduction" );
+        register_option( RS2_OPTION_VOXEL_SIZE, voxel );
+
+        register_processing_threads_option();
+    }
+
+    void fused_pointcloud::set_extrinsics( std::string const & serial, rs2_extrinsics const & extrinsics )
+    {
+        std::lock_guard< std::mutex > lock( _rig_mutex );
+        _rig[serial] = extrinsics;
+        _rig_changed = true;
+    }
+
+    bool fused_pointcloud::should_process( const rs2::frame & frame )
+    {
+        if( ! frame )
+            return false;
+        if( auto set = frame.as< rs2::frameset >() )
+        {
+            for( auto f : set )
+                if( f.is< rs2::depth_frame >() && f.get_profile().format() == RS2_FORMAT_Z16 )
+                    return true;
+            return false;
+        }
+        return frame.is< rs2::depth_frame >() && frame.get_profile().format() == RS2_FORMAT_Z16;
+    }
+
+    fused_pointcloud::camera const & fused_pointcloud::get_camera( const rs2::depth_frame & depth )
+    {
+        auto const profile = depth.get_profile().get();
+        auto it = _cameras.find( profile );
+        if( it != _cameras.end() )
+            return it->second;
+
+        // Profiles come and go with each start of the streams
+        if( _cameras.size() > 64 )
+            _cameras.clear();
+
+        camera & cam = _cameras[profile];
+        auto const intrinsics = depth.get_profile().as< rs2::video_stream_profile >().get_intrinsics();
+        cam.width = intrinsics.width;
+        cam.height = intrinsics.height;
+        cam.units = depth.get_units();
+
+        // Every distortion model deprojects linearly in depth, so the ray at a depth of 1 scales to any other
+        cam.rays.resize( size_t( cam.width ) * cam.height );
+        auto ray = cam.rays.data();
+        for( int y = 0; y < cam.height; ++y )
+        {
+            for( int x = 0; x < cam.width; ++x, ++ray )
+            {
+                const float pixel[] = { float( x ), float( y ) };
+                float point[3];
+                rs2_deproject_pixel_to_point( point, &intrinsics, pixel, 1.f );
+                *ray = { point[0], point[1] };
+            }
+        }
+
+        std::string serial;
+        auto sensor = ( (frame_interface *)depth.get() )->get_sensor();
+        if( sensor && sensor->get_device().supports_info( RS2_CAMERA_INFO_SERIAL_NUMBER ) )
+            serial = sensor->get_device().get_info( RS2_CAMERA_INFO_SERIAL_NUMBER );
+        std::lock_guard< std::mutex > lock( _rig_mutex );
+        auto rig = _rig.find( serial );
+        cam.to_rig = rig != _rig.end() ? rig->second : identity_matrix();
+        return cam;
+    }
+
+    rs2::frame fused_pointcloud::process_frame( const rs2::frame_source & source, const rs2::frame & f )
+    {
+        {
+            std::lock_guard< std::mutex > lock( _rig_mutex );
+            if( _rig_changed )
+            {
+                _cameras.clear();
+                _rig_changed = false;
+            }
+        }
+
+        std::vector< rs2::depth_frame > depths;
+        if( auto set = f.as< rs2::frameset >() )
+        {
+            for( auto frame : set )
+                if( frame.is< rs2::depth_frame >() && frame.get_profile().format() == RS2_FORMAT_Z16 )
+                    depths.push_back( frame );
+        }
+        else
+            depths.push_back( f );
+
+        struct input
+        {
+            camera const * cam;
+            uint16_t const * depth;
+            size_t first_row;  // of all the inputs' rows
+            size_t first_point;
+        };
+        std::vector< input > inputs;
+        std::vector< const rs2_stream_profile * > profiles;
+        size_t rows = 0, total = 0;
+        for( auto & depth : depths )
+        {
+            auto & cam = get_camera( depth );
+            inputs.push_back( { &cam, (uint16_t const *)depth.get_data(), rows, total } );
+            profiles.push_back( depth.get_profile().get() );
+            rows += cam.height;
+            total += size_t( cam.width ) * cam.height;
+        }
+        if( ! total )
+            return {};
+
+        // One row holding all the points; kept for as long as the same streams come in, so frames are pooled
+        if( ! _output_stream || profiles != _output_inputs )
+        {
+            auto const vsp = depths.front().get_profile().as< rs2::video_stream_profile >();
+            auto intrinsics = vsp.get_intrinsics();
+            intrinsics.width = int( total );
+            intrinsics.height = 1;
+            _output_stream = vsp.clone( RS2_STREAM_DEPTH, vsp.stream_index(), RS2_FORMAT_XYZ32F, int( total ), 1, intrinsics );
+            _output_inputs = profiles;
+        }
+
+        auto res = source.allocate_points( _output_stream, depths.front() );
+        auto pframe = (librealsense::points *)res.get();
+        auto vertices = pframe->get_vertices();
+        std::memset( pframe->get_texture_coordinates(), 0, sizeof( float2 ) * total );
+
+        auto fill_rows = [&]( size_t row_begin, size_t row_end )
+        {
+            // The input of the first row
+            size_t i = 0;
+            while( i + 1 < inputs.size() && inputs[i + 1].first_row <= row_begin )
+                ++i;
+            for( auto row = row_begin; row < row_end; ++row )
+            {
+                while( i + 1 < inputs.size() && inputs[i + 1].first_row <= row )
+                    ++i;
+                auto & in = inputs[i];
+                auto const & cam = *in.cam;
+                auto const offset = ( row - in.first_row ) * cam.width;
+                auto const depth = in.depth + offset;
+                auto const rays = cam.rays.data() + offset;
+                auto out = vertices + in.first_point + offset;
+                auto const & r = cam.to_rig.rotation;
+                auto const & t = cam.to_rig.translation;
+                auto const units = cam.units;
+                // Without branches, for the compiler to vectorize; pixels without depth give all zeros
+                for( int x = 0; x < cam.width; ++x )
+                {
+                    float const z = depth[x] * units;
+                    float const px = rays[x].x * z, py = rays[x].y * z;
+                    float const valid = depth[x] ? 1.f : 0.f;
+                    out[x].x = ( r[0] * px + r[3] * py + r[6] * z + t[0] ) * valid;
+                    out[x].y = ( r[1] * px + r[4] * py + r[7] * z + t[1] ) * valid;
+                    out[x].z = ( r[2] * px + r[5] * py + r[8] * z + t[2] ) * valid;
+                }
+            }
+        };
+        auto workers = get_workers();
+        worker_pool::for_each_range( workers.get(), _threads, rows, fill_rows );
+
+        if( _voxel_size > 0 )
+            pframe->set_valid_only( _grid.reduce( vertices, nullptr, total, _voxel_size, vertices, nullptr,
+                                                  workers.get(), _threads ) );
+        return res;
+    }
+}
@@ -0,0 +1,63 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+#include "voxel-grid.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace librealsense
+{
+    class worker_pool;
+
+    // The points of the depth frames of several cameras - a frameset from the multi-device syncer, say - in one frame,
+    // each camera's moved by its extrinsics into the rig's coordinates.
+    //
+    // Every camera's points are deprojected and transformed straight into the output, in one pass split between
+    // threads, through a table of the ray of each depth pixel; with RS2_OPTION_VOXEL_SIZE, the points are then reduced
+    // to the centroids of the cells they fall in. Points have no texture coordinates, as the cameras' images are not
+    // one texture. The output holds a point for each depth pixel of every camera (without depth: all zeros) unless
+    // voxels are on, and then only the centroids.
+    class fused_pointcloud : public generic_processing_block
+    {
+    public:
+        fused_pointcloud();
+
+        // The transformation from the coordinates of a camera, by its serial number, to the rig's. Cameras that were
+        // not given one are taken to be at the rig's origin.
+        void set_extrinsics( std::string const & serial, rs2_extrinsics const & extrinsics );
+
+    protected:
+        bool should_process( const rs2::frame & frame ) override;
+        rs2::frame process_frame( const rs2::frame_source & source, const rs2::frame & f ) override;
+
+    private:
+        // What the points of one depth stream take
+        struct camera
+        {
+            int width = 0, height = 0;
+            float units = 0;
+            std::vector< float2 > rays;  // (x, y) of each pixel's point at a depth of 1
+            rs2_extrinsics to_rig;
+        };
+
+        camera const & get_camera( const rs2::depth_frame & depth );
+
+        std::mutex _rig_mutex;
+        std::map< std::string, rs2_extrinsics > _rig;  // guarded by _rig_mutex
+        bool _rig_changed = false;                     // guarded by _rig_mutex
+
+        std::map< const rs2_stream_profile *, camera > _cameras;
+        std::vector< const rs2_stream_profile * > _output_inputs;  // the profiles _output_stream was made for
+        rs2::stream_profile _output_stream;
+
+        float _voxel_size = 0.f;
+        voxel_grid _grid;
+    };
+}
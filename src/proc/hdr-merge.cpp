@@ -4,6 +4,10 @@
 #include "hdr-merge.h"
 #include <src/core/depth-frame.h>
 
+#ifdef __SSSE3__
+#include <emmintrin.h>
+#endif
+
 namespace librealsense
 {
     hdr_merge::hdr_merge()
@@ -43,7 +47,7 @@ namespace librealsense
         }
 
         auto depth_seq_size = depth_frame.get_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_SIZE);
-        if (depth_seq_size != 2)
+        if (depth_seq_size < 2 || depth_seq_size > MAX_SEQUENCE_SIZE)
             return false;
 
         return true;
@@ -62,63 +66,105 @@ namespace librealsense
 
     rs2::frame hdr_merge::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
-        // steps:
-        // 1. get depth frame from incoming frameset
-        // 2. add the frameset to vector of framesets
-        // 3. check if size of this vector is at least 2 (if not - return latest merge frame)
-        // 4. pop out both framesets from the vector
-        // 5. apply merge algo
-        // 6. save merge frame as latest merge frame
-        // 7. return the merge frame
-
-        // 1. get depth frame from incoming frameset
+        // Each sub-frame of the sequence is merged as it arrives, into a frame started by the first of them: for every
+        // pixel, the depth of the sub-frame whose IR was the furthest from saturation there so far. The merge is
+        // returned once the last sub-frame is in; until then, the previous one is.
         auto fs = f.as<rs2::frameset>();
         auto depth_frame = fs.get_depth_frame();
 
-        // 2. add the frameset to vector of framesets
-        auto depth_seq_id = depth_frame.get_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID);
+        auto depth_seq_id = int(depth_frame.get_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID));
+        auto depth_seq_size = int(depth_frame.get_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_SIZE));
 
-        // condition added to ensure that frames are saved in the right order
-        // to prevent for example the saving of frame with sequence id 1 before
-        // saving frame of sequence id 0
-        // so that the merging with be deterministic - always done with frame n and n+1
-        // with frame n as basis
-        if (_framesets.size() == depth_seq_id)
-        {
-            _framesets[(int)depth_seq_id] = fs;
-        }
+        // Sub-frames are only merged in order, from sequence id 0, so the merge is deterministic - always done with
+        // frames n to n+size-1, with frame n as basis; any other frame drops the sequence being merged
+        if (depth_seq_id == 0)
+            start_sequence(source, depth_frame, depth_seq_size);
+        else if (_merging_frame && !continues_sequence(depth_frame, depth_seq_id, depth_seq_size))
+            _merging_frame = nullptr;
 
         // discard merged frame if not relevant
         discard_depth_merged_frame_if_needed(depth_frame);
 
-        // 3. check if size of this vector is at least 2 (if not - return latest merge frame)
-        if (_framesets.size() >= 2)
+        if (_merging_frame)
         {
-            // 4. pop out both framesets from the vector
-            rs2::frameset fs_0 = _framesets[0];
-            rs2::frameset fs_1 = _framesets[1];
-            _framesets.clear();
-
-            bool use_ir = false;
-            if (check_frames_mergeability(fs_0, fs_1, use_ir))
+            merge_into_sequence(depth_frame, fs.get_infrared_frame());
+            _last_frame_counter = depth_frame.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER);
+            if (++_next_sequence_id == _sequence_size)
             {
-                // 5. apply merge algo
-                rs2::frame new_frame = merging_algorithm(source, fs_0, fs_1, use_ir);
-                if (new_frame)
-                {
-                    // 6. save merge frame as latest merge frame
-                    _depth_merged_frame = new_frame;
-                }
+                _depth_merged_frame = std::move(_merging_frame);
+                _merging_frame = nullptr;
             }
         }
 
-        // 7. return the merge frame
         if (_depth_merged_frame)
             return _depth_merged_frame;
 
         return f;
     }
 
+    void hdr_merge::start_sequence(const rs2::frame_source& source, const rs2::depth_frame& depth, int sequence_size)
+    {
+        _merging_frame = nullptr;
+        _sequence_size = sequence_size;
+        _next_sequence_id = 0;
+
+        auto width = depth.get_width();
+        auto height = depth.get_height();
+        auto new_f = source.allocate_video_frame(depth.get_profile(), depth,
+            depth.get_bytes_per_pixel(), width, height, depth.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME);
+        if (!new_f)
+            return;
+
+        auto ptr = dynamic_cast<librealsense::depth_frame*>((librealsense::frame_interface*)new_f.get());
+        if (!ptr)
+            throw std::runtime_error("Frame interface is not depth frame");
+
+        auto orig = dynamic_cast<librealsense::depth_frame*>((librealsense::frame_interface*)depth.get());
+        if (!orig)
+            throw std::runtime_error("Frame interface is not depth frame");
+
+        ptr->set_sensor(orig->get_sensor());
+
+        // Nothing is trusted yet
+        size_t const width_height_product = size_t(width) * height;
+        memset((uint16_t*)ptr->get_frame_data(), 0, width_height_product * sizeof(uint16_t));
+        _confidence.assign(width_height_product, 0);
+        _merging_frame = new_f;
+    }
+
+    bool hdr_merge::continues_sequence(const rs2::depth_frame& depth, int sequence_id, int sequence_size) const
+    {
+        if (sequence_id != _next_sequence_id || sequence_size != _sequence_size)
+            return false;
+        // The aim of this checking is that the output merged frame will have frame counter n and
+        // will be created by frames n to n+size-1
+        if (depth.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER) != _last_frame_counter + 1)
+            return false;
+        // Depth dimensions must align
+        auto merging = _merging_frame.as<rs2::video_frame>();
+        return depth.get_width() == merging.get_width() && depth.get_height() == merging.get_height();
+    }
+
+    void hdr_merge::merge_into_sequence(const rs2::depth_frame& depth, const rs2::video_frame& ir)
+    {
+        auto merged = (uint16_t*)((librealsense::depth_frame*)_merging_frame.get())->get_frame_data();
+        auto d = (const uint16_t*)depth.get_data();
+        int width_height_product = depth.get_width() * depth.get_height();
+
+        // A sub-frame without usable IR only fills in the pixels no other sub-frame had
+        if (should_ir_be_used_for_merging(depth, ir))
+        {
+            if (ir.get_profile().format() == RS2_FORMAT_Y8)
+                merge_frame_using_ir<uint8_t>(merged, _confidence.data(), d, ir, width_height_product);
+            else
+                merge_frame_using_ir<uint16_t>(merged, _confidence.data(), d, ir, width_height_product);
+        }
+        else
+        {
+            merge_frame_using_only_depth(merged, _confidence.data(), d, width_height_product);
+        }
+    }
+
     void hdr_merge::discard_depth_merged_frame_if_needed(const rs2::frame& f)
     {
         if (_depth_merged_frame)
@@ -126,14 +172,15 @@ namespace librealsense
             // criteria for discarding saved merged_depth_frame:
             // 1 - frame counter for merged depth is greater than the input frame
             // 2 - resolution change
-            // 3 - delta between input frame counter and merged depth counter >= SEQUENTIAL_FRAMES_THRESHOLD
+            // 3 - delta between input frame counter and merged depth counter >= SEQUENTIAL_SEQUENCES_THRESHOLD sequences
             auto depth_merged_frame_counter = _depth_merged_frame.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER);
             auto input_frame_counter = f.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER);
 
             auto merged_d_profile = _depth_merged_frame.get_profile().as<rs2::video_stream_profile>();
             auto new_d_profile = f.get_profile().as<rs2::video_stream_profile>();
 
-            bool counter_diff_over_threshold_detected = ((input_frame_counter - depth_merged_frame_counter) >= SEQUENTIAL_FRAMES_THRESHOLD);
+            bool counter_diff_over_threshold_detected
+                = ((input_frame_counter - depth_merged_frame_counter) >= SEQUENTIAL_SEQUENCES_THRESHOLD * _sequence_size);
             bool restart_pipe_detected = (depth_merged_frame_counter > input_frame_counter);
             bool resolution_change_detected = (merged_d_profile.width() != new_d_profile.width()) ||
                 (merged_d_profile.height() != new_d_profile.height());
@@ -145,168 +192,115 @@ namespace librealsense
         }
     }
 
-    bool hdr_merge::check_frames_mergeability(const rs2::frameset first_fs, const rs2::frameset second_fs,
-        bool& use_ir) const
+    void hdr_merge::merge_frame_using_only_depth(uint16_t* merged, uint16_t* confidence, const uint16_t* depth,
+        int width_height_prod) const
     {
-        auto first_depth = first_fs.get_depth_frame();
-        auto second_depth = second_fs.get_depth_frame();
-        auto first_ir = first_fs.get_infrared_frame();
-        auto second_ir = second_fs.get_infrared_frame();
-
-        auto first_fs_frame_counter = first_depth.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER);
-        auto second_fs_frame_counter = second_depth.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER);
+        // Without IR, any depth is as good as any other: the first sub-frame to have it gives it
+        for (int i = merge_frame_using_only_depth_simd(merged, confidence, depth, width_height_prod); i < width_height_prod; i++)
+        {
+            if (depth[i] && !confidence[i])
+            {
+                merged[i] = depth[i];
+                confidence[i] = 1;
+            }
+        }
+    }
 
-        // The aim of this checking is that the output merged frame will have frame counter n and
-        // frame counter n and will be created by frames n and n+1
-        if (first_fs_frame_counter + 1 != second_fs_frame_counter)
-            return false;
-        // Depth dimensions must align
-        if ((first_depth.get_height() != second_depth.get_height()) ||
-            (first_depth.get_width() != second_depth.get_width()))
-            return false;
+#ifdef __SSSE3__
+    // Takes each pixel of the depth where its confidence c is higher than the merge's so far, along with c: exactly
+    // what the scalar loops do one pixel at a time
+    static void merge_depth_by_confidence(uint16_t* merged, uint16_t* confidence, __m128i d, __m128i c)
+    {
+        auto const zero = _mm_setzero_si128();
+        c = _mm_andnot_si128(_mm_cmpeq_epi16(d, zero), c);
+        auto const old_c = _mm_loadu_si128((const __m128i*)confidence);
+        // Confidences are well below 0x8000, so the signed compare is fine
+        auto const take = _mm_cmpgt_epi16(c, old_c);
+        _mm_storeu_si128((__m128i*)confidence, _mm_or_si128(_mm_and_si128(take, c), _mm_andnot_si128(take, old_c)));
+        auto const old_d = _mm_loadu_si128((const __m128i*)merged);
+        _mm_storeu_si128((__m128i*)merged, _mm_or_si128(_mm_and_si128(take, d), _mm_andnot_si128(take, old_d)));
+    }
 
-        use_ir = should_ir_be_used_for_merging(first_depth, first_ir, second_depth, second_ir);
+    // min(ir - under, over - ir), floored at 0, of 8 signed 16-bit IR values; values from 0x8000 up read as negative
+    // and are invalid either way
+    static __m128i ir_margin(__m128i ir, __m128i under, __m128i over)
+    {
+        auto const margin = _mm_min_epi16(_mm_subs_epi16(ir, under), _mm_subs_epi16(over, ir));
+        return _mm_max_epi16(margin, _mm_setzero_si128());
+    }
+#endif
 
-        return true;
+    int hdr_merge::merge_frame_using_only_depth_simd(uint16_t* merged, uint16_t* confidence, const uint16_t* depth,
+        int width_height_prod) const
+    {
+        int i = 0;
+#ifdef __SSSE3__
+        auto const one = _mm_set1_epi16(1);
+        for (; i + 8 <= width_height_prod; i += 8)
+            merge_depth_by_confidence(merged + i, confidence + i, _mm_loadu_si128((const __m128i*)(depth + i)), one);
+#endif
+        return i;
     }
 
-    rs2::frame hdr_merge::merging_algorithm(const rs2::frame_source& source, const rs2::frameset first_fs, const rs2::frameset second_fs, const bool use_ir) const
+    int hdr_merge::merge_frame_using_ir_simd(uint16_t* merged, uint16_t* confidence, const uint16_t* depth,
+        const uint8_t* ir, int width_height_prod) const
     {
-        auto first = first_fs;
-        auto second = second_fs;
-
-        auto first_depth = first.get_depth_frame();
-        auto second_depth = second.get_depth_frame();
-        auto first_ir = first.get_infrared_frame();
-        auto second_ir = second.get_infrared_frame();
-
-        // new frame allocation
-        auto vf = first_depth.as<rs2::depth_frame>();
-        auto width = vf.get_width();
-        auto height = vf.get_height();
-        auto new_f = source.allocate_video_frame(first_depth.get_profile(), first_depth,
-            vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME);
-
-        if (new_f)
+        int i = 0;
+#ifdef __SSSE3__
+        auto const zero = _mm_setzero_si128();
+        auto const under = _mm_set1_epi16(short(IR_UNDER_SATURATED_VALUE_Y8));
+        auto const over = _mm_set1_epi16(short(IR_OVER_SATURATED_VALUE_Y8));
+        for (; i + 16 <= width_height_prod; i += 16)
         {
-            auto ptr = dynamic_cast<librealsense::depth_frame*>((librealsense::frame_interface*)new_f.get());
-            if (!ptr)
-                throw std::runtime_error("Frame interface is not depth frame");
-
-            auto orig = dynamic_cast<librealsense::depth_frame*>((librealsense::frame_interface*)first_depth.get());
-            if (!orig)
-                throw std::runtime_error("Frame interface is not depth frame");
-
-            auto d0 = (uint16_t*)first_depth.get_data();
-            auto d1 = (uint16_t*)second_depth.get_data();
-
-            auto new_data = (uint16_t*)ptr->get_frame_data();
-
-            ptr->set_sensor(orig->get_sensor());
-
-            memset(new_data, 0, width * height * sizeof(uint16_t));
-
-            int width_height_product = width * height;
-
-            if (use_ir)
-            {
-                if (first_ir.get_profile().format() == RS2_FORMAT_Y8)
-                {
-                    merge_frames_using_ir<uint8_t>(new_data, d0, d1, first_ir, second_ir, width_height_product);
-                }
-                else if (first_ir.get_profile().format() == RS2_FORMAT_Y16)
-                {
-                    merge_frames_using_ir<uint16_t>(new_data, d0, d1, first_ir, second_ir, width_height_product);
-                }
-                else
-                {
-                    merge_frames_using_only_depth(new_data, d0, d1, width_height_product);
-                }
-            }
-            else
-            {
-                merge_frames_using_only_depth(new_data, d0, d1, width_height_product);
-            }
-
-            return new_f;
+            // widen the bytes to the 16-bit depth pixels; in 10-bit units, as for Y16
+            auto const v = _mm_loadu_si128((const __m128i*)(ir + i));
+            auto const c0 = _mm_slli_epi16(ir_margin(_mm_unpacklo_epi8(v, zero), under, over), 2);
+            auto const c1 = _mm_slli_epi16(ir_margin(_mm_unpackhi_epi8(v, zero), under, over), 2);
+            merge_depth_by_confidence(merged + i, confidence + i, _mm_loadu_si128((const __m128i*)(depth + i)), c0);
+            merge_depth_by_confidence(merged + i + 8, confidence + i + 8, _mm_loadu_si128((const __m128i*)(depth + i + 8)), c1);
         }
-        return first_fs;
+#endif
+        return i;
     }
 
-    void hdr_merge::merge_frames_using_only_depth(uint16_t* new_data, uint16_t* d0, uint16_t* d1, int width_height_prod) const
+    int hdr_merge::merge_frame_using_ir_simd(uint16_t* merged, uint16_t* confidence, const uint16_t* depth,
+        const uint16_t* ir, int width_height_prod) const
     {
-        for (int i = 0; i < width_height_prod; i++)
+        int i = 0;
+#ifdef __SSSE3__
+        auto const under = _mm_set1_epi16(short(IR_UNDER_SATURATED_VALUE_Y16));
+        auto const over = _mm_set1_epi16(short(IR_OVER_SATURATED_VALUE_Y16));
+        for (; i + 8 <= width_height_prod; i += 8)
         {
-            if (d0[i])
-                new_data[i] = d0[i];
-            else if (d1[i])
-                new_data[i] = d1[i];
-            else
-                new_data[i] = 0;
+            auto const c = ir_margin(_mm_loadu_si128((const __m128i*)(ir + i)), under, over);
+            merge_depth_by_confidence(merged + i, confidence + i, _mm_loadu_si128((const __m128i*)(depth + i)), c);
         }
+#endif
+        return i;
     }
 
-    bool hdr_merge::should_ir_be_used_for_merging(const rs2::depth_frame& first_depth, const rs2::video_frame& first_ir,
-        const rs2::depth_frame& second_depth, const rs2::video_frame& second_ir) const
+    bool hdr_merge::should_ir_be_used_for_merging(const rs2::depth_frame& depth, const rs2::video_frame& ir) const
     {
-        // checking ir frames are not null
-        bool use_ir = (first_ir && second_ir);
-
-        if (use_ir)
-        {
-            // IR and Depth dimensions must be aligned
-            if ((first_depth.get_height() != first_ir.get_height()) ||
-                (first_depth.get_width() != first_ir.get_width()) ||
-                (second_ir.get_height() != first_ir.get_height()) ||
-                (second_ir.get_width() != first_ir.get_width()))
-                use_ir = false;
-        }
+        // checking ir frame is not null
+        if (!ir)
+            return false;
 
-        // checking frame counter of first depth and ir are the same
-        if (use_ir)
-        {
-            // on devices that does not support meta data on IR frames, do not use IR for hdr merging
-            if (!first_ir.supports_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER)  ||
-                !second_ir.supports_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER) ||
-                !first_ir.supports_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID)    ||
-                !second_ir.supports_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID))
+        // IR and Depth dimensions must be aligned
+        if ((depth.get_height() != ir.get_height()) ||
+            (depth.get_width() != ir.get_width()))
             return false;
 
-            int depth_frame_counter = static_cast<int>(first_depth.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER));
-            int ir_frame_counter = static_cast<int>(first_ir.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER));
-            use_ir = (depth_frame_counter == ir_frame_counter);
+        auto format = ir.get_profile().format();
+        if (format != RS2_FORMAT_Y8 && format != RS2_FORMAT_Y16)
+            return false;
 
-            // checking frame counter of second depth and ir are the same
-            if (use_ir)
-            {
-                depth_frame_counter = static_cast<int>(second_depth.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER));
-                ir_frame_counter = static_cast<int>(second_ir.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER));
-                use_ir = (depth_frame_counter == ir_frame_counter);
-
-                // checking sequence id of first depth and ir are the same
-                if (use_ir)
-                {
-                    auto depth_seq_id = first_depth.get_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID);
-                    auto ir_seq_id = first_ir.get_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID);
-                    use_ir = (depth_seq_id == ir_seq_id);
-
-                    // checking sequence id of second depth and ir are the same
-                    if (use_ir)
-                    {
-                        depth_seq_id = second_depth.get_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID);
-                        ir_seq_id = second_ir.get_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID);
-                        use_ir = (depth_seq_id == ir_seq_id);
-
-                        // checking both ir have the same format
-                        if (use_ir)
-                        {
-                            use_ir = (first_ir.get_profile().format() == second_ir.get_profile().format());
-                        }
-                    }
-                }
-            }
-        }
+        // on devices that does not support meta data on IR frames, do not use IR for hdr merging
+        if (!ir.supports_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER) ||
+            !ir.supports_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID))
+            return false;
 
-        return use_ir;
+        // checking frame counter and sequence id of depth and ir are the same
+        return depth.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER) == ir.get_frame_metadata(RS2_FRAME_METADATA_FRAME_COUNTER)
+            && depth.get_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID) == ir.get_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID);
     }
 }
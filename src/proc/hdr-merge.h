@@ -7,6 +7,9 @@ Copyright(c) 2020 Intel Corporation. All Rights Reserved. */
 #include "synthetic-stream.h"
 #include "option.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace librealsense
 {
     class hdr_merge : public generic_processing_block
@@ -28,60 +31,76 @@ namespace librealsense
         const int IR_OVER_SATURATED_VALUE_Y16 = 0x3eb; // 1003 (1023 - IR_UNDER_SATURATED_VALUE_Y16)
 
         const int NUMBER_OF_FRAMES_WITHOUT_METADATA_FOR_WARNING = 20;
-        const int SEQUENTIAL_FRAMES_THRESHOLD = 4; // avoids returning too old merged frame - frame counter jumps forward 
+        const int MAX_SEQUENCE_SIZE = 4;
+        // avoids returning too old merged frame - frame counter jumps forward by this many whole sequences
+        const int SEQUENTIAL_SEQUENCES_THRESHOLD = 2;
 
         void reset_warning_counter_on_pipe_restart(const rs2::depth_frame& depth_frame);
         void discard_depth_merged_frame_if_needed(const rs2::frame& f);
 
-        bool check_frames_mergeability(const rs2::frameset first_fs, const rs2::frameset second_fs, bool& use_ir) const;
-        bool should_ir_be_used_for_merging(const rs2::depth_frame& first_depth, const rs2::video_frame& first_ir,
-            const rs2::depth_frame& second_depth, const rs2::video_frame& second_ir) const;
-        rs2::frame merging_algorithm(const rs2::frame_source& source, const rs2::frameset first_fs,
-            const rs2::frameset second_fs, const bool use_ir) const;
+        // Starts merging a new sequence into a new frame, from its first depth frame
+        void start_sequence(const rs2::frame_source& source, const rs2::depth_frame& depth, int sequence_size);
+        bool continues_sequence(const rs2::depth_frame& depth, int sequence_id, int sequence_size) const;
+        bool should_ir_be_used_for_merging(const rs2::depth_frame& depth, const rs2::video_frame& ir) const;
+        // Takes the pixels of 'depth' that are more trustworthy than what the merge has so far
+        void merge_into_sequence(const rs2::depth_frame& depth, const rs2::video_frame& ir);
         template <typename T>
-        bool is_infrared_valid(T ir_value, rs2_format ir_format) const;
+        int ir_confidence(T ir_value, rs2_format ir_format) const;
         template <typename T>
-        void merge_frames_using_ir(uint16_t* new_data, uint16_t* d0, uint16_t* d1,
-            const rs2::video_frame& first_ir, const rs2::video_frame& second_ir, int width_height_prod) const;
-        void merge_frames_using_only_depth(uint16_t* new_data, uint16_t* d0, uint16_t* d1, int width_height_prod) const;
+        void merge_frame_using_ir(uint16_t* merged, uint16_t* confidence, const uint16_t* depth,
+            const rs2::video_frame& ir, int width_height_prod) const;
+        void merge_frame_using_only_depth(uint16_t* merged, uint16_t* confidence, const uint16_t* depth,
+            int width_height_prod) const;
+
+        // Vectorized merging of the start of the frames; each returns how many pixels it merged, the rest are for the
+        // caller's scalar loop
+        int merge_frame_using_ir_simd(uint16_t* merged, uint16_t* confidence, const uint16_t* depth,
+            const uint8_t* ir, int width_height_prod) const;
+        int merge_frame_using_ir_simd(uint16_t* merged, uint16_t* confidence, const uint16_t* depth,
+            const uint16_t* ir, int width_height_prod) const;
+        int merge_frame_using_only_depth_simd(uint16_t* merged, uint16_t* confidence, const uint16_t* depth,
+            int width_height_prod) const;
 
         unsigned long long _previous_depth_frame_counter;
         int _frames_without_requested_metadata_counter;
-        std::map<int, rs2::frameset> _framesets;
+        // The sequence being merged, one sub-frame at a time as they arrive: the frame it goes into, and the
+        // confidence in each of its pixels so far (0 for none)
+        rs2::frame _merging_frame;
+        std::vector<uint16_t> _confidence;
+        int _sequence_size = 0;
+        int _next_sequence_id = 0;
+        unsigned long long _last_frame_counter = 0;
         rs2::frame _depth_merged_frame;
     };
     MAP_EXTENSION(RS2_EXTENSION_HDR_MERGE, librealsense::hdr_merge);
 
     template <typename T>
-    void hdr_merge::merge_frames_using_ir(uint16_t* new_data, uint16_t* d0, uint16_t* d1,
-        const rs2::video_frame& first_ir, const rs2::video_frame& second_ir, int width_height_prod) const
+    void hdr_merge::merge_frame_using_ir(uint16_t* merged, uint16_t* confidence, const uint16_t* depth,
+        const rs2::video_frame& ir, int width_height_prod) const
     {
-        auto i0 = (T*)first_ir.get_data();
-        auto i1 = (T*)second_ir.get_data();
-
-        auto format = first_ir.get_profile().format();
+        auto ir_data = (const T*)ir.get_data();
+        auto format = ir.get_profile().format();
 
-        for (int i = 0; i < width_height_prod; i++)
+        for (int i = merge_frame_using_ir_simd(merged, confidence, depth, ir_data, width_height_prod); i < width_height_prod; i++)
         {
-            if (is_infrared_valid<T>(i0[i], format) && d0[i])
-                new_data[i] = d0[i];
-            else if (is_infrared_valid<T>(i1[i], format) && d1[i])
-                new_data[i] = d1[i];
-            else
-                new_data[i] = 0;
+            int c = depth[i] ? ir_confidence<T>(ir_data[i], format) : 0;
+            if (c > confidence[i])
+            {
+                merged[i] = depth[i];
+                confidence[i] = uint16_t(c);
+            }
         }
     }
 
+    // How far inside the valid range an IR value is, in 10-bit units; 0 when it is under- or over-saturated
     template <typename T>
-    bool hdr_merge::is_infrared_valid(T ir_value, rs2_format ir_format) const
+    int hdr_merge::ir_confidence(T ir_value, rs2_format ir_format) const
     {
-        bool result = false;
+        int margin = 0;
         if (ir_format == RS2_FORMAT_Y8)
-            result = (ir_value > IR_UNDER_SATURATED_VALUE_Y8) && (ir_value < IR_OVER_SATURATED_VALUE_Y8);
+            margin = 4 * std::min(int(ir_value) - IR_UNDER_SATURATED_VALUE_Y8, IR_OVER_SATURATED_VALUE_Y8 - int(ir_value));
         else if (ir_format == RS2_FORMAT_Y16)
-            result = (ir_value > IR_UNDER_SATURATED_VALUE_Y16) && (ir_value < IR_OVER_SATURATED_VALUE_Y16);
-        else
-            result = false;
-        return result;
+            margin = std::min(int(ir_value) - IR_UNDER_SATURATED_VALUE_Y16, IR_OVER_SATURATED_VALUE_Y16 - int(ir_value));
+        return std::max(0, margin);
     }
 }
@@ -9,6 +9,8 @@
 #include "software-device.h"
 #include "proc/synthetic-stream.h"
 #include "proc/hole-filling-filter.h"
+#include "proc/hole-filling-simd.h"
+#include "cpu-features.h"
 
 #include <rsutils/string/from.h>
 
@@ -58,6 +60,7 @@ namespace librealsense
         });
 
         register_option(RS2_OPTION_HOLES_FILL, hole_filling_mode);
+        register_in_place_option();
     }
 
     rs2::frame hole_filling_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -66,10 +69,17 @@ namespace librealsense
         auto tgt = prepare_target_frame(f, source);
 
         // Hole filling pass
-        if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
+#ifdef RS2_USE_CUDA
+        if (_bpp == sizeof(float))
+            _cuda_helper.fill_disparity(static_cast<float*>(const_cast<void*>(tgt.get_data())), int(_width), int(_height), _hole_filling_mode);
+        else
+            _cuda_helper.fill_depth(static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())), int(_width), int(_height), _hole_filling_mode);
+#else
+        if (_bpp == sizeof(float))
             apply_hole_filling<float>(const_cast<void*>(tgt.get_data()));
         else
             apply_hole_filling<uint16_t>(const_cast<void*>(tgt.get_data()));
+#endif
 
         return tgt;
     }
@@ -82,7 +92,9 @@ namespace librealsense
             _target_stream_profile = _source_stream_profile.clone(RS2_STREAM_DEPTH, 0, _source_stream_profile.format());
 
             _extension_type = f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME;
-            _bpp = (_extension_type == RS2_EXTENSION_DISPARITY_FRAME) ? sizeof(float) : sizeof(uint16_t);
+            // Fixed-point disparity is filled as depth is: the methods only compare values
+            _bpp = (_extension_type == RS2_EXTENSION_DISPARITY_FRAME && f.get_profile().format() != RS2_FORMAT_DISPARITY16)
+                 ? sizeof(float) : sizeof(uint16_t);
             auto vp = _target_stream_profile.as<rs2::video_stream_profile>();
             _width = vp.width();
             _height = vp.height();
@@ -94,6 +106,9 @@ namespace librealsense
 
     rs2::frame hole_filling_filter::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
     {
+        if (auto tgt = reuse_input(f, _target_stream_profile))
+            return tgt;
+
         // Allocate and copy the content of the input data to the target
         rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, int(_bpp), int(_width), int(_height), int(_stride), _extension_type);
 
@@ -101,4 +116,30 @@ namespace librealsense
         return tgt;
     }
 
+    size_t hole_filling_filter::fill_left_simd(uint16_t* row, size_t width)
+    {
+#ifdef RS2_HOLE_FILLING_SIMD
+        if (get_simd_level() >= simd_level::simd128)
+            return hf_simd::fill_left(row, width);
+#endif
+        return 1;
+    }
+
+    size_t hole_filling_filter::fill_farest_simd(uint16_t* row, size_t width)
+    {
+#ifdef RS2_HOLE_FILLING_SIMD
+        if (get_simd_level() >= simd_level::simd128)
+            return hf_simd::fill_farthest(row, row - width, row + width, width);
+#endif
+        return 1;
+    }
+
+    size_t hole_filling_filter::fill_nearest_simd(uint16_t* row, size_t width)
+    {
+#ifdef RS2_HOLE_FILLING_SIMD
+        if (get_simd_level() >= simd_level::simd128)
+            return hf_simd::fill_nearest(row, row - width, row + width, width);
+#endif
+        return 1;
+    }
 }
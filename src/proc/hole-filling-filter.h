@@ -5,6 +5,10 @@
 
 #include <rsutils/string/from.h>
 
+#ifdef RS2_USE_CUDA
+#include "../cuda/cuda-depth-filters.cuh"
+#endif
+
 namespace librealsense
 {
     enum holes_filling_types : uint8_t
@@ -54,20 +58,14 @@ namespace librealsense
         template<typename T>
         inline void holes_fill_left(T* image_data, size_t width, size_t height, size_t stride)
         {
-            std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
-            std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
-            auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
-
             T* p = image_data;
 
-            for (size_t j = 0; j < height; ++j)
+            for (size_t j = 0; j < height; ++j, p += width)
             {
-                ++p;
-                for (size_t i = 1; i < width; ++i)
+                for (size_t i = fill_left_simd(p, width); i < width; ++i)
                 {
-                    if (empty(p))
-                        *p = *(p - 1);
-                    ++p;
+                    if (empty(p + i))
+                        p[i] = p[i - 1];
                 }
             }
         }
@@ -75,18 +73,14 @@ namespace librealsense
         template<typename T>
         inline void holes_fill_farest(T* image_data, size_t width, size_t height, size_t stride)
         {
-            std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
-            std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
-            auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
-
             T tmp = 0;
-            T * p = image_data + width;
             T * q = nullptr;
-            for (int j = 1; j < height - 1; ++j)
+            for (size_t j = 1; j + 1 < height; ++j)
             {
-                ++p;
-                for (size_t i = 1; i < width; ++i)
+                T * row = image_data + j * width;
+                for (size_t i = fill_farest_simd(row, width); i < width; ++i)
                 {
+                    T * p = row + i;
                     if (empty(p))
                     {
                         tmp = *(p - width);
@@ -109,8 +103,6 @@ namespace librealsense
 
                         *p = tmp;
                     }
-
-                    p++;
                 }
             }
         }
@@ -118,18 +110,14 @@ namespace librealsense
         template<typename T>
         inline void holes_fill_nearest(T* image_data, size_t width, size_t height, size_t stride)
         {
-            std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
-            std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
-            auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
-
             T tmp = 0;
-            T * p = image_data + width;
             T * q = nullptr;
-            for (int j = 1; j < height - 1; ++j)
+            for (size_t j = 1; j + 1 < height; ++j)
             {
-                ++p;
-                for (size_t i = 1; i < width; ++i)
+                T * row = image_data + j * width;
+                for (size_t i = fill_nearest_simd(row, width); i < width; ++i)
                 {
+                    T * p = row + i;
                     if (empty(p))
                     {
                         tmp = *(p - width);
@@ -152,13 +140,29 @@ namespace librealsense
 
                         *p = tmp;
                     }
-
-                    p++;
                 }
             }
         }
 
+        // Disparity pixels are empty when all their bits are zero
+        static bool empty(const float* p) { return !*((const int *)p); }
+        template<typename T>
+        static bool empty(const T* p) { return !(*p); }
+
+        // The SIMD row loops (see hole-filling-simd.h) are for depth; each returns the column the scalar loop goes on
+        // from, 1 when there is none
+        template<typename T>
+        static size_t fill_left_simd(T*, size_t) { return 1; }
+        template<typename T>
+        static size_t fill_farest_simd(T*, size_t) { return 1; }
+        template<typename T>
+        static size_t fill_nearest_simd(T*, size_t) { return 1; }
+        static size_t fill_left_simd(uint16_t* row, size_t width);
+        static size_t fill_farest_simd(uint16_t* row, size_t width);
+        static size_t fill_nearest_simd(uint16_t* row, size_t width);
+
     private:
+        friend class depth_postprocess;  // fills bands of rows
 
         size_t                  _width, _height, _stride;
         size_t                  _bpp;
@@ -167,6 +171,9 @@ namespace librealsense
         rs2::stream_profile     _source_stream_profile;
         rs2::stream_profile     _target_stream_profile;
         uint8_t                 _hole_filling_mode;
+#ifdef RS2_USE_CUDA
+        rscuda::hole_filling_cuda_helper _cuda_helper;
+#endif
     };
     MAP_EXTENSION(RS2_EXTENSION_HOLE_FILLING_FILTER, librealsense::hole_filling_filter);
 }
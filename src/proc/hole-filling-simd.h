@@ -0,0 +1,190 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+// Eight-lane versions of the hole filling filter's row loops, for depth (16-bit) images.
+//
+// What makes the scalar loops sequential is that a hole takes its left neighbour as already filled. Every mode is a
+// recurrence along the row of the form out[i] = k[i] ? a[i] : op(a[i], out[i-1]), where op is max or min and k, a
+// depend only on the pixel and the rows above (already filled) and below (not yet filled). Such steps compose into
+// another step of the same form, so a vector of them is reduced with a log-step scan, and then applied to the value
+// carried in from the pixels before it. The results are the same as the scalar loops'.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined( __SSSE3__ )
+#include <tmmintrin.h>
+#define RS2_HOLE_FILLING_SIMD "SSSE3"
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#include <arm_neon.h>
+#define RS2_HOLE_FILLING_SIMD "NEON"
+#endif
+
+
+#ifdef RS2_HOLE_FILLING_SIMD
+
+namespace librealsense {
+namespace hf_simd {
+
+
+static constexpr size_t LANES = 8;
+
+#if defined( __SSSE3__ )
+
+using vu = __m128i;
+
+inline vu load( uint16_t const * p ) { return _mm_loadu_si128( reinterpret_cast< const __m128i * >( p ) ); }
+inline void store( uint16_t * p, vu v ) { _mm_storeu_si128( reinterpret_cast< __m128i * >( p ), v ); }
+inline vu splat( uint16_t x ) { return _mm_set1_epi16( short( x ) ); }
+// Unsigned min/max take SSE4.1, so these go through saturated subtraction
+inline vu max( vu a, vu b ) { return _mm_add_epi16( _mm_subs_epu16( a, b ), b ); }
+inline vu min( vu a, vu b ) { return _mm_sub_epi16( a, _mm_subs_epu16( a, b ) ); }
+inline vu is_zero( vu a ) { return _mm_cmpeq_epi16( a, _mm_setzero_si128() ); }
+inline vu is_nonzero( vu a ) { return _mm_xor_si128( is_zero( a ), _mm_set1_epi32( -1 ) ); }
+inline vu either( vu a, vu b ) { return _mm_or_si128( a, b ); }
+inline vu both( vu a, vu b ) { return _mm_and_si128( a, b ); }
+inline vu select( vu m, vu a, vu b ) { return _mm_or_si128( _mm_and_si128( m, a ), _mm_andnot_si128( m, b ) ); }
+inline bool all_nonzero( vu a ) { return _mm_movemask_epi8( is_zero( a ) ) == 0; }
+inline uint16_t last( vu a ) { return uint16_t( _mm_extract_epi16( a, 7 ) ); }
+// Moves the lanes up by N, the first N lanes coming from the top of 'fill'
+template< int N > inline vu shift_in( vu a, vu fill ) { return _mm_alignr_epi8( a, fill, 16 - 2 * N ); }
+
+#else  // NEON
+
+using vu = uint16x8_t;
+
+inline vu load( uint16_t const * p ) { return vld1q_u16( p ); }
+inline void store( uint16_t * p, vu v ) { vst1q_u16( p, v ); }
+inline vu splat( uint16_t x ) { return vdupq_n_u16( x ); }
+inline vu max( vu a, vu b ) { return vmaxq_u16( a, b ); }
+inline vu min( vu a, vu b ) { return vminq_u16( a, b ); }
+inline vu is_zero( vu a ) { return vceqq_u16( a, vdupq_n_u16( 0 ) ); }
+inline vu is_nonzero( vu a ) { return vtstq_u16( a, a ); }
+inline vu either( vu a, vu b ) { return vorrq_u16( a, b ); }
+inline vu both( vu a, vu b ) { return vandq_u16( a, b ); }
+inline vu select( vu m, vu a, vu b ) { return vbslq_u16( m, a, b ); }
+inline bool all_nonzero( vu a )
+{
+    uint16x4_t m = vpmin_u16( vget_low_u16( a ), vget_high_u16( a ) );
+    m = vpmin_u16( m, m );
+    m = vpmin_u16( m, m );
+    return vget_lane_u16( m, 0 ) != 0;
+}
+inline uint16_t last( vu a ) { return vgetq_lane_u16( a, 7 ); }
+template< int N > inline vu shift_in( vu a, vu fill ) { return vextq_u16( fill, a, 8 - N ); }
+
+#endif
+
+
+struct max_op
+{
+    static vu apply( vu a, vu b ) { return max( a, b ); }
+    static uint16_t identity() { return 0; }
+};
+
+struct min_op
+{
+    static vu apply( vu a, vu b ) { return min( a, b ); }
+    static uint16_t identity() { return 0xFFFF; }
+};
+
+
+// Composes each lane's step with those of the lanes before it
+template< class Op, int N >
+inline void compose( vu & k, vu & a )
+{
+    vu const previous_a = shift_in< N >( a, splat( Op::identity() ) );
+    vu const previous_k = shift_in< N >( k, splat( 0 ) );
+    a = select( k, a, Op::apply( a, previous_a ) );
+    k = either( k, previous_k );
+}
+
+// Runs the steps of the lanes after 'carry', the previous output, which is updated to the last lane's
+template< class Op >
+inline vu scan( vu k, vu a, uint16_t & carry )
+{
+    compose< Op, 1 >( k, a );
+    compose< Op, 2 >( k, a );
+    compose< Op, 4 >( k, a );
+    vu const out = select( k, a, Op::apply( a, splat( carry ) ) );
+    carry = last( out );
+    return out;
+}
+
+
+// Each of these fills a row from column 1 on and returns where the scalar loop should continue. Pixels are
+// out[i] = v[i] ? v[i] : ... of the value v they have when their turn comes.
+
+// Fill from left: out[i-1]
+inline size_t fill_left( uint16_t * row, size_t width )
+{
+    uint16_t carry = row[0];
+    size_t i = 1;
+    for( ; i + LANES <= width; i += LANES )
+    {
+        vu const v = load( row + i );
+        if( ! all_nonzero( v ) )
+            store( row + i, scan< max_op >( is_nonzero( v ), v, carry ) );
+        else
+            carry = last( v );
+    }
+    return i;
+}
+
+// Farthest from around: the largest of the pixels above, above-left, left, below-left and below
+inline size_t fill_farthest( uint16_t * row, uint16_t const * above, uint16_t const * below, size_t width )
+{
+    uint16_t carry = row[0];
+    size_t i = 1;
+    for( ; i + LANES <= width; i += LANES )
+    {
+        vu const v = load( row + i );
+        if( all_nonzero( v ) )
+        {
+            carry = last( v );
+            continue;
+        }
+        vu const around = max( max( load( above + i ), load( above + i - 1 ) ),
+                               max( load( below + i - 1 ), load( below + i ) ) );
+        vu const k = is_nonzero( v );
+        store( row + i, scan< max_op >( k, select( k, v, around ), carry ) );
+    }
+    return i;
+}
+
+// Nearest from around: the smallest of the non-empty pixels above-left, left, below-left and below, and the pixel
+// above -- which is taken even when empty, leaving the hole empty.
+//
+// The recurrence is on e(out), e mapping empty pixels to the largest value, so that the minimum skips them: a hole
+// whose other neighbours give 0 (the pixel above being empty) stays empty whatever its left neighbour, and passes on
+// an empty left neighbour to the next pixel.
+inline size_t fill_nearest( uint16_t * row, uint16_t const * above, uint16_t const * below, size_t width )
+{
+    auto const e = []( vu x ) { return either( x, is_zero( x ) ); };
+    uint16_t carry = row[0] ? row[0] : 0xFFFF;
+    size_t i = 1;
+    for( ; i + LANES <= width; i += LANES )
+    {
+        vu const v = load( row + i );
+        if( all_nonzero( v ) )
+        {
+            carry = last( v );
+            continue;
+        }
+        vu const around = min( min( load( above + i ), e( load( above + i - 1 ) ) ),
+                               min( e( load( below + i - 1 ) ), e( load( below + i ) ) ) );
+        vu const valid = is_nonzero( v );
+        vu const stays_empty = is_zero( around );
+        vu const out = scan< min_op >( either( valid, stays_empty ), select( valid, v, e( around ) ), carry );
+        store( row + i, select( both( is_zero( v ), stays_empty ), splat( 0 ), out ) );
+    }
+    return i;
+}
+
+
+}  // namespace hf_simd
+}  // namespace librealsense
+
+#endif  // RS2_HOLE_FILLING_SIMD
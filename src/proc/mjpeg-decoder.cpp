@@ -0,0 +1,79 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "mjpeg-decoder.h"
+
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <cstring>
+
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#include "../third-party/stb_image.h"
+
+#ifdef RS2_USE_TURBOJPEG
+#include <turbojpeg.h>
+#endif
+
+
+namespace librealsense
+{
+    // Baseline decoder, always available. stb allocates the image itself, so it is copied into the frame.
+    class stb_mjpeg_decoder : public mjpeg_decoder
+    {
+    public:
+        bool decode_rgb8( uint8_t const * src, size_t size, uint8_t * dst, int width, int height ) override
+        {
+            int w, h, bpp;
+            auto rgb = stbi_load_from_memory( src, int( size ), &w, &h, &bpp, 3 );
+            if( ! rgb )
+                return false;
+            bool const ok = w == width && h == height;
+            if( ok )
+                std::memcpy( dst, rgb, size_t( w ) * h * 3 );
+            stbi_image_free( rgb );
+            return ok;
+        }
+
+        const char * get_name() const override { return "stb"; }
+    };
+
+
+#ifdef RS2_USE_TURBOJPEG
+    // libjpeg-turbo's SIMD decoder, decoding straight into the frame
+    class turbojpeg_mjpeg_decoder : public mjpeg_decoder
+    {
+        tjhandle _handle;
+
+    public:
+        explicit turbojpeg_mjpeg_decoder( tjhandle handle )
+            : _handle( handle )
+        {
+        }
+        ~turbojpeg_mjpeg_decoder() override { tjDestroy( _handle ); }
+
+        bool decode_rgb8( uint8_t const * src, size_t size, uint8_t * dst, int width, int height ) override
+        {
+            int w, h, subsampling, colorspace;
+            if( tjDecompressHeader3( _handle, src, (unsigned long)size, &w, &h, &subsampling, &colorspace ) )
+                return false;
+            if( w != width || h != height )
+                return false;
+            return ! tjDecompress2( _handle, src, (unsigned long)size, dst, width, width * 3, height, TJPF_RGB, 0 );
+        }
+
+        const char * get_name() const override { return "libjpeg-turbo"; }
+    };
+#endif
+
+
+    std::shared_ptr< mjpeg_decoder > mjpeg_decoder::create()
+    {
+#ifdef RS2_USE_TURBOJPEG
+        if( auto handle = tjInitDecompress() )
+            return std::make_shared< turbojpeg_mjpeg_decoder >( handle );
+        LOG_WARNING( "Failed to initialize libjpeg-turbo (" << tjGetErrorStr() << "); falling back to stb for MJPEG" );
+#endif
+        return std::make_shared< stb_mjpeg_decoder >();
+    }
+}
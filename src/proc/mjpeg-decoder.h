@@ -0,0 +1,31 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+
+namespace librealsense
+{
+    // Decodes MJPEG frames for the mjpeg_converter.
+    //
+    // Backends are chosen at build time; create() returns the best one available. Each converter owns its decoder and
+    // only calls it from its own processing thread, so a backend may keep state (handles, scratch buffers) between
+    // frames without locking.
+    class mjpeg_decoder
+    {
+    public:
+        virtual ~mjpeg_decoder() = default;
+
+        // Decodes the JPEG image in [src, src + size) into 'dst', which has room for width * height RGB8 pixels.
+        // Returns false (leaving 'dst' unspecified) if the image could not be decoded or is not width x height.
+        virtual bool decode_rgb8( uint8_t const * src, size_t size, uint8_t * dst, int width, int height ) = 0;
+
+        virtual const char * get_name() const = 0;
+
+        static std::shared_ptr< mjpeg_decoder > create();
+    };
+}
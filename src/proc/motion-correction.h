@@ -0,0 +1,77 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <rsutils/number/float3.h>
+#include <librealsense2/h/rs_sensor.h>
+
+#include <cstddef>
+
+#if defined( __SSSE3__ ) || defined( __SSE2__ ) || defined( _M_X64 )
+#include <emmintrin.h>
+#define RS2_MOTION_CORRECTION_SIMD "SSE"
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#include <arm_neon.h>
+#define RS2_MOTION_CORRECTION_SIMD "NEON"
+#endif
+
+
+namespace librealsense {
+
+
+// The whole correction of an IMU sample -- alignment to the depth coordinate system, then sensitivity and bias if
+// motion correction is on -- folded into a single affine transform: xyz' = m * xyz + offset
+//
+struct motion_correction
+{
+    rsutils::number::float3x3 m = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };  // column-major
+    rsutils::number::float3 offset = { 0, 0, 0 };
+
+    rsutils::number::float3 operator()( rsutils::number::float3 const & xyz ) const { return m * xyz + offset; }
+
+    // Corrects the samples in-place, a whole batch at a time
+    void apply( rs2_motion_sample * samples, size_t n ) const
+    {
+#if defined( __SSSE3__ ) || defined( __SSE2__ ) || defined( _M_X64 )
+        __m128 const x = _mm_setr_ps( m.x.x, m.x.y, m.x.z, 0 );
+        __m128 const y = _mm_setr_ps( m.y.x, m.y.y, m.y.z, 0 );
+        __m128 const z = _mm_setr_ps( m.z.x, m.z.y, m.z.z, 0 );
+        __m128 const b = _mm_setr_ps( offset.x, offset.y, offset.z, 0 );
+        for( auto s = samples, end = samples + n; s < end; ++s )
+        {
+            // The fourth lane reads into the timestamp, and is never stored
+            __m128 const v = _mm_loadu_ps( &s->data.x );
+            __m128 r = _mm_add_ps( b, _mm_mul_ps( x, _mm_shuffle_ps( v, v, _MM_SHUFFLE( 0, 0, 0, 0 ) ) ) );
+            r = _mm_add_ps( r, _mm_mul_ps( y, _mm_shuffle_ps( v, v, _MM_SHUFFLE( 1, 1, 1, 1 ) ) ) );
+            r = _mm_add_ps( r, _mm_mul_ps( z, _mm_shuffle_ps( v, v, _MM_SHUFFLE( 2, 2, 2, 2 ) ) ) );
+            _mm_storel_pi( reinterpret_cast< __m64 * >( &s->data.x ), r );
+            _mm_store_ss( &s->data.z, _mm_movehl_ps( r, r ) );
+        }
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+        float const cols[4][4] = { { m.x.x, m.x.y, m.x.z, 0 },
+                                   { m.y.x, m.y.y, m.y.z, 0 },
+                                   { m.z.x, m.z.y, m.z.z, 0 },
+                                   { offset.x, offset.y, offset.z, 0 } };
+        float32x4_t const x = vld1q_f32( cols[0] ), y = vld1q_f32( cols[1] ), z = vld1q_f32( cols[2] );
+        float32x4_t const b = vld1q_f32( cols[3] );
+        for( auto s = samples, end = samples + n; s < end; ++s )
+        {
+            float32x4_t r = vmlaq_n_f32( b, x, s->data.x );
+            r = vmlaq_n_f32( r, y, s->data.y );
+            r = vmlaq_n_f32( r, z, s->data.z );
+            vst1_f32( &s->data.x, vget_low_f32( r ) );
+            vst1q_lane_f32( &s->data.z, r, 2 );
+        }
+#else
+        for( auto s = samples, end = samples + n; s < end; ++s )
+        {
+            auto r = ( *this )( { s->data.x, s->data.y, s->data.z } );
+            s->data = { r.x, r.y, r.z };
+        }
+#endif
+    }
+};
+
+
+}  // namespace librealsense
@@ -6,8 +6,12 @@
 #include "synthetic-stream.h"
 #include "motion-transform.h"
 #include "stream.h"
+#include "motion-sample-ring.h"
 #include <src/platform/hid-data.h>
 #include <src/core/frame-processor-callback.h>
+#include <src/core/motion-frame.h>
+
+#include <algorithm>
 
 
 namespace librealsense
@@ -106,28 +110,56 @@ namespace librealsense
         auto&& ret = functional_processing_block::process_frame(source, f);
         correct_motion(&ret);
 
+        if( _ring && ret )
+        {
+            rs2_motion_sample sample;
+            std::memcpy( &sample.data, ret.get_data(), sizeof( sample.data ) );
+            sample.timestamp = ret.get_timestamp();
+            record_sample( sample );
+        }
+
         return ret;
     }
 
-    void motion_transform::correct_motion_helper(float3* xyz, rs2_stream stream_type) const
+    motion_correction const & motion_transform::get_correction( rs2_stream stream_type ) const
     {
-        // The IMU sensor orientation shall be aligned with depth sensor's coordinate system
-        *xyz = _imu2depth_cs_alignment_matrix * (*xyz);
-
-        // IMU calibration is done with data in depth sensor's coordinate system, so calibration parameters should be applied for motion correction
-        // in the same coordinate system
-        if (_mm_correct_opt)
+        auto const enabled = _mm_correct_opt ? _mm_correct_opt->query() : 0.f;
+        if( enabled != _corrections_for )
         {
-            if ((_mm_correct_opt->query() > 0.f)) // TBD resolve duality of is_enabled/is_active
-            {
-                if (stream_type == RS2_STREAM_ACCEL)
-                    *xyz = (_accel_sensitivity * (*xyz)) - _accel_bias;
+            // The IMU sensor orientation shall be aligned with depth sensor's coordinate system
+            _alignment.m = _accel_correction.m = _gyro_correction.m = _imu2depth_cs_alignment_matrix;
+            _accel_correction.offset = _gyro_correction.offset = { 0, 0, 0 };
 
-                if (stream_type == RS2_STREAM_GYRO)
-                    *xyz = _gyro_sensitivity * (*xyz) - _gyro_bias;
+            // IMU calibration is done with data in depth sensor's coordinate system, so calibration parameters should be applied for motion correction
+            // in the same coordinate system
+            if( enabled > 0.f )  // TBD resolve duality of is_enabled/is_active
+            {
+                _accel_correction.m = _accel_sensitivity * _imu2depth_cs_alignment_matrix;
+                _accel_correction.offset = { -_accel_bias.x, -_accel_bias.y, -_accel_bias.z };
+                _gyro_correction.m = _gyro_sensitivity * _imu2depth_cs_alignment_matrix;
+                _gyro_correction.offset = { -_gyro_bias.x, -_gyro_bias.y, -_gyro_bias.z };
             }
+            _corrections_for = enabled;
+        }
+        switch( stream_type )
+        {
+        case RS2_STREAM_ACCEL: return _accel_correction;
+        case RS2_STREAM_GYRO: return _gyro_correction;
+        default: return _alignment;
         }
     }
+
+    void motion_transform::correct_motion_helper(float3* xyz, rs2_stream stream_type) const
+    {
+        *xyz = get_correction( stream_type )( *xyz );
+    }
+    void motion_transform::record_sample( rs2_motion_sample const & sample ) const
+    {
+        // Only the processing thread writes, as the ring requires
+        if( _ring )
+            _ring->push( sample );
+    }
+
     void motion_transform::correct_motion(rs2::frame* f) const
     {
         auto xyz = (float3*)(f->get_data());
@@ -267,5 +299,118 @@ namespace librealsense
                                                       actual_size,
                                                       _gyro_scale_factor );
     }
-}
 
+    std::shared_ptr< motion_batch_transform >
+    motion_batch_transform::accel( std::shared_ptr< mm_calib_handler > mm_calib,
+                                   std::shared_ptr< enable_motion_correction > mm_correct_opt,
+                                   bool high_accuracy,
+                                   std::shared_ptr< option > batch_size )
+    {
+        return std::make_shared< motion_batch_transform >(
+            "Acceleration Batch Transform",
+            RS2_STREAM_ACCEL,
+            [high_accuracy]( uint8_t * const dest[], const uint8_t * source )
+            { unpack_accel_axes< RS2_FORMAT_MOTION_XYZ32F >( dest, source, 0, 0, 0, high_accuracy ); },
+            mm_calib,
+            mm_correct_opt,
+            batch_size );
+    }
+
+    std::shared_ptr< motion_batch_transform >
+    motion_batch_transform::gyro( std::shared_ptr< mm_calib_handler > mm_calib,
+                                  std::shared_ptr< enable_motion_correction > mm_correct_opt,
+                                  double gyro_scale_factor,
+                                  std::shared_ptr< option > batch_size )
+    {
+        return std::make_shared< motion_batch_transform >(
+            "Gyroscope Batch Transform",
+            RS2_STREAM_GYRO,
+            [gyro_scale_factor]( uint8_t * const dest[], const uint8_t * source )
+            { unpack_gyro_axes< RS2_FORMAT_MOTION_XYZ32F >( dest, source, 0, 0, 0, gyro_scale_factor ); },
+            mm_calib,
+            mm_correct_opt,
+            batch_size );
+    }
+
+    motion_batch_transform::motion_batch_transform( const char * name,
+                                                    rs2_stream stream,
+                                                    unpack_function unpack,
+                                                    std::shared_ptr< mm_calib_handler > mm_calib,
+                                                    std::shared_ptr< enable_motion_correction > mm_correct_opt,
+                                                    std::shared_ptr< option > batch_size )
+        : motion_transform( name, RS2_FORMAT_MOTION_BATCH, stream, mm_calib, mm_correct_opt )
+        , _unpack( std::move( unpack ) )
+        , _batch_size( std::move( batch_size ) )
+    {
+        configure_processing_callback();
+    }
+
+    void motion_batch_transform::process_function( uint8_t * const dest[], const uint8_t * source, int, int, int, int )
+    {
+        _unpack( dest, source );
+    }
+
+    void motion_batch_transform::configure_processing_callback()
+    {
+        auto process_callback = [&]( frame_holder && frame, synthetic_source_interface * source )
+        {
+            auto profile = As< motion_stream_profile, stream_profile_interface >( frame.frame->get_stream() );
+            auto original = dynamic_cast< librealsense::frame * >( frame.frame );
+            if( ! profile || ! original )
+            {
+                LOG_ERROR( "Failed configuring motion batch processing block: " << get_info( RS2_CAMERA_INFO_NAME ) );
+                return;
+            }
+
+            if( profile.get() != _source_stream_profile.get() )
+            {
+                _source_stream_profile = profile;
+                _batch_profile = profile->clone();
+                _batch_profile->set_format( _target_format );
+                _samples.clear();
+            }
+
+            rs2_motion_sample sample;
+            uint8_t * sample_data[1] = { reinterpret_cast< uint8_t * >( &sample.data ) };
+            process_function( sample_data, (const uint8_t *)frame->get_frame_data(), 0, 0, 0, 0 );
+            sample.timestamp = frame->get_frame_timestamp();
+            _samples.push_back( sample );
+
+            size_t const batch_size = _batch_size ? std::max( 1, int( _batch_size->query() ) ) : 1;
+            if( _samples.size() < batch_size )
+                return;
+
+            get_correction( _target_stream ).apply( _samples.data(), _samples.size() );
+            for( auto const & s : _samples )
+                record_sample( s );
+
+            // The batch carries the metadata of its last sample
+            frame_additional_data data = original->additional_data;
+            frame_holder batch( _source.alloc_frame( { _batch_profile->get_stream_type(),
+                                                       _batch_profile->get_stream_index(),
+                                                       RS2_EXTENSION_MOTION_FRAME },
+                                                     _samples.size() * sizeof( rs2_motion_sample ),
+                                                     std::move( data ),
+                                                     true,
+                                                     false ) );
+            if( ! batch )
+            {
+                LOG_DEBUG( "Dropped " << _samples.size() << " motion samples: out of frame resources" );
+                _samples.clear();
+                return;
+            }
+            if( auto mf = dynamic_cast< motion_frame * >( batch.frame ) )
+            {
+                mf->metadata_parsers = original->metadata_parsers;
+                mf->set_sensor( original->get_sensor() );
+            }
+            std::memcpy( (void *)batch->get_frame_data(), _samples.data(), _samples.size() * sizeof( rs2_motion_sample ) );
+            batch->set_stream( _batch_profile );
+            _samples.clear();
+
+            source->frame_ready( std::move( batch ) );
+        };
+
+        set_processing_callback( make_frame_processor_callback( std::move( process_callback ) ) );
+    }
+}
@@ -3,12 +3,18 @@
 
 #pragma once
 #include "synthetic-stream.h"
+#include "option.h"
+#include "motion-correction.h"
+
+#include <functional>
+#include <vector>
 
 namespace librealsense
 {
     class enable_motion_correction;
     class mm_calib_handler;
     class functional_processing_block;
+    class motion_sample_ring;
 
     class motion_transform : public functional_processing_block
     {
@@ -17,6 +23,9 @@ namespace librealsense
             std::shared_ptr<mm_calib_handler> mm_calib = nullptr,
             std::shared_ptr<enable_motion_correction> mm_correct_opt = nullptr);
 
+        // Every corrected sample will also be recorded to the ring
+        void set_sample_ring( std::shared_ptr< motion_sample_ring > ring ) { _ring = std::move( ring ); }
+
     protected:
         motion_transform(const char* name, rs2_format target_format, rs2_stream target_stream,
             std::shared_ptr<mm_calib_handler> mm_calib,
@@ -26,6 +35,9 @@ namespace librealsense
     protected:
         void correct_motion(rs2::frame* f) const;
         void correct_motion_helper(float3* xyz, rs2_stream stream_type) const;
+        // The stream's correction, recomputed only when motion correction is turned on or off
+        motion_correction const & get_correction( rs2_stream stream_type ) const;
+        void record_sample( rs2_motion_sample const & sample ) const;
 
         std::shared_ptr<enable_motion_correction> _mm_correct_opt = nullptr;
         float3x3            _accel_sensitivity;
@@ -33,6 +45,13 @@ namespace librealsense
         float3x3            _gyro_sensitivity;
         float3              _gyro_bias;
         float3x3            _imu2depth_cs_alignment_matrix;     // Transform and align raw IMU axis [x,y,z] to be consistent with the Depth frame CS
+        std::shared_ptr< motion_sample_ring > _ring;
+
+    private:
+        mutable float _corrections_for = -1;  // the motion-correction option value they were computed for
+        mutable motion_correction _accel_correction;
+        mutable motion_correction _gyro_correction;
+        mutable motion_correction _alignment;  // other streams
     };
 
     class motion_to_accel_gyro : public motion_transform
@@ -91,4 +110,48 @@ namespace librealsense
 
         double  _gyro_scale_factor = 0.1;
     };
+
+    // RS2_OPTION_MOTION_BATCH_SIZE, shared by the sensor's motion_batch_transform blocks
+    class motion_batch_size_option : public float_option
+    {
+    public:
+        motion_batch_size_option() : float_option( option_range{ 1, 1000, 1, 10 } ) {}
+        const char * get_description() const override { return "Number of samples in each batched motion frame"; }
+    };
+
+    // Transforms accel or gyro samples the way acceleration_transform and gyroscope_transform do, but collects them
+    // into RS2_FORMAT_MOTION_BATCH frames: one frame (and callback) per RS2_OPTION_MOTION_BATCH_SIZE samples
+    class motion_batch_transform : public motion_transform
+    {
+    public:
+        static std::shared_ptr< motion_batch_transform > accel( std::shared_ptr< mm_calib_handler > mm_calib,
+                                                                std::shared_ptr< enable_motion_correction > mm_correct_opt,
+                                                                bool high_accuracy,
+                                                                std::shared_ptr< option > batch_size );
+        static std::shared_ptr< motion_batch_transform > gyro( std::shared_ptr< mm_calib_handler > mm_calib,
+                                                               std::shared_ptr< enable_motion_correction > mm_correct_opt,
+                                                               double gyro_scale_factor,
+                                                               std::shared_ptr< option > batch_size );
+
+        // 'unpack' converts a single raw sample to a float3
+        using unpack_function = std::function< void( uint8_t * const dest[], const uint8_t * source ) >;
+        motion_batch_transform( const char * name,
+                                rs2_stream stream,
+                                unpack_function unpack,
+                                std::shared_ptr< mm_calib_handler > mm_calib,
+                                std::shared_ptr< enable_motion_correction > mm_correct_opt,
+                                std::shared_ptr< option > batch_size );
+
+    protected:
+        void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size ) override;
+
+    private:
+        void configure_processing_callback();
+
+        unpack_function _unpack;
+        std::shared_ptr< option > _batch_size;
+        std::shared_ptr< stream_profile_interface > _source_stream_profile;
+        std::shared_ptr< stream_profile_interface > _batch_profile;
+        std::vector< rs2_motion_sample > _samples;  // waiting for the batch to fill; corrected together
+    };
 }
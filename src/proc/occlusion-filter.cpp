@@ -9,6 +9,11 @@
 
 #include <vector>
 #include <cmath>
+#include <algorithm>
+
+#ifdef __SSSE3__
+#include <emmintrin.h>
+#endif
 
 
 namespace librealsense
@@ -63,49 +68,6 @@ namespace librealsense
            }
 
        return res;
-   }
-   template<size_t SIZE>
-   void rotate_image_optimized( uint8_t * dest[], const uint8_t * source, int width, int height)
-   {
-
-       auto width_out = height;
-       auto height_out = width;
-
-       auto out = dest[0];
-       auto buffer_size = maxDivisorRange(height, width, 1, ROTATION_BUFFER_SIZE); 
-
-       uint8_t ** buffer = new uint8_t * [buffer_size];
-       for (int i = 0; i < buffer_size; ++i)
-           buffer[i] = new uint8_t[buffer_size * SIZE];
-
-
-       for (int i = 0; i <= height - buffer_size; i = i + buffer_size)
-       {
-           for (int j = 0; j <= width - buffer_size; j = j + buffer_size)
-           {
-               for (int ii = 0; ii < buffer_size; ++ii)
-               {
-                   for (int jj = 0; jj < buffer_size; ++jj)
-                   {
-                       auto source_index = ((j + jj) + (width * (i + ii))) * SIZE;
-                       memcpy((void*)&(buffer[(buffer_size-1 - jj)][(buffer_size-1 - ii) * SIZE]), &source[source_index], SIZE);
-                   }
-               }
-
-               for (int ii = 0; ii < buffer_size; ++ii)
-               {
-                   auto out_index = (((height_out - buffer_size - j + 1) * width_out) - i - buffer_size + (ii)*width_out);
-                   memcpy(&out[(out_index)*SIZE], (buffer[ii]), buffer_size * SIZE);
-               }
-           }
-       }
-
-       for (int i = 0; i < buffer_size; ++i)
-       {
-           delete[] buffer[i];
-       }
-       delete[] buffer;
- 
    }
     // IMPORTANT! This implementation is based on the assumption that the RGB sensor is positioned strictly to the left of the depth sensor.
     // namely D415/D435. The implementation WILL NOT work properly for different setups
@@ -116,105 +78,124 @@ namespace librealsense
     // -  The UV mapping for the occluded pixel is reset to (0,0). Later on the (0,0) coordinate in the texture map is overwritten
     //    with a invalidation color such as black/magenta according to the purpose (production/debugging)
    void occlusion_filter::monotonic_heuristic_invalidation(float3* points, float2* uv_map, const std::vector<float2>& pix_coord, const rs2::depth_frame& depth) const
+   {
+       size_t const points_width = _depth_intrinsics->width;
+       size_t const points_height = _depth_intrinsics->height;
+
+       if (_occlusion_scanning == horizontal)
+       {
+           // Every row is scanned on its own
+           worker_pool::for_each_range(_workers.get(), _threads, points_height, [&](size_t begin, size_t end) {
+               horizontal_scan(points, pix_coord.data(), points_width, begin, end);
+           });
+       }
+       else if (_occlusion_scanning == vertical)
+       {
+           // Every column is scanned on its own; they are handed out in blocks so the depth rows are read in cache lines
+           size_t const blocks = (points_width + VERTICAL_SCAN_BLOCK_SIZE - 1) / VERTICAL_SCAN_BLOCK_SIZE;
+           worker_pool::for_each_range(_workers.get(), _threads, blocks, [&](size_t begin, size_t end) {
+               vertical_scan(points, uv_map, (const uint16_t *)depth.get_data(), points_width, points_height,
+                             begin * VERTICAL_SCAN_BLOCK_SIZE,
+                             std::min(points_width, end * VERTICAL_SCAN_BLOCK_SIZE));
+           });
+       }
+   }
+
+   // Scan each of rows [row_begin, row_end) from left to right
+   void occlusion_filter::horizontal_scan(float3* points, const float2* pix_coord, size_t width, size_t row_begin, size_t row_end) const
    {
        float occZTh = 0.1f; //meters
        int occDilationSz = 1;
-       auto points_width = _depth_intrinsics->width;
-       auto points_height = _depth_intrinsics->height;
-       auto pixels_ptr = pix_coord.data();
-       auto points_ptr = points;
-       auto uv_map_ptr = uv_map;
-       float maxInLine = -1;
-       float maxZ = 0;
 
-       if (_occlusion_scanning == horizontal)
+       for (size_t y = row_begin; y < row_end; ++y)
        {
-           for( int y = 0; y < points_height; ++y )
-           {
-               maxInLine = -1;
-               maxZ = 0;
-               int occDilationLeft = 0;
+           auto points_ptr = points + y * width;
+           auto pixels_ptr = pix_coord + y * width;
+           float maxInLine = -1;
+           float maxZ = 0;
+           int occDilationLeft = 0;
 
-               for(int x = 0; x < points_width; ++x )
+           for (size_t x = 0; x < width; ++x)
+           {
+               if( points_ptr->z )
                {
-                   if( points_ptr->z )
+                   // Occlusion detection
+                   if( pixels_ptr->x < maxInLine
+                       || ( pixels_ptr->x == maxInLine && ( points_ptr->z - maxZ ) > occZTh ) )
                    {
-                       // Occlusion detection
-                       if( pixels_ptr->x < maxInLine
-                           || ( pixels_ptr->x == maxInLine && ( points_ptr->z - maxZ ) > occZTh ) )
+                       *points_ptr = { 0, 0, 0 };
+                       occDilationLeft = occDilationSz;
+                   }
+                   else
+                   {
+                       maxInLine = pixels_ptr->x;
+                       maxZ = points_ptr->z;
+                       if( occDilationLeft > 0 )
                        {
                            *points_ptr = { 0, 0, 0 };
-                           occDilationLeft = occDilationSz;
-                       }
-                       else
-                       {
-                           maxInLine = pixels_ptr->x;
-                           maxZ = points_ptr->z;
-                           if( occDilationLeft > 0 )
-                           {
-                               *points_ptr = { 0, 0, 0 };
-                               occDilationLeft--;
-                           }
+                           occDilationLeft--;
                        }
                    }
-                   ++points_ptr;
-                   ++uv_map_ptr;
-                   ++pixels_ptr;
                }
+               ++points_ptr;
+               ++pixels_ptr;
            }
        }
-       else if (_occlusion_scanning == vertical)
-       {
-           auto rotated_depth_width = _depth_intrinsics->height;
-           auto rotated_depth_height = _depth_intrinsics->width;
-           auto depth_ptr = (uint8_t *)(depth.get_data());
-           std::vector< uint8_t > alloc( depth.get_bytes_per_pixel() * points_width * points_height );
-           uint8_t * depth_planes[1];
-           depth_planes[0] = alloc.data();
-
-           rotate_image_optimized<2>(depth_planes, (const uint8_t *)(depth.get_data()), points_width, points_height);
+   }
 
-           // scan depth frame after rotation: check if there is a noticed jump between adjacen pixels in Z-axis (depth), it means there could be occlusion.
-           // save suspected points and run occlusion-invalidation vertical scan only on them
-           // after rotation : height = points_width , width = points_height
-           for (int i = 0; i < rotated_depth_height; i++)
-           {
-               for (int j = 0; j < rotated_depth_width; j++)
-               {
-                   // before depth frame rotation: occlusion detected in the positive direction of Y
-                   // after rotation : scan from right to left (positive direction of X) to detect occlusion
-                   // compare depth each pixel only with the pixel on its right (i,j+1)
-                   auto index = (j + (rotated_depth_width * i));
-                   auto uv_index = ((rotated_depth_height - i - 1) + (rotated_depth_width - j - 1) * rotated_depth_height);
-                   auto index_right = index + 1;
-                   uint16_t* diff_depth_ptr = (uint16_t*)depth_planes[0];
-                   uint16_t diff_right = std::abs( (uint16_t)( *( diff_depth_ptr + index ) )
-                                                   - (uint16_t)( *( diff_depth_ptr + index_right ) ) );
-                   float scaled_threshold = DEPTH_OCCLUSION_THRESHOLD / _depth_units;
-                   if (diff_right > scaled_threshold)
-                   {
-                       points_ptr = points + uv_index;
-                       uv_map_ptr = uv_map + uv_index;
-                       auto scan_win_size = maxDivisorRange(rotated_depth_height, rotated_depth_width, 1, VERTICAL_SCAN_WINDOW_SIZE);
+   // Scan columns [col_begin, col_end), each from the bottom up: wherever depth jumps between a pixel and the one above it,
+   // the pixels below whose V coordinate is less than that of the upper one are occluded. The depth frame is walked row
+   // by row, so a block of columns is always read a row at a time.
+   void occlusion_filter::vertical_scan(float3* points, const float2* uv_map, const uint16_t* depth,
+                                        size_t width, size_t height, size_t col_begin, size_t col_end) const
+   {
+       size_t const scan_win_size = maxDivisorRange(int(width), int(height), 1, VERTICAL_SCAN_WINDOW_SIZE);
+       if (height <= scan_win_size + 1)
+           return;
 
-                       if (j >= scan_win_size) {
-                           maxInLine = (uv_map_ptr - 1 * points_width)->y;
-                           for (int y = 0; y <= scan_win_size; ++y)
-                           {
-                               if (((uv_map_ptr + y * points_width)->y < maxInLine))
-                               {
-                                   *(points_ptr + y * points_width) = { 0.f, 0.f };
-                               }
-                               else
-                               {
-                                   break;
-                               }
+       // Depth values are integers, so 'diff > threshold' is 'diff > floor(threshold)'
+       float const scaled_threshold = DEPTH_OCCLUSION_THRESHOLD / _depth_units;
+       uint16_t const threshold = scaled_threshold < 65535.f ? uint16_t(scaled_threshold) : uint16_t(65535);
 
-                           }
+       auto invalidate = [&](size_t index) {
+           float maxInLine = uv_map[index - width].y;
+           for (size_t y = 0; y <= scan_win_size; ++y)
+           {
+               auto i = index + y * width;
+               if (uv_map[i].y < maxInLine)
+                   points[i] = { 0.f, 0.f };
+               else
+                   break;
+           }
+       };
 
-                       }
-                   }
-               }
+       // Only rows with a full scan window below them
+       for (size_t row = height - 1 - scan_win_size; row >= 1; --row)
+       {
+           auto depth_row = depth + row * width;
+           auto depth_above = depth_row - width;
+           size_t x = col_begin;
+#ifdef __SSSE3__
+           auto const max_diff = _mm_set1_epi16(short(threshold));
+           for (; x + 8 <= col_end; x += 8)
+           {
+               auto const d = _mm_loadu_si128((const __m128i *)(depth_row + x));
+               auto const a = _mm_loadu_si128((const __m128i *)(depth_above + x));
+               auto const diff = _mm_or_si128(_mm_subs_epu16(d, a), _mm_subs_epu16(a, d));
+               // diff > threshold wherever the saturated difference is non-zero
+               auto const mask = ~_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_subs_epu16(diff, max_diff), _mm_setzero_si128())) & 0xffff;
+               if (!mask)
+                   continue;
+               for (int k = 0; k < 8; ++k)
+                   if (mask & (3 << (2 * k)))
+                       invalidate(row * width + x + k);
+           }
+#endif
+           for (; x < col_end; ++x)
+           {
+               auto const diff = std::abs(int(depth_row[x]) - int(depth_above[x]));
+               if (diff > threshold)
+                   invalidate(row * width + x);
            }
        }
    }
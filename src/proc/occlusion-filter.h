@@ -4,10 +4,13 @@
 #pragma once
 #include <librealsense2/hpp/rs_frame.hpp>
 #include "rotation-transform.h"
+#include "worker-pool.h"
 #include <src/pose.h>
 
-#define ROTATION_BUFFER_SIZE 32 // minimum limit that could be divided by all resolutions
+#include <functional>
+
 #define VERTICAL_SCAN_WINDOW_SIZE 16
+#define VERTICAL_SCAN_BLOCK_SIZE 64 // columns handed out together by the vertical scan
 #define DEPTH_OCCLUSION_THRESHOLD 0.5f //meters
 
 namespace librealsense
@@ -38,6 +41,13 @@ namespace librealsense
         void set_mode(uint8_t filter_type) { _occlusion_filter = (occlusion_rect_type)filter_type; }
         void set_scanning(uint8_t scanning) { _occlusion_scanning = (occlusion_scanning_type)scanning; }
 
+        // Let process() split the frame between 'threads' threads of 'workers'; null to run on the calling thread only
+        void set_workers(std::shared_ptr<worker_pool> workers, size_t threads)
+        {
+            _workers = std::move(workers);
+            _threads = _workers ? threads : 1;
+        }
+
         void set_texel_intrinsics(const rs2_intrinsics& in);
         void set_depth_intrinsics(const rs2_intrinsics& in) { _depth_intrinsics = in; }
 
@@ -59,6 +69,9 @@ namespace librealsense
         friend class pointcloud;
 
         void monotonic_heuristic_invalidation(float3* points, float2* uv_map, const std::vector<float2> & pix_coord, const rs2::depth_frame& depth) const;
+        void horizontal_scan(float3* points, const float2* pix_coord, size_t width, size_t row_begin, size_t row_end) const;
+        void vertical_scan(float3* points, const float2* uv_map, const uint16_t* depth,
+                           size_t width, size_t height, size_t col_begin, size_t col_end) const;
         void comprehensive_invalidation(float3* points, float2* uv_map, const std::vector<float2> & pix_coord) const;
 
         optional_value<rs2_intrinsics>              _depth_intrinsics;
@@ -67,5 +80,7 @@ namespace librealsense
         occlusion_rect_type                         _occlusion_filter;
         occlusion_scanning_type                     _occlusion_scanning;
         float                                       _depth_units;
+        std::shared_ptr<worker_pool>                _workers;
+        size_t                                      _threads = 1;
     };
 }
@@ -16,18 +16,27 @@
 
 #include <rsutils/string/from.h>
 
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
 #ifdef RS2_USE_CUDA
 #include "proc/cuda/cuda-pointcloud.h"
 #endif
 #ifdef __SSSE3__
 #include "proc/sse/sse-pointcloud.h"
+#include <emmintrin.h>
 #endif
 
 namespace librealsense
 {
-    template<class MAP_DEPTH> void deproject_depth(float * points, const rs2_intrinsics & intrin, const uint16_t * depth, MAP_DEPTH map_depth)
+    // Deprojects the rows [begin, end) of the frame
+    template<class MAP_DEPTH> void deproject_depth(float * points, const rs2_intrinsics & intrin, const uint16_t * depth,
+                                                   MAP_DEPTH map_depth, int begin, int end)
     {
-        for (int y = 0; y < intrin.height; ++y)
+        points += size_t(begin) * intrin.width * 3;
+        depth += size_t(begin) * intrin.width;
+        for (int y = begin; y < end; ++y)
         {
             for (int x = 0; x < intrin.width; ++x)
             {
@@ -43,10 +52,62 @@ namespace librealsense
     {
         auto image = output.get_vertices();
         auto depth_scale = depth_frame.get_units();
-        deproject_depth((float*)image, depth_intrinsics, (const uint16_t*)depth_frame.get_data(), [depth_scale](uint16_t z) { return depth_scale * z; });
+        auto depth = (const uint16_t*)depth_frame.get_data();
+        for_each_range(depth_intrinsics.height, [&](size_t begin, size_t end)
+        {
+            deproject_depth((float*)image, depth_intrinsics, depth, [depth_scale](uint16_t z) { return depth_scale * z; },
+                            int(begin), int(end));
+        });
         return (float3*)image;
     }
 
+    const float3 * pointcloud::depth_to_points_roi(rs2::points output,
+        const rs2_intrinsics & depth_intrinsics, const rs2::depth_frame & depth_frame)
+    {
+        auto image = (float3*)output.get_vertices();
+        memset(image, 0, sizeof(float3) * depth_intrinsics.width * depth_intrinsics.height);
+
+        auto roi = _roi.get(depth_intrinsics.width, depth_intrinsics.height);
+        auto depth_scale = depth_frame.get_units();
+        auto depth = (const uint16_t*)depth_frame.get_data();
+        for_each_range(size_t(roi.max_y - roi.min_y + 1), [&](size_t begin, size_t end)
+        {
+            for (int y = roi.min_y + int(begin); y < roi.min_y + int(end); ++y)
+            {
+                for (int x = roi.min_x; x <= roi.max_x; ++x)
+                {
+                    const float pixel[] = { (float)x, (float)y };
+                    auto i = y * depth_intrinsics.width + x;
+                    rs2_deproject_pixel_to_point(&image[i].x, &depth_intrinsics, pixel, depth_scale * depth[i]);
+                }
+            }
+        });
+        return image;
+    }
+
+    static int16_t quantize(float x)
+    {
+        return int16_t(std::nearbyint(std::min(32767.f, std::max(-32768.f, x))));
+    }
+
+    // Packs 'count' floats, scaled, into int16_t with rounding to nearest and saturation
+    static void quantize(const float * in, int16_t * out, size_t count, float scale)
+    {
+        size_t i = 0;
+#ifdef __SSSE3__
+        auto const s = _mm_set1_ps(scale);
+        auto const lo = _mm_set1_ps(-32768.f);
+        auto const hi = _mm_set1_ps(32767.f);
+        auto convert = [&](const float * p) {
+            return _mm_cvtps_epi32(_mm_min_ps(hi, _mm_max_ps(lo, _mm_mul_ps(_mm_loadu_ps(p), s))));
+        };
+        for (; i + 8 <= count; i += 8)
+            _mm_storeu_si128((__m128i *)(out + i), _mm_packs_epi32(convert(in + i), convert(in + i + 4)));
+#endif
+        for (; i < count; ++i)
+            out[i] = quantize(in[i] * scale);
+    }
+
     float3 transform(const rs2_extrinsics *extrin, const float3 &point) { float3 p = {}; rs2_transform_point_to_point(&p.x, extrin, &point.x); return p; }
     float2 project(const rs2_intrinsics *intrin, const float3 & point) { float2 pixel = {}; rs2_project_point_to_pixel(&pixel.x, intrin, &point.x); return pixel; }
     float2 pixel_to_texcoord(const rs2_intrinsics *intrin, const float2 & pixel) { return{ pixel.x / (intrin->width), pixel.y / (intrin->height) }; }
@@ -77,6 +138,7 @@ namespace librealsense
             _depth_intrinsics = optional_value<rs2_intrinsics>();
             _depth_units = ((depth_frame*)depth.get())->get_units();
             _extrinsics = optional_value<rs2_extrinsics>();
+            _compact_stream = rs2::stream_profile();
         }
 
         bool found_depth_intrinsics = false;
@@ -212,32 +274,36 @@ namespace librealsense
         const rs2_extrinsics& extr,
         float2* pixels_ptr)
     {
-        auto tex_ptr = (float2*)output.get_texture_coordinates();
+        auto const tex_map = (float2*)output.get_texture_coordinates();
 
-        for (unsigned int y = 0; y < height; ++y)
+        for_each_range(height, [&](size_t begin, size_t end)
         {
-            for (unsigned int x = 0; x < width; ++x)
+            auto const first = begin * width;
+            auto point = points + first;
+            auto tex_ptr = tex_map + first;
+            auto pixel_ptr = pixels_ptr + first;
+            for (size_t i = first; i < end * width; ++i)
             {
-                if (points->z)
+                if (point->z)
                 {
-                    auto trans = transform(&extr, *points);
+                    auto trans = transform(&extr, *point);
                     //auto tex_xy = project_to_texcoord(&mapped_intr, trans);
                     // Store intermediate results for poincloud filters
-                    *pixels_ptr = project(&other_intrinsics, trans);
-                    auto tex_xy = pixel_to_texcoord(&other_intrinsics, *pixels_ptr);
+                    *pixel_ptr = project(&other_intrinsics, trans);
+                    auto tex_xy = pixel_to_texcoord(&other_intrinsics, *pixel_ptr);
 
                     *tex_ptr = tex_xy;
                 }
                 else
                 {
                     *tex_ptr = { 0.f, 0.f };
-                    *pixels_ptr = { 0.f, 0.f };
+                    *pixel_ptr = { 0.f, 0.f };
                 }
-                ++points;
+                ++point;
                 ++tex_ptr;
-                ++pixels_ptr;
+                ++pixel_ptr;
             }
-        }
+        });
     }
 
     rs2::points pointcloud::allocate_points(const rs2::frame_source& source, const rs2::frame& depth)
@@ -249,7 +315,11 @@ namespace librealsense
     {
         auto res = allocate_points(source, depth);
         auto pframe = (librealsense::points*)(res.get());
-        const float3* points = depth_to_points(res, *_depth_intrinsics, depth);
+        // With a region of interest the variants' full-frame kernels are passed over for the generic ones, which
+        // skip the rest of the frame
+        bool const roi = _roi.active();
+        const float3* points = roi ? depth_to_points_roi(res, *_depth_intrinsics, depth)
+                                   : depth_to_points(res, *_depth_intrinsics, depth);
 
         auto vid_frame = depth.as<rs2::video_frame>();
 
@@ -272,7 +342,11 @@ namespace librealsense
             auto height = vid_frame.get_height();
             auto width = vid_frame.get_width();
 
-            get_texture_map(res, points, width, height, mapped_intr, extr, pixels_ptr);
+            // Points without depth cost a store each
+            if (roi)
+                pointcloud::get_texture_map(res, points, width, height, mapped_intr, extr, pixels_ptr);
+            else
+                get_texture_map(res, points, width, height, mapped_intr, extr, pixels_ptr);
 
             if (run__occlusion_filter(extr))
             {
@@ -281,12 +355,82 @@ namespace librealsense
                     _occlusion_filter->set_scanning(static_cast<uint8_t>(vertical));
                     _occlusion_filter->_depth_units = _depth_units;
                 }
+                _occlusion_filter->set_workers(get_workers(), _threads);
                 _occlusion_filter->process(pframe->get_vertices(), pframe->get_texture_coordinates(), _pixels_map, depth);
             }
         }
+        if (_voxel_size > 0)
+            keep_voxel_centroids(*pframe);
+        else if (_valid_points_only)
+            keep_valid_points(*pframe);
+        if (_output_format == RS2_FORMAT_XYZ16)
+            return compact_points(source, res, depth);
         return res;
     }
 
+    // The occlusion filter needs the float vertices and texels of the whole frame, so compact output is packed from
+    // them in one pass; the float frame goes straight back to the frame pool
+    rs2::frame pointcloud::compact_points(const rs2::frame_source& source, rs2::points points, const rs2::depth_frame& depth)
+    {
+        if (!_compact_stream)
+            _compact_stream = depth.get_profile().as<rs2::video_stream_profile>().clone(
+                RS2_STREAM_DEPTH, depth.get_profile().stream_index(), RS2_FORMAT_XYZ16);
+
+        auto res = source.allocate_points(_compact_stream, depth);
+        auto in = (librealsense::points*)(points.get());
+        auto out = (librealsense::points*)(res.get());
+        auto const count = in->get_vertex_count();
+        quantize((const float*)in->get_vertices(), out->get_compact_vertices(), count * 3, 1.f / depth.get_units());
+        quantize((const float*)in->get_texture_coordinates(), out->get_compact_texture_coordinates(), count * 2,
+                 librealsense::points::COMPACT_TEXCOORD_SCALE);
+        if (in->is_valid_only())
+        {
+            out->set_valid_only(count);
+            std::swap(out->get_pixel_indices(), in->get_pixel_indices());
+        }
+        return res;
+    }
+
+    // Packs the points that have depth (including after occlusion removal) to the front of the frame, in place: a point
+    // is only ever moved back, over one that was already read
+    void pointcloud::keep_valid_points(librealsense::points & points)
+    {
+        auto const count = points.get_capacity();
+        auto vertices = points.get_vertices();
+        auto texcoords = points.get_texture_coordinates();
+        auto & indices = points.get_pixel_indices();
+        bool const keep_indices = _valid_points_only > 1;
+        if (keep_indices)
+            indices.resize(count);
+
+        size_t n = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!vertices[i].z)
+                continue;
+            vertices[n] = vertices[i];
+            texcoords[n] = texcoords[i];
+            if (keep_indices)
+                indices[n] = int(i);
+            ++n;
+        }
+        if (keep_indices)
+            indices.resize(n);
+        points.set_valid_only(n);
+    }
+
+    // The centroids go over the points they come from: there is no other copy of the cloud
+    void pointcloud::keep_voxel_centroids(librealsense::points & points)
+    {
+        auto const vertices = points.get_vertices();
+        auto const texcoords = points.get_texture_coordinates();
+        auto const workers = get_workers();
+        auto const n = _voxels.reduce(vertices, texcoords, points.get_capacity(), _voxel_size,
+                                      vertices, texcoords, workers.get(), _threads);
+        points.get_pixel_indices().clear();  // a centroid has no pixel
+        points.set_valid_only(n);
+    }
+
     pointcloud::pointcloud()
         : pointcloud("Pointcloud")
     {}
@@ -321,6 +465,33 @@ namespace librealsense
         occlusion_invalidation->set_description(1.f, "Off");
         occlusion_invalidation->set_description(2.f, "On");
         register_option(RS2_OPTION_FILTER_MAGNITUDE, occlusion_invalidation);
+
+        // XYZ16 halves the size of every frame, for sending over the network or uploading as-is
+        auto format_opt = std::make_shared<ptr_option<int>>(RS2_FORMAT_XYZ32F, RS2_FORMAT_XYZ16, 1, RS2_FORMAT_XYZ32F, &_output_format, "Output format");
+        format_opt->set_description(float(RS2_FORMAT_XYZ32F), "XYZ32F");
+        format_opt->set_description(float(RS2_FORMAT_XYZ16), "XYZ16");
+        format_opt->on_set([](float val)
+        {
+            if (int(val) != RS2_FORMAT_XYZ32F && int(val) != RS2_FORMAT_XYZ16)
+                throw invalid_value_exception( rsutils::string::from() << "Unsupported pointcloud output format " << val );
+        });
+        register_option(RS2_OPTION_OUTPUT_FORMAT, format_opt);
+
+        auto valid_only = std::make_shared<ptr_option<uint8_t>>(0, 2, 1, 0, &_valid_points_only, "Emit only the points that have depth");
+        valid_only->set_description(0.f, "All pixels");
+        valid_only->set_description(1.f, "Valid points");
+        valid_only->set_description(2.f, "Valid points and pixel indices");
+        register_option(RS2_OPTION_VALID_POINTS_ONLY, valid_only);
+
+        // Most consumers reduce the cloud right away; done here, there is no dense cloud to hand over first
+        auto voxel = std::make_shared<ptr_option<float>>(0.f, 1.f, 0.001f, 0.f, &_voxel_size,
+            "Size of the cells points are reduced to, in meters; 0 for no reduction");
+        register_option(RS2_OPTION_VOXEL_SIZE, voxel);
+
+        register_processing_threads_option();
+
+        _roi.register_options(*this);
+        register_share_results_option();
     }
 
     bool pointcloud::should_process(const rs2::frame& frame)
@@ -366,6 +537,17 @@ namespace librealsense
 
     rs2::frame pointcloud::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
+        // Besides the depth frame and the options, the points depend only on the profile they are mapped to
+        auto process_depth = [&](const rs2::frame& depth)
+        {
+            auto const state = std::hash<const void*>()(_other_stream ? _other_stream.get_profile().get() : nullptr);
+            if (auto shared = find_shared_result(depth, state))
+                return shared;
+            auto res = process_depth_frame(source, depth);
+            share_result(depth, state, res);
+            return res;
+        };
+
         rs2::frame rv;
         if (auto composite = f.as<rs2::frameset>())
         {
@@ -374,14 +556,14 @@ namespace librealsense
 
             auto depth = composite.first(RS2_STREAM_DEPTH, RS2_FORMAT_Z16);
             inspect_depth_frame(depth);
-            rv = process_depth_frame(source, depth);
+            rv = process_depth(depth);
         }
         else
         {
             if (f.is<rs2::depth_frame>())
             {
                 inspect_depth_frame(f);
-                rv = process_depth_frame(source, f);
+                rv = process_depth(f);
             }
             if (f.get_profile().stream_type() == _stream_filter.stream && f.get_profile().format() == _stream_filter.format)
             {
@@ -3,12 +3,16 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "worker-pool.h"
+#include "processing-roi.h"
+#include "voxel-grid.h"
 #include <src/float3.h>
 
 
 namespace librealsense
 {
     class occlusion_filter;
+    class points;
 
     class LRS_EXTENSION_API pointcloud : public stream_filter_processing_block
     {
@@ -55,8 +59,21 @@ namespace librealsense
         void inspect_depth_frame(const rs2::frame& depth);
         void inspect_other_frame(const rs2::frame& other);
         rs2::frame process_depth_frame(const rs2::frame_source& source, const rs2::depth_frame& depth);
+        // The generic kernel over the region of interest only; the points outside it have no depth
+        const float3 * depth_to_points_roi(rs2::points output, const rs2_intrinsics & depth_intrinsics, const rs2::depth_frame & depth_frame);
+        rs2::frame compact_points(const rs2::frame_source& source, rs2::points points, const rs2::depth_frame& depth);
+        void keep_valid_points(librealsense::points & points);
+        // Replaces the points, in place, by the centroids of the RS2_OPTION_VOXEL_SIZE cells they fall in
+        void keep_voxel_centroids(librealsense::points & points);
         void set_extrinsics();
 
+        int _output_format = RS2_FORMAT_XYZ32F;  // or RS2_FORMAT_XYZ16
+        uint8_t _valid_points_only = 0;  // 1: drop the points without depth; 2: and keep the pixel index of the rest
+        processing_roi _roi;  // in depth pixels
+        float _voxel_size = 0.f;  // 0: no voxel reduction
+        voxel_grid _voxels;
+        rs2::stream_profile _compact_stream;
+
         stream_filter _prev_stream_filter;
         std::shared_ptr< pointcloud > _registered_auto_calib_cb;
     };
@@ -59,6 +59,17 @@ namespace librealsense
                 } );
         }
 
+        // A single block of type T converting 'src' into all the 'dst' formats. Registered after the single-format
+        // factories, it is only chosen when all its formats are requested together.
+        template<typename T>
+        static processing_block_factory create_multi_target_pbf( rs2_format src, const std::vector<rs2_format>& dst, rs2_stream stream )
+        {
+            std::vector<stream_profile> targets;
+            for( auto d : dst )
+                targets.push_back( { d, stream } );
+            return { { {src} }, targets, [=]() { return std::make_shared<T>( dst ); } };
+        }
+
         stream_profiles find_satisfied_requests(const stream_profiles& sp, const stream_profiles& supported_profiles) const;
         bool has_source(const std::shared_ptr<stream_profile_interface>& source) const;
 
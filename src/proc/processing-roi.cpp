@@ -0,0 +1,45 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "proc/processing-roi.h"
+#include "option.h"
+#include "core/options-container.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace librealsense
+{
+    void processing_roi::register_options( options_container & block )
+    {
+        block.register_option( RS2_OPTION_ROI_MIN_X,
+                               std::make_shared< ptr_option< float > >( 0.f, 1.f, 0.01f, 0.f, &_min_x,
+                                                                        "Left edge of the region of interest, as a fraction of the width" ) );
+        block.register_option( RS2_OPTION_ROI_MIN_Y,
+                               std::make_shared< ptr_option< float > >( 0.f, 1.f, 0.01f, 0.f, &_min_y,
+                                                                        "Top edge of the region of interest, as a fraction of the height" ) );
+        block.register_option( RS2_OPTION_ROI_MAX_X,
+                               std::make_shared< ptr_option< float > >( 0.f, 1.f, 0.01f, 1.f, &_max_x,
+                                                                        "Right edge of the region of interest, as a fraction of the width" ) );
+        block.register_option( RS2_OPTION_ROI_MAX_Y,
+                               std::make_shared< ptr_option< float > >( 0.f, 1.f, 0.01f, 1.f, &_max_y,
+                                                                        "Bottom edge of the region of interest, as a fraction of the height" ) );
+    }
+
+    void processing_roi::unregister_options( options_container & block )
+    {
+        for( auto id : { RS2_OPTION_ROI_MIN_X, RS2_OPTION_ROI_MIN_Y, RS2_OPTION_ROI_MAX_X, RS2_OPTION_ROI_MAX_Y } )
+            block.unregister_option( id );
+    }
+
+    region_of_interest processing_roi::get( int width, int height ) const
+    {
+        // Every pixel the region touches is in
+        region_of_interest roi;
+        roi.min_x = std::max( 0, int( std::floor( _min_x * width ) ) );
+        roi.min_y = std::max( 0, int( std::floor( _min_y * height ) ) );
+        roi.max_x = std::min( width, int( std::ceil( _max_x * width ) ) ) - 1;
+        roi.max_y = std::min( height, int( std::ceil( _max_y * height ) ) ) - 1;
+        return roi;
+    }
+}
@@ -0,0 +1,35 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <src/core/roi.h>
+
+namespace librealsense
+{
+    class options_container;
+
+    // The region of interest of a processing block, as RS2_OPTION_ROI_MIN_X, _MIN_Y, _MAX_X and _MAX_Y: fractions of
+    // the width and height of the frame, so a region holds when decimation changes the resolution. The block only
+    // computes inside the region; what it leaves outside is up to the block, and cheap.
+    class processing_roi
+    {
+    public:
+        void register_options( options_container & block );
+        // For variants of a block that process the whole frame regardless
+        static void unregister_options( options_container & block );
+
+        // Whether the region leaves any of the frame out
+        bool active() const { return _min_x > 0.f || _min_y > 0.f || _max_x < 1.f || _max_y < 1.f; }
+
+        // The region in the pixels of a width x height frame, with max_x and max_y inclusive as for auto-exposure;
+        // max_x < min_x (or max_y < min_y) when the region is empty
+        region_of_interest get( int width, int height ) const;
+
+    private:
+        float _min_x = 0.f;
+        float _min_y = 0.f;
+        float _max_x = 1.f;
+        float _max_y = 1.f;
+    };
+}
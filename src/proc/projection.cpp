@@ -0,0 +1,269 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "projection.h"
+#include "sse/sse-projection.h"
+
+#include <librealsense2/rsutil.h>
+#include <cmath>
+#include <algorithm>
+
+
+namespace librealsense {
+
+
+#ifdef __SSSE3__
+
+template< rs2_distortion MODEL >
+static size_t project_sse_batch( float * pixels, rs2_intrinsics const & intrin, float const * points, size_t count )
+{
+    sse_intrinsics const k( intrin );
+    size_t const n = count & ~size_t( 3 );
+    for( size_t i = 0; i < n; i += 4, points += 12, pixels += 8 )
+    {
+        __m128 x, y, z;
+        deinterleave_xyz_sse( _mm_loadu_ps( points ), _mm_loadu_ps( points + 4 ), _mm_loadu_ps( points + 8 ), x, y, z );
+        __m128 px, py;
+        project_sse< MODEL >( x, y, z, k, px, py );
+        __m128 xy1, xy2;
+        interleave_xy_sse( px, py, xy1, xy2 );
+        _mm_storeu_ps( pixels, xy1 );
+        _mm_storeu_ps( pixels + 4, xy2 );
+    }
+    return n;
+}
+
+template< rs2_distortion MODEL >
+static size_t deproject_sse_batch( float * points,
+                                   rs2_intrinsics const & intrin,
+                                   float const * pixels,
+                                   float const * depths,
+                                   size_t count )
+{
+    sse_intrinsics const k( intrin );
+    size_t const n = count & ~size_t( 3 );
+    for( size_t i = 0; i < n; i += 4, pixels += 8, depths += 4, points += 12 )
+    {
+        __m128 px, py;
+        deinterleave_xy_sse( _mm_loadu_ps( pixels ), _mm_loadu_ps( pixels + 4 ), px, py );
+        auto depth = _mm_loadu_ps( depths );
+        __m128 x, y;
+        deproject_sse< MODEL >( px, py, depth, k, x, y );
+        __m128 xyz1, xyz2, xyz3;
+        interleave_xyz_sse( x, y, depth, xyz1, xyz2, xyz3 );
+        _mm_storeu_ps( points, xyz1 );
+        _mm_storeu_ps( points + 4, xyz2 );
+        _mm_storeu_ps( points + 8, xyz3 );
+    }
+    return n;
+}
+
+#endif
+
+
+void project_points_to_pixels( float * pixels, rs2_intrinsics const & intrin, float const * points, size_t count )
+{
+    size_t i = 0;
+#ifdef __SSSE3__
+    switch( intrin.model )
+    {
+    case RS2_DISTORTION_NONE:
+        i = project_sse_batch< RS2_DISTORTION_NONE >( pixels, intrin, points, count );
+        break;
+    case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
+        i = project_sse_batch< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( pixels, intrin, points, count );
+        break;
+    case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
+        i = project_sse_batch< RS2_DISTORTION_INVERSE_BROWN_CONRADY >( pixels, intrin, points, count );
+        break;
+    case RS2_DISTORTION_BROWN_CONRADY:
+        i = project_sse_batch< RS2_DISTORTION_BROWN_CONRADY >( pixels, intrin, points, count );
+        break;
+    default:
+        // F-theta and Kannala-Brandt need atan/tan per point: no SSE kernel
+        break;
+    }
+#endif
+    for( ; i < count; ++i )
+        rs2_project_point_to_pixel( pixels + 2 * i, &intrin, points + 3 * i );
+}
+
+
+void deproject_pixels_to_points( float * points,
+                                 rs2_intrinsics const & intrin,
+                                 float const * pixels,
+                                 float const * depths,
+                                 size_t count )
+{
+    size_t i = 0;
+#ifdef __SSSE3__
+    switch( intrin.model )
+    {
+    case RS2_DISTORTION_NONE:
+    case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:  // cannot be deprojected; treated like 'none', as the scalar version does
+        i = deproject_sse_batch< RS2_DISTORTION_NONE >( points, intrin, pixels, depths, count );
+        break;
+    case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
+        i = deproject_sse_batch< RS2_DISTORTION_INVERSE_BROWN_CONRADY >( points, intrin, pixels, depths, count );
+        break;
+    case RS2_DISTORTION_BROWN_CONRADY:
+        i = deproject_sse_batch< RS2_DISTORTION_BROWN_CONRADY >( points, intrin, pixels, depths, count );
+        break;
+    default:
+        break;
+    }
+#endif
+    for( ; i < count; ++i )
+        rs2_deproject_pixel_to_point( points + 3 * i, &intrin, pixels + 2 * i, depths[i] );
+}
+
+
+
+void next_pixel_in_line( float curr[2], const float start[2], const float end[2] )
+{
+    float line_slope = ( end[1] - start[1] ) / ( end[0] - start[0] );
+    if( fabs( end[0] - curr[0] ) > fabs( end[1] - curr[1] ) )
+    {
+        curr[0] = end[0] > curr[0] ? curr[0] + 1 : curr[0] - 1;
+        curr[1] = end[1] - line_slope * ( end[0] - curr[0] );
+    }
+    else
+    {
+        curr[1] = end[1] > curr[1] ? curr[1] + 1 : curr[1] - 1;
+        curr[0] = end[0] - ( ( end[1] - curr[1] ) / line_slope );
+    }
+}
+
+
+bool is_pixel_in_line( const float curr[2], const float start[2], const float end[2] )
+{
+    return ( ( end[0] >= start[0] && end[0] >= curr[0] && curr[0] >= start[0] )
+             || ( end[0] <= start[0] && end[0] <= curr[0] && curr[0] <= start[0] ) )
+        && ( ( end[1] >= start[1] && end[1] >= curr[1] && curr[1] >= start[1] )
+             || ( end[1] <= start[1] && end[1] <= curr[1] && curr[1] <= start[1] ) );
+}
+
+
+void adjust_2D_point_to_boundary( float p[2], int width, int height )
+{
+    if( p[0] < 0 ) p[0] = 0;
+    if( p[0] > width ) p[0] = (float)width;
+    if( p[1] < 0 ) p[1] = 0;
+    if( p[1] > height ) p[1] = (float)height;
+}
+
+
+color_to_depth_projector::color_to_depth_projector( rs2_intrinsics const & depth_intrin,
+                                                    rs2_intrinsics const & color_intrin,
+                                                    rs2_extrinsics const & color_to_depth,
+                                                    rs2_extrinsics const & depth_to_color )
+    : _depth_intrin( depth_intrin )
+    , _color_intrin( color_intrin )
+    , _color_to_depth( color_to_depth )
+{
+    for( int i = 0; i < 3; ++i )
+        _translation[i] = depth_to_color.translation[i];
+
+    size_t const w = depth_intrin.width + 1;
+    size_t const h = depth_intrin.height + 1;
+    std::vector< float > pixels;
+    pixels.reserve( w * h * 2 );
+    for( size_t y = 0; y < h; ++y )
+        for( size_t x = 0; x < w; ++x )
+        {
+            pixels.push_back( float( x ) );
+            pixels.push_back( float( y ) );
+        }
+    std::vector< float > const ones( w * h, 1.f );
+    std::vector< float > points( w * h * 3 );
+    deproject_pixels_to_points( points.data(), depth_intrin, pixels.data(), ones.data(), w * h );
+
+    // Rotation only: the translation is added per depth
+    auto const & r = depth_to_color.rotation;
+    _rays.resize( points.size() );
+    for( size_t i = 0; i < points.size(); i += 3 )
+    {
+        auto const p = &points[i];
+        _rays[i + 0] = r[0] * p[0] + r[3] * p[1] + r[6] * p[2];
+        _rays[i + 1] = r[1] * p[0] + r[4] * p[1] + r[7] * p[2];
+        _rays[i + 2] = r[2] * p[0] + r[5] * p[1] + r[8] * p[2];
+    }
+}
+
+
+void color_to_depth_projector::ray_at( const float pixel[2], float ray[3] ) const
+{
+    size_t const w = _depth_intrin.width + 1;
+    int x0 = std::min( int( pixel[0] ), _depth_intrin.width - 1 );
+    int y0 = std::min( int( pixel[1] ), _depth_intrin.height - 1 );
+    float const fx = pixel[0] - x0;
+    float const fy = pixel[1] - y0;
+    auto const r00 = &_rays[( y0 * w + x0 ) * 3];
+    auto const r01 = r00 + 3;
+    auto const r10 = r00 + w * 3;
+    auto const r11 = r10 + 3;
+    for( int i = 0; i < 3; ++i )
+    {
+        float const top = r00[i] + ( r01[i] - r00[i] ) * fx;
+        float const bottom = r10[i] + ( r11[i] - r10[i] ) * fx;
+        ray[i] = top + ( bottom - top ) * fy;
+    }
+}
+
+
+bool color_to_depth_projector::project( float to_pixel[2],
+                                        const float from_pixel[2],
+                                        const uint16_t * data,
+                                        float depth_scale,
+                                        float depth_min,
+                                        float depth_max ) const
+{
+    // Line end-points, as rs2_project_color_pixel_to_depth_pixel finds them
+    float start_pixel[2] = { 0 }, end_pixel[2] = { 0 };
+    {
+        float point[3], transformed[3];
+        rs2_deproject_pixel_to_point( point, &_color_intrin, from_pixel, depth_min );
+        rs2_transform_point_to_point( transformed, &_color_to_depth, point );
+        rs2_project_point_to_pixel( start_pixel, &_depth_intrin, transformed );
+        adjust_2D_point_to_boundary( start_pixel, _depth_intrin.width, _depth_intrin.height );
+
+        rs2_deproject_pixel_to_point( point, &_color_intrin, from_pixel, depth_max );
+        rs2_transform_point_to_point( transformed, &_color_to_depth, point );
+        rs2_project_point_to_pixel( end_pixel, &_depth_intrin, transformed );
+        adjust_2D_point_to_boundary( end_pixel, _depth_intrin.width, _depth_intrin.height );
+    }
+
+    float min_dist = -1;
+    for( float p[2] = { start_pixel[0], start_pixel[1] }; is_pixel_in_line( p, start_pixel, end_pixel );
+         next_pixel_in_line( p, start_pixel, end_pixel ) )
+    {
+        int const x = int( p[0] ), y = int( p[1] );
+        if( x >= _depth_intrin.width || y >= _depth_intrin.height )
+            continue;  // on the far edge: no depth there
+        float depth = depth_scale * data[y * _depth_intrin.width + x];
+        if( depth == 0 )
+            continue;
+
+        float ray[3];
+        ray_at( p, ray );
+        float const point[3] = { ray[0] * depth + _translation[0],
+                                 ray[1] * depth + _translation[1],
+                                 ray[2] * depth + _translation[2] };
+        float projected_pixel[2];
+        rs2_project_point_to_pixel( projected_pixel, &_color_intrin, point );
+
+        float const dx = projected_pixel[0] - from_pixel[0];
+        float const dy = projected_pixel[1] - from_pixel[1];
+        float new_dist = dx * dx + dy * dy;
+        if( new_dist < min_dist || min_dist < 0 )
+        {
+            min_dist = new_dist;
+            to_pixel[0] = p[0];
+            to_pixel[1] = p[1];
+        }
+    }
+    return min_dist >= 0;
+}
+
+
+}  // namespace librealsense
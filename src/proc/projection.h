@@ -0,0 +1,66 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace librealsense {
+
+
+// Batch versions of rs2_project_point_to_pixel and rs2_deproject_pixel_to_point: the distortion model is resolved once
+// per call rather than once per point, and points are processed four at a time with SSE where the model allows it.
+// Points are interleaved (x, y, z), pixels (x, y), and the results match the single-point functions.
+void project_points_to_pixels( float * pixels, rs2_intrinsics const & intrin, float const * points, size_t count );
+void deproject_pixels_to_points( float * points,
+                                 rs2_intrinsics const & intrin,
+                                 float const * pixels,
+                                 float const * depths,
+                                 size_t count );
+
+
+
+// Line-search helpers for color-to-depth pixel projection
+void next_pixel_in_line( float curr[2], const float start[2], const float end[2] );
+bool is_pixel_in_line( const float curr[2], const float start[2], const float end[2] );
+void adjust_2D_point_to_boundary( float p[2], int width, int height );
+
+
+// Does what rs2_project_color_pixel_to_depth_pixel does, for a fixed pair of intrinsics and extrinsics, but with each
+// step of the line search reduced to a single color projection:
+//     For every depth pixel we keep its deprojection at 1 meter, already rotated into the color frame, so a depth
+//     pixel at depth d lands at d * ray + translation. This replaces an iterative deprojection and a transform per step.
+// Rays are kept on the pixel grid (including the far edges the search clamps to) and interpolated bilinearly for the
+// fractional positions the line search visits.
+class color_to_depth_projector
+{
+public:
+    color_to_depth_projector( rs2_intrinsics const & depth_intrin,
+                              rs2_intrinsics const & color_intrin,
+                              rs2_extrinsics const & color_to_depth,
+                              rs2_extrinsics const & depth_to_color );
+
+    // Returns false (and leaves to_pixel untouched) if no valid depth was found along the line
+    bool project( float to_pixel[2],
+                  const float from_pixel[2],
+                  const uint16_t * depth,
+                  float depth_scale,
+                  float depth_min,
+                  float depth_max ) const;
+
+private:
+    void ray_at( const float pixel[2], float ray[3] ) const;
+
+    rs2_intrinsics _depth_intrin;
+    rs2_intrinsics _color_intrin;
+    rs2_extrinsics _color_to_depth;
+    float _translation[3];      // depth-to-color
+    std::vector< float > _rays;  // (width + 1) x (height + 1) x 3
+};
+
+
+}  // namespace librealsense
@@ -0,0 +1,210 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "rectify.h"
+#include "projection.h"
+#include "option.h"
+#include "stream.h"
+#include "core/video.h"
+
+#include <librealsense2/hpp/rs_processing.hpp>
+
+#include <cmath>
+
+
+namespace librealsense {
+
+
+rectify::rectify()
+    : stream_filter_processing_block( "Rectify" )
+{
+    _stream_filter.stream = RS2_STREAM_COLOR;
+
+    register_processing_threads_option();
+}
+
+
+bool rectify::is_format_supported( rs2_format format )
+{
+    switch( format )
+    {
+    case RS2_FORMAT_RGB8:
+    case RS2_FORMAT_BGR8:
+    case RS2_FORMAT_RGBA8:
+    case RS2_FORMAT_BGRA8:
+    case RS2_FORMAT_Y8:
+    case RS2_FORMAT_Y16:
+        return true;
+    default:
+        return false;
+    }
+}
+
+
+bool rectify::should_process( const rs2::frame & frame )
+{
+    if( ! stream_filter_processing_block::should_process( frame ) )
+        return false;
+    if( ! frame.is< rs2::video_frame >() || frame.is< rs2::depth_frame >() )
+        return false;
+    return is_format_supported( frame.get_profile().format() );
+}
+
+
+rectify::remap_table const & rectify::get_table( rs2::video_stream_profile const & source_profile )
+{
+    auto it = _tables.find( source_profile.get() );
+    if( it != _tables.end() )
+        return it->second;
+
+    auto const src_intrin = source_profile.get_intrinsics();
+    if( src_intrin.width < 2 || src_intrin.height < 2 || src_intrin.width > INT16_MAX || src_intrin.height > INT16_MAX )
+        throw invalid_value_exception( "rectify: unsupported resolution" );
+
+    // Same camera matrix, without the distortion
+    rs2_intrinsics tgt_intrin = src_intrin;
+    tgt_intrin.model = RS2_DISTORTION_NONE;
+    for( auto & c : tgt_intrin.coeffs )
+        c = 0;
+
+    remap_table table;
+    table.target_profile = source_profile.clone( source_profile.stream_type(),
+                                                 source_profile.stream_index(),
+                                                 source_profile.format() );
+    auto tgt_vspi = dynamic_cast< video_stream_profile_interface * >( table.target_profile.get()->profile );
+    if( ! tgt_vspi )
+        throw std::runtime_error( "Profile is not video stream profile" );
+    tgt_vspi->set_intrinsics( [tgt_intrin]() { return tgt_intrin; } );
+
+    // Where each undistorted pixel's ray lands in the source image, a row at a time
+    size_t const w = src_intrin.width, h = src_intrin.height;
+    table.entries.resize( w * h );
+    std::vector< float > points( w * 3 ), pixels( w * 2 );
+    for( size_t y = 0; y < h; ++y )
+    {
+        for( size_t x = 0; x < w; ++x )
+        {
+            points[x * 3 + 0] = ( x - tgt_intrin.ppx ) / tgt_intrin.fx;
+            points[x * 3 + 1] = ( y - tgt_intrin.ppy ) / tgt_intrin.fy;
+            points[x * 3 + 2] = 1;
+        }
+        project_points_to_pixels( pixels.data(), src_intrin, points.data(), w );
+        for( size_t x = 0; x < w; ++x )
+        {
+            auto & e = table.entries[y * w + x];
+            float const u = pixels[x * 2], v = pixels[x * 2 + 1];
+            if( ! ( u >= 0 && v >= 0 && u <= w - 1 && v <= h - 1 ) )  // also catches NaN
+            {
+                e = { -1, -1, 0, 0 };
+                continue;
+            }
+            // Keep a right and bottom neighbour, even on the last column/row
+            int const x0 = std::min( int( u ), int( w ) - 2 );
+            int const y0 = std::min( int( v ), int( h ) - 2 );
+            e.x = int16_t( x0 );
+            e.y = int16_t( y0 );
+            e.wx = uint16_t( std::lround( ( u - x0 ) * 256 ) );
+            e.wy = uint16_t( std::lround( ( v - y0 ) * 256 ) );
+        }
+    }
+
+    return _tables.emplace( source_profile.get(), std::move( table ) ).first->second;
+}
+
+
+template< class T, int C >
+void rectify::remap_rows( T const * src,
+                          size_t src_stride,
+                          T * dst,
+                          size_t width,
+                          remap_entry const * table,
+                          size_t row_begin,
+                          size_t row_end )
+{
+    for( size_t row = row_begin; row < row_end; ++row )
+    {
+        auto e = table + row * width;
+        auto out = dst + row * width * C;
+        for( size_t i = 0; i < width; ++i, ++e, out += C )
+        {
+            if( e->x < 0 )
+            {
+                for( int c = 0; c < C; ++c )
+                    out[c] = 0;
+                continue;
+            }
+            auto const p0 = src + e->y * src_stride + e->x * C;
+            auto const p1 = p0 + src_stride;
+            // Weights add up to 1<<16; the sums fit in 32 bits even for 16-bit channels
+            uint32_t const w00 = uint32_t( 256 - e->wx ) * ( 256 - e->wy );
+            uint32_t const w01 = uint32_t( e->wx ) * ( 256 - e->wy );
+            uint32_t const w10 = uint32_t( 256 - e->wx ) * e->wy;
+            uint32_t const w11 = uint32_t( e->wx ) * e->wy;
+            for( int c = 0; c < C; ++c )
+                out[c] = T( ( p0[c] * w00 + p0[C + c] * w01 + p1[c] * w10 + p1[C + c] * w11 + ( 1u << 15 ) ) >> 16 );
+        }
+    }
+}
+
+
+rs2::frame rectify::process_frame( const rs2::frame_source & source, const rs2::frame & f )
+{
+    auto vf = f.as< rs2::video_frame >();
+    auto profile = f.get_profile().as< rs2::video_stream_profile >();
+    rs2_intrinsics intrin;
+    try
+    {
+        intrin = profile.get_intrinsics();
+    }
+    catch( ... )
+    {
+        return f;  // nothing to undistort against
+    }
+    if( intrin.model == RS2_DISTORTION_NONE || intrin.width != vf.get_width() || intrin.height != vf.get_height() )
+        return f;
+
+    auto const & table = get_table( profile );
+
+    auto const bpp = vf.get_bytes_per_pixel();
+    auto const width = size_t( vf.get_width() );
+    auto const height = size_t( vf.get_height() );
+    auto tgt = source.allocate_video_frame( table.target_profile, f, bpp, int( width ), int( height ), int( width * bpp ),
+                                            RS2_EXTENSION_VIDEO_FRAME );
+    if( ! tgt )
+        return f;
+
+    auto const src = static_cast< uint8_t const * >( vf.get_data() );
+    auto const dst = static_cast< uint8_t * >( const_cast< void * >( tgt.get_data() ) );
+    size_t const stride = vf.get_stride_in_bytes();
+    auto const entries = table.entries.data();
+    std::function< void( size_t, size_t ) > rows;
+    switch( profile.format() )
+    {
+    case RS2_FORMAT_RGB8:
+    case RS2_FORMAT_BGR8:
+        rows = [&]( size_t b, size_t e ) { remap_rows< uint8_t, 3 >( src, stride, dst, width, entries, b, e ); };
+        break;
+    case RS2_FORMAT_RGBA8:
+    case RS2_FORMAT_BGRA8:
+        rows = [&]( size_t b, size_t e ) { remap_rows< uint8_t, 4 >( src, stride, dst, width, entries, b, e ); };
+        break;
+    case RS2_FORMAT_Y8:
+        rows = [&]( size_t b, size_t e ) { remap_rows< uint8_t, 1 >( src, stride, dst, width, entries, b, e ); };
+        break;
+    case RS2_FORMAT_Y16:
+        rows = [&]( size_t b, size_t e ) {
+            remap_rows< uint16_t, 1 >( reinterpret_cast< uint16_t const * >( src ), stride / 2,
+                                       reinterpret_cast< uint16_t * >( dst ), width, entries, b, e );
+        };
+        break;
+    default:
+        return f;
+    }
+
+    for_each_range( height, rows );
+
+    return tgt;
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,62 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+#include "worker-pool.h"
+
+#include <map>
+
+
+namespace librealsense {
+
+
+// Undistorts color (and infrared) frames into a pinhole image with the same focal length and principal point, so that
+// align, pointcloud and anything else downstream see distortion-free intrinsics (RS2_DISTORTION_NONE).
+//
+// The source pixel of every output pixel is found once per stream profile and kept as a remap table: the offset of its
+// top-left neighbour and fixed-point bilinear weights. Per frame, each output pixel is then a blend of four source
+// pixels, with rows split between threads if asked to. Pixels that fall outside the source image come out black.
+//
+class rectify : public stream_filter_processing_block
+{
+public:
+    rectify();
+
+    static bool is_format_supported( rs2_format format );
+
+protected:
+    bool should_process( const rs2::frame & frame ) override;
+    rs2::frame process_frame( const rs2::frame_source & source, const rs2::frame & f ) override;
+
+private:
+    struct remap_entry
+    {
+        int16_t x, y;    // top-left source pixel; x is -1 when outside the source image
+        uint16_t wx, wy;  // weights of the right and bottom neighbours, in 1/256ths
+    };
+
+    struct remap_table
+    {
+        rs2::stream_profile target_profile;
+        std::vector< remap_entry > entries;
+    };
+
+    remap_table const & get_table( rs2::video_stream_profile const & source_profile );
+
+    // Output rows [row_begin, row_end); T is the channel type, C the number of channels
+    template< class T, int C >
+    static void remap_rows( T const * src,
+                            size_t src_stride,  // in T's
+                            T * dst,
+                            size_t width,
+                            remap_entry const * table,
+                            size_t row_begin,
+                            size_t row_end );
+
+    std::map< rs2_stream_profile const *, remap_table > _tables;
+};
+
+
+}  // namespace librealsense
@@ -8,81 +8,255 @@
 #include "context.h"
 #include "image.h"
 #include "stream.h"
+#include "cpu-features.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#ifdef __SSSE3__
+#include <tmmintrin.h> // For SSSE3 intrinsics
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#include <arm_neon.h>
+#endif
 
 namespace librealsense
 {
     //// Unpacking routines ////
-    template<size_t SIZE>
-    void rotate_image_optimized( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
+    //
+    // The rotation maps the pixel at row i, column j of a width x height source to row (width - 1 - j), column
+    // (height - 1 - i) of the height x width output. Where to put each pixel, and how to convert it on the way, is up
+    // to a writer, so that a conversion can be fused into the rotation instead of taking another pass over the image.
+    //
+    // Squares of block x block source pixels are rotated at a time, so that the output rows they touch stay in the
+    // cache while they are filled; within a block, 16-byte tiles are transposed in SIMD registers when possible.
+
+    static const int rotation_block = 64;
+
+    // Plain rotation of SIZE-byte pixels
+    template< size_t SIZE >
+    struct rotated_pixels
     {
-        auto width_out = height;
-        auto height_out = width;
+        static const size_t pixel_size = SIZE;
 
-        auto out = dest[0];
-        uint8_t buffer[8][8 * SIZE]; // = { 0 };
-        for (int i = 0; i <= height - 8; i = i + 8)
+        uint8_t * out;
+        int out_width;
+        int out_height;
+
+        uint8_t * at( int i, int j ) const
         {
-            for (int j = 0; j <= width - 8; j = j + 8)
-            {
-                for (int ii = 0; ii < 8; ++ii)
-                {
-                    for (int jj = 0; jj < 8; ++jj)
-                    {
-                        auto source_index = ((j + jj) + (width * (i + ii))) * SIZE;
-                        memcpy((void*)(&buffer[7 - jj][(7 - ii) * SIZE]), &source[source_index], SIZE);
-                    }
-                }
+            return out + ( size_t( out_height - 1 - j ) * out_width + ( out_width - 1 - i ) ) * SIZE;
+        }
+        void pixel( int i, int j, const uint8_t * p ) const { std::memcpy( at( i, j ), p, SIZE ); }
+#ifdef __SSSE3__
+        // v holds column j of source rows i.., already in output order
+        void store( int i, int j, __m128i v ) const
+        {
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( at( i + 16 / SIZE - 1, j ) ), v );
+        }
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+        void store( int i, int j, uint8x16_t v ) const { vst1q_u8( at( i + 16 / SIZE - 1, j ), v ); }
+#endif
+    };
 
-                for (int ii = 0; ii < 8; ++ii)
+    // Packed confidence: each source byte holds two 4-bit values, for two consecutive output rows, that are unpacked
+    // to the MSBs of RAW8 pixels
+    struct rotated_confidence
+    {
+        static const size_t pixel_size = 1;
+
+        uint8_t * out;
+        int out_width;
+        int out_height;  // in source bytes, i.e. half the output rows
+
+        uint8_t * at( int i, int j, int nibble ) const
+        {
+            return out + size_t( 2 * ( out_height - 1 - j ) + nibble ) * out_width + ( out_width - 1 - i );
+        }
+        void pixel( int i, int j, const uint8_t * p ) const
+        {
+            *at( i, j, 0 ) = uint8_t( *p << 4 );
+            *at( i, j, 1 ) = uint8_t( *p & 0xF0 );
+        }
+#ifdef __SSSE3__
+        void store( int i, int j, __m128i v ) const
+        {
+            auto const msb = _mm_set1_epi8( char( 0xF0 ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( at( i + 15, j, 0 ) ), _mm_and_si128( _mm_slli_epi16( v, 4 ), msb ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i * >( at( i + 15, j, 1 ) ), _mm_and_si128( v, msb ) );
+        }
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+        void store( int i, int j, uint8x16_t v ) const
+        {
+            vst1q_u8( at( i + 15, j, 0 ), vshlq_n_u8( v, 4 ) );
+            vst1q_u8( at( i + 15, j, 1 ), vandq_u8( v, vdupq_n_u8( 0xF0 ) ) );
+        }
+#endif
+    };
+
+    template< class Writer >
+    void rotate_region( Writer const & w, const uint8_t * source, int width, int i_begin, int i_end, int j_begin, int j_end )
+    {
+        auto const size = Writer::pixel_size;
+        for( int i0 = i_begin; i0 < i_end; i0 += rotation_block )
+        {
+            int const i1 = std::min( i0 + rotation_block, i_end );
+            for( int j0 = j_begin; j0 < j_end; j0 += rotation_block )
+            {
+                int const j1 = std::min( j0 + rotation_block, j_end );
+                for( int i = i0; i < i1; ++i )
                 {
-                    auto out_index = (((height_out - 8 - j + 1) * width_out) - i - 8 + (ii)* width_out);
-                    memcpy(&out[(out_index)* SIZE], &(buffer[ii]), 8 * SIZE);
+                    auto const row = source + size_t( i ) * width * size;
+                    for( int j = j0; j < j1; ++j )
+                        w.pixel( i, j, row + j * size );
                 }
             }
         }
     }
 
-    template<size_t SIZE>
-    void rotate_image( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
+#if defined( __SSSE3__ ) || defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#define RS2_ROTATION_SIMD
+
+    // A tile is as many rows as there are pixels in a 16-byte vector. Each round interleaves the first half of the rows
+    // with the second; that rotates the (row, column) bits of every pixel's index by one, so after as many rounds as
+    // there are bits in a row index the rows and columns are swapped. The columns are then reversed, rows of the tile
+    // being the output's columns in reverse order.
+#ifdef __SSSE3__
+    template< size_t SIZE > struct rotation_tile;
+
+    template<> struct rotation_tile< 1 >
+    {
+        typedef __m128i vector;
+        static const int rounds = 4;
+        static vector load( const uint8_t * p ) { return _mm_loadu_si128( reinterpret_cast< const __m128i * >( p ) ); }
+        static vector lo( vector a, vector b ) { return _mm_unpacklo_epi8( a, b ); }
+        static vector hi( vector a, vector b ) { return _mm_unpackhi_epi8( a, b ); }
+        static vector reverse( vector v )
+        {
+            return _mm_shuffle_epi8( v, _mm_setr_epi8( 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 ) );
+        }
+        static __m128i bytes( vector v ) { return v; }
+    };
+
+    template<> struct rotation_tile< 2 >
     {
-        auto width_out = height;
-        auto height_out = width;
+        typedef __m128i vector;
+        static const int rounds = 3;
+        static vector load( const uint8_t * p ) { return _mm_loadu_si128( reinterpret_cast< const __m128i * >( p ) ); }
+        static vector lo( vector a, vector b ) { return _mm_unpacklo_epi16( a, b ); }
+        static vector hi( vector a, vector b ) { return _mm_unpackhi_epi16( a, b ); }
+        static vector reverse( vector v )
+        {
+            return _mm_shuffle_epi8( v, _mm_setr_epi8( 14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1 ) );
+        }
+        static __m128i bytes( vector v ) { return v; }
+    };
+#else
+    template< size_t SIZE > struct rotation_tile;
 
-        auto out = dest[0];
-        for (int i = 0; i < height; ++i)
+    template<> struct rotation_tile< 1 >
+    {
+        typedef uint8x16_t vector;
+        static const int rounds = 4;
+        static vector load( const uint8_t * p ) { return vld1q_u8( p ); }
+        static vector lo( vector a, vector b ) { return vzipq_u8( a, b ).val[0]; }
+        static vector hi( vector a, vector b ) { return vzipq_u8( a, b ).val[1]; }
+        static vector reverse( vector v )
         {
-            auto row_offset = i * width;
-            for (int j = 0; j < width; ++j)
-            {
-                auto out_index = (((height_out - j) * width_out) - i - 1) * SIZE;
-                std::memcpy( &out[out_index], &( source[( row_offset + j ) * SIZE] ), SIZE );
-            }
+            v = vrev64q_u8( v );
+            return vcombine_u8( vget_high_u8( v ), vget_low_u8( v ) );
         }
-    }
+        static uint8x16_t bytes( vector v ) { return v; }
+    };
 
-    void rotate_confidence( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
+    template<> struct rotation_tile< 2 >
     {
-#pragma pack (push, 1)
-        struct lsb_msb
+        typedef uint16x8_t vector;
+        static const int rounds = 3;
+        static vector load( const uint8_t * p ) { return vld1q_u16( reinterpret_cast< const uint16_t * >( p ) ); }
+        static vector lo( vector a, vector b ) { return vzipq_u16( a, b ).val[0]; }
+        static vector hi( vector a, vector b ) { return vzipq_u16( a, b ).val[1]; }
+        static vector reverse( vector v )
         {
-            unsigned lsb : 4;
-            unsigned msb : 4;
-        };
-#pragma pack(pop)
-
-        rotate_image<1>(dest, source, width, height, actual_size);
-        auto out = dest[0];
-        for (int i = (width - 1), out_i = ((width - 1) * 2); i >= 0; --i, out_i -= 2)
+            v = vrev64q_u16( v );
+            return vcombine_u16( vget_high_u16( v ), vget_low_u16( v ) );
+        }
+        static uint8x16_t bytes( vector v ) { return vreinterpretq_u8_u16( v ); }
+    };
+#endif
+
+    // Rotates the tile whose top-left source pixel is at row i, column j
+    template< class Writer >
+    void rotate_tile( Writer const & w, const uint8_t * source, int width, int i, int j )
+    {
+        typedef rotation_tile< Writer::pixel_size > tile;
+        const int n = 16 / Writer::pixel_size;
+        const int half = n / 2;
+
+        typename tile::vector x[16], y[16];
+        for( int k = 0; k < n; ++k )
+            x[k] = tile::load( source + ( size_t( i + k ) * width + j ) * Writer::pixel_size );
+        for( int round = 0; round < tile::rounds; ++round )
         {
-            auto row_offset = i * height;
-            for (int j = 0; j < height; ++j)
+            for( int k = 0; k < half; ++k )
             {
-                auto val = *(reinterpret_cast<const lsb_msb*>(&out[(row_offset + j)]));
-                auto out_index = out_i * height + j;
-                out[out_index] = val.lsb << 4;
-                out[out_index + height] = val.msb << 4;
+                y[2 * k] = tile::lo( x[k], x[k + half] );
+                y[2 * k + 1] = tile::hi( x[k], x[k + half] );
             }
+            std::copy( y, y + n, x );
         }
+        for( int k = 0; k < n; ++k )
+            w.store( i, j + k, tile::bytes( tile::reverse( x[k] ) ) );
+    }
+#endif
+
+#ifdef RS2_ROTATION_SIMD
+    // Rotates the whole tiles of the image, returning how far they go
+    template< class Writer >
+    void rotate_tiles( Writer const & w, const uint8_t * source, int width, int height, int & tiled_width, int & tiled_height, std::true_type )
+    {
+        if( get_simd_level() < simd_level::simd128 )
+            return;
+        const int n = 16 / Writer::pixel_size;
+        tiled_width = width / n * n;
+        tiled_height = height / n * n;
+        for( int i0 = 0; i0 < tiled_height; i0 += rotation_block )
+            for( int j0 = 0; j0 < tiled_width; j0 += rotation_block )
+                for( int i = i0; i < std::min( i0 + rotation_block, tiled_height ); i += n )
+                    for( int j = j0; j < std::min( j0 + rotation_block, tiled_width ); j += n )
+                        rotate_tile( w, source, width, i, j );
+    }
+
+    // Pixel sizes without a SIMD tile
+    template< class Writer >
+    void rotate_tiles( Writer const &, const uint8_t *, int, int, int &, int &, std::false_type )
+    {
+    }
+#endif
+
+    // Rotates a width x height source through the writer
+    template< class Writer >
+    void rotate_image( Writer const & w, const uint8_t * source, int width, int height )
+    {
+        int tiled_width = 0, tiled_height = 0;
+#ifdef RS2_ROTATION_SIMD
+        rotate_tiles( w, source, width, height, tiled_width, tiled_height,
+                      std::integral_constant< bool, Writer::pixel_size <= 2 >() );
+#endif
+        // What the tiles did not cover: the right edge of their rows, then all the rows below them
+        rotate_region( w, source, width, 0, tiled_height, tiled_width, width );
+        rotate_region( w, source, width, tiled_height, height, 0, width );
+    }
+
+    template< size_t SIZE >
+    void rotate_image( uint8_t * const dest[], const uint8_t * source, int width, int height )
+    {
+        rotate_image( rotated_pixels< SIZE >{ dest[0], height, width }, source, width, height );
+    }
+
+    void rotate_confidence( uint8_t * const dest[], const uint8_t * source, int width, int height )
+    {
+        rotate_image( rotated_confidence{ dest[0], height, width }, source, width, height );
     }
 
     //// Processing routines////
@@ -120,10 +294,13 @@ namespace librealsense
         switch (_target_bpp)
         {
         case 1:
-            rotate_image_optimized<1>(dest, source, rotated_width, rotated_height, actual_size);
+            rotate_image<1>(dest, source, rotated_width, rotated_height);
             break;
         case 2:
-            rotate_image_optimized<2>(dest, source, rotated_width, rotated_height, actual_size);
+            rotate_image<2>(dest, source, rotated_width, rotated_height);
+            break;
+        case 3:
+            rotate_image<3>(dest, source, rotated_width, rotated_height);
             break;
         default:
             LOG_ERROR("Rotation transform does not support format: " + std::string(rs2_format_to_string(_target_format)));
@@ -144,6 +321,6 @@ namespace librealsense
         int rotated_height = width;
 
         // Workaround: the height is given by bytes and not by pixels.
-        rotate_confidence(dest, source, rotated_width / 2, rotated_height, actual_size);
+        rotate_confidence(dest, source, rotated_width / 2, rotated_height);
     }
 }
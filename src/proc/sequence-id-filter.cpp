@@ -9,9 +9,10 @@ namespace librealsense
         : generic_processing_block("Filter By Sequence id"),
         _selected_stream_id(1.f)
     {
-        auto selected_stream_id = std::make_shared<ptr_option<float>>(0.f, 2.f, 1.f, 1.f,
+        // Up to the longest HDR sequence
+        auto selected_stream_id = std::make_shared<ptr_option<float>>(0.f, 4.f, 1.f, 1.f,
             &_selected_stream_id, "Selected stream id for display",
-            std::map<float, std::string>{ {0.f, "all"}, { 1.f, "1" }, { 2.f, "2" }});
+            std::map<float, std::string>{ {0.f, "all"}, { 1.f, "1" }, { 2.f, "2" }, { 3.f, "3" }, { 4.f, "4" }});
         register_option(RS2_OPTION_SEQUENCE_ID, selected_stream_id);
     }
 
@@ -54,7 +55,7 @@ namespace librealsense
         }
         else
         {
-            int seq_id_selected = (seq_id == 0) ? 1 : 0;
+            int seq_id_selected = static_cast<int>(_selected_stream_id) - 1;
             auto key_with_selected_id = std::make_pair(seq_id_selected, unique_id);
             if (_last_frames[key_with_selected_id])
                 return _last_frames[key_with_selected_id];
@@ -0,0 +1,198 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+// Four-lane versions of the spatial filter's floating-point recursive passes.
+//
+// The scalar passes walk one row (or column) at a time through a small valid/invalid state machine. Here that state
+// machine is written without branches, using masks, and four rows (or columns) are stepped through it together:
+// the vertical pass loads four adjacent columns of a row directly, while the horizontal pass transposes 4x4 tiles so
+// that each vector holds one column of four rows. Every lane performs exactly the scalar arithmetic, so the output is
+// the same as the scalar passes'.
+
+#pragma once
+
+#include <cstddef>
+
+#if defined( __SSSE3__ ) || defined( __SSE2__ ) || defined( _M_X64 )
+#include <emmintrin.h>
+#define RS2_SPATIAL_FILTER_SIMD "SSE"
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#include <arm_neon.h>
+#define RS2_SPATIAL_FILTER_SIMD "NEON"
+#endif
+
+
+#ifdef RS2_SPATIAL_FILTER_SIMD
+
+namespace librealsense {
+namespace dxf_simd {
+
+
+static constexpr size_t LANES = 4;
+
+#if defined( __SSSE3__ ) || defined( __SSE2__ ) || defined( _M_X64 )
+
+using vf = __m128;
+using vmask = __m128;
+
+inline vf load( float const * p ) { return _mm_loadu_ps( p ); }
+inline void store( float * p, vf v ) { _mm_storeu_ps( p, v ); }
+inline vf splat( float x ) { return _mm_set1_ps( x ); }
+inline vf add( vf a, vf b ) { return _mm_add_ps( a, b ); }
+inline vf sub( vf a, vf b ) { return _mm_sub_ps( a, b ); }
+inline vf mul( vf a, vf b ) { return _mm_mul_ps( a, b ); }
+inline vmask less( vf a, vf b ) { return _mm_cmplt_ps( a, b ); }
+inline vmask greater( vf a, vf b ) { return _mm_cmpgt_ps( a, b ); }
+inline vmask both( vmask a, vmask b ) { return _mm_and_ps( a, b ); }
+inline vf select( vmask m, vf a, vf b ) { return _mm_or_ps( _mm_and_ps( m, a ), _mm_andnot_ps( m, b ) ); }
+// Same test as the scalar passes' *(int*)&x > 0: positive, non-zero values are valid
+inline vmask valid( vf x )
+{
+    return _mm_castsi128_ps( _mm_cmpgt_epi32( _mm_castps_si128( x ), _mm_setzero_si128() ) );
+}
+inline void transpose( vf & a, vf & b, vf & c, vf & d ) { _MM_TRANSPOSE4_PS( a, b, c, d ); }
+
+#else  // NEON
+
+using vf = float32x4_t;
+using vmask = uint32x4_t;
+
+inline vf load( float const * p ) { return vld1q_f32( p ); }
+inline void store( float * p, vf v ) { vst1q_f32( p, v ); }
+inline vf splat( float x ) { return vdupq_n_f32( x ); }
+inline vf add( vf a, vf b ) { return vaddq_f32( a, b ); }
+inline vf sub( vf a, vf b ) { return vsubq_f32( a, b ); }
+inline vf mul( vf a, vf b ) { return vmulq_f32( a, b ); }
+inline vmask less( vf a, vf b ) { return vcltq_f32( a, b ); }
+inline vmask greater( vf a, vf b ) { return vcgtq_f32( a, b ); }
+inline vmask both( vmask a, vmask b ) { return vandq_u32( a, b ); }
+inline vf select( vmask m, vf a, vf b ) { return vbslq_f32( m, a, b ); }
+inline vmask valid( vf x ) { return vcgtq_s32( vreinterpretq_s32_f32( x ), vdupq_n_s32( 0 ) ); }
+inline void transpose( vf & a, vf & b, vf & c, vf & d )
+{
+    float32x4x2_t ab = vtrnq_f32( a, b );
+    float32x4x2_t cd = vtrnq_f32( c, d );
+    a = vcombine_f32( vget_low_f32( ab.val[0] ), vget_low_f32( cd.val[0] ) );
+    b = vcombine_f32( vget_low_f32( ab.val[1] ), vget_low_f32( cd.val[1] ) );
+    c = vcombine_f32( vget_high_f32( ab.val[0] ), vget_high_f32( cd.val[0] ) );
+    d = vcombine_f32( vget_high_f32( ab.val[1] ), vget_high_f32( cd.val[1] ) );
+}
+
+#endif
+
+
+struct params
+{
+    vf alpha, one_minus_alpha, delta, minus_delta;
+
+    params( float alpha_, float delta_ )
+        : alpha( splat( alpha_ ) )
+        , one_minus_alpha( splat( 1.0f - alpha_ ) )
+        , delta( splat( delta_ ) )
+        , minus_delta( splat( -delta_ ) )
+    {
+    }
+};
+
+// One step of the recursion, for the next pixel 'x' of each lane; returns the value to store back. The previous
+// pixel being valid is what the scalar code tracks as its CurrentlyValid/CurrentlyInvalid state.
+inline vf step( params const & p, vf x, vf & state, vf & previous )
+{
+    vmask const x_valid = valid( x );
+    vf const diff = sub( previous, x );
+    vmask const smooth = both( both( x_valid, valid( previous ) ),
+                               both( less( diff, p.delta ), greater( diff, p.minus_delta ) ) );
+    vf const filtered = add( mul( x, p.alpha ), mul( state, p.one_minus_alpha ) );
+    state = select( smooth, filtered, select( x_valid, x, state ) );
+    previous = x;
+    return select( smooth, filtered, x );
+}
+
+
+// Both vertical passes over columns [col, col + LANES)
+inline void vertical( float * image, size_t width, size_t height, size_t col, params const & p )
+{
+    float * im = image + col;
+    vf state = load( im );
+    vf previous = state;
+    for( size_t v = 1; v < height; ++v )
+    {
+        im += width;
+        store( im, step( p, load( im ), state, previous ) );
+    }
+    // im now points at the last row
+    state = previous = load( im );
+    for( size_t v = 1; v < height; ++v )
+    {
+        im -= width;
+        store( im, step( p, load( im ), state, previous ) );
+    }
+}
+
+
+// Both horizontal passes over rows [row, row + LANES)
+inline void horizontal( float * image, size_t width, size_t row, params const & p )
+{
+    float * r[LANES];
+    for( size_t i = 0; i < LANES; ++i )
+        r[i] = image + ( row + i ) * width;
+
+    auto gather = [&]( size_t u ) {
+        float x[LANES] = { r[0][u], r[1][u], r[2][u], r[3][u] };
+        return load( x );
+    };
+    auto scatter = [&]( size_t u, vf v ) {
+        float x[LANES];
+        store( x, v );
+        for( size_t i = 0; i < LANES; ++i )
+            r[i][u] = x[i];
+    };
+
+    // left to right, over columns 1..width-1
+    vf state = gather( 0 );
+    vf previous = state;
+    size_t u = 1;
+    for( ; u + LANES <= width; u += LANES )
+    {
+        vf c0 = load( r[0] + u ), c1 = load( r[1] + u ), c2 = load( r[2] + u ), c3 = load( r[3] + u );
+        transpose( c0, c1, c2, c3 );  // now c<k> is column u+k of all four rows
+        c0 = step( p, c0, state, previous );
+        c1 = step( p, c1, state, previous );
+        c2 = step( p, c2, state, previous );
+        c3 = step( p, c3, state, previous );
+        transpose( c0, c1, c2, c3 );
+        store( r[0] + u, c0 );
+        store( r[1] + u, c1 );
+        store( r[2] + u, c2 );
+        store( r[3] + u, c3 );
+    }
+    for( ; u < width; ++u )
+        scatter( u, step( p, gather( u ), state, previous ) );
+
+    // right to left, over columns width-2..0
+    state = previous = gather( width - 1 );
+    size_t end = width - 1;  // one past the next column to process
+    for( ; end >= LANES; end -= LANES )
+    {
+        u = end - LANES;
+        vf c0 = load( r[0] + u ), c1 = load( r[1] + u ), c2 = load( r[2] + u ), c3 = load( r[3] + u );
+        transpose( c0, c1, c2, c3 );
+        c3 = step( p, c3, state, previous );
+        c2 = step( p, c2, state, previous );
+        c1 = step( p, c1, state, previous );
+        c0 = step( p, c0, state, previous );
+        transpose( c0, c1, c2, c3 );
+        store( r[0] + u, c0 );
+        store( r[1] + u, c1 );
+        store( r[2] + u, c2 );
+        store( r[3] + u, c3 );
+    }
+    while( end-- > 0 )
+        scatter( end, step( p, gather( end ), state, previous ) );
+}
+
+
+}  // namespace dxf_simd
+}  // namespace librealsense
+
+#endif  // RS2_SPATIAL_FILTER_SIMD
@@ -8,6 +8,8 @@
 #include "proc/synthetic-stream.h"
 #include "proc/hole-filling-filter.h"
 #include "proc/spatial-filter.h"
+#include "proc/spatial-filter-simd.h"
+#include "cpu-features.h"
 
 #include <librealsense2/hpp/rs_sensor.hpp>
 #include <librealsense2/hpp/rs_processing.hpp>
@@ -59,6 +61,7 @@ namespace librealsense
         _spatial_iterations(filter_iter_def),
         _width(0), _height(0), _stride(0), _bpp(0),
         _extension_type(RS2_EXTENSION_DEPTH_FRAME),
+        _fixed_point(false),
         _current_frm_size_pixels(0),
         _stereoscopic_depth(false),
         _focal_lenght_mm(0.f),
@@ -157,6 +160,10 @@ namespace librealsense
         register_option(RS2_OPTION_FILTER_SMOOTH_DELTA, spatial_filter_delta);
         register_option(RS2_OPTION_FILTER_MAGNITUDE, spatial_filter_iterations);
         register_option(RS2_OPTION_HOLES_FILL, holes_filling_mode);
+
+        register_processing_threads_option();
+
+        _roi.register_options(*this);
     }
 
     rs2::frame spatial_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -165,14 +172,60 @@ namespace librealsense
 
         update_configuration(f);
         tgt = prepare_target_frame(f, source);
+        auto data = static_cast<uint8_t*>(const_cast<void*>(tgt.get_data()));
+
+        if (!_roi.active())
+        {
+            smooth(data);
+            return tgt;
+        }
 
+        // The region is filtered as a frame of its own, so pixels outside it neither change nor weigh in
+        auto roi = _roi.get(int(_width), int(_height));
+        if (roi.max_x - roi.min_x < 1 || roi.max_y < roi.min_y)
+            return tgt;
+        auto const full_width = _width, full_height = _height;
+        auto const row_bytes = size_t(roi.max_x - roi.min_x + 1) * _bpp;
+        auto const rows = size_t(roi.max_y - roi.min_y + 1);
+        _roi_data.resize(row_bytes * rows);
+        auto first = data + (size_t(roi.min_y) * full_width + roi.min_x) * _bpp;
+        for (size_t y = 0; y < rows; ++y)
+            memcpy(_roi_data.data() + y * row_bytes, first + y * _stride, row_bytes);
+
+        _width = row_bytes / _bpp;
+        _height = rows;
+        smooth(_roi_data.data());
+        _width = full_width;
+        _height = full_height;
+
+        for (size_t y = 0; y < rows; ++y)
+            memcpy(first + y * _stride, _roi_data.data() + y * row_bytes, row_bytes);
+        return tgt;
+    }
+
+    void spatial_filter::smooth(void * frame_data)
+    {
         // Spatial domain transform edge-preserving filter
+        // There is no GPU version: the fixed-point passes are for boards where memory bandwidth is what limits them
+        if (_fixed_point)
+        {
+            dxf_smooth_fixed(frame_data, _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+            return;
+        }
+#ifdef RS2_USE_CUDA
+        // The hole filling of the disparity domain is done on the GPU as well
         if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
-            dxf_smooth<float>(const_cast<void*>(tgt.get_data()), _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+            _cuda_helper.smooth_disparity(static_cast<float*>(frame_data), int(_width), int(_height),
+                _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations, _holes_filling_mode ? _holes_filling_radius : 0);
         else
-            dxf_smooth<uint16_t>(const_cast<void*>(tgt.get_data()), _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
-
-        return tgt;
+            _cuda_helper.smooth_depth(static_cast<uint16_t*>(frame_data), int(_width), int(_height),
+                _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations, _holes_filling_radius);
+#else
+        if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
+            dxf_smooth<float>(frame_data, _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+        else
+            dxf_smooth<uint16_t>(frame_data, _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+#endif
     }
 
     void  spatial_filter::update_configuration(const rs2::frame& f)
@@ -183,7 +236,8 @@ namespace librealsense
             _target_stream_profile = _source_stream_profile.clone(RS2_STREAM_DEPTH, 0, _source_stream_profile.format());
 
             _extension_type = f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME;
-            _bpp = (_extension_type == RS2_EXTENSION_DISPARITY_FRAME) ? sizeof(float) : sizeof(uint16_t);
+            _fixed_point = (_extension_type == RS2_EXTENSION_DISPARITY_FRAME) && (_source_stream_profile.format() == RS2_FORMAT_DISPARITY16);
+            _bpp = (_extension_type == RS2_EXTENSION_DISPARITY_FRAME && !_fixed_point) ? sizeof(float) : sizeof(uint16_t);
             auto vp = _target_stream_profile.as<rs2::video_stream_profile>();
             _focal_lenght_mm = vp.get_intrinsics().fx;
             _width = vp.width();
@@ -238,13 +292,89 @@ namespace librealsense
         return tgt;
     }
 
-    void spatial_filter::recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ)
+    // A step of the recursive_filter_*_fp() passes over fixed-point disparity: the next value is blended into the
+    // running one if it is close enough to the value before it, both as read, and restarts it otherwise
+    static inline void dxf_fixed_step(uint16_t & value, float & state, uint16_t & previous, float alpha, float deltaZ)
+    {
+        uint16_t const innovation = value;
+        if (innovation)
+        {
+            float delta = float(previous) - float(innovation);
+            if (previous && delta < deltaZ && delta > -deltaZ)
+            {
+                state = innovation * alpha + state * (1.0f - alpha);
+                value = static_cast<uint16_t>(state + 0.5f);
+            }
+            else
+                state = innovation;
+        }
+        previous = innovation;
+    }
+
+    void spatial_filter::recursive_filter_horizontal_fixed(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end)
+    {
+        auto image = reinterpret_cast<uint16_t*>(image_data);
+        for (size_t v = row_begin; v < row_end; v++)
+        {
+            uint16_t * im = image + v * _width;
+
+            // left to right
+            uint16_t previous = im[0];
+            float state = previous;
+            for (size_t u = 1; u < _width; u++)
+                dxf_fixed_step(im[u], state, previous, alpha, deltaZ);
+
+            // right to left
+            previous = im[_width - 1];
+            state = previous;
+            for (size_t u = _width - 1; u-- > 0;)
+                dxf_fixed_step(im[u], state, previous, alpha, deltaZ);
+        }
+    }
+
+    void spatial_filter::recursive_filter_vertical_fixed(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end)
+    {
+        auto image = reinterpret_cast<uint16_t*>(image_data);
+        size_t const cols = col_end - col_begin;
+        if (!cols || _height < 2)
+            return;
+
+        // A row at a time, all the columns together, so memory is read in order rather than a column at a time
+        std::vector<float> state(cols);
+        std::vector<uint16_t> previous(cols);
+        auto pass = [&](size_t first_row, ptrdiff_t step)
+        {
+            uint16_t * im = image + first_row * _width + col_begin;
+            for (size_t u = 0; u < cols; u++)
+                state[u] = previous[u] = im[u];
+            for (size_t v = 1; v < _height; v++)
+            {
+                im += step;
+                for (size_t u = 0; u < cols; u++)
+                    dxf_fixed_step(im[u], state[u], previous[u], alpha, deltaZ);
+            }
+        };
+        pass(0, ptrdiff_t(_width));                 // top to bottom
+        pass(_height - 1, -ptrdiff_t(_width));      // bottom to top
+    }
+
+    void spatial_filter::recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end)
     {
         float *image = reinterpret_cast<float*>(image_data);
 
+#ifdef RS2_SPATIAL_FILTER_SIMD
+        // Whole groups of rows are done together; whatever is left goes through the scalar code below
+        if (_width >= 2 && get_simd_level() >= simd_level::simd128)
+        {
+            dxf_simd::params p(alpha, deltaZ);
+            for (; row_begin + dxf_simd::LANES <= row_end; row_begin += dxf_simd::LANES)
+                dxf_simd::horizontal(image, _width, row_begin, p);
+        }
+#endif
+
         int v, u;
 
-        for (v = 0; v < _height;) {
+        for (v = int(row_begin); v < int(row_end);) {
             // left to right
             float *im = image + v * _width;
             float state = *im;
@@ -366,15 +496,24 @@ namespace librealsense
         }
     }
 
-    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ)
+    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end)
     {
         float *image = reinterpret_cast<float*>(image_data);
 
+#ifdef RS2_SPATIAL_FILTER_SIMD
+        if (_height >= 2 && get_simd_level() >= simd_level::simd128)
+        {
+            dxf_simd::params p(alpha, deltaZ);
+            for (; col_begin + dxf_simd::LANES <= col_end; col_begin += dxf_simd::LANES)
+                dxf_simd::vertical(image, _width, _height, col_begin, p);
+        }
+#endif
+
         int v, u;
 
         // we'll do one column at a time, top to bottom, bottom to top, left to right,
 
-        for (u = 0; u < _width;) {
+        for (u = int(col_begin); u < int(col_end);) {
 
             float *im = image + u;
             float state = im[0];
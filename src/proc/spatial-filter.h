@@ -12,6 +12,12 @@
 
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
+#include "worker-pool.h"
+#include "processing-roi.h"
+
+#ifdef RS2_USE_CUDA
+#include "../cuda/cuda-depth-filters.cuh"
+#endif
 
 namespace librealsense
 {
@@ -26,23 +32,32 @@ namespace librealsense
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
+        // The domain transform over the frame (or the region of interest) in 'frame_data', _width x _height pixels
+        void smooth(void * frame_data);
+
         template <typename T>
         void dxf_smooth(void *frame_data, float alpha, float delta, int iterations)
         {
             static_assert((std::is_arithmetic<T>::value), "Spatial filter assumes numeric types");
             const bool fp = (std::is_floating_point<T>::value);
 
+            // Rows are filtered independently of each other by the horizontal pass, and columns by the vertical one,
+            // so each pass can be split between threads without changing the result
             for (int i = 0; i < iterations; i++)
             {
                 if (fp)
                 {
-                    recursive_filter_horizontal_fp(frame_data, alpha, delta);
-                    recursive_filter_vertical_fp(frame_data, alpha, delta);
+                    for_each_range(_height, [&](size_t begin, size_t end)
+                        { recursive_filter_horizontal_fp(frame_data, alpha, delta, begin, end); });
+                    for_each_range(_width, [&](size_t begin, size_t end)
+                        { recursive_filter_vertical_fp(frame_data, alpha, delta, begin, end); });
                 }
                 else
                 {
-                    recursive_filter_horizontal<T>(frame_data, alpha, delta);
-                    recursive_filter_vertical<T>(frame_data, alpha, delta);
+                    for_each_range(_height, [&](size_t begin, size_t end)
+                        { recursive_filter_horizontal<T>(frame_data, alpha, delta, begin, end); });
+                    for_each_range(_width, [&](size_t begin, size_t end)
+                        { recursive_filter_vertical<T>(frame_data, alpha, delta, begin, end); });
                 }
             }
 
@@ -52,11 +67,32 @@ namespace librealsense
                 intertial_holes_fill<T>(static_cast<T*>(frame_data));
         }
 
-        void recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ);
-        void recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ);
+        // dxf_smooth<float>() over 16-bit fixed-point disparity (RS2_FORMAT_DISPARITY16), with the same passes: each
+        // keeps its running value in float and only rounds what it stores, which is at most half a unit (1/64 pixel)
+        // off. The passes average what they read, so a stored error is never amplified and the result is within
+        // 2 * iterations units of the floating-point filter's, away from edges whose difference is within that much
+        // of the threshold.
+        void dxf_smooth_fixed(void *frame_data, float alpha, float delta, int iterations)
+        {
+            for (int i = 0; i < iterations; i++)
+            {
+                for_each_range(_height, [&](size_t begin, size_t end)
+                    { recursive_filter_horizontal_fixed(frame_data, alpha, delta, begin, end); });
+                for_each_range(_width, [&](size_t begin, size_t end)
+                    { recursive_filter_vertical_fixed(frame_data, alpha, delta, begin, end); });
+            }
+            if (_holes_filling_mode)
+                intertial_holes_fill<uint16_t>(static_cast<uint16_t*>(frame_data));
+        }
+
+        void recursive_filter_horizontal_fixed(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end);
+        void recursive_filter_vertical_fixed(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end);
+
+        void recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end);
+        void recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end);
 
         template <typename T>
-        void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ)
+        void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end)
         {
             size_t v{}, u{};
 
@@ -72,7 +108,7 @@ namespace librealsense
             auto image = reinterpret_cast<T*>(image_data);
             size_t cur_fill = 0;
 
-            for (v = 0; v < _height; v++)
+            for (v = row_begin; v < row_end; v++)
             {
                 // left to right
                 T *im = image + v * _width;
@@ -151,7 +187,7 @@ namespace librealsense
         }
 
         template <typename T>
-        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ)
+        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end)
         {
             size_t v{}, u{};
 
@@ -170,12 +206,13 @@ namespace librealsense
 
             // top to bottom
 
-            T *im = image;
+            T *im;
             T im0{};
             T imw{};
             for (v = 1; v < _height; v++)
             {
-                for (u = 0; u < _width; u++)
+                im = image + (v - 1) * _width + col_begin;
+                for (u = col_begin; u < col_end; u++)
                 {
                     im0 = im[0];
                     imw = im[_width];
@@ -194,10 +231,10 @@ namespace librealsense
             }
 
             // bottom to top
-            im = image + (_height - 2) * _width;
-            for (v = 1; v < _height; v++, im -= (_width * 2))
+            for (v = 1; v < _height; v++)
             {
-                for (u = 0; u < _width; u++)
+                im = image + (_height - 1 - v) * _width + col_begin;
+                for (u = col_begin; u < col_end; u++)
                 {
                     im0 = im[0];
                     imw = im[_width];
@@ -264,6 +301,7 @@ namespace librealsense
         }
 
     private:
+        friend class depth_postprocess;  // runs the passes over bands of rows
 
         float                   _spatial_alpha_param;
         uint8_t                 _spatial_delta_param;
@@ -272,6 +310,7 @@ namespace librealsense
         size_t                  _width, _height, _stride;
         size_t                  _bpp;
         rs2_extension           _extension_type;            // Strictly Depth/Disparity
+        bool                    _fixed_point;               // Disparity in RS2_FORMAT_DISPARITY16
         size_t                  _current_frm_size_pixels;
         rs2::stream_profile     _source_stream_profile;
         rs2::stream_profile     _target_stream_profile;
@@ -280,6 +319,11 @@ namespace librealsense
         float                   _stereo_baseline_mm;
         uint8_t                 _holes_filling_mode;
         uint8_t                 _holes_filling_radius;
+        processing_roi          _roi;                       // Outside it the frame passes unfiltered
+        std::vector<uint8_t>    _roi_data;                  // The region of interest, filtered on its own
+#ifdef RS2_USE_CUDA
+        rscuda::spatial_filter_cuda_helper _cuda_helper;
+#endif
     };
     MAP_EXTENSION(RS2_EXTENSION_SPATIAL_FILTER, librealsense::spatial_filter);
 }
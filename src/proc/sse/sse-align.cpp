@@ -12,6 +12,8 @@
 #include "environment.h"
 #include "stream.h"
 
+#include <algorithm>
+
 using namespace librealsense;
 
 template<int N> struct bytes { uint8_t b[N]; };
@@ -193,52 +195,122 @@ inline void get_texture_map_sse(const uint16_t * depth,
     }
 }
 
-image_transform::image_transform(const rs2_intrinsics& from, float depth_scale)
-    :_depth(from),
-    _depth_scale(depth_scale),
-    _pixel_top_left_int(from.width*from.height),
-    _pixel_bottom_right_int(from.width*from.height)
+// The first half of get_texture_map_sse(): the points of 'size' depth pixels, in planes of x, y and z
+inline void deproject_depth_sse(const uint16_t * depth,
+    float depth_scale,
+    const unsigned int size,
+    const float * pre_compute_x, const float * pre_compute_y,
+    float * points_x, float * points_y, float * points_z)
 {
-}
+    const __m128i mask0 = _mm_set_epi8((char)0xff, (char)0xff, (char)7, (char)6, (char)0xff, (char)0xff, (char)5, (char)4,
+        (char)0xff, (char)0xff, (char)3, (char)2, (char)0xff, (char)0xff, (char)1, (char)0);
+    const __m128i mask1 = _mm_set_epi8((char)0xff, (char)0xff, (char)15, (char)14, (char)0xff, (char)0xff, (char)13, (char)12,
+        (char)0xff, (char)0xff, (char)11, (char)10, (char)0xff, (char)0xff, (char)9, (char)8);
 
-void image_transform::pre_compute_x_y_map_corners()
-{
-    pre_compute_x_y_map(_pre_compute_map_x_top_left, _pre_compute_map_y_top_left, -0.5f);
-    pre_compute_x_y_map(_pre_compute_map_x_bottom_right, _pre_compute_map_y_bottom_right, 0.5f);
+    auto scale = _mm_set_ps1(depth_scale);
+
+    for (unsigned int i = 0; i < size; i += 8)
+    {
+        __m128i d = _mm_load_si128((__m128i const*)(depth + i));
+
+        __m128 depth0 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_shuffle_epi8(d, mask0)), scale);
+        __m128 depth1 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_shuffle_epi8(d, mask1)), scale);
+
+        _mm_store_ps(points_x + i, _mm_mul_ps(depth0, _mm_load_ps(pre_compute_x + i)));
+        _mm_store_ps(points_x + i + 4, _mm_mul_ps(depth1, _mm_load_ps(pre_compute_x + i + 4)));
+        _mm_store_ps(points_y + i, _mm_mul_ps(depth0, _mm_load_ps(pre_compute_y + i)));
+        _mm_store_ps(points_y + i + 4, _mm_mul_ps(depth1, _mm_load_ps(pre_compute_y + i + 4)));
+        _mm_store_ps(points_z + i, depth0);
+        _mm_store_ps(points_z + i + 4, depth1);
+    }
 }
 
-void image_transform::pre_compute_x_y_map(std::vector<float>& pre_compute_map_x,
-    std::vector<float>& pre_compute_map_y,
-    float offset)
+// The second half of get_texture_map_sse(), with the same results: the points from deproject_depth_sse(), mapped onto
+// the other image
+template<rs2_distortion dist>
+inline void project_points_sse(const float * points_x, const float * points_y, const float * points_z,
+    const unsigned int size,
+    uint8_t * pixels_ptr_int,
+    const rs2_intrinsics& to,
+    const rs2_extrinsics& from_to_other)
 {
-    pre_compute_map_x.resize(_depth.width*_depth.height);
-    pre_compute_map_y.resize(_depth.width*_depth.height);
+    auto res = reinterpret_cast<__m128i*>(pixels_ptr_int);
+
+    __m128 r[9];
+    __m128 t[3];
+
+    for (int i = 0; i < 9; ++i)
+    {
+        r[i] = _mm_set_ps1(from_to_other.rotation[i]);
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+        t[i] = _mm_set_ps1(from_to_other.translation[i]);
+    }
+    auto zero = _mm_set_ps1(0);
+    auto half = _mm_set_ps1(0.5);
+    auto fx = _mm_set_ps1(to.fx);
+    auto fy = _mm_set_ps1(to.fy);
+    auto ppx = _mm_set_ps1(to.ppx);
+    auto ppy = _mm_set_ps1(to.ppy);
 
-    for (int h = 0; h < _depth.height; ++h)
+    for (unsigned int i = 0; i < size; i += 4)
     {
-        for (int w = 0; w < _depth.width; ++w)
-        {
-            const float pixel[] = { (float)w + offset, (float)h + offset };
+        auto px = _mm_load_ps(points_x + i);
+        auto py = _mm_load_ps(points_y + i);
+        auto pz = _mm_load_ps(points_z + i);
 
-            float x = (pixel[0] - _depth.ppx) / _depth.fx;
-            float y = (pixel[1] - _depth.ppy) / _depth.fy;
+        auto p_x = _mm_add_ps(_mm_mul_ps(r[0], px), _mm_add_ps(_mm_mul_ps(r[3], py), _mm_add_ps(_mm_mul_ps(r[6], pz), t[0])));
+        auto p_y = _mm_add_ps(_mm_mul_ps(r[1], px), _mm_add_ps(_mm_mul_ps(r[4], py), _mm_add_ps(_mm_mul_ps(r[7], pz), t[1])));
+        auto p_z = _mm_add_ps(_mm_mul_ps(r[2], px), _mm_add_ps(_mm_mul_ps(r[5], py), _mm_add_ps(_mm_mul_ps(r[8], pz), t[2])));
 
-            if (_depth.model == RS2_DISTORTION_INVERSE_BROWN_CONRADY)
-            {
-                float r2 = x * x + y * y;
-                float f = 1 + _depth.coeffs[0] * r2 + _depth.coeffs[1] * r2*r2 + _depth.coeffs[4] * r2*r2*r2;
-                float ux = x * f + 2 * _depth.coeffs[2] * x*y + _depth.coeffs[3] * (r2 + 2 * x*x);
-                float uy = y * f + 2 * _depth.coeffs[3] * x*y + _depth.coeffs[2] * (r2 + 2 * y*y);
-                x = ux;
-                y = uy;
-            }
+        p_x = _mm_div_ps(p_x, p_z);
+        p_y = _mm_div_ps(p_y, p_z);
 
-            pre_compute_map_x[h*_depth.width + w] = x;
-            pre_compute_map_y[h*_depth.width + w] = y;
-        }
+        distorte_x_y<dist>(p_x, p_y, &p_x, &p_y, to);
+
+        //zero the x and y if z is zero
+        auto cmp = _mm_cmpneq_ps(pz, zero);
+        auto u_round = _mm_and_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(p_x, fx), ppx), half), cmp);
+        auto v_round = _mm_and_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(p_y, fy), ppy), half), cmp);
+
+        auto uuvv1 = _mm_shuffle_ps(u_round, v_round, _MM_SHUFFLE(1, 0, 1, 0));
+        auto uuvv2 = _mm_shuffle_ps(u_round, v_round, _MM_SHUFFLE(3, 2, 3, 2));
+
+        _mm_store_si128(&res[0], _mm_cvtps_epi32(_mm_shuffle_ps(uuvv1, uuvv1, _MM_SHUFFLE(3, 1, 2, 0))));
+        _mm_store_si128(&res[1], _mm_cvtps_epi32(_mm_shuffle_ps(uuvv2, uuvv2, _MM_SHUFFLE(3, 1, 2, 0))));
+        res += 2;
     }
 }
 
+// Whether the depth pixels cover more than one pixel of the other image, so both of their corners are mapped
+static bool maps_both_corners(const rs2_intrinsics& depth, const rs2_intrinsics& to)
+{
+    float fov[2];
+    rs2_fov(&depth, fov);
+    float2 pixels_per_angle_depth = { (float)depth.width / fov[0], (float)depth.height / fov[1] };
+
+    rs2_fov(&to, fov);
+    float2 pixels_per_angle_target = { (float)to.width / fov[0], (float)to.height / fov[1] };
+
+    return pixels_per_angle_depth.x < pixels_per_angle_target.x || pixels_per_angle_depth.y < pixels_per_angle_target.y
+        || is_special_resolution(depth, to);
+}
+
+image_transform::image_transform(const rs2_intrinsics& from, float depth_scale)
+    :_depth(from),
+    _depth_scale(depth_scale),
+    _pixel_top_left_int(from.width*from.height),
+    _pixel_bottom_right_int(from.width*from.height)
+{
+}
+
+void image_transform::pre_compute_x_y_map_corners()
+{
+    _map_top_left = get_deprojection_map(_depth, -0.5f);
+    _map_bottom_right = get_deprojection_map(_depth, 0.5f);
+}
+
 void image_transform::align_depth_to_other(const uint16_t* z_pixels, uint16_t* dest, int bpp, const rs2_intrinsics& depth, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
@@ -253,6 +325,60 @@ void image_transform::align_depth_to_other(const uint16_t* z_pixels, uint16_t* d
     }
 }
 
+void image_transform::align_depth_to_others(const uint16_t* z_pixels, const std::vector<uint16_t*>& dests,
+    const std::vector<rs2_intrinsics>& to, const std::vector<rs2_extrinsics>& from_to_others)
+{
+    auto const size = (unsigned int)(_depth.height * _depth.width);
+    if (_other_top_left.size() < to.size())
+    {
+        _other_top_left.resize(to.size());
+        _other_bottom_right.resize(to.size());
+    }
+
+    bool any_both_corners = false;
+    std::vector<bool> both_corners(to.size());
+    for (size_t i = 0; i < to.size(); ++i)
+    {
+        both_corners[i] = maps_both_corners(_depth, to[i]);
+        any_both_corners = any_both_corners || both_corners[i];
+        _other_top_left[i].resize(size);
+        if (both_corners[i])
+            _other_bottom_right[i].resize(size);
+    }
+
+    // A strip of the points at a time, mapped onto all the other images while it is still in the cache
+    const unsigned int strip = 1024;
+    alignas(16) float points_x[strip], points_y[strip], points_z[strip];
+    auto map_corner = [&](const deprojection_map& map, std::vector<std::vector<int2>>& corners, bool bottom_right)
+    {
+        for (unsigned int first = 0; first < size; first += strip)
+        {
+            auto const count = std::min(strip, size - first);
+            deproject_depth_sse(z_pixels + first, _depth_scale, count, map.x.data() + first, map.y.data() + first,
+                points_x, points_y, points_z);
+            for (size_t i = 0; i < to.size(); ++i)
+            {
+                if (bottom_right && !both_corners[i])
+                    continue;
+                auto pixels = (uint8_t *)(corners[i].data() + first);
+                if (to[i].model == RS2_DISTORTION_MODIFIED_BROWN_CONRADY)
+                    project_points_sse<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(points_x, points_y, points_z, count, pixels,
+                        to[i], from_to_others[i]);
+                else
+                    project_points_sse<RS2_DISTORTION_NONE>(points_x, points_y, points_z, count, pixels,
+                        to[i], from_to_others[i]);
+            }
+        }
+    };
+    map_corner(*_map_top_left, _other_top_left, false);
+    if (any_both_corners)
+        map_corner(*_map_bottom_right, _other_bottom_right, true);
+
+    for (size_t i = 0; i < to.size(); ++i)
+        move_depth_to_other(z_pixels, dests[i], to[i], _other_top_left[i],
+            both_corners[i] ? _other_bottom_right[i] : _other_top_left[i]);
+}
+
 inline void image_transform::move_depth_to_other(const uint16_t* z_pixels, uint16_t* dest, const rs2_intrinsics& to,
     const std::vector<librealsense::int2>& pixel_top_left_int,
     const std::vector<librealsense::int2>& pixel_bottom_right_int)
@@ -301,20 +427,13 @@ template<rs2_distortion dist>
 inline void image_transform::align_depth_to_other_sse(const uint16_t * z_pixels, uint16_t * dest, const rs2_intrinsics& depth, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
-    get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
-        _pre_compute_map_y_top_left.data(), (uint8_t *)_pixel_top_left_int.data(), to, from_to_other);
+    get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _map_top_left->x.data(),
+        _map_top_left->y.data(), (uint8_t *)_pixel_top_left_int.data(), to, from_to_other);
 
-    float fov[2];
-    rs2_fov(&depth, fov);
-    float2 pixels_per_angle_depth = { (float)depth.width / fov[0], (float)depth.height / fov[1] };
-
-    rs2_fov(&to, fov);
-    float2 pixels_per_angle_target = { (float)to.width / fov[0], (float)to.height / fov[1] };
-
-    if (pixels_per_angle_depth.x < pixels_per_angle_target.x || pixels_per_angle_depth.y < pixels_per_angle_target.y || is_special_resolution(depth, to))
+    if (maps_both_corners(depth, to))
     {
-        get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
-            _pre_compute_map_y_bottom_right.data(), (uint8_t *)_pixel_bottom_right_int.data(), to, from_to_other);
+        get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _map_bottom_right->x.data(),
+            _map_bottom_right->y.data(), (uint8_t *)_pixel_bottom_right_int.data(), to, from_to_other);
 
         move_depth_to_other(z_pixels, dest, to, _pixel_top_left_int, _pixel_bottom_right_int);
     }
@@ -329,39 +448,52 @@ template<rs2_distortion dist>
 inline void image_transform::align_other_to_depth_sse(const uint16_t * z_pixels, const uint8_t * source, uint8_t * dest, int bpp, const rs2_intrinsics& to,
     const rs2_extrinsics& from_to_other)
 {
-    get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_top_left.data(),
-        _pre_compute_map_y_top_left.data(), (uint8_t *)_pixel_top_left_int.data(), to, from_to_other);
-
-    std::vector<int2>& bottom_right = _pixel_top_left_int;
-    if (to.height < _depth.height && to.width < _depth.width)
+    // Only the bottom-right corners are used when the other image is smaller; the top-left table used to be
+    // overwritten with them in that case, which is the same as using them for both corners
+    bool const bottom_right = to.height < _depth.height && to.width < _depth.width;
+    auto & corners = bottom_right ? _pixel_bottom_right_int : _pixel_top_left_int;
+    auto map_x = bottom_right ? _map_bottom_right->x.data() : _map_top_left->x.data();
+    auto map_y = bottom_right ? _map_bottom_right->y.data() : _map_top_left->y.data();
+
+    // Each depth row is mapped and filled in on its own. The texture-map kernel does 8 aligned pixels at a time, so
+    // rows are split between threads only when that keeps every range on an 8-pixel boundary.
+    auto align_rows = [&](size_t row_begin, size_t row_end)
     {
-        get_texture_map_sse<dist>(z_pixels, _depth_scale, _depth.height*_depth.width, _pre_compute_map_x_bottom_right.data(),
-            _pre_compute_map_y_bottom_right.data(), (uint8_t *)_pixel_bottom_right_int.data(), to, from_to_other);
+        auto const first = row_begin * _depth.width;
+        auto const count = (row_end - row_begin) * _depth.width;
+        memset(dest + first * bpp, 0, count * bpp);
 
-        bottom_right = _pixel_bottom_right_int;
-    }
+        get_texture_map_sse<dist>(z_pixels + first, _depth_scale, (unsigned int)count, map_x + first, map_y + first,
+            (uint8_t *)(corners.data() + first), to, from_to_other);
+        _mm_sfence();  // the texture map is written with streaming stores
 
-    switch (bpp)
-    {
-    case 1:
-        move_other_to_depth(z_pixels, reinterpret_cast<const bytes<1>*>(source), reinterpret_cast<bytes<1>*>(dest), to,
-            _pixel_top_left_int, bottom_right);
-        break;
-    case 2:
-        move_other_to_depth(z_pixels, reinterpret_cast<const bytes<2>*>(source), reinterpret_cast<bytes<2>*>(dest), to,
-            _pixel_top_left_int, bottom_right);
-        break;
-    case 3:
-        move_other_to_depth(z_pixels, reinterpret_cast<const bytes<3>*>(source), reinterpret_cast<bytes<3>*>(dest), to,
-            _pixel_top_left_int, bottom_right);
-        break;
-    case 4:
-        move_other_to_depth(z_pixels, reinterpret_cast<const bytes<4>*>(source), reinterpret_cast<bytes<4>*>(dest), to,
-            _pixel_top_left_int, bottom_right);
-        break;
-    default:
-        break;
-    }
+        switch (bpp)
+        {
+        case 1:
+            move_other_to_depth(z_pixels, reinterpret_cast<const bytes<1>*>(source), reinterpret_cast<bytes<1>*>(dest), to,
+                corners, corners, int(row_begin), int(row_end));
+            break;
+        case 2:
+            move_other_to_depth(z_pixels, reinterpret_cast<const bytes<2>*>(source), reinterpret_cast<bytes<2>*>(dest), to,
+                corners, corners, int(row_begin), int(row_end));
+            break;
+        case 3:
+            move_other_to_depth(z_pixels, reinterpret_cast<const bytes<3>*>(source), reinterpret_cast<bytes<3>*>(dest), to,
+                corners, corners, int(row_begin), int(row_end));
+            break;
+        case 4:
+            move_other_to_depth(z_pixels, reinterpret_cast<const bytes<4>*>(source), reinterpret_cast<bytes<4>*>(dest), to,
+                corners, corners, int(row_begin), int(row_end));
+            break;
+        default:
+            break;
+        }
+    };
+
+    if (_threads > 1 && _depth.width % 8 == 0)
+        _workers->parallel_for(0, _depth.height, _threads, align_rows);
+    else
+        align_rows(0, _depth.height);
 }
 
 template<class T >
@@ -369,10 +501,11 @@ void image_transform::move_other_to_depth(const uint16_t* z_pixels,
     const T* source,
     T* dest, const rs2_intrinsics& to,
     const std::vector<librealsense::int2>& pixel_top_left_int,
-    const std::vector<librealsense::int2>& pixel_bottom_right_int)
+    const std::vector<librealsense::int2>& pixel_bottom_right_int,
+    int row_begin, int row_end)
 {
     // Iterate over the pixels of the depth image
-    for (int y = 0; y < _depth.height; ++y)
+    for (int y = row_begin; y < row_end; ++y)
     {
         for (int x = 0; x < _depth.width; ++x)
         {
@@ -423,11 +556,39 @@ void align_sse::align_z_to_other(rs2::video_frame& aligned, const rs2::video_fra
     _stream_transform->align_depth_to_other(z_pixels, reinterpret_cast<uint16_t*>(aligned_data), 2, z_intrin, other_intrin, z_to_other);
 }
 
+void align_sse::align_z_to_others(std::vector<rs2::video_frame>& aligned, const rs2::video_frame& depth,
+    const std::vector<rs2::video_stream_profile>& other_profiles, float z_scale)
+{
+    auto depth_profile = depth.get_profile().as<rs2::video_stream_profile>();
+    auto z_intrin = depth_profile.get_intrinsics();
+
+    std::vector<uint16_t*> dests;
+    std::vector<rs2_intrinsics> other_intrins;
+    std::vector<rs2_extrinsics> z_to_others;
+    for (size_t i = 0; i < aligned.size(); ++i)
+    {
+        uint8_t * aligned_data = reinterpret_cast<uint8_t *>(const_cast<void*>(aligned[i].get_data()));
+        auto aligned_profile = aligned[i].get_profile().as<rs2::video_stream_profile>();
+        memset(aligned_data, 0, aligned_profile.height() * aligned_profile.width() * aligned[i].get_bytes_per_pixel());
+        dests.push_back(reinterpret_cast<uint16_t*>(aligned_data));
+        other_intrins.push_back(other_profiles[i].get_intrinsics());
+        z_to_others.push_back(depth_profile.get_extrinsics_to(other_profiles[i]));
+    }
+
+    auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
+
+    if (_stream_transform == nullptr)
+    {
+        _stream_transform = std::make_shared<image_transform>(z_intrin, z_scale);
+        _stream_transform->pre_compute_x_y_map_corners();
+    }
+    _stream_transform->align_depth_to_others(z_pixels, dests, other_intrins, z_to_others);
+}
+
 void align_sse::align_other_to_z(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_frame& other, float z_scale)
 {
+    // Cleared by the transform, one range of rows at a time
     uint8_t * aligned_data = reinterpret_cast<uint8_t *>(const_cast<void*>(aligned.get_data()));
-    auto aligned_profile = aligned.get_profile().as<rs2::video_stream_profile>();
-    memset(aligned_data, 0, aligned_profile.height() * aligned_profile.width() * aligned.get_bytes_per_pixel());
 
     auto depth_profile = depth.get_profile().as<rs2::video_stream_profile>();
     auto other_profile = other.get_profile().as<rs2::video_stream_profile>();
@@ -444,6 +605,7 @@ void align_sse::align_other_to_z(rs2::video_frame& aligned, const rs2::video_fra
         _stream_transform = std::make_shared<image_transform>(z_intrin, z_scale);
         _stream_transform->pre_compute_x_y_map_corners();
     }
+    _stream_transform->set_workers(get_workers(), _threads);
 
     _stream_transform->align_other_to_depth(z_pixels, other_pixels, aligned_data, other.get_bytes_per_pixel(), other_intrin, z_to_other);
 }
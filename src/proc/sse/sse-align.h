@@ -4,6 +4,7 @@
 #ifdef __SSSE3__
 
 #include "proc/align.h"
+#include "proc/deprojection-map.h"
 #include <src/float3.h>
 
 namespace librealsense
@@ -26,24 +27,40 @@ namespace librealsense
             uint8_t* dest, int bpp, const rs2_intrinsics& to,
             const rs2_extrinsics& from_to_other);
 
+        // align_depth_to_other() for several other images, deprojecting the depth once for all of them
+        void align_depth_to_others(const uint16_t* z_pixels,
+            const std::vector<uint16_t*>& dests,
+            const std::vector<rs2_intrinsics>& to,
+            const std::vector<rs2_extrinsics>& from_to_others);
+
         void pre_compute_x_y_map_corners();
 
+        // Let align_other_to_depth() split the depth rows between 'threads' threads of 'workers'; null to run
+        // everything on the calling thread
+        void set_workers(std::shared_ptr<worker_pool> workers, size_t threads)
+        {
+            _workers = std::move(workers);
+            _threads = _workers ? threads : 1;
+        }
+
     private:
 
         const rs2_intrinsics _depth;
         float _depth_scale;
 
-        std::vector<float> _pre_compute_map_x_top_left;
-        std::vector<float> _pre_compute_map_y_top_left;
-        std::vector<float> _pre_compute_map_x_bottom_right;
-        std::vector<float> _pre_compute_map_y_bottom_right;
+        // Shared with the other aligns and pointclouds of the same depth intrinsics
+        std::shared_ptr<const deprojection_map> _map_top_left;
+        std::shared_ptr<const deprojection_map> _map_bottom_right;
 
         std::vector<int2> _pixel_top_left_int;
         std::vector<int2> _pixel_bottom_right_int;
 
-        void pre_compute_x_y_map(std::vector<float>& pre_compute_map_x,
-            std::vector<float>& pre_compute_map_y,
-            float offset = 0);
+        // Per other image, for align_depth_to_others()
+        std::vector<std::vector<int2>> _other_top_left;
+        std::vector<std::vector<int2>> _other_bottom_right;
+
+        std::shared_ptr<worker_pool> _workers;
+        size_t _threads = 1;
 
         template<rs2_distortion dist = RS2_DISTORTION_NONE>
         inline void align_depth_to_other_sse(const uint16_t* z_pixels,
@@ -67,7 +84,8 @@ namespace librealsense
             const T* source,
             T* dest, const rs2_intrinsics& to,
             const std::vector<int2>& pixel_top_left_int,
-            const std::vector<int2>& pixel_bottom_right_int);
+            const std::vector<int2>& pixel_bottom_right_int,
+            int row_begin, int row_end);
 
     };
 
@@ -75,6 +93,7 @@ namespace librealsense
     {
     public:
         align_sse(rs2_stream to_stream) : align(to_stream, "Align (SSE3)") {}
+        align_sse(const std::vector<rs2_stream>& to_streams) : align(to_streams, "Align (SSE3)") {}
 
     protected:
         void reset_cache(rs2_stream from, rs2_stream to) override;
@@ -83,6 +102,9 @@ namespace librealsense
 
         void align_other_to_z(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_frame& other, float z_scale) override;
 
+        void align_z_to_others(std::vector<rs2::video_frame>& aligned, const rs2::video_frame& depth,
+                               const std::vector<rs2::video_stream_profile>& other_profiles, float z_scale) override;
+
     private:
         std::shared_ptr<image_transform> _stream_transform;
     };
@@ -9,13 +9,11 @@
 #include "sse-pointcloud.h"
 #include "../../option.h"
 
+#include <algorithm>
 #include <iostream>
 
-#ifdef __SSSE3__
-
-#include <tmmintrin.h> // For SSSE3 intrinsics
-
-#endif
+#include "sse-projection.h"
+#include <librealsense2/rsutil.h>
 
 namespace librealsense
 {
@@ -23,33 +21,7 @@ namespace librealsense
 
     void pointcloud_sse::preprocess()
     {
-        _pre_compute_map_x.resize(_depth_intrinsics->width*_depth_intrinsics->height);
-        _pre_compute_map_y.resize(_depth_intrinsics->width*_depth_intrinsics->height);
-
-        for (int h = 0; h < _depth_intrinsics->height; ++h)
-        {
-            for (int w = 0; w < _depth_intrinsics->width; ++w)
-            {
-                const float pixel[] = { (float)w, (float)h };
-
-                float x = (pixel[0] - _depth_intrinsics->ppx) / _depth_intrinsics->fx;
-                float y = (pixel[1] - _depth_intrinsics->ppy) / _depth_intrinsics->fy;
-
-
-                if (_depth_intrinsics->model == RS2_DISTORTION_INVERSE_BROWN_CONRADY)
-                {
-                    float r2 = x * x + y * y;
-                    float f = 1 + _depth_intrinsics->coeffs[0] * r2 + _depth_intrinsics->coeffs[1] * r2*r2 + _depth_intrinsics->coeffs[4] * r2*r2*r2;
-                    float ux = x * f + 2 * _depth_intrinsics->coeffs[2] * x*y + _depth_intrinsics->coeffs[3] * (r2 + 2 * x*x);
-                    float uy = y * f + 2 * _depth_intrinsics->coeffs[3] * x*y + _depth_intrinsics->coeffs[2] * (r2 + 2 * y*y);
-                    x = ux;
-                    y = uy;
-                }
-
-                _pre_compute_map_x[h*_depth_intrinsics->width + w] = x;
-                _pre_compute_map_y[h*_depth_intrinsics->width + w] = y;
-            }
-        }
+        _map = get_deprojection_map(*_depth_intrinsics);
     }
 
     const float3* pointcloud_sse::depth_to_points(rs2::points output,
@@ -60,12 +32,12 @@ namespace librealsense
 
         auto depth_image = (const uint16_t*)depth_frame.get_data();
 
-        float* pre_compute_x = _pre_compute_map_x.data();
-        float* pre_compute_y = _pre_compute_map_y.data();
+        const float* pre_compute_x = _map->x.data();
+        const float* pre_compute_y = _map->y.data();
 
         uint32_t size = depth_intrinsics.height * depth_intrinsics.width;
 
-        auto point = (float*)output.get_vertices();
+        auto points = (float*)output.get_vertices();
 
         //mask for shuffle
         const __m128i mask0 = _mm_set_epi8((char)0xff, (char)0xff, (char)7, (char)6, (char)0xff, (char)0xff, (char)5, (char)4,
@@ -78,81 +50,80 @@ namespace librealsense
         auto mapx = pre_compute_x;
         auto mapy = pre_compute_y;
 
-        for (unsigned int i = 0; i < size; i += 8)
+        // Split in blocks of 8 pixels, the kernel's step, so every range starts aligned whatever the width
+        for_each_range((size + 7) / 8, [&](size_t begin, size_t end)
         {
-            auto x0 = _mm_load_ps(mapx + i);
-            auto x1 = _mm_load_ps(mapx + i + 4);
+            auto point = points + begin * 24;
+            for (size_t i = begin * 8; i < end * 8; i += 8)
+            {
+                auto x0 = _mm_load_ps(mapx + i);
+                auto x1 = _mm_load_ps(mapx + i + 4);
 
-            auto y0 = _mm_load_ps(mapy + i);
-            auto y1 = _mm_load_ps(mapy + i + 4);
+                auto y0 = _mm_load_ps(mapy + i);
+                auto y1 = _mm_load_ps(mapy + i + 4);
 
-            __m128i d = _mm_load_si128((__m128i const*)(depth_image + i));        //d7 d7 d6 d6 d5 d5 d4 d4 d3 d3 d2 d2 d1 d1 d0 d0
+                __m128i d = _mm_load_si128((__m128i const*)(depth_image + i));        //d7 d7 d6 d6 d5 d5 d4 d4 d3 d3 d2 d2 d1 d1 d0 d0
 
-                                                                            //split the depth pixel to 2 registers of 4 floats each
-            __m128i d0 = _mm_shuffle_epi8(d, mask0);        // 00 00 d3 d3 00 00 d2 d2 00 00 d1 d1 00 00 d0 d0
-            __m128i d1 = _mm_shuffle_epi8(d, mask1);        // 00 00 d7 d7 00 00 d6 d6 00 00 d5 d5 00 00 d4 d4
+                                                                                //split the depth pixel to 2 registers of 4 floats each
+                __m128i d0 = _mm_shuffle_epi8(d, mask0);        // 00 00 d3 d3 00 00 d2 d2 00 00 d1 d1 00 00 d0 d0
+                __m128i d1 = _mm_shuffle_epi8(d, mask1);        // 00 00 d7 d7 00 00 d6 d6 00 00 d5 d5 00 00 d4 d4
 
-            __m128 depth0 = _mm_cvtepi32_ps(d0); //convert depth to float
-            __m128 depth1 = _mm_cvtepi32_ps(d1); //convert depth to float
+                __m128 depth0 = _mm_cvtepi32_ps(d0); //convert depth to float
+                __m128 depth1 = _mm_cvtepi32_ps(d1); //convert depth to float
 
-            depth0 = _mm_mul_ps(depth0, scale);
-            depth1 = _mm_mul_ps(depth1, scale);
+                depth0 = _mm_mul_ps(depth0, scale);
+                depth1 = _mm_mul_ps(depth1, scale);
 
-            auto p0x = _mm_mul_ps(depth0, x0);
-            auto p0y = _mm_mul_ps(depth0, y0);
+                auto p0x = _mm_mul_ps(depth0, x0);
+                auto p0y = _mm_mul_ps(depth0, y0);
 
-            auto p1x = _mm_mul_ps(depth1, x1);
-            auto p1y = _mm_mul_ps(depth1, y1);
+                auto p1x = _mm_mul_ps(depth1, x1);
+                auto p1y = _mm_mul_ps(depth1, y1);
 
-            //scattering of the x y z
-            auto x_y0 = _mm_shuffle_ps(p0x, p0y, _MM_SHUFFLE(2, 0, 2, 0));
-            auto z_x0 = _mm_shuffle_ps(depth0, p0x, _MM_SHUFFLE(3, 1, 2, 0));
-            auto y_z0 = _mm_shuffle_ps(p0y, depth0, _MM_SHUFFLE(3, 1, 3, 1));
+                //scattering of the x y z
+                auto x_y0 = _mm_shuffle_ps(p0x, p0y, _MM_SHUFFLE(2, 0, 2, 0));
+                auto z_x0 = _mm_shuffle_ps(depth0, p0x, _MM_SHUFFLE(3, 1, 2, 0));
+                auto y_z0 = _mm_shuffle_ps(p0y, depth0, _MM_SHUFFLE(3, 1, 3, 1));
 
-            auto xyz01 = _mm_shuffle_ps(x_y0, z_x0, _MM_SHUFFLE(2, 0, 2, 0));
-            auto xyz02 = _mm_shuffle_ps(y_z0, x_y0, _MM_SHUFFLE(3, 1, 2, 0));
-            auto xyz03 = _mm_shuffle_ps(z_x0, y_z0, _MM_SHUFFLE(3, 1, 3, 1));
+                auto xyz01 = _mm_shuffle_ps(x_y0, z_x0, _MM_SHUFFLE(2, 0, 2, 0));
+                auto xyz02 = _mm_shuffle_ps(y_z0, x_y0, _MM_SHUFFLE(3, 1, 2, 0));
+                auto xyz03 = _mm_shuffle_ps(z_x0, y_z0, _MM_SHUFFLE(3, 1, 3, 1));
 
-            auto x_y1 = _mm_shuffle_ps(p1x, p1y, _MM_SHUFFLE(2, 0, 2, 0));
-            auto z_x1 = _mm_shuffle_ps(depth1, p1x, _MM_SHUFFLE(3, 1, 2, 0));
-            auto y_z1 = _mm_shuffle_ps(p1y, depth1, _MM_SHUFFLE(3, 1, 3, 1));
+                auto x_y1 = _mm_shuffle_ps(p1x, p1y, _MM_SHUFFLE(2, 0, 2, 0));
+                auto z_x1 = _mm_shuffle_ps(depth1, p1x, _MM_SHUFFLE(3, 1, 2, 0));
+                auto y_z1 = _mm_shuffle_ps(p1y, depth1, _MM_SHUFFLE(3, 1, 3, 1));
 
-            auto xyz11 = _mm_shuffle_ps(x_y1, z_x1, _MM_SHUFFLE(2, 0, 2, 0));
-            auto xyz12 = _mm_shuffle_ps(y_z1, x_y1, _MM_SHUFFLE(3, 1, 2, 0));
-            auto xyz13 = _mm_shuffle_ps(z_x1, y_z1, _MM_SHUFFLE(3, 1, 3, 1));
+                auto xyz11 = _mm_shuffle_ps(x_y1, z_x1, _MM_SHUFFLE(2, 0, 2, 0));
+                auto xyz12 = _mm_shuffle_ps(y_z1, x_y1, _MM_SHUFFLE(3, 1, 2, 0));
+                auto xyz13 = _mm_shuffle_ps(z_x1, y_z1, _MM_SHUFFLE(3, 1, 3, 1));
 
 
-            //store 8 points of x y z
-            _mm_stream_ps(&point[0], xyz01);
-            _mm_stream_ps(&point[4], xyz02);
-            _mm_stream_ps(&point[8], xyz03);
-            _mm_stream_ps(&point[12], xyz11);
-            _mm_stream_ps(&point[16], xyz12);
-            _mm_stream_ps(&point[20], xyz13);
-            point += 24;
-        }
+                //store 8 points of x y z
+                _mm_stream_ps(&point[0], xyz01);
+                _mm_stream_ps(&point[4], xyz02);
+                _mm_stream_ps(&point[8], xyz03);
+                _mm_stream_ps(&point[12], xyz11);
+                _mm_stream_ps(&point[16], xyz12);
+                _mm_stream_ps(&point[20], xyz13);
+                point += 24;
+            }
+            _mm_sfence();  // the streamed stores are visible to the other threads before the range is reported done
+        });
 #endif
         return (float3*)output.get_vertices();
     }
 
-    void pointcloud_sse::get_texture_map_sse( float2 * texture_map,
-                                          const float3 * points,
-                                          const unsigned int width,
-                                          const unsigned int height,
+#ifdef __SSSE3__
+    template< rs2_distortion MODEL >
+    static void get_texture_map_sse_impl( float * res,
+                                          const float * point,
+                                          const size_t size,
                                           const rs2_intrinsics & other_intrinsics,
                                           const rs2_extrinsics & extr,
-                                          float2 * pixels_ptr )
+                                          float * res1 )
     {
-        auto tex_ptr = texture_map;
-
-#ifdef __SSSE3__
-        auto point = reinterpret_cast<const float*>(points);
-        auto res = reinterpret_cast<float*>(tex_ptr);
-        auto res1 = reinterpret_cast<float*>(pixels_ptr);
-
         __m128 r[9];
         __m128 t[3];
-        __m128 c[5];
 
         for (int i = 0; i < 9; ++i)
         {
@@ -162,85 +133,32 @@ namespace librealsense
         {
             t[i] = _mm_set_ps1(extr.translation[i]);
         }
-        for (int i = 0; i < 5; ++i)
-        {
-            c[i] = _mm_set_ps1(other_intrinsics.coeffs[i]);
-        }
 
-        auto fx = _mm_set_ps1(other_intrinsics.fx);
-        auto fy = _mm_set_ps1(other_intrinsics.fy);
-        auto ppx = _mm_set_ps1(other_intrinsics.ppx);
-        auto ppy = _mm_set_ps1(other_intrinsics.ppy);
+        sse_intrinsics const k( other_intrinsics );
         auto w = _mm_set_ps1(float(other_intrinsics.width));
         auto h = _mm_set_ps1(float(other_intrinsics.height));
-        auto mask_brown_conrady = _mm_set_ps1(RS2_DISTORTION_BROWN_CONRADY);
-        auto mask_distortion_none = _mm_set_ps1(RS2_DISTORTION_NONE);
         auto zero = _mm_set_ps1(0);
-        auto one = _mm_set_ps1(1);
-        auto two = _mm_set_ps1(2);
 
-        for (auto i = 0UL; i < height*width * 3; i += 12)
+        for (auto i = 0UL; i < size * 3; i += 12)
         {
-            //load 4 points (x,y,z)
-            auto xyz1 = _mm_load_ps(point + i);
-            auto xyz2 = _mm_load_ps(point + i + 4);
-            auto xyz3 = _mm_load_ps(point + i + 8);
-
-
-            //gather x,y,z
-            auto yz = _mm_shuffle_ps(xyz1, xyz2, _MM_SHUFFLE(1, 0, 2, 1));
-            auto xy = _mm_shuffle_ps(xyz2, xyz3, _MM_SHUFFLE(2, 1, 3, 2));
-
-            auto x = _mm_shuffle_ps(xyz1, xy, _MM_SHUFFLE(2, 0, 3, 0));
-            auto y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
-            auto z = _mm_shuffle_ps(yz, xyz3, _MM_SHUFFLE(3, 0, 3, 1));
+            //load 4 points (x,y,z) and gather x,y,z
+            __m128 x, y, z;
+            deinterleave_xyz_sse( _mm_load_ps( point + i ), _mm_load_ps( point + i + 4 ), _mm_load_ps( point + i + 8 ), x, y, z );
 
             auto p_x = _mm_add_ps(_mm_mul_ps(r[0], x), _mm_add_ps(_mm_mul_ps(r[3], y), _mm_add_ps(_mm_mul_ps(r[6], z), t[0])));
             auto p_y = _mm_add_ps(_mm_mul_ps(r[1], x), _mm_add_ps(_mm_mul_ps(r[4], y), _mm_add_ps(_mm_mul_ps(r[7], z), t[1])));
             auto p_z = _mm_add_ps(_mm_mul_ps(r[2], x), _mm_add_ps(_mm_mul_ps(r[5], y), _mm_add_ps(_mm_mul_ps(r[8], z), t[2])));
 
-            p_x = _mm_div_ps(p_x, p_z);
-            p_y = _mm_div_ps(p_y, p_z);
-
-            // if(model == RS2_DISTORTION_MODIFIED_BROWN_CONRADY)
-            auto dist = _mm_set_ps1( (float)other_intrinsics.model );
-
-            auto r2 = _mm_add_ps(_mm_mul_ps(p_x, p_x), _mm_mul_ps(p_y, p_y));
-            auto r3 = _mm_add_ps(_mm_mul_ps(c[1], _mm_mul_ps(r2, r2)), _mm_mul_ps(c[4], _mm_mul_ps(r2, _mm_mul_ps(r2, r2))));
-            auto f = _mm_add_ps(one, _mm_add_ps(_mm_mul_ps(c[0], r2), r3));
-
-            auto brown = _mm_cmpeq_ps(mask_brown_conrady, dist);
-           
-            auto x_f = _mm_mul_ps(p_x, f);
-            auto y_f = _mm_mul_ps(p_y, f);
-
-            auto x_f_dist = _mm_or_ps(_mm_and_ps(brown, p_x), _mm_andnot_ps(brown, x_f));
-            auto y_f_dist = _mm_or_ps(_mm_and_ps(brown, p_y), _mm_andnot_ps(brown, y_f));
-
-            auto r4 = _mm_mul_ps(c[3], _mm_add_ps(r2, _mm_mul_ps(two, _mm_mul_ps(x_f_dist, x_f_dist))));
-            auto d_x = _mm_add_ps(x_f, _mm_add_ps(_mm_mul_ps(two, _mm_mul_ps(c[2], _mm_mul_ps(x_f_dist, y_f_dist))), r4));
-
-            auto r5 = _mm_mul_ps(c[2], _mm_add_ps(r2, _mm_mul_ps(two, _mm_mul_ps(y_f_dist, y_f_dist))));
-            auto d_y = _mm_add_ps(y_f, _mm_add_ps(_mm_mul_ps(two, _mm_mul_ps(c[3], _mm_mul_ps(x_f_dist, y_f_dist))), r5));
-
-            auto distortion_none = _mm_cmpeq_ps(mask_distortion_none, dist);
-
-            p_x = _mm_or_ps(_mm_and_ps(distortion_none, p_x ), _mm_andnot_ps(distortion_none, d_x));
-            p_y = _mm_or_ps(_mm_and_ps(distortion_none, p_y ), _mm_andnot_ps(distortion_none, d_y));
-
-            //TODO: add handle to RS2_DISTORTION_FTHETA
+            project_sse< MODEL >( p_x, p_y, p_z, k, p_x, p_y );
 
             //zero the x and y if z is zero
             auto cmp = _mm_cmpneq_ps(z, zero);
-            p_x = _mm_and_ps(_mm_add_ps(_mm_mul_ps(p_x, fx), ppx), cmp);
-            p_y = _mm_and_ps(_mm_add_ps(_mm_mul_ps(p_y, fy), ppy), cmp);
+            p_x = _mm_and_ps(p_x, cmp);
+            p_y = _mm_and_ps(p_y, cmp);
 
             //scattering of the x y before normalize and store in pixels_ptr
-            auto xx_yy01 = _mm_shuffle_ps(p_x, p_y, _MM_SHUFFLE(2, 0, 2, 0));
-            auto xx_yy23 = _mm_shuffle_ps(p_x, p_y, _MM_SHUFFLE(3, 1, 3, 1));
-
-            auto xyxy1 = _mm_shuffle_ps(xx_yy01, xx_yy23, _MM_SHUFFLE(2, 0, 2, 0));
-            auto xyxy2 = _mm_shuffle_ps(xx_yy01, xx_yy23, _MM_SHUFFLE(3, 1, 3, 1));
+            __m128 xyxy1, xyxy2;
+            interleave_xy_sse( p_x, p_y, xyxy1, xyxy2 );
 
             _mm_stream_ps(res1, xyxy1);
             _mm_stream_ps(res1 + 4, xyxy2);
@@ -251,16 +169,68 @@ namespace librealsense
             p_y = _mm_div_ps(p_y, h);
 
             //scattering of the x y after normalize and store in tex_ptr
-            xx_yy01 = _mm_shuffle_ps(p_x, p_y, _MM_SHUFFLE(2, 0, 2, 0));
-            xx_yy23 = _mm_shuffle_ps(p_x, p_y, _MM_SHUFFLE(3, 1, 3, 1));
-
-            xyxy1 = _mm_shuffle_ps(xx_yy01, xx_yy23, _MM_SHUFFLE(2, 0, 2, 0));
-            xyxy2 = _mm_shuffle_ps(xx_yy01, xx_yy23, _MM_SHUFFLE(3, 1, 3, 1));
+            interleave_xy_sse( p_x, p_y, xyxy1, xyxy2 );
 
             _mm_stream_ps(res, xyxy1);
             _mm_stream_ps(res + 4, xyxy2);
             res += 8;
         }
+        _mm_sfence();  // the streamed stores are visible to the other threads before the range is reported done
+    }
+#endif
+
+    void pointcloud_sse::get_texture_map_sse( float2 * texture_map,
+                                          const float3 * points,
+                                          const unsigned int width,
+                                          const unsigned int height,
+                                          const rs2_intrinsics & other_intrinsics,
+                                          const rs2_extrinsics & extr,
+                                          float2 * pixels_ptr )
+    {
+#ifdef __SSSE3__
+        size_t const size = size_t( height ) * width;
+
+        // Split in blocks of 8 points, so every range but the last is a whole number of the kernels' steps of 4
+        for_each_range( ( size + 7 ) / 8, [&]( size_t begin, size_t end )
+        {
+            size_t const first = begin * 8;
+            size_t const count = std::min( end * 8, size ) - first;
+            auto point = reinterpret_cast< const float * >( points + first );
+            auto res = reinterpret_cast< float * >( texture_map + first );
+            auto res1 = reinterpret_cast< float * >( pixels_ptr + first );
+
+            switch( other_intrinsics.model )
+            {
+            case RS2_DISTORTION_NONE:
+                get_texture_map_sse_impl< RS2_DISTORTION_NONE >( res, point, count, other_intrinsics, extr, res1 );
+                break;
+            case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
+                get_texture_map_sse_impl< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( res, point, count, other_intrinsics, extr, res1 );
+                break;
+            case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
+                get_texture_map_sse_impl< RS2_DISTORTION_INVERSE_BROWN_CONRADY >( res, point, count, other_intrinsics, extr, res1 );
+                break;
+            case RS2_DISTORTION_BROWN_CONRADY:
+                get_texture_map_sse_impl< RS2_DISTORTION_BROWN_CONRADY >( res, point, count, other_intrinsics, extr, res1 );
+                break;
+            default:
+                // No SSE kernel for F-theta/Kannala-Brandt: one point at a time
+                for( size_t i = first; i < first + count; ++i )
+                {
+                    auto const & p = points[i];
+                    float2 pixel = { 0, 0 };
+                    if( p.z )
+                    {
+                        float transformed[3];
+                        rs2_transform_point_to_point( transformed, &extr, &p.x );
+                        rs2_project_point_to_pixel( &pixel.x, &other_intrinsics, transformed );
+                    }
+                    pixels_ptr[i] = pixel;
+                    texture_map[i] = { pixel.x / other_intrinsics.width, pixel.y / other_intrinsics.height };
+                }
+                break;
+            }
+        } );
 #endif
 
     }
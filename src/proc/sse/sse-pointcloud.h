@@ -3,6 +3,7 @@
 
 #pragma once
 #include "../pointcloud.h"
+#include "../deprojection-map.h"
 
 namespace librealsense
 {
@@ -34,9 +35,7 @@ namespace librealsense
             const rs2_extrinsics& extr,
             float2* pixels_ptr) override;
 
-        std::vector<float> _pre_compute_map_x;
-        std::vector<float> _pre_compute_map_y;
-
-        void pre_compute_x_y_map();
+        // Shared with the other pointclouds and aligns of the same depth intrinsics
+        std::shared_ptr<const deprojection_map> _map;
     };
 }
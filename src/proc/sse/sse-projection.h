@@ -0,0 +1,199 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#ifdef __SSSE3__
+
+#include <librealsense2/h/rs_types.h>
+#include <tmmintrin.h>
+
+
+namespace librealsense {
+
+
+// Projection kernels, four points at a time, with the distortion model as a template parameter so each model gets a
+// loop of its own. They follow rs2_project_point_to_pixel and rs2_deproject_pixel_to_point exactly, for the models that
+// need no trigonometry (i.e., all but F-theta and Kannala-Brandt, which callers handle one point at a time).
+
+
+// Intrinsics broadcast to all lanes
+struct sse_intrinsics
+{
+    __m128 fx, fy, ppx, ppy;
+    __m128 c[5];
+
+    explicit sse_intrinsics( rs2_intrinsics const & intrin )
+        : fx( _mm_set_ps1( intrin.fx ) )
+        , fy( _mm_set_ps1( intrin.fy ) )
+        , ppx( _mm_set_ps1( intrin.ppx ) )
+        , ppy( _mm_set_ps1( intrin.ppy ) )
+    {
+        for( int i = 0; i < 5; ++i )
+            c[i] = _mm_set_ps1( intrin.coeffs[i] );
+    }
+};
+
+
+inline bool is_sse_projection_model( rs2_distortion model )
+{
+    return model != RS2_DISTORTION_FTHETA && model != RS2_DISTORTION_KANNALA_BRANDT4;
+}
+
+
+// Normalized image-plane coordinates -> distorted
+template< rs2_distortion MODEL >
+inline void distort_sse( __m128 & x, __m128 & y, sse_intrinsics const & k )
+{
+}
+
+// Modified and inverse Brown-Conrady project the same way: radial first, then tangential on the result
+inline void distort_modified_brown_conrady_sse( __m128 & x, __m128 & y, sse_intrinsics const & k )
+{
+    auto const one = _mm_set_ps1( 1 );
+    auto const two = _mm_set_ps1( 2 );
+    auto r2 = _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) );
+    auto r3 = _mm_add_ps( _mm_mul_ps( k.c[1], _mm_mul_ps( r2, r2 ) ), _mm_mul_ps( k.c[4], _mm_mul_ps( r2, _mm_mul_ps( r2, r2 ) ) ) );
+    auto f = _mm_add_ps( one, _mm_add_ps( _mm_mul_ps( k.c[0], r2 ), r3 ) );
+    auto xf = _mm_mul_ps( x, f );
+    auto yf = _mm_mul_ps( y, f );
+    auto xy2 = _mm_mul_ps( two, _mm_mul_ps( xf, yf ) );
+    x = _mm_add_ps( xf, _mm_add_ps( _mm_mul_ps( k.c[2], xy2 ), _mm_mul_ps( k.c[3], _mm_add_ps( r2, _mm_mul_ps( two, _mm_mul_ps( xf, xf ) ) ) ) ) );
+    y = _mm_add_ps( yf, _mm_add_ps( _mm_mul_ps( k.c[3], xy2 ), _mm_mul_ps( k.c[2], _mm_add_ps( r2, _mm_mul_ps( two, _mm_mul_ps( yf, yf ) ) ) ) ) );
+}
+
+template<>
+inline void distort_sse< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( __m128 & x, __m128 & y, sse_intrinsics const & k )
+{
+    distort_modified_brown_conrady_sse( x, y, k );
+}
+
+template<>
+inline void distort_sse< RS2_DISTORTION_INVERSE_BROWN_CONRADY >( __m128 & x, __m128 & y, sse_intrinsics const & k )
+{
+    distort_modified_brown_conrady_sse( x, y, k );
+}
+
+// Brown-Conrady: both radial and tangential from the undistorted coordinates
+template<>
+inline void distort_sse< RS2_DISTORTION_BROWN_CONRADY >( __m128 & x, __m128 & y, sse_intrinsics const & k )
+{
+    auto const one = _mm_set_ps1( 1 );
+    auto const two = _mm_set_ps1( 2 );
+    auto r2 = _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) );
+    auto r3 = _mm_add_ps( _mm_mul_ps( k.c[1], _mm_mul_ps( r2, r2 ) ), _mm_mul_ps( k.c[4], _mm_mul_ps( r2, _mm_mul_ps( r2, r2 ) ) ) );
+    auto f = _mm_add_ps( one, _mm_add_ps( _mm_mul_ps( k.c[0], r2 ), r3 ) );
+    auto xy2 = _mm_mul_ps( two, _mm_mul_ps( x, y ) );
+    auto dx = _mm_add_ps( _mm_mul_ps( x, f ), _mm_add_ps( _mm_mul_ps( k.c[2], xy2 ), _mm_mul_ps( k.c[3], _mm_add_ps( r2, _mm_mul_ps( two, _mm_mul_ps( x, x ) ) ) ) ) );
+    auto dy = _mm_add_ps( _mm_mul_ps( y, f ), _mm_add_ps( _mm_mul_ps( k.c[3], xy2 ), _mm_mul_ps( k.c[2], _mm_add_ps( r2, _mm_mul_ps( two, _mm_mul_ps( y, y ) ) ) ) ) );
+    x = dx;
+    y = dy;
+}
+
+
+// Distorted normalized coordinates -> undistorted; iterative (10 iterations, determined empirically) where needed.
+// Modified Brown-Conrady cannot be deprojected, and is left as-is like the 'none' model.
+template< rs2_distortion MODEL >
+inline void undistort_sse( __m128 & x, __m128 & y, sse_intrinsics const & k )
+{
+}
+
+template<>
+inline void undistort_sse< RS2_DISTORTION_INVERSE_BROWN_CONRADY >( __m128 & x, __m128 & y, sse_intrinsics const & k )
+{
+    auto const one = _mm_set_ps1( 1 );
+    auto const two = _mm_set_ps1( 2 );
+    auto const xo = x, yo = y;
+    for( int i = 0; i < 10; i++ )
+    {
+        auto r2 = _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) );
+        auto icdist = _mm_div_ps( one, _mm_add_ps( one, _mm_mul_ps( _mm_add_ps( _mm_mul_ps( _mm_add_ps( _mm_mul_ps( k.c[4], r2 ), k.c[1] ), r2 ), k.c[0] ), r2 ) ) );
+        auto xq = _mm_div_ps( x, icdist );
+        auto yq = _mm_div_ps( y, icdist );
+        auto xy2 = _mm_mul_ps( two, _mm_mul_ps( xq, yq ) );
+        auto delta_x = _mm_add_ps( _mm_mul_ps( k.c[2], xy2 ), _mm_mul_ps( k.c[3], _mm_add_ps( r2, _mm_mul_ps( two, _mm_mul_ps( xq, xq ) ) ) ) );
+        auto delta_y = _mm_add_ps( _mm_mul_ps( k.c[3], xy2 ), _mm_mul_ps( k.c[2], _mm_add_ps( r2, _mm_mul_ps( two, _mm_mul_ps( yq, yq ) ) ) ) );
+        x = _mm_mul_ps( _mm_sub_ps( xo, delta_x ), icdist );
+        y = _mm_mul_ps( _mm_sub_ps( yo, delta_y ), icdist );
+    }
+}
+
+template<>
+inline void undistort_sse< RS2_DISTORTION_BROWN_CONRADY >( __m128 & x, __m128 & y, sse_intrinsics const & k )
+{
+    auto const one = _mm_set_ps1( 1 );
+    auto const two = _mm_set_ps1( 2 );
+    auto const xo = x, yo = y;
+    for( int i = 0; i < 10; i++ )
+    {
+        auto r2 = _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) );
+        auto icdist = _mm_div_ps( one, _mm_add_ps( one, _mm_mul_ps( _mm_add_ps( _mm_mul_ps( _mm_add_ps( _mm_mul_ps( k.c[4], r2 ), k.c[1] ), r2 ), k.c[0] ), r2 ) ) );
+        auto xy2 = _mm_mul_ps( two, _mm_mul_ps( x, y ) );
+        auto delta_x = _mm_add_ps( _mm_mul_ps( k.c[2], xy2 ), _mm_mul_ps( k.c[3], _mm_add_ps( r2, _mm_mul_ps( two, _mm_mul_ps( x, x ) ) ) ) );
+        auto delta_y = _mm_add_ps( _mm_mul_ps( k.c[3], xy2 ), _mm_mul_ps( k.c[2], _mm_add_ps( r2, _mm_mul_ps( two, _mm_mul_ps( y, y ) ) ) ) );
+        x = _mm_mul_ps( _mm_sub_ps( xo, delta_x ), icdist );
+        y = _mm_mul_ps( _mm_sub_ps( yo, delta_y ), icdist );
+    }
+}
+
+
+// Points (x, y, z) -> pixels (px, py)
+template< rs2_distortion MODEL >
+inline void project_sse( __m128 x, __m128 y, __m128 z, sse_intrinsics const & k, __m128 & px, __m128 & py )
+{
+    x = _mm_div_ps( x, z );
+    y = _mm_div_ps( y, z );
+    distort_sse< MODEL >( x, y, k );
+    px = _mm_add_ps( _mm_mul_ps( x, k.fx ), k.ppx );
+    py = _mm_add_ps( _mm_mul_ps( y, k.fy ), k.ppy );
+}
+
+// Pixels (px, py) and their depth -> points (x, y, depth)
+template< rs2_distortion MODEL >
+inline void deproject_sse( __m128 px, __m128 py, __m128 depth, sse_intrinsics const & k, __m128 & x, __m128 & y )
+{
+    x = _mm_div_ps( _mm_sub_ps( px, k.ppx ), k.fx );
+    y = _mm_div_ps( _mm_sub_ps( py, k.ppy ), k.fy );
+    undistort_sse< MODEL >( x, y, k );
+    x = _mm_mul_ps( x, depth );
+    y = _mm_mul_ps( y, depth );
+}
+
+
+// Four interleaved xyz points (in three registers) <-> one register per coordinate
+inline void deinterleave_xyz_sse( __m128 xyz1, __m128 xyz2, __m128 xyz3, __m128 & x, __m128 & y, __m128 & z )
+{
+    auto yz = _mm_shuffle_ps( xyz1, xyz2, _MM_SHUFFLE( 1, 0, 2, 1 ) );
+    auto xy = _mm_shuffle_ps( xyz2, xyz3, _MM_SHUFFLE( 2, 1, 3, 2 ) );
+    x = _mm_shuffle_ps( xyz1, xy, _MM_SHUFFLE( 2, 0, 3, 0 ) );
+    y = _mm_shuffle_ps( yz, xy, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    z = _mm_shuffle_ps( yz, xyz3, _MM_SHUFFLE( 3, 0, 3, 1 ) );
+}
+
+inline void interleave_xyz_sse( __m128 x, __m128 y, __m128 z, __m128 & xyz1, __m128 & xyz2, __m128 & xyz3 )
+{
+    auto x_y = _mm_shuffle_ps( x, y, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+    auto z_x = _mm_shuffle_ps( z, x, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    auto y_z = _mm_shuffle_ps( y, z, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+    xyz1 = _mm_shuffle_ps( x_y, z_x, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+    xyz2 = _mm_shuffle_ps( y_z, x_y, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    xyz3 = _mm_shuffle_ps( z_x, y_z, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+}
+
+// Four interleaved xy pixels (in two registers) <-> one register per coordinate
+inline void deinterleave_xy_sse( __m128 xy1, __m128 xy2, __m128 & x, __m128 & y )
+{
+    x = _mm_shuffle_ps( xy1, xy2, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+    y = _mm_shuffle_ps( xy1, xy2, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+}
+
+inline void interleave_xy_sse( __m128 x, __m128 y, __m128 & xy1, __m128 & xy2 )
+{
+    xy1 = _mm_unpacklo_ps( x, y );
+    xy2 = _mm_unpackhi_ps( x, y );
+}
+
+
+}  // namespace librealsense
+
+#endif  // __SSSE3__
@@ -2,25 +2,70 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
 #include <functional>
+#include <thread>
+#include <chrono>
 #include "source.h"
 #include "sync.h"
 #include "proc/synthetic-stream.h"
 #include "proc/syncer-processing-block.h"
 #include <src/core/frame-processor-callback.h>
+#include <src/core/time-service.h>
+#include <src/core/stream-profile-interface.h>
+#include <src/composite-frame.h>
+#include <src/latency-stats.h>
+#include <src/frame-trace.h>
 
 
 namespace librealsense
 {
-    syncer_process_unit::syncer_process_unit(std::initializer_list< bool_option::ptr > enable_opts, bool log)
-        : processing_block("syncer"), _matcher((new composite_identity_matcher({})))
+    static std::shared_ptr< matcher > create_top_matcher( bool across_devices )
+    {
+        // Each device adds its own matcher, on its first frame, under this one
+        if( across_devices )
+            return std::make_shared< timestamp_composite_matcher >( std::vector< std::shared_ptr< matcher > >() );
+        return std::make_shared< composite_identity_matcher >( std::vector< std::shared_ptr< matcher > >() );
+    }
+
+    syncer_process_unit::syncer_process_unit( std::initializer_list< bool_option::ptr > enable_opts,
+                                              bool log,
+                                              bool across_devices )
+        : processing_block("syncer"), _matcher( create_top_matcher( across_devices ) )
         , _enable_opts(enable_opts.begin(), enable_opts.end())
+        , _inbox( INBOX_SIZE,
+                  []( frame_holder const & fh )
+                  {
+                      // If the inbox is overrun, we'll get here
+                      LOG_DEBUG( "DROPPED frame " << fh );
+                      stream_stats::drop( fh.frame, RS2_FRAME_DROP_STAGE_SYNCER_INBOX );
+                  } )
     {
+        auto max_latency = std::make_shared< ptr_option< float > >(
+            0.f,
+            10000.f,
+            1.f,
+            0.f,
+            &_max_latency,
+            "Max time, in ms, to hold a frameset back waiting for a late stream; 0 = as long as its frame rate allows" );
+        register_option( RS2_OPTION_MAX_LATENCY, max_latency );
+
+        auto batch_window = std::make_shared< ptr_option< float > >(
+            0.f,
+            10.f,
+            0.1f,
+            0.f,
+            &_batch_window,
+            "Time, in ms, to let frames from other streams gather before matching them together; 0 = match on arrival" );
+        register_option( RS2_OPTION_SYNC_BATCH_WINDOW, batch_window );
+
         _matcher->set_callback( []( frame_holder f, syncronization_environment const & env ) {
             if( env.log )
             {
                 LOG_DEBUG( "<-- queueing " << f );
             }
 
+            if( frame_trace::enabled() )
+                frame_trace::instant( "syncer emit", frame_trace::frame_tag( f.frame ), time_service::get_time() );
+
             // We get here from within a dispatch() call, already protected by a mutex -- so only
             // one thread can enqueue!
             env.matches.enqueue( std::move( f ) );
@@ -54,14 +99,41 @@ namespace librealsense
                 return;
             }
             LOG_DEBUG( "--> syncing " << frame );
+            if( frame->is_blocking() )
             {
-                std::lock_guard<std::mutex> lock(_mutex);
-                if( ! _matcher->get_active() )
+                // The caller expects to be held up until the frame is taken care of (e.g., playback)
+                std::lock_guard< std::mutex > lock( _mutex );
+                dispatch_pending( source, log );
+                dispatch( std::move( frame ), source, log );
+            }
+            else
+            {
+                // Matching needs the heads of all the stream queues, so only one thread can do it at a time. Rather
+                // than wait for it, each thread leaves its frame in the inbox, and whoever holds the lock drains it.
+                auto const profile = frame->get_stream();
+                _inbox.enqueue( std::move( frame ) );
+                if( profile )
+                    profile->get_stats().drops.queue_depth( RS2_FRAME_DROP_STAGE_SYNCER_INBOX, _inbox.size(), INBOX_SIZE );
+                bool first = true;
+                while( true )
                 {
-                    LOG_DEBUG( "matcher was stopped: NOT DISPATCHING FRAME!" );
-                    return;
+                    std::unique_lock< std::mutex > lock( _mutex, std::try_to_lock );
+                    if( ! lock.owns_lock() )
+                        break;  // the owner will pick up our frame: it checks the inbox again after unlocking
+                    auto const batch_window = _batch_window;
+                    if( first && batch_window > 0 )
+                    {
+                        // Sensors of the same device tend to deliver within a short time of each other: let them
+                        // leave their frames, so the whole frameset is matched, and released, in one go
+                        std::this_thread::sleep_for( std::chrono::microseconds( int( batch_window * 1000 ) ) );
+                    }
+                    first = false;
+                    dispatch_pending( source, log );
+                    lock.unlock();
+                    if( _inbox.empty() )
+                        break;
+                    // Another thread queued a frame while we held the lock, and left it to us
                 }
-                _matcher->dispatch(std::move(frame), { source, _matches, log });
             }
 
             frame_holder f;
@@ -75,6 +147,7 @@ namespace librealsense
                 while (_matches.try_dequeue(&f))
                 {
                     LOG_DEBUG( "--> frame ready: " << *f.frame );
+                    record_sync_latency( f );
                     get_source().frame_ready(std::move(f));
                 }
             }
@@ -84,6 +157,45 @@ namespace librealsense
         set_processing_callback( make_frame_processor_callback( std::move( f ) ) );
     }
 
+    void syncer_process_unit::record_sync_latency( frame_holder const & f )
+    {
+        auto const now = time_service::get_time();
+        auto record = [now]( frame_interface const * child )
+        {
+            auto const & header = child->get_header();
+            auto const profile = child->get_stream();
+            if( header.publish_time > 0 && profile )
+                profile->get_stats().publish_to_sync.record( now - header.publish_time );
+        };
+        if( auto composite = dynamic_cast< composite_frame const * >( f.frame ) )
+        {
+            for( size_t i = 0; i < composite->get_embedded_frames_count(); ++i )
+                if( auto child = composite->get_frame( int( i ) ) )
+                    record( child );
+        }
+        else
+            record( f.frame );
+    }
+
+    // Requires _mutex
+    void syncer_process_unit::dispatch( frame_holder && frame, synthetic_source_interface * source, bool log )
+    {
+        if( ! _matcher->get_active() )
+        {
+            LOG_DEBUG( "matcher was stopped: NOT DISPATCHING FRAME!" );
+            return;
+        }
+        _matcher->dispatch( std::move( frame ), { source, _matches, log, _max_latency } );
+    }
+
+    // Requires _mutex
+    void syncer_process_unit::dispatch_pending( synthetic_source_interface * source, bool log )
+    {
+        frame_holder frame;
+        while( _inbox.try_dequeue( &frame ) )
+            dispatch( std::move( frame ), source, log );
+    }
+
     // Stopping the syncer means no more frames will be enqueued, and any existing frames
     // pending dispatch will be lost!
     void syncer_process_unit::stop()
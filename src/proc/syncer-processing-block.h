@@ -17,11 +17,16 @@
 namespace librealsense
 {
     class processing_block;
+    class synthetic_source_interface;
     class timestamp_composite_matcher;
     class syncer_process_unit : public processing_block
     {
     public:
-        syncer_process_unit(std::initializer_list< bool_option::ptr > enable_opts, bool log = true);
+        // With 'across_devices', the framesets of different devices are also matched with each other, by timestamp
+        // (which should then be global time), instead of each device's being released on its own
+        syncer_process_unit(std::initializer_list< bool_option::ptr > enable_opts,
+                            bool log = true,
+                            bool across_devices = false);
 
         syncer_process_unit( bool_option::ptr is_enabled_opt = nullptr, bool log = true)
             : syncer_process_unit( { is_enabled_opt }, log) {}
@@ -40,8 +45,18 @@ namespace librealsense
             _matcher.reset();
         }
     private:
+        void dispatch( frame_holder && frame, synthetic_source_interface * source, bool log );
+        void dispatch_pending( synthetic_source_interface * source, bool log );
+        static void record_sync_latency( frame_holder const & f );
+
         std::shared_ptr<matcher> _matcher;
         std::vector< std::weak_ptr<bool_option> > _enable_opts;
+        float _max_latency = 0.f;
+        float _batch_window = 0.f;  // ms
+
+        // Frames waiting for whichever thread is dispatching; room for a burst from every stream
+        static constexpr unsigned INBOX_SIZE = 8 * QUEUE_MAX_SIZE;
+        single_consumer_queue< frame_holder > _inbox;
 
         single_consumer_frame_queue<frame_holder> _matches;
         std::mutex _callback_mutex;
@@ -6,16 +6,24 @@
 #include "core/video.h"
 #include "core/motion-frame.h"
 #include "core/depth-frame.h"
+#include "core/disparity-frame.h"
 #include <src/composite-frame.h>
+#include <src/points.h>
 #include <src/core/frame-callback.h>
 #include <src/core/frame-processor-callback.h>
 #include "option.h"
 #include "stream.h"
 #include "types.h"
 #include <src/core/time-service.h>
+#include <src/latency-stats.h>
+#include <src/frame-trace.h>
 
 #include <rsutils/string/from.h>
 
+#include <algorithm>
+#include <sstream>
+#include <typeinfo>
+
 
 namespace librealsense
 {
@@ -36,13 +44,87 @@ namespace librealsense
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
         register_info(RS2_CAMERA_INFO_NAME, name);
         _source.init(std::shared_ptr<metadata_parser_map>());
+
+        auto stats_opt = std::make_shared< ptr_option< bool > >( false,
+                                                                 true,
+                                                                 true,
+                                                                 false,
+                                                                 &_collect_stats,
+                                                                 "Collect timing and frame counters" );
+        stats_opt->on_set( [this]( float val ) {
+            if( val )
+                _stats.reset();
+            _source_wrapper.set_stats( val ? &_stats : nullptr );
+        } );
+        register_option( RS2_OPTION_PROCESSING_STATS, stats_opt );
+        register_info( RS2_CAMERA_INFO_PROCESSING_STATS, std::string() );
+
+        auto async_opt = std::make_shared< ptr_option< bool > >( false,
+                                                                 true,
+                                                                 true,
+                                                                 false,
+                                                                 &_async,
+                                                                 "Process frames on the shared worker pool" );
+        // Frames already queued are done before invoke() goes back to processing them on the caller's thread
+        async_opt->on_set( [this]( float val ) {
+            if( ! val )
+                _async_queue.flush();
+        } );
+        register_option( RS2_OPTION_ASYNC_PROCESSING, async_opt );
+    }
+
+    const std::string & processing_block::get_info( rs2_camera_info info ) const
+    {
+        if( info != RS2_CAMERA_INFO_PROCESSING_STATS )
+            return info_container::get_info( info );
+        std::lock_guard< std::mutex > lock( _stats_text_mutex );
+        _stats_text = _stats.to_string();
+        return _stats_text;
+    }
+
+    std::string processing_block_stats::to_string() const
+    {
+        auto const d = durations.get_stats();
+        return rsutils::string::from() << "invocations: " << d.count << ", avg: " << d.mean_ms
+                                       << " ms, p99: " << d.p99_ms << " ms, max: " << d.max_ms
+                                       << " ms, allocations: " << allocations.load() << ", dropped: " << dropped.load();
     }
 
     void processing_block::invoke(frame_holder f)
+    {
+        if( ! _async )
+        {
+            process( std::move( f ) );
+            return;
+        }
+
+        // Each block has a queue of its own: its frames are processed in order, while other blocks run in parallel
+        if( _async_queue.size() >= MAX_ASYNC_BACKLOG )
+        {
+            LOG_DEBUG( "Dropping frame: " << get_info( RS2_CAMERA_INFO_NAME ) << " is falling behind" );
+            if( _collect_stats )
+                ++_stats.dropped;
+            return;
+        }
+        // std::function needs a copyable target, and frame_holder only moves
+        auto holder = std::make_shared< frame_holder >( std::move( f ) );
+        _async_queue.post( [this, holder]() { process( std::move( *holder ) ); } );
+    }
+
+    void processing_block::stop()
+    {
+        _async = false;
+        _async_queue.flush();
+    }
+
+    void processing_block::process( frame_holder f )
     {
         frame_source::archive_id id
             = { f->get_stream()->get_stream_type(), f->get_stream()->get_stream_index(), RS2_EXTENSION_VIDEO_FRAME };
         auto callback = _source.begin_callback( id );
+        bool const collect_stats = _collect_stats;
+        auto const start = collect_stats ? time_service::get_time() : 0;
+        frame_trace::scope trace( get_info( RS2_CAMERA_INFO_NAME ).c_str(), f.frame );
         try
         {
             if (_callback)
@@ -56,11 +138,26 @@ namespace librealsense
         catch (std::exception const & e)
         {
             LOG_ERROR( "Exception was thrown during callback: " << e.what() );
+            if( collect_stats )
+                ++_stats.dropped;
         }
         catch (...)
         {
             LOG_ERROR( "Exception was thrown during callback!" );
+            if( collect_stats )
+                ++_stats.dropped;
         }
+        if( collect_stats )
+            _stats.durations.record( time_service::get_time() - start );
+    }
+
+    frame_interface * synthetic_source::counted( frame_interface * allocated )
+    {
+        // A failed allocation throws or returns nothing, and is counted as a drop by whoever sees that
+        if( allocated )
+            if( auto stats = _stats.load( std::memory_order_relaxed ) )
+                ++stats->allocations;
+        return allocated;
     }
 
     generic_processing_block::generic_processing_block(const char* name)
@@ -70,6 +167,9 @@ namespace librealsense
         {
             std::lock_guard<std::mutex> lock(_mutex);
 
+            // Before any copy of our own is made
+            _sole_input = f && ! ( (frame_interface *)f.get() )->is_shared() ? f.get() : nullptr;
+
             std::vector<rs2::frame> frames_to_process;
 
             frames_to_process.push_back(f);
@@ -82,7 +182,9 @@ namespace librealsense
             {
                 if (should_process(f))
                 {
+                    auto const start = time_service::get_time();
                     auto res = process_frame(source, f);
+                    f.get_profile().get()->profile->get_stats().processing.record(time_service::get_time() - start);
                     if (!res) continue;
                     if (auto composite = res.as<rs2::frameset>())
                     {
@@ -100,6 +202,8 @@ namespace librealsense
                 }
             }
 
+            _sole_input = nullptr;
+
             auto out = prepare_output(source, f, results);
             if(out)
                 source.frame_ready(out);
@@ -109,6 +213,119 @@ namespace librealsense
         processing_block::set_processing_callback(std::shared_ptr<rs2_frame_processor_callback>(callback));
     }
 
+    void generic_processing_block::register_in_place_option()
+    {
+        register_option( RS2_OPTION_IN_PLACE_PROCESSING,
+                         std::make_shared< ptr_option< bool > >( false,
+                                                                 true,
+                                                                 true,
+                                                                 false,
+                                                                 &_in_place,
+                                                                 "Write the output into the input frame when possible" ) );
+    }
+
+    rs2::frame generic_processing_block::reuse_input( const rs2::frame & f, const rs2::stream_profile & profile )
+    {
+        // A frameset holds a reference to each of its frames, so these are never the sole input
+        if( ! _in_place || ! f || f.get() != _sole_input )
+            return {};
+
+        // Frames that also live on a GPU would go out of sync with their copy there
+        auto fi = (frame_interface *)f.get();
+        auto & type = typeid( *fi );
+        if( type != typeid( video_frame ) && type != typeid( depth_frame ) && type != typeid( disparity_frame ) )
+            return {};
+        // Nor can frames that share their data with another
+        if( static_cast< frame * >( fi )->is_data_view() )
+            return {};
+
+        fi->set_stream(
+            std::dynamic_pointer_cast< stream_profile_interface >( profile.get()->profile->shared_from_this() ) );
+        return f;
+    }
+
+    void generic_processing_block::register_share_results_option()
+    {
+        register_option( RS2_OPTION_SHARE_RESULTS,
+                         std::make_shared< ptr_option< bool > >( false,
+                                                                 true,
+                                                                 true,
+                                                                 false,
+                                                                 &_share_results,
+                                                                 "Reuse the output of equivalent blocks" ) );
+    }
+
+    void generic_processing_block::register_processing_threads_option()
+    {
+        auto const max_threads = std::max( 1u, std::min( 255u, std::thread::hardware_concurrency() ) );
+        register_option( RS2_OPTION_PROCESSING_THREADS,
+                         std::make_shared< ptr_option< uint8_t > >( uint8_t( 1 ),
+                                                                    uint8_t( max_threads ),
+                                                                    uint8_t( 1 ),
+                                                                    uint8_t( 1 ),
+                                                                    &_threads,
+                                                                    "Number of threads to split each frame between" ) );
+    }
+
+    std::shared_ptr< worker_pool > generic_processing_block::get_workers()
+    {
+        if( _threads <= 1 )
+            return nullptr;
+        if( ! _workers )
+            _workers = worker_pool::shared();
+        return _workers;
+    }
+
+    void generic_processing_block::for_each_range( size_t count, std::function< void( size_t, size_t ) > const & fn )
+    {
+        auto const workers = get_workers();
+        worker_pool::for_each_range( workers.get(), _threads, count, fn );
+    }
+
+    std::string generic_processing_block::shared_result_key( size_t state ) const
+    {
+        // Options that only change how, or how fast, the output is produced are left out of the key
+        std::ostringstream key;
+        key << typeid( *this ).name() << '/' << state;
+        for( auto id : get_supported_options() )
+        {
+            switch( id )
+            {
+            case RS2_OPTION_SHARE_RESULTS:
+            case RS2_OPTION_PROCESSING_THREADS:
+            case RS2_OPTION_PROCESSING_STATS:
+            case RS2_OPTION_ASYNC_PROCESSING:
+            case RS2_OPTION_IN_PLACE_PROCESSING:
+            case RS2_OPTION_FRAMES_QUEUE_SIZE:
+                continue;
+            default:
+                key << '/' << int( id ) << '=' << get_option( id ).query();
+            }
+        }
+        return key.str();
+    }
+
+    rs2::frame generic_processing_block::find_shared_result( const rs2::frame & input, size_t state ) const
+    {
+        auto f = input ? dynamic_cast< frame * >( (frame_interface *)input.get() ) : nullptr;
+        if( ! _share_results || ! f )
+            return {};
+        auto result = f->find_result( shared_result_key( state ) );
+        if( ! result )
+            return {};
+        frame_interface * ptr = nullptr;
+        std::swap( result.frame, ptr );
+        return rs2::frame( (rs2_frame *)ptr );
+    }
+
+    void generic_processing_block::share_result( const rs2::frame & input, size_t state, const rs2::frame & output ) const
+    {
+        auto f = input ? dynamic_cast< frame * >( (frame_interface *)input.get() ) : nullptr;
+        if( ! _share_results || ! f || ! output )
+            return;
+        f->keep_result( shared_result_key( state ), frame_holder::acquire( (frame_interface *)output.get() ) );
+    }
+
     rs2::frame generic_processing_block::prepare_output(const rs2::frame_source& source, rs2::frame input, std::vector<rs2::frame> results)
     {
         // this function prepares the processing block output frame(s) by the following heuristic:
@@ -249,6 +466,19 @@ namespace librealsense
 
     rs2::frame functional_processing_block::process_frame(const rs2::frame_source & source, const rs2::frame & f)
     {
+        size_t offset = 0;
+        auto in = f.as<rs2::video_frame>();
+        if (in && output_in_source(in.get_width(), in.get_height(), offset))
+        {
+            init_profiles_info(&f);
+            auto stream = std::dynamic_pointer_cast<stream_profile_interface>(
+                _target_stream_profile.get()->profile->shared_from_this());
+            int const width = in.get_width();
+            if (auto view = _source_wrapper.allocate_video_frame_view(stream, (frame_interface *)f.get(), offset,
+                    _target_bpp, width, in.get_height(), width * _target_bpp, _extension_type))
+                return rs2::frame((rs2_frame *)view);
+        }
+
         auto&& ret = prepare_frame(source, f);
         int width = 0;
         int height = 0;
@@ -354,12 +584,16 @@ namespace librealsense
             data.system_time = time_service::get_time();
             data.is_blocking = original->is_blocking();
 
-            auto res = _actual_source.alloc_frame(
+            // XYZ + UV for every point, as floats or (compact) as int16
+            auto const point_size = vid_stream->get_format() == RS2_FORMAT_XYZ16 ? sizeof( int16_t ) * 5 : sizeof( float ) * 5;
+            auto res = counted( _actual_source.alloc_frame(
                 { vid_stream->get_stream_type(), vid_stream->get_stream_index(), frame_type },
-                vid_stream->get_width() * vid_stream->get_height() * sizeof( float ) * 5,
+                vid_stream->get_width() * vid_stream->get_height() * point_size,
                 std::move( data ),
-                true );
+                true ) );
             if (!res) throw wrong_api_call_sequence_exception("Out of frame resources!");
+            if( auto pts = dynamic_cast< points * >( res ) )
+                pts->reset_valid_only();  // the frame may have been recycled from one that wasn't
             res->set_sensor(original->get_sensor());
             res->set_stream(stream);
             return res;
@@ -375,6 +609,30 @@ namespace librealsense
         int new_height,
         int new_stride,
         rs2_extension frame_type)
+    {
+        return allocate_video(stream, original, new_bpp, new_width, new_height, new_stride, frame_type, nullptr);
+    }
+
+    frame_interface* synthetic_source::allocate_video_frame_view(std::shared_ptr<stream_profile_interface> stream,
+        frame_interface* original,
+        size_t offset,
+        int new_bpp,
+        int new_width,
+        int new_height,
+        int new_stride,
+        rs2_extension frame_type)
+    {
+        return allocate_video(stream, original, new_bpp, new_width, new_height, new_stride, frame_type, &offset);
+    }
+
+    frame_interface* synthetic_source::allocate_video(std::shared_ptr<stream_profile_interface> const & stream,
+        frame_interface* original,
+        int new_bpp,
+        int new_width,
+        int new_height,
+        int new_stride,
+        rs2_extension frame_type,
+        size_t const * view_offset)
     {
         video_frame* vf = nullptr;
 
@@ -421,16 +679,23 @@ namespace librealsense
         if (!of)
             throw std::runtime_error("Can not cast frame interface to frame");
 
+        size_t const size = size_t(stride) * height;
+        if (view_offset && *view_offset + size > size_t(original->get_frame_data_size()))
+            return nullptr;
+
         frame_additional_data data = of->additional_data;
-        auto res = _actual_source.alloc_frame( { stream->get_stream_type(), stream->get_stream_index(), frame_type },
-                                               stride * height,
+        auto res = counted( _actual_source.alloc_frame( { stream->get_stream_type(), stream->get_stream_index(), frame_type },
+                                               view_offset ? 0 : size,
                                                std::move( data ),
-                                               true );
+                                               ! view_offset ) );
         if (!res) throw wrong_api_call_sequence_exception("Out of frame resources!");
         vf = dynamic_cast<video_frame*>(res);
         if (!vf)
             throw std::runtime_error("Frame is not video frame");
 
+        if (view_offset)
+            vf->set_data_view(original, *view_offset, size);
+
         vf->metadata_parsers = of->metadata_parsers;
         vf->assign(width, height, stride, bpp);
         vf->set_sensor(original->get_sensor());
@@ -457,10 +722,10 @@ namespace librealsense
             throw std::runtime_error("Frame interface is not frame");
 
         frame_additional_data data = of->additional_data;
-        auto res = _actual_source.alloc_frame( { stream->get_stream_type(), stream->get_stream_index(), frame_type },
+        auto res = counted( _actual_source.alloc_frame( { stream->get_stream_type(), stream->get_stream_index(), frame_type },
                                                of->get_frame_data_size(),
                                                std::move( data ),
-                                               true );
+                                               true ) );
         if (!res) throw wrong_api_call_sequence_exception("Out of frame resources!");
 
         auto mf = dynamic_cast<motion_frame*>(res);
@@ -503,30 +768,41 @@ namespace librealsense
     }
 
     frame_interface* synthetic_source::allocate_composite_frame(std::vector<frame_holder> holders)
+    {
+        return allocate_composite_frame(holders.data(), holders.size());
+    }
+
+    frame_interface* synthetic_source::allocate_composite_frame(frame_holder* holders, size_t count)
     {
         frame_additional_data d{};
 
+        auto const end = holders + count;
         auto req_size = 0;
-        for (auto&& f : holders)
-            req_size += get_embeded_frames_size(f.frame);
+        for (auto f = holders; f != end; ++f)
+            req_size += get_embeded_frames_size(f->frame);
 
-        auto res = _actual_source.alloc_frame( { RS2_STREAM_ANY, 0, RS2_EXTENSION_COMPOSITE_FRAME }, // Special case for composite frames
+        auto res = counted( _actual_source.alloc_frame( { RS2_STREAM_ANY, 0, RS2_EXTENSION_COMPOSITE_FRAME }, // Special case for composite frames
                                                req_size * sizeof( rs2_frame * ),
                                                std::move( d ),
-                                               true );
-        if (!res) return nullptr;
+                                               true ) );
+        if (!res)
+        {
+            if( auto stats = _stats.load( std::memory_order_relaxed ) )
+                ++stats->dropped;
+            return nullptr;
+        }
 
         auto cf = static_cast<composite_frame*>(res);
 
-        for (auto&& f : holders)
+        for (auto f = holders; f != end; ++f)
         {
-            if (f->is_blocking())
+            if ((*f)->is_blocking())
                 res->set_blocking(true);
         }
 
         auto frames = cf->get_frames();
-        for (auto&& f : holders)
-            copy_frames(std::move(f), frames);
+        for (auto f = holders; f != end; ++f)
+            copy_frames(std::move(*f), frames);
         frames -= req_size;
 
         auto releaser = [frames, req_size]()
@@ -599,6 +875,13 @@ namespace librealsense
         _processing_blocks.back()->set_output_callback(callback);
     }
 
+    void composite_processing_block::stop()
+    {
+        for( auto & block : _processing_blocks )
+            block->stop();
+        processing_block::stop();
+    }
+
     void composite_processing_block::invoke(frame_holder frames)
     {
         // Invoke the first processing block.
@@ -644,8 +927,9 @@ namespace librealsense
 
             auto w = profile->get_width();
             auto h = profile->get_height();
+            auto const decimation = _decimation;
 
-            if (profile.get() != _source_stream_profile.get())
+            if (profile.get() != _source_stream_profile.get() || decimation != _active_decimation)
             {
                 _source_stream_profile = profile;
                 _right_target_stream_profile = profile->clone();
@@ -662,6 +946,31 @@ namespace librealsense
                 _left_target_stream_profile->set_unique_id(_left_target_profile_idx);
                 _right_target_stream_profile->set_stream_index(_right_target_profile_idx);
                 _right_target_stream_profile->set_unique_id(_right_target_profile_idx);
+
+                _active_decimation = decimation;
+                if (decimation > 1)
+                {
+                    for (auto & target : { _left_target_stream_profile, _right_target_stream_profile })
+                    {
+                        auto vsp = As<video_stream_profile_interface>(target);
+                        if (!vsp)
+                            continue;
+                        int const tw = decimated_size(w, decimation);
+                        int const th = decimated_size(h, decimation);
+                        vsp->set_dims(tw, th);
+                        vsp->set_intrinsics([profile, decimation, tw, th]()
+                        {
+                            auto intrin = profile->get_intrinsics();
+                            intrin.width = tw;
+                            intrin.height = th;
+                            intrin.fx /= decimation;
+                            intrin.fy /= decimation;
+                            intrin.ppx /= decimation;
+                            intrin.ppy /= decimation;
+                            return intrin;
+                        });
+                    }
+                }
             }
 
             // passthrough the frame if we don't need to process it.
@@ -674,15 +983,34 @@ namespace librealsense
 
             frame_holder lf, rf;
 
-            lf = source->allocate_video_frame(_left_target_stream_profile, frame, _left_target_bpp,
-                w, h, w * _left_target_bpp, _left_extension_type);
-            rf = source->allocate_video_frame(_right_target_stream_profile, frame, _right_target_bpp,
-                w, h, w * _right_target_bpp, _right_extension_type);
+            int const tw = decimated_size(w, _active_decimation);
+            int const th = decimated_size(h, _active_decimation);
+            // Outputs that are a part of the source as is reference it rather than get a copy
+            bool views[2] = { false, false };
+            size_t offset = 0;
+            if (_active_decimation == 1 && output_in_source(0, w, h, offset))
+            {
+                lf = source->allocate_video_frame_view(_left_target_stream_profile, frame, offset, _left_target_bpp,
+                    tw, th, tw * _left_target_bpp, _left_extension_type);
+                views[0] = lf;
+            }
+            if (_active_decimation == 1 && output_in_source(1, w, h, offset))
+            {
+                rf = source->allocate_video_frame_view(_right_target_stream_profile, frame, offset, _right_target_bpp,
+                    tw, th, tw * _right_target_bpp, _right_extension_type);
+                views[1] = rf;
+            }
+            if (!views[0])
+                lf = source->allocate_video_frame(_left_target_stream_profile, frame, _left_target_bpp,
+                    tw, th, tw * _left_target_bpp, _left_extension_type);
+            if (!views[1])
+                rf = source->allocate_video_frame(_right_target_stream_profile, frame, _right_target_bpp,
+                    tw, th, tw * _right_target_bpp, _right_extension_type);
 
             // process the frame
             uint8_t * planes[2];
-            planes[0] = (uint8_t *)lf.frame->get_frame_data();
-            planes[1] = (uint8_t *)rf.frame->get_frame_data();
+            planes[0] = views[0] ? nullptr : (uint8_t *)lf.frame->get_frame_data();
+            planes[1] = views[1] ? nullptr : (uint8_t *)rf.frame->get_frame_data();
 
             process_function(planes, (const uint8_t *)frame->get_frame_data(), w, h, 0, 0);
 
@@ -692,4 +1020,19 @@ namespace librealsense
 
         set_processing_callback( make_frame_processor_callback( std::move( process_callback ) ) );
     }
+
+    /*static*/ int interleaved_functional_processing_block::decimated_size(int size, int factor)
+    {
+        if (factor <= 1)
+            return size;
+        return (size / factor + 3) / 4 * 4;
+    }
+
+    void interleaved_functional_processing_block::register_decimation_option()
+    {
+        // Same range as the decimation filter's
+        register_option(RS2_OPTION_FILTER_MAGNITUDE,
+            std::make_shared<ptr_option<uint8_t>>(uint8_t(1), uint8_t(8), uint8_t(1), uint8_t(1), &_decimation,
+                "Decimation scale applied while deinterleaving (1 for none)"));
+    }
 }
@@ -9,6 +9,8 @@
 
 #include <src/core/info.h>
 #include <src/core/options-container.h>
+#include <src/latency-stats.h>
+#include "worker-pool.h"
 
 #include <librealsense2/hpp/rs_frame.hpp>
 #include <librealsense2/hpp/rs_processing.hpp>
@@ -17,6 +19,23 @@ namespace librealsense
 {
 
 
+    // Counters a processing block collects while RS2_OPTION_PROCESSING_STATS is on
+    struct processing_block_stats
+    {
+        latency_histogram durations;            // of each invoke(), including outputs it delivers synchronously
+        std::atomic< uint64_t > allocations{ 0 };  // output frames allocated
+        std::atomic< uint64_t > dropped{ 0 };      // frames lost to a failed allocation or a throwing callback
+
+        void reset()
+        {
+            durations.reset();
+            allocations = 0;
+            dropped = 0;
+        }
+        std::string to_string() const;
+    };
+
+
     // A synthetic source is simply a wrapper around a new frame_source and its exposure thru the rs2_source APIs
     //
     class synthetic_source : public synthetic_source_interface
@@ -24,6 +43,9 @@ namespace librealsense
     public:
         synthetic_source( frame_source & actual );
 
+        // Count allocations into 'stats'; nullptr to stop counting
+        void set_stats( processing_block_stats * stats ) { _stats = stats; }
+
         frame_interface* allocate_video_frame(std::shared_ptr<stream_profile_interface> stream,
             frame_interface* original,
             int new_bpp = 0,
@@ -32,11 +54,21 @@ namespace librealsense
             int new_stride = 0,
             rs2_extension frame_type = RS2_EXTENSION_VIDEO_FRAME) override;
 
+        frame_interface* allocate_video_frame_view(std::shared_ptr<stream_profile_interface> stream,
+            frame_interface* original,
+            size_t offset,
+            int new_bpp,
+            int new_width,
+            int new_height,
+            int new_stride,
+            rs2_extension frame_type = RS2_EXTENSION_VIDEO_FRAME) override;
+
         frame_interface* allocate_motion_frame(std::shared_ptr<stream_profile_interface> stream,
             frame_interface* original,
             rs2_extension frame_type = RS2_EXTENSION_MOTION_FRAME) override;
 
         frame_interface* allocate_composite_frame(std::vector<frame_holder> frames) override;
+        frame_interface* allocate_composite_frame(frame_holder* frames, size_t count) override;
 
         frame_interface* allocate_points(std::shared_ptr<stream_profile_interface> stream, 
             frame_interface* original, rs2_extension frame_type = RS2_EXTENSION_POINTS) override;
@@ -46,8 +78,20 @@ namespace librealsense
         rs2_source* get_rs2_source() const { return _c_wrapper.get(); }
 
     private:
+        frame_interface * counted( frame_interface * allocated );
+        // With a view_offset, the frame is a view of the original's data (see allocate_video_frame_view)
+        frame_interface * allocate_video( std::shared_ptr< stream_profile_interface > const & stream,
+                                          frame_interface * original,
+                                          int new_bpp,
+                                          int new_width,
+                                          int new_height,
+                                          int new_stride,
+                                          rs2_extension frame_type,
+                                          size_t const * view_offset );
+
         frame_source & _actual_source;
         std::shared_ptr<rs2_source> _c_wrapper;
+        std::atomic< processing_block_stats * > _stats{ nullptr };
     };
 
     class LRS_EXTENSION_API processing_block : public processing_block_interface, public options_container, public info_container
@@ -59,13 +103,31 @@ namespace librealsense
         void set_output_callback( rs2_frame_callback_sptr callback) override;
         void invoke(frame_holder frames) override;
         synthetic_source_interface& get_source() override { return _source_wrapper; }
+        void stop() override;
+
+        // RS2_CAMERA_INFO_PROCESSING_STATS is generated on each query; the rest are as registered
+        const std::string & get_info( rs2_camera_info info ) const override;
 
+        // Nothing is left in _async_queue by now: the block was stopped by its owner
         virtual ~processing_block() { _source.flush(); }
     protected:
         frame_source _source;
         std::mutex _mutex;
         rs2_frame_processor_callback_sptr _callback;
         synthetic_source _source_wrapper;
+
+    private:
+        // Frames still waiting in _async_queue past this are dropped, the way a full frame_queue would
+        static const size_t MAX_ASYNC_BACKLOG = 16;
+
+        void process( frame_holder frames );
+
+        bool _async = false;
+        serial_queue _async_queue;  // frames invoked while _async is on
+        bool _collect_stats = false;
+        processing_block_stats _stats;
+        mutable std::mutex _stats_text_mutex;
+        mutable std::string _stats_text;  // holds the last returned RS2_CAMERA_INFO_PROCESSING_STATS
     };
 
     class LRS_EXTENSION_API generic_processing_block : public processing_block
@@ -79,6 +141,47 @@ namespace librealsense
 
         virtual bool should_process(const rs2::frame& frame) = 0;
         virtual rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) = 0;
+
+        // Registers RS2_OPTION_IN_PLACE_PROCESSING, for blocks whose output has the same size as their input
+        void register_in_place_option();
+
+        // 'f', re-tagged with 'profile', if the output may be written into it: in-place processing is on, 'f' is not
+        // part of a frameset and is the frame the block was invoked with, nothing else references it, and its data is
+        // in plain CPU memory. Otherwise an empty frame, and the output needs a frame of its own.
+        rs2::frame reuse_input(const rs2::frame& f, const rs2::stream_profile& profile);
+
+        // Registers RS2_OPTION_SHARE_RESULTS, for blocks whose output is determined by their input frame, their options
+        // and the 'state' they pass below
+        void register_share_results_option();
+
+        // With RS2_OPTION_SHARE_RESULTS on, the output that a block of the same type, with the same option values and
+        // state, computed from 'input' and shared; otherwise an empty frame
+        rs2::frame find_shared_result(const rs2::frame& input, size_t state) const;
+
+        // Makes 'output' available to equivalent blocks for as long as 'input' lives, if RS2_OPTION_SHARE_RESULTS is on.
+        // 'output' must not reference 'input' (see frame::keep_result).
+        void share_result(const rs2::frame& input, size_t state, const rs2::frame& output) const;
+
+        // Registers RS2_OPTION_PROCESSING_THREADS, for blocks that can split a frame between threads; the output is
+        // identical either way
+        void register_processing_threads_option();
+
+        // The pool to split the frame on, or null with a single thread. Acquired here rather than when the option is
+        // set, so only the processing thread touches it.
+        std::shared_ptr<worker_pool> get_workers();
+
+        // Call fn over [0, count), split between _threads threads
+        void for_each_range(size_t count, std::function<void(size_t, size_t)> const & fn);
+
+        uint8_t _threads = 1;  // RS2_OPTION_PROCESSING_THREADS
+
+    private:
+        std::string shared_result_key(size_t state) const;
+
+        bool _share_results = false;
+        bool _in_place = false;
+        rs2_frame* _sole_input = nullptr;  // the frame being processed, if no one else references it
+        std::shared_ptr<worker_pool> _workers;  // Acquired on first use, when _threads > 1
     };
 
     struct stream_filter
@@ -154,6 +257,9 @@ namespace librealsense
         rs2::frame process_frame(const rs2::frame_source & source, const rs2::frame & f) override;
         virtual rs2::frame prepare_frame(const rs2::frame_source& source, const rs2::frame& f);
         virtual void process_function(uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) = 0;
+        // When the output of a width x height source is a contiguous part of it as is, returns its offset in the source:
+        // the output is then a view of the source (see frame::set_data_view), and process_function is not called
+        virtual bool output_in_source(int width, int height, size_t & offset) const { return false; }
 
         rs2::stream_profile _target_stream_profile;
         rs2::stream_profile _source_stream_profile;
@@ -178,10 +284,26 @@ namespace librealsense
             rs2_extension right_extension_type,
             int right_idx);
 
+        // Size of a side of the output when it is decimated by 'factor': whole blocks, padded to a multiple of 4 like the
+        // decimation filter's output
+        static int decimated_size(int size, int factor);
+
     protected:
+        // When decimation is on, width and height are still those of the source; the outputs are
+        // decimated_size(width, _active_decimation) x decimated_size(height, _active_decimation)
         virtual void process_function(uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) = 0;
+        // Same as functional_processing_block's, for 'output' 0 (left) or 1 (right); process_function then gets a null
+        // plane for it. Not used while decimating.
+        virtual bool output_in_source(int output, int width, int height, size_t & offset) const { return false; }
         void configure_processing_callback();
 
+        // Adds RS2_OPTION_FILTER_MAGNITUDE, for blocks whose process_function can decimate as it deinterleaves: the
+        // outputs are then what the decimation filter would make of them, without a separate pass over both frames
+        void register_decimation_option();
+
+        uint8_t _decimation = 1;         // as set by the user
+        uint8_t _active_decimation = 1;  // what the current target profiles (and process_function) use
+
         std::shared_ptr<stream_profile_interface> _source_stream_profile;
         std::shared_ptr<stream_profile_interface> _left_target_stream_profile;
         std::shared_ptr<stream_profile_interface> _right_target_stream_profile;
@@ -237,6 +359,7 @@ namespace librealsense
             option_range get_range() const override { return get().get_range(); }
             bool is_enabled() const override { return get().is_enabled(); }
             bool is_read_only() const override { return get().is_read_only(); }
+            bool can_set_while_streaming() const override { return get().can_set_while_streaming(); }
             const char* get_description() const override { return get().get_description(); }
             const char* get_value_description(float v) const override { return get().get_value_description(v); }
             void enable_recording(std::function<void(const option &)> record_action) override {}
@@ -250,12 +373,14 @@ namespace librealsense
 
         composite_processing_block();
         composite_processing_block(const char* name);
-        virtual ~composite_processing_block() { _source.flush(); };
+        // The blocks are ours: they are stopped while they are still whole
+        virtual ~composite_processing_block() { stop(); _source.flush(); };
 
         processing_block& get(rs2_option option);
         void add(std::shared_ptr<processing_block> block);
         void set_output_callback(rs2_frame_callback_sptr callback) override;
         void invoke(frame_holder frames) override;
+        void stop() override;
 
     protected:
         std::vector<std::shared_ptr<processing_block>> _processing_blocks;
@@ -278,6 +403,13 @@ struct rs2_processing_block : public rs2_options
         : rs2_options((librealsense::options_interface*)block.get()),
         block(block) { }
 
+    // The last to let go of the block stops it (see processing_block_interface::stop)
+    ~rs2_processing_block()
+    {
+        if( block && block.use_count() == 1 )
+            block->stop();
+    }
+
     std::shared_ptr<librealsense::processing_block_interface> block;
 
     rs2_processing_block& operator=(const rs2_processing_block&) = delete;
@@ -11,6 +11,14 @@
 
 #include <rsutils/string/from.h>
 
+#ifdef RS2_USE_CUDA
+#include "cuda/cuda-frame.h"
+#endif
+
+#ifdef __SSSE3__
+#include <tmmintrin.h> // For SSSE3 intrinsics
+#endif
+
 
 namespace librealsense
 {
@@ -113,33 +121,163 @@ namespace librealsense
         register_option(RS2_OPTION_FILTER_SMOOTH_ALPHA, temporal_filter_alpha);
         register_option(RS2_OPTION_FILTER_SMOOTH_DELTA, temporal_filter_delta);
 
+        register_processing_threads_option();
+
+        _roi.register_options(*this);
+
         on_set_persistence_control(_persistence_param);
         on_set_delta(_delta_param);
         on_set_alpha(_alpha_param);
+
+#ifdef RS2_USE_CUDA
+        // Filtered depth frames stay on the device, for the next CUDA block to use without a copy
+        _source.add_extension<cuda_depth_frame>(RS2_EXTENSION_DEPTH_FRAME_CUDA);
+#endif
     }
 
     rs2::frame temporal_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
         update_configuration(f);
+
+#ifdef RS2_USE_CUDA
+        if (_extension_type == RS2_EXTENSION_DEPTH_FRAME)
+        {
+            // Neither the input, when it comes from another CUDA block, nor the result go through the host
+            rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, (int)_bpp, (int)_width, (int)_height,
+                (int)_stride, RS2_EXTENSION_DEPTH_FRAME_CUDA);
+            auto d_output = static_cast<uint16_t*>(get_device_output(tgt, _current_frm_size_pixels * _bpp));
+            if (d_output)
+            {
+                auto d_input = static_cast<const uint16_t*>(get_device_data(f));
+                auto input = d_input ? nullptr : static_cast<const uint16_t*>(f.get_data());
+                _cuda_helper.smooth_depth_to_device(input, d_input, d_output, int(_current_frm_size_pixels),
+                    _alpha_param, _delta_param, _persistence_map.data(), _cur_frame_index);
+                _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
+                return tgt;
+            }
+        }
+#endif
         auto tgt = prepare_target_frame(f, source);
 
         // Temporal filter execution
-        if (_extension_type == RS2_EXTENSION_DISPARITY_FRAME)
+#ifdef RS2_USE_CUDA
+        if (_bpp == sizeof(float))
+            _cuda_helper.smooth_disparity(static_cast<float*>(const_cast<void*>(tgt.get_data())), int(_current_frm_size_pixels),
+                _alpha_param, _delta_param, _persistence_map.data(), _cur_frame_index);
+        else
+            _cuda_helper.smooth_depth(static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())), int(_current_frm_size_pixels),
+                _alpha_param, _delta_param, _persistence_map.data(), _cur_frame_index);
+        _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
+#else
+        if (_bpp == sizeof(float))
             temp_jw_smooth<float>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data());
         else
             temp_jw_smooth<uint16_t>(const_cast<void*>(tgt.get_data()), _last_frame.data(), _history.data());
+#endif
 
         return tgt;
     }
 
 
+#ifdef __SSSE3__
+    size_t temporal_filter::temp_jw_smooth_sse(uint16_t* frame, uint16_t* last_frame, uint8_t* history, size_t count)
+    {
+        if (!_delta_param)
+            return 0;
+
+        const uint8_t mask = uint8_t(1 << _cur_frame_index);
+
+        // For this phase, whether each of the 256 histories is credible, one bit each: the bit for history h is
+        // bit (h & 7) of byte (h >> 3). The bytes are looked up 16 at a time with a shuffle.
+        alignas(16) uint8_t credible[32] = {};
+        for (size_t h = 0; h < PRESISTENCY_LUT_SIZE; h++)
+            if (_persistence_map[h] & mask)
+                credible[h >> 3] |= uint8_t(1 << (h & 7));
+        const __m128i credible_lo = _mm_load_si128(reinterpret_cast<const __m128i*>(credible));
+        const __m128i credible_hi = _mm_load_si128(reinterpret_cast<const __m128i*>(credible + 16));
+        const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i all_ones = _mm_cmpeq_epi8(zero, zero);
+        const __m128i mask8 = _mm_set1_epi8(char(mask));
+        const __m128i bit4 = _mm_set1_epi8(16);
+        const __m128i low3 = _mm_set1_epi8(7);
+        const __m128i low5 = _mm_set1_epi8(31);
+        const __m128i sign16 = _mm_set1_epi16(short(0x8000));
+        // |cur - prev| < delta, i.e. |cur - prev| saturated-minus (delta - 1) is zero; delta is at least 1
+        const __m128i delta_minus_1 = _mm_set1_epi16(short(_delta_param - 1));
+        const __m128 alpha = _mm_set1_ps(_alpha_param);
+        const __m128 one_minus_alpha = _mm_set1_ps(_one_minus_alpha);
+
+        auto select = [](__m128i m, __m128i a, __m128i b) { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); };
+        // Same as static_cast<uint16_t>(_alpha_param * cur + _one_minus_alpha * prev), for 8 pixels
+        auto filter = [&](__m128i cur, __m128i prev)
+        {
+            __m128i r[2];
+            for (int half = 0; half < 2; half++)
+            {
+                __m128i c = half ? _mm_unpackhi_epi16(cur, zero) : _mm_unpacklo_epi16(cur, zero);
+                __m128i p = half ? _mm_unpackhi_epi16(prev, zero) : _mm_unpacklo_epi16(prev, zero);
+                __m128 f = _mm_add_ps(_mm_mul_ps(alpha, _mm_cvtepi32_ps(c)), _mm_mul_ps(one_minus_alpha, _mm_cvtepi32_ps(p)));
+                // Results are in [0, 65535]; bias them so the signed pack doesn't saturate
+                r[half] = _mm_sub_epi32(_mm_cvttps_epi32(f), _mm_set1_epi32(0x8000));
+            }
+            return _mm_xor_si128(_mm_packs_epi32(r[0], r[1]), sign16);
+        };
+
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i hist = _mm_loadu_si128(reinterpret_cast<const __m128i*>(history + i));
+            __m128i idx = _mm_and_si128(_mm_srli_epi16(hist, 3), low5);
+            __m128i table = select(_mm_cmpeq_epi8(_mm_and_si128(idx, bit4), bit4),
+                                   _mm_shuffle_epi8(credible_hi, idx),
+                                   _mm_shuffle_epi8(credible_lo, idx));
+            __m128i is_credible = _mm_andnot_si128(
+                _mm_cmpeq_epi8(_mm_and_si128(table, _mm_shuffle_epi8(bits, _mm_and_si128(hist, low3))), zero), all_ones);
+
+            __m128i agree16[2], cur_valid16[2];
+            for (int half = 0; half < 2; half++)
+            {
+                uint16_t* f = frame + i + half * 8;
+                uint16_t* l = last_frame + i + half * 8;
+                __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f));
+                __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(l));
+
+                __m128i no_cur = _mm_cmpeq_epi16(cur, zero);
+                __m128i no_prev = _mm_cmpeq_epi16(prev, zero);
+                __m128i diff = _mm_or_si128(_mm_subs_epu16(cur, prev), _mm_subs_epu16(prev, cur));
+                __m128i close = _mm_cmpeq_epi16(_mm_subs_epu16(diff, delta_minus_1), zero);
+                __m128i agree = _mm_andnot_si128(_mm_or_si128(no_cur, no_prev), close);
+                __m128i credible16 = half ? _mm_unpackhi_epi8(is_credible, is_credible) : _mm_unpacklo_epi8(is_credible, is_credible);
+                __m128i fill = _mm_and_si128(_mm_andnot_si128(no_prev, no_cur), credible16);
+
+                __m128i result = filter(cur, prev);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(f), select(agree, result, select(fill, prev, cur)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(l), select(agree, result, select(no_cur, prev, cur)));
+
+                agree16[half] = agree;
+                cur_valid16[half] = _mm_andnot_si128(no_cur, all_ones);
+            }
+
+            // A new value either extends the history (when it agrees with the last one) or restarts it
+            __m128i agree8 = _mm_packs_epi16(agree16[0], agree16[1]);
+            __m128i cur_valid8 = _mm_packs_epi16(cur_valid16[0], cur_valid16[1]);
+            hist = select(cur_valid8,
+                          _mm_or_si128(_mm_and_si128(agree8, hist), mask8),
+                          _mm_andnot_si128(mask8, hist));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(history + i), hist);
+        }
+        return i;
+    }
+#endif
+
     void temporal_filter::on_set_persistence_control(uint8_t val)
     {
         std::lock_guard<std::mutex> lock(_mutex);
         _persistence_param = val;
         recalc_persistence_map();
-        _last_frame.clear();
-        _history.clear();
+        reset_history();
     }
 
     void temporal_filter::on_set_alpha(float val)
@@ -148,8 +286,7 @@ namespace librealsense
         _alpha_param = val;
         _one_minus_alpha = 1.f - _alpha_param;
         _cur_frame_index = 0;
-        _last_frame.clear();
-        _history.clear();
+        reset_history();
     }
 
     void temporal_filter::on_set_delta(float val)
@@ -157,8 +294,7 @@ namespace librealsense
         std::lock_guard<std::mutex> lock(_mutex);
         _delta_param = static_cast<uint8_t>(val);
         _cur_frame_index = 0;
-        _last_frame.clear();
-        _history.clear();
+        reset_history();
     }
 
     void  temporal_filter::update_configuration(const rs2::frame& f)
@@ -170,18 +306,21 @@ namespace librealsense
 
             //TODO - reject any frame other than depth/disparity
             _extension_type = f.is<rs2::disparity_frame>() ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME;
-            _bpp = (_extension_type == RS2_EXTENSION_DISPARITY_FRAME) ? sizeof(float) : sizeof(uint16_t);
+            // Fixed-point disparity goes through the same integer code as depth: the result is truncated, as for
+            // depth, so it trails the floating-point filter's by less than 1 / alpha units (1/32 pixel)
+            _bpp = (_extension_type == RS2_EXTENSION_DISPARITY_FRAME && f.get_profile().format() != RS2_FORMAT_DISPARITY16)
+                 ? sizeof(float) : sizeof(uint16_t);
             auto vp = _target_stream_profile.as<rs2::video_stream_profile>();
             _width = vp.width();
             _height = vp.height();
             _stride = _width*_bpp;
             _current_frm_size_pixels = _width * _height;
 
-            _last_frame.clear();
+            reset_history();
+#ifndef RS2_USE_CUDA
             _last_frame.resize(_current_frm_size_pixels*_bpp);
-
-            _history.clear();
             _history.resize(_current_frm_size_pixels*_bpp);
+#endif
 
         }
     }
@@ -195,6 +334,15 @@ namespace librealsense
         return tgt;
     }
 
+    void temporal_filter::reset_history()
+    {
+        _last_frame.clear();
+        _history.clear();
+#ifdef RS2_USE_CUDA
+        _cuda_helper.reset();
+#endif
+    }
+
     void temporal_filter::recalc_persistence_map()
     {
         _persistence_map.fill(0);
@@ -3,6 +3,12 @@
 
 #pragma once
 #include "types.h"
+#include "worker-pool.h"
+#include "processing-roi.h"
+
+#ifdef RS2_USE_CUDA
+#include "../cuda/cuda-depth-filters.cuh"
+#endif
 
 namespace librealsense
 {
@@ -24,8 +30,37 @@ namespace librealsense
         {
             static_assert((std::is_arithmetic<T>::value), "temporal filter assumes numeric types");
 
-            const bool fp = (std::is_floating_point<T>::value);
+            // Every pixel is filtered against its own history only, so the frame can be split between threads
+            auto smooth = [&](size_t begin, size_t end)
+            {
+#ifdef __SSSE3__
+                if (std::is_same<T, uint16_t>::value)
+                    begin += temp_jw_smooth_sse(static_cast<uint16_t*>(frame_data) + begin,
+                                                static_cast<uint16_t*>(_last_frame_data) + begin,
+                                                history + begin, end - begin);
+#endif
+                temp_jw_smooth_range<T>(frame_data, _last_frame_data, history, begin, end);
+            };
+            // Outside the region of interest pixels pass through, and their history stands still
+            if (_roi.active())
+            {
+                auto roi = _roi.get(int(_width), int(_height));
+                if (roi.max_x >= roi.min_x && roi.max_y >= roi.min_y)
+                    for_each_range(size_t(roi.max_y - roi.min_y + 1), [&](size_t begin, size_t end)
+                    {
+                        for (size_t y = roi.min_y + begin; y < roi.min_y + end; y++)
+                            smooth(y * _width + roi.min_x, y * _width + roi.max_x + 1);
+                    });
+            }
+            else
+                for_each_range(_current_frm_size_pixels, smooth);
 
+            _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
+        }
+
+        template<typename T>
+        void temp_jw_smooth_range(void* frame_data, void * _last_frame_data, uint8_t *history, size_t begin, size_t end)
+        {
             T delta_z = static_cast<T>(_delta_param);
 
             auto frame          = reinterpret_cast<T*>(frame_data);
@@ -34,7 +69,7 @@ namespace librealsense
             unsigned char mask = 1 << _cur_frame_index;
 
             // pass one -- go through image and update all
-            for (size_t i = 0; i < _current_frm_size_pixels; i++)
+            for (size_t i = begin; i < end; i++)
             {
                 T cur_val = frame[i];
                 T prev_val = _last_frame[i];
@@ -79,16 +114,23 @@ namespace librealsense
                     history[i] &= ~mask;
                 }
             }
-
-            _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
         }
 
+#ifdef __SSSE3__
+        // Same as temp_jw_smooth_range<uint16_t>, 16 pixels at a time; returns how many pixels were done, leaving
+        // the remainder (fewer than 16) to the scalar code
+        size_t temp_jw_smooth_sse(uint16_t* frame, uint16_t* last_frame, uint8_t* history, size_t count);
+#endif
+
     private:
+        friend class depth_postprocess;  // filters bands of pixels against the history
         void on_set_persistence_control(uint8_t val);
         void on_set_alpha(float val);
         void on_set_delta(float val);
 
         void recalc_persistence_map();
+        // Forget the last frame and the history
+        void reset_history();
         uint8_t                 _persistence_param;
 
         float                   _alpha_param;               // The normalized weight of the current pixel
@@ -105,6 +147,10 @@ namespace librealsense
         uint8_t                 _cur_frame_index;
         // encodes whether a particular 8 bit history is good enough for all 8 phases of storage
         std::array<uint8_t, PRESISTENCY_LUT_SIZE> _persistence_map;
+        processing_roi          _roi;                       // Not applied on the GPU, which keeps the whole frame
+#ifdef RS2_USE_CUDA
+        rscuda::temporal_filter_cuda_helper _cuda_helper;  // Holds the last frame and the history on the device
+#endif
     };
     MAP_EXTENSION(RS2_EXTENSION_TEMPORAL_FILTER, librealsense::temporal_filter);
 }
@@ -10,6 +10,7 @@
 #include "environment.h"
 #include "option.h"
 #include "threshold.h"
+#include "depth-kernels.h"
 #include "image.h"
 
 namespace librealsense
@@ -32,6 +33,8 @@ namespace librealsense
             std::make_shared<min_distance_option>(
                 min_opt,
                 max_opt));
+
+        register_in_place_option();
     }
 
     rs2::frame threshold::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -47,6 +50,15 @@ namespace librealsense
         auto vf = f.as<rs2::depth_frame>();
         auto width = vf.get_width();
         auto height = vf.get_height();
+
+        if (auto tgt = reuse_input(f, _target_stream_profile))
+        {
+            auto du = vf.get_units();
+            auto depth_data = (uint16_t*)tgt.get_data();
+            threshold_depth(depth_data, depth_data, width * height, du, _min, _max);
+            return tgt;
+        }
+
         auto new_f = source.allocate_video_frame(_target_stream_profile, f,
             vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME);
 
@@ -66,12 +78,7 @@ namespace librealsense
             ptr->set_sensor(orig->get_sensor());
             auto du = orig->get_units();
 
-            memset(new_data, 0, width * height * sizeof(uint16_t));
-            for (int i = 0; i < width * height; i++)
-            {
-                auto dist = du * depth_data[i];
-                if (dist >= _min && dist <= _max) new_data[i] = depth_data[i];
-            }
+            threshold_depth(depth_data, new_data, width * height, du, _min, _max);
 
             return new_f;
         }
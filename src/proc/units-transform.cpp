@@ -71,12 +71,7 @@ namespace librealsense
 
             ptr->set_sensor(orig->get_sensor());
 
-            memset(new_data, 0, _width * _height * sizeof(float));
-            for (int i = 0; i < _width * _height; i++)
-            {
-                float dist = *_depth_units * depth_data[i];
-                new_data[i] = dist;
-            }
+            depth_frame::depth_to_meters(depth_data, _width * _height, *_depth_units, new_data);
 
             return new_f;
         }
@@ -0,0 +1,165 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "voxel-grid.h"
+#include "worker-pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+
+namespace librealsense
+{
+    namespace
+    {
+        uint64_t const no_key = ~uint64_t( 0 );
+        int const axis_bits = 21;
+        float const axis_half = float( 1 << ( axis_bits - 1 ) );
+
+        uint64_t axis_key( float v, float inverse_size )
+        {
+            // Written so that NaN clamps as well
+            float f = v * inverse_size;
+            if( ! ( f > -axis_half ) )
+                f = -axis_half;
+            if( ! ( f < axis_half - 1 ) )
+                f = axis_half - 1;
+            return uint64_t( int64_t( std::floor( f ) ) + int64_t( axis_half ) );
+        }
+
+        uint64_t cell_key( float3 const & p, float inverse_size )
+        {
+            return ( axis_key( p.x, inverse_size ) << ( 2 * axis_bits ) ) | ( axis_key( p.y, inverse_size ) << axis_bits )
+                 | axis_key( p.z, inverse_size );
+        }
+
+        // The top bits of a multiplicative hash, so that neighbouring cells spread over the partitions
+        size_t partition_of( uint64_t key )
+        {
+            return size_t( ( key * 0x9E3779B97F4A7C15ull ) >> 58 );
+        }
+    }
+
+    size_t voxel_grid::reduce( float3 const * points, float2 const * uv, size_t count, float size,
+                               float3 * out, float2 * out_uv,
+                               worker_pool * workers, size_t threads )
+    {
+        static_assert( PARTITIONS == 64, "partition_of() gives 6 bits" );
+        if( ! count || ! ( size > 0 ) )
+            return 0;
+
+        float const inverse_size = 1.f / size;
+        size_t const chunks = workers && threads > 1 ? threads : 1;
+        auto for_each = [&]( size_t n, std::function< void( size_t ) > const & fn )
+        {
+            auto range = [&]( size_t begin, size_t end )
+            {
+                for( auto i = begin; i < end; ++i )
+                    fn( i );
+            };
+            if( chunks > 1 )
+                workers->parallel_for( 0, n, chunks, range );
+            else
+                range( 0, n );
+        };
+        auto chunk_begin = [&]( size_t c ) { return c * count / chunks; };
+
+        // The cell of each point, and how many points of each chunk go to each partition
+        _keys.resize( count );
+        _counts.assign( chunks * PARTITIONS, 0 );
+        for_each( chunks, [&]( size_t c )
+        {
+            auto counts = &_counts[c * PARTITIONS];
+            for( auto i = chunk_begin( c ), end = chunk_begin( c + 1 ); i < end; ++i )
+            {
+                if( ! points[i].z )
+                {
+                    _keys[i] = no_key;
+                    continue;
+                }
+                auto const key = cell_key( points[i], inverse_size );
+                _keys[i] = key;
+                ++counts[partition_of( key )];
+            }
+        } );
+
+        // Where each chunk's points of each partition go, partitions one after the other
+        size_t partition_begin[PARTITIONS + 1];
+        size_t total = 0;
+        for( size_t p = 0; p < PARTITIONS; ++p )
+        {
+            partition_begin[p] = total;
+            for( size_t c = 0; c < chunks; ++c )
+            {
+                auto & n = _counts[c * PARTITIONS + p];
+                auto const offset = total;
+                total += n;
+                n = offset;
+            }
+        }
+        partition_begin[PARTITIONS] = total;
+
+        _entries.resize( total );
+        for_each( chunks, [&]( size_t c )
+        {
+            auto offsets = &_counts[c * PARTITIONS];
+            for( auto i = chunk_begin( c ), end = chunk_begin( c + 1 ); i < end; ++i )
+            {
+                auto const key = _keys[i];
+                if( key != no_key )
+                    _entries[offsets[partition_of( key )]++] = { key, uint32_t( i ) };
+            }
+        } );
+
+        // Each partition by itself: its points sorted by cell (then index, so the sums are always in the same order)
+        for_each( PARTITIONS, [&]( size_t p )
+        {
+            auto & cells = _cells[p];
+            cells.clear();
+            auto const begin = _entries.begin() + partition_begin[p];
+            auto const end = _entries.begin() + partition_begin[p + 1];
+            std::sort( begin, end );
+            for( auto it = begin; it != end; )
+            {
+                float3 sum = { 0, 0, 0 };
+                float2 uv_sum = { 0, 0 };
+                size_t n = 0;
+                auto const key = it->first;
+                for( ; it != end && it->first == key; ++it, ++n )
+                {
+                    auto const & v = points[it->second];
+                    sum.x += v.x;
+                    sum.y += v.y;
+                    sum.z += v.z;
+                    if( uv )
+                    {
+                        uv_sum.x += uv[it->second].x;
+                        uv_sum.y += uv[it->second].y;
+                    }
+                }
+                float const inverse_n = 1.f / n;
+                cells.push_back( { { sum.x * inverse_n, sum.y * inverse_n, sum.z * inverse_n },
+                                   { uv_sum.x * inverse_n, uv_sum.y * inverse_n } } );
+            }
+        } );
+
+        // Only now that every point was read can the output overwrite them
+        size_t cell_begin[PARTITIONS + 1];
+        cell_begin[0] = 0;
+        for( size_t p = 0; p < PARTITIONS; ++p )
+            cell_begin[p + 1] = cell_begin[p] + _cells[p].size();
+        for_each( PARTITIONS, [&]( size_t p )
+        {
+            auto i = cell_begin[p];
+            for( auto const & c : _cells[p] )
+            {
+                out[i] = c.point;
+                if( uv )
+                    out_uv[i] = c.uv;
+                ++i;
+            }
+        } );
+        return cell_begin[PARTITIONS];
+    }
+}
@@ -0,0 +1,49 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <src/float3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+namespace librealsense
+{
+    class worker_pool;
+
+    // Reduces a cloud to one point per occupied cell of a regular grid: the centroid of the points in the cell, with the
+    // average of their texture coordinates.
+    //
+    // Cells are hashed into a fixed number of partitions, whose points are then sorted by cell and summed, each
+    // partition by one thread; partitions do not depend on the number of threads, so neither does the output. The
+    // scratch memory is kept between calls.
+    class voxel_grid
+    {
+    public:
+        // Reduces the first 'count' points, dropping those without depth (z == 0), into cells 'size' meters wide.
+        // 'out' and 'out_uv' may be 'points' and 'uv'; 'uv' may be null, and then 'out_uv' is not written. Returns the
+        // number of cells. Cells are limited to +-2^20 of 'size' from the origin: points farther away are clamped to
+        // the last cell.
+        size_t reduce( float3 const * points, float2 const * uv, size_t count, float size,
+                       float3 * out, float2 * out_uv,
+                       worker_pool * workers, size_t threads );
+
+    private:
+        struct cell
+        {
+            float3 point;
+            float2 uv;
+        };
+
+        static constexpr size_t PARTITIONS = 64;
+
+        std::vector< uint64_t > _keys;                       // per point; ~0 for points without depth
+        std::vector< size_t > _counts;                       // per (chunk, partition): points, then offsets
+        std::vector< std::pair< uint64_t, uint32_t > > _entries;  // (key, point index), grouped by partition
+        std::vector< cell > _cells[PARTITIONS];
+    };
+}
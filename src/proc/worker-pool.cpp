@@ -0,0 +1,305 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "worker-pool.h"
+
+#include <rsutils/shared-ptr-singleton.h>
+#include <rsutils/concurrency/thread-policy.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+
+namespace librealsense {
+
+
+static rsutils::shared_ptr_singleton< worker_pool > the_worker_pool;
+static std::atomic< size_t > the_worker_pool_size( 0 );
+
+// The pool, and the index of the queue, of the worker running on this thread
+static thread_local worker_pool const * this_pool = nullptr;
+static thread_local size_t this_queue = 0;
+
+
+std::shared_ptr< worker_pool > worker_pool::shared()
+{
+    auto threads = the_worker_pool_size.load();
+    if( ! threads )
+    {
+        auto const hw = std::thread::hardware_concurrency();
+        threads = hw > 1 ? size_t( hw - 1 ) : size_t( 1 );
+    }
+    return the_worker_pool.instance( threads );
+}
+
+
+void worker_pool::set_shared_size( size_t threads )
+{
+    the_worker_pool_size = threads;
+}
+
+
+worker_pool::worker_pool( size_t threads )
+{
+    for( size_t i = 0; i < threads; ++i )
+        _queues.emplace_back( new queue );
+    for( size_t i = 0; i < threads; ++i )
+        _threads.emplace_back( [this, i]() {
+            rsutils::concurrency::apply_thread_policy( "processing" );
+            run( i );
+        } );
+}
+
+
+worker_pool::~worker_pool()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stopping = true;
+    }
+    _cv.notify_all();
+    for( auto & t : _threads )
+        t.join();
+}
+
+
+void worker_pool::post( std::function< void() > task )
+{
+    if( _threads.empty() )
+    {
+        try
+        {
+            task();
+        }
+        catch( ... )
+        {
+        }
+        return;
+    }
+
+    bool const ours = this_pool == this;
+    auto & q = *_queues[ours ? this_queue : _next_queue++ % _queues.size()];
+    {
+        // Counted before it is queued, so a worker that takes it right away can never bring the count below zero
+        std::lock_guard< std::mutex > lock( _mutex );
+        ++_pending;
+    }
+    {
+        std::lock_guard< std::mutex > lock( q.mutex );
+        if( ours )
+            q.tasks.push_front( std::move( task ) );
+        else
+            q.tasks.push_back( std::move( task ) );
+    }
+    _cv.notify_one();
+}
+
+
+bool worker_pool::take( size_t index, std::function< void() > & task )
+{
+    for( size_t i = 0; i < _queues.size(); ++i )
+    {
+        auto & q = *_queues[( index + i ) % _queues.size()];
+        {
+            std::lock_guard< std::mutex > lock( q.mutex );
+            if( q.tasks.empty() )
+                continue;
+            if( i == 0 )
+            {
+                task = std::move( q.tasks.front() );
+                q.tasks.pop_front();
+            }
+            else
+            {
+                task = std::move( q.tasks.back() );
+                q.tasks.pop_back();
+            }
+        }
+        std::lock_guard< std::mutex > lock( _mutex );
+        --_pending;
+        return true;
+    }
+    return false;
+}
+
+
+void worker_pool::run( size_t index )
+{
+    this_pool = this;
+    this_queue = index;
+    while( true )
+    {
+        std::function< void() > task;
+        if( take( index, task ) )
+        {
+            try
+            {
+                task();
+            }
+            catch( ... )
+            {
+            }
+            continue;
+        }
+
+        // Also wakes up while a task is counted but not yet queued; it is taken on the next round
+        std::unique_lock< std::mutex > lock( _mutex );
+        _cv.wait( lock, [this]() { return _stopping || _pending; } );
+        if( ! _pending )
+            return;  // stopping, with nothing left
+    }
+}
+
+
+namespace {
+
+
+// One parallel_for() call: whoever is available grabs the next range until there are none left
+struct job
+{
+    std::function< void( size_t, size_t ) > const & fn;
+    size_t const begin;
+    size_t const end;
+    size_t const parts;
+
+    std::atomic< size_t > next;
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t done = 0;
+    std::exception_ptr error;
+
+    job( std::function< void( size_t, size_t ) > const & fn_, size_t begin_, size_t end_, size_t parts_ )
+        : fn( fn_ )
+        , begin( begin_ )
+        , end( end_ )
+        , parts( parts_ )
+        , next( 0 )
+    {
+    }
+
+    void work()
+    {
+        size_t i;
+        while( ( i = next++ ) < parts )
+        {
+            std::exception_ptr ex;
+            try
+            {
+                fn( begin + ( end - begin ) * i / parts, begin + ( end - begin ) * ( i + 1 ) / parts );
+            }
+            catch( ... )
+            {
+                ex = std::current_exception();
+            }
+            std::lock_guard< std::mutex > lock( mutex );
+            if( ex && ! error )
+                error = ex;
+            if( ++done == parts )
+                cv.notify_all();
+        }
+    }
+};
+
+
+}  // namespace
+
+
+void worker_pool::parallel_for( size_t begin,
+                                size_t end,
+                                size_t parts,
+                                std::function< void( size_t, size_t ) > const & fn )
+{
+    if( end <= begin )
+        return;
+    parts = std::min( parts, end - begin );
+    if( parts <= 1 || _threads.empty() )
+    {
+        fn( begin, end );
+        return;
+    }
+
+    // Workers that only get to their task after we're done find nothing left and never touch 'fn'
+    auto j = std::make_shared< job >( fn, begin, end, parts );
+    for( size_t i = 1; i < std::min( parts, _threads.size() + 1 ); ++i )
+        post( [j]() { j->work(); } );
+
+    j->work();
+
+    std::unique_lock< std::mutex > lock( j->mutex );
+    j->cv.wait( lock, [&]() { return j->done == parts; } );
+    if( j->error )
+        std::rethrow_exception( j->error );
+}
+
+
+void worker_pool::for_each_range( worker_pool * pool,
+                                  size_t parts,
+                                  size_t count,
+                                  std::function< void( size_t, size_t ) > const & fn )
+{
+    if( pool && parts > 1 )
+        pool->parallel_for( 0, count, parts, fn );
+    else
+        fn( 0, count );
+}
+
+
+void serial_queue::post( std::function< void() > task )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    _tasks.push_back( std::move( task ) );
+    if( _running )
+        return;  // the drain() in progress gets to it
+    _running = true;
+    if( ! _pool )
+        _pool = worker_pool::shared();
+    _pool->post( [this]() { drain(); } );
+}
+
+
+void serial_queue::drain()
+{
+    while( true )
+    {
+        std::function< void() > task;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            if( _tasks.empty() )
+            {
+                _running = false;
+                // Notified under the lock: once flush() returns, 'this' may be gone
+                _cv.notify_all();
+                return;
+            }
+            task = std::move( _tasks.front() );
+        }
+        try
+        {
+            task();
+        }
+        catch( ... )
+        {
+        }
+        // Popped only once done, so size() and flush() account for the task in progress
+        std::lock_guard< std::mutex > lock( _mutex );
+        _tasks.pop_front();
+    }
+}
+
+
+void serial_queue::flush()
+{
+    std::unique_lock< std::mutex > lock( _mutex );
+    _cv.wait( lock, [this]() { return ! _running; } );
+}
+
+
+size_t serial_queue::size() const
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    return _tasks.size();
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,104 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace librealsense {
+
+
+// A pool of threads that processing blocks can split their work between.
+//
+// Blocks share a single pool, from shared(), which lives as long as someone holds it. The calling thread always takes
+// part in the work, so parallel_for() is safe to call from a worker thread as well: it never waits for work that has
+// not started yet.
+//
+// Each thread has a queue of its own. Tasks posted from a worker go to the front of its queue, where it takes them
+// next; a worker with nothing left steals from the back of the others'.
+//
+class worker_pool
+{
+public:
+    // Sized to the number of hardware threads, less the caller's, unless set_shared_size() says otherwise
+    static std::shared_ptr< worker_pool > shared();
+
+    // Size of the pool shared() creates next, from the "processing-threads" context setting; 0 for the default. A pool
+    // that is already alive keeps its size.
+    static void set_shared_size( size_t threads );
+
+    explicit worker_pool( size_t threads );
+    ~worker_pool();
+
+    // Split [begin, end) into up to 'parts' contiguous, roughly equal ranges and call fn( range_begin, range_end ) for
+    // each, concurrently; returns once all are done. If any throws, the first exception is rethrown.
+    void parallel_for( size_t begin, size_t end, size_t parts, std::function< void( size_t, size_t ) > const & fn );
+
+    // Call fn( range_begin, range_end ) over [0, count): split 'parts' ways on 'pool' if there is one, otherwise in one
+    // go on the caller's thread
+    static void
+    for_each_range( worker_pool * pool, size_t parts, size_t count, std::function< void( size_t, size_t ) > const & fn );
+
+    // Run 'task' on one of the threads, some time later; right away, on the caller's, if there are none. Whatever it
+    // throws is swallowed.
+    void post( std::function< void() > task );
+
+    size_t size() const { return _threads.size(); }
+
+private:
+    struct queue
+    {
+        std::mutex mutex;
+        std::deque< std::function< void() > > tasks;
+    };
+
+    bool take( size_t index, std::function< void() > & task );
+    void run( size_t index );
+
+    std::vector< std::unique_ptr< queue > > _queues;  // one per thread
+    std::atomic< size_t > _next_queue{ 0 };           // for tasks posted from outside the pool
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    size_t _pending = 0;  // tasks posted and not yet taken; guarded by _mutex
+    bool _stopping = false;
+    std::vector< std::thread > _threads;
+};
+
+
+// Runs the tasks posted to it one at a time, in the order they were posted, on the shared worker_pool (acquired on the
+// first post). Different queues run concurrently.
+//
+class serial_queue
+{
+public:
+    serial_queue() = default;
+    ~serial_queue() { flush(); }
+
+    void post( std::function< void() > task );
+
+    // Wait for all the tasks posted so far to finish. Not to be called from one of them.
+    void flush();
+
+    // Tasks posted and not yet finished
+    size_t size() const;
+
+private:
+    void drain();
+
+    std::shared_ptr< worker_pool > _pool;
+    mutable std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque< std::function< void() > > _tasks;
+    bool _running = false;  // a drain() is posted or running
+};
+
+
+}  // namespace librealsense
@@ -14,13 +14,16 @@ namespace librealsense
 
     void unpack_y16_y16_from_y12i_10_mipi( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
     {
-        auto count = width * height;
 #ifdef RS2_USE_CUDA
+        auto count = width * height;
         rscuda::split_frame_y16_y16_from_y12i_cuda(dest, count, reinterpret_cast<const y12i_pixel_mipi *>(source));
 #else
-        split_frame(dest, count, reinterpret_cast<const y12i_pixel_mipi*>(source),
-            [](const y12i_pixel_mipi& p) -> uint16_t { return p.l() << 6 | p.l() >> 4; },  // We want to convert 10-bit data to 16-bit data
-            [](const y12i_pixel_mipi& p) -> uint16_t { return p.r() << 6 | p.r() >> 4; }); // Multiply by 64 1/16 to efficiently approximate 65535/1023
+        with_resolution(width, height, [&](auto w, auto h)
+        {
+            split_frame(dest, pixel_count(w, h), reinterpret_cast<const y12i_pixel_mipi*>(source),
+                [](const y12i_pixel_mipi& p) -> uint16_t { return p.l() << 6 | p.l() >> 4; },  // We want to convert 10-bit data to 16-bit data
+                [](const y12i_pixel_mipi& p) -> uint16_t { return p.r() << 6 | p.r() >> 4; }); // Multiply by 64 1/16 to efficiently approximate 65535/1023
+        });
 #endif
     }
 
@@ -22,14 +22,17 @@ namespace librealsense
     };
     void unpack_y10msb_y10msb_from_y16i( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
     {
-        auto count = width * height;
 // CUDA TODO
 //#ifdef RS2_USE_CUDA
+//        auto count = width * height;
 //        rscuda::split_frame_y10msb_y10msb_from_y16i_cuda(dest, count, reinterpret_cast<const y12i_pixel*>(source));
 //#else
-        split_frame(dest, count, reinterpret_cast<const y16i_pixel*>(source),
-            [](const y16i_pixel& p) -> uint16_t { return (p.l()); },
-            [](const y16i_pixel& p) -> uint16_t { return (p.r()); });
+        with_resolution(width, height, [&](auto w, auto h)
+        {
+            split_frame(dest, pixel_count(w, h), reinterpret_cast<const y16i_pixel*>(source),
+                [](const y16i_pixel& p) -> uint16_t { return (p.l()); },
+                [](const y16i_pixel& p) -> uint16_t { return (p.r()); });
+        });
 //#endif
     }
 
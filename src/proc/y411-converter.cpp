@@ -3,6 +3,12 @@
 
 #include "y411-converter.h"
 
+#include "option.h"
+#include "color-formats-neon.h"
+#include "cpu-features.h"
+
+#include <thread>
+
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
 #endif
@@ -293,15 +299,34 @@ namespace librealsense
         }
     }
 
-    // This function unpacks Y411 format into RGB8 using SSE if defined
+    // This function unpacks Y411 format into RGB8 using CUDA when built with it, or SSE or NEON when the CPU has them
     // The size of the frame must be bigger than 4 pixels and product of 32
     void unpack_y411( uint8_t * const dest[], const uint8_t * const s, int w, int h, int actual_size )
     {
+#ifdef RS2_USE_CUDA
+        rscuda::unpack_y411_cuda_helper(s, dest[0], w, h);
+        return;
+#endif
 #if defined __SSSE3__ && ! defined ANDROID
-        unpack_y411_sse(dest[0], s, w, h, actual_size);
-#else
-        unpack_y411_native(dest[0], s, w, h, actual_size);
+        if( get_simd_level() >= simd_level::simd128 )
+        {
+            unpack_y411_sse(dest[0], s, w, h, actual_size);
+            return;
+        }
+#elif defined RS2_YUV_NEON
+        if( get_simd_level() >= simd_level::simd128 && w % 16 == 0 )
+        {
+            yuv_neon::unpack_y411_rgb8(dest[0], s, w, h);
+            return;
+        }
 #endif
+        unpack_y411_native(dest[0], s, w, h, actual_size);
+    }
+
+    y411_converter::y411_converter(rs2_format target_format)
+        : functional_processing_block("Y411 Transform", target_format)
+    {
+        register_processing_threads_option();
     }
 
     void y411_converter::process_function( uint8_t * const dest[],
@@ -311,6 +336,24 @@ namespace librealsense
         int actual_size,
         int input_size)
     {
-        unpack_y411(dest, source, width, height, actual_size);
-    }  // namespace librealsense
+        // Split on pairs of lines, which share their chroma; the SIMD paths need whole multiples of 16 pixels each.
+        // The CUDA path converts whole frames.
+#ifdef RS2_USE_CUDA
+        bool const split = false;
+#else
+        bool const split = _threads > 1 && width % 16 == 0 && height % 2 == 0;
+#endif
+        if (!split)
+        {
+            unpack_y411(dest, source, width, height, actual_size);
+            return;
+        }
+
+        for_each_range(height / 2, [&](size_t begin, size_t end)
+        {
+            uint8_t * planes[1] = { dest[0] + begin * 2 * width * 3 };
+            int const lines = int(end - begin) * 2;
+            unpack_y411(planes, source + begin * 3 * width, width, lines, lines * width * 3);
+        });
+    }
 }
@@ -4,14 +4,14 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "worker-pool.h"
 
 namespace librealsense
 {
     class LRS_EXTENSION_API y411_converter : public functional_processing_block
     {
     public:
-        y411_converter(rs2_format target_format)
-            : functional_processing_block("Y411 Transform", target_format) {};
+        y411_converter(rs2_format target_format);
 
     protected:
         void process_function( uint8_t * const dest[],
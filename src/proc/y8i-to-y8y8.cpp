@@ -14,14 +14,26 @@ namespace librealsense
     struct y8i_pixel { uint8_t l, r; };
     void unpack_y8_y8_from_y8i( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
     {
-        auto count = width * height;
 #ifdef RS2_USE_CUDA
+        auto count = width * height;
         rscuda::split_frame_y8_y8_from_y8i_cuda(dest, count, reinterpret_cast<const y8i_pixel *>(source));
 #else
-        split_frame(dest, count, reinterpret_cast<const y8i_pixel*>(source),
+        with_resolution(width, height, [&](auto w, auto h)
+        {
+            split_frame(dest, pixel_count(w, h), reinterpret_cast<const y8i_pixel*>(source),
+                [](const y8i_pixel & p) -> uint8_t { return p.l; },
+                [](const y8i_pixel & p) -> uint8_t { return p.r; });
+        });
+#endif
+    }
+
+    void unpack_y8_y8_from_y8i_decimated( uint8_t * const dest[], const uint8_t * source, int width, int height, int factor )
+    {
+        auto out_size = interleaved_functional_processing_block::decimated_size;
+        split_frame_decimated(dest, width, height, factor, out_size(width, factor), out_size(height, factor),
+            reinterpret_cast<const y8i_pixel*>(source),
             [](const y8i_pixel & p) -> uint8_t { return p.l; },
             [](const y8i_pixel & p) -> uint8_t { return p.r; });
-#endif
     }
 
     y8i_to_y8y8::y8i_to_y8y8(int left_idx, int right_idx) :
@@ -30,10 +42,15 @@ namespace librealsense
     y8i_to_y8y8::y8i_to_y8y8(const char * name, int left_idx, int right_idx)
         : interleaved_functional_processing_block(name, RS2_FORMAT_Y8I, RS2_FORMAT_Y8, RS2_STREAM_INFRARED, RS2_EXTENSION_VIDEO_FRAME, 1,
                                                                         RS2_FORMAT_Y8, RS2_STREAM_INFRARED, RS2_EXTENSION_VIDEO_FRAME, 2)
-    {}
+    {
+        register_decimation_option();
+    }
 
     void y8i_to_y8y8::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
     {
-        unpack_y8_y8_from_y8i(dest, source, width, height, actual_size);
+        if (_active_decimation > 1)
+            unpack_y8_y8_from_y8i_decimated(dest, source, width, height, _active_decimation);
+        else
+            unpack_y8_y8_from_y8i(dest, source, width, height, actual_size);
     }
 } // namespace librealsense
@@ -24,6 +24,8 @@
 #include "proc/processing-blocks-factory.h"
 #include "proc/colorizer.h"
 #include "proc/pointcloud.h"
+#include "proc/fused-pointcloud.h"
+#include "proc/projection.h"
 #include "proc/align.h"
 #include "proc/threshold.h"
 #include "proc/units-transform.h"
@@ -32,11 +34,13 @@
 #include "proc/decimation-filter.h"
 #include "proc/spatial-filter.h"
 #include "proc/hole-filling-filter.h"
+#include "proc/depth-postprocess.h"
 #include "proc/color-formats-converter.h"
 #include "proc/y411-converter.h"
 #include "proc/rates-printer.h"
 #include "proc/hdr-merge.h"
 #include "proc/sequence-id-filter.h"
+#include "proc/rectify.h"
 #include "media/playback/playback_device.h"
 #include "stream.h"
 #include <librealsense2/h/rs_types.h>
@@ -59,6 +63,10 @@
 #include "color-sensor.h"
 #include "composite-frame.h"
 #include "points.h"
+#include "latency-stats.h"
+#include "usb-bandwidth.h"
+#include "frame-memory-budget.h"
+#include "frame-batch.h"
 
 #include <src/core/time-service.h>
 #include <rsutils/string/from.h>
@@ -195,12 +203,15 @@ struct rs2_pipeline_profile
 struct rs2_frame_queue
 {
     explicit rs2_frame_queue(int cap)
-        : queue( cap, [cap]( librealsense::frame_holder const & fh ) {
+        : capacity( cap )
+        , queue( cap, [cap]( librealsense::frame_holder const & fh ) {
             LOG_DEBUG( "DROPPED queue (capacity= " << cap << ") frame " << fh );
+            librealsense::stream_stats::drop( fh.frame, RS2_FRAME_DROP_STAGE_FRAME_QUEUE );
         } )
     {
     }
 
+    int const capacity;
     single_consumer_frame_queue<librealsense::frame_holder> queue;
 };
 
@@ -214,6 +225,11 @@ struct rs2_terminal_parser
     std::shared_ptr<librealsense::terminal_parser> terminal_parser;
 };
 
+struct rs2_color_to_depth_projector
+{
+    std::shared_ptr<librealsense::color_to_depth_projector> projector;
+};
+
 struct rs2_firmware_log_message
 {
     std::shared_ptr<librealsense::fw_logs::fw_logs_binary_data> firmware_log_binary_data;
@@ -540,6 +556,17 @@ void rs2_get_motion_intrinsics(const rs2_stream_profile* mode, rs2_motion_device
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, mode, intrinsics)
 
+int rs2_get_motion_samples(const rs2_sensor* sensor, rs2_stream stream, double from_ms, double to_ms, rs2_motion_sample* samples, int max_samples, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    VALIDATE_NOT_NULL(samples);
+    VALIDATE_RANGE(max_samples, 0, std::numeric_limits<int>::max());
+
+    auto motion = VALIDATE_INTERFACE(sensor->sensor, librealsense::motion_sensor);
+    return int(motion->get_motion_samples(stream, from_ms, to_ms, samples, size_t(max_samples)));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, sensor, stream, from_ms, to_ms, samples, max_samples)
+
 
 void rs2_get_video_stream_resolution(const rs2_stream_profile* from, int* width, int* height, rs2_error** error) BEGIN_API_CALL
 {
@@ -718,6 +745,13 @@ int rs2_is_option_read_only(const rs2_options* options, rs2_option option, rs2_e
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, options, option)
 
+int rs2_can_set_option_while_streaming(const rs2_options* options, rs2_option option, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(options);
+    return options->options->get_option(option).can_set_while_streaming();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, options, option)
+
 float rs2_get_option(const rs2_options* options, rs2_option option_id, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(options);
@@ -774,18 +808,17 @@ void rs2_delete_option_value( rs2_option_value const * p_value ) BEGIN_API_CALL
 }
 NOEXCEPT_RETURN( , p_value )
 
-void rs2_set_option(const rs2_options* options, rs2_option option, float value, rs2_error** error) BEGIN_API_CALL
+// Sets a float value according to the option's type, or throws if it does not fit; with 'dry_run', only checks it
+static void set_option_float( librealsense::option & option_ref, float value, bool dry_run = false )
 {
-    VALIDATE_NOT_NULL(options);
-    VALIDATE_OPTION_ENABLED(options, option);
-    auto& option_ref = options->options->get_option(option);
     auto range = option_ref.get_range();
     switch( option_ref.get_value_type() )
     {
     case RS2_OPTION_TYPE_FLOAT:
         if( range.min != range.max && range.step )
             VALIDATE_RANGE( value, range.min, range.max );
-        option_ref.set( value );
+        if( ! dry_run )
+            option_ref.set( value );
         break;
 
     case RS2_OPTION_TYPE_INTEGER:
@@ -793,14 +826,16 @@ void rs2_set_option(const rs2_options* options, rs2_option option, float value,
             VALIDATE_RANGE( value, range.min, range.max );
         if( (int)value != value )
             throw invalid_value_exception( rsutils::string::from() << "not an integer: " << value );
-        option_ref.set( value );
+        if( ! dry_run )
+            option_ref.set( value );
         break;
 
     case RS2_OPTION_TYPE_BOOLEAN:
-        if( value == 0.f )
-            option_ref.set_value( false );
-        else if( value == 1.f )
-            option_ref.set_value( true );
+        if( value == 0.f || value == 1.f )
+        {
+            if( ! dry_run )
+                option_ref.set_value( value == 1.f );
+        }
         else
             throw invalid_value_exception( rsutils::string::from() << "not a boolean: " << value );
         break;
@@ -812,15 +847,110 @@ void rs2_set_option(const rs2_options* options, rs2_option option, float value,
             auto desc = option_ref.get_value_description( value );
             if( desc )
             {
-                option_ref.set_value( desc );
+                if( ! dry_run )
+                    option_ref.set_value( desc );
                 break;
             }
         }
         throw not_implemented_exception( "use rs2_set_option_value to set string values" );
     }
 }
+
+void rs2_set_option(const rs2_options* options, rs2_option option, float value, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(options);
+    VALIDATE_OPTION_ENABLED(options, option);
+    set_option_float( options->options->get_option(option), value );
+}
 HANDLE_EXCEPTIONS_AND_RETURN(, options, option, value)
 
+// The raw sensor behind the options, if any, to keep powered while several of them are set
+static librealsense::raw_sensor_base * get_raw_sensor( librealsense::options_interface * options )
+{
+    if( auto synthetic = dynamic_cast< librealsense::synthetic_sensor * >( options ) )
+        return synthetic->get_raw_sensor().get();
+    return dynamic_cast< librealsense::raw_sensor_base * >( options );
+}
+
+void rs2_apply_options( const rs2_options * options,
+                        const rs2_option * option_ids,
+                        const float * values,
+                        int count,
+                        rs2_error ** error ) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL( options );
+    VALIDATE_RANGE( count, 0, RS2_OPTION_COUNT );
+    if( ! count )
+        return;
+    VALIDATE_NOT_NULL( option_ids );
+    VALIDATE_NOT_NULL( values );
+
+    auto sensor = dynamic_cast< librealsense::sensor_interface * >( options->options );
+    bool const streaming = sensor && sensor->is_streaming();
+
+    // Everything is checked before anything is set
+    std::vector< librealsense::option * > targets;
+    for( int i = 0; i < count; ++i )
+    {
+        VALIDATE_OPTION_ENABLED( options, option_ids[i] );
+        auto & option = options->options->get_option( option_ids[i] );
+        if( option.is_read_only() )
+            throw invalid_value_exception( "option " + get_string( option_ids[i] ) + " is read-only" );
+        if( streaming && ! option.can_set_while_streaming() )
+            throw wrong_api_call_sequence_exception( "option " + get_string( option_ids[i] )
+                                                     + " cannot be set while streaming" );
+        set_option_float( option, values[i], true );
+        targets.push_back( &option );
+    }
+
+    // Then all are sent in one go, with the device powered throughout; if one fails, those already set go back
+    auto raw = get_raw_sensor( options->options );
+    if( raw )
+        raw->prepare_for_bulk_operation();
+    std::vector< std::pair< librealsense::option *, float > > applied;
+    try
+    {
+        for( int i = 0; i < count; ++i )
+        {
+            float previous = 0;
+            bool const restorable = [&]()
+            {
+                try
+                {
+                    previous = targets[i]->query();
+                    return true;
+                }
+                catch( ... )
+                {
+                    return false;
+                }
+            }();
+            set_option_float( *targets[i], values[i] );
+            if( restorable )
+                applied.emplace_back( targets[i], previous );
+        }
+    }
+    catch( ... )
+    {
+        for( auto it = applied.rbegin(); it != applied.rend(); ++it )
+        {
+            try
+            {
+                set_option_float( *it->first, it->second );
+            }
+            catch( ... )
+            {
+            }
+        }
+        if( raw )
+            raw->finished_bulk_operation();
+        throw;
+    }
+    if( raw )
+        raw->finished_bulk_operation();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, options, option_ids, values, count )
+
 void rs2_set_option_value( rs2_options const * options, rs2_option_value const * option_value, rs2_error ** error ) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL( options );
@@ -1066,6 +1196,82 @@ void rs2_set_notifications_callback(const rs2_sensor* sensor, rs2_notification_c
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor, on_notification, user)
 
 
+class frame_allocator : public rs2_frame_allocator
+{
+    rs2_frame_allocate_callback_ptr aptr;
+    rs2_frame_deallocate_callback_ptr dptr;
+    void * user;
+
+public:
+    frame_allocator( rs2_frame_allocate_callback_ptr on_allocate,
+                     rs2_frame_deallocate_callback_ptr on_deallocate,
+                     void * user )
+        : aptr( on_allocate )
+        , dptr( on_deallocate )
+        , user( user )
+    {
+    }
+
+    void * allocate( size_t size ) override { return aptr( static_cast< int >( size ), user ); }
+    void deallocate( void * buffer, size_t size ) override
+    {
+        if( dptr )
+            dptr( buffer, static_cast< int >( size ), user );
+    }
+
+    void release() override { delete this; }
+};
+
+
+static librealsense::sensor_base * get_frame_allocating_sensor( const rs2_sensor * sensor )
+{
+    auto base = dynamic_cast< librealsense::sensor_base * >( sensor->sensor );
+    if( ! base )
+        throw librealsense::not_implemented_exception( "Sensor does not support custom frame allocation" );
+    return base;
+}
+
+void rs2_set_frame_allocator( const rs2_sensor * sensor,
+                              rs2_frame_allocate_callback_ptr allocate,
+                              rs2_frame_deallocate_callback_ptr deallocate,
+                              void * user,
+                              rs2_error ** error ) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL( sensor );
+    rs2_frame_allocator_sptr allocator;
+    if( allocate )
+        allocator.reset( new frame_allocator( allocate, deallocate, user ),
+                         []( rs2_frame_allocator * p ) { delete p; } );
+    get_frame_allocating_sensor( sensor )->set_frame_allocator( std::move( allocator ) );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, allocate, deallocate, user )
+
+void rs2_set_frame_allocator_cpp( const rs2_sensor * sensor, rs2_frame_allocator * allocator, rs2_error ** error ) BEGIN_API_CALL
+{
+    // Take ownership of the allocator ASAP or else memory leaks could result if we throw!
+    rs2_frame_allocator_sptr allocator_ptr;
+    if( allocator )
+        allocator_ptr.reset( allocator, []( rs2_frame_allocator * p ) { p->release(); } );
+
+    VALIDATE_NOT_NULL( sensor );
+    get_frame_allocating_sensor( sensor )->set_frame_allocator( std::move( allocator_ptr ) );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, allocator )
+
+void rs2_set_callback_queue( const rs2_sensor * sensor, unsigned int size, int drop_newest, rs2_error ** error ) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL( sensor );
+    VALIDATE_LE( size, 256u );
+    auto base = dynamic_cast< librealsense::sensor_base * >( sensor->sensor );
+    if( ! base )
+        throw librealsense::not_implemented_exception( "Sensor does not support a callback queue" );
+    if( base->is_streaming() )
+        throw librealsense::wrong_api_call_sequence_exception( "Callback queue cannot be changed while streaming" );
+    base->set_callback_queue( size, drop_newest != 0 );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, size, drop_newest )
+
+
 class software_device_destruction_callback : public rs2_software_device_destruction_callback
 {
     rs2_software_device_destruction_callback_ptr nptr;
@@ -1111,6 +1317,51 @@ void rs2_software_device_set_destruction_callback(const rs2_device* dev, rs2_sof
 HANDLE_EXCEPTIONS_AND_RETURN(, dev, on_destruction, user)
 
 
+class software_device_frameset_release_callback : public rs2_software_device_frameset_release_callback
+{
+    rs2_software_device_frameset_release_callback_ptr nptr;
+    void * user;
+
+public:
+    software_device_frameset_release_callback( rs2_software_device_frameset_release_callback_ptr on_release,
+                                               void * user )
+        : nptr( on_release )
+        , user( user )
+    {
+    }
+
+    void on_frameset_release( int frame_number ) override
+    {
+        if( nptr )
+        {
+            try
+            {
+                nptr( frame_number, user );
+            }
+            catch( ... )
+            {
+                LOG_ERROR( "Received an exception from software device frameset release callback!" );
+            }
+        }
+    }
+
+    void release() override { delete this; }
+};
+
+
+void rs2_software_device_set_frameset_release_callback(const rs2_device* dev, rs2_software_device_frameset_release_callback_ptr on_release, void* user, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(dev);
+    auto swdev = VALIDATE_INTERFACE(dev->device, librealsense::software_device);
+    VALIDATE_NOT_NULL(on_release);
+    rs2_software_device_frameset_release_callback_sptr callback(
+        new software_device_frameset_release_callback( on_release, user ),
+        [](rs2_software_device_frameset_release_callback* p) { delete p; });
+    swdev->register_frameset_release_callback(std::move(callback));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, dev, on_release, user)
+
+
 void rs2_set_devices_changed_callback(const rs2_context* context, rs2_devices_changed_callback_ptr callback, void* user, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(context);
@@ -1184,6 +1435,23 @@ void rs2_software_device_set_destruction_callback_cpp(const rs2_device* dev, rs2
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, dev, callback)
 
+void rs2_software_device_set_frameset_release_callback_cpp(const rs2_device* dev, rs2_software_device_frameset_release_callback* callback, rs2_error** error) BEGIN_API_CALL
+{
+    // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
+    // 'new' when calling us)
+    VALIDATE_NOT_NULL( callback );
+    rs2_software_device_frameset_release_callback_sptr callback_ptr{ callback,
+                                                                     []( rs2_software_device_frameset_release_callback * p )
+                                                                     {
+                                                                         p->release();
+                                                                     } };
+
+    VALIDATE_NOT_NULL(dev);
+    auto swdev = VALIDATE_INTERFACE(dev->device, librealsense::software_device);
+    swdev->register_frameset_release_callback( callback_ptr );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, dev, callback)
+
 void rs2_set_devices_changed_callback_cpp(rs2_context* context, rs2_devices_changed_callback* callback, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -1531,6 +1799,37 @@ int rs2_try_wait_for_frame(rs2_frame_queue* queue, unsigned int timeout_ms, rs2_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, queue, output_frame)
 
+int rs2_wait_for_frame_batch(rs2_frame_queue* queue, rs2_frame** frames, int count, unsigned int timeout_ms, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(queue);
+    VALIDATE_NOT_NULL(frames);
+    VALIDATE_RANGE(count, 1, queue->capacity);
+    std::vector<librealsense::frame_holder> batch(count);
+    auto const n = queue->queue.dequeue(batch.data(), batch.size(), timeout_ms);
+    if (!n)
+    {
+        throw std::runtime_error("Frame did not arrive in time!");
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        frames[i] = (rs2_frame*)batch[i].frame;
+        batch[i].frame = nullptr;
+    }
+    return int(n);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, queue, frames, count, timeout_ms)
+
+rs2_frame* rs2_pack_frames_nchw(rs2_frame** frames, int count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frames);
+    VALIDATE_RANGE(count, 1, std::numeric_limits<int>::max());
+    for (int i = 0; i < count; ++i)
+        VALIDATE_NOT_NULL(frames[i]);
+    return (rs2_frame*)pack_frames_nchw(reinterpret_cast<frame_interface* const*>(frames), count);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frames, count)
+
 void rs2_enqueue_frame(rs2_frame* frame, void* queue) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
@@ -1538,7 +1837,10 @@ void rs2_enqueue_frame(rs2_frame* frame, void* queue) BEGIN_API_CALL
     auto q = reinterpret_cast<rs2_frame_queue*>(queue);
     librealsense::frame_holder fh;
     fh.frame = (frame_interface*)frame;
+    auto profile = fh->get_stream();
     q->queue.enqueue(std::move(fh));
+    if (profile)
+        profile->get_stats().drops.queue_depth(RS2_FRAME_DROP_STAGE_FRAME_QUEUE, q->queue.size(), q->capacity);
 }
 NOEXCEPT_RETURN(, frame, queue)
 
@@ -1571,6 +1873,38 @@ void rs2_get_extrinsics(const rs2_stream_profile* from,
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, from, to, extrin)
 
+void rs2_get_stream_stats(const rs2_stream_profile* profile, rs2_stream_stats* stats, int reset, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(profile);
+    VALIDATE_NOT_NULL(stats);
+
+    auto & s = profile->profile->get_stats();
+    stats->arrival_to_publish = s.arrival_to_publish.get_stats();
+    stats->publish_to_sync = s.publish_to_sync.get_stats();
+    stats->processing = s.processing.get_stats();
+    stats->exposure_to_callback = s.exposure_to_callback.get_stats();
+    if (reset)
+    {
+        s.arrival_to_publish.reset();
+        s.publish_to_sync.reset();
+        s.processing.reset();
+        s.exposure_to_callback.reset();
+    }
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, profile, stats, reset)
+
+void rs2_get_stream_frame_drops(const rs2_stream_profile* profile, rs2_frame_drops* drops, int reset, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(profile);
+    VALIDATE_NOT_NULL(drops);
+
+    auto & s = profile->profile->get_stats();
+    *drops = s.drops.get_stats();
+    if (reset)
+        s.drops.reset();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, profile, drops, reset)
+
 void rs2_register_extrinsics(const rs2_stream_profile* from,
     const rs2_stream_profile* to,
     rs2_extrinsics extrin, rs2_error** error)BEGIN_API_CALL
@@ -1946,6 +2280,22 @@ void rs2_context_unload_tracking_module(rs2_context* ctx, rs2_error** error) BEG
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, ctx)
 
+rs2_raw_data_buffer* rs2_get_usb_bandwidth_usage(const rs2_context* context, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(context);
+    auto const usage = librealsense::usb_bandwidth::get_usage().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( usage.begin(), usage.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, context)
+
+rs2_raw_data_buffer* rs2_get_frame_memory_usage(const rs2_context* context, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(context);
+    auto const usage = librealsense::frame_memory_budget::instance().get_usage().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( usage.begin(), usage.end() ) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, context)
+
 const char* rs2_playback_device_get_file_path(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2011,6 +2361,28 @@ int rs2_playback_device_is_real_time(const rs2_device* device, rs2_error** error
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, device)
 
+void rs2_playback_device_set_prefetch_depth(const rs2_device* device, unsigned int depth, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    playback->set_prefetch_depth(depth);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, depth)
+
+void rs2_playback_device_sync_with(const rs2_device* device, const rs2_device* other, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(other);
+    VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    VALIDATE_INTERFACE(other->device, librealsense::playback_device);
+    auto playback = std::dynamic_pointer_cast< librealsense::playback_device >( device->device );
+    auto other_playback = std::dynamic_pointer_cast< librealsense::playback_device >( other->device );
+    if( ! playback || ! other_playback )
+        throw std::runtime_error( "Device is not a playback device" );
+    librealsense::playback_device::sync( playback, other_playback );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, other)
+
 void rs2_playback_device_set_status_changed_callback(const rs2_device* device, rs2_playback_status_changed_callback* callback, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -2048,6 +2420,14 @@ void rs2_playback_device_set_playback_speed(const rs2_device* device, float spee
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, device)
 
+unsigned long long rs2_playback_device_get_dropped_frames(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    return playback->get_dropped_frames();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device)
+
 void rs2_playback_device_stop(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2072,7 +2452,7 @@ rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* fi
     VALIDATE_NOT_NULL(file);
 
     return new rs2_device({
-        std::make_shared<record_device>(device->device, std::make_shared<ros_writer>(file, compression_enabled != 0))
+        std::make_shared<record_device>(device->device, std::make_shared<ros_writer>(file, compression_enabled != 0, device->device->get_context()->get_settings()))
         });
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file)
@@ -2101,6 +2481,23 @@ const char* rs2_record_device_filename(const rs2_device* device, rs2_error** err
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device)
 
+void rs2_record_device_set_queue_limit(const rs2_device* device, unsigned int max_frames, rs2_record_queue_policy policy, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_ENUM(policy);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    record_device->set_write_queue_limit(max_frames, policy);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, max_frames, policy)
+
+unsigned long long rs2_record_device_get_dropped_frames(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    return record_device->get_dropped_frames();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device)
+
 
 rs2_frame* rs2_allocate_synthetic_video_frame(rs2_source* source, const rs2_stream_profile* new_stream, rs2_frame* original,
     int new_bpp, int new_width, int new_height, int new_stride, rs2_extension frame_type, rs2_error** error) BEGIN_API_CALL
@@ -2217,6 +2614,23 @@ int rs2_pipeline_try_wait_for_frames(rs2_pipeline* pipe, rs2_frame** output_fram
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, pipe, output_frame)
 
+int rs2_pipeline_wait_for_frames_batch(rs2_pipeline* pipe, rs2_frame** framesets, int count, unsigned int timeout_ms, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(pipe);
+    VALIDATE_NOT_NULL(framesets);
+    VALIDATE_RANGE(count, 1, std::numeric_limits<int>::max());
+
+    std::vector<librealsense::frame_holder> batch(count);
+    auto const n = pipe->pipeline->wait_for_frames(batch.data(), batch.size(), timeout_ms);
+    for (size_t i = 0; i < n; ++i)
+    {
+        framesets[i] = (rs2_frame*)batch[i].frame;
+        batch[i].frame = nullptr;
+    }
+    return int(n);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, pipe, framesets, count, timeout_ms)
+
 void rs2_delete_pipeline(rs2_pipeline* pipe) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(pipe);
@@ -2518,6 +2932,15 @@ rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error) BEGIN_
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_multi_device_sync_processing_block(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::syncer_process_unit>(
+        std::initializer_list< librealsense::bool_option::ptr >{}, true, true );
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
 void rs2_start_processing(rs2_processing_block* block, rs2_frame_callback* on_frame, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -2610,6 +3033,66 @@ int rs2_embedded_frames_count(rs2_frame* composite, rs2_error** error) BEGIN_API
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, composite)
 
+int rs2_frameset_snapshot( rs2_frame * frameset, rs2_frame_snapshot * frames, int max_frames,
+                           const rs2_frame_metadata_value * metadata, int metadata_count,
+                           rs2_metadata_type * values, int * supported, rs2_error ** error ) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL( frameset );
+    VALIDATE_RANGE( max_frames, 0, std::numeric_limits< int >::max() );
+    VALIDATE_RANGE( metadata_count, 0, (int)RS2_FRAME_METADATA_COUNT );
+    if( max_frames )
+        VALIDATE_NOT_NULL( frames );
+    if( metadata_count )
+    {
+        VALIDATE_NOT_NULL( metadata );
+        VALIDATE_NOT_NULL( values );
+        for( int m = 0; m < metadata_count; ++m )
+            VALIDATE_ENUM( metadata[m] );
+    }
+
+    auto f = (frame_interface *)frameset;
+    auto cf = dynamic_cast< librealsense::composite_frame * >( f );
+    int const count = cf ? (int)cf->get_embedded_frames_count() : 1;
+    for( int i = 0; i < count && i < max_frames; ++i )
+    {
+        auto fi = cf ? cf->get_frame( i ) : f;
+        auto & s = frames[i];
+        auto profile = fi->get_stream();
+        s.frame = (rs2_frame *)fi;
+        s.data = fi->get_frame_data();
+        s.data_size = fi->get_frame_data_size();
+        s.profile = profile->get_c_wrapper();
+        s.stream = profile->get_stream_type();
+        s.stream_index = profile->get_stream_index();
+        s.format = profile->get_format();
+        s.unique_id = profile->get_unique_id();
+        s.frame_number = fi->get_frame_number();
+        s.timestamp = fi->get_frame_timestamp();
+        s.timestamp_domain = fi->get_frame_timestamp_domain();
+        if( auto vf = dynamic_cast< librealsense::video_frame * >( fi ) )
+        {
+            s.width = vf->get_width();
+            s.height = vf->get_height();
+            s.stride = vf->get_stride();
+            s.bpp = vf->get_bpp();
+        }
+        else
+            s.width = s.height = s.stride = s.bpp = 0;
+
+        for( int m = 0; m < metadata_count; ++m )
+        {
+            auto & value = values[i * metadata_count + m];
+            bool const found = fi->find_metadata( metadata[m], &value );
+            if( ! found )
+                value = 0;
+            if( supported )
+                supported[i * metadata_count + m] = found;
+        }
+    }
+    return count;
+}
+HANDLE_EXCEPTIONS_AND_RETURN( 0, frameset, frames, max_frames, metadata, metadata_count, values, supported )
+
 rs2_vertex* rs2_get_frame_vertices(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
@@ -2643,6 +3126,15 @@ int rs2_get_frame_points_count(const rs2_frame* frame, rs2_error** error) BEGIN_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
 
+const int* rs2_get_frame_points_pixel_indices(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    auto & indices = points->get_pixel_indices();
+    return indices.empty() ? nullptr : indices.data();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
+
 rs2_processing_block* rs2_create_pointcloud(rs2_error** error) BEGIN_API_CALL
 {
     return new rs2_processing_block { pointcloud::create() };
@@ -2683,6 +3175,28 @@ rs2_processing_block* rs2_create_align(rs2_stream align_to, rs2_error** error) B
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, align_to)
 
+rs2_processing_block* rs2_create_align_to_streams(const rs2_stream* align_to, int count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(align_to);
+    VALIDATE_RANGE(count, 1, RS2_STREAM_COUNT - 1);
+
+    std::vector< rs2_stream > streams;
+    for( int i = 0; i < count; ++i )
+    {
+        VALIDATE_ENUM( align_to[i] );
+        if( count > 1 && align_to[i] == RS2_STREAM_DEPTH )
+            throw invalid_value_exception( "depth cannot be aligned to with other streams" );
+        if( std::find( streams.begin(), streams.end(), align_to[i] ) != streams.end() )
+            throw invalid_value_exception( std::string( get_string( align_to[i] ) ) + " is listed twice" );
+        streams.push_back( align_to[i] );
+    }
+
+    auto block = align::create_align( streams );
+
+    return new rs2_processing_block{ block };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, align_to, count)
+
 rs2_processing_block* rs2_create_colorizer(rs2_error** error) BEGIN_API_CALL
 {
     auto block = std::make_shared<librealsense::colorizer>();
@@ -2734,6 +3248,66 @@ rs2_processing_block* rs2_create_hole_filling_filter_block(rs2_error** error) BE
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_depth_postprocess_block(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::depth_postprocess>();
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
+rs2_processing_block* rs2_create_rectify_block(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::rectify>();
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
+rs2_processing_block* rs2_create_fused_pointcloud_block(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::fused_pointcloud>();
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
+void rs2_set_fused_pointcloud_extrinsics(rs2_processing_block* block, const char* serial, const rs2_extrinsics* extrinsics, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    VALIDATE_NOT_NULL(serial);
+    VALIDATE_NOT_NULL(extrinsics);
+    auto fused = std::dynamic_pointer_cast<librealsense::fused_pointcloud>(block->block);
+    if (!fused)
+        throw std::runtime_error("Object does not support \"librealsense::fused_pointcloud\" interface! ");
+    fused->set_extrinsics(serial, *extrinsics);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, serial, extrinsics)
+
+static std::shared_ptr<librealsense::depth_postprocess> as_depth_postprocess(const rs2_processing_block* block)
+{
+    auto pp = std::dynamic_pointer_cast<librealsense::depth_postprocess>(block->block);
+    if (!pp)
+        throw std::runtime_error("Object does not support \"librealsense::depth_postprocess\" interface! ");
+    return pp;
+}
+
+rs2_processing_block* rs2_get_depth_postprocess_stage(rs2_processing_block* block, rs2_extension stage, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    VALIDATE_ENUM(stage);
+    return new rs2_processing_block{ as_depth_postprocess(block)->get_stage(stage) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, block, stage)
+
+void rs2_enable_depth_postprocess_stage(rs2_processing_block* block, rs2_extension stage, int enable, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    VALIDATE_ENUM(stage);
+    as_depth_postprocess(block)->enable_stage(stage, enable != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, stage, enable)
+
 rs2_processing_block* rs2_create_rates_printer_block(rs2_error** error) BEGIN_API_CALL
 {
     auto block = std::make_shared<librealsense::rates_printer>();
@@ -2814,6 +3388,29 @@ float rs2_depth_frame_get_distance(const rs2_frame* frame_ref, int x, int y, rs2
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref, x, y)
 
+void rs2_depth_frame_get_distances(const rs2_frame* frame_ref, const int* pixels, int count, float* distances, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame_ref);
+    auto df = VALIDATE_INTERFACE(((frame_interface*)frame_ref), librealsense::depth_frame);
+    VALIDATE_RANGE(count, 0, std::numeric_limits<int>::max());
+    if (!count)
+        return;
+    VALIDATE_NOT_NULL(pixels);
+    VALIDATE_NOT_NULL(distances);
+    df->get_distances(pixels, count, distances);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, frame_ref, pixels, count, distances)
+
+void rs2_depth_frame_get_all_distances(const rs2_frame* frame_ref, float* distances, int size, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame_ref);
+    VALIDATE_NOT_NULL(distances);
+    auto df = VALIDATE_INTERFACE(((frame_interface*)frame_ref), librealsense::depth_frame);
+    VALIDATE_RANGE(size, df->get_width() * df->get_height(), std::numeric_limits<int>::max());
+    df->get_distances(distances);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, frame_ref, distances, size)
+
 float rs2_depth_frame_get_units( const rs2_frame* frame_ref, rs2_error** error ) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL( frame_ref );
@@ -4073,6 +4670,20 @@ void rs2_deproject_pixel_to_point(float point[3], const struct rs2_intrinsics* i
 }
 NOEXCEPT_RETURN(, point)
 
+void rs2_project_points_to_pixels(float* pixels, const struct rs2_intrinsics* intrin, const float* points, int count) BEGIN_API_CALL
+{
+    if (count > 0)
+        librealsense::project_points_to_pixels(pixels, *intrin, points, count);
+}
+NOEXCEPT_RETURN(, pixels)
+
+void rs2_deproject_pixels_to_points(float* points, const struct rs2_intrinsics* intrin, const float* pixels, const float* depths, int count) BEGIN_API_CALL
+{
+    if (count > 0)
+        librealsense::deproject_pixels_to_points(points, *intrin, pixels, depths, count);
+}
+NOEXCEPT_RETURN(, points)
+
 void rs2_transform_point_to_point(float to_point[3], const struct rs2_extrinsics* extrin, const float from_point[3]) BEGIN_API_CALL
 {
     to_point[0] = extrin->rotation[0] * from_point[0] + extrin->rotation[3] * from_point[1] + extrin->rotation[6] * from_point[2] + extrin->translation[0];
@@ -4088,39 +4699,6 @@ void rs2_fov(const struct rs2_intrinsics* intrin, float to_fov[2]) BEGIN_API_CAL
 }
 NOEXCEPT_RETURN(, to_fov)
 
-/* Helper inner function (not part of the API) */
-void next_pixel_in_line(float curr[2], const float start[2], const float end[2])
-{
-    float line_slope = (end[1] - start[1]) / (end[0] - start[0]);
-    if (fabs(end[0] - curr[0]) > fabs(end[1] - curr[1]))
-    {
-        curr[0] = end[0] > curr[0] ? curr[0] + 1 : curr[0] - 1;
-        curr[1] = end[1] - line_slope * (end[0] - curr[0]);
-    }
-    else
-    {
-        curr[1] = end[1] > curr[1] ? curr[1] + 1 : curr[1] - 1;
-        curr[0] = end[0] - ((end[1] - curr[1]) / line_slope);
-    }
-}
-
-/* Helper inner function (not part of the API) */
-bool is_pixel_in_line(const float curr[2], const float start[2], const float end[2])
-{
-    return ((end[0] >= start[0] && end[0] >= curr[0] && curr[0] >= start[0]) || (end[0] <= start[0] && end[0] <= curr[0] && curr[0] <= start[0])) &&
-        ((end[1] >= start[1] && end[1] >= curr[1] && curr[1] >= start[1]) || (end[1] <= start[1] && end[1] <= curr[1] && curr[1] <= start[1]));
-}
-
-/* Helper inner function (not part of the API) */
-void adjust_2D_point_to_boundary(float p[2], int width, int height)
-{
-    if (p[0] < 0) p[0] = 0;
-    if (p[0] > width) p[0] = (float)width;
-    if (p[1] < 0) p[1] = 0;
-    if (p[1] > height) p[1] = (float)height;
-}
-
-
 void rs2_project_color_pixel_to_depth_pixel(float to_pixel[2],
     const uint16_t* data, float depth_scale,
     float depth_min, float depth_max,
@@ -4168,6 +4746,47 @@ void rs2_project_color_pixel_to_depth_pixel(float to_pixel[2],
 }
 NOEXCEPT_RETURN(, to_pixel)
 
+rs2_color_to_depth_projector* rs2_create_color_to_depth_projector(const struct rs2_intrinsics* depth_intrin,
+    const struct rs2_intrinsics* color_intrin,
+    const struct rs2_extrinsics* color_to_depth,
+    const struct rs2_extrinsics* depth_to_color, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(depth_intrin);
+    VALIDATE_NOT_NULL(color_intrin);
+    VALIDATE_NOT_NULL(color_to_depth);
+    VALIDATE_NOT_NULL(depth_to_color);
+    return new rs2_color_to_depth_projector{ std::make_shared<librealsense::color_to_depth_projector>(
+        *depth_intrin, *color_intrin, *color_to_depth, *depth_to_color) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, depth_intrin, color_intrin, color_to_depth, depth_to_color)
+
+void rs2_delete_color_to_depth_projector(rs2_color_to_depth_projector* projector) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(projector);
+    delete projector;
+}
+NOEXCEPT_RETURN(, projector)
+
+void rs2_project_color_pixels_to_depth_pixels(const rs2_color_to_depth_projector* projector,
+    float* to_pixels, const float* from_pixels, int count,
+    const uint16_t* data, float depth_scale, float depth_min, float depth_max, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(projector);
+    VALIDATE_NOT_NULL(data);
+    VALIDATE_RANGE(count, 0, std::numeric_limits<int>::max());
+    if (count)
+    {
+        VALIDATE_NOT_NULL(to_pixels);
+        VALIDATE_NOT_NULL(from_pixels);
+    }
+    for (int i = 0; i < count; ++i)
+    {
+        if (!projector->projector->project(to_pixels + 2 * i, from_pixels + 2 * i, data, depth_scale, depth_min, depth_max))
+            to_pixels[2 * i] = to_pixels[2 * i + 1] = -1;
+    }
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, projector, to_pixels, from_pixels, count, data, depth_scale, depth_min, depth_max)
+
 const rs2_raw_data_buffer* rs2_run_focal_length_calibration_cpp(rs2_device* device, rs2_frame_queue* left, rs2_frame_queue* right, float target_w, float target_h, 
     int adjust_both_sides, float* ratio, float* angle, rs2_update_progress_callback * progress_callback, rs2_error** error) BEGIN_API_CALL
 {
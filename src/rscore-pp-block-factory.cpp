@@ -7,6 +7,7 @@
 #include "proc/disparity-transform.h"
 #include "proc/hdr-merge.h"
 #include "proc/hole-filling-filter.h"
+#include "proc/rectify.h"
 #include "proc/sequence-id-filter.h"
 #include "proc/spatial-filter.h"
 #include "proc/temporal-filter.h"
@@ -45,6 +46,8 @@ rscore_pp_block_factory::create_pp_block( std::string const & name, rsutils::jso
         return std::make_shared< temporal_filter >();
     if( rsutils::string::nocase_equal( name, "Hole Filling Filter" ) )
         return std::make_shared< hole_filling_filter >();
+    if( rsutils::string::nocase_equal( name, "Rectify" ) )
+        return std::make_shared< rectify >();
 
     return {};
 }
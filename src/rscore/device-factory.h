@@ -50,6 +50,11 @@ public:
     // RS2_PRODUCT_LINE_... defines for possible values.
     //
     virtual std::vector< std::shared_ptr< device_info > > query_devices( unsigned mask ) const = 0;
+
+    // Called when a devices-changed callback is registered with the context: a factory that only starts watching for
+    // devices on demand should start now
+    //
+    virtual void on_callback_registered() {}
 };
 
 
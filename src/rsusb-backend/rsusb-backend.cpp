@@ -10,6 +10,8 @@
 #include "../usb/usb-enumerator.h"
 #include "../core/time-service.h"
 
+#include <rsutils/json.h>
+
 #include <chrono>
 #include <cctype> // std::tolower
 
@@ -19,6 +21,8 @@ namespace librealsense
     namespace platform
     {
         rs_backend::rs_backend()
+            : _usb_request_count( 2 )
+            , _inline_publish( false )
         {
 
         }
@@ -31,12 +35,23 @@ namespace librealsense
         std::shared_ptr<uvc_device> rs_backend::create_uvc_device(uvc_device_info info) const
         {
             LOG_DEBUG("Creating UVC Device from path: " << info.device_path.c_str());
-            auto dev = create_rsuvc_device(info);
+            auto dev = create_rsuvc_device(info, static_cast< uint8_t >( _usb_request_count.load() ), _inline_publish);
             if (!dev)
                 return nullptr;
             return std::make_shared<retry_controls_work_around>(dev);
         }
 
+        void rs_backend::apply_settings( rsutils::json const & settings )
+        {
+            int const count
+                = settings.nested( std::string( "rsusb-request-count", 19 ) ).default_value( _usb_request_count.load() );
+            if( count < 1 || count > backend_frames_archive::CAPACITY - 2 )
+                throw invalid_value_exception( "rsusb-request-count must be between 1 and "
+                                               + std::to_string( backend_frames_archive::CAPACITY - 2 ) );
+            _usb_request_count = count;
+            _inline_publish = settings.nested( std::string( "rsusb-inline-frames", 19 ) ).default_value( _inline_publish.load() );
+        }
+
         std::vector<uvc_device_info> rs_backend::query_uvc_devices() const {
             return query_uvc_devices_info();
         }
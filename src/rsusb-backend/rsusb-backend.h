@@ -6,6 +6,8 @@
 #include "../backend.h"
 #include "../platform/command-transfer.h"
 
+#include <atomic>
+
 namespace librealsense
 {
     namespace platform
@@ -27,6 +29,14 @@ namespace librealsense
             // Not supported
             std::shared_ptr<hid_device> create_hid_device(hid_device_info info) const override;
             std::vector<hid_device_info> query_hid_devices() const override;
+
+            void apply_settings( rsutils::json const & settings ) override;
+
+        private:
+            // Number of UVC transfers kept submitted ahead while streaming ("rsusb-request-count")
+            std::atomic< int > _usb_request_count;
+            // Frames are published from the USB completion context, skipping the publishing thread ("rsusb-inline-frames")
+            std::atomic< bool > _inline_publish;
         };
     }
 }
@@ -15,6 +15,12 @@
 #include "core/depth-frame.h"
 #include "core/stream-profile-interface.h"
 #include "core/frame-callback.h"
+#include "core/time-service.h"
+#include "latency-stats.h"
+#include "frame-trace.h"
+#include "environment.h"
+#include "core/video.h"
+#include "core/motion.h"
 #include "core/notification.h"
 #include <src/metadata-parser.h>
 
@@ -76,6 +82,17 @@ void log_callback_end( uint32_t fps,
         register_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL, std::make_shared<librealsense::md_time_of_arrival_parser>());
 
         register_info(RS2_CAMERA_INFO_NAME, name);
+
+        if( auto context = dev ? dev->get_context() : nullptr )
+        {
+            rsutils::json const & settings = context->get_settings();
+            _source.set_eager_metadata( settings.nested( std::string( "eager-metadata", 14 ) ).default_value( false ) );
+            auto const queue = settings.nested( std::string( "callback-queue", 14 ) );
+            if( auto const size = queue.nested( std::string( "size", 4 ) ).default_value( 0u ) )
+                _source.set_callback_queue(
+                    size,
+                    queue.nested( std::string( "drop", 4 ) ).default_value( std::string( "oldest" ) ) == "newest" );
+        }
     }
 
     const std::string& sensor_base::get_info(rs2_camera_info info) const
@@ -267,20 +284,17 @@ void log_callback_end( uint32_t fps,
         return *_owner;
     }
 
-    // TODO - make this method more efficient, using parralel computation, with SSE or CUDA, when available
-    std::vector<uint8_t> sensor_base::align_width_to_64(int width, int height, int bpp, uint8_t * pix) const
+    void sensor_base::align_width_to_64( int width, int height, int bpp, uint8_t const * pix, uint8_t * dst ) const
     {
         int factor = bpp >> 3;
         int bytes_in_width = width * factor;
         int actual_input_bytes_in_width = (((bytes_in_width / 64 ) + 1) * 64);
-        std::vector<uint8_t> pixels;
-        for (int j = 0; j < height; ++j)
+        for( int j = 0; j < height; ++j )
         {
-            int start_index = j * actual_input_bytes_in_width;
-            int end_index = (width * factor) + (j * actual_input_bytes_in_width);
-            pixels.insert(pixels.end(), pix + start_index, pix + end_index);
+            memcpy( dst, pix, bytes_in_width );
+            dst += bytes_in_width;
+            pix += actual_input_bytes_in_width;
         }
-        return pixels;
     }
 
     std::shared_ptr< frame >
@@ -409,6 +423,7 @@ void log_callback_end( uint32_t fps,
             auto interval = interval_j.get< uint32_t >();  // NOTE: can throw!
             _options_watcher.set_update_interval( std::chrono::milliseconds( interval ) );
         }
+        _prefetch_calibration = settings.nested( std::string( "calibration-prefetch", 20 ) ).default_value( false );
 
         // synthetic sensor and its raw sensor will share the formats and streams mapping
         auto& raw_fourcc_to_rs2_format_map = _raw_sensor->get_fourcc_to_rs2_format_map();
@@ -432,6 +447,7 @@ void log_callback_end( uint32_t fps,
         {
             LOG_ERROR("An error has occurred while stop_streaming()!");
         }
+        join_prefetch();
     }
 
     // Register the option to both raw sensor and synthetic sensor.
@@ -615,11 +631,67 @@ void log_callback_end( uint32_t fps,
         }
 
         set_active_streams(requests);
+
+        if( _prefetch_calibration )
+            prefetch_calibration( requests );
+    }
+
+    void synthetic_sensor::prefetch_calibration( const stream_profiles & profiles )
+    {
+        // The intrinsics of a profile, and its extrinsics to the other sensors, are computed from calibration tables
+        // that are read from the device (and parsed) the first time they are needed: usually by the first frames of
+        // the stream, on their way through align, pointcloud, etc. Reading them now, while the stream starts, takes
+        // that off the first frames. Whatever fails is left to fail again when it is actually needed.
+        join_prefetch();
+        _prefetch = std::thread(
+            [this, profiles]()
+            {
+                auto const started = std::chrono::steady_clock::now();
+                auto & graph = environment::get_instance().get_extrinsics_graph();
+                for( auto & profile : profiles )
+                {
+                    try
+                    {
+                        if( auto video = As< video_stream_profile_interface >( profile ) )
+                            video->get_intrinsics();
+                        else if( auto motion = As< motion_stream_profile_interface >( profile ) )
+                            motion->get_intrinsics();
+                    }
+                    catch( ... )
+                    {
+                    }
+                    for( size_t i = 0; _owner && i < _owner->get_sensors_count(); ++i )
+                    {
+                        try
+                        {
+                            auto const others = _owner->get_sensor( i ).get_stream_profiles();
+                            rs2_extrinsics extrinsics;
+                            if( ! others.empty() )
+                                graph.try_fetch_extrinsics( *profile, *others.front(), &extrinsics );
+                        }
+                        catch( ... )
+                        {
+                        }
+                    }
+                }
+                LOG_DEBUG( "Calibration of " << profiles.size() << " profile(s) of " << get_info( RS2_CAMERA_INFO_NAME )
+                                             << " prefetched in "
+                                             << std::chrono::duration_cast< std::chrono::milliseconds >(
+                                                    std::chrono::steady_clock::now() - started ).count()
+                                             << " ms" );
+            } );
+    }
+
+    void synthetic_sensor::join_prefetch()
+    {
+        if( _prefetch.joinable() )
+            _prefetch.join();
     }
 
     void synthetic_sensor::close()
     {
         std::lock_guard<std::mutex> lock(_synthetic_configure_lock);
+        join_prefetch();
         _raw_sensor->close();
 
         std::vector< std::shared_ptr< processing_block > > active_pbs = _formats_converter.get_active_converters();
@@ -637,8 +709,33 @@ void log_callback_end( uint32_t fps,
 
         // Set the post-processing callback as the user callback.
         // This callback might be modified by other object.
-        set_frames_callback(callback);
-        _formats_converter.set_frames_callback( callback );  // TODO duplicate?! Something fishy here!
+        // Frames are stamped on their way out, for the latency stats.
+        auto published = make_frame_callback(
+            [callback]( frame_interface * f )
+            {
+                if( auto fr = dynamic_cast< frame * >( f ) )
+                {
+                    auto const now = time_service::get_time();
+                    fr->additional_data.publish_time = now;
+                    if( auto profile = fr->get_stream() )
+                    {
+                        auto & stats = profile->get_stats();
+                        stats.arrival_to_publish.record( now - fr->additional_data.system_time );
+                        double exposed;
+                        if( stream_stats::exposure_midpoint( fr, exposed ) )
+                            stats.exposure_to_callback.record( now - exposed );
+                    }
+                }
+                if( callback )
+                {
+                    frame_trace::scope trace( "user callback", f );
+                    callback->on_frame( (rs2_frame *)f );
+                }
+                else if( f )
+                    f->release();
+            } );
+        set_frames_callback( published );
+        _formats_converter.set_frames_callback( published );  // TODO duplicate?! Something fishy here!
 
         // Call the processing block on the frame
         _raw_sensor->start(
@@ -22,6 +22,7 @@
 #include <limits.h>
 #include <atomic>
 #include <functional>
+#include <thread>
 
 
 namespace librealsense
@@ -79,6 +80,9 @@ namespace librealsense
             _on_open = callback;
         }
         virtual void set_frame_metadata_modifier(on_frame_md callback) { _metadata_modifier = callback; }
+        virtual void set_frame_allocator( rs2_frame_allocator_sptr allocator ) { _source.set_frame_allocator( allocator ); }
+        // See frame_source::set_callback_queue
+        virtual void set_callback_queue( size_t size, bool drop_newest ) { _source.set_callback_queue( size, drop_newest ); }
         device_interface& get_device() override;
 
         // Make sensor inherit its owning device info by default
@@ -132,7 +136,8 @@ namespace librealsense
             return width * height * bpp >> 3;
         }
 
-        std::vector<uint8_t> align_width_to_64(int width, int height, int bpp, uint8_t * pix) const;
+        // Copy rows from 'pix', where each is padded to a multiple of 64 bytes, into the packed 'dst'
+        void align_width_to_64( int width, int height, int bpp, uint8_t const * pix, uint8_t * dst ) const;
 
         std::atomic<bool> _is_streaming;
         std::atomic<bool> _is_opened;
@@ -158,6 +163,13 @@ namespace librealsense
     {
     public:
         virtual ~motion_sensor() = default;
+
+        // Copies up to 'max' of the recent samples of the stream with timestamps in [from, to], oldest first; returns
+        // how many were copied
+        virtual size_t get_motion_samples( rs2_stream, double from, double to, rs2_motion_sample *, size_t max ) const
+        {
+            return 0;
+        }
     };
 
     MAP_EXTENSION(RS2_EXTENSION_MOTION_SENSOR, librealsense::motion_sensor);
@@ -247,6 +259,10 @@ namespace librealsense
         int register_before_streaming_changes_callback(std::function<void(bool)> callback) override;
         void unregister_before_start_callback(int token) override;
         void register_metadata(rs2_frame_metadata_value metadata, std::shared_ptr<md_attribute_parser_base> metadata_parser) const override;
+        // Frames are allocated by the raw sensor
+        void set_frame_allocator( rs2_frame_allocator_sptr allocator ) override { _raw_sensor->set_frame_allocator( allocator ); }
+        // The raw sensor's frames are queued, so that format conversion also runs off the backend thread
+        void set_callback_queue( size_t size, bool drop_newest ) override { _raw_sensor->set_callback_queue( size, drop_newest ); }
         bool is_streaming() const override;
         bool is_opened() const override;
 
@@ -257,8 +273,13 @@ namespace librealsense
     private:
         void register_processing_block_options(const processing_block& pb);
         void unregister_processing_block_options(const processing_block& pb);
+        // Computes, on _prefetch, whatever the profiles compute lazily from the calibration; see open()
+        void prefetch_calibration(const stream_profiles& profiles);
+        void join_prefetch();
 
         std::mutex _synthetic_configure_lock;
+        bool _prefetch_calibration = false;
+        std::thread _prefetch;
 
         rs2_frame_callback_sptr _post_process_callback;
         std::shared_ptr<raw_sensor_base> _raw_sensor;
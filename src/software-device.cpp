@@ -8,11 +8,52 @@
 #include "core/notification.h"
 #include "stream.h"
 
+#include <mutex>
+#include <unordered_map>
+
 
 namespace librealsense
 {
+    class software_device::borrowed_buffers
+    {
+        std::mutex _mutex;
+        std::unordered_map< int, int > _outstanding;  // frame number -> frames not released yet
+        frameset_release_callback_ptr _callback;
+
+    public:
+        void set_callback( frameset_release_callback_ptr callback )
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            _callback = std::move( callback );
+        }
+
+        void borrow( int frame_number )
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            ++_outstanding[frame_number];
+        }
+
+        void release( int frame_number )
+        {
+            frameset_release_callback_ptr callback;
+            {
+                std::lock_guard< std::mutex > lock( _mutex );
+                auto it = _outstanding.find( frame_number );
+                if( it == _outstanding.end() || --it->second )
+                    return;
+                _outstanding.erase( it );
+                callback = _callback;
+            }
+            // Outside the lock: the user will likely inject the next frameset from here
+            if( callback )
+                callback->on_frameset_release( frame_number );
+        }
+    };
+
+
     software_device::software_device( std::shared_ptr< const device_info > const & dev_info )
         : device( dev_info, false )
+        , _borrowed_buffers( std::make_shared< borrowed_buffers >() )
     {
     }
 
@@ -52,6 +93,17 @@ namespace librealsense
         _user_destruction_callback = std::move(callback);
     }
 
+    void software_device::register_frameset_release_callback( frameset_release_callback_ptr callback )
+    {
+        _borrowed_buffers->set_callback( std::move( callback ) );
+    }
+
+    std::function< void() > software_device::borrow_buffer( int frame_number )
+    {
+        _borrowed_buffers->borrow( frame_number );
+        return [buffers = _borrowed_buffers, frame_number]() { buffers->release( frame_number ); };
+    }
+
     software_sensor& software_device::get_software_sensor( size_t index)
     {
         if (index >= _software_sensors.size())
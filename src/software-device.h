@@ -33,9 +33,20 @@ public:
     using destruction_callback_ptr = std::shared_ptr< rs2_software_device_destruction_callback >;
     void register_destruction_callback( destruction_callback_ptr );
 
+    using frameset_release_callback_ptr = std::shared_ptr< rs2_software_device_frameset_release_callback >;
+    void register_frameset_release_callback( frameset_release_callback_ptr );
+
+    // Frames injected without a deleter borrow their buffers from the user. They're counted per frame number, over all
+    // our sensors, so the user gets one notification per frameset when all its buffers can be reused. Returns what
+    // the frame should call on release.
+    std::function< void() > borrow_buffer( int frame_number );
+
 protected:
+    class borrowed_buffers;
+
     std::vector<std::shared_ptr<software_sensor>> _software_sensors;
     destruction_callback_ptr _user_destruction_callback;
+    std::shared_ptr< borrowed_buffers > _borrowed_buffers;  // shared with the frames, which may outlive us
     rs2_matchers _matcher = RS2_MATCHER_DEFAULT;
 };
 
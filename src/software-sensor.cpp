@@ -63,6 +63,7 @@ software_sensor::software_sensor( std::string const & name, software_device * ow
 
 software_sensor::~software_sensor()
 {
+    stop_unshared( _pbs );
 }
 
 
@@ -259,18 +260,29 @@ frame_interface * software_sensor::allocate_new_video_frame( video_stream_profil
 }
 
 
+std::function< void() > software_sensor::make_on_release( void ( *deleter )( void * ), void * data, int frame_number )
+{
+    if( deleter )
+        return [deleter, data]() { deleter( data ); };
+    // No deleter: the data is borrowed, and the device tells the user when the whole frameset is done with it
+    if( auto sd = dynamic_cast< software_device * >( _owner ) )
+        return sd->borrow_buffer( frame_number );
+    return []() {};
+}
+
+
 void software_sensor::invoke_new_frame( frame_holder && frame, void const * pixels, std::function< void() > on_release )
 {
     // The frame pixels/data are stored in the continuation object!
     if( pixels )
-        frame->attach_continuation( frame_continuation( on_release, pixels ) );
+        frame->attach_continuation( frame_continuation( std::move( on_release ), pixels ) );
     _source.invoke_callback( std::move( frame ) );
 }
 
 
 void software_sensor::on_video_frame( rs2_software_video_frame const & software_frame )
 {
-    deferred on_release( [deleter = software_frame.deleter, data = software_frame.pixels]() { deleter( data ); } );
+    deferred on_release( make_on_release( software_frame.deleter, software_frame.pixels, software_frame.frame_number ) );
 
     stream_profile_interface * profile = software_frame.profile->profile;
     auto vid_profile = dynamic_cast< video_stream_profile_interface * >( profile );
@@ -303,7 +315,7 @@ void software_sensor::on_video_frame( rs2_software_video_frame const & software_
 
 void software_sensor::on_motion_frame( rs2_software_motion_frame const & software_frame )
 {
-    deferred on_release( [deleter = software_frame.deleter, data = software_frame.data]() { deleter( data ); } );
+    deferred on_release( make_on_release( software_frame.deleter, software_frame.data, software_frame.frame_number ) );
     if( ! _is_streaming )
         return;
 
@@ -320,7 +332,7 @@ void software_sensor::on_motion_frame( rs2_software_motion_frame const & softwar
 
 void software_sensor::on_pose_frame( rs2_software_pose_frame const & software_frame )
 {
-    deferred on_release( [deleter = software_frame.deleter, data = software_frame.data]() { deleter( data ); } );
+    deferred on_release( make_on_release( software_frame.deleter, software_frame.data, software_frame.frame_number ) );
     if( ! _is_streaming )
         return;
 
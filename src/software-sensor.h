@@ -57,6 +57,7 @@ protected:
     frame_interface * allocate_new_frame( rs2_extension, stream_profile_interface *, frame_additional_data && );
     frame_interface * allocate_new_video_frame( video_stream_profile_interface *, int stride, int bpp, frame_additional_data && );
     void invoke_new_frame( frame_holder &&, void const * pixels, std::function< void() > on_release );
+    std::function< void() > make_on_release( void ( *deleter )( void * ), void * data, int frame_number );
 
     metadata_array _metadata_map;
 
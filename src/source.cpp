@@ -5,6 +5,7 @@
 
 #include <src/option.h>
 #include <src/core/frame-holder.h>
+#include <src/frame.h>
 #include <src/core/enum-helpers.h>
 
 #include <rsutils/string/from.h>
@@ -67,6 +68,24 @@ namespace librealsense
         _metadata_parsers = metadata_parsers;
     }
 
+    // Which frames go first when the frame memory budget runs short
+    static frame_memory_budget::priority get_memory_priority( rs2_stream stream, rs2_extension ex )
+    {
+        if( ex == RS2_EXTENSION_POINTS )
+            return frame_memory_budget::priority::low;
+        switch( stream )
+        {
+        case RS2_STREAM_DEPTH:
+        case RS2_STREAM_GYRO:
+        case RS2_STREAM_ACCEL:
+        case RS2_STREAM_MOTION:
+        case RS2_STREAM_POSE:
+            return frame_memory_budget::priority::high;
+        default:
+            return frame_memory_budget::priority::normal;
+        }
+    }
+
     std::map< frame_source::archive_id, std::shared_ptr< archive_interface > >::iterator
     frame_source::create_archive( archive_id id )
     {
@@ -77,11 +96,16 @@ namespace librealsense
         if( it == _supported_extensions.end() )
             throw wrong_api_call_sequence_exception( "Requested frame type is not supported!" );
 
-        auto ret = _archive.insert( { id, make_archive( ex, &_max_publish_list_size, _metadata_parsers ) } );
+        auto ret = _archive.insert( { id, make_archive( ex,
+                                                         &_max_publish_list_size,
+                                                         _metadata_parsers,
+                                                         get_memory_priority( std::get< rs2_stream >( id ), ex ) ) } );
         if( ! ret.second || ! ret.first->second ) // Check insertion success and allocation success
             throw std::runtime_error( rsutils::string::from() << "Failed to create archive of type " << get_string( ex ) );
 
         ret.first->second->set_sensor( _sensor );
+        if( _frame_allocator && ex != RS2_EXTENSION_COMPOSITE_FRAME )
+            ret.first->second->set_frame_allocator( _frame_allocator );
 
         return ret.first;
     }
@@ -113,7 +137,8 @@ namespace librealsense
     frame_interface * frame_source::alloc_frame( archive_id id,
                                                  size_t size,
                                                  frame_additional_data && additional_data,
-                                                 bool requires_memory )
+                                                 bool requires_memory,
+                                                 bool zero_fill )
     {
         // We use a special index for extensions, like GPU accelerated frames. See add_extension.
         if( std::get< rs2_extension>( id ) >= RS2_EXTENSION_COUNT )
@@ -125,7 +150,7 @@ namespace librealsense
         if( it == _archive.end() )
             it = create_archive( id );
 
-        return it->second->alloc_and_track( size, std::move( additional_data ), requires_memory );
+        return it->second->alloc_and_track( size, std::move( additional_data ), requires_memory, zero_fill );
     }
 
     void frame_source::set_sensor( const std::weak_ptr< sensor_interface > & s )
@@ -140,6 +165,18 @@ namespace librealsense
         }
     }
 
+    void frame_source::set_frame_allocator( rs2_frame_allocator_sptr allocator )
+    {
+        std::lock_guard< std::recursive_mutex > lock( _mutex );
+
+        _frame_allocator = allocator;
+        for( auto & a : _archive )
+        {
+            if( std::get< rs2_extension >( a.first ) != RS2_EXTENSION_COMPOSITE_FRAME )
+                a.second->set_frame_allocator( _frame_allocator );
+        }
+    }
+
     void frame_source::set_callback( rs2_frame_callback_sptr callback )
     {
         std::lock_guard< std::recursive_mutex > lock( _mutex );
@@ -152,7 +189,37 @@ namespace librealsense
         return _callback;
     }
 
+    void frame_source::set_callback_queue( size_t size, bool drop_newest )
+    {
+        std::shared_ptr< frame_callback_executor > previous;  // destroyed outside the lock
+        std::lock_guard< std::recursive_mutex > lock( _mutex );
+        previous = std::move( _callback_executor );
+        if( size )
+            _callback_executor = std::make_shared< frame_callback_executor >(
+                size, drop_newest, [this]( frame_holder && f ) { deliver( std::move( f ) ); } );
+    }
+
+    void frame_source::cancel_pending_callbacks() const
+    {
+        std::shared_ptr< frame_callback_executor > executor;
+        {
+            std::lock_guard< std::recursive_mutex > lock( _mutex );
+            executor = _callback_executor;
+        }
+        if( executor )
+            executor->cancel();
+    }
+
     void frame_source::invoke_callback(frame_holder frame) const
+    {
+        // The backend thread we're on is free again as soon as the frame is queued
+        if( auto executor = _callback_executor )
+            executor->enqueue( std::move( frame ) );
+        else
+            deliver( std::move( frame ) );
+    }
+
+    void frame_source::deliver( frame_holder frame ) const
     {
         if (frame && frame.frame && frame.frame->get_owner())
         {
@@ -160,6 +227,10 @@ namespace librealsense
             {
                 if (_callback)
                 {
+                    if (_eager_metadata)
+                        if (auto f = dynamic_cast<librealsense::frame*>(frame.frame))
+                            f->decode_metadata();
+
                     frame_interface* ref = nullptr;
                     std::swap(frame.frame, ref);
                     _callback->on_frame((rs2_frame*)ref);
@@ -178,6 +249,8 @@ namespace librealsense
 
     void frame_source::flush() const
     {
+        cancel_pending_callbacks();
+
         std::lock_guard< std::recursive_mutex > lock( _mutex );
 
         for( auto & kvp : _archive )
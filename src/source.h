@@ -6,6 +6,7 @@
 
 #include <librealsense2/hpp/rs_types.hpp>
 #include <src/frame-archive.h>
+#include <src/callback-executor.h>
 
 #include <tuple>
 
@@ -30,22 +31,39 @@ namespace librealsense
 
         std::shared_ptr< option > get_published_size_option();
 
+        // Pass 'zero_fill' false when the caller is going to overwrite the whole frame data, to save clearing it
         frame_interface * alloc_frame( archive_id id,
                                        size_t size,
                                        frame_additional_data && additional_data,
-                                       bool requires_memory );
+                                       bool requires_memory,
+                                       bool zero_fill = true );
 
         void set_callback( rs2_frame_callback_sptr callback );
         rs2_frame_callback_sptr get_callback() const;
 
         void invoke_callback( frame_holder frame ) const;
 
+        // Deliver frames to the callback from a queue of 'size' frames, on a thread of its own, instead of on the
+        // thread invoke_callback() is called from (see frame_callback_executor); 0 to go back to delivering directly
+        void set_callback_queue( size_t size, bool drop_newest );
+
+        // Drop the frames waiting in the callback queue, if any, and wait for the one being delivered
+        void cancel_pending_callbacks() const;
+
         void flush() const;
 
         virtual ~frame_source() { flush(); }
 
         void set_sensor( const std::weak_ptr< sensor_interface > & s );
 
+        // Frames that carry their payload (i.e., not composite frames) will get their memory from this allocator, if
+        // set; survives reset()
+        void set_frame_allocator( rs2_frame_allocator_sptr allocator );
+
+        // Decode all the metadata of every frame before it is dispatched, so later queries are table lookups (see
+        // frame::decode_metadata)
+        void set_eager_metadata( bool eager ) { _eager_metadata = eager; }
+
         template<class T>
         void add_extension( rs2_extension ex )
         {
@@ -68,6 +86,8 @@ namespace librealsense
         static rs2_extension stream_to_frame_types( rs2_stream stream );
 
     private:
+        void deliver( frame_holder frame ) const;
+
         friend class syncer_process_unit;
 
         std::map< archive_id, std::shared_ptr< archive_interface > >::iterator create_archive( archive_id id );
@@ -81,5 +101,8 @@ namespace librealsense
         rs2_frame_callback_sptr _callback;
         std::shared_ptr< metadata_parser_map > _metadata_parsers;
         std::weak_ptr< sensor_interface > _sensor;
+        rs2_frame_allocator_sptr _frame_allocator;
+        bool _eager_metadata = false;
+        std::shared_ptr< frame_callback_executor > _callback_executor;
     };
 }
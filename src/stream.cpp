@@ -2,6 +2,7 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
 #include "stream.h"
+#include "latency-stats.h"
 
 namespace librealsense
 {
@@ -97,6 +98,19 @@ namespace librealsense
     {
         _c_ptr = wrapper;
     }
+
+    stream_stats & stream_profile_base::get_stats() const
+    {
+        // Asked for with every frame: only the first takes the lock in stream_stats::get()
+        auto stats = _stats.load( std::memory_order_acquire );
+        if( ! stats )
+        {
+            stats = &stream_stats::get( _uid );
+            _stats.store( stats, std::memory_order_release );
+        }
+        return *stats;
+    }
+
     void stream_profile_base::create_snapshot(std::shared_ptr<stream_profile_interface>& snapshot) const
     {
         auto ptr = std::const_pointer_cast<stream_interface>(shared_from_this());
@@ -108,4 +122,3 @@ namespace librealsense
         throw not_implemented_exception(__FUNCTION__);
     }
 }
-
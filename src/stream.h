@@ -85,10 +85,13 @@ namespace librealsense
         void set_unique_id(int uid) override
         {
             _uid = uid;
+            _stats = nullptr;
         };
 
         rs2_stream_profile* get_c_wrapper() const override;
 
+        stream_stats & get_stats() const override;
+
         void set_c_wrapper(rs2_stream_profile* wrapper) override;
 
         void create_snapshot(std::shared_ptr<stream_profile_interface>& snapshot) const override;
@@ -103,6 +106,7 @@ namespace librealsense
         int _tag = profile_tag::PROFILE_TAG_ANY;
         rs2_stream_profile _c_wrapper;
         rs2_stream_profile* _c_ptr = nullptr;
+        mutable std::atomic< stream_stats * > _stats{ nullptr };  // of _uid, once it is first asked for
     };
 
     class video_stream_profile : public virtual video_stream_profile_interface, public stream_profile_base, public extension_snapshot
@@ -9,6 +9,7 @@
 #include "core/sensor-interface.h"
 #include "composite-frame.h"
 #include "core/time-service.h"
+#include "latency-stats.h"
 
 #include <rsutils/string/from.h>
 
@@ -155,6 +156,7 @@ namespace librealsense
              {
                  // If queues are overrun, we'll get here
                  LOG_DEBUG( "DROPPED frame " << fh );
+                 stream_stats::drop( fh.frame, RS2_FRAME_DROP_STAGE_SYNCER );
              } )
     {
     }
@@ -336,9 +338,15 @@ namespace librealsense
         // latest timestamp/frame-number/etc. that we can compare to.
         auto const last_arrived = f->get_header();
 
-        if( ! _frames_queue[matcher.get()].q.enqueue( std::move( f ) ) )
+        auto & queue = _frames_queue[matcher.get()];
+        if( ! queue.stats && ! dynamic_cast< composite_frame const * >( f.frame ) )
+            if( auto profile = f->get_stream() )
+                queue.stats = &profile->get_stats();
+        if( ! queue.q.enqueue( std::move( f ) ) )
             // If we get stopped, nothing to do!
             return;
+        if( queue.stats )
+            queue.stats->drops.queue_depth( RS2_FRAME_DROP_STAGE_SYNCER, queue.q.size(), QUEUE_MAX_SIZE );
 
         // We have a queue for each known stream we want to sync.
         // E.g., for (Depth Color), we need to sync two frames, one from each.
@@ -346,18 +354,22 @@ namespace librealsense
         // waited-for...
 
         std::vector< frame_holder * > frames_arrived;
-        std::vector< librealsense::matcher * > frames_arrived_matchers;
+        // Remember where each frame came from, so releasing it doesn't need another lookup
+        std::vector< matcher_queue * > frames_arrived_queues;
         std::vector< int > synced_frames;
         std::vector< int > unsynced_frames;
         std::vector< librealsense::matcher * > missing_streams;
+        // Reused for every frameset we release; the holders are moved out, so it only allocates the first time
+        std::vector< frame_holder > match;
+        frames_arrived.reserve( _frames_queue.size() );
+        frames_arrived_queues.reserve( _frames_queue.size() );
 
         while( true )
         {
             missing_streams.clear();
-            frames_arrived_matchers.clear();
+            frames_arrived_queues.clear();
             frames_arrived.clear();
-
-            std::vector< frame_holder > match;
+            match.clear();
             {
                 // We don't want to stop while syncing!
                 std::lock_guard< std::mutex > lock( _mutex );
@@ -370,7 +382,7 @@ namespace librealsense
                     if( ! s->second.q.peek( [&]( frame_holder & fh ) {
                             LOG_IF_ENABLE( "... have " << *fh.frame, env );
                             frames_arrived.push_back( &fh );
-                            frames_arrived_matchers.push_back( m );
+                            frames_arrived_queues.push_back( &s->second );
                         } ) )
                     {
                         missing_streams.push_back( m );
@@ -448,8 +460,7 @@ namespace librealsense
                 {
                     frame_holder frame;
                     int const timeout_ms = 5000;
-                    librealsense::matcher * m = frames_arrived_matchers[index];
-                    _frames_queue[m].q.dequeue( &frame, timeout_ms );
+                    frames_arrived_queues[index]->q.dequeue( &frame, timeout_ms );
                     match.push_back( std::move( frame ) );
                 }
             }
@@ -464,7 +475,7 @@ namespace librealsense
                        } );
 
 
-            frame_holder composite = env.source->allocate_composite_frame(std::move(match));
+            frame_holder composite = env.source->allocate_composite_frame( match.data(), match.size() );
             if (composite.frame)
             {
                 auto cb = begin_callback();
@@ -699,6 +710,18 @@ namespace librealsense
         rs2_time_t now = last_arrived.timestamp;
         if( now > next_expected.value )
         {
+            // The user may prefer latency over complete framesets: release without the missing stream, but without
+            // deactivating it -- it's still expected and will be waited for again once it shows up
+            if( env.max_latency_ms > 0 && now - next_expected.value >= env.max_latency_ms )
+            {
+                LOG_IF_ENABLE( "...     exceeded max latency of " << env.max_latency_ms << " ms; not waiting for it",
+                               env );
+                auto it = _frames_queue.find( missing );
+                if( it != _frames_queue.end() && it->second.stats )
+                    it->second.stats->drops.latency_cutoff();
+                return true;
+            }
+
             // Wait for the missing stream frame to arrive -- up to a cutout: anything more and we
             // let the frameset be ready without it...
             auto gap = 1000. / fps;
@@ -760,12 +783,8 @@ namespace librealsense
         // Syncer have to output composite frame 
         if (!composite)
         {
-            std::vector<frame_holder> match;
-            std::ostringstream frame_string_for_logging;
-            frame_string_for_logging << f; // Saving frame holder string before moving frame
-
-            match.push_back(std::move(f));
-            frame_holder composite = env.source->allocate_composite_frame(std::move(match));
+            auto const frame_number = f->get_frame_number();  // for logging, before we move the frame
+            frame_holder composite = env.source->allocate_composite_frame( &f, 1 );
             if (composite.frame)
             {
                 auto cb = begin_callback();
@@ -775,7 +794,7 @@ namespace librealsense
             else
             {
                 LOG_ERROR( "composite_identity_matcher: "
-                           << _name << " " << frame_string_for_logging.str()
+                           << _name << " #" << frame_number
                            << " faild to create composite_frame, user callback will not be called" );
             }
         }
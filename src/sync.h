@@ -12,26 +12,33 @@
 #include <mutex>
 #include <memory>
 #include <map>
+#include <string>
 
 
 namespace librealsense {
 
 
     class synthetic_source_interface;
+    struct stream_stats;
 
     struct syncronization_environment
     {
         syncronization_environment( synthetic_source_interface * source,
                                     single_consumer_frame_queue< frame_holder >& matches,
-                                    bool log )
+                                    bool log,
+                                    double max_latency_ms = 0 )
             : source( source )
             , matches( matches )
             , log( log )
+            , max_latency_ms( max_latency_ms )
         {
         }
         synthetic_source_interface * source;
         single_consumer_frame_queue< frame_holder > & matches;
         bool log = true;
+        // Don't wait for a missing stream more than this past its expected frame (0 = no limit); each frameset
+        // released without it is counted in its drop stats
+        double max_latency_ms = 0;
     };
 
     typedef int stream_id;
@@ -116,6 +123,7 @@ namespace librealsense {
         struct matcher_queue
         {
             single_consumer_frame_queue< frame_holder > q;
+            stream_stats * stats = nullptr;  // of the matcher's stream, once its first frame arrives
 
             matcher_queue();
         };
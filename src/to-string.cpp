@@ -4,17 +4,107 @@
 #include "core/options-registry.h"
 #include "core/enum-helpers.h"
 
-#include <rsutils/string/make-less-screamy.h>
 #include <cassert>
+#include <cstddef>
+#include <vector>
+
+
+// The names are worked out at compile time, as rsutils::string::make_less_screamy() would: "AUTO_EXPOSURE" becomes
+// "Auto Exposure". There is nothing to build when the library loads, nor the first time a name is asked for.
+namespace {
+
+
+constexpr void make_less_screamy( char * out, char const * screamy, size_t size )
+{
+    bool first = true;
+    for( size_t i = 0; i < size; ++i )
+    {
+        char ch = screamy[i];
+        if( ch == '_' )
+        {
+            ch = ' ';
+            first = true;
+        }
+        else
+        {
+            if( ! first && ch >= 'A' && ch <= 'Z' )
+                ch = char( ch - 'A' + 'a' );
+            first = false;
+        }
+        out[i] = ch;
+    }
+}
+
+
+template< size_t N >
+class less_screamy
+{
+public:
+    constexpr less_screamy( char const ( &screamy )[N] )
+        : _str{}
+    {
+        make_less_screamy( _str, screamy, N );
+    }
+
+    constexpr char const * c_str() const { return _str; }
+
+private:
+    char _str[N];
+};
+
+
+// The names of an enumeration's values [0, COUNT), by value; empty for values with no name
+template< size_t COUNT >
+class name_table
+{
+public:
+    static constexpr size_t max_length = 47;
+
+    constexpr name_table()
+        : _names{}
+    {
+    }
+
+    template< size_t N >
+    constexpr void set( size_t value, char const ( &screamy )[N] )
+    {
+        static_assert( N <= max_length + 1, "name too long for the table" );
+        make_less_screamy( _names[value], screamy, N );
+    }
+
+    template< size_t N >
+    constexpr void set_as_is( size_t value, char const ( &name )[N] )
+    {
+        static_assert( N <= max_length + 1, "name too long for the table" );
+        for( size_t i = 0; i < N; ++i )
+            _names[value][i] = name[i];
+    }
+
+    constexpr char const * operator[]( size_t value ) const { return _names[value]; }
+
+    // For the functions that return names as std::string: made once, from the table
+    std::vector< std::string > to_strings() const
+    {
+        std::vector< std::string > strings( COUNT );
+        for( size_t i = 0; i < COUNT; ++i )
+            strings[i] = _names[i];
+        return strings;
+    }
+
+private:
+    char _names[COUNT][max_length + 1];
+};
+
+
+}  // namespace
 
 
-#define STRX( X ) rsutils::string::make_less_screamy( #X )
 #define STRCASE( T, X )                                                                                                \
     case RS2_##T##_##X: {                                                                                              \
-        static const std::string s##T##_##X##_str = STRX( X );                                                         \
+        static constexpr less_screamy< sizeof( #X ) > s##T##_##X##_str( #X );                                          \
         return s##T##_##X##_str.c_str();                                                                               \
     }
-#define STRARR( ARRAY, T, X ) ARRAY[RS2_##T##_##X] = STRX( X )
+#define STRARR( TABLE, T, X ) TABLE.set( RS2_##T##_##X, #X )
 
 
 static std::string const unknown_value_str( librealsense::UNKNOWN_VALUE );
@@ -336,6 +426,21 @@ const char * get_string( rs2_playback_status value )
 #undef CASE
 }
 
+const char * get_string( rs2_record_queue_policy value )
+{
+#define CASE( X ) STRCASE( RECORD_QUEUE_POLICY, X )
+    switch( value )
+    {
+    CASE( DROP_OLDEST )
+    CASE( DROP_NEWEST )
+    CASE( BLOCK )
+    default:
+        assert( ! is_valid( value ) );
+        return UNKNOWN_VALUE;
+    }
+#undef CASE
+}
+
 const char * get_string( rs2_log_severity value )
 {
 #define CASE( X ) STRCASE( LOG_SEVERITY, X )
@@ -354,114 +459,142 @@ const char * get_string( rs2_log_severity value )
 #undef CASE
 }
 
+static constexpr name_table< RS2_OPTION_COUNT > make_option_names()
+{
+    name_table< RS2_OPTION_COUNT > names;
+#define CASE( X ) STRARR( names, OPTION, X );
+    CASE( BACKLIGHT_COMPENSATION )
+    CASE( BRIGHTNESS )
+    CASE( CONTRAST )
+    CASE( EXPOSURE )
+    CASE( GAIN )
+    CASE( GAMMA )
+    CASE( HUE )
+    CASE( SATURATION )
+    CASE( SHARPNESS )
+    CASE( WHITE_BALANCE )
+    CASE( ENABLE_AUTO_EXPOSURE )
+    CASE( ENABLE_AUTO_WHITE_BALANCE )
+    CASE( LASER_POWER )
+    CASE( ACCURACY )
+    CASE( MOTION_RANGE )
+    CASE( FILTER_OPTION )
+    CASE( CONFIDENCE_THRESHOLD )
+    CASE( FRAMES_QUEUE_SIZE )
+    CASE( VISUAL_PRESET )
+    CASE( TOTAL_FRAME_DROPS )
+    CASE( EMITTER_ENABLED )
+    names.set_as_is( RS2_OPTION_AUTO_EXPOSURE_MODE, "Fisheye Auto Exposure Mode" );
+    CASE( POWER_LINE_FREQUENCY )
+    CASE( ASIC_TEMPERATURE )
+    CASE( ERROR_POLLING_ENABLED )
+    CASE( PROJECTOR_TEMPERATURE )
+    CASE( OUTPUT_TRIGGER_ENABLED )
+    CASE( MOTION_MODULE_TEMPERATURE )
+    CASE( DEPTH_UNITS )
+    CASE( ENABLE_MOTION_CORRECTION )
+    CASE( AUTO_EXPOSURE_PRIORITY )
+    CASE( HISTOGRAM_EQUALIZATION_ENABLED )
+    CASE( MIN_DISTANCE )
+    CASE( MAX_DISTANCE )
+    CASE( COLOR_SCHEME )
+    CASE( TEXTURE_SOURCE )
+    CASE( FILTER_MAGNITUDE )
+    CASE( FILTER_SMOOTH_ALPHA )
+    CASE( FILTER_SMOOTH_DELTA )
+    CASE( STEREO_BASELINE )
+    CASE( HOLES_FILL )
+    CASE( AUTO_EXPOSURE_CONVERGE_STEP )
+    CASE( INTER_CAM_SYNC_MODE )
+    CASE( STREAM_FILTER )
+    CASE( STREAM_FORMAT_FILTER )
+    CASE( STREAM_INDEX_FILTER )
+    CASE( EMITTER_ON_OFF )
+    CASE( ZERO_ORDER_POINT_X )
+    CASE( ZERO_ORDER_POINT_Y )
+    names.set_as_is( RS2_OPTION_LLD_TEMPERATURE, "LDD temperature" );
+    CASE( MC_TEMPERATURE )
+    CASE( MA_TEMPERATURE )
+    CASE( APD_TEMPERATURE )
+    CASE( HARDWARE_PRESET )
+    CASE( GLOBAL_TIME_ENABLED )
+    CASE( ENABLE_MAPPING )
+    CASE( ENABLE_RELOCALIZATION )
+    CASE( ENABLE_POSE_JUMPING )
+    CASE( ENABLE_DYNAMIC_CALIBRATION )
+    CASE( DEPTH_OFFSET )
+    CASE( LED_POWER )
+    CASE( ZERO_ORDER_ENABLED )
+    CASE( ENABLE_MAP_PRESERVATION )
+    CASE( FREEFALL_DETECTION_ENABLED )
+    names.set_as_is( RS2_OPTION_AVALANCHE_PHOTO_DIODE, "Receiver Gain" );
+    CASE( POST_PROCESSING_SHARPENING )
+    CASE( PRE_PROCESSING_SHARPENING )
+    CASE( NOISE_FILTERING )
+    CASE( INVALIDATION_BYPASS )
+    // CASE(AMBIENT_LIGHT) // Deprecated - replaced by "DIGITAL_GAIN" option
+    CASE( DIGITAL_GAIN )
+    CASE( SENSOR_MODE )
+    CASE( EMITTER_ALWAYS_ON )
+    CASE( THERMAL_COMPENSATION )
+    CASE( TRIGGER_CAMERA_ACCURACY_HEALTH )
+    CASE( RESET_CAMERA_ACCURACY_HEALTH )
+    CASE( HOST_PERFORMANCE )
+    CASE( HDR_ENABLED )
+    CASE( SEQUENCE_NAME )
+    CASE( SEQUENCE_SIZE )
+    CASE( SEQUENCE_ID )
+    CASE( HUMIDITY_TEMPERATURE )
+    CASE( ENABLE_MAX_USABLE_RANGE )
+    names.set_as_is( RS2_OPTION_ALTERNATE_IR, "Alternate IR" );
+    CASE( NOISE_ESTIMATION )
+    names.set_as_is( RS2_OPTION_ENABLE_IR_REFLECTIVITY, "Enable IR Reflectivity" );
+    CASE( AUTO_EXPOSURE_LIMIT )
+    CASE( AUTO_GAIN_LIMIT )
+    CASE( AUTO_RX_SENSITIVITY )
+    CASE( TRANSMITTER_FREQUENCY )
+    CASE( VERTICAL_BINNING )
+    CASE( RECEIVER_SENSITIVITY )
+    CASE( AUTO_EXPOSURE_LIMIT_TOGGLE )
+    CASE( AUTO_GAIN_LIMIT_TOGGLE )
+    CASE( EMITTER_FREQUENCY )
+    names.set_as_is( RS2_OPTION_DEPTH_AUTO_EXPOSURE_MODE, "Auto Exposure Mode" );
+    CASE( OHM_TEMPERATURE )
+    CASE( SOC_PVT_TEMPERATURE )
+    CASE( GYRO_SENSITIVITY )
+    CASE( PROCESSING_THREADS )
+    CASE( OUTPUT_FORMAT )
+    CASE( VALID_POINTS_ONLY )
+    CASE( MAX_LATENCY )
+    CASE( PROCESSING_STATS )
+    CASE( SYNC_BATCH_WINDOW )
+    CASE( ASYNC_PROCESSING )
+    CASE( IN_PLACE_PROCESSING )
+    CASE( ROI_MIN_X )
+    CASE( ROI_MIN_Y )
+    CASE( ROI_MAX_X )
+    CASE( ROI_MAX_Y )
+    CASE( MOTION_BATCH_SIZE )
+    CASE( SHARE_RESULTS )
+    CASE( VOXEL_SIZE )
+    CASE( FIXED_POINT_DISPARITY )
+    CASE( ADAPTIVE_DECIMATION )
+#undef CASE
+    return names;
+}
+
+static constexpr auto option_names = make_option_names();
+
+char const * get_builtin_option_name( rs2_option const option )
+{
+    if( option >= 0 && option < RS2_OPTION_COUNT )
+        return option_names[option];
+    return UNKNOWN_VALUE;
+}
+
 std::string const & get_string_( rs2_option value )
 {
-    static auto str_array = []()
-    {
-        std::vector< std::string > arr( RS2_OPTION_COUNT );
-#define CASE( X ) STRARR( arr, OPTION, X );
-        CASE( BACKLIGHT_COMPENSATION )
-        CASE( BRIGHTNESS )
-        CASE( CONTRAST )
-        CASE( EXPOSURE )
-        CASE( GAIN )
-        CASE( GAMMA )
-        CASE( HUE )
-        CASE( SATURATION )
-        CASE( SHARPNESS )
-        CASE( WHITE_BALANCE )
-        CASE( ENABLE_AUTO_EXPOSURE )
-        CASE( ENABLE_AUTO_WHITE_BALANCE )
-        CASE( LASER_POWER )
-        CASE( ACCURACY )
-        CASE( MOTION_RANGE )
-        CASE( FILTER_OPTION )
-        CASE( CONFIDENCE_THRESHOLD )
-        CASE( FRAMES_QUEUE_SIZE )
-        CASE( VISUAL_PRESET )
-        CASE( TOTAL_FRAME_DROPS )
-        CASE( EMITTER_ENABLED )
-        arr[RS2_OPTION_AUTO_EXPOSURE_MODE] = "Fisheye Auto Exposure Mode";
-        CASE( POWER_LINE_FREQUENCY )
-        CASE( ASIC_TEMPERATURE )
-        CASE( ERROR_POLLING_ENABLED )
-        CASE( PROJECTOR_TEMPERATURE )
-        CASE( OUTPUT_TRIGGER_ENABLED )
-        CASE( MOTION_MODULE_TEMPERATURE )
-        CASE( DEPTH_UNITS )
-        CASE( ENABLE_MOTION_CORRECTION )
-        CASE( AUTO_EXPOSURE_PRIORITY )
-        CASE( HISTOGRAM_EQUALIZATION_ENABLED )
-        CASE( MIN_DISTANCE )
-        CASE( MAX_DISTANCE )
-        CASE( COLOR_SCHEME )
-        CASE( TEXTURE_SOURCE )
-        CASE( FILTER_MAGNITUDE )
-        CASE( FILTER_SMOOTH_ALPHA )
-        CASE( FILTER_SMOOTH_DELTA )
-        CASE( STEREO_BASELINE )
-        CASE( HOLES_FILL )
-        CASE( AUTO_EXPOSURE_CONVERGE_STEP )
-        CASE( INTER_CAM_SYNC_MODE )
-        CASE( STREAM_FILTER )
-        CASE( STREAM_FORMAT_FILTER )
-        CASE( STREAM_INDEX_FILTER )
-        CASE( EMITTER_ON_OFF )
-        CASE( ZERO_ORDER_POINT_X )
-        CASE( ZERO_ORDER_POINT_Y )
-        arr[RS2_OPTION_LLD_TEMPERATURE] = "LDD temperature";
-        CASE( MC_TEMPERATURE )
-        CASE( MA_TEMPERATURE )
-        CASE( APD_TEMPERATURE )
-        CASE( HARDWARE_PRESET )
-        CASE( GLOBAL_TIME_ENABLED )
-        CASE( ENABLE_MAPPING )
-        CASE( ENABLE_RELOCALIZATION )
-        CASE( ENABLE_POSE_JUMPING )
-        CASE( ENABLE_DYNAMIC_CALIBRATION )
-        CASE( DEPTH_OFFSET )
-        CASE( LED_POWER )
-        CASE( ZERO_ORDER_ENABLED )
-        CASE( ENABLE_MAP_PRESERVATION )
-        CASE( FREEFALL_DETECTION_ENABLED )
-        arr[RS2_OPTION_AVALANCHE_PHOTO_DIODE] = "Receiver Gain";
-        CASE( POST_PROCESSING_SHARPENING )
-        CASE( PRE_PROCESSING_SHARPENING )
-        CASE( NOISE_FILTERING )
-        CASE( INVALIDATION_BYPASS )
-        // CASE(AMBIENT_LIGHT) // Deprecated - replaced by "DIGITAL_GAIN" option
-        CASE( DIGITAL_GAIN )
-        CASE( SENSOR_MODE )
-        CASE( EMITTER_ALWAYS_ON )
-        CASE( THERMAL_COMPENSATION )
-        CASE( TRIGGER_CAMERA_ACCURACY_HEALTH )
-        CASE( RESET_CAMERA_ACCURACY_HEALTH )
-        CASE( HOST_PERFORMANCE )
-        CASE( HDR_ENABLED )
-        CASE( SEQUENCE_NAME )
-        CASE( SEQUENCE_SIZE )
-        CASE( SEQUENCE_ID )
-        CASE( HUMIDITY_TEMPERATURE )
-        CASE( ENABLE_MAX_USABLE_RANGE )
-        arr[RS2_OPTION_ALTERNATE_IR] = "Alternate IR";
-        CASE( NOISE_ESTIMATION )
-        arr[RS2_OPTION_ENABLE_IR_REFLECTIVITY] = "Enable IR Reflectivity";
-        CASE( AUTO_EXPOSURE_LIMIT )
-        CASE( AUTO_GAIN_LIMIT )
-        CASE( AUTO_RX_SENSITIVITY )
-        CASE( TRANSMITTER_FREQUENCY )
-        CASE( VERTICAL_BINNING )
-        CASE( RECEIVER_SENSITIVITY )
-        CASE( AUTO_EXPOSURE_LIMIT_TOGGLE )
-        CASE( AUTO_GAIN_LIMIT_TOGGLE )
-        CASE( EMITTER_FREQUENCY )
-        arr[RS2_OPTION_DEPTH_AUTO_EXPOSURE_MODE] = "Auto Exposure Mode";
-        CASE( OHM_TEMPERATURE )
-        CASE( SOC_PVT_TEMPERATURE )
-        CASE( GYRO_SENSITIVITY )
-#undef CASE
-        return arr;
-    }();
+    static auto const str_array = option_names.to_strings();
     if( value >= 0 && value < RS2_OPTION_COUNT )
         return str_array[value];
     return unknown_value_str;
@@ -543,6 +676,8 @@ const char * get_string( rs2_format value )
     CASE( Y411 )
     CASE( Y16I )
     CASE( M420 )
+    CASE( XYZ16 )
+    CASE( MOTION_BATCH )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -588,6 +723,8 @@ const char * get_string( rs2_camera_info value )
     CASE( FIRMWARE_UPDATE_ID )
     CASE( IP_ADDRESS )
     CASE( DFU_DEVICE_PATH )
+    CASE( PROCESSING_STATS )
+    CASE( STREAM_STATS )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -595,58 +732,62 @@ const char * get_string( rs2_camera_info value )
 #undef CASE
 }
 
+static constexpr name_table< RS2_FRAME_METADATA_COUNT > make_metadata_names()
+{
+    name_table< RS2_FRAME_METADATA_COUNT > names;
+#define CASE( X ) STRARR( names, FRAME_METADATA, X );
+    CASE( FRAME_COUNTER )
+    CASE( FRAME_TIMESTAMP )
+    CASE( SENSOR_TIMESTAMP )
+    CASE( ACTUAL_EXPOSURE )
+    CASE( GAIN_LEVEL )
+    CASE( AUTO_EXPOSURE )
+    CASE( WHITE_BALANCE )
+    CASE( TIME_OF_ARRIVAL )
+    CASE( TEMPERATURE )
+    CASE( BACKEND_TIMESTAMP )
+    CASE( ACTUAL_FPS )
+    CASE( FRAME_LASER_POWER )
+    CASE( FRAME_LASER_POWER_MODE )
+    CASE( EXPOSURE_PRIORITY )
+    CASE( EXPOSURE_ROI_LEFT )
+    CASE( EXPOSURE_ROI_RIGHT )
+    CASE( EXPOSURE_ROI_TOP )
+    CASE( EXPOSURE_ROI_BOTTOM )
+    CASE( BRIGHTNESS )
+    CASE( CONTRAST )
+    CASE( SATURATION )
+    CASE( SHARPNESS )
+    CASE( AUTO_WHITE_BALANCE_TEMPERATURE )
+    CASE( BACKLIGHT_COMPENSATION )
+    CASE( GAMMA )
+    CASE( HUE )
+    CASE( MANUAL_WHITE_BALANCE )
+    CASE( POWER_LINE_FREQUENCY )
+    CASE( LOW_LIGHT_COMPENSATION )
+    CASE( FRAME_EMITTER_MODE )
+    CASE( FRAME_LED_POWER )
+    CASE( RAW_FRAME_SIZE )
+    CASE( GPIO_INPUT_DATA )
+    CASE( SEQUENCE_NAME )
+    CASE( SEQUENCE_ID )
+    CASE( SEQUENCE_SIZE )
+    CASE( TRIGGER )
+    CASE( PRESET )
+    CASE( INPUT_WIDTH )
+    CASE( INPUT_HEIGHT )
+    CASE( SUB_PRESET_INFO )
+    CASE( CALIB_INFO )
+    CASE( CRC )
+#undef CASE
+    return names;
+}
+
+static constexpr auto metadata_names = make_metadata_names();
+
 std::string const & get_string( rs2_frame_metadata_value value )
 {
-    static auto str_array = []()
-    {
-        std::vector< std::string > arr( RS2_FRAME_METADATA_COUNT );
-#define CASE( X ) STRARR( arr, FRAME_METADATA, X );
-        CASE( FRAME_COUNTER )
-        CASE( FRAME_TIMESTAMP )
-        CASE( SENSOR_TIMESTAMP )
-        CASE( ACTUAL_EXPOSURE )
-        CASE( GAIN_LEVEL )
-        CASE( AUTO_EXPOSURE )
-        CASE( WHITE_BALANCE )
-        CASE( TIME_OF_ARRIVAL )
-        CASE( TEMPERATURE )
-        CASE( BACKEND_TIMESTAMP )
-        CASE( ACTUAL_FPS )
-        CASE( FRAME_LASER_POWER )
-        CASE( FRAME_LASER_POWER_MODE )
-        CASE( EXPOSURE_PRIORITY )
-        CASE( EXPOSURE_ROI_LEFT )
-        CASE( EXPOSURE_ROI_RIGHT )
-        CASE( EXPOSURE_ROI_TOP )
-        CASE( EXPOSURE_ROI_BOTTOM )
-        CASE( BRIGHTNESS )
-        CASE( CONTRAST )
-        CASE( SATURATION )
-        CASE( SHARPNESS )
-        CASE( AUTO_WHITE_BALANCE_TEMPERATURE )
-        CASE( BACKLIGHT_COMPENSATION )
-        CASE( GAMMA )
-        CASE( HUE )
-        CASE( MANUAL_WHITE_BALANCE )
-        CASE( POWER_LINE_FREQUENCY )
-        CASE( LOW_LIGHT_COMPENSATION )
-        CASE( FRAME_EMITTER_MODE )
-        CASE( FRAME_LED_POWER )
-        CASE( RAW_FRAME_SIZE )
-        CASE( GPIO_INPUT_DATA )
-        CASE( SEQUENCE_NAME )
-        CASE( SEQUENCE_ID )
-        CASE( SEQUENCE_SIZE )
-        CASE( TRIGGER )
-        CASE( PRESET )
-        CASE( INPUT_WIDTH )
-        CASE( INPUT_HEIGHT )
-        CASE( SUB_PRESET_INFO )
-        CASE( CALIB_INFO )
-        CASE( CRC )
-#undef CASE
-            return arr;
-    }();
+    static auto const str_array = metadata_names.to_strings();
     if( ! is_valid( value ) )
         return unknown_value_str;
     return str_array[value];
@@ -682,6 +823,26 @@ const char * get_string( rs2_calib_target_type value )
 #undef CASE
 }
 
+const char * get_string( rs2_frame_drop_stage value )
+{
+#define CASE( X ) STRCASE( FRAME_DROP_STAGE, X )
+    switch( value )
+    {
+    CASE( BACKEND )
+    CASE( ARCHIVE )
+    CASE( SYNCER_INBOX )
+    CASE( SYNCER )
+    CASE( FRAME_QUEUE )
+    CASE( CALLBACK_QUEUE )
+    CASE( RECORDER )
+    CASE( METADATA_SYNC )
+    default:
+        assert( ! is_valid( value ) );
+        return UNKNOWN_VALUE;
+    }
+#undef CASE
+}
+
 const char * get_string( rs2_notification_category value )
 {
 #define CASE( X ) STRCASE( NOTIFICATION_CATEGORY, X )
@@ -742,19 +903,23 @@ const char * get_string( rs2_l500_visual_preset value )
 }
 
 
-std::string const & get_string( rs2_option_type value )
+static constexpr name_table< RS2_OPTION_TYPE_COUNT > make_option_type_names()
 {
-    static auto str_array = []()
-    {
-        std::vector< std::string > arr( RS2_OPTION_TYPE_COUNT );
-#define CASE( X ) STRARR( arr, OPTION_TYPE, X );
-        CASE( FLOAT )
-        CASE( STRING )
-        CASE( INTEGER )
-        CASE( BOOLEAN )
+    name_table< RS2_OPTION_TYPE_COUNT > names;
+#define CASE( X ) STRARR( names, OPTION_TYPE, X );
+    CASE( FLOAT )
+    CASE( STRING )
+    CASE( INTEGER )
+    CASE( BOOLEAN )
 #undef CASE
-            return arr;
-    }();
+    return names;
+}
+
+static constexpr auto option_type_names = make_option_type_names();
+
+std::string const & get_string( rs2_option_type value )
+{
+    static auto const str_array = option_type_names.to_strings();
     if( ! is_valid( value ) )
         return unknown_value_str;
     return str_array[value];
@@ -769,6 +934,9 @@ const char * rs2_distortion_to_string( rs2_distortion distortion ) { return libr
 
 const char * rs2_option_to_string( rs2_option option )
 {
+    // Built-in names come straight from the table; registered options are negative
+    if( option >= 0 && option < RS2_OPTION_COUNT )
+        return librealsense::get_builtin_option_name( option );
     return librealsense::get_string( option ).c_str();
 }
 
@@ -788,8 +956,10 @@ const char * rs2_sr300_visual_preset_to_string( rs2_sr300_visual_preset preset )
 const char * rs2_log_severity_to_string( rs2_log_severity severity ) { return librealsense::get_string( severity ); }
 const char * rs2_exception_type_to_string( rs2_exception_type type ) { return librealsense::get_string( type ); }
 const char * rs2_playback_status_to_string( rs2_playback_status status ) { return librealsense::get_string( status ); }
+const char * rs2_record_queue_policy_to_string( rs2_record_queue_policy policy ) { return librealsense::get_string( policy ); }
 const char * rs2_extension_type_to_string( rs2_extension type ) { return librealsense::get_string( type ); }
 const char * rs2_matchers_to_string( rs2_matchers matcher ) { return librealsense::get_string( matcher ); }
+const char * rs2_frame_drop_stage_to_string( rs2_frame_drop_stage stage ) { return librealsense::get_string( stage ); }
 const char * rs2_frame_metadata_to_string( rs2_frame_metadata_value metadata ) { return librealsense::get_string( metadata ).c_str(); }
 const char * rs2_extension_to_string( rs2_extension type ) { return rs2_extension_type_to_string( type ); }
 const char * rs2_frame_metadata_value_to_string( rs2_frame_metadata_value metadata ) { return rs2_frame_metadata_to_string( metadata ); }
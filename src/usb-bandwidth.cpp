@@ -0,0 +1,225 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "usb-bandwidth.h"
+#include "image.h"
+#include "stream.h"
+#include "core/device-interface.h"
+#include "platform/platform-device-info.h"
+
+#include <rsutils/json.h>
+
+#include <cctype>
+#include <limits>
+#include <map>
+#include <mutex>
+
+
+namespace librealsense {
+namespace usb_bandwidth {
+
+
+namespace {
+
+
+struct location
+{
+    std::string bus;
+    platform::usb_spec spec = platform::usb_undefined;
+};
+
+
+struct reservation
+{
+    device_interface const * owner;  // only compared, never dereferenced
+    location where;
+    double rate;
+};
+
+
+struct registry
+{
+    std::mutex mutex;
+    std::map< void const *, reservation > reservations;
+    // Nominal payload: what's left of the signalling rate after protocol overhead, roughly
+    double usb2_capacity = 40e6;   // of 480 Mbps
+    double usb3_capacity = 400e6;  // of 5 Gbps
+};
+
+
+registry & get_registry()
+{
+    static registry the_registry;
+    return the_registry;
+}
+
+
+bool is_usb2( platform::usb_spec spec )
+{
+    return spec != platform::usb_undefined && spec < platform::usb3_type;
+}
+
+
+// Where a device is, from the first UVC device of its group; false if it has none (not a backend USB device)
+bool locate( device_interface const & dev, location & where )
+{
+    auto info = std::dynamic_pointer_cast< const platform::platform_device_info >( dev.get_device_info() );
+    if( ! info || info->get_group().uvc_devices.empty() )
+        return false;
+    auto const & uvc = info->get_group().uvc_devices.front();
+    where.bus = get_bus( uvc.device_path );
+    where.spec = uvc.conn_spec;
+    return true;
+}
+
+
+double capacity_of( registry const & r, platform::usb_spec spec )
+{
+    return is_usb2( spec ) ? r.usb2_capacity : r.usb3_capacity;
+}
+
+
+}  // namespace
+
+
+double get_payload_rate( rs2_format format, uint32_t width, uint32_t height, uint32_t fps )
+{
+    switch( format )
+    {
+    case RS2_FORMAT_ANY:
+    case RS2_FORMAT_MJPEG:
+    case RS2_FORMAT_Z16H:
+    case RS2_FORMAT_MOTION_RAW:
+    case RS2_FORMAT_MOTION_XYZ32F:
+    case RS2_FORMAT_GPIO_RAW:
+    case RS2_FORMAT_6DOF:
+    case RS2_FORMAT_COMBINED_MOTION:
+        return 0;
+    default:
+        break;
+    }
+    int bpp;
+    try
+    {
+        bpp = get_image_bpp( format );
+    }
+    catch( ... )
+    {
+        return 0;
+    }
+    return double( width ) * height * bpp / 8 * fps;
+}
+
+
+double get_payload_rate( stream_profile_interface const & profile )
+{
+    auto video = dynamic_cast< video_stream_profile_interface const * >( &profile );
+    if( ! video )
+        return 0;
+    return get_payload_rate( profile.get_format(), video->get_width(), video->get_height(), profile.get_framerate() );
+}
+
+
+std::string get_bus( std::string const & device_path )
+{
+    // e.g., /sys/devices/pci0000:00/0000:00:14.0/usb2/2-3/2-3:1.0/video4linux/video0 -> .../usb2
+    for( auto pos = device_path.find( "/usb" ); pos != std::string::npos; pos = device_path.find( "/usb", pos + 1 ) )
+    {
+        auto end = pos + 4;
+        while( end < device_path.size() && std::isdigit( static_cast< unsigned char >( device_path[end] ) ) )
+            ++end;
+        if( end > pos + 4 && ( end == device_path.size() || device_path[end] == '/' ) )
+            return device_path.substr( 0, end );
+    }
+    return device_path;
+}
+
+
+double get_capacity( platform::usb_spec spec )
+{
+    auto & r = get_registry();
+    std::lock_guard< std::mutex > lock( r.mutex );
+    return capacity_of( r, spec );
+}
+
+
+void set_capacities( double usb2_bytes_per_sec, double usb3_bytes_per_sec )
+{
+    auto & r = get_registry();
+    std::lock_guard< std::mutex > lock( r.mutex );
+    if( usb2_bytes_per_sec > 0 )
+        r.usb2_capacity = usb2_bytes_per_sec;
+    if( usb3_bytes_per_sec > 0 )
+        r.usb3_capacity = usb3_bytes_per_sec;
+}
+
+
+void reserve( void const * key, device_interface const & owner, double bytes_per_sec )
+{
+    location where;
+    if( ! locate( owner, where ) )
+        return;
+    auto & r = get_registry();
+    std::lock_guard< std::mutex > lock( r.mutex );
+    r.reservations[key] = { &owner, where, bytes_per_sec };
+    double used = 0;
+    for( auto const & kvp : r.reservations )
+        if( kvp.second.where.bus == where.bus )
+            used += kvp.second.rate;
+    if( used > capacity_of( r, where.spec ) )
+        LOG_WARNING( "USB bus " << where.bus << " is over-subscribed: " << used / 1e6 << " of "
+                                << capacity_of( r, where.spec ) / 1e6 << " MB/s; expect frame drops" );
+}
+
+
+void release( void const * key )
+{
+    auto & r = get_registry();
+    std::lock_guard< std::mutex > lock( r.mutex );
+    r.reservations.erase( key );
+}
+
+
+double get_headroom( device_interface const & dev )
+{
+    location where;
+    if( ! locate( dev, where ) )
+        return std::numeric_limits< double >::infinity();
+    auto & r = get_registry();
+    std::lock_guard< std::mutex > lock( r.mutex );
+    double headroom = capacity_of( r, where.spec );
+    for( auto const & kvp : r.reservations )
+        if( kvp.second.where.bus == where.bus && kvp.second.owner != &dev )
+            headroom -= kvp.second.rate;
+    return headroom;
+}
+
+
+rsutils::json get_usage()
+{
+    auto & r = get_registry();
+    std::lock_guard< std::mutex > lock( r.mutex );
+    rsutils::json usage = rsutils::json::object();
+    for( auto const & kvp : r.reservations )
+    {
+        auto const & where = kvp.second.where;
+        auto & bus = usage[where.bus];
+        if( bus.is_null() )
+        {
+            auto it = platform::usb_spec_names.find( where.spec );
+            bus["usb-type"] = it != platform::usb_spec_names.end() ? it->second : "Undefined";
+            bus["capacity"] = capacity_of( r, where.spec ) / 1e6;
+            bus["used"] = 0.;
+            bus["sensors"] = 0;
+        }
+        bus["used"] = bus["used"].get< double >() + kvp.second.rate / 1e6;
+        bus["sensors"] = bus["sensors"].get< int >() + 1;
+    }
+    for( auto & bus : usage )
+        bus["headroom"] = bus["capacity"].get< double >() - bus["used"].get< double >();
+    return usage;
+}
+
+
+}  // namespace usb_bandwidth
+}  // namespace librealsense
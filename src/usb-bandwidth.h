@@ -0,0 +1,57 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+#include <src/usb/usb-types.h>
+#include <rsutils/json-fwd.h>
+
+#include <cstdint>
+#include <string>
+
+
+namespace librealsense {
+
+
+class device_interface;
+class stream_profile_interface;
+
+
+// A rough, process-wide model of USB bandwidth, so that profiles can be resolved to what the bus can actually carry
+// when several cameras share it.
+//
+// Devices are grouped by the USB bus (root hub) they're on, as found in their sysfs path; where the path doesn't say
+// (e.g., on Windows), each device is taken to be alone on its bus. What a bus carries is what the open UVC sensors on it
+// stream: width x height x bpp x fps of their raw profiles, against a nominal capacity for its USB type.
+//
+namespace usb_bandwidth {
+
+
+// Bytes per second; 0 for anything we can't tell (non-video, compressed, ...)
+double get_payload_rate( rs2_format, uint32_t width, uint32_t height, uint32_t fps );
+double get_payload_rate( stream_profile_interface const & );
+
+// The bus a UVC device path is on; the path itself if it can't be told
+std::string get_bus( std::string const & device_path );
+
+// Nominal payload bytes per second, for USB2 and USB3 buses (USB1 and unknown are taken as USB2 and USB3, resp.)
+double get_capacity( platform::usb_spec );
+void set_capacities( double usb2_bytes_per_sec, double usb3_bytes_per_sec );
+
+// Sensors account for what they open, under a key of their choosing (themselves), until they release it.
+// Does nothing for devices that aren't on USB.
+void reserve( void const * key, device_interface const & owner, double bytes_per_sec );
+void release( void const * key );
+
+// Bytes per second still available on the bus of the device, not counting what the device itself uses; infinite if
+// it's not a USB device
+double get_headroom( device_interface const & );
+
+// { "<bus>": { "usb-type": "3.2", "capacity": MB/s, "used": MB/s, "headroom": MB/s, "sensors": N }, ... }, for the
+// buses anything is reserved on
+rsutils::json get_usage();
+
+
+}  // namespace usb_bandwidth
+}  // namespace librealsense
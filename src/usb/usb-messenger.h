@@ -10,12 +10,26 @@ namespace librealsense
 {
     namespace platform
     {
+        // Called with the status and the number of bytes transferred once an asynchronous transfer is done
+        typedef std::function<void(usb_status status, uint32_t transferred)> control_transfer_callback;
+
         class usb_messenger
         {
         public:
             virtual ~usb_messenger() = default;
 
             virtual usb_status control_transfer(int request_type, int request, int value, int index, uint8_t* buffer, uint32_t length, uint32_t& transferred, uint32_t timeout_ms) = 0;
+
+            // Queues a control transfer and returns without waiting for it: the callback is called when it is done,
+            // possibly from another thread, and the buffer must stay valid until then. Transfers are carried out in
+            // the order they were queued. Backends without asynchronous transfers carry it out before returning.
+            virtual void control_transfer_async(int request_type, int request, int value, int index, uint8_t* buffer, uint32_t length, uint32_t timeout_ms, control_transfer_callback callback)
+            {
+                uint32_t transferred = 0;
+                auto sts = control_transfer(request_type, request, value, index, buffer, length, transferred, timeout_ms);
+                callback(sts, transferred);
+            }
+
             virtual usb_status bulk_transfer(const rs_usb_endpoint& endpoint, uint8_t* buffer, uint32_t length, uint32_t& transferred, uint32_t timeout_ms) = 0;
             virtual usb_status reset_endpoint(const rs_usb_endpoint& endpoint, uint32_t timeout_ms) = 0;
             virtual usb_status submit_request(const rs_usb_request& request) = 0;
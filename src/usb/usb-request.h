@@ -30,6 +30,11 @@ namespace librealsense
             virtual void* get_native_request() const = 0;
             virtual const std::vector<uint8_t>& get_buffer() const = 0;
             virtual void set_buffer(const std::vector<uint8_t>& buffer) = 0;
+            // Transfer directly into memory owned by the caller, which must outlive the transfer; no copy is kept
+            virtual void set_buffer(uint8_t* buffer, int length) = 0;
+            // The memory the transfer reads into or writes from, whichever way it was set
+            virtual uint8_t* get_data() const = 0;
+            virtual int get_data_length() const = 0;
 
         protected:
             virtual void set_native_buffer_length(int length) = 0;
@@ -52,15 +57,31 @@ namespace librealsense
             virtual void set_buffer(const std::vector<uint8_t>& buffer) override
             {
                 _buffer = buffer;
-                set_native_buffer(_buffer.data());
-                set_native_buffer_length( static_cast< int >( _buffer.size() ));
+                attach_buffer(_buffer.data(), static_cast< int >( _buffer.size() ));
             }
+            virtual void set_buffer(uint8_t* buffer, int length) override
+            {
+                _buffer.clear();
+                attach_buffer(buffer, length);
+            }
+            virtual uint8_t* get_data() const override { return _data; }
+            virtual int get_data_length() const override { return _data_length; }
 
         protected:
+            void attach_buffer(uint8_t* buffer, int length)
+            {
+                _data = buffer;
+                _data_length = length;
+                set_native_buffer(buffer);
+                set_native_buffer_length(length);
+            }
+
             void* _client_data;
             rs_usb_request request;
             rs_usb_endpoint _endpoint;
             std::vector<uint8_t> _buffer;
+            uint8_t* _data = nullptr;
+            int _data_length = 0;
             rs_usb_request_callback _callback;
         };
 
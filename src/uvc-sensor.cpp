@@ -3,8 +3,12 @@
 
 #include "uvc-sensor.h"
 #include "device.h"
+#include "context.h"
 #include "stream.h"
 #include "global_timestamp_reader.h"
+#include "usb-bandwidth.h"
+#include "latency-stats.h"
+#include "frame-trace.h"
 #include "core/video-frame.h"
 #include "core/notification.h"
 #include "platform/uvc-option.h"
@@ -32,14 +36,62 @@ uvc_sensor::uvc_sensor( std::string const & name,
     , _device( std::move( uvc_device ) )
     , _user_count( 0 )
     , _timestamp_reader( std::move( timestamp_reader ) )
+    , _zero_copy_frames_in_flight( std::make_shared< std::atomic< int > >( 0 ) )
 {
     register_metadata( RS2_FRAME_METADATA_BACKEND_TIMESTAMP,
                        make_additional_data_parser( &frame_additional_data::backend_timestamp ) );
     register_metadata( RS2_FRAME_METADATA_RAW_FRAME_SIZE,
                        make_additional_data_parser( &frame_additional_data::raw_size ) );
+
+    if( auto context = dev ? dev->get_context() : nullptr )
+    {
+        rsutils::json const & settings = context->get_settings();
+        _frame_buffers = settings.nested( std::string( "frame-buffers", 13 ) ).default_value( _frame_buffers );
+#if defined( RS2_USE_V4L2_BACKEND ) || defined( RS2_USE_WMF_BACKEND )
+        // V4L2 buffers are requeued, and MF samples released, by the continuation; other backends release their
+        // buffers from the streaming context so holding on to them is not safe
+        _zero_copy = settings.nested( std::string( "zero-copy-frames", 16 ) ).default_value( false );
+#endif
+        if( _frame_buffers < 2 )
+            throw invalid_value_exception( "invalid frame-buffers setting; must be at least 2" );
+        _option_cache_staleness = std::chrono::milliseconds(
+            settings.nested( std::string( "option-cache-ms", 15 ) ).default_value( 0 ) );
+        _warm_restart = settings.nested( std::string( "warm-restart", 12 ) ).default_value( false );
+        _metadata_only = settings.nested( std::string( "metadata-only-frames", 20 ) ).default_value( false );
+    }
 }
 
 
+namespace {
+
+
+// Hands the backend buffer back (using the continuation we got with it) when the frame referencing it goes away
+class backend_buffer_releaser : public rs2_frame_allocator
+{
+    std::function< void() > _continuation;
+    std::shared_ptr< std::atomic< int > > _in_flight;
+
+public:
+    backend_buffer_releaser( std::function< void() > && continuation, std::shared_ptr< std::atomic< int > > in_flight )
+        : _continuation( std::move( continuation ) )
+        , _in_flight( std::move( in_flight ) )
+    {
+        ++*_in_flight;
+    }
+
+    void * allocate( size_t ) override { return nullptr; }
+    void deallocate( void *, size_t ) override
+    {
+        _continuation();
+        --*_in_flight;
+    }
+    void release() override { delete this; }
+};
+
+
+}  // namespace
+
+
 uvc_sensor::~uvc_sensor()
 {
     try
@@ -47,8 +99,10 @@ uvc_sensor::~uvc_sensor()
         if( _is_streaming )
             uvc_sensor::stop();
 
+        _warm_restart = false;  // no open() is coming
         if( _is_opened )
             uvc_sensor::close();
+        release_parked();
     }
     catch( ... )
     {
@@ -56,6 +110,25 @@ uvc_sensor::~uvc_sensor()
     }
 }
 
+void uvc_sensor::release_parked()
+{
+    if( _parked_config.empty() )
+        return;
+    for( auto && profile : _parked_config )
+    {
+        try
+        {
+            _device->close( profile );
+        }
+        catch( ... )
+        {
+        }
+    }
+    reset_streaming();
+    _parked_config.clear();
+    _parked_power.reset();
+}
+
 void uvc_sensor::verify_supported_requests( const stream_profiles & requests ) const
 {
     // This method's aim is to send a relevant exception message when a user tries to stream
@@ -99,8 +172,27 @@ void uvc_sensor::open( const stream_profiles & requests )
     else if( _is_opened )
         throw wrong_api_call_sequence_exception( "open(...) failed. UVC device is already opened!" );
 
+    auto const open_start = std::chrono::steady_clock::now();
     auto on = std::unique_ptr< power >( new power( std::dynamic_pointer_cast< uvc_sensor >( shared_from_this() ) ) );
 
+    bool warm = false;
+    if( ! _parked_config.empty() )
+    {
+        std::vector< platform::stream_profile > requested;
+        for( auto && req_profile : requests )
+            if( auto base = std::dynamic_pointer_cast< stream_profile_base >( req_profile ) )
+                requested.push_back( base->get_backend_profile() );
+        // Frames still referencing the parked buffers would be overwritten once these are queued again
+        warm = requested == _parked_config && *_zero_copy_frames_in_flight == 0;
+        if( warm )
+        {
+            _parked_config.clear();
+            _parked_power.reset();  // 'on' holds the power now
+        }
+        else
+            release_parked();
+    }
+
     _source.init( _metadata_parsers );
     _source.set_sensor( _source_owner->shared_from_this() );
 
@@ -115,9 +207,10 @@ void uvc_sensor::open( const stream_profiles & requests )
         {
             unsigned long long last_frame_number = 0;
             rs2_time_t last_timestamp = 0;
+            auto stats = &req_profile->get_stats();
             _device->probe_and_commit(
                 req_profile_base->get_backend_profile(),
-                [this, req_profile_base, req_profile, last_frame_number, last_timestamp](
+                [this, req_profile_base, req_profile, last_frame_number, last_timestamp, stats](
                     platform::stream_profile p,
                     platform::frame_object f,
                     std::function< void() > continuation ) mutable
@@ -139,6 +232,12 @@ void uvc_sensor::open( const stream_profiles & requests )
                                                                  last_timestamp,
                                                                  last_frame_number,
                                                                  req_profile_base );
+                    if( _metadata_only )
+                    {
+                        // The metadata was copied into the frame: the buffer can go back before anything else
+                        continuation();
+                        continuation = []() {};
+                    }
                     const auto && timestamp_domain = _timestamp_reader->get_frame_timestamp_domain( fr );
                     auto bpp = get_image_bpp( req_profile_base->get_format() );
                     auto && frame_counter = fr->additional_data.frame_number;
@@ -159,12 +258,28 @@ void uvc_sensor::open( const stream_profiles & requests )
                                << rs2_timestamp_domain_to_string( timestamp_domain ) << ",last_frame_number,"
                                << last_frame_number << ",last_timestamp," << last_timestamp );
 
+                    // Frames the backend gave up on pairing with metadata are part of the gap, but are counted apart
+                    if( f.unpaired_frames )
+                        stats->drops.drop( RS2_FRAME_DROP_STAGE_METADATA_SYNC, f.unpaired_frames );
+                    stats->drops.metadata_sync( f.pairing_mismatches, f.unpaired_metadata );
+
                     if( frame_counter <= last_frame_number )
                         LOG_INFO( "Frame counter reset" );
+                    else if( last_frame_number && frame_counter > last_frame_number + 1 + f.unpaired_frames )
+                        // Frames that never made it to us, wherever they were lost below
+                        stats->drops.drop( RS2_FRAME_DROP_STAGE_BACKEND,
+                                           frame_counter - last_frame_number - 1 - f.unpaired_frames );
 
                     last_frame_number = frame_counter;
                     last_timestamp = timestamp;
 
+                    if( frame_trace::enabled() )
+                        frame_trace::instant( "backend arrival",
+                                              frame_trace::frame_tag( req_profile_base->get_stream_type(),
+                                                                      req_profile_base->get_stream_index(),
+                                                                      frame_counter ),
+                                              system_time );
+
                     const auto && vsp = As< video_stream_profile, stream_profile_interface >( req_profile );
                     int width = vsp ? vsp->get_width() : 0;
                     int height = vsp ? vsp->get_height() : 0;
@@ -182,12 +297,23 @@ void uvc_sensor::open( const stream_profiles & requests )
                     if( val_in_range( req_profile_base->get_format(), { RS2_FORMAT_MJPEG, RS2_FORMAT_Z16H } ) )
                         expected_size = static_cast< int >( f.frame_size );
 
+                    // The whole frame is copied over below, except for Y12I which may be 24bpp and only fill 75%
+                    bool const zero_fill = req_profile_base->get_format() == RS2_FORMAT_Y12I;
+
+                    // Raw formats that need no stride fix-up can reference the backend buffer as-is
+                    bool const zero_copy = ! _metadata_only && _zero_copy
+                                        && val_in_range( req_profile_base->get_format(),
+                                                         { RS2_FORMAT_Z16, RS2_FORMAT_Y8, RS2_FORMAT_Y16 } )
+                                        && expected_size == f.frame_size
+                                        && *_zero_copy_frames_in_flight < _frame_buffers - 1;
+
                     auto extension = frame_source::stream_to_frame_types( req_profile_base->get_stream_type() );
                     frame_holder fh = _source.alloc_frame(
                         { req_profile_base->get_stream_type(), req_profile_base->get_stream_index(), extension },
-                        expected_size,
+                        _metadata_only ? 0 : expected_size,
                         std::move( fr->additional_data ),
-                        true );
+                        ! zero_copy && ! _metadata_only,
+                        zero_fill );
                     auto diff = time_service::get_time() - system_time;
                     if( diff > 10 )
                         LOG_DEBUG( "!! Frame allocation took " << diff << " msec" );
@@ -197,11 +323,28 @@ void uvc_sensor::open( const stream_profiles & requests )
                         // method should be limited to use of MIPI - not for USB
                         // the aim is to grab the data from a bigger buffer, which is aligned to 64 bytes,
                         // when the resolution's width is not aligned to 64
-                        if( ( width * bpp >> 3 ) % 64 != 0 && f.frame_size > expected_size )
+                        auto zero_copy_frame = zero_copy ? dynamic_cast< frame * >( fh.frame ) : nullptr;
+                        if( _metadata_only )
                         {
-                            std::vector< uint8_t > pixels = align_width_to_64( width, height, bpp, (uint8_t *)f.pixels );
-                            assert( expected_size == sizeof( uint8_t ) * pixels.size() );
-                            memcpy( (void *)fh->get_frame_data(), pixels.data(), expected_size );
+                            // Nothing to copy: the metadata is already in the frame's additional data
+                        }
+                        else if( zero_copy_frame )
+                        {
+                            // The backend buffer now belongs to the frame
+                            zero_copy_frame->set_allocated_data(
+                                (uint8_t *)f.pixels,
+                                expected_size,
+                                std::make_shared< backend_buffer_releaser >( std::move( continuation ),
+                                                                             _zero_copy_frames_in_flight ) );
+                            continuation = []() {};
+                        }
+                        else if( ( width * bpp >> 3 ) % 64 != 0 && f.frame_size > expected_size )
+                        {
+                            align_width_to_64( width,
+                                               height,
+                                               bpp,
+                                               (uint8_t const *)f.pixels,
+                                               (uint8_t *)fh->get_frame_data() );
                         }
                         else
                         {
@@ -220,7 +363,7 @@ void uvc_sensor::open( const stream_profiles & requests )
                         auto && video = dynamic_cast< video_frame * >( fh.frame );
                         if( video )
                         {
-                            video->assign( width, height, width * bpp / 8, bpp );
+                            video->assign( width, height, _metadata_only ? 0 : width * bpp / 8, bpp );
                         }
 
                         fh->set_timestamp_domain( timestamp_domain );
@@ -233,11 +376,13 @@ void uvc_sensor::open( const stream_profiles & requests )
 
                     // calling the continuation method, and releasing the backend frame buffer
                     // since the content of the OS frame buffer has been copied, it can released ASAP
+                    // (in zero-copy, this was moved into the frame and is a no-op)
                     continuation();
 
                     if (!fh.frame)
                     {
                         LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
+                        stats->drops.drop( RS2_FRAME_DROP_STAGE_ARCHIVE );
                         return;
                     }
 
@@ -250,13 +395,19 @@ void uvc_sensor::open( const stream_profiles & requests )
 
                         // Invoke first callback
                         auto callback_start_time = time_service::get_time();
+                        if( frame_trace::enabled() )
+                            frame_trace::complete( "frame_archive publish",
+                                                   frame_trace::frame_tag( fh.frame ),
+                                                   system_time,
+                                                   callback_start_time );
                         auto callback = fh->get_owner()->begin_callback();
                         _source.invoke_callback( std::move( fh ) );
 
                         // Log callback ended
                         log_callback_end( fps, callback_start_time, time_service::get_time(), stream_type, frame_number );
                     }
-                } );
+                },
+                _frame_buffers );
         }
         catch( ... )
         {
@@ -308,7 +459,20 @@ void uvc_sensor::open( const stream_profiles & requests )
     {
         As< librealsense::global_time_interface >( _owner )->enable_time_diff_keeper( true );
     }
+    if( _owner )
+    {
+        double rate = 0;
+        for( auto && req_profile : requests )
+            rate += usb_bandwidth::get_payload_rate( *req_profile );
+        usb_bandwidth::reserve( this, *_owner, rate );
+    }
     set_active_streams( requests );
+
+    LOG_DEBUG( get_info( RS2_CAMERA_INFO_NAME ) << ( warm ? " warm" : " cold" ) << " open took "
+                                                << std::chrono::duration_cast< std::chrono::milliseconds >(
+                                                       std::chrono::steady_clock::now() - open_start )
+                                                       .count()
+                                                << " ms" );
 }
 
 void uvc_sensor::close()
@@ -319,21 +483,35 @@ void uvc_sensor::close()
     else if( ! _is_opened )
         throw wrong_api_call_sequence_exception( "close() failed. UVC device was not opened!" );
 
+    bool const park = _warm_restart && ! _internal_config.empty();
     for( auto && profile : _internal_config )
     {
         try  // Handle disconnect event
         {
-            _device->close( profile );
+            if( park )
+                _device->park( profile );
+            else
+                _device->close( profile );
         }
         catch( ... )
         {
         }
     }
-    reset_streaming();
+    if( park )
+    {
+        // The archives stay, free lists and all, for the next open() to reuse; only what's in flight is dropped
+        _source.cancel_pending_callbacks();
+        _timestamp_reader->reset();
+        _parked_config = _internal_config;
+        _parked_power = std::move( _power );
+    }
+    else
+        reset_streaming();
     if( Is< librealsense::global_time_interface >( _owner ) )
     {
         As< librealsense::global_time_interface >( _owner )->enable_time_diff_keeper( false );
     }
+    usb_bandwidth::release( this );
     _power.reset();
     _is_opened = false;
     set_active_streams( {} );
@@ -374,6 +552,7 @@ void uvc_sensor::start( rs2_frame_callback_sptr callback )
     _source.set_callback( callback );
     _is_streaming = true;
     _device->start_callbacks();
+    invalidate_option_cache();  // some controls behave differently while streaming
 }
 
 void uvc_sensor::stop()
@@ -384,7 +563,9 @@ void uvc_sensor::stop()
 
     _is_streaming = false;
     _device->stop_callbacks();
+    _source.cancel_pending_callbacks();
     _timestamp_reader->reset();
+    invalidate_option_cache();
     raise_on_before_streaming_changes( false );
 }
 
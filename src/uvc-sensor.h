@@ -43,6 +43,14 @@ public:
         return action( *_device );
     }
 
+    // Option values read from the device may be served from a cache (see option_value_cache) for up to this long,
+    // from the "option-cache-ms" setting; 0 (the default) always queries the device
+    std::chrono::milliseconds get_option_cache_staleness() const { return _option_cache_staleness; }
+    // Any write to the sensor may change other options' values too (e.g., setting exposure turns off auto-exposure),
+    // so every cached value is dropped when this changes
+    uint64_t get_option_generation() const { return _option_generation; }
+    void invalidate_option_cache() { ++_option_generation; }
+
 protected:
     stream_profiles init_stream_profiles() override;
     void verify_supported_requests( const stream_profiles & requests ) const;
@@ -50,6 +58,7 @@ protected:
 private:
     void acquire_power();
     void release_power();
+    void release_parked();
     void reset_streaming();
 
     struct power
@@ -90,6 +99,30 @@ private:
     std::vector< platform::extension_unit > _xus;
     std::unique_ptr< power > _power;
     std::unique_ptr< frame_timestamp_reader > _timestamp_reader;
+
+    // Zero-copy mode: raw frames reference the backend buffer directly and hand it back only when released, instead
+    // of being copied. Enabled via the "zero-copy-frames" context setting; the number of backend buffers is from
+    // "frame-buffers". At most _frame_buffers-1 frames are held this way so the backend is never left without a
+    // buffer; beyond that frames are copied as usual. With Media Foundation, which manages its own sample pool,
+    // "frame-buffers" is only the depth of this queue: how many samples frames may keep from the source reader.
+    bool _zero_copy = false;
+    int _frame_buffers = DEFAULT_V4L2_FRAME_BUFFERS;
+    std::shared_ptr< std::atomic< int > > _zero_copy_frames_in_flight;
+
+    // Metadata-only mode: frames carry their metadata (parsed as usual) but no pixels, and the backend buffer is
+    // handed back as soon as the metadata is out of it, without allocating or copying the image. For consumers that
+    // only need the per-frame telemetry. Enabled via the "metadata-only-frames" context setting.
+    bool _metadata_only = false;
+
+    // Warm restart: on close(), the backend keeps its buffers and we keep the frame archives (with their free lists)
+    // and the power, so that an open() of the same profiles right after does not have to set them up again. Enabled
+    // via the "warm-restart" context setting; anything else opened releases them first.
+    bool _warm_restart = false;
+    std::vector< platform::stream_profile > _parked_config;
+    std::unique_ptr< power > _parked_power;
+
+    std::chrono::milliseconds _option_cache_staleness{ 0 };
+    std::atomic< uint64_t > _option_generation{ 0 };
 };
 
 
@@ -63,7 +63,7 @@ namespace librealsense
             return rv;
         }
 
-        std::shared_ptr<uvc_device> create_rsuvc_device(uvc_device_info info)
+        std::shared_ptr<uvc_device> create_rsuvc_device(uvc_device_info info, uint8_t usb_request_count, bool inline_publish)
         {
             auto devices = usb_enumerator::query_devices_info();
             for (auto&& usb_info : devices)
@@ -73,17 +73,19 @@ namespace librealsense
 
                 auto dev = usb_enumerator::create_usb_device(usb_info);
                 if(dev)
-                    return std::make_shared<rs_uvc_device>(dev, info);
+                    return std::make_shared<rs_uvc_device>(dev, info, usb_request_count, inline_publish);
             }
 
             return nullptr;
         }
 
-        rs_uvc_device::rs_uvc_device(const rs_usb_device& usb_device, const uvc_device_info &info, uint8_t usb_request_count) :
+        rs_uvc_device::rs_uvc_device(const rs_usb_device& usb_device, const uvc_device_info &info, uint8_t usb_request_count,
+                                     bool inline_publish) :
                 _usb_device(usb_device),
                 _info(info),
-                _action_dispatcher(10),
-                _usb_request_count(usb_request_count)
+                _action_dispatcher(10, nullptr, "usb"),
+                _usb_request_count(usb_request_count),
+                _inline_publish(inline_publish)
         {
             _parser = std::make_shared<uvc_parser>(usb_device, info);
             _action_dispatcher.start();
@@ -455,7 +457,7 @@ namespace librealsense
             if(sts != RS2_USB_STATUS_SUCCESS)
                 throw std::runtime_error("Failed to start streaming!");
 
-            uvc_streamer_context usc = { profile, callback, ctrl, _usb_device, _messenger, _usb_request_count };
+            uvc_streamer_context usc = { profile, callback, ctrl, _usb_device, _messenger, _usb_request_count, _inline_publish };
 
             auto streamer = std::make_shared<uvc_streamer>(usc);
             _streamers.push_back(streamer);
@@ -606,23 +608,33 @@ namespace librealsense
                 throw std::runtime_error("insufficient data writen to USB");
         }
 
-        bool rs_uvc_device::uvc_get_ctrl(uint8_t unit, uint8_t ctrl, void *data, int len, uvc_req_code req_code) const
+        usb_status rs_uvc_device::control_transfer_and_wait(int request_type, int request, int value, int index, uint8_t* data, uint32_t len) const
         {
-            usb_status sts;
+            // Only the submission goes through the dispatcher: the transfer itself is queued on the messenger, so
+            // callers on other threads do not wait for it to complete before theirs are sent
+            auto done = std::make_shared<std::promise<usb_status>>();
+            auto result = done->get_future();
+            bool submitted = false;
             _action_dispatcher.invoke_and_wait([&, this](dispatcher::cancellable_timer c)
             {
                 if (_messenger)
                 {
-                    uint32_t transferred;
-                    sts = _messenger->control_transfer(
-                            UVC_REQ_TYPE_GET, req_code,
-                            ctrl << 8,
-                            unit << 8 | _info.mi,
-                            static_cast<unsigned char *>(data),
-                            len, transferred, CONTROL_TRANSFER_TIMEOUT);
+                    submitted = true;
+                    _messenger->control_transfer_async(request_type, request, value, index, data, len, CONTROL_TRANSFER_TIMEOUT,
+                        [done](usb_status sts, uint32_t) { done->set_value(sts); });
                 }
             }, [this](){ return !_messenger; });
 
+            return submitted ? result.get() : RS2_USB_STATUS_OTHER;
+        }
+
+        bool rs_uvc_device::uvc_get_ctrl(uint8_t unit, uint8_t ctrl, void *data, int len, uvc_req_code req_code) const
+        {
+            auto sts = control_transfer_and_wait(UVC_REQ_TYPE_GET, req_code,
+                                                 ctrl << 8,
+                                                 unit << 8 | _info.mi,
+                                                 static_cast<uint8_t *>(data), len);
+
             if (sts == RS2_USB_STATUS_NO_DEVICE)
                 throw std::runtime_error("usb device disconnected");
 
@@ -631,20 +643,10 @@ namespace librealsense
 
         bool rs_uvc_device::uvc_set_ctrl(uint8_t unit, uint8_t ctrl, void *data, int len)
         {
-            usb_status sts;
-            _action_dispatcher.invoke_and_wait([&, this](dispatcher::cancellable_timer c)
-            {
-                if (_messenger)
-                {
-                    uint32_t transferred;
-                    sts = _messenger->control_transfer(
-                            UVC_REQ_TYPE_SET, UVC_SET_CUR,
-                            ctrl << 8,
-                            unit << 8 | _info.mi,
-                            static_cast<unsigned char *>(data),
-                            len, transferred, CONTROL_TRANSFER_TIMEOUT);
-                }
-            }, [this](){ return !_messenger; });
+            auto sts = control_transfer_and_wait(UVC_REQ_TYPE_SET, UVC_SET_CUR,
+                                                 ctrl << 8,
+                                                 unit << 8 | _info.mi,
+                                                 static_cast<uint8_t *>(data), len);
 
             if (sts == RS2_USB_STATUS_NO_DEVICE)
                 throw std::runtime_error("usb device disconnected");
@@ -17,6 +17,7 @@
 #include <thread>
 #include <vector>
 #include <memory>
+#include <future>
 
 typedef void(uvc_frame_callback_t)(struct librealsense::platform::frame_object *frame, void *user_ptr);
 
@@ -28,7 +29,8 @@ namespace librealsense
         class uvc_streamer;
 
         std::vector<uvc_device_info> query_uvc_devices_info();
-        std::shared_ptr<uvc_device> create_rsuvc_device(uvc_device_info info);
+        std::shared_ptr<uvc_device> create_rsuvc_device(uvc_device_info info, uint8_t usb_request_count = 2,
+                                                        bool inline_publish = false);
 
         struct profile_and_callback
         {
@@ -39,7 +41,8 @@ namespace librealsense
         class rs_uvc_device : public uvc_device
         {
         public:
-            rs_uvc_device(const rs_usb_device& usb_device, const uvc_device_info &info, uint8_t usb_request_count = 2);
+            rs_uvc_device(const rs_usb_device& usb_device, const uvc_device_info &info, uint8_t usb_request_count = 2,
+                          bool inline_publish = false);
             virtual ~rs_uvc_device();
 
             virtual void probe_and_commit(stream_profile profile, frame_callback callback, int buffers = DEFAULT_V4L2_FRAME_BUFFERS) override;
@@ -80,6 +83,8 @@ namespace librealsense
             usb_status query_stream_ctrl(const std::shared_ptr<uvc_stream_ctrl_t>& control, uint8_t probe, int req);
             std::vector<uvc_format_t> get_available_formats_all() const;
 
+            // Sends a control transfer without holding the action dispatcher while it is on the wire
+            usb_status control_transfer_and_wait(int request_type, int request, int value, int index, uint8_t* data, uint32_t len) const;
             bool uvc_get_ctrl(uint8_t unit, uint8_t ctrl, void *data, int len, uvc_req_code req_code) const;
             bool uvc_set_ctrl(uint8_t unit, uint8_t ctrl, void *data, int len);
 
@@ -108,6 +113,7 @@ namespace librealsense
             rs_usb_request                          _interrupt_request;
             rs_usb_request_callback                 _interrupt_callback;
             uint8_t                                 _usb_request_count;
+            bool                                    _inline_publish;
 
             mutable dispatcher                      _action_dispatcher;
             // uvc internal
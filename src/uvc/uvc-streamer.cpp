@@ -16,7 +16,7 @@ namespace librealsense
     namespace platform
     {
         uvc_streamer::uvc_streamer(uvc_streamer_context context) :
-            _context(context), _action_dispatcher(10)
+            _context(context), _action_dispatcher(10, nullptr, "usb")
         {
             auto inf = context.usb_device->get_interface(context.control->bInterfaceNumber);
             if (inf == nullptr)
@@ -38,11 +38,12 @@ namespace librealsense
             flush();
         }
 
-        void uvc_process_bulk_payload(backend_frame_ptr fp, size_t payload_len, backend_frames_queue& queue) {
+        // Parse the UVC payload header in place; returns false if the payload should be dropped
+        static bool uvc_process_bulk_payload(backend_frame_ptr& fp, size_t payload_len) {
 
             /* ignore empty payload transfers */
             if (!fp || payload_len < 2)
-                return;
+                return false;
 
             uint8_t header_len = fp->pixels[0];
             uint8_t header_info = fp->pixels[1];
@@ -52,12 +53,12 @@ namespace librealsense
             if (header_info & 0x40)
             {
                 LOG_ERROR("bad packet: error bit set");
-                return;
+                return false;
             }
             if (header_len > payload_len)
             {
                 LOG_ERROR("bogus packet: actual_len=" << payload_len << ", header_len=" << header_len);
-                return;
+                return false;
             }
 
 
@@ -65,8 +66,7 @@ namespace librealsense
             librealsense::platform::frame_object fo{ data_len, header_len,
                                                      fp->pixels.data() + header_len , fp->pixels.data() };
             fp->fo = fo;
-
-            queue.enqueue(std::move(fp));
+            return true;
         }
 
         void uvc_streamer::init()
@@ -93,7 +93,7 @@ namespace librealsense
                     if(_publish_frames && running())
                         _context.user_cb(_context.profile, fp->fo, []() mutable {});
                 }
-            });
+            }, "usb");
 
             _watchdog = std::make_shared<watchdog>([this]()
              {
@@ -112,41 +112,77 @@ namespace librealsense
 
             _request_callback = std::make_shared<usb_request_callback>([this](platform::rs_usb_request r)
             {
-                _action_dispatcher.invoke([this, r](dispatcher::cancellable_timer)
-                {
-                    if(!_running)
-                      return;
-
-                    auto al = r->get_actual_length();
-                    // Relax the frame size constrain for compressed streams
-                    bool is_compressed = val_in_range(_context.profile.format, { 0x4d4a5047U , 0x5a313648U}); // MJPEG, Z16H
-                    if(al > 0L && ((al == r->get_buffer().data()[0] + _context.control->dwMaxVideoFrameSize) || is_compressed ))
-                    {
-                        auto f = backend_frame_ptr(_frames_archive->allocate(), &cleanup_frame);
-                        if(f)
-                        {
-                            _frame_arrived = true;
-                            _watchdog->kick();
-                            memcpy(f->pixels.data(), r->get_buffer().data(), r->get_buffer().size());
-                            uvc_process_bulk_payload(std::move(f), r->get_actual_length(), _queue);
-                        }
-                    }
-
-                    auto sts = _context.messenger->submit_request(r);
-                    if(sts != platform::RS2_USB_STATUS_SUCCESS)
-                        LOG_ERROR("failed to submit UVC request, error: " << sts);
-                });
+                // Completions are serialized by the usb_request_callback, and stop() cancels it before anything else
+                if(_context.inline_publish)
+                    handle_request(r);
+                else
+                    _action_dispatcher.invoke([this, r](dispatcher::cancellable_timer) { handle_request(r); });
             });
 
+            // Each request transfers straight into a frame from the archive, so the archive must always have spares
+            // for the frames that are queued or being published
+            if(_context.request_count < 1 || _context.request_count > _frames_archive->CAPACITY - 2)
+                throw std::runtime_error("invalid UVC request count " + std::to_string(_context.request_count));
+
             _requests = std::vector<rs_usb_request>(_context.request_count);
             for(auto&& r : _requests)
             {
                 r = _context.messenger->create_request(_read_endpoint);
-                r->set_buffer(std::vector<uint8_t>(_read_buff_length));
+                attach_frame(r, _frames_archive->allocate());
                 r->set_callback(_request_callback);
             }
         }
 
+        void uvc_streamer::handle_request(const rs_usb_request& r)
+        {
+            if(!_running)
+              return;
+
+            auto al = r->get_actual_length();
+            // Relax the frame size constrain for compressed streams
+            bool is_compressed = val_in_range(_context.profile.format, { 0x4d4a5047U , 0x5a313648U}); // MJPEG, Z16H
+            if(al > 0L && ((al == r->get_data()[0] + _context.control->dwMaxVideoFrameSize) || is_compressed ))
+            {
+                // The request filled one of our frames directly: hand it over as-is, and transfer the next
+                // payload into a fresh one. If none is free, the payload is dropped and the frame reused.
+                auto next = _frames_archive->allocate();
+                if(next)
+                {
+                    _frame_arrived = true;
+                    _watchdog->kick();
+                    auto f = backend_frame_ptr(reinterpret_cast<backend_frame *>(r->get_client_data()), &cleanup_frame);
+                    attach_frame(r, next);
+                    if(uvc_process_bulk_payload(f, al))
+                    {
+                        if(!_context.inline_publish)
+                            _queue.enqueue(std::move(f));
+                        else if(_publish_frames)
+                            _context.user_cb(_context.profile, f->fo, []() mutable {});
+                    }
+                }
+            }
+
+            auto sts = _context.messenger->submit_request(r);
+            if(sts != platform::RS2_USB_STATUS_SUCCESS)
+                LOG_ERROR("failed to submit UVC request, error: " << sts);
+        }
+
+        void uvc_streamer::attach_frame(const rs_usb_request& r, backend_frame * f)
+        {
+            r->set_client_data(f);
+            r->set_buffer(f->pixels.data(), static_cast<int>(f->pixels.size()));
+        }
+
+        void uvc_streamer::release_request_frames()
+        {
+            for(auto&& r : _requests)
+            {
+                if(auto f = reinterpret_cast<backend_frame *>(r->get_client_data()))
+                    _frames_archive->deallocate(f);
+                r->set_client_data(nullptr);
+            }
+        }
+
         void uvc_streamer::start()
         {
             _action_dispatcher.invoke_and_wait([this](dispatcher::cancellable_timer c)
@@ -168,7 +204,8 @@ namespace librealsense
                         throw std::runtime_error("failed to submit UVC request while start streaming");
                 }
 
-                _publish_frame_thread->start();
+                if(!_context.inline_publish)
+                    _publish_frame_thread->start();
 
             }, [this](){ return _running; });
         }
@@ -191,13 +228,15 @@ namespace librealsense
                 for(auto&& r : _requests)
                   _context.messenger->cancel_request(r);
 
+                release_request_frames();
                 _requests.clear();
 
                 _frames_archive->wait_until_empty();
 
                 _context.messenger->reset_endpoint(_read_endpoint, RS2_USB_ENDPOINT_DIRECTION_READ);
 
-                _publish_frame_thread->stop();
+                if(!_context.inline_publish)
+                    _publish_frame_thread->stop();
 
                 {
                     std::lock_guard<std::mutex> lock(_running_mutex);
@@ -26,6 +26,8 @@ namespace librealsense
             rs_usb_device usb_device;
             rs_usb_messenger messenger;
             uint8_t request_count;
+            // Publish frames from the USB completion context, rather than queueing them to a publishing thread
+            bool inline_publish;
         };
 
         class uvc_streamer
@@ -66,6 +68,9 @@ namespace librealsense
 
             void init();
             void flush();
+            void handle_request(const rs_usb_request& r);
+            void attach_frame(const rs_usb_request& r, backend_frame * f);
+            void release_request_frames();
         };
     }
 }
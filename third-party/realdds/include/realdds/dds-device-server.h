@@ -96,6 +96,8 @@ public:
     std::map< std::string, std::shared_ptr< dds_stream_server > > const & streams() const { return _stream_name_to_server; }
 
     void publish_notification( topics::flexible_msg && );
+    // In the participant's preferred format
+    void publish_notification( rsutils::json const & );
     void publish_metadata( rsutils::json && );
 
     bool has_metadata_readers() const;
@@ -125,6 +127,7 @@ private:
 
     std::shared_ptr< dds_publisher > _publisher;
     std::shared_ptr< dds_subscriber > _subscriber;
+    bool const _cbor_messages;  // notifications and metadata are sent as CBOR rather than JSON text
     std::string _topic_root;
     std::map< std::string, std::shared_ptr< dds_stream_server > > _stream_name_to_server;
     dds_options _options;
@@ -7,9 +7,13 @@
 #include "dds-guid.h"
 #include "dds-time.h"
 
+#include <rsutils/json.h>
+
 #include <map>
 #include <memory>
 #include <mutex>
+#include <chrono>
+#include <atomic>
 
 
 namespace realdds {
@@ -33,6 +37,10 @@ class dds_topic_reader;
 // HW reset) and is then discovered again will reuse the same dds_device object. The topic-root is how devices are
 // distinguished.
 //
+// With the participant's "device-cache" setting, the device-infos seen are kept in a file and, on start(), devices seen
+// recently enough are created right away rather than waiting for their broadcasts. These are "tentative": they are
+// reported as added once they are ready (their server is really there), and validated when their broadcast arrives.
+//
 class dds_device_watcher
 {
 public:
@@ -63,9 +71,18 @@ public:
     //
     bool is_device_broadcast( std::shared_ptr< dds_device > const & ) const;
 
+    // Returns true if the device was created from the cache and its broadcast has not been seen yet
+    //
+    bool is_device_tentative( std::shared_ptr< dds_device > const & ) const;
+
 private:
     void init();
 
+    // Create tentative devices for what the cache has
+    void load_cache();
+    // Update the cache with the device-info just seen
+    void update_cache( std::string const & root, rsutils::json const & device_info );
+
     std::shared_ptr< dds_participant > _participant;
     std::shared_ptr< dds_topic_reader > _device_info_topic;
 
@@ -78,6 +95,8 @@ private:
         std::weak_ptr< dds_device > in_use;   // when !alive, to detect if it's still being used
         dds_guid writer_guid;
         dds_time last_seen;
+        bool tentative = false;  // from the cache, not validated by a broadcast yet
+        std::shared_ptr< std::atomic< bool > > reported;  // for tentative devices, once on_device_added was called
     };
 
     void device_discovery_lost( device_liveliness &, std::lock_guard< std::mutex > & lock );
@@ -85,6 +104,10 @@ private:
     using liveliness_map = std::map< std::string /*root*/, device_liveliness >;
     liveliness_map _device_by_root;
     mutable std::mutex _devices_mutex;
+
+    std::string _cache_path;  // empty if not caching
+    std::chrono::seconds _cache_ttl;
+    rsutils::json _cache;     // root -> { device-info, last-seen }; guarded by _devices_mutex
 };
 
 
@@ -82,6 +82,8 @@ public:
     rsutils::json query_option_value( const std::shared_ptr< dds_option > & option );
 
     void send_control( topics::flexible_msg &&, rsutils::json * reply = nullptr );
+    // In the participant's preferred format (device/message-format)
+    void send_control( rsutils::json const &, rsutils::json * reply = nullptr );
 
     bool has_extrinsics() const;
     std::shared_ptr< extrinsics > get_extrinsics( std::string const & from, std::string const & to ) const;
@@ -0,0 +1,72 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "dds-defines.h"
+#include "dds-guid.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace realdds {
+
+namespace topics {
+class image_msg;
+}  // namespace topics
+
+
+// Hands images from a server to the readers of the same topic in the same process, without DDS
+//
+// A dds_video_stream_server whose topic has local readers (dds_video_streams of the same domain and topic name in this
+// process) gives them its images directly, without serializing them, still publishing over DDS if it has readers
+// elsewhere. Local readers ignore the DDS samples of local writers, so nothing is received twice.
+//
+// Images are delivered on the publishing thread: the last reader gets them, the others get copies.
+//
+class dds_intra_process
+{
+public:
+    typedef std::function< void( topics::image_msg && ) > on_image_callback;
+
+    static dds_intra_process & instance();
+
+    void add_reader( dds_domain_id, std::string const & topic_name, dds_guid const & reader, on_image_callback );
+    // Once this returns, the reader's callback will not be called again
+    void remove_reader( dds_guid const & reader );
+    bool is_local_writer( dds_guid const & writer ) const;
+
+    void add_writer( dds_domain_id, std::string const & topic_name, dds_guid const & writer );
+    void remove_writer( dds_guid const & writer );
+
+    // Number of local readers the writer would deliver to
+    size_t readers_of( dds_guid const & writer ) const;
+
+    // Hands the image to the writer's local readers. With 'keep', they all get copies and the image is left intact;
+    // otherwise, it is moved to the last of them. Returns the number of readers.
+    size_t deliver( dds_guid const & writer, topics::image_msg & image, bool keep );
+
+private:
+    dds_intra_process() = default;
+
+    struct reader
+    {
+        dds_guid guid;
+        on_image_callback callback;  // null once removed
+        std::recursive_mutex mutex;  // held while delivering; recursive, for callbacks that remove their own reader
+    };
+
+    typedef std::pair< dds_domain_id, std::string > topic_key;
+
+    mutable std::mutex _mutex;
+    std::map< topic_key, std::vector< std::shared_ptr< reader > > > _readers;
+    std::map< dds_guid, topic_key > _writers;
+};
+
+
+}  // namespace realdds
@@ -5,6 +5,7 @@
 #include "dds-defines.h"
 
 #include <rsutils/json.h>
+#include <rsutils/shared-ptr-singleton.h>
 #include <memory>
 #include <functional>
 #include <string>
@@ -37,6 +38,9 @@ class slice;
 namespace realdds {
 
 
+class dds_reader_executor;
+
+
 // The starting point for any DDS interaction, a participant has a name and is the focal point for creating, destroying,
 // and managing other DDS objects. It defines the DDS domain (ID) in which every other object lives.
 //
@@ -51,6 +55,7 @@ class dds_participant
     struct listener_impl;
 
     rsutils::json _settings;
+    rsutils::shared_ptr_singleton< dds_reader_executor > _reader_executor;
 
 public:
     dds_participant() = default;
@@ -72,6 +77,11 @@ public:
 
     rsutils::json const & settings() const { return _settings; }
 
+    // The threads that serve the participant's stream and metadata readers, "reader-threads" of them (2 by default);
+    // created on first use, and gone with the last reader
+    //
+    std::shared_ptr< dds_reader_executor > reader_executor();
+
     // RTPS 8.2.4.2 "Every Participant has GUID <prefix, ENTITYID_PARTICIPANT>, where the constant ENTITYID_PARTICIPANT
     //     is a special value defined by the RTPS protocol. Its actual value depends on the PSM."
     // In FastDDS, this constant is ENTITYID_RTPSParticipant = 0x1c1.
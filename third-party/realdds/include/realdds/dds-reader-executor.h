@@ -0,0 +1,69 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <fastdds/dds/core/condition/GuardCondition.hpp>
+#include <fastdds/dds/core/condition/WaitSet.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace realdds {
+
+
+class dds_topic_reader_thread;
+
+
+// Services many topic-readers from a few threads, rather than a thread per reader: each thread waits on the status
+// conditions of the readers assigned to it, and handles those with changes when woken, high-priority ones first.
+//
+// Readers are assigned to the thread with the fewest readers, and stay there. A reader's callbacks are therefore still
+// serialized, but they also block the other readers on the same thread while they run: do not wait from them for data
+// that may arrive on another pooled reader!
+//
+// The participant owns one, through dds_participant::reader_executor(), for all its pooled readers.
+//
+class dds_reader_executor
+{
+public:
+    enum class priority
+    {
+        normal,
+        high,  // e.g., images: handled before the normal readers that woke at the same time
+    };
+
+private:
+    struct lane
+    {
+        eprosima::fastdds::dds::GuardCondition stopped;
+        eprosima::fastdds::dds::WaitSet wait_set;  // after 'stopped', which is attached to it
+        std::recursive_mutex mutex;  // held while handling, so remove() waits for the reader's callbacks to finish
+        std::map< eprosima::fastdds::dds::Condition const *, std::pair< dds_topic_reader_thread *, priority > > readers;
+        std::thread th;
+    };
+    std::vector< std::shared_ptr< lane > > _lanes;  // shared with its thread, which may outlive us
+    std::map< dds_topic_reader_thread const *, lane * > _lane_by_reader;
+    std::mutex _mutex;  // for _lane_by_reader; never held together with a lane's
+
+public:
+    dds_reader_executor( size_t n_threads );
+    ~dds_reader_executor();
+
+    size_t size() const { return _lanes.size(); }
+
+    // The reader must be running; its callbacks may be called before this returns
+    void add( dds_topic_reader_thread *, priority );
+    // Once this returns, no callbacks are in progress nor will be made
+    void remove( dds_topic_reader_thread * );
+
+private:
+    static void run( lane & );
+};
+
+
+}  // namespace realdds
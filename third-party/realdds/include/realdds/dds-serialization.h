@@ -51,6 +51,7 @@ eprosima::fastdds::dds::DurabilityQosPolicyKind durability_kind_from_string( std
 eprosima::fastdds::dds::HistoryQosPolicyKind history_kind_from_string( std::string const & );
 eprosima::fastdds::dds::LivelinessQosPolicyKind liveliness_kind_from_string( std::string const & );
 eprosima::fastrtps::rtps::MemoryManagementPolicy_t history_memory_policy_from_string( std::string const & );
+eprosima::fastdds::dds::PublishModeQosPolicyKind publish_mode_kind_from_string( std::string const & );
 
 // Override QoS reliability from a JSON source.
 // The JSON can be a simple string indicating simple reliability kind:
@@ -109,15 +110,46 @@ void override_data_sharing_qos_from_json( eprosima::fastdds::dds::DataSharingQos
 //
 void override_endpoint_qos_from_json( eprosima::fastdds::dds::RTPSEndpointQos & qos, rsutils::json const & );
 
+// Override QoS publish-mode from a JSON source.
+// The JSON can be a simple string indicating the kind:
+//      "publish-mode": "asynchronous"
+// If an object, a flow controller (registered with the participant's "flow-controllers") can be specified; it
+// implies asynchronous publishing:
+//      "publish-mode": {
+//          "kind": "asynchronous",
+//          "flow-controller": "large-data"
+//          }
+// The flow controller name is not copied: the JSON must outlive the QoS (the participant settings do).
+//
+void override_publish_mode_qos_from_json( eprosima::fastdds::dds::PublishModeQosPolicy & qos, rsutils::json const & );
+
 
 // Override participant QoS from a JSON source.
 // The JSON is an object:
 //      {
 //          "participant-id": -1,
 //          "lease-duration": 10,  // seconds
+//          "flow-controllers": {
+//              "<name>": {
+//                  "max-bytes-per-period": 0,  // 0 for no limit
+//                  "period-ms": 100,
+//                  "scheduler": "fifo"  // or "round-robin", "high-priority", "priority-with-reservation"
+//                  }
+//              },
+//          "large-data": true  // or an object, like a flow controller
 //      }
+// The flow controller names are not copied: the JSON must outlive the QoS.
 //
 void override_participant_qos_from_json( eprosima::fastdds::dds::DomainParticipantQos & qos, rsutils::json const & );
 
 
+// The "large-data" participant setting tunes the participant for streaming frames that have to be fragmented (i.e.,
+// large images) over a lossy network, where any lost fragment loses the whole frame: bigger socket buffers, and a
+// flow controller, LARGE_DATA_FLOW_CONTROLLER, that the stream writers then publish through asynchronously, so frames
+// go out paced rather than in bursts that overflow buffers along the way.
+//
+constexpr char const * LARGE_DATA_FLOW_CONTROLLER = "large-data";
+bool is_large_data_enabled( rsutils::json const & participant_settings );
+
+
 }  // namespace realdds
@@ -10,7 +10,9 @@
 #include <memory>
 #include <string>
 #include <set>
+#include <vector>
 #include <functional>
+#include <atomic>
 
 
 namespace realdds {
@@ -94,11 +96,31 @@ public:
 
     virtual void publish_image( topics::image_msg && );
 
+    // Compression of published images, one of:
+    //     "none"
+    //     "lossless"  Z16 depth, with rsutils::image::depth_codec
+    //     "jpeg"      RGB8/BGR8 color
+    // Images the compression does not apply to are published raw. Subscribers tell from the image encoding, which
+    // becomes "<encoding>; <format>" for compressed images (as with ROS's compressed image transports).
+    // Can be changed while streaming; throws on an unknown compression.
+    void set_compression( std::string const & );
+    std::string get_compression() const;
+
 private:
     void check_profile( std::shared_ptr< dds_stream_profile > const & ) const override;
 
+    enum class compression
+    {
+        none,
+        lossless,
+        jpeg
+    };
+    // Compresses into 'out' and returns the format, or returns null to publish the image raw
+    char const * compress( topics::image_msg const &, uint32_t step, std::vector< uint8_t > & out ) const;
+
     std::set< video_intrinsics > _intrinsics;
     image_header _image_header;
+    std::atomic< compression > _compression;
 };
 
 
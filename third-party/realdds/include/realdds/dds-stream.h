@@ -5,11 +5,14 @@
 
 #include "dds-stream-base.h"
 #include "dds-trinsics.h"
+#include "dds-guid.h"
 
 #include <string>
 #include <vector>
 #include <set>
 #include <functional>
+#include <atomic>
+#include <cstdint>
 
 namespace realdds {
 
@@ -48,12 +51,41 @@ public:
 
     std::shared_ptr< dds_topic > const & get_topic() const override;
 
+    // Since the last open(): samples received, and samples DDS knows were lost on the way (over best-effort, a
+    // single lost fragment of a large frame loses the whole frame)
+    //
+    // The latency is from the sample timestamp to its reception, so is only meaningful when the server timestamps
+    // with a clock synchronized to ours (e.g., global time)
+    struct statistics
+    {
+        uint64_t received = 0;
+        uint64_t lost = 0;
+        uint64_t bytes = 0;  // payload of the samples received
+        double seconds = 0;  // since open()
+        double mean_latency_ms = 0;
+        double max_latency_ms = 0;
+
+        double bytes_per_second() const { return seconds > 0 ? bytes / seconds : 0.; }
+    };
+    statistics get_statistics() const;
+
 protected:
     virtual void handle_data() = 0;
     virtual bool can_start_streaming() const = 0;
 
+    // Called by open() for the reader it creates
+    void init_reader( std::shared_ptr< dds_topic_reader_thread > const & );
+    // Called by handle_data() for each sample received
+    void count_sample( size_t bytes, dds_time const & timestamp, dds_time const & received );
+
     std::shared_ptr< dds_topic_reader_thread > _reader;
     bool _streaming = false;
+    std::atomic< uint64_t > _n_received{ 0 };
+    std::atomic< uint64_t > _n_lost{ 0 };
+    std::atomic< uint64_t > _n_bytes{ 0 };
+    std::atomic< int64_t > _total_latency_us{ 0 };
+    std::atomic< int64_t > _max_latency_us{ 0 };
+    dds_time _open_time;
 };
 
 class dds_video_stream : public dds_stream
@@ -62,8 +94,10 @@ class dds_video_stream : public dds_stream
 
 public:
     dds_video_stream( std::string const & stream_name, std::string const & sensor_name );
+    ~dds_video_stream();
 
     void open( std::string const & topic_name, std::shared_ptr< dds_subscriber > const & ) override;
+    void close() override;
 
     typedef std::function< void( topics::image_msg && f ) > on_data_available_callback;
     void on_data_available( on_data_available_callback cb ) { _on_data_available = cb; }
@@ -73,10 +107,13 @@ public:
 
 protected:
     void handle_data() override;
+    // Images from a server in this process (see dds_intra_process)
+    void handle_local_image( topics::image_msg && );
     bool can_start_streaming() const override { return _on_data_available != nullptr; }
 
     std::set< video_intrinsics > _intrinsics;
     on_data_available_callback _on_data_available = nullptr;
+    dds_guid _local_guid = unknown_guid;  // of our reader, while registered with dds_intra_process
 };
 
 class dds_depth_stream : public dds_video_stream
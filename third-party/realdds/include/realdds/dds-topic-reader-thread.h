@@ -4,6 +4,7 @@
 #pragma once
 
 #include "dds-topic-reader.h"
+#include "dds-reader-executor.h"
 
 #include <fastdds/dds/core/condition/GuardCondition.hpp>
 #include <thread>
@@ -27,10 +28,16 @@ namespace realdds {
 // See also:
 //      https://fast-dds.docs.eprosima.com/en/latest/fastdds/dds_layer/subscriber/dataReader/readingData.html#accessing-data-with-a-waiting-thread
 //
+// With many readers (e.g., several devices with several streams each), a thread apiece is wasteful: given an executor,
+// the reader is instead served by one of the executor's threads.
+//
 class dds_topic_reader_thread : public dds_topic_reader
 {
     typedef dds_topic_reader super;
 
+    std::shared_ptr< dds_reader_executor > const _executor;
+    dds_reader_executor::priority const _priority = dds_reader_executor::priority::normal;
+
     eprosima::fastdds::dds::GuardCondition _stopped;
     std::thread _th;
 
@@ -38,10 +45,19 @@ public:
     dds_topic_reader_thread( std::shared_ptr< dds_topic > const & topic );
     dds_topic_reader_thread( std::shared_ptr< dds_topic > const & topic,
                              std::shared_ptr< dds_subscriber > const & subscriber );
+    dds_topic_reader_thread( std::shared_ptr< dds_topic > const & topic,
+                             std::shared_ptr< dds_subscriber > const & subscriber,
+                             std::shared_ptr< dds_reader_executor > const & executor,
+                             dds_reader_executor::priority = dds_reader_executor::priority::normal );
     ~dds_topic_reader_thread();
 
     void run( qos const & ) override;
     void stop() override;
+
+private:
+    friend class dds_reader_executor;
+    // Call the callbacks for whatever changed since the last call
+    void handle_status_changes();
 };
 
 
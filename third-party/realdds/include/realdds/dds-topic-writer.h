@@ -52,6 +52,7 @@ public:
 
     bool is_running() const { return ( get() != nullptr ); }
     bool has_readers() const { return _n_readers > 0; }
+    int n_readers() const { return _n_readers; }
 
     std::shared_ptr< dds_topic > const & topic() const { return _topic; }
     std::shared_ptr< dds_publisher > const & publisher() const { return _publisher; }
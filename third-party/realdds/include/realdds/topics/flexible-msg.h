@@ -50,6 +50,11 @@ public:
         CUSTOM = raw::FLEXIBLE_DATA_CUSTOM,
     };
 
+    // The format a participant writes its json messages in, from its device/message-format setting: "json" (the
+    // default; readable by anyone) or "cbor" (smaller, and faster to encode and decode). Readers accept either, as the
+    // format is in each message.
+    static data_format preferred_format( rsutils::json const & participant_settings );
+
     bool is_valid() const { return ! _data.empty(); }
     void invalidate() { _data.clear(); }
 
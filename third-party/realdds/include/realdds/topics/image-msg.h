@@ -10,6 +10,8 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <utility>
+#include <cstdint>
 
 
 namespace eprosima {
@@ -38,6 +40,27 @@ class dds_topic_reader;
 namespace topics {
 
 
+// Frame metadata in binary form, carried inside the image sample itself rather than in a separate metadata message,
+// so a subscriber has the complete frame in a single sample with nothing to match up or parse.
+//
+// It is appended to the image data, and its presence indicated by the encoding ending with "; <FORMAT>".
+//
+struct image_metadata
+{
+    static constexpr char const * FORMAT = "rs2_md";
+
+    uint64_t frame_number = 0;
+    int32_t timestamp_domain = 0;
+    float depth_units = 0.f;                                // 0 if not a depth image
+    std::vector< std::pair< uint16_t, int64_t > > values;  // by key: for librealsense, the rs2_frame_metadata_value
+
+    // Appends the binary form to the image data
+    void write_to( std::vector< uint8_t > & data ) const;
+    // Removes the binary form from the end of the image data; returns false if it is not valid
+    bool read_from( std::vector< uint8_t > & data );
+};
+
+
 class image_msg
 {
 public:
@@ -74,9 +97,15 @@ public:
                            eprosima::fastdds::dds::SampleInfo * optional_info = nullptr );
 
     std::vector< uint8_t > raw_data;
+    // As received: the stream encoding, followed by "; <format>" when raw_data is compressed (see
+    // dds_video_stream_server::set_compression). Not used when publishing.
+    std::string encoding;
     int width = -1;
     int height = -1;
     dds_time timestamp;
+    // When publishing, appended to the image if set; when received, set if it was (and removed from raw_data and
+    // the encoding)
+    std::shared_ptr< image_metadata > metadata;
 };
 
 
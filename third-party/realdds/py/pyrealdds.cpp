@@ -879,6 +879,18 @@ PYBIND11_MODULE(NAME, m) {
         .def( "is_open", &dds_stream::is_open )
         .def( "start_streaming", &dds_stream::start_streaming )
         .def( "stop_streaming", &dds_stream::stop_streaming )
+        .def( "statistics",
+              []( dds_stream const & self )
+              {
+                  auto const stats = self.get_statistics();
+                  return json::object( { { "received", stats.received },
+                                         { "lost", stats.lost },
+                                         { "bytes", stats.bytes },
+                                         { "seconds", stats.seconds },
+                                         { "bytes-per-second", stats.bytes_per_second() },
+                                         { "mean-latency-ms", stats.mean_latency_ms },
+                                         { "max-latency-ms", stats.max_latency_ms } } );
+              } )
         .def( "__repr__", []( dds_stream const & self ) {
             std::ostringstream os;
             os << "<" SNAME "." << self.type_string() << "_stream \"" << self.name() << "\"";
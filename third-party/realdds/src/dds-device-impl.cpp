@@ -86,6 +86,8 @@ dds_device::impl::impl( std::shared_ptr< dds_participant > const & participant,
     , _device_settings( device_settings( participant ) )
     , _reply_timeout_ms(
           _device_settings.nested( "control", "reply-timeout-ms" ).default_value< size_t >( 2000 ) )
+    , _cbor_messages( topics::flexible_msg::data_format::CBOR
+                      == topics::flexible_msg::preferred_format( participant->settings() ) )
 {
     create_control_writer();
     create_notifications_reader();
@@ -434,6 +436,15 @@ json dds_device::impl::query_option_value( const std::shared_ptr< dds_option > &
 }
 
 
+void dds_device::impl::write_control_message( json const & j, json * reply )
+{
+    write_control_message( topics::flexible_msg( _cbor_messages ? topics::flexible_msg::data_format::CBOR
+                                                                : topics::flexible_msg::data_format::JSON,
+                                                 j ),
+                           reply );
+}
+
+
 void dds_device::impl::write_control_message( topics::flexible_msg && msg, json * reply )
 {
     assert( _control_writer != nullptr );
@@ -511,7 +522,8 @@ void dds_device::impl::create_metadata_reader()
         return;
 
     auto topic = topics::flexible_msg::create_topic( _participant, _info.topic_root() + topics::METADATA_TOPIC_NAME );
-    _metadata_reader = std::make_shared< dds_topic_reader_thread >( topic, _subscriber );
+    _metadata_reader
+        = std::make_shared< dds_topic_reader_thread >( topic, _subscriber, _participant->reader_executor() );
     _metadata_reader->on_data_available(
         [this]()
         {
@@ -62,6 +62,7 @@ public:
     std::condition_variable _replies_cv;
     std::map< dds_sequence_number, rsutils::json > _replies;
     size_t const _reply_timeout_ms;
+    bool const _cbor_messages;  // controls are sent as CBOR rather than JSON text
 
     std::shared_ptr< dds_topic_reader > _notifications_reader;
     std::shared_ptr< dds_topic_reader > _metadata_reader;
@@ -86,6 +87,8 @@ public:
     void open( const dds_stream_profiles & profiles );
 
     void write_control_message( topics::flexible_msg &&, rsutils::json * reply = nullptr );
+    // In the participant's preferred format
+    void write_control_message( rsutils::json const &, rsutils::json * reply = nullptr );
 
     void set_option_value( const std::shared_ptr< dds_option > & option, rsutils::json new_value );
     rsutils::json query_option_value( const std::shared_ptr< dds_option > & option );
@@ -38,6 +38,8 @@ dds_device_server::dds_device_server( std::shared_ptr< dds_participant > const &
                                       const std::string & topic_root )
     : _publisher( std::make_shared< dds_publisher >( participant ) )
     , _subscriber( std::make_shared< dds_subscriber >( participant ) )
+    , _cbor_messages( topics::flexible_msg::data_format::CBOR
+                      == topics::flexible_msg::preferred_format( participant->settings() ) )
     , _topic_root( topic_root )
     , _control_dispatcher( QUEUE_MAX_SIZE )
 {
@@ -275,11 +277,27 @@ void dds_device_server::publish_notification( topics::flexible_msg && notificati
 }
 
 
+void dds_device_server::publish_notification( json const & notification )
+{
+    publish_notification( topics::flexible_msg( _cbor_messages ? topics::flexible_msg::data_format::CBOR
+                                                               : topics::flexible_msg::data_format::JSON,
+                                                notification ) );
+}
+
+
 void dds_device_server::publish_metadata( json && md )
 {
     if( ! _metadata_writer )
         DDS_THROW( runtime_error, "device '" + _topic_root + "' has no stream with enabled metadata" );
 
+    if( _cbor_messages )
+    {
+        topics::flexible_msg msg( topics::flexible_msg::data_format::CBOR, md );
+        LOG_DEBUG( "publishing metadata: " << shorten_json_string( md.dump(), 300 ) );
+        std::move( msg ).write_to( *_metadata_writer );
+        return;
+    }
+
     topics::flexible_msg msg( md );
     LOG_DEBUG(
         "publishing metadata: " << shorten_json_string( slice( msg.custom_data< char const >(), msg._data.size() ),
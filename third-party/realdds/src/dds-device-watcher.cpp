@@ -11,8 +11,13 @@
 #include <realdds/topics/device-info-msg.h>
 
 #include <rsutils/json.h>
+#include <rsutils/json-config.h>
+#include <rsutils/os/special-folder.h>
 using rsutils::json;
 
+#include <fstream>
+#include <thread>
+
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 
@@ -21,6 +26,13 @@ using namespace eprosima::fastdds::dds;
 using namespace realdds;
 
 
+static int64_t seconds_since_epoch()
+{
+    return std::chrono::duration_cast< std::chrono::seconds >( std::chrono::system_clock::now().time_since_epoch() )
+        .count();
+}
+
+
 dds_device_watcher::dds_device_watcher( std::shared_ptr< dds_participant > const & participant )
     : _device_info_topic(
         new dds_topic_reader_thread( topics::flexible_msg::create_topic( participant, topics::DEVICE_INFO_TOPIC_NAME ) ) )
@@ -51,6 +63,10 @@ dds_device_watcher::dds_device_watcher( std::shared_ptr< dds_participant > const
                     continue;
                 }
 
+                bool const stopping = j.nested( "stopping", &json::is_boolean ).default_value( false );
+                if( ! stopping )
+                    update_cache( root, j );
+
                 {
                     std::lock_guard< std::mutex > lock( _devices_mutex );
                     auto it = _device_by_root.find( root );
@@ -58,7 +74,34 @@ dds_device_watcher::dds_device_watcher( std::shared_ptr< dds_participant > const
                     {
                         auto & device = it->second;
                         device.last_seen = now();
-                        if( j.nested( "stopping", &json::is_boolean ).default_value( false ) )
+                        if( device.alive && device.tentative && ! stopping )
+                        {
+                            // The first broadcast for a device from the cache: it's really there, unless it's not the
+                            // same device anymore...
+                            topics::device_info device_info = topics::device_info::from_json( j );
+                            auto & cached_info = device.alive->device_info();
+                            device.writer_guid = guid;
+                            device.tentative = false;
+                            if( device_info.name() == cached_info.name()
+                                && device_info.serial_number() == cached_info.serial_number() )
+                            {
+                                LOG_DEBUG( "[" << device.alive->debug_name() << "] device (from "
+                                               << _participant->print( guid ) << ") validated" );
+                                // If it's not ready yet (and therefore not reported), it's now just like a new device
+                                if( _on_device_added && ! device.reported->exchange( true ) )
+                                {
+                                    std::thread( [device = device.alive, on_device_added = _on_device_added]()
+                                                 { on_device_added( device ); } )
+                                        .detach();
+                                }
+                                continue;
+                            }
+                            LOG_DEBUG( "[" << device.alive->debug_name() << "] device (from "
+                                           << _participant->print( guid ) << ") changed since it was cached" );
+                            device_discovery_lost( device, lock );
+                            device.in_use.reset();  // don't bring the cached device back to life below
+                        }
+                        if( stopping )
                         {
                             // This device is stopping for whatever reason (e.g., HW reset); remove it
                             if( device.alive )
@@ -108,6 +151,7 @@ dds_device_watcher::dds_device_watcher( std::shared_ptr< dds_participant > const
                     device.alive = new_device;
                     device.writer_guid = guid;
                     device.last_seen = now();
+                    device.tentative = false;
                 }
 
                 // NOTE: device removals are handled via the writer-removed notification; see on_subscription_matched() below
@@ -151,6 +195,22 @@ dds_device_watcher::dds_device_watcher( std::shared_ptr< dds_participant > const
 
     if( ! _participant->is_valid() )
         DDS_THROW( runtime_error, "participant was not initialized" );
+
+    // "device-cache" can be true (for the default path), a path, or an object with a "path" and "ttl-seconds"
+    auto cache_settings = _participant->settings().nested( "device-cache" );
+    int64_t ttl = 24 * 60 * 60;
+    if( cache_settings.is_string() )
+        _cache_path = cache_settings.string_ref();
+    else if( cache_settings.is_object() )
+    {
+        _cache_path = cache_settings.nested( "path" ).string_ref_or_empty();
+        ttl = cache_settings.nested( "ttl-seconds" ).default_value( ttl );
+    }
+    if( _cache_path.empty() && ( cache_settings.is_object() || cache_settings.default_value( false ) ) )
+        _cache_path = rsutils::os::get_special_folder( rsutils::os::special_folder::app_data ) + "realsense-dds-devices-"
+                    + std::to_string( _participant->domain_id() ) + ".json";
+    _cache_ttl = std::chrono::seconds( ttl );
+    _cache = json::object();
 }
 
 
@@ -163,6 +223,7 @@ bool dds_device_watcher::is_stopped() const
 void dds_device_watcher::start()
 {
     stop();
+    load_cache();
     if( ! _device_info_topic->is_running() )
         init();
     LOG_DEBUG( "DDS device watcher started on '" << _participant->get()->get_qos().name() << "' "
@@ -218,6 +279,94 @@ void dds_device_watcher::device_discovery_lost( device_liveliness & device, std:
 }
 
 
+void dds_device_watcher::load_cache()
+{
+    if( _cache_path.empty() )
+        return;
+
+    json cache;
+    try
+    {
+        cache = rsutils::json_config::load_from_file( _cache_path );
+    }
+    catch( std::exception const & e )
+    {
+        LOG_ERROR( "ignoring device cache: " << e.what() );
+        return;
+    }
+    if( ! cache.is_object() )
+        return;
+
+    auto const now_s = seconds_since_epoch();
+    for( auto const & root_entry : cache.items() )
+    {
+        auto const & root = root_entry.key();
+        auto const & entry = root_entry.value();
+        auto info_j = entry.nested( "device-info" );
+        if( ! info_j.is_object()
+            || now_s - entry.nested( "last-seen" ).default_value< int64_t >( 0 ) > _cache_ttl.count() )
+            continue;
+
+        std::shared_ptr< dds_device > new_device;
+        std::shared_ptr< std::atomic< bool > > reported;
+        {
+            std::lock_guard< std::mutex > lock( _devices_mutex );
+            if( ! _cache.contains( root ) )
+                _cache[root] = entry;
+            auto & device = _device_by_root[root];
+            if( device.alive || device.in_use.lock() )
+                continue;  // already known
+            new_device = std::make_shared< dds_device >( _participant, topics::device_info::from_json( info_j ) );
+            reported = std::make_shared< std::atomic< bool > >( false );
+            device.alive = new_device;
+            device.writer_guid = {};
+            device.tentative = true;
+            device.reported = reported;
+        }
+        LOG_DEBUG( "[" << new_device->debug_name() << "] tentative device from cache: " << info_j );
+
+        // Creating it subscribed to its notifications: if the server is there, the device gets ready without waiting
+        // for the broadcast
+        if( _on_device_added )
+        {
+            std::thread(
+                [new_device, reported, on_device_added = _on_device_added]()
+                {
+                    try
+                    {
+                        new_device->wait_until_ready();
+                    }
+                    catch( std::exception const & )
+                    {
+                        // Not there (yet?); if it comes back, its broadcast will report it
+                        return;
+                    }
+                    if( ! reported->exchange( true ) )
+                        on_device_added( new_device );
+                } )
+                .detach();
+        }
+    }
+}
+
+
+void dds_device_watcher::update_cache( std::string const & root, json const & device_info )
+{
+    if( _cache_path.empty() )
+        return;
+
+    std::string contents;
+    {
+        std::lock_guard< std::mutex > lock( _devices_mutex );
+        _cache[root] = json::object( { { "device-info", device_info }, { "last-seen", seconds_since_epoch() } } );
+        contents = _cache.dump( 4 );
+    }
+    std::ofstream f( _cache_path );
+    if( ! ( f << contents ) )
+        LOG_ERROR( "failed to write device cache '" << _cache_path << "'" );
+}
+
+
 bool dds_device_watcher::foreach_device(
     std::function< bool( std::shared_ptr< dds_device > const & ) > fn ) const
 {
@@ -240,6 +389,17 @@ bool dds_device_watcher::is_device_broadcast( std::shared_ptr< dds_device > cons
     auto it = _device_by_root.find( root );
     if( it == _device_by_root.end() )
         return false;
-    return !! it->second.alive;
+    return it->second.alive && ! it->second.tentative;
+}
+
+
+bool dds_device_watcher::is_device_tentative( std::shared_ptr< dds_device > const & dev ) const
+{
+    auto & root = dev->device_info().topic_root();
+    std::lock_guard< std::mutex > lock( _devices_mutex );
+    auto it = _device_by_root.find( root );
+    if( it == _device_by_root.end() )
+        return false;
+    return it->second.alive && it->second.tentative;
 }
 
@@ -209,6 +209,12 @@ void dds_device::send_control( topics::flexible_msg && msg, json * reply )
     _impl->write_control_message( std::move( msg ), reply );
 }
 
+void dds_device::send_control( json const & j, json * reply )
+{
+    wait_until_ready( 0 );  // throw if not
+    _impl->write_control_message( j, reply );
+}
+
 bool dds_device::has_extrinsics() const
 {
     return ! _impl->_extrinsics_map.empty();
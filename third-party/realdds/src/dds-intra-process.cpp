@@ -0,0 +1,138 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <realdds/dds-intra-process.h>
+#include <realdds/topics/image-msg.h>
+#include <realdds/dds-utilities.h>
+
+#include <algorithm>
+
+
+namespace realdds {
+
+
+dds_intra_process & dds_intra_process::instance()
+{
+    // Never destroyed: streams may still go away during static destruction
+    static auto the_instance = new dds_intra_process();
+    return *the_instance;
+}
+
+
+void dds_intra_process::add_reader( dds_domain_id domain,
+                                    std::string const & topic_name,
+                                    dds_guid const & guid,
+                                    on_image_callback callback )
+{
+    auto r = std::make_shared< reader >();
+    r->guid = guid;
+    r->callback = std::move( callback );
+    std::lock_guard< std::mutex > lock( _mutex );
+    _readers[{ domain, topic_name }].push_back( std::move( r ) );
+}
+
+
+void dds_intra_process::remove_reader( dds_guid const & guid )
+{
+    std::shared_ptr< reader > removed;
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        for( auto it = _readers.begin(); it != _readers.end() && ! removed; ++it )
+        {
+            auto & readers = it->second;
+            auto r = std::find_if( readers.begin(),
+                                   readers.end(),
+                                   [&]( std::shared_ptr< reader > const & r ) { return r->guid == guid; } );
+            if( r == readers.end() )
+                continue;
+            removed = *r;
+            readers.erase( r );
+            if( readers.empty() )
+                _readers.erase( it );
+        }
+    }
+    if( removed )
+    {
+        // Wait for a delivery in progress
+        std::lock_guard< std::recursive_mutex > lock( removed->mutex );
+        removed->callback = nullptr;
+    }
+}
+
+
+bool dds_intra_process::is_local_writer( dds_guid const & guid ) const
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    return _writers.find( guid ) != _writers.end();
+}
+
+
+void dds_intra_process::add_writer( dds_domain_id domain, std::string const & topic_name, dds_guid const & guid )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    _writers[guid] = { domain, topic_name };
+}
+
+
+void dds_intra_process::remove_writer( dds_guid const & guid )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    _writers.erase( guid );
+}
+
+
+size_t dds_intra_process::readers_of( dds_guid const & writer ) const
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    auto w = _writers.find( writer );
+    if( w == _writers.end() )
+        return 0;
+    auto r = _readers.find( w->second );
+    return r == _readers.end() ? 0 : r->second.size();
+}
+
+
+size_t dds_intra_process::deliver( dds_guid const & writer, topics::image_msg & image, bool keep )
+{
+    std::vector< std::shared_ptr< reader > > readers;
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        auto w = _writers.find( writer );
+        if( w == _writers.end() )
+            return 0;
+        auto r = _readers.find( w->second );
+        if( r == _readers.end() )
+            return 0;
+        readers = r->second;
+    }
+
+    for( size_t i = 0; i < readers.size(); ++i )
+    {
+        topics::image_msg copy;
+        bool const last = ! keep && i + 1 == readers.size();
+        if( ! last )
+        {
+            copy.raw_data = image.raw_data;
+            copy.encoding = image.encoding;
+            copy.width = image.width;
+            copy.height = image.height;
+            copy.timestamp = image.timestamp;
+            copy.metadata = image.metadata;  // not changed by readers
+        }
+        std::lock_guard< std::recursive_mutex > lock( readers[i]->mutex );
+        if( ! readers[i]->callback )
+            continue;
+        try
+        {
+            readers[i]->callback( last ? std::move( image ) : std::move( copy ) );
+        }
+        catch( std::exception const & e )
+        {
+            LOG_ERROR( "intra-process delivery to " << realdds::print_guid( readers[i]->guid ) << " failed: " << e.what() );
+        }
+    }
+    return readers.size();
+}
+
+
+}  // namespace realdds
@@ -6,6 +6,7 @@
 #include <realdds/dds-guid.h>
 #include <realdds/dds-time.h>
 #include <realdds/dds-serialization.h>
+#include <realdds/dds-reader-executor.h>
 
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/domain/DomainParticipantListener.hpp>
@@ -275,6 +276,12 @@ dds_participant::~dds_participant()
 }
 
 
+std::shared_ptr< dds_reader_executor > dds_participant::reader_executor()
+{
+    return _reader_executor.instance( _settings.nested( "reader-threads" ).default_value< size_t >( 2 ) );
+}
+
+
 dds_guid const & dds_participant::guid() const
 {
     return get()->guid();
@@ -0,0 +1,112 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <realdds/dds-reader-executor.h>
+#include <realdds/dds-topic-reader-thread.h>
+#include <realdds/dds-utilities.h>
+
+#include <fastdds/dds/subscriber/DataReader.hpp>
+
+#include <algorithm>
+
+
+namespace realdds {
+
+
+dds_reader_executor::dds_reader_executor( size_t n_threads )
+{
+    _lanes.resize( std::max( n_threads, size_t( 1 ) ) );
+    for( auto & l : _lanes )
+    {
+        l = std::make_shared< lane >();
+        l->wait_set.attach_condition( l->stopped );
+        l->th = std::thread( [l]() { run( *l ); } );
+    }
+}
+
+
+dds_reader_executor::~dds_reader_executor()
+{
+    for( auto & l : _lanes )
+        l->stopped.set_trigger_value( true );
+    for( auto & l : _lanes )
+    {
+        if( l->th.get_id() == std::this_thread::get_id() )
+            l->th.detach();  // the last reader was destroyed from its own callback; the lane will exit by itself
+        else if( l->th.joinable() )
+            l->th.join();
+    }
+}
+
+
+void dds_reader_executor::add( dds_topic_reader_thread * reader, priority p )
+{
+    lane * l;
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        std::map< lane const *, size_t > n_readers;
+        for( auto & lr : _lane_by_reader )
+            ++n_readers[lr.second];
+        l = std::min_element( _lanes.begin(),
+                              _lanes.end(),
+                              [&]( std::shared_ptr< lane > const & a, std::shared_ptr< lane > const & b )
+                              { return n_readers[a.get()] < n_readers[b.get()]; } )
+                ->get();
+        _lane_by_reader[reader] = l;
+    }
+
+    auto & condition = reader->get()->get_statuscondition();
+    {
+        std::lock_guard< std::recursive_mutex > lock( l->mutex );
+        l->readers[&condition] = { reader, p };
+    }
+    l->wait_set.attach_condition( condition );
+}
+
+
+void dds_reader_executor::remove( dds_topic_reader_thread * reader )
+{
+    lane * l;
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        auto it = _lane_by_reader.find( reader );
+        if( it == _lane_by_reader.end() )
+            return;
+        l = it->second;
+        _lane_by_reader.erase( it );
+    }
+
+    auto & condition = reader->get()->get_statuscondition();
+    std::lock_guard< std::recursive_mutex > lock( l->mutex );
+    l->wait_set.detach_condition( condition );
+    l->readers.erase( &condition );
+}
+
+
+/*static*/ void dds_reader_executor::run( lane & l )
+{
+    while( ! l.stopped.get_trigger_value() )
+    {
+        eprosima::fastdds::dds::ConditionSeq active_conditions;
+        l.wait_set.wait( active_conditions, eprosima::fastrtps::c_TimeInfinite );
+
+        if( l.stopped.get_trigger_value() )
+            break;
+
+        // The conditions may belong to readers that have since been removed (and even destroyed), so we only go by
+        // what's still in our map
+        std::lock_guard< std::recursive_mutex > lock( l.mutex );
+        for( auto p : { priority::high, priority::normal } )
+        {
+            for( auto condition : active_conditions )
+            {
+                auto it = l.readers.find( condition );
+                if( it != l.readers.end() && it->second.second == p )
+                    it->second.first->handle_status_changes();
+            }
+        }
+    }
+}
+
+
+}  // namespace realdds
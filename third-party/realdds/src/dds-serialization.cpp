@@ -10,11 +10,15 @@
 
 #include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
 #include <fastdds/rtps/transport/UDPTransportDescriptor.h>
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+#include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
 
 #include <rsutils/string/from.h>
 #include <rsutils/string/nocase.h>
 #include <rsutils/json.h>
 
+#include <algorithm>
+
 
 namespace eprosima {
 namespace fastdds {
@@ -244,6 +248,30 @@ eprosima::fastrtps::rtps::MemoryManagementPolicy_t history_memory_policy_from_st
 }
 
 
+eprosima::fastdds::dds::PublishModeQosPolicyKind publish_mode_kind_from_string( std::string const & s )
+{
+    if( s == "synchronous" )
+        return eprosima::fastdds::dds::SYNCHRONOUS_PUBLISH_MODE;
+    if( s == "asynchronous" )
+        return eprosima::fastdds::dds::ASYNCHRONOUS_PUBLISH_MODE;
+    DDS_THROW( runtime_error, "invalid publish mode '" << s << "'" );
+}
+
+
+static eprosima::fastdds::rtps::FlowControllerSchedulerPolicy flow_controller_scheduler_from_string( std::string const & s )
+{
+    if( s == "fifo" )
+        return eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::FIFO;
+    if( s == "round-robin" )
+        return eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::ROUND_ROBIN;
+    if( s == "high-priority" )
+        return eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::HIGH_PRIORITY;
+    if( s == "priority-with-reservation" )
+        return eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION;
+    DDS_THROW( runtime_error, "invalid flow controller scheduler '" << s << "'" );
+}
+
+
 void override_reliability_qos_from_json( eprosima::fastdds::dds::ReliabilityQosPolicy & qos, rsutils::json const & j )
 {
     if( j.is_string() )
@@ -338,6 +366,45 @@ void override_endpoint_qos_from_json( eprosima::fastdds::dds::RTPSEndpointQos &
 }
 
 
+void override_publish_mode_qos_from_json( eprosima::fastdds::dds::PublishModeQosPolicy & qos, rsutils::json const & j )
+{
+    if( j.is_string() )
+        qos.kind = publish_mode_kind_from_string( j.string_ref() );
+    else if( j.is_object() )
+    {
+        if( auto controller_j = j.nested( "flow-controller", &rsutils::json::is_string ) )
+        {
+            qos.kind = eprosima::fastdds::dds::ASYNCHRONOUS_PUBLISH_MODE;
+            qos.flow_controller_name = controller_j.string_ref().c_str();
+        }
+        if( auto kind_j = j.nested( "kind", &rsutils::json::is_string ) )
+            qos.kind = publish_mode_kind_from_string( kind_j.string_ref() );
+    }
+}
+
+
+static void override_flow_controller_from_json( eprosima::fastdds::rtps::FlowControllerDescriptor & controller,
+                                                rsutils::json const & j )
+{
+    if( j.is_object() )
+    {
+        j.nested( "max-bytes-per-period" ).get_ex( controller.max_bytes_per_period );
+        j.nested( "period-ms" ).get_ex( controller.period_ms );
+        if( auto scheduler_j = j.nested( "scheduler", &rsutils::json::is_string ) )
+            controller.scheduler = flow_controller_scheduler_from_string( scheduler_j.string_ref() );
+    }
+    else if( j.exists() && ! j.is_boolean() )
+        DDS_THROW( runtime_error, "flow controller '" << controller.name << "' must be an object; got " << j );
+}
+
+
+bool is_large_data_enabled( rsutils::json const & participant_settings )
+{
+    auto j = participant_settings.nested( "large-data" );
+    return j.is_object() || j.default_value( false );
+}
+
+
 static bool parse_ip_list( rsutils::json const & j, std::string const & key, std::vector< std::string > * output )
 {
     if( auto whitelist_j = j.nested( key ) )
@@ -373,6 +440,36 @@ void override_participant_qos_from_json( eprosima::fastdds::dds::DomainParticipa
     j.nested( "lease-duration" ).get_ex( qos.wire_protocol().builtin.discovery_config.leaseDuration );
 
     j.nested( "use-builtin-transports" ).get_ex( qos.transport().use_builtin_transports );
+    if( is_large_data_enabled( j ) )
+    {
+        // A 1280x720 depth frame is ~1.8MB; by default, pace out about 25MB/sec, 256KB at a time
+        auto controller = std::make_shared< eprosima::fastdds::rtps::FlowControllerDescriptor >();
+        controller->name = LARGE_DATA_FLOW_CONTROLLER;
+        controller->max_bytes_per_period = 256 * 1024;
+        controller->period_ms = 10;
+        override_flow_controller_from_json( *controller, j.nested( "large-data" ) );
+        qos.flow_controllers().push_back( controller );
+
+        // Room for a few frames' worth of fragments either way; "udp" can still override
+        for( auto t : qos.transport().user_transports )
+            if( auto udp_t = std::dynamic_pointer_cast< eprosima::fastdds::rtps::UDPTransportDescriptor >( t ) )
+            {
+                udp_t->sendBufferSize = std::max( udp_t->sendBufferSize, uint32_t( 32 * 1024 * 1024 ) );
+                udp_t->receiveBufferSize = std::max( udp_t->receiveBufferSize, uint32_t( 32 * 1024 * 1024 ) );
+            }
+    }
+    if( auto controllers_j = j.nested( "flow-controllers" ) )
+    {
+        if( ! controllers_j.is_object() )
+            DDS_THROW( runtime_error, "flow-controllers must be an object; got " << controllers_j );
+        for( auto it = controllers_j.begin(); it != controllers_j.end(); ++it )
+        {
+            auto controller = std::make_shared< eprosima::fastdds::rtps::FlowControllerDescriptor >();
+            controller->name = it.key().c_str();
+            override_flow_controller_from_json( *controller, it.value() );
+            qos.flow_controllers().push_back( controller );
+        }
+    }
     if( auto udp_j = j.nested( "udp" ) )
     {
         for( auto t : qos.transport().user_transports )
@@ -382,6 +479,26 @@ void override_participant_qos_from_json( eprosima::fastdds::dds::DomainParticipa
                 break;
             }
     }
+    if( auto shm_j = j.nested( "shm" ) )
+    {
+        // Participants on the same host then exchange samples through shared memory rather than the network stack;
+        // UDP is still there for everyone else (and for discovery)
+        bool enabled = true;
+        if( shm_j.is_boolean() )
+            enabled = shm_j.get< bool >();
+        else if( ! shm_j.is_object() )
+            DDS_THROW( runtime_error, "shm must be a boolean or an object; got " << shm_j );
+        if( enabled )
+        {
+            auto shm_t = std::make_shared< eprosima::fastdds::rtps::SharedMemTransportDescriptor >();
+            uint32_t segment_size;
+            if( shm_j.nested( "segment-size" ).get_ex( segment_size ) )
+                shm_t->segment_size( segment_size );
+            // First, so it is preferred to UDP where both reach
+            auto & transports = qos.transport().user_transports;
+            transports.insert( transports.begin(), shm_t );
+        }
+    }
 }
 
 
@@ -8,16 +8,26 @@
 #include <realdds/dds-participant.h>
 #include <realdds/dds-publisher.h>
 #include <realdds/dds-utilities.h>
+#include <realdds/dds-serialization.h>
 #include <realdds/topics/image-msg.h>
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/flexible-msg.h>
 #include <realdds/topics/ros2/ros2imagePubSubTypes.h>
 #include <realdds/topics/ros2/ros2imuPubSubTypes.h>
 #include <realdds/dds-time.h>
+#include <realdds/dds-intra-process.h>
+
+#include <rsutils/json.h>
+#include <rsutils/image/depth-codec.h>
 
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/publisher/DataWriter.hpp>
 
+#define STB_IMAGE_WRITE_STATIC
+#define STBI_WRITE_NO_STDIO
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "../../stb_image_write.h"
+
 
 namespace realdds {
 
@@ -30,11 +40,13 @@ dds_stream_server::dds_stream_server( std::string const & stream_name, std::stri
 
 dds_stream_server::~dds_stream_server()
 {
+    close();
 }
 
 
 dds_video_stream_server::dds_video_stream_server( std::string const& stream_name, std::string const& sensor_name )
     : dds_stream_server( stream_name, sensor_name )
+    , _compression( compression::none )
 {
 }
 
@@ -97,6 +109,7 @@ void dds_video_stream_server::open( std::string const & topic_name, std::shared_
 
 
     run_stream();
+    dds_intra_process::instance().add_writer( publisher->get_participant()->domain_id(), topic_name, _writer->guid() );
 }
 
 void dds_stream_server::run_stream()
@@ -125,7 +138,16 @@ void dds_stream_server::run_stream()
             } );
     }
     
-    _writer->run( dds_topic_writer::qos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS ) );  // no retries
+    dds_topic_writer::qos wqos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS );  // no retries
+    auto & settings = _writer->topic()->get_participant()->settings();
+    if( is_large_data_enabled( settings ) )
+    {
+        // Frames get queued and sent by the flow controller's thread, paced, rather than all at once by write()
+        wqos.publish_mode().kind = eprosima::fastdds::dds::ASYNCHRONOUS_PUBLISH_MODE;
+        wqos.publish_mode().flow_controller_name = LARGE_DATA_FLOW_CONTROLLER;
+    }
+    wqos.override_from_json( settings.nested( "device", "stream" ) );
+    _writer->run( wqos );
 }
 
 
@@ -194,6 +216,8 @@ void dds_video_stream_server::stop_streaming()
 
 void dds_stream_server::close()
 {
+    if( _writer )
+        dds_intra_process::instance().remove_writer( _writer->guid() );
     _writer.reset();
 }
 
@@ -211,6 +235,18 @@ void dds_video_stream_server::publish_image( topics::image_msg && image )
                    "image width (" + std::to_string( image.width ) + ") does not match stream header ("
                        + std::to_string( _image_header.width ) + ")" );
 
+    // Readers in this process get the image as is; it only goes over DDS if there are readers elsewhere, too
+    auto & intra_process = dds_intra_process::instance();
+    auto const n_local = intra_process.readers_of( _writer->guid() );
+    if( n_local )
+    {
+        bool const remote = size_t( _writer->n_readers() ) > n_local;
+        image.encoding = _image_header.encoding.to_string();
+        intra_process.deliver( _writer->guid(), image, remote );
+        if( ! remote )
+            return;
+    }
+
     // LOG_DEBUG( "publishing a DDS video frame for topic: " << _writer->topic()->get()->get_name() );
     sensor_msgs::msg::Image raw_image;
     
@@ -235,13 +271,99 @@ void dds_video_stream_server::publish_image( topics::image_msg && image )
 
     raw_image.is_bigendian() = false;
 
-    raw_image.data() = std::move( image.raw_data );
+    if( auto format = compress( image, raw_image.step(), raw_image.data() ) )
+        raw_image.encoding() += std::string( "; " ) + format;
+    else
+        raw_image.data() = std::move( image.raw_data );
+
+    if( image.metadata )
+    {
+        image.metadata->write_to( raw_image.data() );
+        raw_image.encoding() += std::string( "; " ) + topics::image_metadata::FORMAT;
+    }
 
     LOG_DEBUG( "publishing '" << name() << "' " << raw_image.encoding() << " frame @ " << time_to_string( image.timestamp ) );
     DDS_API_CALL( _writer->get()->write( &raw_image ) );
 }
 
 
+void dds_video_stream_server::set_compression( std::string const & name )
+{
+    if( name == "none" )
+        _compression = compression::none;
+    else if( name == "lossless" )
+        _compression = compression::lossless;
+    else if( name == "jpeg" )
+        _compression = compression::jpeg;
+    else
+        DDS_THROW( runtime_error, "invalid compression '" + name + "' for stream '" + this->name() + "'" );
+}
+
+
+std::string dds_video_stream_server::get_compression() const
+{
+    switch( _compression.load() )
+    {
+    case compression::lossless: return "lossless";
+    case compression::jpeg: return "jpeg";
+    default: return "none";
+    }
+}
+
+
+char const * dds_video_stream_server::compress( topics::image_msg const & image,
+                                                uint32_t step,
+                                                std::vector< uint8_t > & out ) const
+{
+    static constexpr int JPEG_QUALITY = 90;
+
+    auto const format = _image_header.encoding.to_string();
+    switch( _compression.load() )
+    {
+    case compression::lossless:
+        if( format != "16UC1" )
+            break;
+        {
+            rsutils::image::depth_codec::image_info info;
+            info.width = uint32_t( image.width );
+            info.height = uint32_t( image.height );
+            info.step = step;
+            info.depth_units = 0.f;  // the metadata carries them
+            rsutils::image::depth_codec::encode( info, image.raw_data.data(), out );
+        }
+        return rsutils::image::depth_codec::FORMAT;
+
+    case compression::jpeg:
+        // stb takes the pixels without padding
+        if( ( format != "rgb8" && format != "RGB2" ) || step != uint32_t( image.width ) * 3 )
+            break;
+        out.reserve( image.raw_data.size() / 4 );
+        if( ! stbi_write_jpg_to_func(
+                []( void * context, void * data, int size )
+                {
+                    auto & v = *static_cast< std::vector< uint8_t > * >( context );
+                    v.insert( v.end(), static_cast< uint8_t * >( data ), static_cast< uint8_t * >( data ) + size );
+                },
+                &out,
+                image.width,
+                image.height,
+                3,
+                image.raw_data.data(),
+                JPEG_QUALITY ) )
+        {
+            LOG_ERROR( "failed to compress '" << name() << "' image; publishing it raw" );
+            out.clear();
+            break;
+        }
+        return "jpeg";
+
+    default:
+        break;
+    }
+    return nullptr;
+}
+
+
 void dds_motion_stream_server::publish_motion( topics::imu_msg && imu )
 {
     if( ! is_streaming() )
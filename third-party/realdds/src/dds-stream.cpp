@@ -6,10 +6,14 @@
 #include <realdds/dds-topic.h>
 #include <realdds/dds-topic-reader-thread.h>
 #include <realdds/dds-subscriber.h>
+#include <realdds/dds-participant.h>
 #include <realdds/topics/image-msg.h>
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/flexible-msg.h>
 #include <realdds/dds-exceptions.h>
+#include <realdds/dds-utilities.h>
+#include <realdds/dds-time.h>
+#include <realdds/dds-intra-process.h>
 
 #include <rsutils/json.h>
 
@@ -37,9 +41,32 @@ void dds_video_stream::open( std::string const & topic_name, std::shared_ptr< dd
 
     // To support automatic streaming (without the need to handle start/stop-streaming commands) the reader is created
     // here and destroyed on close()
-    _reader = std::make_shared< dds_topic_reader_thread >( topic, subscriber );
-    _reader->on_data_available( [this]() { handle_data(); } );
-    _reader->run( dds_topic_reader::qos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS ) );  // no retries
+    init_reader( std::make_shared< dds_topic_reader_thread >( topic,
+                                                              subscriber,
+                                                              subscriber->get_participant()->reader_executor(),
+                                                              dds_reader_executor::priority::high ) );
+    dds_topic_reader::qos rqos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS );  // no retries
+    rqos.override_from_json( subscriber->get_participant()->settings().nested( "device", "stream" ) );
+    _reader->run( rqos );
+
+    // A server in this process hands us its images directly
+    _local_guid = _reader->get()->guid();
+    dds_intra_process::instance().add_reader( subscriber->get_participant()->domain_id(),
+                                              topic_name,
+                                              _local_guid,
+                                              [this]( topics::image_msg && image )
+                                              { handle_local_image( std::move( image ) ); } );
+}
+
+
+void dds_video_stream::close()
+{
+    if( _local_guid != unknown_guid )
+    {
+        dds_intra_process::instance().remove_reader( _local_guid );
+        _local_guid = unknown_guid;
+    }
+    super::close();
 }
 
 
@@ -55,14 +82,75 @@ void dds_motion_stream::open( std::string const & topic_name, std::shared_ptr< d
 
     // To support automatic streaming (without the need to handle start/stop-streaming commands) the reader is created
     // here and destroyed on close()
-    _reader = std::make_shared< dds_topic_reader_thread >( topic, subscriber );
+    init_reader( std::make_shared< dds_topic_reader_thread >( topic,
+                                                              subscriber,
+                                                              subscriber->get_participant()->reader_executor() ) );
+    dds_topic_reader::qos rqos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS );  // no retries
+    rqos.override_from_json( subscriber->get_participant()->settings().nested( "device", "stream" ) );
+    _reader->run( rqos );
+}
+
+
+void dds_stream::init_reader( std::shared_ptr< dds_topic_reader_thread > const & reader )
+{
+    _reader = reader;
+    _n_received = 0;
+    _n_lost = 0;
+    _n_bytes = 0;
+    _total_latency_us = 0;
+    _max_latency_us = 0;
+    _open_time = now();
     _reader->on_data_available( [this]() { handle_data(); } );
-    _reader->run( dds_topic_reader::qos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS ) );  // no retries
+    _reader->on_sample_lost(
+        [this]( eprosima::fastdds::dds::SampleLostStatus const & status )
+        {
+            _n_lost = status.total_count;
+            LOG_DEBUG( "'" << name() << "' lost " << status.total_count_change << " samples (" << status.total_count
+                           << " of " << _n_received + _n_lost << " since open)" );
+        } );
+}
+
+
+void dds_stream::count_sample( size_t bytes, dds_time const & timestamp, dds_time const & received )
+{
+    ++_n_received;
+    _n_bytes += bytes;
+    auto const latency_us = ( received.to_ns() - timestamp.to_ns() ) / 1000;
+    _total_latency_us += latency_us;
+    auto max_us = _max_latency_us.load();
+    while( latency_us > max_us && ! _max_latency_us.compare_exchange_weak( max_us, latency_us ) )
+        ;
+}
+
+
+dds_stream::statistics dds_stream::get_statistics() const
+{
+    statistics stats;
+    stats.received = _n_received;
+    stats.lost = _n_lost;
+    stats.bytes = _n_bytes;
+    if( _reader )
+        stats.seconds = double( now().to_ns() - _open_time.to_ns() ) / 1e9;
+    if( stats.received )
+    {
+        stats.mean_latency_ms = _total_latency_us / 1000. / stats.received;
+        stats.max_latency_ms = _max_latency_us / 1000.;
+    }
+    return stats;
 }
 
 
 void dds_stream::close()
 {
+    if( _reader )
+    {
+        auto const stats = get_statistics();
+        if( stats.lost )
+            LOG_INFO( "'" << name() << "' received " << stats.received << " samples and lost " << stats.lost );
+        LOG_DEBUG( "'" << name() << "' received " << stats.bytes << " bytes in " << stats.seconds
+                       << " seconds; latency mean " << stats.mean_latency_ms << " ms, max " << stats.max_latency_ms
+                       << " ms" );
+    }
     _reader.reset();
 }
 
@@ -88,19 +176,35 @@ void dds_video_stream::handle_data()
     {
         if( ! frame.is_valid() )
             continue;
+        // Already handed to us directly
+        if( dds_intra_process::instance().is_local_writer( info.sample_identity.writer_guid() ) )
+            continue;
 
+        count_sample( frame.raw_data.size(), frame.timestamp, time_from( info.reception_timestamp ) );
         if( is_streaming() && _on_data_available )
             _on_data_available( std::move( frame ) );
     }
 }
 
 
+void dds_video_stream::handle_local_image( topics::image_msg && image )
+{
+    count_sample( image.raw_data.size(), image.timestamp, now() );
+    if( is_streaming() && _on_data_available )
+        _on_data_available( std::move( image ) );
+}
+
+
 void dds_motion_stream::handle_data()
 {
     topics::imu_msg imu;
     eprosima::fastdds::dds::SampleInfo info;
     while( _reader && topics::imu_msg::take_next( *_reader, &imu, &info ) )
     {
+        if( ! imu.is_valid() )
+            continue;
+
+        count_sample( sizeof( imu.imu_data() ), imu.timestamp(), time_from( info.reception_timestamp ) );
         if( is_streaming() && _on_data_available )
             _on_data_available( std::move( imu ) );
     }
@@ -128,6 +232,14 @@ dds_video_stream::dds_video_stream( std::string const & stream_name, std::string
 }
 
 
+dds_video_stream::~dds_video_stream()
+{
+    // Our callback must not be called once we're gone
+    if( _local_guid != unknown_guid )
+        dds_intra_process::instance().remove_reader( _local_guid );
+}
+
+
 dds_depth_stream::dds_depth_stream( std::string const & stream_name, std::string const & sensor_name )
     : super( stream_name, sensor_name )
 {
@@ -28,6 +28,17 @@ dds_topic_reader_thread::dds_topic_reader_thread( std::shared_ptr< dds_topic > c
 }
 
 
+dds_topic_reader_thread::dds_topic_reader_thread( std::shared_ptr< dds_topic > const & topic,
+                                                  std::shared_ptr< dds_subscriber > const & subscriber,
+                                                  std::shared_ptr< dds_reader_executor > const & executor,
+                                                  dds_reader_executor::priority priority )
+    : super( topic, subscriber )
+    , _executor( executor )
+    , _priority( priority )
+{
+}
+
+
 dds_topic_reader_thread::~dds_topic_reader_thread()
 {
     stop();  // Make sure thread is stopped!
@@ -40,17 +51,21 @@ void dds_topic_reader_thread::run( qos const & rqos )
         DDS_THROW( runtime_error, "on-data-available must be provided" );
 
     _reader = DDS_API_CALL( _subscriber->get()->create_datareader( _topic->get(), rqos ) );
-    
+    _reader->get_statuscondition().set_enabled_statuses( eprosima::fastdds::dds::StatusMask::data_available()
+                                                         << eprosima::fastdds::dds::StatusMask::subscription_matched()
+                                                         << eprosima::fastdds::dds::StatusMask::sample_lost() );
+
+    if( _executor )
+    {
+        _executor->add( this, _priority );
+        return;
+    }
+
     _th = std::thread(
         [this, name = _topic->get()->get_name()]()
         {
             eprosima::fastdds::dds::WaitSet wait_set;
-            auto & condition = _reader->get_statuscondition();
-            condition.set_enabled_statuses( eprosima::fastdds::dds::StatusMask::data_available()
-                                            << eprosima::fastdds::dds::StatusMask::subscription_matched()
-                                            << eprosima::fastdds::dds::StatusMask::sample_lost() );
-            wait_set.attach_condition( condition );
-
+            wait_set.attach_condition( _reader->get_statuscondition() );
             wait_set.attach_condition( _stopped );
 
             while( ! _stopped.get_trigger_value() )
@@ -61,30 +76,38 @@ void dds_topic_reader_thread::run( qos const & rqos )
                 if( _stopped.get_trigger_value() )
                     break;
 
-                auto & changed = _reader->get_status_changes();
-                if( changed.is_active( eprosima::fastdds::dds::StatusMask::sample_lost() ) )
-                {
-                    eprosima::fastdds::dds::SampleLostStatus status;
-                    _reader->get_sample_lost_status( status );
-                    on_sample_lost( _reader, status );
-                }
-                if( changed.is_active( eprosima::fastdds::dds::StatusMask::data_available() ) )
-                {
-                    on_data_available( _reader );
-                }
-                if( changed.is_active( eprosima::fastdds::dds::StatusMask::subscription_matched() ) )
-                {
-                    eprosima::fastdds::dds::SubscriptionMatchedStatus status;
-                    _reader->get_subscription_matched_status( status );
-                    on_subscription_matched( _reader, status );
-                }
+                handle_status_changes();
             }
         } );
 }
 
 
+void dds_topic_reader_thread::handle_status_changes()
+{
+    auto & changed = _reader->get_status_changes();
+    if( changed.is_active( eprosima::fastdds::dds::StatusMask::sample_lost() ) )
+    {
+        eprosima::fastdds::dds::SampleLostStatus status;
+        _reader->get_sample_lost_status( status );
+        on_sample_lost( _reader, status );
+    }
+    if( changed.is_active( eprosima::fastdds::dds::StatusMask::data_available() ) )
+    {
+        on_data_available( _reader );
+    }
+    if( changed.is_active( eprosima::fastdds::dds::StatusMask::subscription_matched() ) )
+    {
+        eprosima::fastdds::dds::SubscriptionMatchedStatus status;
+        _reader->get_subscription_matched_status( status );
+        on_subscription_matched( _reader, status );
+    }
+}
+
+
 void dds_topic_reader_thread::stop()
 {
+    if( _executor && _reader )
+        _executor->remove( this );
     if( _th.joinable() )
     {
         _stopped.set_trigger_value( true );
@@ -97,6 +97,7 @@ void dds_topic_writer::qos::override_from_json( rsutils::json const & qos_settin
     override_liveliness_qos_from_json( liveliness(), qos_settings.nested( "liveliness" ) );
     override_data_sharing_qos_from_json( data_sharing(), qos_settings.nested( "data-sharing" ) );
     override_endpoint_qos_from_json( endpoint(), qos_settings.nested( "endpoint" ) );
+    override_publish_mode_qos_from_json( publish_mode(), qos_settings.nested( "publish-mode" ) );
 }
 
 
@@ -59,6 +59,17 @@ flexible_msg::flexible_msg( data_format format, rsutils::json const & j, uint32_
 }
 
 
+/*static*/ flexible_msg::data_format flexible_msg::preferred_format( rsutils::json const & participant_settings )
+{
+    std::string format;
+    if( ! participant_settings.nested( "device", "message-format" ).get_ex( format ) || format == "json" )
+        return data_format::JSON;
+    if( format == "cbor" )
+        return data_format::CBOR;
+    DDS_THROW( runtime_error, "invalid device/message-format '" << format << "'; expecting 'json' or 'cbor'" );
+}
+
+
 /*static*/ std::shared_ptr< dds_topic >
 flexible_msg::create_topic( std::shared_ptr< dds_participant > const & participant, char const * topic_name )
 {
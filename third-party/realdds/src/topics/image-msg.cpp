@@ -12,27 +12,111 @@
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 
 namespace realdds {
 namespace topics {
 
 
+// Layout, little-endian: frame_number, timestamp_domain, depth_units, value count, (key, value) pairs, and finally
+// the size of all of the above, so it can be found from the end of the data
+static constexpr size_t METADATA_FIXED_SIZE = sizeof( uint64_t ) + sizeof( int32_t ) + sizeof( float ) + sizeof( uint16_t );
+static constexpr size_t METADATA_VALUE_SIZE = sizeof( uint16_t ) + sizeof( int64_t );
+
+
+template< class T >
+static uint8_t * put( uint8_t * p, T const & v )
+{
+    memcpy( p, &v, sizeof( v ) );
+    return p + sizeof( v );
+}
+
+
+template< class T >
+static uint8_t const * get( uint8_t const * p, T & v )
+{
+    memcpy( &v, p, sizeof( v ) );
+    return p + sizeof( v );
+}
+
+
+void image_metadata::write_to( std::vector< uint8_t > & data ) const
+{
+    uint16_t const count = uint16_t( std::min( values.size(), size_t( UINT16_MAX ) ) );
+    uint32_t const size = uint32_t( METADATA_FIXED_SIZE + count * METADATA_VALUE_SIZE );
+    auto const start = data.size();
+    data.resize( start + size + sizeof( size ) );
+    auto p = put( data.data() + start, frame_number );
+    p = put( p, timestamp_domain );
+    p = put( p, depth_units );
+    p = put( p, count );
+    for( uint16_t i = 0; i < count; ++i )
+    {
+        p = put( p, values[i].first );
+        p = put( p, values[i].second );
+    }
+    put( p, size );
+}
+
+
+bool image_metadata::read_from( std::vector< uint8_t > & data )
+{
+    uint32_t size;
+    if( data.size() < sizeof( size ) )
+        return false;
+    get( data.data() + data.size() - sizeof( size ), size );
+    if( size < METADATA_FIXED_SIZE || size > data.size() - sizeof( size ) )
+        return false;
+    auto const start = data.size() - sizeof( size ) - size;
+    auto p = get( data.data() + start, frame_number );
+    p = get( p, timestamp_domain );
+    p = get( p, depth_units );
+    uint16_t count;
+    p = get( p, count );
+    if( size != METADATA_FIXED_SIZE + count * METADATA_VALUE_SIZE )
+        return false;
+    values.resize( count );
+    for( auto & kv : values )
+    {
+        p = get( p, kv.first );
+        p = get( p, kv.second );
+    }
+    data.resize( start );
+    return true;
+}
+
+
 image_msg::image_msg( sensor_msgs::msg::Image && rhs )
 {
-    raw_data = std::move( rhs.data() );
-    width    = std::move( rhs.width() );
-    height   = std::move( rhs.height() );
-    timestamp = dds_time( rhs.header().stamp().sec(), rhs.header().stamp().nanosec() );
+    *this = std::move( rhs );
 }
 
 
 image_msg & image_msg::operator=( sensor_msgs::msg::Image && rhs )
 {
     raw_data = std::move( rhs.data() );
+    encoding = std::move( rhs.encoding() );
     width    = std::move( rhs.width() );
     height   = std::move( rhs.height() );
     timestamp = dds_time( rhs.header().stamp().sec(), rhs.header().stamp().nanosec() );
 
+    metadata.reset();
+    std::string const md_suffix = std::string( "; " ) + image_metadata::FORMAT;
+    if( encoding.size() > md_suffix.size()
+        && ! encoding.compare( encoding.size() - md_suffix.size(), md_suffix.size(), md_suffix ) )
+    {
+        encoding.resize( encoding.size() - md_suffix.size() );
+        metadata = std::make_shared< image_metadata >();
+        if( ! metadata->read_from( raw_data ) )
+        {
+            LOG_ERROR( "invalid metadata in '" << encoding << "' image; ignoring it" );
+            metadata.reset();
+            invalidate();
+        }
+    }
+
     return *this;
 }
 
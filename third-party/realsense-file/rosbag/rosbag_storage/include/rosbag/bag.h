@@ -50,8 +50,11 @@
 #include "ros/message_event.h"
 #include "ros/serialization.h"
 
+#include <deque>
+#include <future>
 #include <ios>
 #include <map>
+#include <memory>
 #include <queue>
 #include <set>
 #include <stdexcept>
@@ -118,6 +121,14 @@ public:
     std::tuple<std::string, uint64_t, uint64_t> getCompressionInfo() const;
     void            setChunkThreshold(uint32_t chunk_threshold);  //!< Set the threshold for creating new chunks
     uint32_t        getChunkThreshold() const;                    //!< Get the threshold for creating new chunks
+    //! Compress LZ4 chunks on up to this many background threads (0, the default, compresses on the writing thread)
+    //! While chunks are compressed in the background, messages of the bag cannot be read back until it is closed.
+    void            setCompressionThreads(uint32_t threads);
+    uint32_t        getCompressionThreads() const;
+    //! Read uncompressed chunks straight out of a memory mapping of the file instead of copying them into a buffer
+    //! first. Takes effect when a bag is opened for reading; if the file cannot be mapped it is read as usual.
+    void            setMemoryMapped(bool mapped);
+    bool            isMemoryMapped() const;                       //!< true if the open bag is being read from a mapping
 
     //! Write a message into the bag file
     /*!
@@ -197,6 +208,10 @@ private:
     template<class T>
     void writeMessageDataRecord(uint32_t conn_id, rs2rosinternal::Time const& time, T const& msg);
     void writeIndexRecords();
+    void writeIndexRecords(std::map<uint32_t, std::multiset<IndexEntry> > const& indexes);
+    bool deferChunks() const;
+    void submitChunk();
+    void writePendingChunks(bool wait_for_all);
     void writeConnectionRecords();
     void writeChunkInfoRecords();
     void startWritingChunk(rs2rosinternal::Time time);
@@ -305,6 +320,21 @@ private:
     mutable Buffer*  current_buffer_;
 
     mutable uint64_t decompressed_chunk_;      //!< position of decompressed chunk
+
+    // Chunks handed to background compression, in the order they must be written. Their position in the file (and
+    // therefore the chunk_pos of their index entries) is only known once all the chunks before them were written.
+    struct PendingChunk
+    {
+        ChunkInfo                                       info;
+        std::map<uint32_t, std::multiset<IndexEntry> > connection_indexes;
+        uint32_t                                        uncompressed_size;
+        std::future<std::vector<char> >                 compressed;
+    };
+    uint32_t                 compression_threads_;
+    std::deque<PendingChunk> pending_chunks_;
+
+    bool                     memory_mapped_;            //!< map files opened for reading (see setMemoryMapped)
+    bool                     mapped_;                   //!< the open file is mapped
 };
 
 } // namespace rosbag
@@ -538,7 +568,8 @@ void Bag::doWrite(std::string const& topic, rs2rosinternal::Time const& time, T
             }
             connections_[conn_id] = connection_info;
 
-            writeConnectionRecord(connection_info);
+            if (!deferChunks())
+                writeConnectionRecord(connection_info);
             appendConnectionRecordToBuffer(outgoing_chunk_buffer_, connection_info);
         }
 
@@ -550,8 +581,11 @@ void Bag::doWrite(std::string const& topic, rs2rosinternal::Time const& time, T
 
         std::multiset<IndexEntry>& chunk_connection_index = curr_chunk_connection_indexes_[connection_info->id];
         chunk_connection_index.insert(chunk_connection_index.end(), index_entry);
-        std::multiset<IndexEntry>& connection_index = connection_indexes_[connection_info->id];
-        connection_index.insert(connection_index.end(), index_entry);
+        if (!deferChunks()) {
+            // Deferred chunks are indexed once they're written and their position is known
+            std::multiset<IndexEntry>& connection_index = connection_indexes_[connection_info->id];
+            connection_index.insert(connection_index.end(), index_entry);
+        }
 
         // Increment the connection count
         curr_chunk_info_.connection_counts[connection_info->id]++;
@@ -599,9 +633,11 @@ void Bag::writeMessageDataRecord(uint32_t conn_id, rs2rosinternal::Time const& t
     CONSOLE_BRIDGE_logDebug("Writing MSG_DATA [%llu:%d]: conn=%d sec=%d nsec=%d data_len=%d",
               (unsigned long long) file_.getOffset(), getChunkOffset(), conn_id, time.sec, time.nsec, msg_ser_len);
 
-    writeHeader(header);
-    writeDataLength(msg_ser_len);
-    write((char*) record_buffer_.getData(), msg_ser_len);
+    if (!deferChunks()) {
+        writeHeader(header);
+        writeDataLength(msg_ser_len);
+        write((char*) record_buffer_.getData(), msg_ser_len);
+    }
 
     // todo: use better abstraction than appendHeaderToBuffer
     appendHeaderToBuffer(outgoing_chunk_buffer_, header);
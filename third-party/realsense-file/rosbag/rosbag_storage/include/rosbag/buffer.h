@@ -52,11 +52,15 @@ public:
 
     void setSize(uint32_t size);
 
+    //! Refer to someone else's data (e.g. a file mapping) rather than a copy of it, until the next setSize()
+    void setView(uint8_t* data, uint32_t size);
+
 private:
     void ensureCapacity(uint32_t capacity);
 
 private:
     uint8_t* buffer_;
+    uint8_t* view_;
     uint32_t capacity_;
     uint32_t size_;
 };
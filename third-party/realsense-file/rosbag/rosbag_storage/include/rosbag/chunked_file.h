@@ -77,9 +77,15 @@ public:
     void        seek(uint64_t offset, int origin = std::ios_base::beg); //!< seek to given offset from origin
     void        decompress(CompressionType compression, uint8_t* dest, unsigned int dest_len, uint8_t* source, unsigned int source_len);
 
+    //! Map the whole file (opened for reading) into memory; returns false, leaving the file as it was, if it can't be
+    bool           map();
+    //! The mapped bytes [offset, offset+size) of the file, or NULL if the file is not mapped or the range is outside it
+    uint8_t const* getMapping(uint64_t offset, uint64_t size) const;
+
 private:
     void open(std::string const& filename, std::string const& mode);
     void clearUnused();
+    void unmap();
 
 private:
     std::string filename_;       //!< path to file
@@ -88,6 +94,11 @@ private:
     uint64_t    compressed_in_;  //!< number of bytes written to current compressed stream
     char*       unused_;         //!< extra data read by compressed stream
     int         nUnused_;        //!< number of bytes of extra data read by compressed stream
+    uint8_t*    mapping_;        //!< the file's contents, if map() was called
+    uint64_t    mapping_size_;   //!< size of mapping_
+#ifdef _WIN32
+    void*       mapping_handle_; //!< file mapping object backing mapping_
+#endif
 
     std::shared_ptr<StreamFactory> stream_factory_;
 
@@ -41,6 +41,7 @@
 #include <map>
 #include <tuple>
 #include <tuple>
+#include <future>
 
 #include "console_bridge/console.h"
 #include <memory.h>
@@ -69,7 +70,10 @@ Bag::Bag() :
     chunk_open_(false),
     curr_chunk_data_pos_(0),
     current_buffer_(0),
-    decompressed_chunk_(0)
+    decompressed_chunk_(0),
+    compression_threads_(0),
+    memory_mapped_(false),
+    mapped_(false)
 {
 }
 
@@ -85,7 +89,10 @@ Bag::Bag(string const& filename, uint32_t mode) :
     chunk_open_(false),
     curr_chunk_data_pos_(0),
     current_buffer_(0),
-    decompressed_chunk_(0)
+    decompressed_chunk_(0),
+    compression_threads_(0),
+    memory_mapped_(false),
+    mapped_(false)
 {
     open(filename, mode);
 }
@@ -115,6 +122,7 @@ void Bag::open(string const& filename, uint32_t mode) {
 
 void Bag::openRead(string const& filename) {
     file_.openRead(filename);
+    mapped_ = memory_mapped_ && file_.map();
 
     readVersion();
 
@@ -164,6 +172,11 @@ void Bag::close() {
         closeWrite();
 
     file_.close();
+    mapped_ = false;
+    // Any chunk still cached in decompress_buffer_ belongs to the file just closed (and may be a view of its mapping)
+    decompressed_chunk_ = 0;
+    decompress_buffer_.setSize(0);
+    current_buffer_ = NULL;
 
     topic_connection_ids_.clear();
     header_connection_ids_.clear();
@@ -192,6 +205,19 @@ void Bag::setChunkThreshold(uint32_t chunk_threshold) {
     chunk_threshold_ = chunk_threshold;
 }
 
+void Bag::setMemoryMapped(bool mapped) { memory_mapped_ = mapped; }
+bool Bag::isMemoryMapped() const        { return mapped_; }
+
+void Bag::setCompressionThreads(uint32_t threads) {
+    if (file_.isOpen() && chunk_open_)
+        stopWritingChunk();
+    writePendingChunks(true);
+
+    compression_threads_ = threads;
+}
+
+uint32_t Bag::getCompressionThreads() const { return compression_threads_; }
+
 CompressionType Bag::getCompression() const { return compression_; }
 
 std::tuple<std::string, uint64_t, uint64_t> Bag::getCompressionInfo() const
@@ -237,6 +263,7 @@ std::tuple<std::string, uint64_t, uint64_t> Bag::getCompressionInfo() const
 void Bag::setCompression(CompressionType compression) {
     if (file_.isOpen() && chunk_open_)
         stopWritingChunk();
+    writePendingChunks(true);
 
     if (!(compression == compression::Uncompressed ||
           compression == compression::BZ2 ||
@@ -292,6 +319,7 @@ void Bag::startWriting() {
 void Bag::stopWriting() {
     if (chunk_open_)
         stopWritingChunk();
+    writePendingChunks(true);
 
     seek(0, std::ios::end);
 
@@ -438,13 +466,24 @@ void Bag::readFileHeaderRecord() {
 }
 
 uint32_t Bag::getChunkOffset() const {
-    if (compression_ == compression::Uncompressed)
+    if (deferChunks())
+        return outgoing_chunk_buffer_.getSize();
+    else if (compression_ == compression::Uncompressed)
         return static_cast<uint32_t>(file_.getOffset() - curr_chunk_data_pos_);
     else
         return file_.getCompressedBytesIn();
 }
 
 void Bag::startWritingChunk(Time time) {
+    if (deferChunks()) {
+        // Nothing is written until the chunk is compressed; its data is assembled in outgoing_chunk_buffer_
+        curr_chunk_info_.pos        = -1;
+        curr_chunk_info_.start_time = time;
+        curr_chunk_info_.end_time   = time;
+        chunk_open_ = true;
+        return;
+    }
+
     // Initialize chunk info
     curr_chunk_info_.pos        = file_.getOffset();
     curr_chunk_info_.start_time = time;
@@ -463,6 +502,13 @@ void Bag::startWritingChunk(Time time) {
 }
 
 void Bag::stopWritingChunk() {
+    if (deferChunks()) {
+        submitChunk();
+        curr_chunk_info_.connection_counts.clear();
+        chunk_open_ = false;
+        return;
+    }
+
     // Add this chunk to the index
     chunks_.push_back(curr_chunk_info_);
 
@@ -530,8 +576,77 @@ void Bag::readChunkHeader(ChunkHeader& chunk_header) const {
 
 // Index records
 
+bool Bag::deferChunks() const {
+    return compression_threads_ > 0 && compression_ == compression::LZ4;
+}
+
+void Bag::submitChunk() {
+    // The chunk's data is compressed from a copy, so outgoing_chunk_buffer_ can be refilled right away
+    auto raw = std::make_shared<std::vector<char> >(outgoing_chunk_buffer_.getData(),
+                                                    outgoing_chunk_buffer_.getData() + outgoing_chunk_buffer_.getSize());
+    PendingChunk chunk;
+    chunk.info = curr_chunk_info_;
+    chunk.connection_indexes.swap(curr_chunk_connection_indexes_);
+    chunk.uncompressed_size = static_cast<uint32_t>(raw->size());
+    chunk.compressed = std::async(std::launch::async, [raw]() {
+        // Same framing (and block size) as LZ4Stream, so readers can't tell the difference
+        std::vector<char> out(raw->size() + raw->size() / 8 + 1024);
+        for (;;) {
+            unsigned int out_size = static_cast<unsigned int>(out.size());
+            int ret = roslz4_buffToBuffCompress(raw->data(), static_cast<unsigned int>(raw->size()),
+                                                out.data(), &out_size, 6);
+            if (ret == ROSLZ4_OK) {
+                out.resize(out_size);
+                return out;
+            }
+            if (ret != ROSLZ4_OUTPUT_SMALL)
+                throw BagException("Failed to compress chunk");
+            out.resize(out.size() * 2);
+        }
+    });
+    pending_chunks_.push_back(std::move(chunk));
+
+    // Keep at most compression_threads_ chunks in flight; write whatever is already done
+    writePendingChunks(false);
+    while (pending_chunks_.size() > compression_threads_) {
+        pending_chunks_.front().compressed.wait();
+        writePendingChunks(false);
+    }
+}
+
+void Bag::writePendingChunks(bool wait_for_all) {
+    while (!pending_chunks_.empty()) {
+        if (!wait_for_all && pending_chunks_.front().compressed.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            break;
+        PendingChunk chunk = std::move(pending_chunks_.front());
+        pending_chunks_.pop_front();
+        vector<char> data = chunk.compressed.get();  // rethrows if compression failed
+
+        seek(0, std::ios::end);
+        chunk.info.pos = file_.getOffset();
+        writeChunkHeader(compression::LZ4, static_cast<uint32_t>(data.size()), chunk.uncompressed_size);
+        write(data.data(), data.size());
+        chunks_.push_back(chunk.info);
+
+        // Now that the chunk has a position, its messages can be indexed
+        for (auto& connection_index : chunk.connection_indexes) {
+            multiset<IndexEntry>& index = connection_indexes_[connection_index.first];
+            for (IndexEntry entry : connection_index.second) {
+                entry.chunk_pos = chunk.info.pos;
+                index.insert(index.end(), entry);
+            }
+        }
+        writeIndexRecords(chunk.connection_indexes);
+        file_size_ = file_.getOffset();
+    }
+}
+
 void Bag::writeIndexRecords() {
-    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = curr_chunk_connection_indexes_.begin(); i != curr_chunk_connection_indexes_.end(); i++) {
+    writeIndexRecords(curr_chunk_connection_indexes_);
+}
+
+void Bag::writeIndexRecords(map<uint32_t, multiset<IndexEntry> > const& indexes) {
+    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = indexes.begin(); i != indexes.end(); i++) {
         uint32_t                    connection_id = i->first;
         multiset<IndexEntry> const& index         = i->second;
 
@@ -835,13 +950,19 @@ void Bag::readMessageDataRecord102(uint64_t offset, rs2rosinternal::Header& head
     file_.read((char*) record_buffer_.getData(), data_size);
 }
 
-// Reading this into a buffer isn't completely necessary, but we do it anyways for now
+// Reading this into a buffer isn't completely necessary, but we do it anyways unless the file is mapped
 void Bag::decompressRawChunk(ChunkHeader const& chunk_header) const {
     assert(chunk_header.compression == COMPRESSION_NONE);
     assert(chunk_header.compressed_size == chunk_header.uncompressed_size);
 
     CONSOLE_BRIDGE_logDebug("compressed_size: %d uncompressed_size: %d", chunk_header.compressed_size, chunk_header.uncompressed_size);
 
+    // Messages are only ever read out of the buffer, so it can refer to the (read-only) mapping directly
+    if (uint8_t const* mapped = file_.getMapping(file_.getOffset(), chunk_header.compressed_size)) {
+        decompress_buffer_.setView(const_cast<uint8_t*>(mapped), chunk_header.compressed_size);
+        return;
+    }
+
     decompress_buffer_.setSize(chunk_header.compressed_size);
     file_.read((char*) decompress_buffer_.getData(), chunk_header.compressed_size);
 
@@ -41,21 +41,27 @@
 
 namespace rosbag {
 
-Buffer::Buffer() : buffer_(NULL), capacity_(0), size_(0) { }
+Buffer::Buffer() : buffer_(NULL), view_(NULL), capacity_(0), size_(0) { }
 
 Buffer::~Buffer() {
     free(buffer_);
 }
 
-uint8_t* Buffer::getData()           { return buffer_;   }
+uint8_t* Buffer::getData()           { return view_ ? view_ : buffer_; }
 uint32_t Buffer::getCapacity() const { return capacity_; }
 uint32_t Buffer::getSize()     const { return size_;     }
 
 void Buffer::setSize(uint32_t size) {
+    view_ = NULL;
     size_ = size;
     ensureCapacity(size);
 }
 
+void Buffer::setView(uint8_t* data, uint32_t size) {
+    view_ = data;
+    size_ = size;
+}
+
 void Buffer::ensureCapacity(uint32_t capacity) {
     if (capacity <= capacity_)
         return;
@@ -49,8 +49,18 @@
 #        define fileno _fileno
 #        define ftruncate _chsize_s //Intel Realsense Change, Was: #define ftruncate _chsize 
 #    endif
+#    include <io.h>
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
 #else
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 
 using std::string;
@@ -64,7 +74,12 @@ ChunkedFile::ChunkedFile() :
     offset_(0),
     compressed_in_(0),
     unused_(NULL),
-    nUnused_(0)
+    nUnused_(0),
+    mapping_(NULL),
+    mapping_size_(0)
+#ifdef _WIN32
+    , mapping_handle_(NULL)
+#endif
 {
     stream_factory_ = std::make_shared<StreamFactory>(this);
 }
@@ -137,6 +152,8 @@ void ChunkedFile::close() {
     // Close any compressed stream by changing to uncompressed mode
     setWriteMode(compression::Uncompressed);
 
+    unmap();
+
     // Close the file
     int success = fclose(file_);
     if (success != 0)
@@ -148,6 +165,62 @@ void ChunkedFile::close() {
     clearUnused();
 }
 
+bool ChunkedFile::map() {
+    if (mapping_)
+        return true;
+    if (!file_)
+        throw BagIOException("Can't map a file before opening it");
+
+    fflush(file_);
+#ifdef _WIN32
+    HANDLE file = (HANDLE) _get_osfhandle(fileno(file_));
+    LARGE_INTEGER size;
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size) || size.QuadPart <= 0
+        || uint64_t(size.QuadPart) > SIZE_MAX)
+        return false;
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping)
+        return false;
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        CloseHandle(mapping);
+        return false;
+    }
+    mapping_handle_ = mapping;
+    mapping_size_   = uint64_t(size.QuadPart);
+#else
+    struct stat st;
+    if (fstat(fileno(file_), &st) != 0 || st.st_size <= 0 || uint64_t(st.st_size) > SIZE_MAX)
+        return false;
+    void* data = mmap(NULL, size_t(st.st_size), PROT_READ, MAP_SHARED, fileno(file_), 0);
+    if (data == MAP_FAILED)
+        return false;
+    mapping_size_ = uint64_t(st.st_size);
+#endif
+    mapping_ = (uint8_t*) data;
+    return true;
+}
+
+uint8_t const* ChunkedFile::getMapping(uint64_t offset, uint64_t size) const {
+    if (!mapping_ || offset > mapping_size_ || size > mapping_size_ - offset)
+        return NULL;
+    return mapping_ + offset;
+}
+
+void ChunkedFile::unmap() {
+    if (!mapping_)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(mapping_);
+    CloseHandle(mapping_handle_);
+    mapping_handle_ = NULL;
+#else
+    munmap(mapping_, size_t(mapping_size_));
+#endif
+    mapping_      = NULL;
+    mapping_size_ = 0;
+}
+
 // Read/write modes
 
 void ChunkedFile::setWriteMode(CompressionType type) {
@@ -3,12 +3,16 @@
 
 #pragma once
 #include <queue>
+#include <algorithm>
 #include <mutex>
 #include <condition_variable>
 #include <thread>
 #include <atomic>
 #include <functional>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 
 const int QUEUE_MAX_SIZE = 10;
 // Simplest implementation of a blocking concurrent queue for thread messaging
@@ -111,6 +115,28 @@ public:
         return true;
     }
 
+    // Remove 'count' items at once, under a single lock; wait until there are that many
+    // Return how many were removed -- fewer than 'count' if the timeout expired or the queue stopped first
+    size_t dequeue( T * items, size_t count, unsigned int timeout_ms )
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _deq_cv.wait_for( lock,
+                          std::chrono::milliseconds( timeout_ms ),
+                          [this, count]() { return ! _accepting || _queue.size() >= count; } );
+
+        size_t const n = std::min( count, _queue.size() );
+        for( size_t i = 0; i < n; ++i )
+        {
+            items[i] = std::move( _queue.front() );
+            _queue.pop_front();
+        }
+
+        if( n )
+            _enq_cv.notify_all();
+
+        return n;
+    }
+
     // Remove one item if available; do not wait for one
     // Return true if an item was removed -- otherwise, false
     bool try_dequeue(T* item)
@@ -193,15 +219,304 @@ public:
     bool empty() const { return ! size(); }
 };
 
-// A single_consumer_queue meant to hold frame_holder objects
-template<class T>
+// Same interface and semantics as single_consumer_queue, but on a bounded ring: producers claim a slot with a CAS and
+// publish it by bumping the slot's sequence number, so they never wait for each other or for the consumer. Taking from
+// the head goes through a spin flag shared only with producers that must drop the oldest item (queue over capacity).
+// Nobody takes a mutex unless there's a thread to wake: waiting is still on a condition variable, but producers only
+// touch it when the consumer is actually asleep.
+//
+// T must be default-constructible; a slot is reset to T() as soon as its item is taken.
+//
+template< class T >
+class lock_free_single_consumer_queue
+{
+    struct slot
+    {
+        std::atomic< size_t > sequence;
+        T item;
+    };
+
+    std::unique_ptr< slot[] > _slots;
+    size_t const _mask;
+    std::atomic< size_t > _tail;      // next position to enqueue into
+    size_t _head;                     // next position to dequeue from; under _head_lock
+    mutable std::atomic_flag _head_lock = ATOMIC_FLAG_INIT;
+    std::atomic< size_t > _size;
+
+    unsigned int const _cap;
+    std::atomic< bool > _accepting;
+
+    std::function< void( T const & ) > const _on_drop_callback;
+
+    std::mutex _sleep_mutex;
+    std::condition_variable _deq_cv;  // not empty signal
+    std::condition_variable _enq_cv;  // not full signal
+    std::atomic< int > _deq_sleepers;
+    std::atomic< int > _enq_sleepers;
+
+    static size_t ring_size( unsigned int cap )
+    {
+        // Room for a few concurrent producers beyond the capacity, before they have to drop the oldest
+        size_t n = 2;
+        while( n < size_t( cap ) + 4 )
+            n <<= 1;
+        return n;
+    }
+
+    class head_lock
+    {
+        std::atomic_flag & _flag;
+
+    public:
+        explicit head_lock( std::atomic_flag & flag )
+            : _flag( flag )
+        {
+            while( _flag.test_and_set( std::memory_order_acquire ) )
+                std::this_thread::yield();
+        }
+        ~head_lock() { _flag.clear( std::memory_order_release ); }
+    };
+
+    // False if the ring is full; the item is only moved from on success
+    bool push( T & item )
+    {
+        auto pos = _tail.load( std::memory_order_relaxed );
+        slot * s;
+        while( true )
+        {
+            s = &_slots[pos & _mask];
+            auto const diff = intptr_t( s->sequence.load( std::memory_order_acquire ) ) - intptr_t( pos );
+            if( diff == 0 )
+            {
+                if( _tail.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                    break;
+            }
+            else if( diff < 0 )
+                return false;
+            else
+                pos = _tail.load( std::memory_order_relaxed );
+        }
+        s->item = std::move( item );
+        _size.fetch_add( 1, std::memory_order_relaxed );
+        s->sequence.store( pos + 1, std::memory_order_release );
+        return true;
+    }
+
+    // Must be under _head_lock
+    bool pop( T * item )
+    {
+        auto & s = _slots[_head & _mask];
+        if( s.sequence.load( std::memory_order_acquire ) != _head + 1 )
+            return false;  // empty, or the producer of the head is not done yet
+        *item = std::move( s.item );
+        s.item = T();
+        s.sequence.store( _head + _mask + 1, std::memory_order_release );
+        ++_head;
+        _size.fetch_sub( 1, std::memory_order_relaxed );
+        return true;
+    }
+
+    bool take( T * item, bool wake_producers = true )
+    {
+        bool taken;
+        {
+            head_lock lock( _head_lock );
+            taken = pop( item );
+        }
+        if( taken && wake_producers )
+            wake( _enq_sleepers, _enq_cv );
+        return taken;
+    }
+
+    void drop_oldest()
+    {
+        T dropped;
+        if( take( &dropped ) && _on_drop_callback )
+            _on_drop_callback( dropped );
+    }
+
+    // The fence pairs with the one in sleep(): either the sleeper sees what we did before waking it, or we see it
+    // and, by taking the mutex it waits under, can't notify it before it's waiting
+    void wake( std::atomic< int > & sleepers, std::condition_variable & cv, bool all = false )
+    {
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        if( ! sleepers.load( std::memory_order_relaxed ) )
+            return;
+        {
+            std::lock_guard< std::mutex > lock( _sleep_mutex );
+        }
+        if( all )
+            cv.notify_all();
+        else
+            cv.notify_one();
+    }
+
+    template< class Pred >
+    bool sleep( std::atomic< int > & sleepers,
+                std::condition_variable & cv,
+                std::chrono::steady_clock::time_point deadline,
+                Pred done )
+    {
+        std::unique_lock< std::mutex > lock( _sleep_mutex );
+        sleepers.fetch_add( 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        bool ok = true;
+        while( ! done() )
+        {
+            if( cv.wait_until( lock, deadline ) == std::cv_status::timeout )
+            {
+                ok = done();
+                break;
+            }
+        }
+        sleepers.fetch_sub( 1, std::memory_order_relaxed );
+        return ok;
+    }
+
+public:
+    explicit lock_free_single_consumer_queue( unsigned int cap = QUEUE_MAX_SIZE,
+                                              std::function< void( T const & ) > on_drop_callback = nullptr )
+        : _slots( new slot[ring_size( cap )] )
+        , _mask( ring_size( cap ) - 1 )
+        , _tail( 0 )
+        , _head( 0 )
+        , _size( 0 )
+        , _cap( cap )
+        , _accepting( true )
+        , _on_drop_callback( on_drop_callback )
+        , _deq_sleepers( 0 )
+        , _enq_sleepers( 0 )
+    {
+        for( size_t i = 0; i <= _mask; ++i )
+            _slots[i].sequence.store( i, std::memory_order_relaxed );
+    }
+
+    // Enqueue an item onto the queue.
+    // If the queue grows beyond capacity, the front will be removed, losing whatever was there!
+    bool enqueue( T && item )
+    {
+        if( ! _accepting )
+        {
+            if( _on_drop_callback )
+                _on_drop_callback( item );
+            return false;
+        }
+
+        while( ! push( item ) )
+            drop_oldest();  // the ring itself is full: producers racing past the capacity
+        if( _size.load( std::memory_order_relaxed ) > _cap )
+            drop_oldest();
+        if( ! _accepting )
+            clear();  // stopped while we were at it
+
+        // We pushed something -- let others know there's something to dequeue
+        wake( _deq_sleepers, _deq_cv );
+        return true;
+    }
+
+    // Enqueue an item, but wait for room if there isn't any
+    // Returns true if the enqueue succeeded
+    bool blocking_enqueue( T && item )
+    {
+        sleep( _enq_sleepers, _enq_cv, std::chrono::steady_clock::time_point::max(), [this]() {
+            return _size.load( std::memory_order_relaxed ) < _cap || ! _accepting;
+        } );
+        if( ! _accepting )
+        {
+            // We shouldn't be adding anything to the queue when we're stopping
+            if( _on_drop_callback )
+                _on_drop_callback( item );
+            return false;
+        }
+
+        while( ! push( item ) )
+            drop_oldest();
+        wake( _deq_sleepers, _deq_cv );
+        return true;
+    }
+
+    // Remove one item; if unavailable, wait for it
+    // Return true if an item was removed -- otherwise, false
+    bool dequeue( T * item, unsigned int timeout_ms )
+    {
+        if( take( item ) )
+            return true;
+        // Waking producers takes the mutex we sleep under, so it waits until we're out
+        bool taken = false;
+        sleep( _deq_sleepers,
+               _deq_cv,
+               std::chrono::steady_clock::now() + std::chrono::milliseconds( timeout_ms ),
+               [&]() { return ( taken = take( item, false ) ) || ! _accepting; } );
+        if( taken )
+            wake( _enq_sleepers, _enq_cv );
+        return taken;
+    }
+
+    // Remove one item if available; do not wait for one
+    // Return true if an item was removed -- otherwise, false
+    bool try_dequeue( T * item ) { return take( item ); }
+
+    template< class Fn >
+    bool peek( Fn fn ) const
+    {
+        head_lock lock( _head_lock );
+        auto const & s = _slots[_head & _mask];
+        if( s.sequence.load( std::memory_order_acquire ) != _head + 1 )
+            return false;
+        fn( s.item );
+        return true;
+    }
+
+    template< class Fn >
+    bool peek( Fn fn )
+    {
+        head_lock lock( _head_lock );
+        auto & s = _slots[_head & _mask];
+        if( s.sequence.load( std::memory_order_acquire ) != _head + 1 )
+            return false;
+        fn( s.item );
+        return true;
+    }
+
+    void stop()
+    {
+        // We no longer accept any more items!
+        _accepting = false;
+        clear();
+    }
+
+    void clear()
+    {
+        {
+            head_lock lock( _head_lock );
+            T item;
+            while( pop( &item ) )
+                item = T();
+        }
+        // Wake up anyone who is waiting for room to enqueue, or waiting for something to dequeue -- there's nothing now
+        wake( _enq_sleepers, _enq_cv, true );
+        wake( _deq_sleepers, _deq_cv, true );
+    }
+
+    void start() { _accepting = true; }
+
+    bool started() const { return _accepting; }
+    bool stopped() const { return ! started(); }
+
+    size_t size() const { return _size.load( std::memory_order_relaxed ); }
+
+    bool empty() const { return ! size(); }
+};
+
+// A single_consumer_queue meant to hold frame_holder objects; Queue may also be a lock_free_single_consumer_queue
+template< class T, class Queue = single_consumer_queue< T > >
 class single_consumer_frame_queue
 {
-    single_consumer_queue<T> _queue;
+    Queue _queue;
 
 public:
-    single_consumer_frame_queue< T >( unsigned int cap = QUEUE_MAX_SIZE,
-                                      std::function< void( T const & ) > on_drop_callback = nullptr )
+    single_consumer_frame_queue( unsigned int cap = QUEUE_MAX_SIZE,
+                                 std::function< void( T const & ) > on_drop_callback = nullptr )
         : _queue( cap, on_drop_callback )
     {
     }
@@ -219,6 +534,11 @@ public:
         return _queue.dequeue(item, timeout_ms);
     }
 
+    size_t dequeue( T * items, size_t count, unsigned int timeout_ms )
+    {
+        return _queue.dequeue( items, count, timeout_ms );
+    }
+
     bool try_dequeue(T* item)
     {
         return _queue.try_dequeue(item);
@@ -314,8 +634,11 @@ public:
     // and we're non-blocking. The on_drop_callback allows caputring of these instances, if we
     // want...
     //
+    // The dispatching thread applies the thread policy (see thread-policy.h) of the given role; "dispatcher" if none.
+    //
     dispatcher( unsigned int queue_capacity,
-                std::function< void( action ) > on_drop_callback = nullptr );
+                std::function< void( action ) > on_drop_callback = nullptr,
+                char const * thread_role = nullptr );
 
     ~dispatcher();
 
@@ -406,8 +729,8 @@ template<class T = std::function<void(dispatcher::cancellable_timer)>>
 class active_object
 {
 public:
-    active_object(T operation)
-        : _operation(std::move(operation)), _dispatcher(1), _stopped(true)
+    active_object(T operation, char const * thread_role = nullptr)
+        : _operation(std::move(operation)), _dispatcher(1, nullptr, thread_role), _stopped(true)
     {
     }
 
@@ -0,0 +1,82 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+// A small value that a single writer replaces every now and then, while any number of readers take consistent copies
+// of it without locking: a reader that overlapped a write simply copies again. Readers never write, so they don't
+// contend with each other or with the writer (other than on the rare retry).
+//
+// T must be trivially copyable; it's stored as atomic words so the racing copy is well-defined.
+// Writers must be serialized by the caller.
+//
+template< class T >
+class seqlock
+{
+    static_assert( std::is_trivially_copyable< T >::value, "seqlock values must be trivially copyable" );
+
+    static constexpr size_t N_WORDS = ( sizeof( T ) + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t );
+
+    std::atomic< uint32_t > _seq;  // odd while a write is in progress
+    std::atomic< uint64_t > _words[N_WORDS];
+
+    void store_words( T const & value )
+    {
+        uint64_t words[N_WORDS] = {};
+        std::memcpy( words, &value, sizeof( T ) );
+        for( size_t i = 0; i < N_WORDS; ++i )
+            _words[i].store( words[i], std::memory_order_relaxed );
+    }
+
+public:
+    explicit seqlock( T const & value = T() )
+        : _seq( 0 )
+    {
+        store_words( value );
+    }
+
+    seqlock( seqlock const & ) = delete;
+    seqlock & operator=( seqlock const & ) = delete;
+
+    void store( T const & value )
+    {
+        auto const seq = _seq.load( std::memory_order_relaxed );
+        _seq.store( seq + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        store_words( value );
+        _seq.store( seq + 2, std::memory_order_release );
+    }
+
+    T load() const
+    {
+        uint64_t words[N_WORDS];
+        uint32_t before, after;
+        do
+        {
+            before = _seq.load( std::memory_order_acquire );
+            for( size_t i = 0; i < N_WORDS; ++i )
+                words[i] = _words[i].load( std::memory_order_relaxed );
+            std::atomic_thread_fence( std::memory_order_acquire );
+            after = _seq.load( std::memory_order_relaxed );
+        }
+        while( before != after || ( before & 1 ) );
+
+        T value;
+        std::memcpy( &value, words, sizeof( T ) );
+        return value;
+    }
+};
+
+
+}  // namespace concurrency
+}  // namespace rsutils
@@ -0,0 +1,35 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <rsutils/json-fwd.h>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+// Threads the library creates belong to a role ("usb", "v4l2", "hid", "processing", "dispatcher", ...) and,
+// once they start running, apply whatever policy was configured for that role:
+//
+//     {
+//         "v4l2": { "name": "rs-v4l2", "cpus": [2, 3], "priority": 80 },
+//         "default": { "cpus": [0, 1] }
+//     }
+//
+// "name" is the thread name (cut to 15 characters, on Linux); "cpus" is the set of CPUs the thread may run on; a
+// "priority" above 0 switches it to SCHED_FIFO with that priority (on Windows, it maps to a thread priority class).
+// Roles without a policy of their own take the "default" one. Nothing is changed for a role without any policy.
+//
+// Threads apply the policy when they start, so this should be configured before they are created. Throws if the
+// JSON is invalid; failures to apply a policy are only logged, as they usually mean missing permissions.
+//
+void set_thread_policies( rsutils::json const & );
+
+// Applies the policy for the role to the calling thread; a null role means "default"
+void apply_thread_policy( char const * role );
+
+
+}  // namespace concurrency
+}  // namespace rsutils
@@ -0,0 +1,95 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+// Runs periodic tasks -- the pollers each device would otherwise keep a thread for -- on a small pool of threads.
+//
+// Tasks are kept in a hashed timer wheel: a ring of slots, one per tick, each holding the tasks due when the wheel
+// gets to it (tasks due more than a turn away wait for as many turns). One thread turns the wheel and hands due tasks
+// to the pool. Since most tasks query the device over control transfers, at most one task is started per tick: tasks
+// that are due together are pushed to the following ticks, and new tasks start in the least busy tick of their first
+// period, so the transfers of different devices do not all go out at once.
+//
+// A task never runs concurrently with itself: if it is still running when due again, that run is skipped.
+//
+// Threads apply the thread policy (see thread-policy.h) of the "polling" role.
+//
+class timer_wheel
+{
+public:
+    typedef uint64_t task_id;  // 0 is never a task
+
+    explicit timer_wheel( size_t threads = 2, std::chrono::milliseconds tick = std::chrono::milliseconds( 10 ) );
+    ~timer_wheel();
+
+    timer_wheel( timer_wheel const & ) = delete;
+    timer_wheel & operator=( timer_wheel const & ) = delete;
+
+    // The one the library's devices share; it lives for as long as anyone holds it. Tasks whose timing matters, or
+    // that may block long, are better off on a wheel of their own: they would delay, or be delayed by, the rest.
+    static std::shared_ptr< timer_wheel > shared();
+
+    // Runs 'task' every 'period' from now on. With 'spread' the first run is in the least busy tick of the first
+    // period; otherwise it is in the next tick.
+    task_id add( std::function< void() > task, std::chrono::milliseconds period, bool spread = true );
+
+    // Changes the period of a task, from its next run on; may be called from the task itself
+    void set_period( task_id, std::chrono::milliseconds period );
+
+    // Once this returns, the task will not run again: if it is running, this waits for it to finish (unless called
+    // from the task itself)
+    void remove( task_id );
+
+    size_t size() const;
+
+private:
+    struct task
+    {
+        std::shared_ptr< std::function< void() > > fn;  // shared with the worker running it
+        size_t period = 1;  // in ticks
+        size_t turns = 0;   // left before it is due, when the wheel gets to its slot
+        bool running = false;
+        std::thread::id runner;
+    };
+
+    size_t ticks_of( std::chrono::milliseconds ) const;
+    void schedule( task_id, task &, size_t ticks_from_now );  // with _mutex held
+    void turn();
+    void work();
+
+    std::chrono::milliseconds const _tick;
+    std::vector< std::vector< task_id > > _slots;
+    size_t _cursor = 0;  // the slot of the last tick that went by
+    std::map< task_id, task > _tasks;
+    task_id _last_id = 0;
+    std::deque< task_id > _due;
+    bool _stopping = false;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _due_cv;   // workers wait for tasks
+    std::condition_variable _done_cv;  // remove() waits for a running task
+    std::condition_variable _stop_cv;  // the wheel waits for the next tick
+    std::thread _wheel;
+    std::vector< std::thread > _workers;
+};
+
+
+}  // namespace concurrency
+}  // namespace rsutils
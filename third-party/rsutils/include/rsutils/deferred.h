@@ -27,7 +27,7 @@ public:
     deferred() = default;
 
     deferred( fn && f )
-        : _deferred( f )
+        : _deferred( std::move( f ) )
     {
     }
 
@@ -0,0 +1,70 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <sstream>
+#include <string>
+
+
+namespace rsutils {
+namespace async_debug_log {
+
+
+// When on, LOG_DEBUG only formats its message (into a per-thread stream) and posts it, with its source location, into
+// a lock-free ring; a background thread hands it to EasyLogging++, where building the log line, writing it to the
+// console/file and calling the log callbacks then happen. So debug logging can be left on without the hot paths it's
+// in paying for the logger's locks and I/O.
+//
+// The log line's %datetime and %thread are of when and where it was dispatched rather than logged, though. A message
+// too long for the ring, or posted while the ring is full, drains the ring and then goes out synchronously, as it
+// would have without this.
+//
+// Off by default; LRS_LOG_ASYNC enables it in librealsense.
+//
+void enable( bool on );
+
+extern std::atomic< bool > g_on;
+inline bool is_on() { return g_on.load( std::memory_order_relaxed ); }
+
+// Dispatches whatever was posted so far, before returning
+void flush();
+
+
+// What LOG_DEBUG streams into: an ostringstream, reused by the thread from one message to the next
+class message
+{
+    std::ostringstream _ss;
+
+public:
+    template< class T >
+    message & operator<<( T const & value )
+    {
+        _ss << value;
+        return *this;
+    }
+    message & operator<<( std::ostream & ( *manip )( std::ostream & ) )
+    {
+        _ss << manip;
+        return *this;
+    }
+    // As EasyLogging++ would, rather than the ostream's
+    message & operator<<( char const * str )
+    {
+        _ss << ( str ? str : "(null)" );
+        return *this;
+    }
+    message & operator<<( char * str ) { return *this << static_cast< char const * >( str ); }
+    message & operator<<( wchar_t const * str );
+    message & operator<<( std::wstring const & str ) { return *this << str.c_str(); }
+
+    // Posts the message and resets the stream for the next one
+    void post( char const * file, unsigned line, char const * func );
+
+    static message & get();
+};
+
+
+}  // namespace async_debug_log
+}  // namespace rsutils
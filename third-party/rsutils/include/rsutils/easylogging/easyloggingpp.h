@@ -20,6 +20,7 @@
 
 #if BUILD_EASYLOGGINGPP
 #include <third-party/easyloggingpp/src/easylogging++.h>
+#include <rsutils/easylogging/async-debug-log.h>
 
 
 #define LIBREALSENSE_ELPP_ID "librealsense"
@@ -43,7 +44,7 @@
 
 #else //__ANDROID__  
 
-#define LOG_DEBUG(...)   do { CLOG(DEBUG   , LIBREALSENSE_ELPP_ID) << __VA_ARGS__; } while(false)
+#define LOG_DEBUG(...)   do { if( rsutils::async_debug_log::is_on() ) { rsutils::async_debug_log::message::get() << __VA_ARGS__; rsutils::async_debug_log::message::get().post( __FILE__, __LINE__, ELPP_FUNC ); } else { CLOG(DEBUG, LIBREALSENSE_ELPP_ID) << __VA_ARGS__; } } while(false)
 #define LOG_INFO(...)    do { CLOG(INFO    , LIBREALSENSE_ELPP_ID) << __VA_ARGS__; } while(false)
 #define LOG_WARNING(...) do { CLOG(WARNING , LIBREALSENSE_ELPP_ID) << __VA_ARGS__; } while(false)
 #define LOG_ERROR(...)   do { CLOG(ERROR   , LIBREALSENSE_ELPP_ID) << __VA_ARGS__; } while(false)
@@ -75,3 +76,30 @@ void configure_elpp_logger( bool enable_debug = false,
 
 
 #endif // BUILD_EASYLOGGINGPP
+
+
+// Compile-time filtering (CMake's LOG_MIN_SEVERITY): macros below this rs2_log_severity compile to nothing, so they
+// don't even evaluate their arguments
+#ifndef LRS_LOG_MIN_SEVERITY
+#define LRS_LOG_MIN_SEVERITY 0  // RS2_LOG_SEVERITY_DEBUG: everything
+#endif
+#if LRS_LOG_MIN_SEVERITY > 0
+#undef LOG_DEBUG
+#define LOG_DEBUG(...)   do { ; } while(false)
+#endif
+#if LRS_LOG_MIN_SEVERITY > 1
+#undef LOG_INFO
+#define LOG_INFO(...)    do { ; } while(false)
+#endif
+#if LRS_LOG_MIN_SEVERITY > 2
+#undef LOG_WARNING
+#define LOG_WARNING(...) do { ; } while(false)
+#endif
+#if LRS_LOG_MIN_SEVERITY > 3
+#undef LOG_ERROR
+#define LOG_ERROR(...)   do { ; } while(false)
+#endif
+#if LRS_LOG_MIN_SEVERITY > 4
+#undef LOG_FATAL
+#define LOG_FATAL(...)   do { ; } while(false)
+#endif
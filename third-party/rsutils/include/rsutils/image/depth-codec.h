@@ -0,0 +1,48 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace rsutils {
+namespace image {
+
+
+// Lossless encoding of Z16 depth images, for recording and streaming.
+//
+// Depth images are mostly smooth surfaces broken up by runs of invalid (zero) pixels. Each row is written as a
+// stream of byte-aligned tokens: runs of zeros become a single token, and valid pixels are stored as the
+// (zig-zag) difference from the previous valid pixel on the row, which usually fits in one byte. The result is
+// roughly half the size of the raw image and compresses much better with general-purpose compressors. Images that
+// would not get smaller are stored raw.
+//
+namespace depth_codec {
+
+
+// How users of the encoding identify it (e.g., in a ROS CompressedImage format or a DDS image encoding)
+constexpr char const * FORMAT = "rs2_z16_delta_rle";
+
+struct image_info
+{
+    uint32_t width;
+    uint32_t height;
+    uint32_t step;  // bytes per row, >= 2 * width
+    float depth_units;
+};
+
+// Appends the encoded image to 'out'; 'pixels' holds info.height rows of info.step bytes
+void encode( image_info const & info, uint8_t const * pixels, std::vector< uint8_t > & out );
+
+// Throws std::runtime_error if the data is not a valid encoding
+image_info decode_info( uint8_t const * data, size_t size );
+
+// 'pixels' must have room for step * height bytes; row padding past the pixels themselves is zeroed
+void decode( uint8_t const * data, size_t size, uint8_t * pixels );
+
+
+}  // namespace depth_codec
+}  // namespace image
+}  // namespace rsutils
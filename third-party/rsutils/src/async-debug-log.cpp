@@ -0,0 +1,202 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#ifdef BUILD_EASYLOGGINGPP
+#include <rsutils/easylogging/easyloggingpp.h>
+#include <rsutils/easylogging/async-debug-log.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+
+namespace rsutils {
+namespace async_debug_log {
+
+
+std::atomic< bool > g_on( false );
+
+
+namespace {
+
+
+void dispatch( char const * file, unsigned line, char const * func, char const * text, size_t size )
+{
+    el::base::Writer( el::Level::Debug, file, line, func ).construct( 1, LIBREALSENSE_ELPP_ID )
+        << std::string( text, size );
+}
+
+
+// A bounded multiple-producer queue in which every slot has a sequence number: a producer claims a slot with a single
+// CAS on the enqueue position, then publishes it by bumping its sequence. Consumers (just the one at a time, under
+// _drain_mutex) never block producers.
+class ring
+{
+    static constexpr size_t CAPACITY = 4096;  // power of 2
+    static constexpr size_t TEXT_SIZE = 232;  // so a slot is 256 bytes, on 64-bit
+
+    struct slot
+    {
+        std::atomic< size_t > sequence;
+        char const * file;
+        char const * func;
+        unsigned line;
+        unsigned size;
+        char text[TEXT_SIZE];
+    };
+
+    std::unique_ptr< slot[] > _slots;
+    std::atomic< size_t > _enqueue_pos{ 0 };
+    size_t _dequeue_pos = 0;
+    std::mutex _drain_mutex;
+    std::atomic< bool > _stop{ false };
+    std::thread _thread;
+
+public:
+    ring()
+        : _slots( new slot[CAPACITY] )
+    {
+        for( size_t i = 0; i < CAPACITY; ++i )
+            _slots[i].sequence.store( i, std::memory_order_relaxed );
+        _thread = std::thread( [this]() {
+            while( ! _stop.load( std::memory_order_relaxed ) )
+            {
+                if( ! drain() )
+                    std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+            }
+        } );
+    }
+
+    ~ring()
+    {
+        _stop = true;
+        _thread.join();
+        drain();
+    }
+
+    // False if the message doesn't fit or the ring is full
+    bool post( char const * file, unsigned line, char const * func, char const * text, size_t size )
+    {
+        if( size > TEXT_SIZE )
+            return false;
+        auto pos = _enqueue_pos.load( std::memory_order_relaxed );
+        slot * s;
+        while( true )
+        {
+            s = &_slots[pos & ( CAPACITY - 1 )];
+            auto const seq = s->sequence.load( std::memory_order_acquire );
+            auto const diff = intptr_t( seq ) - intptr_t( pos );
+            if( diff == 0 )
+            {
+                if( _enqueue_pos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                    break;
+            }
+            else if( diff < 0 )
+                return false;  // full: the consumer hasn't freed this slot yet
+            else
+                pos = _enqueue_pos.load( std::memory_order_relaxed );
+        }
+        s->file = file;
+        s->func = func;
+        s->line = line;
+        s->size = unsigned( size );
+        std::memcpy( s->text, text, size );
+        s->sequence.store( pos + 1, std::memory_order_release );
+        return true;
+    }
+
+    // Dispatches all the messages published so far; returns whether there were any
+    bool drain()
+    {
+        std::lock_guard< std::mutex > lock( _drain_mutex );
+        bool any = false;
+        while( true )
+        {
+            auto & s = _slots[_dequeue_pos & ( CAPACITY - 1 )];
+            if( s.sequence.load( std::memory_order_acquire ) != _dequeue_pos + 1 )
+                return any;  // empty, or the next slot is still being written
+            dispatch( s.file, s.line, s.func, s.text, s.size );
+            s.sequence.store( _dequeue_pos + CAPACITY, std::memory_order_release );
+            ++_dequeue_pos;
+            any = true;
+        }
+    }
+};
+
+
+// Created on first use, so it's destroyed (and drained) before the logger it dispatches to
+std::shared_ptr< ring > get_ring( bool create )
+{
+    static std::mutex mutex;
+    static std::shared_ptr< ring > the_ring;
+    std::lock_guard< std::mutex > lock( mutex );
+    if( ! the_ring && create )
+        the_ring = std::make_shared< ring >();
+    return the_ring;
+}
+
+
+}  // namespace
+
+
+void enable( bool on )
+{
+    if( on )
+        get_ring( true );
+    g_on = on;
+    if( ! on )
+        flush();
+}
+
+
+void flush()
+{
+    if( auto r = get_ring( false ) )
+        r->drain();
+}
+
+
+message & message::operator<<( wchar_t const * str )
+{
+    if( ! str )
+        return *this << "(null)";
+    // Same narrowing as EasyLogging++ does without ELPP_UNICODE
+    std::string narrow;
+    for( ; *str; ++str )
+        narrow += static_cast< char >( *str );
+    _ss << narrow;
+    return *this;
+}
+
+
+void message::post( char const * file, unsigned line, char const * func )
+{
+    auto const text = _ss.str();
+    _ss.str( std::string() );
+    _ss.clear();
+
+    // Kept in a static, not looked up on every message
+    static auto const r = get_ring( true );
+    if( ! r->post( file, line, func, text.data(), text.size() ) )
+    {
+        r->drain();  // whatever this thread posted before goes out first
+        dispatch( file, line, func, text.data(), text.size() );
+    }
+}
+
+
+message & message::get()
+{
+    static thread_local message m;
+    return m;
+}
+
+
+}  // namespace async_debug_log
+}  // namespace rsutils
+
+
+#endif  // BUILD_EASYLOGGINGPP
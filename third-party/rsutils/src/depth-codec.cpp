@@ -0,0 +1,239 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <rsutils/image/depth-codec.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+
+namespace rsutils {
+namespace image {
+namespace depth_codec {
+
+
+// Layout: MAGIC, width, height, step, depth_units, method, then the pixels (all little-endian)
+static constexpr uint8_t MAGIC[4] = { 'R', 'S', 'Z', 1 };
+static constexpr size_t HEADER_SIZE = sizeof( MAGIC ) + 3 * sizeof( uint32_t ) + sizeof( float ) + 1;
+
+enum method : uint8_t
+{
+    RAW = 0,        // step * height bytes, as-is
+    DELTA_RLE = 1,  // width pixels per row, as tokens
+};
+
+// Tokens:
+//     0x00-0x7F            zig-zag delta 0..127 from the previous valid pixel
+//     0x80-0xBF  b         zig-zag delta 128..16383: ((t & 0x3F) << 8) | b
+//     0xC0-0xEF            run of 1..48 zero pixels
+//     0xF0       lo hi     run of 1..65535 zero pixels
+//     0xF1       lo hi     a pixel value, as-is
+static constexpr uint8_t SHORT_RUN = 0xC0;
+static constexpr uint32_t MAX_SHORT_RUN = 48;
+static constexpr uint8_t LONG_RUN = 0xF0;
+static constexpr uint8_t LITERAL = 0xF1;
+
+
+static uint8_t * put16( uint8_t * p, uint32_t v )
+{
+    p[0] = uint8_t( v );
+    p[1] = uint8_t( v >> 8 );
+    return p + 2;
+}
+
+static uint8_t * put32( uint8_t * p, uint32_t v )
+{
+    return put16( put16( p, v & 0xFFFF ), v >> 16 );
+}
+
+static uint32_t get16( uint8_t const * p )
+{
+    return uint32_t( p[0] ) | ( uint32_t( p[1] ) << 8 );
+}
+
+static uint32_t get32( uint8_t const * p )
+{
+    return get16( p ) | ( get16( p + 2 ) << 16 );
+}
+
+
+static uint8_t * encode_row( uint8_t const * row, uint32_t width, uint8_t * out )
+{
+    int32_t prev = 0;
+    uint32_t x = 0;
+    while( x < width )
+    {
+        uint16_t v;
+        memcpy( &v, row + 2 * x, 2 );
+        if( ! v )
+        {
+            uint32_t run = 1;
+            while( x + run < width && run < 0xFFFF && ! row[2 * ( x + run )] && ! row[2 * ( x + run ) + 1] )
+                ++run;
+            if( run <= MAX_SHORT_RUN )
+                *out++ = uint8_t( SHORT_RUN + run - 1 );
+            else
+            {
+                *out++ = LONG_RUN;
+                out = put16( out, run );
+            }
+            x += run;
+            continue;
+        }
+
+        int32_t const d = int32_t( v ) - prev;
+        uint32_t const zz = ( uint32_t( d ) << 1 ) ^ uint32_t( d >> 31 );
+        if( zz < 0x80 )
+            *out++ = uint8_t( zz );
+        else if( zz < 0x4000 )
+        {
+            *out++ = uint8_t( 0x80 | ( zz >> 8 ) );
+            *out++ = uint8_t( zz );
+        }
+        else
+        {
+            *out++ = LITERAL;
+            out = put16( out, v );
+        }
+        prev = v;
+        ++x;
+    }
+    return out;
+}
+
+
+void encode( image_info const & info, uint8_t const * pixels, std::vector< uint8_t > & out )
+{
+    size_t const raw_size = size_t( info.step ) * info.height;
+    size_t const start = out.size();
+    // Worst case is a literal (3 bytes) per pixel
+    out.resize( start + HEADER_SIZE + std::max( raw_size, size_t( 3 ) * info.width * info.height ) );
+
+    uint8_t * p = out.data() + start;
+    memcpy( p, MAGIC, sizeof( MAGIC ) );
+    p = put32( p + sizeof( MAGIC ), info.width );
+    p = put32( p, info.height );
+    p = put32( p, info.step );
+    uint32_t units;
+    memcpy( &units, &info.depth_units, sizeof( units ) );
+    p = put32( p, units );
+    uint8_t * const method_byte = p++;
+
+    uint8_t * const data = p;
+    for( uint32_t y = 0; y < info.height && size_t( p - data ) < raw_size; ++y )
+        p = encode_row( pixels + size_t( y ) * info.step, info.width, p );
+
+    if( size_t( p - data ) < raw_size )
+        *method_byte = DELTA_RLE;
+    else
+    {
+        *method_byte = RAW;
+        memcpy( data, pixels, raw_size );
+        p = data + raw_size;
+    }
+    out.resize( p - out.data() );
+}
+
+
+image_info decode_info( uint8_t const * data, size_t size )
+{
+    if( size < HEADER_SIZE || memcmp( data, MAGIC, sizeof( MAGIC ) ) )
+        throw std::runtime_error( "Invalid encoded depth image" );
+    image_info info;
+    data += sizeof( MAGIC );
+    info.width = get32( data );
+    info.height = get32( data + 4 );
+    info.step = get32( data + 8 );
+    uint32_t const units = get32( data + 12 );
+    memcpy( &info.depth_units, &units, sizeof( units ) );
+    if( info.step / 2 < info.width )
+        throw std::runtime_error( "Invalid encoded depth image size" );
+    return info;
+}
+
+
+void decode( uint8_t const * data, size_t size, uint8_t * pixels )
+{
+    auto const info = decode_info( data, size );
+    uint8_t const method = data[HEADER_SIZE - 1];
+    uint8_t const * p = data + HEADER_SIZE;
+    uint8_t const * const end = data + size;
+    size_t const raw_size = size_t( info.step ) * info.height;
+
+    if( method == RAW )
+    {
+        if( size_t( end - p ) != raw_size )
+            throw std::runtime_error( "Invalid encoded depth image: size mismatch" );
+        memcpy( pixels, p, raw_size );
+        return;
+    }
+    if( method != DELTA_RLE )
+        throw std::runtime_error( "Unknown depth image encoding method" );
+
+    auto const need = [&]( size_t n ) {
+        if( size_t( end - p ) < n )
+            throw std::runtime_error( "Invalid encoded depth image: truncated" );
+    };
+    for( uint32_t y = 0; y < info.height; ++y )
+    {
+        uint8_t * const row = pixels + size_t( y ) * info.step;
+        int32_t prev = 0;
+        uint32_t x = 0;
+        while( x < info.width )
+        {
+            need( 1 );
+            uint8_t const t = *p++;
+            int32_t v;
+            if( t >= SHORT_RUN && t <= LONG_RUN )
+            {
+                uint32_t run;
+                if( t == LONG_RUN )
+                {
+                    need( 2 );
+                    run = get16( p );
+                    p += 2;
+                }
+                else
+                    run = t - SHORT_RUN + 1;
+                if( ! run || run > info.width - x )
+                    throw std::runtime_error( "Invalid encoded depth image: run past end of row" );
+                memset( row + 2 * x, 0, 2 * run );
+                x += run;
+                continue;
+            }
+            if( t == LITERAL )
+            {
+                need( 2 );
+                v = int32_t( get16( p ) );
+                p += 2;
+            }
+            else
+            {
+                uint32_t zz = t;
+                if( t >= 0x80 )
+                {
+                    if( t >= SHORT_RUN )
+                        throw std::runtime_error( "Invalid encoded depth image: unknown token" );
+                    need( 1 );
+                    zz = ( uint32_t( t & 0x3F ) << 8 ) | *p++;
+                }
+                v = prev + ( int32_t( zz >> 1 ) ^ -int32_t( zz & 1 ) );
+                if( v < 0 || v > 0xFFFF )
+                    throw std::runtime_error( "Invalid encoded depth image: value out of range" );
+            }
+            uint16_t const pixel = uint16_t( v );
+            memcpy( row + 2 * x, &pixel, 2 );
+            prev = v;
+            ++x;
+        }
+        memset( row + 2 * size_t( info.width ), 0, info.step - 2 * size_t( info.width ) );
+    }
+    if( p != end )
+        throw std::runtime_error( "Invalid encoded depth image: trailing data" );
+}
+
+
+}  // namespace depth_codec
+}  // namespace image
+}  // namespace rsutils
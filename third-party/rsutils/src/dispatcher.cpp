@@ -2,17 +2,21 @@
 // Copyright(c) 2021 Intel Corporation. All Rights Reserved.
 
 #include <rsutils/concurrency/concurrency.h>
+#include <rsutils/concurrency/thread-policy.h>
 #include <rsutils/easylogging/easyloggingpp.h>
 #include <rsutils/time/waiting-on.h>
 
-dispatcher::dispatcher( unsigned int cap, std::function< void( action ) > on_drop_callback )
+dispatcher::dispatcher( unsigned int cap, std::function< void( action ) > on_drop_callback, char const * thread_role )
     : _queue( cap, on_drop_callback )
     , _was_stopped( true )
     , _is_alive( true )
 {
     // We keep a running thread that takes stuff off our queue and dispatches them
-    _thread = std::thread([&]()
+    std::string role( thread_role ? thread_role : "dispatcher" );
+    _thread = std::thread([this, role]()
     {
+        rsutils::concurrency::apply_thread_policy( role.c_str() );
+
         int timeout_ms = 5000;
         while( _is_alive )
         {
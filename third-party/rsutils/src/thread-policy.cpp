@@ -0,0 +1,157 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <rsutils/concurrency/thread-policy.h>
+#include <rsutils/easylogging/easyloggingpp.h>
+#include <rsutils/json.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#endif
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+namespace {
+
+
+struct thread_policy
+{
+    std::string name;
+    std::vector< int > cpus;
+    int priority = 0;
+};
+
+
+std::mutex policies_mutex;
+std::map< std::string, thread_policy > policies;
+
+
+thread_policy parse_policy( std::string const & role, rsutils::json const & j )
+{
+    if( ! j.is_object() )
+        throw std::invalid_argument( "thread policy for '" + role + "' should be an object" );
+    thread_policy policy;
+    j.nested( "name" ).get_ex( policy.name );
+    auto const cpus = j.nested( "cpus" );
+    if( cpus.exists() )
+    {
+        if( ! cpus.is_array() )
+            throw std::invalid_argument( "thread policy for '" + role + "': 'cpus' should be an array" );
+        for( auto const & cpu : cpus )
+        {
+            if( ! cpu.is_number_unsigned() )
+                throw std::invalid_argument( "thread policy for '" + role + "': invalid CPU " + cpu.dump() );
+            policy.cpus.push_back( cpu.get< int >() );
+        }
+    }
+    j.nested( "priority" ).get_ex( policy.priority );
+    if( policy.priority < 0 )
+        throw std::invalid_argument( "thread policy for '" + role + "': priority cannot be negative" );
+    return policy;
+}
+
+
+void apply( char const * role, thread_policy const & policy )
+{
+#ifdef _WIN32
+    if( ! policy.cpus.empty() )
+    {
+        DWORD_PTR mask = 0;
+        for( int cpu : policy.cpus )
+            if( cpu < int( sizeof( mask ) * 8 ) )
+                mask |= DWORD_PTR( 1 ) << cpu;
+        if( ! SetThreadAffinityMask( GetCurrentThread(), mask ) )
+            LOG_WARNING( "failed to set '" << role << "' thread affinity: error " << GetLastError() );
+    }
+    if( policy.priority > 0 )
+    {
+        int const priority = policy.priority >= 90   ? THREAD_PRIORITY_TIME_CRITICAL
+                           : policy.priority >= 50 ? THREAD_PRIORITY_HIGHEST
+                                                   : THREAD_PRIORITY_ABOVE_NORMAL;
+        if( ! SetThreadPriority( GetCurrentThread(), priority ) )
+            LOG_WARNING( "failed to set '" << role << "' thread priority: error " << GetLastError() );
+    }
+    // Thread names need SetThreadDescription, which isn't available on every Windows we support
+#else
+    if( ! policy.name.empty() )
+    {
+#if defined( __APPLE__ )
+        pthread_setname_np( policy.name.c_str() );
+#else
+        pthread_setname_np( pthread_self(), policy.name.substr( 0, 15 ).c_str() );
+#endif
+    }
+#if defined( __linux__ ) && ! defined( __ANDROID__ )
+    if( ! policy.cpus.empty() )
+    {
+        cpu_set_t set;
+        CPU_ZERO( &set );
+        for( int cpu : policy.cpus )
+            if( cpu < CPU_SETSIZE )
+                CPU_SET( cpu, &set );
+        if( int err = pthread_setaffinity_np( pthread_self(), sizeof( set ), &set ) )
+            LOG_WARNING( "failed to set '" << role << "' thread affinity: " << strerror( err ) );
+    }
+#endif
+    if( policy.priority > 0 )
+    {
+        sched_param param = {};
+        param.sched_priority = policy.priority;
+        if( int err = pthread_setschedparam( pthread_self(), SCHED_FIFO, &param ) )
+            LOG_WARNING( "failed to set '" << role << "' thread to SCHED_FIFO priority " << policy.priority << ": "
+                                           << strerror( err ) );
+    }
+#endif
+}
+
+
+}  // namespace
+
+
+void set_thread_policies( rsutils::json const & j )
+{
+    if( ! j.is_object() )
+        throw std::invalid_argument( "thread policies should be an object" );
+    std::map< std::string, thread_policy > new_policies;
+    for( auto it = j.begin(); it != j.end(); ++it )
+        new_policies[it.key()] = parse_policy( it.key(), it.value() );
+
+    std::lock_guard< std::mutex > lock( policies_mutex );
+    policies = std::move( new_policies );
+}
+
+
+void apply_thread_policy( char const * role )
+{
+    if( ! role )
+        role = "default";
+    thread_policy policy;
+    {
+        std::lock_guard< std::mutex > lock( policies_mutex );
+        if( policies.empty() )
+            return;
+        auto it = policies.find( role );
+        if( it == policies.end() )
+            it = policies.find( "default" );
+        if( it == policies.end() )
+            return;
+        policy = it->second;
+    }
+    apply( role, policy );
+}
+
+
+}  // namespace concurrency
+}  // namespace rsutils
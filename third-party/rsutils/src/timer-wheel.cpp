@@ -0,0 +1,230 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <rsutils/concurrency/timer-wheel.h>
+#include <rsutils/concurrency/thread-policy.h>
+#include <rsutils/shared-ptr-singleton.h>
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <algorithm>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+namespace {
+
+// With 10 ms ticks, a turn of the wheel is a little over 5 seconds: longer periods take more than one turn
+size_t const n_slots = 512;
+
+void join_or_detach( std::thread & thread )
+{
+    if( ! thread.joinable() )
+        return;
+    // The last reference may go away on one of our own threads (a task holding it), which cannot join itself
+    if( thread.get_id() == std::this_thread::get_id() )
+        thread.detach();
+    else
+        thread.join();
+}
+
+}  // namespace
+
+
+timer_wheel::timer_wheel( size_t threads, std::chrono::milliseconds tick )
+    : _tick( std::max( tick, std::chrono::milliseconds( 1 ) ) )
+    , _slots( n_slots )
+{
+    _wheel = std::thread( [this]() {
+        apply_thread_policy( "polling" );
+        turn();
+    } );
+    for( size_t i = 0; i < std::max( threads, size_t( 1 ) ); ++i )
+        _workers.emplace_back( [this]() {
+            apply_thread_policy( "polling" );
+            work();
+        } );
+}
+
+
+timer_wheel::~timer_wheel()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stopping = true;
+    }
+    _stop_cv.notify_all();
+    _due_cv.notify_all();
+    join_or_detach( _wheel );
+    for( auto & worker : _workers )
+        join_or_detach( worker );
+}
+
+
+std::shared_ptr< timer_wheel > timer_wheel::shared()
+{
+    static shared_ptr_singleton< timer_wheel > the_wheel;
+    return the_wheel.instance();
+}
+
+
+size_t timer_wheel::ticks_of( std::chrono::milliseconds period ) const
+{
+    auto const ticks = ( period.count() + _tick.count() - 1 ) / _tick.count();
+    return ticks > 1 ? size_t( ticks ) : 1;
+}
+
+
+void timer_wheel::schedule( task_id id, task & t, size_t ticks_from_now )
+{
+    // The wheel gets to this slot in ((ticks - 1) % n_slots) + 1 ticks; the rest are whole turns
+    _slots[( _cursor + ticks_from_now ) % n_slots].push_back( id );
+    t.turns = ( ticks_from_now - 1 ) / n_slots;
+}
+
+
+timer_wheel::task_id timer_wheel::add( std::function< void() > fn, std::chrono::milliseconds period, bool spread )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    auto const id = ++_last_id;
+    auto & t = _tasks[id];
+    t.fn = std::make_shared< std::function< void() > >( std::move( fn ) );
+    t.period = ticks_of( period );
+
+    size_t first = 1;
+    if( spread )
+    {
+        // The least busy tick of the first period, the latest of those (closest to when it would be due) on ties
+        first = std::min( t.period, n_slots );
+        for( size_t ticks = first; ticks > 0; --ticks )
+            if( _slots[( _cursor + ticks ) % n_slots].size() < _slots[( _cursor + first ) % n_slots].size() )
+                first = ticks;
+    }
+    schedule( id, t, first );
+    return id;
+}
+
+
+void timer_wheel::set_period( task_id id, std::chrono::milliseconds period )
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    auto it = _tasks.find( id );
+    if( it != _tasks.end() )
+        it->second.period = ticks_of( period );
+}
+
+
+void timer_wheel::remove( task_id id )
+{
+    std::unique_lock< std::mutex > lock( _mutex );
+    auto const self = std::this_thread::get_id();
+    _done_cv.wait( lock, [&]() {
+        auto it = _tasks.find( id );
+        return it == _tasks.end() || ! it->second.running || it->second.runner == self;
+    } );
+    // Its slot (and _due) are cleaned up as the wheel and workers go by it
+    _tasks.erase( id );
+}
+
+
+size_t timer_wheel::size() const
+{
+    std::lock_guard< std::mutex > lock( _mutex );
+    return _tasks.size();
+}
+
+
+void timer_wheel::turn()
+{
+    auto next = std::chrono::steady_clock::now();
+    std::unique_lock< std::mutex > lock( _mutex );
+    while( true )
+    {
+        next += _tick;
+        if( _stop_cv.wait_until( lock, next, [this]() { return _stopping; } ) )
+            break;
+
+        _cursor = ( _cursor + 1 ) % n_slots;
+        std::vector< task_id > slot;
+        std::swap( slot, _slots[_cursor] );
+        std::vector< task_id > later;  // still turns away
+        bool started = false;
+        for( auto id : slot )
+        {
+            auto it = _tasks.find( id );
+            if( it == _tasks.end() )
+                continue;  // removed
+            auto & t = it->second;
+            if( t.turns )
+            {
+                --t.turns;
+                later.push_back( id );
+                continue;
+            }
+            if( started )
+            {
+                // One task per tick: the rest go in the following ticks
+                schedule( id, t, 1 );
+                continue;
+            }
+            started = true;
+            if( ! t.running )
+            {
+                _due.push_back( id );
+                _due_cv.notify_one();
+            }
+            schedule( id, t, t.period );
+        }
+        auto & current = _slots[_cursor];  // may have been scheduled into, for a whole number of turns
+        current.insert( current.end(), later.begin(), later.end() );
+    }
+}
+
+
+void timer_wheel::work()
+{
+    std::unique_lock< std::mutex > lock( _mutex );
+    while( true )
+    {
+        _due_cv.wait( lock, [this]() { return _stopping || ! _due.empty(); } );
+        if( _stopping )
+            break;
+        auto const id = _due.front();
+        _due.pop_front();
+        auto it = _tasks.find( id );
+        if( it == _tasks.end() || it->second.running )
+            continue;
+        it->second.running = true;
+        it->second.runner = std::this_thread::get_id();
+        auto fn = it->second.fn;  // the task may be removed while running
+
+        lock.unlock();
+        try
+        {
+            ( *fn )();
+        }
+        catch( std::exception const & e )
+        {
+            LOG_ERROR( "Timer wheel task exception caught: " << e.what() );
+        }
+        catch( ... )
+        {
+            LOG_ERROR( "Timer wheel task unknown exception caught!" );
+        }
+        fn.reset();
+        lock.lock();
+
+        it = _tasks.find( id );
+        if( it != _tasks.end() )
+        {
+            it->second.running = false;
+            it->second.runner = std::thread::id();
+        }
+        _done_cv.notify_all();
+    }
+}
+
+
+}  // namespace concurrency
+}  // namespace rsutils
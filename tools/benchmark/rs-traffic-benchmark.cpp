@@ -0,0 +1,599 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+// Load-tests the capture path (software sensor -> syncer or pipeline -> processing) without hardware: software
+// devices are fed frames at the configured rates, with timestamp jitter and drops, and we measure what comes out.
+
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include "tclap/CmdLine.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+using namespace TCLAP;
+
+
+namespace {
+
+
+typedef std::chrono::steady_clock steady;
+
+
+double thread_cpu_seconds()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if( ! GetThreadTimes( GetCurrentThread(), &creation, &exit, &kernel, &user ) )
+        return 0;
+    auto const to_100ns = []( FILETIME const & t ) { return ( uint64_t( t.dwHighDateTime ) << 32 ) | t.dwLowDateTime; };
+    return ( to_100ns( kernel ) + to_100ns( user ) ) * 1e-7;
+#else
+    timespec ts;
+    if( clock_gettime( CLOCK_THREAD_CPUTIME_ID, &ts ) )
+        return 0;
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+
+double process_cpu_seconds()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if( ! GetProcessTimes( GetCurrentProcess(), &creation, &exit, &kernel, &user ) )
+        return 0;
+    auto const to_100ns = []( FILETIME const & t ) { return ( uint64_t( t.dwHighDateTime ) << 32 ) | t.dwLowDateTime; };
+    return ( to_100ns( kernel ) + to_100ns( user ) ) * 1e-7;
+#else
+    return double( std::clock() ) / CLOCKS_PER_SEC;
+#endif
+}
+
+
+// Durations, in microseconds, of which we want percentiles
+class samples
+{
+    std::mutex _mutex;
+    std::vector< double > _us;
+
+public:
+    void add( double us )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _us.push_back( us );
+    }
+
+    size_t size() const { return _us.size(); }
+
+    // Only once all threads are done
+    double percentile( int p )
+    {
+        if( _us.empty() )
+            return 0;
+        std::sort( _us.begin(), _us.end() );
+        return _us[std::min( _us.size() - 1, _us.size() * p / 100 )];
+    }
+};
+
+
+struct stream_spec
+{
+    std::string name;  // depth, color, ir1, ir2
+    rs2_stream type;
+    int index;
+    rs2_format format;
+    int bpp;
+    int width, height, fps;
+};
+
+
+stream_spec parse_stream( std::string const & spec )
+{
+    // name:WxH@fps
+    auto const colon = spec.find( ':' );
+    stream_spec s;
+    s.name = spec.substr( 0, colon );
+    if( s.name == "depth" )
+        s.type = RS2_STREAM_DEPTH, s.index = 0, s.format = RS2_FORMAT_Z16, s.bpp = 2;
+    else if( s.name == "color" )
+        s.type = RS2_STREAM_COLOR, s.index = 0, s.format = RS2_FORMAT_RGB8, s.bpp = 3;
+    else if( s.name == "ir1" || s.name == "ir2" )
+        s.type = RS2_STREAM_INFRARED, s.index = s.name[2] - '0', s.format = RS2_FORMAT_Y8, s.bpp = 1;
+    else
+        throw std::runtime_error( "invalid stream '" + spec + "'; expecting depth, color, ir1 or ir2" );
+    char x = 0, at = 0;
+    std::istringstream is( colon == std::string::npos ? std::string() : spec.substr( colon + 1 ) );
+    if( ! ( is >> s.width >> x >> s.height >> at >> s.fps ) || x != 'x' || at != '@' || s.width <= 0
+        || s.height <= 0 || s.fps <= 0 )
+        throw std::runtime_error( "invalid stream '" + spec + "'; expecting, e.g., depth:848x480@30" );
+    return s;
+}
+
+
+struct settings
+{
+    std::vector< stream_spec > streams;
+    double jitter_ms;     // standard deviation of the timestamp jitter
+    double drop_percent;  // of frames that never make it
+    std::chrono::milliseconds duration;
+    bool use_pipeline;
+    std::vector< std::string > processing;
+    unsigned seed;
+};
+
+
+// What the consumer measures, per stream across all devices
+struct stream_stats
+{
+    std::atomic< uint64_t > emitted{ 0 };
+    std::atomic< uint64_t > dropped{ 0 };
+    std::atomic< uint64_t > delivered{ 0 };
+    samples latency;  // on_video_frame to wait_for_frames
+};
+
+
+class benchmark_state
+{
+public:
+    std::map< std::string, std::unique_ptr< stream_stats > > streams;
+    samples ingest;  // on_video_frame, which includes the syncing
+    std::atomic< uint64_t > framesets{ 0 };
+    std::map< std::string, std::unique_ptr< samples > > processing;
+    std::mutex cpu_mutex;
+    double generator_cpu = 0, consumer_cpu = 0;
+    steady::time_point const start = steady::now();
+
+    // What we stamp each frame with, so the consumer knows how long it took to get to it
+    int64_t now_us() const
+    {
+        return std::chrono::duration_cast< std::chrono::microseconds >( steady::now() - start ).count();
+    }
+};
+
+
+// A software device with a sensor per stream, fed by its own thread
+class traffic_generator
+{
+    struct stream
+    {
+        stream_spec spec;
+        rs2::software_sensor sensor;
+        rs2::stream_profile profile;
+        std::vector< uint8_t > pixels;  // never written to once we start, so shared by all frames
+        stream_stats * stats;
+        steady::time_point next;
+        int frame_number = 0;
+
+        stream( stream_spec const & spec_, rs2::software_sensor const & sensor_ )
+            : spec( spec_ )
+            , sensor( sensor_ )
+            , stats( nullptr )
+        {
+        }
+    };
+
+    rs2::software_device _dev;
+    std::vector< std::unique_ptr< stream > > _streams;
+    settings const & _settings;
+    benchmark_state & _state;
+    std::mt19937 _random;
+    std::thread _thread;
+    std::atomic< bool > _stop{ false };
+
+    static rs2_intrinsics intrinsics( int w, int h )
+    {
+        return { w, h, w / 2.f, h / 2.f, float( w ), float( w ), RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+    }
+
+    void emit( stream & s, std::normal_distribution< double > & jitter,
+               std::bernoulli_distribution & drop )
+    {
+        int const frame_number = ++s.frame_number;
+        s.stats->emitted++;
+        if( drop( _random ) )
+        {
+            s.stats->dropped++;
+            return;
+        }
+
+        // The device clock: when the frame was due, give or take
+        double const timestamp
+            = std::chrono::duration< double, std::milli >( s.next - _state.start ).count()
+            + ( _settings.jitter_ms > 0 ? jitter( _random ) : 0. );
+        s.sensor.set_metadata( RS2_FRAME_METADATA_TIME_OF_ARRIVAL, _state.now_us() );
+        auto const t0 = steady::now();
+        s.sensor.on_video_frame( { s.pixels.data(), []( void * ) {}, s.spec.width * s.spec.bpp, s.spec.bpp,
+                                   timestamp, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, frame_number, s.profile.get(),
+                                   0.001f } );
+        _state.ingest.add( std::chrono::duration< double, std::micro >( steady::now() - t0 ).count() );
+    }
+
+    void run()
+    {
+        std::normal_distribution< double > jitter( 0., std::max( _settings.jitter_ms, 1e-9 ) );
+        std::bernoulli_distribution drop( _settings.drop_percent / 100. );
+        auto const first = steady::now();
+        for( auto & s : _streams )
+            s->next = first;
+        while( ! _stop )
+        {
+            auto & s = **std::min_element( _streams.begin(), _streams.end(),
+                                           []( std::unique_ptr< stream > const & a, std::unique_ptr< stream > const & b )
+                                           { return a->next < b->next; } );
+            std::this_thread::sleep_until( s.next );
+            emit( s, jitter, drop );
+            s.next += std::chrono::duration_cast< steady::duration >(
+                std::chrono::duration< double >( 1. / s.spec.fps ) );
+        }
+        std::lock_guard< std::mutex > lock( _state.cpu_mutex );
+        _state.generator_cpu += thread_cpu_seconds();
+    }
+
+public:
+    traffic_generator( int index, settings const & settings, benchmark_state & state )
+        : _settings( settings )
+        , _state( state )
+        , _random( settings.seed + index )
+    {
+        _dev.register_info( RS2_CAMERA_INFO_NAME, "Traffic Generator" );
+        _dev.register_info( RS2_CAMERA_INFO_SERIAL_NUMBER, "traffic-" + std::to_string( index ) );
+        int uid = 1;
+        rs2::stream_profile first;
+        for( auto const & spec : settings.streams )
+        {
+            std::unique_ptr< stream > s( new stream( spec, _dev.add_sensor( spec.name ) ) );
+            if( spec.type == RS2_STREAM_DEPTH )
+            {
+                s->sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+                s->sensor.add_read_only_option( RS2_OPTION_STEREO_BASELINE, 50.f );
+            }
+            s->profile = s->sensor.add_video_stream( { spec.type, spec.index, uid++, spec.width, spec.height, spec.fps,
+                                                       spec.bpp, spec.format, intrinsics( spec.width, spec.height ) },
+                                                     true );
+            // Something for the depth filters and align to chew on
+            s->pixels.resize( size_t( spec.width ) * spec.height * spec.bpp );
+            for( size_t i = 0; i < s->pixels.size(); ++i )
+                s->pixels[i] = uint8_t( spec.type == RS2_STREAM_DEPTH && i % 2 ? 3 : i * 7 );
+            if( first )
+                first.register_extrinsics_to( s->profile, { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0.015f, 0, 0 } } );
+            else
+                first = s->profile;
+            s->stats = state.streams[spec.name].get();
+            _streams.push_back( std::move( s ) );
+        }
+        _dev.create_matcher( RS2_MATCHER_DEFAULT );  // by timestamp
+    }
+
+    ~traffic_generator() { stop(); }
+
+    rs2::software_device & device() { return _dev; }
+
+    // Without a pipeline, the sensors go straight into the given syncer
+    void open( rs2::syncer & sync )
+    {
+        for( auto & s : _streams )
+        {
+            s->sensor.open( s->profile );
+            s->sensor.start( sync );
+        }
+    }
+
+    void start() { _thread = std::thread( [this]() { run(); } ); }
+
+    void stop()
+    {
+        _stop = true;
+        if( _thread.joinable() )
+            _thread.join();
+    }
+};
+
+
+std::function< rs2::frame( rs2::frame ) > make_block( std::string const & name )
+{
+    if( name == "decimation" )
+        return std::bind( &rs2::filter::process, std::make_shared< rs2::decimation_filter >(), std::placeholders::_1 );
+    if( name == "spatial" )
+        return std::bind( &rs2::filter::process, std::make_shared< rs2::spatial_filter >(), std::placeholders::_1 );
+    if( name == "temporal" )
+        return std::bind( &rs2::filter::process, std::make_shared< rs2::temporal_filter >(), std::placeholders::_1 );
+    if( name == "colorizer" )
+        return std::bind( &rs2::filter::process, std::make_shared< rs2::colorizer >(), std::placeholders::_1 );
+    if( name == "align" )
+        return std::bind( &rs2::filter::process, std::make_shared< rs2::align >( RS2_STREAM_COLOR ),
+                          std::placeholders::_1 );
+    if( name == "pointcloud" )
+    {
+        auto pc = std::make_shared< rs2::pointcloud >();
+        return [pc]( rs2::frame f ) -> rs2::frame {
+            return f.is< rs2::depth_frame >() ? pc->calculate( f ) : f;
+        };
+    }
+    throw std::runtime_error( "invalid processing block '" + name
+                              + "'; expecting decimation, spatial, temporal, colorizer, align or pointcloud" );
+}
+
+
+// Waits for framesets from one device until stopped, and runs them through the processing blocks
+void consume( std::function< bool( rs2::frameset & ) > wait, settings const & settings, benchmark_state & state,
+              std::atomic< bool > & stop )
+{
+    std::vector< std::pair< samples *, std::function< rs2::frame( rs2::frame ) > > > blocks;
+    for( auto & name : settings.processing )
+        blocks.emplace_back( state.processing.at( name ).get(), make_block( name ) );
+
+    rs2::frameset fs;
+    while( ! stop )
+    {
+        if( ! wait( fs ) )
+            continue;
+        auto const now = state.now_us();
+        state.framesets++;
+        for( auto f : fs )
+        {
+            auto it = state.streams.end();
+            auto const profile = f.get_profile();
+            switch( profile.stream_type() )
+            {
+            case RS2_STREAM_DEPTH: it = state.streams.find( "depth" ); break;
+            case RS2_STREAM_COLOR: it = state.streams.find( "color" ); break;
+            case RS2_STREAM_INFRARED: it = state.streams.find( profile.stream_index() == 2 ? "ir2" : "ir1" ); break;
+            default: break;
+            }
+            if( it == state.streams.end() )
+                continue;
+            it->second->delivered++;
+            if( f.supports_frame_metadata( RS2_FRAME_METADATA_TIME_OF_ARRIVAL ) )
+                it->second->latency.add(
+                    double( now - f.get_frame_metadata( RS2_FRAME_METADATA_TIME_OF_ARRIVAL ) ) );
+        }
+
+        rs2::frame f = fs;
+        for( auto & block : blocks )
+        {
+            auto const t0 = steady::now();
+            f = block.second( f );
+            block.first->add( std::chrono::duration< double, std::micro >( steady::now() - t0 ).count() );
+        }
+    }
+    std::lock_guard< std::mutex > lock( state.cpu_mutex );
+    state.consumer_cpu += thread_cpu_seconds();
+}
+
+
+std::string json_string( std::string const & s )
+{
+    std::string out = "\"";
+    for( char c : s )
+    {
+        if( c == '"' || c == '\\' )
+            out += '\\';
+        out += c;
+    }
+    return out + "\"";
+}
+
+
+}  // namespace
+
+
+int main( int argc, char ** argv ) try
+{
+    CmdLine cmd( "librealsense rs-traffic-benchmark tool", ' ', RS2_API_FULL_VERSION_STR );
+    ValueArg< int > devices_arg( "d", "devices", "Number of software devices (default: 1)", false, 1, "count" );
+    MultiArg< std::string > streams_arg( "s", "stream", "Stream of each device, as name:WxH@fps with name one of "
+                                         "depth, color, ir1, ir2 (default: depth:848x480@30 color:1280x720@30)",
+                                         false, "spec" );
+    ValueArg< double > jitter_arg( "j", "jitter", "Timestamp jitter standard deviation, in ms (default: 0.5)", false,
+                                   0.5, "ms" );
+    ValueArg< double > drop_arg( "x", "drop", "Percentage of frames dropped (default: 1)", false, 1, "percent" );
+    ValueArg< double > duration_arg( "t", "time", "Seconds to run for (default: 10)", false, 10, "seconds" );
+    SwitchArg pipeline_arg( "p", "pipeline", "Stream through a pipeline per device, rather than sensors into a syncer" );
+    MultiArg< std::string > process_arg( "b", "block", "Processing block to run on each frameset, in order: "
+                                         "decimation, spatial, temporal, colorizer, align or pointcloud",
+                                         false, "name" );
+    ValueArg< unsigned > seed_arg( "r", "seed", "Seed for the jitter and drops (default: 0)", false, 0, "number" );
+    ValueArg< std::string > json_arg( "o", "json", "Write the results as JSON to this file ('-' for the console)",
+                                      false, "", "path" );
+    cmd.add( devices_arg );
+    cmd.add( streams_arg );
+    cmd.add( jitter_arg );
+    cmd.add( drop_arg );
+    cmd.add( duration_arg );
+    cmd.add( pipeline_arg );
+    cmd.add( process_arg );
+    cmd.add( seed_arg );
+    cmd.add( json_arg );
+    cmd.parse( argc, argv );
+
+    rs2::log_to_console( RS2_LOG_SEVERITY_ERROR );
+
+    settings s;
+    for( auto & spec : streams_arg.getValue() )
+        s.streams.push_back( parse_stream( spec ) );
+    if( s.streams.empty() )
+        s.streams = { parse_stream( "depth:848x480@30" ), parse_stream( "color:1280x720@30" ) };
+    s.jitter_ms = std::max( 0., jitter_arg.getValue() );
+    s.drop_percent = std::min( 100., std::max( 0., drop_arg.getValue() ) );
+    s.duration = std::chrono::milliseconds( int64_t( duration_arg.getValue() * 1000 ) );
+    s.use_pipeline = pipeline_arg.getValue();
+    s.processing = process_arg.getValue();
+    s.seed = seed_arg.getValue();
+    int const n_devices = std::max( 1, devices_arg.getValue() );
+
+    benchmark_state state;
+    for( auto & spec : s.streams )
+        if( ! state.streams.emplace( spec.name, std::unique_ptr< stream_stats >( new stream_stats ) ).second )
+            throw std::runtime_error( "stream '" + spec.name + "' given more than once" );
+    for( auto & name : s.processing )
+    {
+        make_block( name );  // validate
+        state.processing[name].reset( new samples );
+    }
+
+    rs2::context ctx;
+    std::vector< std::unique_ptr< traffic_generator > > generators;
+    std::vector< std::shared_ptr< rs2::syncer > > syncers;
+    std::vector< std::shared_ptr< rs2::pipeline > > pipelines;
+    std::vector< std::function< bool( rs2::frameset & ) > > waits;
+    for( int i = 0; i < n_devices; ++i )
+    {
+        generators.emplace_back( new traffic_generator( i, s, state ) );
+        auto & gen = *generators.back();
+        if( s.use_pipeline )
+        {
+            gen.device().add_to( ctx );
+            auto pipe = std::make_shared< rs2::pipeline >( ctx );
+            rs2::config cfg;
+            cfg.enable_device( "traffic-" + std::to_string( i ) );
+            for( auto & spec : s.streams )
+                cfg.enable_stream( spec.type, spec.index, spec.width, spec.height, spec.format, spec.fps );
+            pipe->start( cfg );
+            pipelines.push_back( pipe );
+            waits.push_back( [pipe]( rs2::frameset & fs ) { return pipe->try_wait_for_frames( &fs, 100 ); } );
+        }
+        else
+        {
+            auto sync = std::make_shared< rs2::syncer >();
+            gen.open( *sync );
+            syncers.push_back( sync );
+            waits.push_back( [sync]( rs2::frameset & fs ) { return sync->try_wait_for_frames( &fs, 100 ); } );
+        }
+    }
+
+    auto const cpu_start = process_cpu_seconds();
+    auto const wall_start = steady::now();
+    std::atomic< bool > stop( false );
+    std::vector< std::thread > consumers;
+    for( auto & wait : waits )
+        consumers.emplace_back( [&, wait]() { consume( wait, s, state, stop ); } );
+    for( auto & gen : generators )
+        gen->start();
+
+    std::this_thread::sleep_for( s.duration );
+
+    for( auto & gen : generators )
+        gen->stop();
+    stop = true;
+    for( auto & t : consumers )
+        t.join();
+    double const seconds = std::chrono::duration< double >( steady::now() - wall_start ).count();
+    double const cpu = process_cpu_seconds() - cpu_start;
+    for( auto & pipe : pipelines )
+        pipe->stop();
+
+    std::cout << ( s.use_pipeline ? "pipeline" : "syncer" ) << ", " << n_devices << " device(s), " << seconds
+              << " s, jitter " << s.jitter_ms << " ms, " << s.drop_percent << "% drops" << std::endl
+              << std::endl;
+    std::cout << std::fixed << std::setprecision( 1 );
+    std::cout << std::left << std::setw( 24 ) << "Stream" << std::right << std::setw( 12 ) << "sent fps"
+              << std::setw( 12 ) << "got fps" << std::setw( 14 ) << "latency p50" << std::setw( 14 ) << "latency p99"
+              << std::endl;
+    for( auto & spec : s.streams )
+    {
+        auto & st = *state.streams[spec.name];
+        std::cout << std::left << std::setw( 24 ) << spec.name << std::right << std::setw( 12 )
+                  << ( st.emitted - st.dropped ) / seconds / n_devices << std::setw( 12 )
+                  << st.delivered / seconds / n_devices << std::setw( 11 ) << st.latency.percentile( 50 ) << " us"
+                  << std::setw( 11 ) << st.latency.percentile( 99 ) << " us" << std::endl;
+    }
+    std::cout << std::endl << std::left << std::setw( 24 ) << "Stage" << std::right << std::setw( 12 ) << "p50 (us)"
+              << std::setw( 12 ) << "p99 (us)" << std::setw( 12 ) << "calls" << std::endl;
+    std::cout << std::left << std::setw( 24 ) << "on_video_frame+sync" << std::right << std::setw( 12 )
+              << state.ingest.percentile( 50 ) << std::setw( 12 ) << state.ingest.percentile( 99 ) << std::setw( 12 )
+              << state.ingest.size() << std::endl;
+    for( auto & name : s.processing )
+    {
+        auto & p = *state.processing[name];
+        std::cout << std::left << std::setw( 24 ) << name << std::right << std::setw( 12 ) << p.percentile( 50 )
+                  << std::setw( 12 ) << p.percentile( 99 ) << std::setw( 12 ) << p.size() << std::endl;
+    }
+    std::cout << std::endl
+              << "framesets/s: " << state.framesets / seconds << std::endl
+              << "CPU: " << 100 * cpu / seconds << "% total, " << 100 * state.generator_cpu / seconds
+              << "% generating+syncing, " << 100 * state.consumer_cpu / seconds << "% consuming+processing"
+              << std::endl;
+
+    auto const & json = json_arg.getValue();
+    if( ! json.empty() )
+    {
+        std::ofstream file;
+        if( json != "-" )
+        {
+            file.open( json );
+            if( ! file )
+                throw std::runtime_error( "cannot write " + json );
+        }
+        std::ostream & os = json == "-" ? std::cout : file;
+        os << std::fixed << std::setprecision( 3 );
+        os << "{\n  \"mode\": " << json_string( s.use_pipeline ? "pipeline" : "syncer" ) << ",\n";
+        os << "  \"devices\": " << n_devices << ",\n";
+        os << "  \"seconds\": " << seconds << ",\n";
+        os << "  \"jitter_ms\": " << s.jitter_ms << ",\n";
+        os << "  \"drop_percent\": " << s.drop_percent << ",\n";
+        os << "  \"seed\": " << s.seed << ",\n";
+        os << "  \"framesets_per_second\": " << state.framesets / seconds << ",\n";
+        os << "  \"cpu_percent\": { \"total\": " << 100 * cpu / seconds
+           << ", \"generating\": " << 100 * state.generator_cpu / seconds
+           << ", \"consuming\": " << 100 * state.consumer_cpu / seconds << " },\n";
+        os << "  \"streams\": [";
+        for( size_t i = 0; i < s.streams.size(); ++i )
+        {
+            auto & spec = s.streams[i];
+            auto & st = *state.streams[spec.name];
+            os << ( i ? "," : "" ) << "\n    { \"name\": " << json_string( spec.name )
+               << ", \"width\": " << spec.width << ", \"height\": " << spec.height << ", \"fps\": " << spec.fps
+               << ", \"sent_fps\": " << ( st.emitted - st.dropped ) / seconds / n_devices
+               << ", \"delivered_fps\": " << st.delivered / seconds / n_devices
+               << ", \"latency_p50_us\": " << st.latency.percentile( 50 )
+               << ", \"latency_p99_us\": " << st.latency.percentile( 99 ) << " }";
+        }
+        os << "\n  ],\n  \"stages\": [";
+        os << "\n    { \"name\": \"on_video_frame+sync\", \"calls\": " << state.ingest.size()
+           << ", \"p50_us\": " << state.ingest.percentile( 50 ) << ", \"p99_us\": " << state.ingest.percentile( 99 )
+           << " }";
+        for( auto & name : s.processing )
+        {
+            auto & p = *state.processing[name];
+            os << ",\n    { \"name\": " << json_string( name ) << ", \"calls\": " << p.size()
+               << ", \"p50_us\": " << p.percentile( 50 ) << ", \"p99_us\": " << p.percentile( 99 ) << " }";
+        }
+        os << "\n  ]\n}\n";
+    }
+
+    return EXIT_SUCCESS;
+}
+catch( const rs2::error & e )
+{
+    std::cerr << "RealSense error calling " << e.get_failed_function() << "(" << e.get_failed_args() << "):\n    "
+              << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
+catch( const std::exception & e )
+{
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
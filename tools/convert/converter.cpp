@@ -30,6 +30,7 @@ void rs2::tools::converter::metadata_to_txtfile(const rs2::frame& frm, const std
 
 bool converter_base::frames_map_get_and_set(rs2_stream streamType, frame_number_t frameNumber)
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     if (_framesMap.find(streamType) == _framesMap.end()) {
         _framesMap.emplace(streamType, std::unordered_set<frame_number_t>());
     }
@@ -46,21 +47,44 @@ bool converter_base::frames_map_get_and_set(rs2_stream streamType, frame_number_
 
 void converter_base::wait_sub_workers()
 {
-    for_each(_subWorkers.begin(), _subWorkers.end(),
+    std::vector<std::thread> subWorkers;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _workers.find(std::this_thread::get_id());
+        if (it == _workers.end())
+            return;
+        subWorkers = std::move(it->second.subWorkers);
+        if (!it->second.worker.joinable())
+            _workers.erase(it);
+    }
+
+    for_each(subWorkers.begin(), subWorkers.end(),
         [](std::thread& t) {
             t.join();
         });
-
-    _subWorkers.clear();
 }
 
 void converter_base::wait()
 {
-    _worker.join();
+    std::thread worker;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _workers.find(std::this_thread::get_id());
+        if (it == _workers.end())
+            return;
+        worker = std::move(it->second.worker);
+        if (it->second.subWorkers.empty())
+            _workers.erase(it);
+    }
+
+    // Nothing was started if the frame was skipped
+    if (worker.joinable())
+        worker.join();
 }
 
 std::string converter_base::get_statistics()
 {
+    std::lock_guard<std::mutex> lock(_mutex);
     std::stringstream result;
     result << name() << '\n';
 
@@ -75,3 +99,83 @@ std::string converter_base::get_statistics()
     return (result.str());
 }
 
+
+converter_pool::converter_pool(std::vector<std::shared_ptr<converter_base>> converters, size_t threads, size_t max_queued)
+    : _converters(std::move(converters))
+    , _maxQueued(std::max<size_t>(max_queued, 1))
+    , _done(false)
+{
+    for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i)
+        _threads.emplace_back([this] { work(); });
+}
+
+converter_pool::~converter_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _done = true;
+    }
+    _cv.notify_all();
+    for (auto& t : _threads)
+        if (t.joinable())
+            t.join();
+}
+
+void converter_pool::convert(rs2::frame frame)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this] { return _queue.size() < _maxQueued || _done; });
+    if (_done)
+        return;
+    _queue.push_back(std::move(frame));
+    _cv.notify_all();
+}
+
+void converter_pool::work()
+{
+    while (true)
+    {
+        rs2::frame frame;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this] { return !_queue.empty() || _done; });
+            if (_queue.empty())
+                return;
+            frame = std::move(_queue.front());
+            _queue.pop_front();
+        }
+        _cv.notify_all();
+
+        try
+        {
+            for (auto& converter : _converters)
+                converter->convert(frame);
+            for (auto& converter : _converters)
+                converter->wait();
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_error)
+                _error = std::current_exception();
+        }
+    }
+}
+
+void converter_pool::finish()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _done = true;
+    }
+    _cv.notify_all();
+    for (auto& t : _threads)
+        t.join();
+    _threads.clear();
+
+    if (_error)
+        std::rethrow_exception(_error);
+
+    for (auto& converter : _converters)
+        converter->finish();
+}
@@ -10,6 +10,12 @@
 #include <string>
 #include <sstream>
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 
 #include "librealsense2/rs.hpp"
 
@@ -22,10 +28,17 @@ namespace rs2 {
 
             typedef unsigned long long frame_number_t;
 
+            // convert() and wait() may be called from several threads at once (see converter_pool): the workers are
+            // kept per calling thread, so each wait() only waits for the conversion its own thread started.
             class converter_base {
             protected:
-                std::thread _worker;
-                std::vector<std::thread> _subWorkers;
+                struct workers {
+                    std::thread worker;
+                    std::vector<std::thread> subWorkers;
+                };
+
+                std::mutex _mutex;  // protects _workers and _framesMap
+                std::map<std::thread::id, workers> _workers;
                 std::unordered_map<int, std::unordered_set<frame_number_t>> _framesMap;
 
             protected:
@@ -34,23 +47,58 @@ namespace rs2 {
 
                 template <typename F> void start_worker(const F& f)
                 {
-                    _worker = std::thread(f);
+                    std::thread worker(f);
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _workers[std::this_thread::get_id()].worker = std::move(worker);
                 }
 
                 template <typename F> void add_sub_worker(const F& f)
                 {
-                    _subWorkers.emplace_back(f);
+                    std::thread worker(f);
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _workers[std::this_thread::get_id()].subWorkers.push_back(std::move(worker));
                 }
 
             public:
+                virtual ~converter_base() = default;
+
                 virtual void convert(rs2::frame& frame) = 0;
                 virtual std::string name() const = 0;
 
                 virtual std::string get_statistics();
 
+                // Called once all frames were converted
+                virtual void finish() {}
+
                 void wait();
             };
 
+            // Converts frames on a number of threads, handing each frame to all the converters. At most 'max_queued'
+            // frames wait for a free thread; convert() blocks until there is room, which keeps memory use bounded (and,
+            // with non-real-time playback, holds the playback back to the pace of the conversion).
+            class converter_pool {
+                std::vector<std::shared_ptr<converter_base>> _converters;
+                size_t _maxQueued;
+                std::vector<std::thread> _threads;
+                std::deque<rs2::frame> _queue;
+                std::mutex _mutex;
+                std::condition_variable _cv;
+                bool _done;
+                std::exception_ptr _error;
+
+                void work();
+
+            public:
+                converter_pool(std::vector<std::shared_ptr<converter_base>> converters, size_t threads, size_t max_queued);
+                ~converter_pool();
+
+                void convert(rs2::frame frame);
+
+                // Waits for all the frames to be converted, then finishes the converters; rethrows the first error any
+                // of the conversions ran into
+                void finish();
+            };
+
         }
     }
 }
@@ -45,9 +45,7 @@ converter_csv::converter_csv(const std::string& filePath, rs2_stream streamType)
     : _filePath(filePath)
     , _streamType(streamType)
     , _imu_pose_collection()
-    , _sub_workers_joined(false)
     , _m()
-    , _cv()
 {
 }
 
@@ -58,7 +56,7 @@ void converter_csv::convert_depth(rs2::depth_frame& depthframe)
     }
 
     start_worker(
-        [this, &depthframe] {
+        [this, depthframe] {
 
             std::stringstream filename;
             filename << _filePath
@@ -131,8 +129,12 @@ void converter_csv::save_motion_pose_data_to_file()
     if (!csv.is_open())
         throw std::runtime_error(stringify() << "Cannot open the requested output file " << _filePath << ", please check permissions");
 
-    for (const auto& elem : _imu_pose_collection)
+    for (auto& elem : _imu_pose_collection)
     {
+        // Frames converted on several threads may have been collected out of order
+        std::stable_sort(elem.second.begin(), elem.second.end(),
+            [](const motion_pose_frame_record& a, const motion_pose_frame_record& b) { return a._frame_number < b._frame_number; });
+
         csv << "\n\nStream Type,F#,HW Timestamp (ms),Backend Timestamp(ms),Host Timestamp(ms)"
             << (val_in_range(elem.first.first, { RS2_STREAM_GYRO,RS2_STREAM_ACCEL }) ? ",3DOF_x,3DOF_y,3DOF_z" : "")
             << (val_in_range(elem.first.first, { RS2_STREAM_POSE }) ? ",t_x,t_y,t_z,r_x,r_y,r_z,r_w" : "")
@@ -150,56 +152,51 @@ void converter_csv::convert_motion_pose(rs2::frame& f)
         return;
     }
 
-    start_worker(
-        [this, f] {
+    auto stream_uid = std::make_pair(f.get_profile().stream_type(),
+        f.get_profile().stream_index());
 
-            add_sub_worker(
-                [this, f] {
-                    auto stream_uid = std::make_pair(f.get_profile().stream_type(),
-                        f.get_profile().stream_index());
-
-                    long long frame_timestamp = 0LL;
-                    if (f.supports_frame_metadata(RS2_FRAME_METADATA_FRAME_TIMESTAMP))
-                        frame_timestamp = f.get_frame_metadata(RS2_FRAME_METADATA_FRAME_TIMESTAMP);
-
-                    long long backend_timestamp = 0LL;
-                    if (f.supports_frame_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP))
-                        backend_timestamp = f.get_frame_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP);
-
-                    long long time_of_arrival = 0LL;
-                    if (f.supports_frame_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL))
-                        time_of_arrival = f.get_frame_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL);
-                    
-                    motion_pose_frame_record record{ f.get_profile().stream_type(),
-                                                f.get_profile().stream_index(),
-                                                f.get_frame_number(),
-                                                frame_timestamp,
-                                                backend_timestamp,
-                                                time_of_arrival};
-
-                    if (auto motion = f.as<rs2::motion_frame>())
-                    {
-                        auto axes = motion.get_motion_data();
-                        record._params = { axes.x, axes.y, axes.z };
-                    }
+    long long frame_timestamp = 0LL;
+    if (f.supports_frame_metadata(RS2_FRAME_METADATA_FRAME_TIMESTAMP))
+        frame_timestamp = f.get_frame_metadata(RS2_FRAME_METADATA_FRAME_TIMESTAMP);
 
-                    if (auto pf = f.as<rs2::pose_frame>())
-                    {
-                        auto pose = pf.get_pose_data();
-                        record._params = { pose.translation.x, pose.translation.y, pose.translation.z,
-                                pose.rotation.x,pose.rotation.y,pose.rotation.z,pose.rotation.w };
-                    }
+    long long backend_timestamp = 0LL;
+    if (f.supports_frame_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP))
+        backend_timestamp = f.get_frame_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP);
 
-                    _imu_pose_collection[stream_uid].emplace_back(record);
-                });
-            wait_sub_workers();
-            _sub_workers_joined = true;
-            _cv.notify_all();
-        });
-    std::unique_lock<std::mutex> lck(_m);
-    while (!_sub_workers_joined)
-        _cv.wait(lck);
-    save_motion_pose_data_to_file();
+    long long time_of_arrival = 0LL;
+    if (f.supports_frame_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL))
+        time_of_arrival = f.get_frame_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL);
+
+    motion_pose_frame_record record{ f.get_profile().stream_type(),
+                                f.get_profile().stream_index(),
+                                f.get_frame_number(),
+                                frame_timestamp,
+                                backend_timestamp,
+                                time_of_arrival};
+
+    if (auto motion = f.as<rs2::motion_frame>())
+    {
+        auto axes = motion.get_motion_data();
+        record._params = { axes.x, axes.y, axes.z };
+    }
+
+    if (auto pf = f.as<rs2::pose_frame>())
+    {
+        auto pose = pf.get_pose_data();
+        record._params = { pose.translation.x, pose.translation.y, pose.translation.z,
+                pose.rotation.x,pose.rotation.y,pose.rotation.z,pose.rotation.w };
+    }
+
+    // The records are all written out by finish()
+    std::lock_guard<std::mutex> lock(_m);
+    _imu_pose_collection[stream_uid].emplace_back(record);
+}
+
+void converter_csv::finish()
+{
+    std::lock_guard<std::mutex> lock(_m);
+    if (_imu_pose_collection.size())
+        save_motion_pose_data_to_file();
 }
 
 void converter_csv::convert(rs2::frame& frame)
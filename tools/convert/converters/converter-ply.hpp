@@ -6,6 +6,7 @@
 
 
 #include "../converter.hpp"
+#include <librealsense2/hpp/rs_export.hpp>
 
 
 namespace rs2 {
@@ -50,7 +51,9 @@ namespace rs2 {
                                     << "_" << std::setprecision(14) << std::fixed << frameDepth.get_timestamp()
                                     << ".ply";
 
-                                points.export_to_ply(filename.str(), frameColor);
+                                // Each frame is converted on a thread of its own
+                                rs2::ply_writer writer;
+                                writer.write(filename.str(), points, frameColor);
 
                                 std::stringstream metadata_file;
                                 metadata_file << _filePath
@@ -20,6 +20,7 @@ namespace rs2 {
                 rs2_stream _streamType;
                 std::string _filePath;
                 rs2::colorizer _colorizer;
+                std::mutex _colorizerMutex;  // frames may be converted on several threads
 
             public:
                 converter_png(const std::string& filePath, rs2_stream streamType = rs2_stream::RS2_STREAM_ANY)
@@ -50,6 +51,7 @@ namespace rs2 {
                             rs2::video_frame videoframe = frame.as<rs2::video_frame>();
 
                             if (videoframe.get_profile().stream_type() == rs2_stream::RS2_STREAM_DEPTH) {
+                                std::lock_guard<std::mutex> lock(_colorizerMutex);
                                 videoframe = _colorizer.process(videoframe);
                             }
 
@@ -43,6 +43,7 @@ int main(int argc, char** argv) try
     ValueArg <string> frameNumberEnd("t", "last-framenumber", "ignore frames whose frame number is greater than this value", false, "", "last-framenumber");
     ValueArg <string> startTime("s", "start-time", "ignore frames whose timestamp is less than this value (the first frame is at time 0)", false, "", "start-time");
     ValueArg <string> endTime("e", "end-time", "ignore frames whose timestamp is greater than this value (the first frame is at time 0)", false, "", "end-time");
+    ValueArg <unsigned> threads("j", "threads", "number of frames to convert in parallel (default - 1)", false, 1, "threads");
 
 
     cmd.add(inputFilename);
@@ -50,6 +51,7 @@ int main(int argc, char** argv) try
     cmd.add(frameNumberStart);
     cmd.add(endTime);
     cmd.add(startTime);
+    cmd.add(threads);
     cmd.add(outputFilenamePng);
     cmd.add(outputFilenameCsv);
     cmd.add(outputFilenameRaw);
@@ -130,6 +132,11 @@ int main(int argc, char** argv) try
         end_time = (uint64_t) (SECONDS_TO_NANOSECONDS * (std::strtod( endTime.getValue().c_str(), nullptr )));
     }
 
+    // Frames are read from the file once, and each is handed to all the converters on one of these threads; a couple
+    // of frames per thread are queued so the threads don't wait on the playback
+    const size_t conversion_threads = std::max( threads.getValue(), 1u );
+    const size_t max_queued_frames = 2 * conversion_threads;
+
     //in order to convert frames into ply we need synced depth and color frames, 
     //therefore we use pipeline
     if (outputFilenamePly.isSet()) {
@@ -147,6 +154,8 @@ int main(int argc, char** argv) try
         cfg.enable_device_from_file(inputFilename.getValue());
         pipe->start(cfg);
 
+        rs2::tools::converter::converter_pool pool( { plyconverter }, conversion_threads, max_queued_frames );
+
         auto device = pipe->get_active_profile().get_device();
         rs2::playback playback = device.as<rs2::playback>();
         playback.set_real_time(false);
@@ -182,10 +191,7 @@ int main(int argc, char** argv) try
                 process_frame = false;
          
             if( process_frame )
-            {
-                plyconverter->convert(frameset);
-                plyconverter->wait();
-            }
+                pool.convert( frameset );
 
             auto posNext = playback.get_position();
 
@@ -195,6 +201,7 @@ int main(int argc, char** argv) try
 
             posCurr = posNext;
         }
+        pool.finish();
     }
 
     // for every converter other than ply,
@@ -207,6 +214,7 @@ int main(int argc, char** argv) try
         playback.set_real_time(false);
         std::vector<rs2::sensor> sensors = playback.query_sensors();
         std::mutex mutex;
+        rs2::tools::converter::converter_pool pool( converters, conversion_threads, max_queued_frames );
 
         auto duration = playback.get_duration();
         int progress = 0;
@@ -235,15 +243,7 @@ int main(int argc, char** argv) try
                 if (endTime.isSet() && posCurr > end_time)
                     return;
 
-                for_each(converters.begin(), converters.end(),
-                    [&frame](shared_ptr<rs2::tools::converter::converter_base>& converter) {
-                    converter->convert(frame);
-                });
-
-                for_each(converters.begin(), converters.end(),
-                    [](shared_ptr<rs2::tools::converter::converter_base>& converter) {
-                    converter->wait();
-                });
+                pool.convert( frame );
             });
 
         }
@@ -279,6 +279,7 @@ int main(int argc, char** argv) try
             sensor.stop();
             sensor.close();
         }
+        pool.finish();
     }
 
     if( !switchTextOutput.isSet() )
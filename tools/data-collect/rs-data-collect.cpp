@@ -97,8 +97,47 @@ void data_collector::parse_and_configure(ValueArg<string>& config_file)
     }
 }
 
+std::string data_collector::configuration_description() const
+{
+    std::string description;
+    for (const auto& elem : selected_stream_profiles)
+        description += get_profile_description(elem);
+    return description;
+}
+
+void data_collector::stream_to_binary_file(const string& out_filename)
+{
+    _binary = std::make_shared<binary_writer>(out_filename, configuration_description());
+}
+
+void data_collector::write_csv(std::ostream& csv, const std::string& configuration, const records_map& records)
+{
+    csv << "Configuration:\nStream Type,Stream Name,Format,FPS,Width,Height\n";
+    csv << configuration;
+
+    for (const auto& elem : records)
+    {
+        csv << "\n\nStream Type,Index,F#,HW Timestamp (ms),Host Timestamp(ms)"
+            << (val_in_range(elem.first.first, { RS2_STREAM_GYRO,RS2_STREAM_ACCEL }) ? ",3DOF_x,3DOF_y,3DOF_z" : "")
+            << (val_in_range(elem.first.first, { RS2_STREAM_POSE }) ? ",t_x,t_y,t_z,r_x,r_y,r_z,r_w" : "")
+            << std::endl;
+
+        for (auto i = 0; i < elem.second.size(); i++)
+            csv << elem.second[i].to_string();
+    }
+}
+
 void data_collector::save_data_to_file(const string& out_filename)
 {
+    if (_binary)
+    {
+        auto written = _binary->records_written();
+        _binary.reset();    // Flushes the file
+        std::cout << "\nData collection accomplished with " << written << " records streamed into "
+            << out_filename << std::endl;
+        return;
+    }
+
     if (!data_collection.size())
         throw runtime_error(stringify() << "No data collected, aborting");
 
@@ -118,20 +157,7 @@ void data_collector::save_data_to_file(const string& out_filename)
     if (!csv.is_open())
         throw runtime_error(stringify() << "Cannot open the requested output file " << out_filename << ", please check permissions");
 
-    csv << "Configuration:\nStream Type,Stream Name,Format,FPS,Width,Height\n";
-    for (const auto& elem : selected_stream_profiles)
-        csv << get_profile_description(elem);
-
-    for (const auto& elem : data_collection)
-    {
-        csv << "\n\nStream Type,Index,F#,HW Timestamp (ms),Host Timestamp(ms)"
-            << (val_in_range(elem.first.first, { RS2_STREAM_GYRO,RS2_STREAM_ACCEL }) ? ",3DOF_x,3DOF_y,3DOF_z" : "")
-            << (val_in_range(elem.first.first, { RS2_STREAM_POSE }) ? ",t_x,t_y,t_z,r_x,r_y,r_z,r_w" : "")
-            << std::endl;
-
-        for (auto i = 0; i < elem.second.size(); i++)
-            csv << elem.second[i].to_string();
-    }
+    write_csv(csv, configuration_description(), data_collection);
 }
 
 void data_collector::collect_frame_attributes(rs2::frame f, std::chrono::time_point<std::chrono::high_resolution_clock> start_time)
@@ -139,7 +165,7 @@ void data_collector::collect_frame_attributes(rs2::frame f, std::chrono::time_po
     auto arrival_time = std::chrono::duration<double, std::milli>(chrono::high_resolution_clock::now() - start_time);
     auto stream_uid = std::make_pair(f.get_profile().stream_type(), f.get_profile().stream_index());
 
-    if (data_collection[stream_uid].size() < _max_frames)
+    if (frames_received[stream_uid] < _max_frames)
     {
         frame_record rec{ f.get_frame_number(),
             f.get_timestamp(),
@@ -162,7 +188,11 @@ void data_collector::collect_frame_attributes(rs2::frame f, std::chrono::time_po
                     pose.rotation.x,pose.rotation.y,pose.rotation.z,pose.rotation.w };
         }
 
-        data_collection[stream_uid].emplace_back(rec);
+        if (_binary)
+            _binary->append(rec);
+        else
+            data_collection[stream_uid].emplace_back(rec);
+        ++frames_received[stream_uid];
     }
 }
 
@@ -182,8 +212,8 @@ bool data_collector::collecting(std::chrono::time_point<std::chrono::high_resolu
     for (auto&& profile : selected_stream_profiles)
     {
         auto key = std::make_pair(profile.stream_type(), profile.stream_index());
-        if (!data_collection.size() || (data_collection.find(key) != data_collection.end() &&
-            (data_collection[key].size() && data_collection[key].size() < _max_frames)))
+        if (!frames_received.size() || (frames_received.find(key) != frames_received.end() &&
+            (frames_received[key] && frames_received[key] < _max_frames)))
         {
             collected_enough_frames = false;
             break;
@@ -281,6 +311,115 @@ bool data_collector::configure_sensors()
     return succeed;
 }
 
+binary_writer::binary_writer(const std::string& filename, const std::string& configuration)
+    : _file(filename, std::ios::binary | std::ios::trunc)
+{
+    if (!_file.is_open())
+        throw runtime_error(stringify() << "Cannot open the requested output file " << filename << ", please check permissions");
+
+    binary_file_header header = { { 'R', 'S', 'D', 'C' }, BINARY_FILE_VERSION, sizeof(binary_record),
+        static_cast<uint32_t>(configuration.size()) };
+    _file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    _file.write(configuration.data(), configuration.size());
+
+    _filling.reserve(BUFFER_RECORDS);
+    _writing.reserve(BUFFER_RECORDS);
+    _thread = std::thread([this]() { write_loop(); });
+}
+
+binary_writer::~binary_writer()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _cv.notify_one();
+    _thread.join();
+}
+
+void binary_writer::append(const data_collector::frame_record& rec)
+{
+    binary_record b = { rec._frame_number, rec._ts, rec._arrival_time, rec._domain, rec._stream_type, rec._stream_idx, 0 };
+    std::copy(rec._params.begin(), rec._params.end(), b.params);
+
+    bool full;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _filling.push_back(b);
+        full = _filling.size() >= BUFFER_RECORDS;
+    }
+    if (full)
+        _cv.notify_one();
+}
+
+uint64_t binary_writer::records_written() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _written + _filling.size() + _writing.size();
+}
+
+void binary_writer::write_loop()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _cv.wait_for(lock, std::chrono::milliseconds(100),
+            [this]() { return _stopping || _filling.size() >= BUFFER_RECORDS; });
+        bool const stopping = _stopping;
+
+        // The callbacks go on filling the other buffer while this one is written
+        std::swap(_filling, _writing);
+        lock.unlock();
+        if (_writing.size())
+            _file.write(reinterpret_cast<const char*>(_writing.data()), _writing.size() * sizeof(binary_record));
+        lock.lock();
+        _written += _writing.size();
+        _writing.clear();
+
+        if (stopping && _filling.empty())
+            break;
+    }
+    _file.flush();
+}
+
+void rs_data_collect::convert_binary_to_csv(const std::string& bin_filename, const std::string& csv_filename)
+{
+    ifstream bin(bin_filename, std::ios::binary);
+    if (!bin.is_open())
+        throw runtime_error(stringify() << "Cannot open " << bin_filename);
+
+    binary_file_header header;
+    if (!bin.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::string(header.magic, 4) != "RSDC")
+        throw runtime_error(stringify() << bin_filename << " is not an rs-data-collect binary file");
+    if (header.version != BINARY_FILE_VERSION || header.record_size != sizeof(binary_record))
+        throw runtime_error(stringify() << bin_filename << " has an unsupported version " << header.version
+            << " (record size " << header.record_size << ")");
+
+    std::string configuration(header.configuration_size, '\0');
+    bin.read(&configuration[0], configuration.size());
+
+    // Records of all streams come interleaved, as they arrived: the CSV has them per stream
+    data_collector::records_map records;
+    binary_record b;
+    uint64_t n = 0;
+    while (bin.read(reinterpret_cast<char*>(&b), sizeof(b)))
+    {
+        auto type = static_cast<rs2_stream>(b.stream_type);
+        data_collector::frame_record rec{ b.frame_number, b.ts, b.arrival_time,
+            static_cast<rs2_timestamp_domain>(b.domain), type, b.stream_idx };
+        std::copy(b.params, b.params + 7, rec._params.begin());
+        records[std::make_pair(type, int(b.stream_idx))].emplace_back(rec);
+        ++n;
+    }
+
+    ofstream csv(csv_filename);
+    if (!csv.is_open())
+        throw runtime_error(stringify() << "Cannot open the requested output file " << csv_filename << ", please check permissions");
+    data_collector::write_csv(csv, configuration, records);
+
+    std::cout << "Converted " << n << " records from " << bin_filename << " into " << csv_filename << std::endl;
+}
+
 int main(int argc, char** argv) try
 {
 
@@ -294,19 +433,30 @@ int main(int argc, char** argv) try
     ValueArg<int>    max_frames("m", "MaxFrames_Number", "Maximum number of frames-per-stream to receive", false, 100, "");
     ValueArg<string> out_file("f", "FullFilePath", "the file where the data will be saved to", false, "", "");
     ValueArg<string> config_file("c", "ConfigurationFile", "Specify file path with the requested configuration", false, "", "");
+    SwitchArg        binary("b", "Binary", "Stream fixed-size binary records into the file as frames arrive, instead of writing CSV at the end", false);
+    ValueArg<string> convert("x", "ConvertBinary", "Convert a binary file made with -b into CSV (saved to -f), and exit", false, "", "");
 
     cmd.add(timeout);
     cmd.add(max_frames);
     cmd.add(out_file);
     cmd.add(config_file);
+    cmd.add(binary);
+    cmd.add(convert);
     cmd.parse(argc, argv);
 
+    if (convert.isSet())
+    {
+        convert_binary_to_csv(convert.getValue(), out_file.isSet() ? out_file.getValue() : DEF_OUTPUT_FILE_NAME);
+        return EXIT_SUCCESS;
+    }
+
     std::cout << "Running rs-data-collect: ";
     for (auto i=1; i < argc; ++i)
         std::cout << argv[i] << " ";
     std::cout << std::endl << std::endl;
 
-    auto output_file       = out_file.isSet() ? out_file.getValue() : DEF_OUTPUT_FILE_NAME;
+    auto output_file       = out_file.isSet() ? out_file.getValue() :
+        binary.isSet() ? DEF_BINARY_OUTPUT_FILE_NAME : DEF_OUTPUT_FILE_NAME;
 
     {
         ofstream csv(output_file);
@@ -335,6 +485,9 @@ int main(int argc, char** argv) try
 
         dc.parse_and_configure(config_file);
 
+        if (binary.isSet())
+            dc.stream_to_binary_file(output_file);
+
         //data_collection buffer;
         auto start_time = chrono::high_resolution_clock::now();
 
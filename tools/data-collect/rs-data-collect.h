@@ -26,9 +26,14 @@ GYRO,1,1,200,MOTION_XYZ32F
 
 #include <librealsense2/rs.hpp>
 #include "tclap/CmdLine.h"
+#include <array>
+#include <condition_variable>
 #include <fstream>
+#include <iomanip>
 #include <sstream>
 #include <map>
+#include <mutex>
+#include <thread>
 
 
 using namespace std;
@@ -38,6 +43,7 @@ namespace rs_data_collect
 {
     const uint64_t  DEF_FRAMES_NUMBER = 100;
     const std::string DEF_OUTPUT_FILE_NAME("frames_data.csv");
+    const std::string DEF_BINARY_OUTPUT_FILE_NAME("frames_data.bin");
 
     // Split string into token,  trim unreadable characters
     inline std::vector<std::string> tokenize(std::string line, char separator)
@@ -174,6 +180,8 @@ namespace rs_data_collect
         stop_on_any
     };
 
+    class binary_writer;
+
     class data_collector
     {
     public:
@@ -183,6 +191,8 @@ namespace rs_data_collect
         data_collector(const data_collector&);
 
         void parse_and_configure(ValueArg<string>& config_file);
+        // Records are streamed into the binary file as they arrive, instead of being kept for save_data_to_file()
+        void stream_to_binary_file(const string& out_filename);
         void save_data_to_file(const string& out_filename);
         void collect_frame_attributes(rs2::frame f, std::chrono::time_point<std::chrono::high_resolution_clock> start_time);
         bool collecting(std::chrono::time_point<std::chrono::high_resolution_clock> start_time);
@@ -234,10 +244,16 @@ namespace rs_data_collect
             std::array<double,7>    _params;            // |The parameters are optional and sensor specific
         };
 
+        typedef std::map<std::pair<rs2_stream, int>, std::vector<frame_record>> records_map;
+
+        static void write_csv(std::ostream& csv, const std::string& configuration, const records_map& records);
+
     private:
 
         std::shared_ptr<rs2::device>        _dev;
-        std::map<std::pair<rs2_stream, int>, std::vector<frame_record>> data_collection;
+        records_map                         data_collection;
+        std::map<std::pair<rs2_stream, int>, uint64_t> frames_received;  // Per stream, whether kept or streamed
+        std::shared_ptr<binary_writer>      _binary;
         std::vector<stream_request>         requests_to_go, user_requests;
         std::vector<rs2::sensor>            active_sensors;
         std::vector<rs2::stream_profile>    selected_stream_profiles;
@@ -250,5 +266,63 @@ namespace rs_data_collect
 
         // Assign the user configuration to the selected device
         bool configure_sensors();
+
+        std::string configuration_description() const;
+    };
+
+    // A frame_record, as stored in the binary file: fixed-size, in host byte order
+    struct binary_record
+    {
+        uint64_t    frame_number;
+        double      ts;
+        double      arrival_time;
+        int32_t     domain;
+        int32_t     stream_type;
+        int32_t     stream_idx;
+        int32_t     reserved;
+        double      params[7];
+    };
+    static_assert(sizeof(binary_record) == 96, "binary_record must not be padded");
+
+    // The binary file starts with this header, then 'configuration_size' bytes of the (CSV) configuration description,
+    // then records until the end of the file
+    struct binary_file_header
+    {
+        char        magic[4];           // "RSDC"
+        uint32_t    version;
+        uint32_t    record_size;
+        uint32_t    configuration_size;
     };
+
+    const uint32_t BINARY_FILE_VERSION = 1;
+
+    // Appends records to a binary file on a background thread, so the frame callbacks neither format text nor wait
+    // for the disk: they fill a buffer, which is handed to the thread when full (or every 100 ms) while another is
+    // filled
+    class binary_writer
+    {
+    public:
+        binary_writer(const std::string& filename, const std::string& configuration);
+        ~binary_writer();   // Writes what is left, and closes the file
+
+        void append(const data_collector::frame_record& rec);
+        uint64_t records_written() const;
+
+    private:
+        void write_loop();
+
+        static const size_t         BUFFER_RECORDS = 4096;
+
+        std::ofstream               _file;
+        std::vector<binary_record>  _filling;
+        std::vector<binary_record>  _writing;
+        mutable std::mutex          _mutex;
+        std::condition_variable     _cv;
+        bool                        _stopping = false;
+        uint64_t                    _written = 0;
+        std::thread                 _thread;
+    };
+
+    // Converts a binary file made with -b into the same CSV rs-data-collect writes otherwise
+    void convert_binary_to_csv(const std::string& bin_filename, const std::string& csv_filename);
 }
@@ -14,6 +14,7 @@
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/dds-device-server.h>
 #include <realdds/dds-stream-server.h>
+#include <realdds/dds-publisher.h>
 #include <realdds/dds-topic-reader-thread.h>
 #include <realdds/dds-participant.h>
 #include <realdds/dds-guid.h>
@@ -249,6 +250,7 @@ std::vector< std::shared_ptr< realdds::dds_stream_server > > lrs_device_controll
         server->init_profiles( profiles, default_profile_index );
 
         // Get supported options and recommended filters for this stream
+        realdds::dds_options stream_options;
         for( auto & sensor : _rs_dev.query_sensors() )
         {
             std::string const sensor_name = sensor.get_info( RS2_CAMERA_INFO_NAME );
@@ -259,7 +261,6 @@ std::vector< std::shared_ptr< realdds::dds_stream_server > > lrs_device_controll
             // only need to do this once per sensor!
             if( sensors_handled.emplace( sensor_name ).second )
             {
-                realdds::dds_options stream_options;
                 auto supported_options = sensor.get_supported_options();
                 for( auto option_id : supported_options )
                 {
@@ -313,11 +314,29 @@ std::vector< std::shared_ptr< realdds::dds_stream_server > > lrs_device_controll
                 for( auto const & filter : recommended_filters )
                     filter_names.push_back( filter.get_info( RS2_CAMERA_INFO_NAME ) );
 
-                server->init_options( stream_options );
                 server->set_recommended_filters( std::move( filter_names ) );
             }
         }
 
+        // Compression is per stream, and handled by the server rather than the sensor
+        json compression_choices;
+        if( std::dynamic_pointer_cast< dds_depth_stream_server >( server ) )
+            compression_choices = json::array( { "none", "lossless" } );
+        else if( std::dynamic_pointer_cast< dds_color_stream_server >( server ) )
+            compression_choices = json::array( { "none", "jpeg" } );
+        if( ! compression_choices.is_null() )
+        {
+            json j = json::array( { compression_option_name( *server ),
+                                    "none",
+                                    std::move( compression_choices ),
+                                    "none",
+                                    "Compression of the published images; formats it does not apply to are sent raw" } );
+            stream_options.push_back( realdds::dds_option::from_json( j ) );
+        }
+
+        if( ! stream_options.empty() )
+            server->init_options( stream_options );
+
         servers.push_back( server );
     }
 
@@ -552,6 +571,7 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
 
         // Initialize with nothing: no streams, no options, empty extrinsics, etc.
         _md_enabled = false;
+        _md_in_frame = false;
         _dds_device_server->init( supported_streams, options, extrinsics );
         return;
     }
@@ -564,6 +584,10 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
     // is_enabled will return current state. If one of the conditions is false we cannot get metadata from the device.
     _md_enabled = rs2::metadata_helper::instance().can_support_metadata( _rs_dev.get_info( RS2_CAMERA_INFO_PRODUCT_LINE ) )
                && rs2::metadata_helper::instance().is_enabled( _rs_dev.get_info( RS2_CAMERA_INFO_PHYSICAL_PORT ) );
+    _md_in_frame = _dds_device_server->participant()
+                       ->settings()
+                       .nested( "device", "metadata", "in-frame" )
+                       .default_value( false );
 
     // Create a supported streams list for initializing the relevant DDS topics
     supported_streams = get_supported_streams();
@@ -631,9 +655,13 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
                         image.height = video->get_image_header().height;
                         image.width = video->get_image_header().width;
                         image.timestamp = timestamp;
+                        if( _md_in_frame )
+                            image.metadata = get_image_metadata( f );
                         video->publish_image( std::move( image ) );
+                        publish_variants( f, *video, timestamp );
 
-                        publish_frame_metadata( f, timestamp );
+                        if( ! _md_in_frame )
+                            publish_frame_metadata( f, timestamp );
                     } );
             }
             std::cout << sensor_name << " sensor started" << std::endl;
@@ -661,6 +689,7 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
 
     // Initialize the DDS device server with the supported streams
     _dds_device_server->init( supported_streams, options, extrinsics );
+    init_variants();
 
     for( auto & name_sensor : _rs_sensors )
     {
@@ -817,6 +846,157 @@ void lrs_device_controller::publish_frame_metadata( const rs2::frame & f, realdd
 }
 
 
+std::shared_ptr< realdds::topics::image_metadata > lrs_device_controller::get_image_metadata( const rs2::frame & f )
+{
+    auto md = std::make_shared< realdds::topics::image_metadata >();
+    md->frame_number = f.get_frame_number();
+    md->timestamp_domain = f.get_frame_timestamp_domain();
+    if( f.is< rs2::depth_frame >() )
+        md->depth_units = f.as< rs2::depth_frame >().get_units();
+    for( size_t i = 0; i < static_cast< size_t >( RS2_FRAME_METADATA_COUNT ); ++i )
+    {
+        rs2_frame_metadata_value val = static_cast< rs2_frame_metadata_value >( i );
+        if( f.supports_frame_metadata( val ) )
+            md->values.emplace_back( uint16_t( val ), f.get_frame_metadata( val ) );
+    }
+    return md;
+}
+
+
+void lrs_device_controller::init_variants()
+{
+    // E.g., { "Color Dashboard": { "stream": "Color", "decimation": 4, "fps-divisor": 6 } }
+    auto const & variants
+        = _dds_device_server->participant()->settings().nested( "device", "variants" ).default_object();
+    for( auto const & name_settings : variants.items() )
+    {
+        auto const & name = name_settings.key();
+        auto const & settings = name_settings.value();
+        try
+        {
+            auto it = _stream_name_to_server.find( settings.at( "stream" ).get< std::string >() );
+            auto source = it == _stream_name_to_server.end()
+                            ? nullptr
+                            : std::dynamic_pointer_cast< dds_video_stream_server >( it->second );
+            if( ! source )
+                throw std::runtime_error( "no such video stream" );
+            if( _stream_name_to_server.count( name ) )
+                throw std::runtime_error( "a stream by this name already exists" );
+
+            auto variant = std::make_shared< stream_variant >();
+            variant->decimation = std::max( settings.nested( "decimation" ).default_value( 1 ), 1 );
+            variant->fps_divisor = std::max( settings.nested( "fps-divisor" ).default_value( 1 ), 1 );
+
+            // The server is not part of the device: it has a single profile, to satisfy open(), and the header is set
+            // from the actual frames
+            auto const & source_profile = std::static_pointer_cast< dds_video_stream_profile >(
+                source->profiles().at( source->default_profile_index() ) );
+            if( ! strcmp( source->type_string(), "depth" ) )
+                variant->server = std::make_shared< dds_depth_stream_server >( name, source->sensor_name() );
+            else if( ! strcmp( source->type_string(), "ir" ) )
+                variant->server = std::make_shared< dds_ir_stream_server >( name, source->sensor_name() );
+            else if( ! strcmp( source->type_string(), "confidence" ) )
+                variant->server = std::make_shared< dds_confidence_stream_server >( name, source->sensor_name() );
+            else
+                variant->server = std::make_shared< dds_color_stream_server >( name, source->sensor_name() );
+            variant->server->init_profiles(
+                { std::make_shared< dds_video_stream_profile >( source_profile->frequency() / variant->fps_divisor,
+                                                                source_profile->encoding(),
+                                                                source_profile->width() / variant->decimation,
+                                                                source_profile->height() / variant->decimation ) },
+                0 );
+            variant->server->on_readers_changed(
+                [weak_variant = std::weak_ptr< stream_variant >( variant )]( std::shared_ptr< dds_stream_server > const &,
+                                                                            int n_readers )
+                {
+                    if( auto variant = weak_variant.lock() )
+                        variant->n_readers = n_readers;
+                } );
+
+            if( ! _variants_publisher )
+                _variants_publisher = std::make_shared< dds_publisher >( _dds_device_server->participant() );
+            variant->server->open( "rt/" + _dds_device_server->topic_root() + '_' + name, _variants_publisher );
+            _variants.emplace( source->name(), std::move( variant ) );
+            LOG_DEBUG( "stream variant '" << name << "' of '" << source->name() << "': " << settings );
+        }
+        catch( std::exception const & e )
+        {
+            LOG_ERROR( "invalid stream variant '" << name << "': " << e.what() );
+        }
+    }
+}
+
+
+void lrs_device_controller::publish_variants( const rs2::frame & f,
+                                              dds_video_stream_server const & source,
+                                              dds_time const & timestamp )
+{
+    auto range = _variants.equal_range( source.name() );
+    if( range.first == range.second )
+        return;
+
+    auto vf = f.as< rs2::video_frame >();
+    if( ! vf )
+        return;
+    int const bpp = vf.get_bytes_per_pixel();
+    int const stride = vf.get_stride_in_bytes();
+    if( bpp <= 0 || f.get_data_size() < size_t( stride ) * vf.get_height() )
+        return;  // not made of pixels (e.g., MJPEG)
+
+    // Pixels are taken whole, except that YUYV/UYVY pixel pairs share their chroma and so are taken in pairs
+    auto const format = f.get_profile().format();
+    int const unit_pixels = ( format == RS2_FORMAT_YUYV || format == RS2_FORMAT_UYVY ) ? 2 : 1;
+    int const unit_bytes = bpp * unit_pixels;
+
+    for( auto it = range.first; it != range.second; ++it )
+    {
+        auto & variant = *it->second;
+        auto & server = *variant.server;
+        if( variant.n_readers <= 0 )
+        {
+            // Nobody to produce it for
+            if( server.is_streaming() )
+                server.stop_streaming();
+            continue;
+        }
+
+        realdds::image_header header;
+        header.encoding = source.get_image_header().encoding;
+        header.width = source.get_image_header().width / variant.decimation / unit_pixels * unit_pixels;
+        header.height = source.get_image_header().height / variant.decimation;
+        if( server.is_streaming()
+            && ( server.get_image_header().width != header.width || server.get_image_header().height != header.height ) )
+            server.stop_streaming();
+        if( ! server.is_streaming() )
+        {
+            server.start_streaming( header );
+            server.set_compression( source.get_compression() );
+            variant.n_frames = 0;
+        }
+        if( variant.n_frames++ % variant.fps_divisor )
+            continue;
+
+        realdds::topics::image_msg image;
+        image.width = header.width;
+        image.height = header.height;
+        image.timestamp = timestamp;
+        size_t const row_bytes = size_t( header.width ) * bpp;
+        image.raw_data.resize( row_bytes * header.height );
+        auto const src = static_cast< uint8_t const * >( f.get_data() );
+        auto dst = image.raw_data.data();
+        for( int y = 0; y < header.height; ++y )
+        {
+            auto const src_row = src + size_t( y ) * variant.decimation * stride;
+            for( int x = 0; x < header.width; x += unit_pixels, dst += unit_bytes )
+                memcpy( dst, src_row + size_t( x ) * variant.decimation * bpp, unit_bytes );
+        }
+        if( _md_in_frame )
+            image.metadata = get_image_metadata( f );
+        server.publish_image( std::move( image ) );
+    }
+}
+
+
 std::vector< rs2::stream_profile >
 lrs_device_controller::get_rs2_profiles( realdds::dds_stream_profiles const & dds_profiles ) const
 {
@@ -862,7 +1042,13 @@ lrs_device_controller::get_rs2_profiles( realdds::dds_stream_profiles const & dd
 }
 
 
-void lrs_device_controller::set_option( const std::shared_ptr< realdds::dds_option > & option, float new_value )
+/*static*/ std::string lrs_device_controller::compression_option_name( realdds::dds_stream_server const & server )
+{
+    return server.name() + " Compression";
+}
+
+
+void lrs_device_controller::set_option( const std::shared_ptr< realdds::dds_option > & option, json const & new_value )
 {
     auto stream = option->stream();
     if( ! stream )
@@ -872,8 +1058,13 @@ void lrs_device_controller::set_option( const std::shared_ptr< realdds::dds_opti
     if( it == _stream_name_to_server.end() )
         throw std::runtime_error( "no stream '" + stream->name() + "' in device" );
     auto server = it->second;
+    if( option->get_name() == compression_option_name( *server ) )
+    {
+        std::static_pointer_cast< dds_video_stream_server >( server )->set_compression( new_value.string_ref() );
+        return;
+    }
     auto & sensor = _rs_sensors[server->sensor_name()];
-    sensor.set_option( option_name_to_id( option->get_name() ), new_value );
+    sensor.set_option( option_name_to_id( option->get_name() ), new_value.get< float >() );
 }
 
 
@@ -887,6 +1078,8 @@ json lrs_device_controller::query_option( const std::shared_ptr< realdds::dds_op
     if( it == _stream_name_to_server.end() )
         throw std::runtime_error( "no stream '" + stream->name() + "' in device" );
     auto server = it->second;
+    if( option->get_name() == compression_option_name( *server ) )
+        return std::static_pointer_cast< dds_video_stream_server >( server )->get_compression();
     auto & sensor = _rs_sensors[server->sensor_name()];
     try
     {
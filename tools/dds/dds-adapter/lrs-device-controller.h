@@ -9,6 +9,7 @@
 #include <rsutils/json-fwd.h>
 #include <map>
 #include <vector>
+#include <atomic>
 
 namespace rs2 {
     class frame;
@@ -18,7 +19,12 @@ namespace realdds {
 
 class dds_device_server;
 class dds_stream_server;
+class dds_video_stream_server;
+class dds_publisher;
 class dds_option;
+namespace topics {
+struct image_metadata;
+}
 
 } // namespace realdds
 
@@ -32,7 +38,7 @@ public:
     lrs_device_controller( rs2::device dev, std::shared_ptr< realdds::dds_device_server > dds_device_server );
     ~lrs_device_controller();
 
-    void set_option( const std::shared_ptr< realdds::dds_option > & option, float new_value );
+    void set_option( const std::shared_ptr< realdds::dds_option > & option, rsutils::json const & new_value );
     rsutils::json query_option( const std::shared_ptr< realdds::dds_option > & option );
 
     bool is_recovery() const;
@@ -40,7 +46,27 @@ public:
 private:
     std::vector< std::shared_ptr< realdds::dds_stream_server > > get_supported_streams();
 
+    // The option, on depth and color streams, that sets the server's compression
+    static std::string compression_option_name( realdds::dds_stream_server const & );
+
     void publish_frame_metadata( const rs2::frame & f, realdds::dds_time const & );
+    // The same metadata, to be sent with the image itself (device/metadata/in-frame)
+    static std::shared_ptr< realdds::topics::image_metadata > get_image_metadata( const rs2::frame & f );
+
+    // Reduced versions of video streams, for lightweight subscribers (device/variants): produced here, once for all
+    // their subscribers and only while they have any, and published on topics of their own
+    struct stream_variant
+    {
+        std::shared_ptr< realdds::dds_video_stream_server > server;
+        int decimation = 1;   // every N-th pixel in each direction
+        int fps_divisor = 1;  // every N-th frame
+        std::atomic< int > n_readers{ 0 };
+        unsigned n_frames = 0;
+    };
+    void init_variants();
+    void publish_variants( const rs2::frame & f,
+                           realdds::dds_video_stream_server const & source,
+                           realdds::dds_time const & );
 
     bool on_control( std::string const & id, rsutils::json const & control, rsutils::json & reply );
     bool on_hardware_reset( rsutils::json const &, rsutils::json & );
@@ -69,11 +95,14 @@ private:
     std::shared_ptr< dfu_support > _dfu;
 
     std::map< std::string, std::shared_ptr< realdds::dds_stream_server > > _stream_name_to_server;
+    std::multimap< std::string, std::shared_ptr< stream_variant > > _variants;  // by source stream name
+    std::shared_ptr< realdds::dds_publisher > _variants_publisher;
 
     std::vector< rs2::stream_profile > get_rs2_profiles( realdds::dds_stream_profiles const & dds_profiles ) const;
 
     std::shared_ptr< realdds::dds_device_server > _dds_device_server;
     bool _md_enabled;
+    bool _md_in_frame;  // metadata for video streams goes inside the images rather than on the metadata topic
 };  // class lrs_device_controller
 
 }  // namespace tools
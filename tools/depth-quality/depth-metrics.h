@@ -15,9 +15,21 @@
 #include <math.h>
 #include <mutex>
 #include <vector>
+#include <thread>
 #include <cmath>
 
 #include <librealsense2/rs.hpp>
+#include <librealsense2/rsutil.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 )
+#include <emmintrin.h>
+#define RS2_DEPTH_METRICS_SSE
+#define RS2_DEPTH_METRICS_SIMD
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#include <arm_neon.h>
+#define RS2_DEPTH_METRICS_NEON
+#define RS2_DEPTH_METRICS_SIMD
+#endif
 
 
 namespace rs2
@@ -67,27 +79,59 @@ namespace rs2
             return{ normal.x, normal.y, normal.z, -(normal.x*point.x + normal.y*point.y + normal.z*point.z) };
         }
 
-        //Based on: http://www.ilikebigbits.com/blog/2015/3/2/plane-from-points
-        inline plane plane_from_points(const std::vector<rs2::float3> points)
+        // Runs f(band_begin, band_end, band) over [begin, end) split into contiguous bands, one per hardware thread
+        // but none shorter than min_band, the last one on the calling thread. Returns the number of bands.
+        template< class F >
+        inline int parallel_bands(int begin, int end, F f, int min_band = 16)
         {
-            if (points.size() < 3) throw std::runtime_error("Not enough points to calculate plane");
+            int count = end - begin;
+            int bands = std::max(1, std::min(int(std::thread::hardware_concurrency()), count / std::max(1, min_band)));
 
-            rs2::float3 sum = { 0,0,0 };
-            for (auto point : points) sum = sum + point;
-
-            rs2::float3 centroid = sum / float(points.size());
+            std::vector<std::thread> threads;
+            for (int band = 0; band < bands; ++band)
+            {
+                int band_begin = begin + int(int64_t(count) * band / bands);
+                int band_end = begin + int(int64_t(count) * (band + 1) / bands);
+                if (band + 1 < bands)
+                    threads.emplace_back(f, band_begin, band_end, band);
+                else
+                    f(band_begin, band_end, band);
+            }
+            for (auto& t : threads)
+                t.join();
+            return bands;
+        }
 
+        // Sums over a set of points: their number, their coordinates, and the products of the coordinates relative to
+        // their centroid. These are all the plane fit needs, so the points do not have to be kept for it.
+        struct point_moments
+        {
+            double n = 0;
+            double x = 0, y = 0, z = 0;
             double xx = 0, xy = 0, xz = 0, yy = 0, yz = 0, zz = 0;
-            for (auto point : points) {
-                rs2::float3 temp = point - centroid;
-                xx += temp.x * temp.x;
-                xy += temp.x * temp.y;
-                xz += temp.x * temp.z;
-                yy += temp.y * temp.y;
-                yz += temp.y * temp.z;
-                zz += temp.z * temp.z;
+
+            point_moments& operator+=(const point_moments& other)
+            {
+                n += other.n;
+                x += other.x; y += other.y; z += other.z;
+                xx += other.xx; xy += other.xy; xz += other.xz;
+                yy += other.yy; yz += other.yz; zz += other.zz;
+                return *this;
             }
 
+            rs2::float3 centroid() const
+            {
+                return{ float(x / n), float(y / n), float(z / n) };
+            }
+        };
+
+        //Based on: http://www.ilikebigbits.com/blog/2015/3/2/plane-from-points
+        inline plane plane_from_moments(const point_moments& m)
+        {
+            if (m.n < 3) throw std::runtime_error("Not enough points to calculate plane");
+
+            double xx = m.xx, xy = m.xy, xz = m.xz, yy = m.yy, yz = m.yz, zz = m.zz;
+
             double det_x = yy*zz - yz*yz;
             double det_y = xx*zz - xz*xz;
             double det_z = xx*yy - xy*xy;
@@ -115,7 +159,273 @@ namespace rs2
                 dir = { a, b, 1 };
             }
 
-            return plane_from_point_and_normal(centroid, dir.normalized());
+            return plane_from_point_and_normal(m.centroid(), dir.normalized());
+        }
+
+        inline plane plane_from_points(const std::vector<rs2::float3> points)
+        {
+            if (points.size() < 3) throw std::runtime_error("Not enough points to calculate plane");
+
+            point_moments m;
+            for (auto point : points)
+            {
+                m.x += point.x;
+                m.y += point.y;
+                m.z += point.z;
+            }
+            m.n = double(points.size());
+
+            rs2::float3 centroid = m.centroid();
+            for (auto point : points) {
+                rs2::float3 temp = point - centroid;
+                m.xx += temp.x * temp.x;
+                m.xy += temp.x * temp.y;
+                m.xz += temp.x * temp.z;
+                m.yy += temp.y * temp.y;
+                m.yz += temp.y * temp.z;
+                m.zz += temp.z * temp.z;
+            }
+
+            return plane_from_moments(m);
+        }
+
+        // The moments of a depth image region are gathered row by row, straight from the depth buffer. Whatever the
+        // distortion model, a pixel's point is its depth times the point the pixel has at depth 1 -- its ray -- so the
+        // rays of a row are all that is needed besides the depth.
+        //
+        // The first pass adds up the points (and collects them, when asked to); the second, their products relative
+        // to the centroid the first pass gives. Four pixels are done at a time, in float, over runs short enough for
+        // the float sums to stay exact to well under a micron; each run is then added to the double totals.
+        namespace moments_detail
+        {
+            static const int RUN = 256;
+
+#if defined( RS2_DEPTH_METRICS_SSE )
+            using f4 = __m128;
+            inline f4 zero4() { return _mm_setzero_ps(); }
+            inline f4 splat4(float x) { return _mm_set1_ps(x); }
+            inline f4 load4(const float* p) { return _mm_loadu_ps(p); }
+            inline f4 load_depth4(const uint16_t* p)
+            {
+                auto d = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+                return _mm_cvtepi32_ps(_mm_unpacklo_epi16(d, _mm_setzero_si128()));
+            }
+            inline f4 add4(f4 a, f4 b) { return _mm_add_ps(a, b); }
+            inline f4 sub4(f4 a, f4 b) { return _mm_sub_ps(a, b); }
+            inline f4 mul4(f4 a, f4 b) { return _mm_mul_ps(a, b); }
+            // Lanes where z is zero (no depth) are cleared
+            inline f4 valid4(f4 a, f4 z) { return _mm_and_ps(a, _mm_cmpneq_ps(z, _mm_setzero_ps())); }
+            inline f4 count4(f4 z) { return _mm_and_ps(_mm_set1_ps(1.f), _mm_cmpneq_ps(z, _mm_setzero_ps())); }
+            inline double sum4(f4 a)
+            {
+                float lanes[4];
+                _mm_storeu_ps(lanes, a);
+                return double(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+            }
+#elif defined( RS2_DEPTH_METRICS_NEON )
+            using f4 = float32x4_t;
+            inline f4 zero4() { return vdupq_n_f32(0.f); }
+            inline f4 splat4(float x) { return vdupq_n_f32(x); }
+            inline f4 load4(const float* p) { return vld1q_f32(p); }
+            inline f4 load_depth4(const uint16_t* p) { return vcvtq_f32_u32(vmovl_u16(vld1_u16(p))); }
+            inline f4 add4(f4 a, f4 b) { return vaddq_f32(a, b); }
+            inline f4 sub4(f4 a, f4 b) { return vsubq_f32(a, b); }
+            inline f4 mul4(f4 a, f4 b) { return vmulq_f32(a, b); }
+            inline f4 valid4(f4 a, f4 z)
+            {
+                return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vcgtq_f32(z, vdupq_n_f32(0.f))));
+            }
+            inline f4 count4(f4 z) { return valid4(vdupq_n_f32(1.f), z); }
+            inline double sum4(f4 a)
+            {
+                float lanes[4];
+                vst1q_f32(lanes, a);
+                return double(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+            }
+#endif
+
+            inline void add_sums(const uint16_t* depth, const float* rx, const float* ry, int count, float units,
+                                 point_moments& m, std::vector<rs2::float3>* points)
+            {
+                int i = 0;
+#ifdef RS2_DEPTH_METRICS_SIMD
+                auto scale = splat4(units);
+                while (i + 4 <= count)
+                {
+                    f4 n = zero4(), x = zero4(), y = zero4(), z = zero4();
+                    int run_end = std::min(count, i + RUN);
+                    for (; i + 4 <= run_end; i += 4)
+                    {
+                        auto d = mul4(load_depth4(depth + i), scale);
+                        n = add4(n, count4(d));
+                        x = add4(x, mul4(load4(rx + i), d));
+                        y = add4(y, mul4(load4(ry + i), d));
+                        z = add4(z, d);
+                    }
+                    m.n += sum4(n); m.x += sum4(x); m.y += sum4(y); m.z += sum4(z);
+                }
+#endif
+                for (; i < count; ++i)
+                {
+                    if (!depth[i])
+                        continue;
+                    float d = depth[i] * units;
+                    m.n += 1;
+                    m.x += rx[i] * d;
+                    m.y += ry[i] * d;
+                    m.z += d;
+                }
+
+                if (points)
+                    for (int j = 0; j < count; ++j)
+                        if (depth[j])
+                        {
+                            float d = depth[j] * units;
+                            points->push_back({ d * rx[j], d * ry[j], d });
+                        }
+            }
+
+            inline void add_products(const uint16_t* depth, const float* rx, const float* ry, int count, float units,
+                                     rs2::float3 c, point_moments& m)
+            {
+                int i = 0;
+#ifdef RS2_DEPTH_METRICS_SIMD
+                auto scale = splat4(units);
+                auto cx = splat4(c.x), cy = splat4(c.y), cz = splat4(c.z);
+                while (i + 4 <= count)
+                {
+                    f4 xx = zero4(), xy = zero4(), xz = zero4(), yy = zero4(), yz = zero4(), zz = zero4();
+                    int run_end = std::min(count, i + RUN);
+                    for (; i + 4 <= run_end; i += 4)
+                    {
+                        auto d = mul4(load_depth4(depth + i), scale);
+                        auto x = valid4(sub4(mul4(load4(rx + i), d), cx), d);
+                        auto y = valid4(sub4(mul4(load4(ry + i), d), cy), d);
+                        auto z = valid4(sub4(d, cz), d);
+                        xx = add4(xx, mul4(x, x)); xy = add4(xy, mul4(x, y)); xz = add4(xz, mul4(x, z));
+                        yy = add4(yy, mul4(y, y)); yz = add4(yz, mul4(y, z)); zz = add4(zz, mul4(z, z));
+                    }
+                    m.xx += sum4(xx); m.xy += sum4(xy); m.xz += sum4(xz);
+                    m.yy += sum4(yy); m.yz += sum4(yz); m.zz += sum4(zz);
+                }
+#endif
+                for (; i < count; ++i)
+                {
+                    if (!depth[i])
+                        continue;
+                    float d = depth[i] * units;
+                    float x = rx[i] * d - c.x, y = ry[i] * d - c.y, z = d - c.z;
+                    m.xx += x * x; m.xy += x * y; m.xz += x * z;
+                    m.yy += y * y; m.yz += y * z; m.zz += z * z;
+                }
+            }
+
+            // Without distortion (or with all-zero coefficients) a pixel's ray is ((x - ppx) / fx, (y - ppy) / fy)
+            inline bool separable(const rs2_intrinsics& intrin)
+            {
+                if (intrin.model == RS2_DISTORTION_NONE)
+                    return true;
+                if (intrin.model != RS2_DISTORTION_BROWN_CONRADY && intrin.model != RS2_DISTORTION_INVERSE_BROWN_CONRADY)
+                    return false;
+                return std::all_of(std::begin(intrin.coeffs), std::end(intrin.coeffs), [](float c) { return c == 0.f; });
+            }
+
+            // The rays of pixels [min_x, max_x) of row y
+            class row_rays
+            {
+            public:
+                row_rays(const rs2_intrinsics& intrin, int min_x, int max_x)
+                    : _intrin(intrin), _min_x(min_x), _separable(separable(intrin)),
+                      _x(max_x - min_x), _y(max_x - min_x), _pixels(_separable ? 0 : 2 * (max_x - min_x)),
+                      _ones(_separable ? 0 : max_x - min_x, 1.f), _points(_separable ? 0 : 3 * (max_x - min_x))
+                {
+                    if (_separable)
+                        for (int i = 0; i < int(_x.size()); ++i)
+                            _x[i] = (float(min_x + i) - intrin.ppx) / intrin.fx;
+                }
+
+                void set_row(int y)
+                {
+                    int count = int(_x.size());
+                    if (_separable)
+                    {
+                        std::fill(_y.begin(), _y.end(), (float(y) - _intrin.ppy) / _intrin.fy);
+                        return;
+                    }
+                    for (int i = 0; i < count; ++i)
+                    {
+                        _pixels[2 * i] = float(_min_x + i);
+                        _pixels[2 * i + 1] = float(y);
+                    }
+                    rs2_deproject_pixels_to_points(_points.data(), &_intrin, _pixels.data(), _ones.data(), count);
+                    for (int i = 0; i < count; ++i)
+                    {
+                        _x[i] = _points[3 * i];
+                        _y[i] = _points[3 * i + 1];
+                    }
+                }
+
+                const float* x() const { return _x.data(); }
+                const float* y() const { return _y.data(); }
+
+            private:
+                rs2_intrinsics _intrin;
+                int _min_x;
+                bool _separable;
+                std::vector<float> _x, _y, _pixels, _ones, _points;
+            };
+        }
+
+        // The moments of the points of the region's valid depth pixels, collecting the points in row order when asked
+        // to. Rows are split among threads.
+        inline point_moments depth_moments(const uint16_t* pixels, int w, float units, const rs2_intrinsics* intrin,
+                                           rs2::region_of_interest roi, std::vector<rs2::float3>* points = nullptr)
+        {
+            using namespace moments_detail;
+
+            int count = roi.max_x - roi.min_x;
+            if (count <= 0 || roi.max_y <= roi.min_y)
+                return{};
+
+            int bands = std::max(1, int(std::thread::hardware_concurrency()));
+            std::vector<point_moments> sums(bands), products(bands);
+            std::vector<std::vector<rs2::float3>> band_points(points ? bands : 0);
+
+            bands = parallel_bands(roi.min_y, roi.max_y, [&](int begin, int end, int band)
+            {
+                row_rays rays(*intrin, roi.min_x, roi.max_x);
+                if (points)
+                    band_points[band].reserve(size_t(end - begin) * count);
+                for (int y = begin; y < end; ++y)
+                {
+                    rays.set_row(y);
+                    add_sums(pixels + y * w + roi.min_x, rays.x(), rays.y(), count, units, sums[band],
+                             points ? &band_points[band] : nullptr);
+                }
+            });
+
+            point_moments m;
+            for (int band = 0; band < bands; ++band)
+                m += sums[band];
+            if (points)
+                for (int band = 0; band < bands; ++band)
+                    points->insert(points->end(), band_points[band].begin(), band_points[band].end());
+            if (m.n < 3)
+                return m;
+
+            auto centroid = m.centroid();
+            parallel_bands(roi.min_y, roi.max_y, [&](int begin, int end, int band)
+            {
+                row_rays rays(*intrin, roi.min_x, roi.max_x);
+                for (int y = begin; y < end; ++y)
+                {
+                    rays.set_row(y);
+                    add_products(pixels + y * w + roi.min_x, rays.x(), rays.y(), count, units, centroid, products[band]);
+                }
+            });
+            for (int band = 0; band < bands; ++band)
+                m += products[band];
+            return m;
         }
 
         inline double evaluate_pixel(const plane& p, const rs2_intrinsics* intrin, float x, float y, float distance, float3& output)
@@ -161,35 +471,14 @@ namespace rs2
 
             snapshot_metrics result{ w, h, roi, {} };
 
-            std::mutex m;
-
             std::vector<rs2::float3> roi_pixels;
+            auto moments = depth_moments(pixels, w, units, intrin, roi, &roi_pixels);
 
-//#pragma omp parallel for - TODO optimization envisaged
-            for (int y = roi.min_y; y < roi.max_y; ++y)
-                for (int x = roi.min_x; x < roi.max_x; ++x)
-                {
-                    auto depth_raw = pixels[y*w + x];
-
-                    if (depth_raw)
-                    {
-                        // units is float
-                        float pixel[2] = { float(x), float(y) };
-                        float point[3];
-                        auto distance = depth_raw * units;
-
-                        rs2_deproject_pixel_to_point(point, intrin, pixel, distance);
-
-                        std::lock_guard<std::mutex> lock(m);
-                        roi_pixels.push_back({ point[0], point[1], point[2] });
-                    }
-                }
-
-            if (roi_pixels.size() < 3) { // Not enough pixels in RoI to fit a plane
+            if (moments.n < 3) { // Not enough pixels in RoI to fit a plane
                 return result;
             }
 
-            plane p = plane_from_points(roi_pixels);
+            plane p = plane_from_moments(moments);
 
             if (p == plane{ 0, 0, 0, 0 }) { // The points in RoI don't span a valid plane
                 return result;
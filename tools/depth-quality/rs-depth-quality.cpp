@@ -93,45 +93,55 @@ int main(int argc, const char * argv[]) try
         const float bf_factor = baseline_mm * focal_length_pixels * TO_METERS; // also convert point units from mm to meter
 
         std::vector<rs2::float3> points_set = points;
-        std::vector<float> distances;
-        std::vector<float> disparities;
-        std::vector<float> gt_errors;
 
-        // Reserve memory for the data
-        distances.reserve(points.size());
-        disparities.reserve(points.size());
-        if (ground_truth_mm) gt_errors.reserve(points.size());
-
-        // Remove outliers [below 0.5% and above 99.5%)
-        std::sort(points_set.begin(), points_set.end(), [](const rs2::float3& a, const rs2::float3& b) { return a.z < b.z; });
+        // Remove outliers [below 0.5% and above 99.5%): only which points are kept matters, not their order
         size_t outliers = points_set.size() / 200;
+        auto by_z = [](const rs2::float3& a, const rs2::float3& b) { return a.z < b.z; };
+        if (outliers)
+        {
+            std::nth_element(points_set.begin(), points_set.begin() + outliers, points_set.end(), by_z);
+            std::nth_element(points_set.begin() + outliers, points_set.end() - outliers, points_set.end(), by_z);
+        }
         points_set.erase(points_set.begin(), points_set.begin() + outliers); // crop min 0.5% of the dataset
         points_set.resize(points_set.size() - outliers); // crop max 0.5% of the dataset
 
+        std::vector<float> gt_errors(ground_truth_mm ? points_set.size() : 0);
+        std::vector<double> band_sq_distances(std::max(1u, std::thread::hardware_concurrency()), 0.);
+        std::vector<double> band_sq_disparities(band_sq_distances.size(), 0.);
+
         // Convert Z values into Depth values by aligning the Fitted plane with the Ground Truth (GT) plane
         // Calculate distance and disparity of Z values to the fitted plane.
         // Use the rotated plane fit to calculate GT errors
-        for (auto point : points_set)
+        parallel_bands(0, int(points_set.size()), [&](int begin, int end, int band)
         {
-            // Find distance from point to the reconstructed plane
-            auto dist2plane = p.a*point.x + p.b*point.y + p.c*point.z + p.d;
-            // Project the point to plane in 3D and find distance to the intersection point
-            rs2::float3 plane_intersect = { float(point.x - dist2plane*p.a),
-                                            float(point.y - dist2plane*p.b),
-                                            float(point.z - dist2plane*p.c) };
-
-            // Store distance, disparity and gt- error
-            distances.push_back(dist2plane * TO_MM);
-            disparities.push_back(bf_factor / point.length() - bf_factor / plane_intersect.length());
-            // The negative dist2plane represents a point closer to the camera than the fitted plane
-            if (ground_truth_mm) gt_errors.push_back(plane_fit_to_ground_truth_mm + (dist2plane * TO_MM));
-        }
+            double sq_distances = 0, sq_disparities = 0;
+            for (int i = begin; i < end; ++i)
+            {
+                auto& point = points_set[i];
+                // Find distance from point to the reconstructed plane
+                auto dist2plane = p.a*point.x + p.b*point.y + p.c*point.z + p.d;
+                // Project the point to plane in 3D and find distance to the intersection point
+                rs2::float3 plane_intersect = { float(point.x - dist2plane*p.a),
+                                                float(point.y - dist2plane*p.b),
+                                                float(point.z - dist2plane*p.c) };
+
+                // Accumulate distance and disparity, and store gt- error
+                float distance = dist2plane * TO_MM;
+                float disparity = bf_factor / point.length() - bf_factor / plane_intersect.length();
+                sq_distances += distance * distance;
+                sq_disparities += disparity * disparity;
+                // The negative dist2plane represents a point closer to the camera than the fitted plane
+                if (ground_truth_mm) gt_errors[i] = plane_fit_to_ground_truth_mm + (dist2plane * TO_MM);
+            }
+            band_sq_distances[band] = sq_distances;
+            band_sq_disparities[band] = sq_disparities;
+        }, 4096);
 
         // Show Z accuracy metric only when Ground Truth is available
         z_accuracy->enable(ground_truth_mm > 0);
         if (ground_truth_mm)
         {
-            std::sort(begin(gt_errors), end(gt_errors));
+            std::nth_element(begin(gt_errors), begin(gt_errors) + gt_errors.size() / 2, end(gt_errors));
             auto gt_median = gt_errors[gt_errors.size() / 2];
             auto accuracy = TO_PERCENT * (gt_median / ground_truth_mm);
             z_accuracy->add_value(accuracy);
@@ -139,18 +149,14 @@ int main(int argc, const char * argv[]) try
         }
 
         // Calculate Sub-pixel RMS for Stereo-based Depth sensors
-        double total_sq_disparity_diff = 0;
-        for (auto disparity : disparities)
-        {
-            total_sq_disparity_diff += disparity*disparity;
-        }
-        auto rms_subpixel_val = static_cast<float>(std::sqrt(total_sq_disparity_diff / disparities.size()));
+        double total_sq_disparity_diff = std::accumulate(band_sq_disparities.begin(), band_sq_disparities.end(), 0.);
+        auto rms_subpixel_val = static_cast<float>(std::sqrt(total_sq_disparity_diff / points_set.size()));
         sub_pixel_rms_error->add_value(rms_subpixel_val);
         if (record) samples.push_back({ sub_pixel_rms_error->get_name(),  rms_subpixel_val });
 
         // Calculate Plane Fit RMS  (Spatial Noise) mm
-        double plane_fit_err_sqr_sum = std::inner_product(distances.begin(), distances.end(), distances.begin(), 0.);
-        auto rms_error_val = static_cast<float>(std::sqrt(plane_fit_err_sqr_sum / distances.size()));
+        double plane_fit_err_sqr_sum = std::accumulate(band_sq_distances.begin(), band_sq_distances.end(), 0.);
+        auto rms_error_val = static_cast<float>(std::sqrt(plane_fit_err_sqr_sum / points_set.size()));
         auto rms_error_val_per = TO_PERCENT * (rms_error_val / distance_mm);
         plane_fit_rms_error->add_value(rms_error_val_per);
         if (record)
@@ -14,7 +14,7 @@
 #include <stb_image.h>
 
 
-#define RS_EMBED_VERSION "0.0.0.2"
+#define RS_EMBED_VERSION "0.0.0.3"
 
 struct float3
 {
@@ -74,10 +74,12 @@ int main(int argc, char** argv) try
     ValueArg<string> inputFilename("i", "input", "Input filename", true, "", "input-file");
     ValueArg<string> outputFilename("o", "output", "Output filename", false, "", "output-file");
     ValueArg<string> objectName("n", "name", "Name", false, "", "object-name");
+    SwitchArg compress("c", "compress", "Embed any (non-obj) file LZ4-compressed, decompressed on first use", false);
 
     cmd.add(inputFilename);
     cmd.add(outputFilename);
     cmd.add(objectName);
+    cmd.add(compress);
     cmd.parse(argc, argv);
 
     auto input = inputFilename.getValue();
@@ -200,8 +202,66 @@ int main(int argc, char** argv) try
 
         myfile.close();
     }
+    else if (compress.getValue())
+    {
+        auto ext = input.substr(input.find_last_of('.') + 1);
+        auto symbol = name + "_" + ext;
+
+        ifstream ifs(input, ios::binary | ios::ate);
+        if (!ifs)
+        {
+            std::cout << "file: " << input << " could not be found!" << std::endl;
+            return EXIT_FAILURE;
+        }
+        ifstream::pos_type pos = ifs.tellg();
+        std::vector<char> buffer(pos);
+        ifs.seekg(0, ios::beg);
+        ifs.read(buffer.data(), pos);
+
+        auto rawDataSize = (int)buffer.size();
+        auto compressBufSize = LZ4_compressBound(rawDataSize);
+        std::vector<char> compressed(compressBufSize + 4, 0);  // room to round up to whole words
+        int nCompressedSize = LZ4_compress_default(buffer.data(), compressed.data(), rawDataSize, compressBufSize);
+        if (nCompressedSize <= 0)
+            throw std::runtime_error("LZ4 compression of " + input + " failed");
+
+        ofstream myfile;
+        myfile.open(output);
+        myfile << "// License: Apache 2.0. See LICENSE file in root directory.\n";
+        myfile << "// Copyright(c) " << get_current_year() << " Intel Corporation. All Rights Reserved.\n\n";
+        myfile << "// This file is auto-generated from " << name << "." << ext << " using rs-embed tool version: " << RS_EMBED_VERSION << "\n";
+        myfile << "// Generation time: " << get_current_time() << ".\n\n";
+        myfile << "#pragma once\n";
+        myfile << "#include <lz4.h>\n";
+        myfile << "#include <stdint.h>\n";
+        myfile << "#include <vector>\n\n";
+
+        myfile << "static const uint32_t " << symbol << "_compressed_data [] { ";
+        for (int i = 0; i < nCompressedSize; i += 4)
+        {
+            uint32_t word;
+            memcpy(&word, compressed.data() + i, 4);
+            myfile << "0x" << std::hex << word;
+            if (i + 4 < nCompressedSize) myfile << ",";
+        }
+        myfile << "};\n\n";
 
-    if (ends_with(input, ".png"))
+        // A function-local static: decompressed once, by whoever asks first, and safe to ask from any thread
+        myfile << "// The " << name << "." << ext << " bytes, decompressed on first use\n";
+        myfile << "inline const std::vector<uint8_t>& get_" << symbol << "_data()\n";
+        myfile << "{\n";
+        myfile << "    static const std::vector<uint8_t> data = []() {\n";
+        myfile << "        std::vector<uint8_t> uncompressed(0x" << std::hex << rawDataSize << ");\n";
+        myfile << "        (void)LZ4_decompress_safe((const char*)" << symbol << "_compressed_data, (char*)uncompressed.data(), 0x"
+               << std::hex << nCompressedSize << ", 0x" << std::hex << rawDataSize << ");\n";
+        myfile << "        return uncompressed;\n";
+        myfile << "    }();\n";
+        myfile << "    return data;\n";
+        myfile << "}\n";
+
+        myfile.close();
+    }
+    else if (ends_with(input, ".png"))
     {
         ifstream ifs(input, ios::binary | ios::ate);
         ifstream::pos_type pos = ifs.tellg();
@@ -6,6 +6,8 @@
 #include <rsutils/json.h>
 #include <vector>
 #include <map>
+#include <algorithm>
+#include <set>
 #include <string>
 #include <cstring>
 #include <iostream>
@@ -224,6 +226,147 @@ bool is_mipi_device( const rs2::device & dev )
     return d457_device && usb_type.compare( "unknown" ) == 0;
 }
 
+// Update all the (updatable, USB) devices to the same image at once: each is put in update state, then all the
+// resulting DFU devices are flashed in parallel, one thread each, while their progress is shown on one line
+int update_all_devices( rs2::context & ctx, rs2::device_list const & devs, std::vector< uint8_t > const & fw_image )
+{
+    std::condition_variable cv;
+    std::mutex mutex;
+    std::map< std::string, rs2::update_device > dfu_devices;  // by update serial number
+    std::set< std::string > reconnected;
+
+    ctx.set_devices_changed_callback( [&]( rs2::event_information & info ) {
+        std::lock_guard< std::mutex > lk( mutex );
+        for( auto && d : info.get_new_devices() )
+        {
+            if( ! d.supports( RS2_CAMERA_INFO_FIRMWARE_UPDATE_ID ) )
+                continue;
+            std::string sn = d.get_info( RS2_CAMERA_INFO_FIRMWARE_UPDATE_ID );
+            if( d.is< rs2::update_device >() )
+                dfu_devices[sn] = d;
+            else
+                reconnected.insert( sn );
+        }
+        cv.notify_all();
+    } );
+
+    std::vector< std::string > pending;
+    for( auto && d : devs )
+    {
+        if( ! d.is< rs2::updatable >() || ! d.supports( RS2_CAMERA_INFO_FIRMWARE_UPDATE_ID ) )
+            continue;
+        std::string sn = d.get_info( RS2_CAMERA_INFO_FIRMWARE_UPDATE_ID );
+        if( is_mipi_device( d ) )
+        {
+            std::cout << std::endl << "Skipping MIPI device " << sn << "; update it on its own" << std::endl;
+            continue;
+        }
+        auto upd = d.as< rs2::updatable >();
+        if( ! upd.check_firmware_compatibility( fw_image ) )
+        {
+            std::cout << std::endl << "Skipping " << sn << ": firmware is not compatible with "
+                      << d.get_info( RS2_CAMERA_INFO_NAME ) << std::endl;
+            continue;
+        }
+        print_device_info( d );
+        upd.enter_update_state();
+        // Some devices may immediately get in an update state?
+        if( d.is< rs2::update_device >() )
+        {
+            std::lock_guard< std::mutex > lk( mutex );
+            dfu_devices[sn] = d;
+        }
+        pending.push_back( sn );
+    }
+    if( pending.empty() )
+    {
+        std::cout << std::endl << "No devices to update" << std::endl << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::map< std::string, float > progress;
+    std::map< std::string, std::string > errors;
+    std::vector< std::thread > threads;
+    {
+        std::unique_lock< std::mutex > lk( mutex );
+        cv.wait_for( lk, std::chrono::seconds( WAIT_FOR_DEVICE_TIMEOUT ), [&] {
+            return std::all_of( pending.begin(), pending.end(), [&]( std::string const & sn ) {
+                return dfu_devices.count( sn ) > 0;
+            } );
+        } );
+        for( auto & sn : pending )
+        {
+            auto it = dfu_devices.find( sn );
+            if( it == dfu_devices.end() )
+            {
+                errors[sn] = "failed to locate device in FW update mode";
+                continue;
+            }
+            progress[sn] = 0;
+            threads.emplace_back( [&, sn]( rs2::update_device dfu ) {
+                std::string error;
+                try
+                {
+                    dfu.update( fw_image, [&]( const float p ) {
+                        std::lock_guard< std::mutex > lk( mutex );
+                        progress[sn] = p;
+                    } );
+                }
+                catch( std::exception const & e )
+                {
+                    error = e.what();
+                }
+                std::lock_guard< std::mutex > lk( mutex );
+                progress.erase( sn );
+                if( ! error.empty() )
+                    errors[sn] = error;
+                cv.notify_all();
+            }, it->second );
+        }
+    }
+
+    std::cout << std::endl << "Firmware update of " << threads.size() << " devices started. Please don't disconnect them!"
+              << std::endl << std::endl;
+    {
+        bool const tty = ISATTY( FILENO( stdout ) );
+        std::unique_lock< std::mutex > lk( mutex );
+        while( ! cv.wait_for( lk, std::chrono::milliseconds( 500 ), [&] { return progress.empty(); } ) )
+        {
+            if( ! tty )
+                continue;
+            std::cout << "\r";
+            for( auto & sn_progress : progress )
+                std::cout << sn_progress.first << ": " << int( sn_progress.second * 100 ) << "%  ";
+            std::cout << std::flush;
+        }
+    }
+    for( auto & t : threads )
+        t.join();
+
+    std::cout << std::endl << std::endl << "Waiting for devices to reconnect..." << std::endl;
+    {
+        std::unique_lock< std::mutex > lk( mutex );
+        cv.wait_for( lk, std::chrono::seconds( WAIT_FOR_DEVICE_TIMEOUT ), [&] {
+            return std::all_of( pending.begin(), pending.end(), [&]( std::string const & sn ) {
+                return errors.count( sn ) || reconnected.count( sn );
+            } );
+        } );
+    }
+    ctx.set_devices_changed_callback( []( rs2::event_information & ) {} );
+
+    for( auto & sn : pending )
+    {
+        auto it = errors.find( sn );
+        if( it != errors.end() )
+            std::cout << "Device " << sn << " failed: " << it->second << std::endl;
+        else if( ! reconnected.count( sn ) )
+            std::cout << "Device " << sn << " was updated but did not reconnect" << std::endl;
+        else
+            std::cout << "Device " << sn << " successfully updated" << std::endl;
+    }
+    return errors.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 int main( int argc, char ** argv )
 try
 {
@@ -245,6 +388,7 @@ try
     ValueArg<std::string> backup_arg("b", "backup", "Create a backup to the camera flash and saved it to the given path", false, "", "string");
     ValueArg<std::string> file_arg("f", "file", "Path of the firmware image file", false, "", "string");
     ValueArg<std::string> serial_number_arg("s", "serial_number", "The serial number of the device to be update, this is mandetory if more than one device is connected", false, "", "string");
+    SwitchArg all_arg( "a", "all", "Update all connected devices, in parallel, with the same firmware image" );
     SwitchArg only_sw_arg( "", "sw-only", "Show only software devices (playback, DDS, etc. -- but not USB/HID/etc.)" );
 
     cmd.add(debug_arg);
@@ -254,6 +398,7 @@ try
     cmd.add(file_arg);
     cmd.add(serial_number_arg);
     cmd.add(backup_arg);
+    cmd.add(all_arg);
     cmd.add(only_sw_arg);
 #ifdef BUILD_WITH_DDS
     ValueArg< int > domain_arg( "", "dds-domain", "Set the DDS domain ID (default to 0)", false, 0, "0-232" );
@@ -281,7 +426,7 @@ try
     rs2::context ctx( settings.dump() );
 
     if (!list_devices_arg.isSet() && !recover_arg.isSet() && !unsigned_arg.isSet() &&
-        !backup_arg.isSet() && !file_arg.isSet() && !serial_number_arg.isSet())
+        !backup_arg.isSet() && !file_arg.isSet() && !serial_number_arg.isSet() && !all_arg.isSet())
     {
         std::cout << std::endl << "Nothing to do, run again with -h for help" << std::endl;
         list_devices( ctx, only_sw_arg.isSet() );
@@ -383,6 +528,18 @@ try
         }
     }
 
+    if( all_arg.isSet() )
+    {
+        if( serial_number_arg.isSet() || backup_arg.isSet() || unsigned_arg.isSet() )
+        {
+            std::cout << std::endl << "--all cannot be combined with a serial number, backup or unsigned update" << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::vector< uint8_t > fw_image = read_firmware_data( file_arg.isSet(), file_arg.getValue() );
+        std::cout << std::endl << "Update to FW: " << file_arg.getValue() << std::endl;
+        return update_all_devices( ctx, query_devices( ctx, only_sw_arg.getValue() ), fw_image );
+    }
+
     // Update device
     ctx.set_devices_changed_callback([&](rs2::event_information& info)
     {
@@ -0,0 +1,581 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include "tclap/CmdLine.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace TCLAP;
+
+
+namespace {
+
+
+// The frames that the benchmarks of one resolution run on, whether synthetic or from a bag
+struct input
+{
+    std::vector< rs2::frame > depth;
+    std::vector< rs2::frame > disparity;  // the depth, transformed, for disparity-to-depth
+    std::vector< rs2::frame > rgb;
+    std::vector< rs2::frame > yuyv;
+    std::vector< rs2::frame > y411;
+    std::vector< rs2::frame > depth_color;  // framesets
+};
+
+typedef std::pair< int, int > resolution;  // width, height
+typedef std::map< resolution, input > inputs;
+
+
+resolution get_resolution( rs2::frame const & f )
+{
+    auto vf = f.as< rs2::video_frame >();
+    return { vf.get_width(), vf.get_height() };
+}
+
+
+// Depth and color frames made up in a software device: the same pixels on every run, for every resolution
+class synthetic_source
+{
+    rs2::software_device _dev;
+    rs2::software_sensor _depth_sensor;
+    std::vector< rs2::software_sensor > _color_sensors;
+    rs2::stream_profile _depth_profile;
+    std::vector< rs2::stream_profile > _color_profiles;
+    std::vector< rs2::frame_queue > _queues;
+    int _width, _height;
+
+    static rs2_intrinsics intrinsics( int w, int h )
+    {
+        return { w, h, w / 2.f, h / 2.f, float( w ), float( w ), RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+    }
+
+    static void free_pixels( void * p ) { delete[] static_cast< uint8_t * >( p ); }
+
+    rs2::frame push( rs2::software_sensor & sensor, rs2::stream_profile const & profile, rs2::frame_queue & q,
+                     uint8_t * pixels, int stride, int bpp, int i )
+    {
+        sensor.on_video_frame( { pixels, free_pixels, stride, bpp, 1000. / 30 * i, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK,
+                                 i, profile.get(), 0.001f } );
+        auto f = q.wait_for_frame();
+        f.keep();
+        return f;
+    }
+
+public:
+    synthetic_source( int w, int h, size_t n_frames )
+        : _depth_sensor( _dev.add_sensor( "Depth" ) )
+        , _width( w )
+        , _height( h )
+    {
+        // Both needed for the depth frames to be usable by disparity_transform
+        _depth_sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+        _depth_sensor.add_read_only_option( RS2_OPTION_STEREO_BASELINE, 50.f );
+        _depth_profile = _depth_sensor.add_video_stream(
+            { RS2_STREAM_DEPTH, 0, 0, w, h, 30, 2, RS2_FORMAT_Z16, intrinsics( w, h ) } );
+
+        struct color_format { char const * name; rs2_format format; int bpp; };
+        color_format const formats[] = { { "RGB8", RS2_FORMAT_RGB8, 3 },
+                                         { "YUYV", RS2_FORMAT_YUYV, 2 },
+                                         { "Y411", RS2_FORMAT_Y411, 2 } };  // bpp is unused: we give the stride
+        int uid = 1;
+        for( auto const & cf : formats )
+        {
+            _color_sensors.push_back( _dev.add_sensor( cf.name ) );
+            _color_profiles.push_back( _color_sensors.back().add_video_stream(
+                { RS2_STREAM_COLOR, 0, uid++, w, h, 30, cf.bpp, cf.format, intrinsics( w, h ) } ) );
+            _depth_profile.register_extrinsics_to( _color_profiles.back(),
+                                                   { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0.015f, 0, 0 } } );
+        }
+
+        _queues.emplace_back( unsigned( n_frames + 1 ) );
+        _depth_sensor.open( _depth_profile );
+        _depth_sensor.start( _queues.back() );
+        for( size_t s = 0; s < _color_sensors.size(); ++s )
+        {
+            _queues.emplace_back( unsigned( n_frames + 1 ) );
+            _color_sensors[s].open( _color_profiles[s] );
+            _color_sensors[s].start( _queues.back() );
+        }
+    }
+
+    ~synthetic_source()
+    {
+        _depth_sensor.stop();
+        _depth_sensor.close();
+        for( auto & s : _color_sensors )
+        {
+            s.stop();
+            s.close();
+        }
+    }
+
+    void generate( size_t n_frames, input & in )
+    {
+        int const w = _width, h = _height;
+        for( int i = 0; i < int( n_frames ); ++i )
+        {
+            // A slanted plane with some ripples and holes, moving a little from one frame to the next
+            auto depth = new uint8_t[w * h * 2];
+            auto z = reinterpret_cast< uint16_t * >( depth );
+            for( int y = 0; y < h; ++y )
+                for( int x = 0; x < w; ++x )
+                {
+                    int const v = 800 + y + ( ( x * 7 + y * 3 + i * 5 ) % 64 );
+                    *z++ = ( ( x + y * 31 + i ) % 23 ) ? uint16_t( v ) : 0;
+                }
+            in.depth.push_back( push( _depth_sensor, _depth_profile, _queues[0], depth, w * 2, 2, i ) );
+
+            auto rgb = new uint8_t[w * h * 3];
+            for( int p = 0; p < w * h; ++p )
+            {
+                rgb[p * 3 + 0] = uint8_t( p + i );
+                rgb[p * 3 + 1] = uint8_t( p / w );
+                rgb[p * 3 + 2] = uint8_t( p * 3 );
+            }
+            in.rgb.push_back( push( _color_sensors[0], _color_profiles[0], _queues[1], rgb, w * 3, 3, i ) );
+
+            auto yuyv = new uint8_t[w * h * 2];
+            for( int b = 0; b < w * h * 2; ++b )
+                yuyv[b] = uint8_t( b * 5 + i );
+            in.yuyv.push_back( push( _color_sensors[1], _color_profiles[1], _queues[2], yuyv, w * 2, 2, i ) );
+
+            // 12 bits per pixel
+            auto y411 = new uint8_t[w * h * 3 / 2];
+            for( int b = 0; b < w * h * 3 / 2; ++b )
+                y411[b] = uint8_t( b * 3 + i );
+            in.y411.push_back( push( _color_sensors[2], _color_profiles[2], _queues[3], y411, w * 3 / 2, 2, i ) );
+        }
+    }
+};
+
+
+// Framesets of depth and RGB color, made directly rather than by a syncer, so there's one for every pair
+void compose_depth_color( input & in )
+{
+    rs2::frame color;
+    rs2::filter compose( [&color]( rs2::frame f, rs2::frame_source & source ) {
+        source.frame_ready( source.allocate_composite_frame( { f, color } ) );
+    } );
+    for( size_t i = 0; i < in.depth.size() && i < in.rgb.size(); ++i )
+    {
+        color = in.rgb[i];
+        auto fs = compose.process( in.depth[i] ).as< rs2::frameset >();
+        fs.keep();
+        in.depth_color.push_back( fs );
+    }
+}
+
+
+void make_disparity( input & in )
+{
+    rs2::disparity_transform to_disparity( true );
+    for( auto & f : in.depth )
+    {
+        try
+        {
+            auto d = to_disparity.process( f );
+            d.keep();
+            in.disparity.push_back( d );
+        }
+        catch( std::exception const & e )
+        {
+            std::cerr << "cannot make disparity frames: " << e.what() << std::endl;
+            return;
+        }
+    }
+}
+
+
+// The frames' sensors have to stay around, as some blocks look them up (e.g., for the stereo baseline)
+typedef std::vector< std::shared_ptr< void > > keep_alive;
+
+
+void add_synthetic( inputs & all, std::vector< resolution > const & resolutions, size_t n_frames,
+                    keep_alive & sources )
+{
+    for( auto & res : resolutions )
+    {
+        auto & in = all[res];
+        auto source = std::make_shared< synthetic_source >( res.first, res.second, n_frames );
+        source->generate( n_frames, in );
+        compose_depth_color( in );
+        sources.push_back( source );
+    }
+}
+
+
+void add_bag( inputs & all, std::string const & filename, size_t n_frames, keep_alive & sources )
+{
+    rs2::config cfg;
+    cfg.enable_device_from_file( filename, false );  // no repeat
+    auto pipe = std::make_shared< rs2::pipeline >();
+    auto profile = pipe->start( cfg );
+    profile.get_device().as< rs2::playback >().set_real_time( false );  // every frame, as fast as we can use them
+
+    rs2::frameset fs;
+    while( pipe->try_wait_for_frames( &fs, 1000 ) )
+    {
+        fs.keep();
+        rs2::frame depth, rgb;
+        for( auto f : fs )
+        {
+            if( ! f.is< rs2::video_frame >() )
+                continue;
+            auto & in = all[get_resolution( f )];
+            switch( f.get_profile().format() )
+            {
+            case RS2_FORMAT_Z16:
+                if( in.depth.size() < n_frames )
+                    in.depth.push_back( f );
+                depth = f;
+                break;
+            case RS2_FORMAT_RGB8:
+                if( in.rgb.size() < n_frames )
+                    in.rgb.push_back( f );
+                rgb = f;
+                break;
+            case RS2_FORMAT_YUYV:
+                if( in.yuyv.size() < n_frames )
+                    in.yuyv.push_back( f );
+                break;
+            case RS2_FORMAT_Y411:
+                if( in.y411.size() < n_frames )
+                    in.y411.push_back( f );
+                break;
+            default:
+                break;
+            }
+        }
+        // Framesets go with the depth resolution
+        if( depth && rgb )
+        {
+            auto & in = all[get_resolution( depth )];
+            if( in.depth_color.size() < n_frames )
+                in.depth_color.push_back( fs );
+        }
+    }
+    sources.push_back( pipe );  // not stopped: that would release the device
+}
+
+
+struct result
+{
+    std::string name;
+    resolution res;
+    size_t iterations;
+    double mean_ns, p50_ns, p99_ns, max_ns;
+};
+
+
+// One benchmark: what it is fed, and how to process each frame
+struct benchmark
+{
+    std::string name;
+    std::function< std::vector< rs2::frame > const &( input const & ) > frames;
+    std::function< std::function< rs2::frame( rs2::frame ) >() > make;  // a fresh block for every resolution
+};
+
+
+template< class T >
+std::function< std::function< rs2::frame( rs2::frame ) >() > block()
+{
+    return []() {
+        auto b = std::make_shared< T >();
+        return [b]( rs2::frame f ) { return b->process( f ); };
+    };
+}
+
+
+std::vector< benchmark > get_benchmarks()
+{
+    typedef std::vector< rs2::frame > const & frames;
+    auto depth = []( input const & in ) -> frames { return in.depth; };
+    auto disparity = []( input const & in ) -> frames { return in.disparity; };
+    auto yuyv = []( input const & in ) -> frames { return in.yuyv; };
+    auto y411 = []( input const & in ) -> frames { return in.y411; };
+    auto depth_color = []( input const & in ) -> frames { return in.depth_color; };
+
+    std::vector< benchmark > benchmarks;
+    benchmarks.push_back( { "colorizer", depth, block< rs2::colorizer >() } );
+    benchmarks.push_back( { "pointcloud", depth, []() {
+                               auto pc = std::make_shared< rs2::pointcloud >();
+                               return [pc]( rs2::frame f ) -> rs2::frame { return pc->calculate( f ); };
+                           } } );
+    benchmarks.push_back( { "decimation_filter", depth, block< rs2::decimation_filter >() } );
+    benchmarks.push_back( { "threshold_filter", depth, block< rs2::threshold_filter >() } );
+    benchmarks.push_back( { "disparity_transform(to)", depth, block< rs2::disparity_transform >() } );
+    benchmarks.push_back( { "disparity_transform(from)", disparity, []() {
+                               auto b = std::make_shared< rs2::disparity_transform >( false );
+                               return [b]( rs2::frame f ) { return b->process( f ); };
+                           } } );
+    benchmarks.push_back( { "spatial_filter", depth, block< rs2::spatial_filter >() } );
+    benchmarks.push_back( { "temporal_filter", depth, block< rs2::temporal_filter >() } );
+    benchmarks.push_back( { "hole_filling_filter", depth, block< rs2::hole_filling_filter >() } );
+    benchmarks.push_back( { "depth_postprocess", depth, block< rs2::depth_postprocess >() } );
+    benchmarks.push_back( { "units_transform", depth, block< rs2::units_transform >() } );
+    benchmarks.push_back( { "align(to color)", depth_color, []() {
+                               auto b = std::make_shared< rs2::align >( RS2_STREAM_COLOR );
+                               return [b]( rs2::frame f ) { return b->rs2::filter::process( f ); };
+                           } } );
+    benchmarks.push_back( { "align(to depth)", depth_color, []() {
+                               auto b = std::make_shared< rs2::align >( RS2_STREAM_DEPTH );
+                               return [b]( rs2::frame f ) { return b->rs2::filter::process( f ); };
+                           } } );
+    benchmarks.push_back( { "yuy_decoder", yuyv, block< rs2::yuy_decoder >() } );
+    benchmarks.push_back( { "y411_decoder", y411, block< rs2::y411_decoder >() } );
+    return benchmarks;
+}
+
+
+bool run( benchmark const & bm, resolution const & res, input const & in, size_t n_frames, size_t warmup,
+          result & r )
+{
+    auto const & frames = bm.frames( in );
+    if( frames.empty() )
+        return false;
+
+    auto process = bm.make();
+    std::vector< double > ns;
+    ns.reserve( n_frames );
+    for( size_t i = 0; i < warmup + n_frames; ++i )
+    {
+        auto const & f = frames[i % frames.size()];
+        auto const start = std::chrono::steady_clock::now();
+        auto out = process( f );
+        auto const end = std::chrono::steady_clock::now();
+        if( i >= warmup )
+            ns.push_back( std::chrono::duration< double, std::nano >( end - start ).count() );
+    }
+
+    std::sort( ns.begin(), ns.end() );
+    double sum = 0;
+    for( auto t : ns )
+        sum += t;
+    r.name = bm.name;
+    r.res = res;
+    r.iterations = ns.size();
+    r.mean_ns = sum / ns.size();
+    r.p50_ns = ns[ns.size() / 2];
+    r.p99_ns = ns[std::min( ns.size() - 1, ns.size() * 99 / 100 )];
+    r.max_ns = ns.back();
+    return true;
+}
+
+
+std::string full_name( result const & r )
+{
+    return r.name + "/" + std::to_string( r.res.first ) + "x" + std::to_string( r.res.second );
+}
+
+
+std::string json_string( std::string const & s )
+{
+    std::ostringstream os;
+    os << '"';
+    for( char c : s )
+    {
+        if( c == '"' || c == '\\' )
+            os << '\\' << c;
+        else if( static_cast< unsigned char >( c ) < 0x20 )
+            os << "\\u" << std::hex << std::setw( 4 ) << std::setfill( '0' ) << int( c ) << std::dec;
+        else
+            os << c;
+    }
+    os << '"';
+    return os.str();
+}
+
+
+// Same layout as Google Benchmark's JSON output, so the same tools can compare runs
+void write_json( std::ostream & os, std::vector< result > const & results, std::string const & source )
+{
+    char date[32];
+    auto const now = std::time( nullptr );
+    std::strftime( date, sizeof( date ), "%Y-%m-%dT%H:%M:%S", std::localtime( &now ) );
+
+    os << "{\n";
+    os << "  \"context\": {\n";
+    os << "    \"date\": " << json_string( date ) << ",\n";
+    os << "    \"executable\": \"rs-pb-benchmark\",\n";
+    os << "    \"library_version\": " << json_string( RS2_API_FULL_VERSION_STR ) << ",\n";
+    os << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+    os << "    \"source\": " << json_string( source ) << "\n";
+    os << "  },\n";
+    os << "  \"benchmarks\": [";
+    for( size_t i = 0; i < results.size(); ++i )
+    {
+        auto const & r = results[i];
+        double const pixels = double( r.res.first ) * r.res.second;
+        os << ( i ? "," : "" ) << "\n    {\n";
+        os << "      \"name\": " << json_string( full_name( r ) ) << ",\n";
+        os << "      \"run_name\": " << json_string( full_name( r ) ) << ",\n";
+        os << "      \"run_type\": \"iteration\",\n";
+        os << "      \"iterations\": " << r.iterations << ",\n";
+        os << std::fixed << std::setprecision( 1 );
+        os << "      \"real_time\": " << r.mean_ns << ",\n";
+        os << "      \"time_unit\": \"ns\",\n";
+        os << "      \"p50\": " << r.p50_ns << ",\n";
+        os << "      \"p99\": " << r.p99_ns << ",\n";
+        os << "      \"max\": " << r.max_ns << ",\n";
+        os << std::setprecision( 3 );
+        os << "      \"items_per_second\": " << 1e9 / r.mean_ns << ",\n";
+        os << "      \"megapixels_per_second\": " << pixels * 1e3 / r.mean_ns << "\n";
+        os << "    }";
+        os << std::defaultfloat;
+    }
+    os << "\n  ]\n}\n";
+}
+
+
+std::vector< resolution > parse_resolutions( std::vector< std::string > const & args )
+{
+    std::vector< resolution > resolutions;
+    for( auto & a : args )
+    {
+        int w = 0, h = 0;
+        char x = 0;
+        std::istringstream is( a );
+        if( ! ( is >> w >> x >> h ) || x != 'x' || w <= 0 || h <= 0 || w % 2 || h % 2 )
+            throw std::runtime_error( "invalid resolution '" + a + "'; expecting an even WxH, e.g. 848x480" );
+        resolutions.push_back( { w, h } );
+    }
+    return resolutions;
+}
+
+
+}  // namespace
+
+
+int main( int argc, char ** argv ) try
+{
+    CmdLine cmd( "librealsense rs-pb-benchmark tool", ' ', RS2_API_FULL_VERSION_STR );
+    MultiArg< std::string > bags( "i", "input", "Bag file to take frames from, instead of synthetic ones", false,
+                                  "path" );
+    MultiArg< std::string > resolutions_arg( "r", "resolution", "Synthetic frame resolution (default: 640x480, "
+                                             "848x480 and 1280x720)", false, "WxH" );
+    ValueArg< size_t > frames_arg( "n", "frames", "Frames to time, per benchmark (default: 300)", false, 300,
+                                   "count" );
+    ValueArg< size_t > warmup_arg( "w", "warmup", "Frames to process before timing (default: 30)", false, 30,
+                                   "count" );
+    ValueArg< std::string > filter_arg( "f", "filter", "Only run the benchmarks whose name/WxH matches this regex",
+                                        false, "", "regex" );
+    ValueArg< int > threads_arg( "t", "threads", "Processing threads (0 for the library's default)", false, 0,
+                                 "count" );
+    ValueArg< std::string > json_arg( "j", "json", "Write the results as JSON to this file ('-' for the console)",
+                                      false, "", "path" );
+    cmd.add( bags );
+    cmd.add( resolutions_arg );
+    cmd.add( frames_arg );
+    cmd.add( warmup_arg );
+    cmd.add( filter_arg );
+    cmd.add( threads_arg );
+    cmd.add( json_arg );
+    cmd.parse( argc, argv );
+
+    rs2::log_to_console( RS2_LOG_SEVERITY_ERROR );
+
+    // "processing-threads" sizes the pool from the moment a context is made, for all blocks
+    std::string settings = "{\"processing-threads\":" + std::to_string( threads_arg.getValue() ) + "}";
+    rs2::context ctx( settings.c_str() );
+
+    size_t const n_frames = std::max< size_t >( 1, frames_arg.getValue() );
+    size_t const warmup = warmup_arg.getValue();
+
+    inputs all;
+    keep_alive sources;
+    std::string source;
+    if( bags.getValue().empty() )
+    {
+        auto resolutions = parse_resolutions( resolutions_arg.getValue() );
+        if( resolutions.empty() )
+            resolutions = { { 640, 480 }, { 848, 480 }, { 1280, 720 } };
+        // Frames are reused in a loop, so we don't need as many as we time
+        add_synthetic( all, resolutions, std::min< size_t >( n_frames, 30 ), sources );
+        source = "synthetic";
+    }
+    else
+    {
+        for( auto & bag : bags.getValue() )
+        {
+            add_bag( all, bag, n_frames, sources );
+            source += ( source.empty() ? "" : ";" ) + bag;
+        }
+    }
+    for( auto & in : all )
+        make_disparity( in.second );
+
+    std::regex filter( filter_arg.getValue() );
+    std::vector< result > results;
+
+    std::cout << std::left << std::setw( 40 ) << "Benchmark" << std::right << std::setw( 12 ) << "p50 (us)"
+              << std::setw( 12 ) << "p99 (us)" << std::setw( 12 ) << "mean (us)" << std::setw( 12 ) << "FPS"
+              << std::setw( 12 ) << "MP/s" << std::endl;
+    std::cout << std::string( 100, '-' ) << std::endl;
+    for( auto const & bm : get_benchmarks() )
+    {
+        for( auto const & in : all )
+        {
+            result r;
+            r.name = bm.name;
+            r.res = in.first;
+            if( ! std::regex_search( full_name( r ), filter ) )
+                continue;
+            try
+            {
+                if( ! run( bm, in.first, in.second, n_frames, warmup, r ) )
+                    continue;  // no input for it
+            }
+            catch( std::exception const & e )
+            {
+                std::cerr << full_name( r ) << " failed: " << e.what() << std::endl;
+                continue;
+            }
+            std::cout << std::left << std::setw( 40 ) << full_name( r ) << std::right << std::fixed
+                      << std::setprecision( 1 ) << std::setw( 12 ) << r.p50_ns / 1e3 << std::setw( 12 )
+                      << r.p99_ns / 1e3 << std::setw( 12 ) << r.mean_ns / 1e3 << std::setw( 12 ) << 1e9 / r.mean_ns
+                      << std::setw( 12 ) << double( r.res.first ) * r.res.second * 1e3 / r.mean_ns << std::endl;
+            results.push_back( r );
+        }
+    }
+
+    auto const & json = json_arg.getValue();
+    if( json == "-" )
+        write_json( std::cout, results, source );
+    else if( ! json.empty() )
+    {
+        std::ofstream out( json );
+        if( ! out )
+            throw std::runtime_error( "cannot write " + json );
+        write_json( out, results, source );
+    }
+
+    return EXIT_SUCCESS;
+}
+catch( const rs2::error & e )
+{
+    std::cerr << "RealSense error calling " << e.get_failed_function() << "(" << e.get_failed_args() << "):\n    "
+              << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
+catch( const std::exception & e )
+{
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
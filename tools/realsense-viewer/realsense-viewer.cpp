@@ -411,6 +411,11 @@ int main(int argc, const char** argv) try
         }
     }
 
+    window.on_first_frame = [&]()
+    {
+        viewer_model.preload_assets();
+    };
+
     window.on_load = [&]()
     {
         refresh_devices(m, ctx, devices_connection_changes, connected_devs,
@@ -12,6 +12,7 @@
 #include <thread>
 #include <string.h>
 #include <chrono>
+#include <sstream>
 #include "tclap/CmdLine.h"
 
 using namespace TCLAP;
@@ -23,18 +24,44 @@ int main(int argc, char * argv[]) try
     SwitchArg debug_arg( "", "debug", "Turn on LibRS debug logs" );
     ValueArg<double>    time("t", "Time", "Amount of time to record (in seconds)", false, 10., "");
     ValueArg<std::string> out_file("f", "FullFilePath", "the file where the data will be saved to", false, "test.bag", "");
+    MultiArg<std::string> fps_arg("", "fps", "Record a stream type at a lower rate than it streams, e.g. --fps color=5", false, "stream=fps");
+    ValueArg<double>    split_size("", "split-size", "Go on in a new file (name_001.bag, ...) whenever the current one reaches this size", false, 0., "MB");
+    ValueArg<double>    split_time("", "split-time", "Go on in a new file (name_001.bag, ...) whenever the current one reaches this duration", false, 0., "seconds");
 
     cmd.add(debug_arg);
     cmd.add(time);
     cmd.add(out_file);
+    cmd.add(fps_arg);
+    cmd.add(split_size);
+    cmd.add(split_time);
     cmd.parse(argc, argv);
 
+    // Passed to the recorder through the context settings
+    std::ostringstream settings;
+    settings << "{";
+    if (!fps_arg.getValue().empty())
+    {
+        settings << "\"record-fps\":{";
+        const char* separator = "";
+        for (auto&& stream_fps : fps_arg.getValue())
+        {
+            auto eq = stream_fps.find('=');
+            if (eq == std::string::npos)
+                throw std::runtime_error("--fps expects <stream>=<fps>, e.g. color=5");
+            settings << separator << "\"" << stream_fps.substr(0, eq) << "\":" << std::stod(stream_fps.substr(eq + 1));
+            separator = ",";
+        }
+        settings << "},";
+    }
+    settings << "\"record-split\":{\"size\":" << split_size.getValue() << ",\"duration\":" << split_time.getValue() << "}}";
+
 #ifdef BUILD_EASYLOGGINGPP
     bool const debugging = debug_arg.getValue();
     rs2::log_to_console( debugging ? RS2_LOG_SEVERITY_DEBUG : RS2_LOG_SEVERITY_ERROR );
 #endif
 
-    rs2::pipeline pipe;
+    rs2::context ctx(settings.str().c_str());
+    rs2::pipeline pipe(ctx);
     rs2::config cfg;
     cfg.enable_record_to_file(out_file.getValue());
 
@@ -5,6 +5,7 @@
 
 #include <string>
 #include <regex>
+#include <memory>
 
 #include <realsense-file/rosbag/rosbag_storage/include/rosbag/bag.h>
 #include <realsense-file/rosbag/rosbag_storage/include/rosbag/view.h>
@@ -27,17 +28,52 @@ namespace rosbag_inspector
         uint64_t uncompressed;
     };
 
+    // What the bag's index tells of a topic, without reading any of its messages
+    struct topic_info
+    {
+        topic_info() : messages(0), duration(0), rate(0) {}
+        topic_info(const topic_info& other)
+            : data_type(other.data_type), messages(other.messages), duration(other.duration), rate(other.rate) {}
+        topic_info& operator=(const topic_info& other)
+        {
+            data_type = other.data_type;
+            messages = other.messages;
+            duration = other.duration;
+            rate = other.rate;
+            view.reset(); // It refers to the other's bag
+            return *this;
+        }
+
+        std::string data_type; // Of the first connection, in case of several
+        uint32_t messages;
+        double duration;       // Between the first and last messages, in seconds
+        double rate;           // Messages per second; 0 for fewer than 2 messages
+        std::shared_ptr<rosbag::View> view; // Of its messages; made the first time the topic is opened, and never copied
+    };
+
     struct rosbag_content
     {
         rosbag_content(const std::string& file)
         {
             bag.open(file);
 
+            // Connections and the index entries of each are loaded when the bag is opened: no chunk is read here
             rosbag::View entire_bag_view(bag);
-
-            for (auto&& m : entire_bag_view)
+            for (auto&& connection : entire_bag_view.getConnections())
+            {
+                auto& info = topics[connection->topic];
+                if (info.data_type.empty())
+                    info.data_type = connection->datatype;
+            }
+            for (auto&& topic : topics)
             {
-                topics_to_message_types[m.getTopic()].push_back(m.getDataType());
+                rosbag::View messages(bag, rosbag::TopicQuery(topic.first));
+                auto& info = topic.second;
+                info.messages = messages.size();
+                if (info.messages > 0)
+                    info.duration = (messages.getEndTime() - messages.getBeginTime()).toSec();
+                if (info.messages > 1 && info.duration > 0)
+                    info.rate = (info.messages - 1) / info.duration;
             }
 
             path = bag.getFileName();
@@ -65,7 +101,7 @@ namespace rosbag_inspector
             version = other.version;
             size = other.size;
             compression_info = other.compression_info;
-            topics_to_message_types = other.topics_to_message_types;
+            topics = other.topics;
         }
         rosbag_content(rosbag_content&& other)
         {
@@ -78,7 +114,7 @@ namespace rosbag_inspector
             version = other.version;
             size = other.size;
             compression_info = other.compression_info;
-            topics_to_message_types = other.topics_to_message_types;
+            topics = other.topics;
 
             other.cache.clear();
             other.file_duration = std::chrono::nanoseconds::zero();
@@ -89,8 +125,17 @@ namespace rosbag_inspector
             other.compression_info.compressed = 0;
             other.compression_info.uncompressed = 0;
             other.compression_info.compression_type = "";
-            other.topics_to_message_types.clear();
+            other.topics.clear();
         }
+        // The messages of a topic, in the bag's (already loaded) index
+        rosbag::View& get_messages(const std::string& topic)
+        {
+            auto& info = topics[topic];
+            if (!info.view)
+                info.view = std::make_shared<rosbag::View>(bag, rosbag::TopicQuery(topic));
+            return *info.view;
+        }
+
         std::string instanciate_and_cache(const rosbag::MessageInstance& m, uint64_t count)
         {
             auto key = std::make_tuple(m.getCallerId(), m.getDataType(), m.getMD5Sum(), m.getTopic(), m.getTime(), count);
@@ -120,7 +165,7 @@ namespace rosbag_inspector
         std::string version;
         double size;
         rosbag_inspector::compression_info compression_info;
-        std::map<std::string, std::vector<std::string>> topics_to_message_types;
+        std::map<std::string, topic_info> topics;
         rosbag::Bag bag;
     };
 }
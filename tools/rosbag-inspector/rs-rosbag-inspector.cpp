@@ -241,21 +241,24 @@ void draw_bag_content(rosbag_content& bag, int flags)
     ImGui::Text("\t%s", std::string(tmpstringstream() << std::left << std::setw(20) << "compressed: " << bag.compression_info.compressed).c_str());
     if (ImGui::CollapsingHeader("Topics"))
     {
-        for (auto&& topic_to_message_type : bag.topics_to_message_types)
+        for (auto&& topic_and_info : bag.topics)
         {
-            std::string topic = topic_to_message_type.first;
-            std::vector<std::string> messages_types = topic_to_message_type.second;
+            std::string topic = topic_and_info.first;
+            auto const& info = topic_and_info.second;
             std::ostringstream oss;
             int max_topic_len = 100;
             oss << std::left << std::setw(max_topic_len) << topic
-                << " " << std::left << std::setw(10) << messages_types.size() << std::setw(6) << std::string(" msg") + (messages_types.size() > 1 ? "s" : "")
-                << ": " << std::left << std::setw(40) << messages_types.front() << std::endl;
+                << " " << std::left << std::setw(10) << info.messages << std::setw(6) << std::string(" msg") + (info.messages > 1 ? "s" : "")
+                << std::right << std::fixed << std::setprecision(3) << std::setw(12) << info.duration << " s"
+                << std::setw(10) << std::setprecision(2) << info.rate << " Hz"
+                << "  : " << std::left << std::setw(40) << info.data_type << std::endl;
             std::string line = oss.str();
             auto pos = ImGui::GetCursorPos();
             ImGui::SetCursorPos({ pos.x + 20, pos.y });
             if (ImGui::CollapsingHeader(line.c_str()))
             {
-                rosbag::View messages(bag.bag, rosbag::TopicQuery(topic));
+                // Only now, and only as many as shown, are the topic's messages read
+                auto& messages = bag.get_messages(topic);
                 uint64_t count = 0;
                 constexpr uint64_t num_next_items_to_show = 10;
                 num_topics_to_show[topic] = std::max(num_topics_to_show[topic], num_next_items_to_show);
@@ -276,7 +279,7 @@ void draw_bag_content(rosbag_content& bag, int flags)
                     ImGui::Separator();
                     if (count >= max)
                     {
-                        int left = messages.size() - max;
+                        int left = int(int64_t(info.messages) - int64_t(max));
                         if (left > 0)
                         {
                             ImGui::Text("... %d more messages", left);
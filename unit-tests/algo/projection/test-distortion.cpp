@@ -54,6 +54,77 @@ TEST_CASE( "brown_conrady_deproject" )
     compare(pixel1, pixel2);
 }
 
+TEST_CASE( "batch_projection_matches_single_point" )
+{
+    for( auto model : { RS2_DISTORTION_NONE, RS2_DISTORTION_INVERSE_BROWN_CONRADY, RS2_DISTORTION_BROWN_CONRADY, RS2_DISTORTION_KANNALA_BRANDT4 } )
+    {
+        CAPTURE( model );
+        rs2_intrinsics model_intrin = intrin;
+        model_intrin.model = model;
+
+        // An odd count, to go through the non-SIMD remainder too
+        const int count = 11;
+        std::vector< float > pixels, depths;
+        for( int i = 0; i < count; ++i )
+        {
+            pixels.push_back( float( 10 + 113 * i ) );
+            pixels.push_back( float( 7 + 61 * i ) );
+            depths.push_back( 0.5f + i );
+        }
+
+        std::vector< float > points( 3 * count ), batch_points( 3 * count );
+        std::vector< float > batch_pixels( 2 * count );
+        for( int i = 0; i < count; ++i )
+            rs2_deproject_pixel_to_point( &points[3 * i], &model_intrin, &pixels[2 * i], depths[i] );
+        rs2_deproject_pixels_to_points( batch_points.data(), &model_intrin, pixels.data(), depths.data(), count );
+        for( int i = 0; i < 3 * count; ++i )
+        {
+            CAPTURE( i );
+            REQUIRE( std::abs( points[i] - batch_points[i] ) <= 0.001 );
+        }
+
+        rs2_project_points_to_pixels( batch_pixels.data(), &model_intrin, points.data(), count );
+        for( int i = 0; i < count; ++i )
+        {
+            CAPTURE( i );
+            float pixel[2];
+            rs2_project_point_to_pixel( pixel, &model_intrin, &points[3 * i] );
+            compare( { pixel[0], pixel[1] }, { batch_pixels[2 * i], batch_pixels[2 * i + 1] } );
+        }
+    }
+}
+
+TEST_CASE( "color_to_depth_projector_matches_single_pixel" )
+{
+    rs2_intrinsics depth_intrin = { 848, 480, 424.3f, 240.1f, 420.1f, 420.1f, RS2_DISTORTION_BROWN_CONRADY, { 0 } };
+    rs2_extrinsics depth_to_color = { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0.015f, 0, 0 } };
+    rs2_extrinsics color_to_depth = { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { -0.015f, 0, 0 } };
+
+    std::vector< uint16_t > depth( depth_intrin.width * depth_intrin.height );
+    for( size_t i = 0; i < depth.size(); ++i )
+        depth[i] = i % 17 ? uint16_t( 800 + ( i / 4000 ) * 10 ) : 0;
+
+    std::vector< float > from = { 10, 10, 640, 360, 1000, 700, 1279, 0 };
+    int const count = int( from.size() / 2 );
+
+    rs2_error * e = nullptr;
+    auto projector = rs2_create_color_to_depth_projector( &depth_intrin, &intrin, &color_to_depth, &depth_to_color, &e );
+    REQUIRE( projector );
+    std::vector< float > to( from.size() );
+    rs2_project_color_pixels_to_depth_pixels( projector, to.data(), from.data(), count, depth.data(), 0.001f, 0.1f, 10, &e );
+    REQUIRE( ! e );
+    rs2_delete_color_to_depth_projector( projector );
+
+    for( int i = 0; i < count; ++i )
+    {
+        CAPTURE( i );
+        librealsense::float2 expected = { -1, -1 };
+        rs2_project_color_pixel_to_depth_pixel( (float *)&expected, depth.data(), 0.001f, 0.1f, 10,
+                                                &depth_intrin, &intrin, &color_to_depth, &depth_to_color, &from[2 * i] );
+        compare( expected, { to[2 * i], to[2 * i + 1] } );
+    }
+}
+
 #if 0 //TODO: check why sse tests fails on LibCi
 TEST_CASE("inverse_brown_conrady_sse_deproject")
 {
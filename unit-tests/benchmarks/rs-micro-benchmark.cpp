@@ -0,0 +1,497 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <src/small-heap.h>
+#include <src/lock-free-heap.h>
+#include <rsutils/concurrency/concurrency.h>
+
+#include "tclap/CmdLine.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace TCLAP;
+
+
+namespace {
+
+
+typedef std::chrono::steady_clock steady;
+typedef std::vector< double > samples;  // in ns
+
+
+double ns_since( steady::time_point start )
+{
+    return std::chrono::duration< double, std::nano >( steady::now() - start ).count();
+}
+
+
+struct result
+{
+    std::string name;
+    size_t producers;
+    size_t iterations;
+    double mean_ns, p50_ns, p99_ns, p999_ns, max_ns;
+    double items_per_second;  // over all producers
+};
+
+
+// Runs 'body' on each producer thread, all starting at once, and returns the wall time they took. Each gets its index
+// and the samples to fill.
+double run_producers( size_t producers, std::function< void( size_t, samples & ) > const & body,
+                      std::vector< samples > & per_thread )
+{
+    per_thread.assign( producers, samples() );
+    std::atomic< size_t > ready( 0 );
+    std::atomic< bool > go( false );
+    std::vector< std::thread > threads;
+    for( size_t i = 0; i < producers; ++i )
+        threads.emplace_back( [&, i]() {
+            ++ready;
+            while( ! go )
+                std::this_thread::yield();
+            body( i, per_thread[i] );
+        } );
+    while( ready < producers )
+        std::this_thread::yield();
+    auto const start = steady::now();
+    go = true;
+    for( auto & t : threads )
+        t.join();
+    return ns_since( start );
+}
+
+
+void summarize( std::string const & name, size_t producers, size_t ops, double wall_ns, samples & ns, result & r )
+{
+    std::sort( ns.begin(), ns.end() );
+    double sum = 0;
+    for( auto t : ns )
+        sum += t;
+    auto at = [&]( size_t per_thousand ) {
+        return ns[std::min( ns.size() - 1, ns.size() * per_thousand / 1000 )];
+    };
+    r.name = name;
+    r.producers = producers;
+    r.iterations = ns.size();
+    r.mean_ns = ns.empty() ? 0 : sum / ns.size();
+    r.p50_ns = ns.empty() ? 0 : at( 500 );
+    r.p99_ns = ns.empty() ? 0 : at( 990 );
+    r.p999_ns = ns.empty() ? 0 : at( 999 );
+    r.max_ns = ns.empty() ? 0 : ns.back();
+    r.items_per_second = ops * 1e9 / wall_ns;
+}
+
+
+void summarize( std::string const & name, size_t producers, size_t ops, double wall_ns,
+                std::vector< samples > & per_thread, result & r )
+{
+    samples all;
+    for( auto & s : per_thread )
+        all.insert( all.end(), s.begin(), s.end() );
+    summarize( name, producers, ops, wall_ns, all, r );
+}
+
+
+// One benchmark: given the number of producers and the operations each does, fill in the result
+struct benchmark
+{
+    std::string name;
+    std::function< void( size_t producers, size_t ops, result & ) > run;
+};
+
+
+// Each producer allocates an item and gives it back; the latency is of the pair
+template< class heap >
+void run_heap( std::string const & name, size_t producers, size_t ops, result & r )
+{
+    heap h;
+    std::vector< samples > ns;
+    auto wall = run_producers( producers,
+                               [&]( size_t, samples & s ) {
+                                   s.reserve( ops );
+                                   for( size_t i = 0; i < ops; ++i )
+                                   {
+                                       auto const start = steady::now();
+                                       auto item = h.allocate();
+                                       if( item )
+                                           h.deallocate( item );
+                                       s.push_back( ns_since( start ) );
+                                   }
+                               },
+                               ns );
+    summarize( name, producers, producers * ops, wall, ns, r );
+}
+
+
+// The producers enqueue the time they did so, and the consumer takes the latency when it dequeues it; the queue is
+// small enough that producers have to wait for room
+template< class queue >
+void run_queue( std::string const & name, size_t producers, size_t ops, result & r )
+{
+    queue q( 64 );
+    size_t const total = producers * ops;
+    samples latencies;
+    latencies.reserve( total );
+    std::thread consumer( [&]() {
+        steady::time_point enqueued;
+        while( latencies.size() < total )
+            if( q.dequeue( &enqueued, 1000 ) )
+                latencies.push_back( ns_since( enqueued ) );
+            else
+                break;  // a producer must have died; report what we have
+    } );
+    auto const start = steady::now();
+    std::vector< samples > unused;
+    run_producers( producers,
+                   [&]( size_t, samples & ) {
+                       for( size_t i = 0; i < ops; ++i )
+                           q.blocking_enqueue( steady::now() );
+                   },
+                   unused );
+    consumer.join();
+    summarize( name, producers, total, ns_since( start ), latencies, r );
+}
+
+
+// Like the queue, but through a dispatcher: the latency is from invoke() until the action runs
+void run_dispatcher( std::string const & name, size_t producers, size_t ops, result & r )
+{
+    size_t const total = producers * ops;
+    samples latencies;
+    latencies.reserve( total );
+    dispatcher d( 64 );
+    d.start();
+    auto const start = steady::now();
+    std::vector< samples > unused;
+    run_producers( producers,
+                   [&]( size_t, samples & ) {
+                       for( size_t i = 0; i < ops; ++i )
+                       {
+                           auto const invoked = steady::now();
+                           // Only the dispatching thread touches the latencies
+                           d.invoke( [&latencies, invoked]( dispatcher::cancellable_timer ) {
+                               latencies.push_back( ns_since( invoked ) );
+                           },
+                                     true );  // blocking: nothing is dropped
+                       }
+                   },
+                   unused );
+    d.flush();
+    auto const wall = ns_since( start );
+    d.stop();
+    summarize( name, producers, total, wall, latencies, r );
+}
+
+
+rs2_intrinsics intrinsics( int w, int h )
+{
+    return { w, h, w / 2.f, h / 2.f, float( w ), float( w ), RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+}
+
+
+// A software device with a Y8 stream per producer, each from a sensor of its own
+struct software_streams
+{
+    static int const width = 64, height = 48;
+
+    rs2::software_device dev;
+    std::vector< rs2::software_sensor > sensors;
+    std::vector< rs2::stream_profile > profiles;
+    std::vector< uint8_t > pixels;
+
+    explicit software_streams( size_t n )
+        : pixels( width * height )
+    {
+        for( size_t i = 0; i < n; ++i )
+        {
+            sensors.push_back( dev.add_sensor( "Producer " + std::to_string( i ) ) );
+            profiles.push_back( sensors.back().add_video_stream( { RS2_STREAM_INFRARED, int( i + 1 ), int( i + 1 ),
+                                                                   width, height, 30, 1, RS2_FORMAT_Y8,
+                                                                   intrinsics( width, height ) } ) );
+            sensors.back().open( profiles.back() );
+        }
+    }
+
+    // The pixels are shared, and never freed by the library
+    void push( size_t i, int frame_number )
+    {
+        sensors[i].on_video_frame( { pixels.data(), []( void * ) {}, width, 1, 1000. / 30 * frame_number,
+                                     RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, frame_number, profiles[i].get() } );
+    }
+};
+
+
+// The producers all allocate from the frame archive of one processing block, which releases the frame right away;
+// the latency is of allocate_video_frame() and the release
+void run_frame_archive( std::string const & name, size_t producers, size_t ops, result & r )
+{
+    software_streams sw( 1 );
+    rs2::frame_queue q( 1, true );
+    sw.sensors[0].start( q );
+    sw.push( 0, 1 );
+    auto original = q.wait_for_frame();
+    sw.sensors[0].stop();
+
+    static thread_local samples * current = nullptr;
+    auto profile = original.get_profile();
+    rs2::processing_block block( [profile]( rs2::frame f, rs2::frame_source & source ) {
+        auto const start = steady::now();
+        {
+            auto out = source.allocate_video_frame( profile, f );
+        }
+        current->push_back( ns_since( start ) );
+    } );
+
+    std::vector< samples > ns;
+    auto wall = run_producers( producers,
+                               [&]( size_t, samples & s ) {
+                                   s.reserve( ops );
+                                   current = &s;
+                                   for( size_t i = 0; i < ops; ++i )
+                                       block.invoke( original );
+                               },
+                               ns );
+    summarize( name, producers, producers * ops, wall, ns, r );
+}
+
+
+// Each producer pushes the frames of its own stream into one syncer, with matching timestamps, so that the framesets
+// are made of a frame from every producer; the latency is of on_video_frame(), which dispatches to the syncer's
+// composite matcher on the producer's thread
+void run_syncer( std::string const & name, size_t producers, size_t ops, result & r )
+{
+    software_streams sw( producers );
+    rs2::syncer sync( 16 );
+    for( auto & s : sw.sensors )
+        s.start( sync );
+
+    std::atomic< bool > done( false );
+    std::thread consumer( [&]() {
+        rs2::frameset fs;
+        while( ! done )
+            sync.try_wait_for_frames( &fs, 10 );
+    } );
+
+    std::vector< samples > ns;
+    auto wall = run_producers( producers,
+                               [&]( size_t index, samples & s ) {
+                                   s.reserve( ops );
+                                   for( size_t i = 0; i < ops; ++i )
+                                   {
+                                       auto const start = steady::now();
+                                       sw.push( index, int( i + 1 ) );
+                                       s.push_back( ns_since( start ) );
+                                   }
+                               },
+                               ns );
+    done = true;
+    consumer.join();
+    for( auto & s : sw.sensors )
+        s.stop();
+    summarize( name, producers, producers * ops, wall, ns, r );
+}
+
+
+std::vector< benchmark > get_benchmarks()
+{
+    typedef single_consumer_queue< steady::time_point > scq;
+    typedef lock_free_single_consumer_queue< steady::time_point > lf_scq;
+    typedef librealsense::small_heap< int, 128 > heap;
+    typedef librealsense::lock_free_heap< int, 128 > lf_heap;
+
+    std::vector< benchmark > benchmarks;
+    benchmarks.push_back( { "small_heap", []( size_t p, size_t n, result & r ) {
+                               run_heap< heap >( "small_heap", p, n, r );
+                           } } );
+    benchmarks.push_back( { "lock_free_heap", []( size_t p, size_t n, result & r ) {
+                               run_heap< lf_heap >( "lock_free_heap", p, n, r );
+                           } } );
+    benchmarks.push_back( { "single_consumer_queue", []( size_t p, size_t n, result & r ) {
+                               run_queue< scq >( "single_consumer_queue", p, n, r );
+                           } } );
+    benchmarks.push_back( { "lock_free_single_consumer_queue", []( size_t p, size_t n, result & r ) {
+                               run_queue< lf_scq >( "lock_free_single_consumer_queue", p, n, r );
+                           } } );
+    benchmarks.push_back( { "dispatcher", []( size_t p, size_t n, result & r ) {
+                               run_dispatcher( "dispatcher", p, n, r );
+                           } } );
+    benchmarks.push_back( { "frame_archive", []( size_t p, size_t n, result & r ) {
+                               run_frame_archive( "frame_archive", p, n, r );
+                           } } );
+    benchmarks.push_back( { "syncer", []( size_t p, size_t n, result & r ) { run_syncer( "syncer", p, n, r ); } } );
+    return benchmarks;
+}
+
+
+std::string full_name( std::string const & name, size_t producers )
+{
+    return name + "/threads:" + std::to_string( producers );
+}
+
+
+std::string json_string( std::string const & s )
+{
+    std::ostringstream os;
+    os << '"';
+    for( char c : s )
+    {
+        if( c == '"' || c == '\\' )
+            os << '\\' << c;
+        else if( static_cast< unsigned char >( c ) < 0x20 )
+            os << "\\u" << std::hex << std::setw( 4 ) << std::setfill( '0' ) << int( c ) << std::dec;
+        else
+            os << c;
+    }
+    os << '"';
+    return os.str();
+}
+
+
+// Same layout as Google Benchmark's JSON output (and rs-pb-benchmark's), so the same tools can compare runs
+void write_json( std::ostream & os, std::vector< result > const & results )
+{
+    char date[32];
+    auto const now = std::time( nullptr );
+    std::strftime( date, sizeof( date ), "%Y-%m-%dT%H:%M:%S", std::localtime( &now ) );
+
+    os << "{\n";
+    os << "  \"context\": {\n";
+    os << "    \"date\": " << json_string( date ) << ",\n";
+    os << "    \"executable\": \"rs-micro-benchmark\",\n";
+    os << "    \"library_version\": " << json_string( RS2_API_FULL_VERSION_STR ) << ",\n";
+    os << "    \"num_cpus\": " << std::thread::hardware_concurrency() << "\n";
+    os << "  },\n";
+    os << "  \"benchmarks\": [";
+    for( size_t i = 0; i < results.size(); ++i )
+    {
+        auto const & r = results[i];
+        auto const name = full_name( r.name, r.producers );
+        os << ( i ? "," : "" ) << "\n    {\n";
+        os << "      \"name\": " << json_string( name ) << ",\n";
+        os << "      \"run_name\": " << json_string( name ) << ",\n";
+        os << "      \"run_type\": \"iteration\",\n";
+        os << "      \"threads\": " << r.producers << ",\n";
+        os << "      \"iterations\": " << r.iterations << ",\n";
+        os << std::fixed << std::setprecision( 1 );
+        os << "      \"real_time\": " << r.mean_ns << ",\n";
+        os << "      \"time_unit\": \"ns\",\n";
+        os << "      \"p50\": " << r.p50_ns << ",\n";
+        os << "      \"p99\": " << r.p99_ns << ",\n";
+        os << "      \"p999\": " << r.p999_ns << ",\n";
+        os << "      \"max\": " << r.max_ns << ",\n";
+        os << "      \"items_per_second\": " << r.items_per_second << "\n";
+        os << "    }";
+        os << std::defaultfloat;
+    }
+    os << "\n  ]\n}\n";
+}
+
+
+}  // namespace
+
+
+int main( int argc, char ** argv ) try
+{
+    CmdLine cmd( "librealsense rs-micro-benchmark tool", ' ', RS2_API_FULL_VERSION_STR );
+    MultiArg< size_t > producers_arg( "p", "producers", "Producer threads (default: 1, 2, 4, 8 and 16)", false,
+                                      "count" );
+    ValueArg< size_t > ops_arg( "n", "ops", "Operations per producer (default: 10000)", false, 10000, "count" );
+    ValueArg< size_t > warmup_arg( "w", "warmup", "Operations per producer before timing (default: 1000)", false,
+                                   1000, "count" );
+    ValueArg< std::string > filter_arg( "f", "filter",
+                                        "Only run the benchmarks whose name/threads:N matches this regex", false, "",
+                                        "regex" );
+    ValueArg< std::string > json_arg( "j", "json", "Write the results as JSON to this file ('-' for the console)",
+                                      false, "", "path" );
+    cmd.add( producers_arg );
+    cmd.add( ops_arg );
+    cmd.add( warmup_arg );
+    cmd.add( filter_arg );
+    cmd.add( json_arg );
+    cmd.parse( argc, argv );
+
+    rs2::log_to_console( RS2_LOG_SEVERITY_ERROR );
+
+    auto producer_counts = producers_arg.getValue();
+    if( producer_counts.empty() )
+        producer_counts = { 1, 2, 4, 8, 16 };
+    size_t const ops = std::max< size_t >( 1, ops_arg.getValue() );
+    size_t const warmup = warmup_arg.getValue();
+
+    std::regex filter( filter_arg.getValue() );
+    std::vector< result > results;
+
+    std::cout << std::left << std::setw( 48 ) << "Benchmark" << std::right << std::setw( 12 ) << "p50 (us)"
+              << std::setw( 12 ) << "p99 (us)" << std::setw( 12 ) << "p99.9 (us)" << std::setw( 12 ) << "max (us)"
+              << std::setw( 14 ) << "Mops/s" << std::endl;
+    std::cout << std::string( 110, '-' ) << std::endl;
+    for( auto const & bm : get_benchmarks() )
+    {
+        for( auto producers : producer_counts )
+        {
+            if( ! producers )
+                continue;
+            auto const name = full_name( bm.name, producers );
+            if( ! std::regex_search( name, filter ) )
+                continue;
+            result r;
+            try
+            {
+                if( warmup )
+                    bm.run( producers, warmup, r );
+                bm.run( producers, ops, r );
+            }
+            catch( std::exception const & e )
+            {
+                std::cerr << name << " failed: " << e.what() << std::endl;
+                continue;
+            }
+            std::cout << std::left << std::setw( 48 ) << name << std::right << std::fixed << std::setprecision( 2 )
+                      << std::setw( 12 ) << r.p50_ns / 1e3 << std::setw( 12 ) << r.p99_ns / 1e3 << std::setw( 12 )
+                      << r.p999_ns / 1e3 << std::setw( 12 ) << r.max_ns / 1e3 << std::setw( 14 )
+                      << r.items_per_second / 1e6 << std::endl;
+            results.push_back( r );
+        }
+    }
+
+    auto const & json = json_arg.getValue();
+    if( json == "-" )
+        write_json( std::cout, results );
+    else if( ! json.empty() )
+    {
+        std::ofstream out( json );
+        if( ! out )
+            throw std::runtime_error( "cannot write " + json );
+        write_json( out, results );
+    }
+
+    return EXIT_SUCCESS;
+}
+catch( const rs2::error & e )
+{
+    std::cerr << "RealSense error calling " << e.get_failed_function() << "(" << e.get_failed_args() << "):\n    "
+              << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
+catch( const std::exception & e )
+{
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+}
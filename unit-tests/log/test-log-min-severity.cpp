@@ -0,0 +1,36 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+// Whatever this build is configured with (CMake's LOG_MIN_SEVERITY), filter out DEBUG messages here
+#undef LRS_LOG_MIN_SEVERITY
+#define LRS_LOG_MIN_SEVERITY 1
+
+#include <rsutils/easylogging/easyloggingpp.h>
+// Catch also defines CHECK(), and so we have to undefine it or we get compilation errors!
+#undef CHECK
+#include "../catch.h"
+
+#include <src/log.h>
+
+
+using namespace librealsense;
+
+
+// A filtered macro compiles to nothing: its arguments, however costly, are not even evaluated
+//
+TEST_CASE( "LOG_DEBUG is compiled out below the minimum severity", "[log]" )
+{
+    reset_logger();  // nothing to console or file; also makes sure the logger is linked in
+
+    int evaluated = 0;
+    LOG_DEBUG( "frame " << ++evaluated );
+    CHECK( evaluated == 0 );
+
+#if BUILD_EASYLOGGINGPP
+    // Severities at or above the minimum are untouched
+    LOG_INFO( "frame " << ++evaluated );
+    CHECK( evaluated == 1 );
+#endif
+}
@@ -0,0 +1,327 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <unit-tests/test.h>
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+
+// Frames with fixed content, from a software device, to feed processing blocks with.
+//
+// Depth and infrared streams go to a stereo depth sensor (with depth units and a baseline, so the disparity domain
+// works); any other stream to a second sensor. All the streams have to be added before the first frame is made.
+//
+class sw_frames
+{
+public:
+    sw_frames()
+        : _depth_sensor( _dev.add_sensor( "Depth" ) )
+        , _other_sensor( _dev.add_sensor( "Color" ) )
+    {
+        _depth_sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+        _depth_sensor.add_read_only_option( RS2_OPTION_STEREO_BASELINE, 50.f );  // mm
+    }
+
+    ~sw_frames()
+    {
+        for( auto sensor : { &_depth_sensor, &_other_sensor } )
+        {
+            if( sensor->get_active_streams().empty() )
+                continue;
+            sensor->stop();
+            sensor->close();
+        }
+    }
+
+    // Pinhole intrinsics centered on the image, with a focal length of 'fx' pixels
+    static rs2_intrinsics intrinsics( int width, int height, float fx )
+    {
+        rs2_intrinsics intrin = {};
+        intrin.width = width;
+        intrin.height = height;
+        intrin.ppx = width / 2.f;
+        intrin.ppy = height / 2.f;
+        intrin.fx = intrin.fy = fx;
+        intrin.model = RS2_DISTORTION_BROWN_CONRADY;
+        return intrin;
+    }
+
+    rs2::stream_profile add_stream( rs2_stream stream, int index, rs2_format format, int width, int height, int bpp,
+                                    float fx = 380.f )
+    {
+        bool const depth = stream == RS2_STREAM_DEPTH || stream == RS2_STREAM_INFRARED;
+        auto & sensor = depth ? _depth_sensor : _other_sensor;
+        auto & profiles = depth ? _depth_profiles : _other_profiles;
+        auto profile = sensor.add_video_stream(
+            { stream, index, int( _depth_profiles.size() + _other_profiles.size() ), width, height, 30, bpp, format,
+              intrinsics( width, height, fx ) } );
+        profiles.push_back( profile );
+        return profile;
+    }
+
+    // Depth pixels are only mapped onto another stream once the extrinsics between them are known: 'to' is 'dx' meters
+    // to the right of 'from'
+    static void set_extrinsics( rs2::stream_profile from, rs2::stream_profile to, float dx )
+    {
+        rs2_extrinsics extrin = { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { -dx, 0, 0 } };
+        from.register_extrinsics_to( to, extrin );
+        extrin.translation[0] = dx;
+        to.register_extrinsics_to( from, extrin );
+    }
+
+    // Metadata for the frames made from now on, of streams of the depth sensor
+    void set_metadata( rs2_frame_metadata_value id, rs2_metadata_type value )
+    {
+        _depth_sensor.set_metadata( id, value );
+    }
+
+    // A frame of 'profile' with a copy of 'pixels', 'stride' bytes per row (stride * height in all)
+    rs2::frame make( rs2::stream_profile const & profile, std::vector< uint8_t > const & pixels, int stride )
+    {
+        start();
+        auto vsp = profile.as< rs2::video_stream_profile >();
+        REQUIRE( pixels.size() >= size_t( stride ) * vsp.height() );
+
+        auto copy = new uint8_t[pixels.size()];
+        std::memcpy( copy, pixels.data(), pixels.size() );
+        bool const depth = profile.stream_type() == RS2_STREAM_DEPTH || profile.stream_type() == RS2_STREAM_INFRARED;
+        ++_frame_number;
+        ( depth ? _depth_sensor : _other_sensor )
+            .on_video_frame( { copy,
+                               []( void * p ) { delete[] static_cast< uint8_t * >( p ); },
+                               stride,
+                               rs2_format_bpp( profile.format() ),
+                               double( _frame_number ) * 33.,
+                               RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK,
+                               _frame_number,
+                               profile.get() } );
+        rs2::frame f;
+        REQUIRE( _queue.try_wait_for_frame( &f ) );
+        return f;
+    }
+
+    // Same, with rows of width * bpp bytes
+    rs2::frame make( rs2::stream_profile const & profile, std::vector< uint8_t > const & pixels )
+    {
+        auto vsp = profile.as< rs2::video_stream_profile >();
+        return make( profile, pixels, vsp.width() * rs2_format_bpp( profile.format() ) );
+    }
+
+    // A frameset of 'frames', as a syncer would put together
+    static rs2::frameset make_set( std::vector< rs2::frame > const & frames )
+    {
+        rs2::frame_queue q( 1 );
+        rs2::processing_block bundle( [&]( rs2::frame, rs2::frame_source & source )
+                                      { source.frame_ready( source.allocate_composite_frame( frames ) ); } );
+        bundle.start( q );
+        bundle.invoke( frames.front() );
+        rs2::frame set;
+        REQUIRE( q.poll_for_frame( &set ) );
+        return set.as< rs2::frameset >();
+    }
+
+private:
+    static int rs2_format_bpp( rs2_format format )
+    {
+        switch( format )
+        {
+        case RS2_FORMAT_Y8:
+        case RS2_FORMAT_RAW8:
+        case RS2_FORMAT_Y411:
+        case RS2_FORMAT_M420:
+        case RS2_FORMAT_W10:
+            return 1;  // or less: the caller gives the stride
+        case RS2_FORMAT_RGB8:
+        case RS2_FORMAT_BGR8:
+            return 3;
+        case RS2_FORMAT_RGBA8:
+        case RS2_FORMAT_BGRA8:
+        case RS2_FORMAT_DISPARITY32:
+        case RS2_FORMAT_Y12I:
+            return 4;
+        default:
+            return 2;
+        }
+    }
+
+    void start()
+    {
+        if( _started )
+            return;
+        _started = true;
+        for( auto sensor_profiles : { std::make_pair( &_depth_sensor, &_depth_profiles ),
+                                      std::make_pair( &_other_sensor, &_other_profiles ) } )
+        {
+            if( sensor_profiles.second->empty() )
+                continue;
+            sensor_profiles.first->open( *sensor_profiles.second );
+            sensor_profiles.first->start( _queue );
+        }
+    }
+
+    rs2::software_device _dev;
+    rs2::software_sensor _depth_sensor;
+    rs2::software_sensor _other_sensor;
+    std::vector< rs2::stream_profile > _depth_profiles;
+    std::vector< rs2::stream_profile > _other_profiles;
+    rs2::frame_queue _queue{ 1, true };
+    bool _started = false;
+    int _frame_number = 0;
+};
+
+
+// Fixed, pseudo-random content
+//
+// A depth image (in 1 mm units) of a tilted plane with boxes on it, sensor noise, and holes: scattered pixels and
+// blobs, as the filters have to deal with both
+inline std::vector< uint8_t > depth_pixels( int width, int height, unsigned seed = 1 )
+{
+    std::mt19937 gen( seed );
+    std::normal_distribution< float > noise( 0.f, 6.f );
+    std::uniform_int_distribution< int > percent( 0, 99 );
+    std::vector< uint8_t > pixels( size_t( width ) * height * 2 );
+    auto depth = reinterpret_cast< uint16_t * >( pixels.data() );
+    for( int y = 0; y < height; ++y )
+        for( int x = 0; x < width; ++x )
+        {
+            float z = 1500.f + 2.f * x + 3.f * y;
+            if( ( x / 40 + y / 30 ) % 3 == 0 )
+                z -= 400.f;  // a box, with sharp edges to preserve
+            z += noise( gen );
+            bool const hole = percent( gen ) < 5 || ( ( x - width / 3 ) * ( x - width / 3 ) + ( y - height / 2 ) * ( y - height / 2 ) < 150 );
+            *depth++ = hole ? 0 : uint16_t( z );
+        }
+    return pixels;
+}
+
+// Random bytes, e.g. for infrared and color; 'low' and 'high' run over 0 and 255 by the same amount, so the extremes
+// (saturation) show up as well
+inline std::vector< uint8_t > random_bytes( size_t count, unsigned seed = 2, int low = 0, int high = 255 )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > dist( low, high );
+    std::vector< uint8_t > bytes( count );
+    for( auto & b : bytes )
+        b = uint8_t( std::min( 255, std::max( 0, dist( gen ) ) ) );
+    return bytes;
+}
+
+
+// The bytes of a frame, a frameset (one frame after the other, in order) or pointcloud (vertices then texture
+// coordinates), to compare outputs by
+inline std::vector< uint8_t > bytes_of( rs2::frame const & f )
+{
+    std::vector< uint8_t > bytes;
+    auto append = [&]( void const * data, size_t size )
+    {
+        auto p = static_cast< uint8_t const * >( data );
+        bytes.insert( bytes.end(), p, p + size );
+    };
+    auto append_frame = [&]( rs2::frame const & f )
+    {
+        if( auto points = f.as< rs2::points >() )
+        {
+            append( points.get_vertices(), points.size() * sizeof( rs2::vertex ) );
+            append( points.get_texture_coordinates(), points.size() * sizeof( rs2::texture_coordinate ) );
+        }
+        else
+            append( f.get_data(), f.get_data_size() );
+    };
+    if( auto set = f.as< rs2::frameset >() )
+        for( auto && sub : set )
+            append_frame( sub );
+    else if( f )
+        append_frame( f );
+    return bytes;
+}
+
+// Everything the block outputs for 'input', in order (an interleaved converter outputs two frames per input)
+inline std::vector< uint8_t > output_of( rs2::processing_block & block, rs2::frame const & input )
+{
+    rs2::frame_queue q( 8 );
+    block.start( q );
+    block.invoke( input );
+    std::vector< uint8_t > bytes;
+    rs2::frame f;
+    while( q.poll_for_frame( &f ) )
+    {
+        auto b = bytes_of( f );
+        bytes.insert( bytes.end(), b.begin(), b.end() );
+    }
+    return bytes;
+}
+
+// The largest difference between two same-sized buffers, in bytes, or -1 if their sizes differ
+inline int max_difference( std::vector< uint8_t > const & a, std::vector< uint8_t > const & b )
+{
+    if( a.size() != b.size() )
+        return -1;
+    int diff = 0;
+    for( size_t i = 0; i < a.size(); ++i )
+        diff = std::max( diff, std::abs( int( a[i] ) - int( b[i] ) ) );
+    return diff;
+}
+
+
+// Caps the SIMD kernels of all processing blocks, through the "simd-level" context setting: "none", "simd128" or
+// "auto" for whatever the CPU has
+inline void set_simd_level( std::string const & level )
+{
+    rs2::context ctx( "{ \"simd-level\": \"" + level + "\", \"processing-threads\": 3 }" );
+}
+
+// Runs 'input' through a new block from 'make' with the SIMD kernels forced off and with whatever the CPU has, and
+// with 1 thread and several (if the block has RS2_OPTION_PROCESSING_THREADS), and checks the outputs are the same.
+//
+// Blocks whose generic code is known to round differently from their SIMD code get a 'generic_tolerance': the output
+// without SIMD may then be off by that much per byte, while all the SIMD outputs still have to be identical.
+//
+// 'make' returns the block by value, as its own type: rs2::processing_block would take a filter converted to it for a
+// processing function.
+template< class MAKE >
+void check_same_output( MAKE && make, rs2::frame const & input, int generic_tolerance = 0 )
+{
+    std::vector< uint8_t > generic, simd;
+    for( auto level : { "none", "simd128", "auto" } )
+    {
+        set_simd_level( level );
+        for( int threads : { 1, 4 } )
+        {
+            auto made = make();
+            rs2::processing_block & block = made;
+            if( threads > 1 )
+            {
+                if( ! block.supports( RS2_OPTION_PROCESSING_THREADS ) )
+                    continue;
+                auto const range = block.get_option_range( RS2_OPTION_PROCESSING_THREADS );
+                block.set_option( RS2_OPTION_PROCESSING_THREADS, std::min( float( threads ), range.max ) );
+            }
+            auto const output = output_of( block, input );
+            INFO( "SIMD level " << level << ", " << threads << " thread(s)" );
+            REQUIRE( ! output.empty() );
+            if( generic.empty() )
+                generic = output;
+            else if( std::string( level ) == "none" )
+                CHECK( max_difference( output, generic ) == 0 );
+            else
+            {
+                CHECK( max_difference( output, generic ) >= 0 );
+                CHECK( max_difference( output, generic ) <= generic_tolerance );
+                if( simd.empty() )
+                    simd = output;
+                else
+                    CHECK( max_difference( output, simd ) == 0 );
+            }
+        }
+    }
+    set_simd_level( "auto" );
+}
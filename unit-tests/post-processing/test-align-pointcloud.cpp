@@ -0,0 +1,122 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "sw-frames.h"
+
+
+// Align and pointcloud split their rows between threads and, with a texture, run the occlusion filter over them: the
+// result has to be the same whatever the thread count. So does aligning to several streams at once, against aligning
+// to each on its own.
+
+
+namespace {
+
+// Depth with a color camera 5 cm to its right and an infrared one 5 cm to its left, with other sizes and focal
+// lengths, so pixels get spread, merged and occluded
+struct stereo_input
+{
+    sw_frames sw;
+    rs2::frameset set;
+
+    stereo_input()
+    {
+        auto depth = sw.add_stream( RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, 637, 359, 2 );
+        auto ir = sw.add_stream( RS2_STREAM_INFRARED, 1, RS2_FORMAT_Y8, 424, 240, 1, 250.f );
+        auto color = sw.add_stream( RS2_STREAM_COLOR, 0, RS2_FORMAT_RGB8, 853, 479, 3, 610.f );
+        sw_frames::set_extrinsics( depth, color, 0.05f );
+        sw_frames::set_extrinsics( depth, ir, -0.05f );
+        set = sw_frames::make_set( { sw.make( depth, depth_pixels( 637, 359 ) ),
+                                     sw.make( ir, random_bytes( 424 * 240 ) ),
+                                     sw.make( color, random_bytes( 853 * 479 * 3 ) ) } );
+    }
+};
+
+// The depth frames in the output of align that have the size of 'to', in order
+std::vector< uint8_t > aligned_depth( rs2::processing_block & align, rs2::frameset const & input,
+                                      std::vector< rs2_stream > const & to )
+{
+    rs2::frame_queue q( 4 );
+    align.start( q );
+    align.invoke( input );
+    rs2::frame output;
+    REQUIRE( q.poll_for_frame( &output ) );
+    auto set = output.as< rs2::frameset >();
+    REQUIRE( set );
+
+    std::vector< uint8_t > bytes;
+    for( auto stream : to )
+    {
+        auto target = input.first( stream ).as< rs2::video_frame >();
+        bool found = false;
+        for( auto && f : set )
+        {
+            auto vf = f.as< rs2::video_frame >();
+            if( f.get_profile().stream_type() != RS2_STREAM_DEPTH || vf.get_width() != target.get_width()
+                || vf.get_height() != target.get_height() )
+                continue;
+            auto b = bytes_of( f );
+            bytes.insert( bytes.end(), b.begin(), b.end() );
+            found = true;
+            break;
+        }
+        CHECK( found );
+    }
+    return bytes;
+}
+
+}  // namespace
+
+
+TEST_CASE( "align: same output with and without SIMD and threads", "[post-processing]" )
+{
+    stereo_input in;
+    for( auto to : { RS2_STREAM_COLOR, RS2_STREAM_INFRARED, RS2_STREAM_DEPTH } )
+    {
+        INFO( "align to " << rs2_stream_to_string( to ) );
+        check_same_output( [=] { return rs2::align( to ); }, in.set );
+    }
+}
+
+TEST_CASE( "align to several streams: same output as one at a time", "[post-processing]" )
+{
+    stereo_input in;
+    std::vector< rs2_stream > const targets = { RS2_STREAM_COLOR, RS2_STREAM_INFRARED };
+
+    std::vector< uint8_t > separate;
+    for( auto to : targets )
+    {
+        rs2::align align( to );
+        auto b = aligned_depth( align, in.set, { to } );
+        separate.insert( separate.end(), b.begin(), b.end() );
+    }
+
+    for( int threads : { 1, 4 } )
+    {
+        INFO( threads << " thread(s)" );
+        rs2::align align( targets );
+        if( threads > 1 && align.supports( RS2_OPTION_PROCESSING_THREADS ) )
+            align.set_option( RS2_OPTION_PROCESSING_THREADS,
+                              std::min( float( threads ), align.get_option_range( RS2_OPTION_PROCESSING_THREADS ).max ) );
+        CHECK( max_difference( aligned_depth( align, in.set, targets ), separate ) == 0 );
+    }
+}
+
+TEST_CASE( "pointcloud: same output with and without SIMD and threads", "[post-processing]" )
+{
+    stereo_input in;
+    for( float occlusion : { 1.f, 2.f } )
+    {
+        INFO( "occlusion filter " << ( occlusion > 1 ? "on" : "off" ) );
+        auto make = [=]
+        {
+            rs2::pointcloud pc( RS2_STREAM_COLOR );
+            pc.set_option( RS2_OPTION_STREAM_FORMAT_FILTER, float( RS2_FORMAT_RGB8 ) );
+            pc.set_option( RS2_OPTION_FILTER_MAGNITUDE, occlusion );
+            return pc;
+        };
+        check_same_output( make, in.set );
+    }
+
+    // Without a texture, the points alone
+    check_same_output( [] { return rs2::pointcloud(); }, in.set.get_depth_frame() );
+}
@@ -0,0 +1,61 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "sw-frames.h"
+
+
+// The colorizer's table lookups and row splitting have to color every pixel the same, whatever the thread count, for
+// every input it takes: 16-bit depth (through the table) and disparity (per pixel)
+
+
+TEST_CASE( "colorizer: same output with and without SIMD and threads", "[post-processing]" )
+{
+    sw_frames sw;
+    auto profile = sw.add_stream( RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, 637, 359, 2 );
+    auto depth = sw.make( profile, depth_pixels( 637, 359 ) );
+    rs2::disparity_transform to_disparity( true );
+    rs2::frame disparity = to_disparity.process( depth );
+
+    for( float format : { float( RS2_FORMAT_RGB8 ), float( RS2_FORMAT_RGBA8 ) } )
+        for( float equalize : { 0.f, 1.f } )
+            for( float scheme : { 0.f, 2.f, 9.f } )
+            {
+                INFO( "format " << rs2_format_to_string( rs2_format( int( format ) ) ) << ", histogram equalization "
+                                << equalize << ", color scheme " << scheme );
+                auto make = [=]
+                {
+                    rs2::colorizer colorizer( scheme );
+                    colorizer.set_option( RS2_OPTION_OUTPUT_FORMAT, format );
+                    colorizer.set_option( RS2_OPTION_HISTOGRAM_EQUALIZATION_ENABLED, equalize );
+                    if( ! equalize )
+                    {
+                        colorizer.set_option( RS2_OPTION_MIN_DISTANCE, 1.1f );
+                        colorizer.set_option( RS2_OPTION_MAX_DISTANCE, 3.3f );
+                    }
+                    return colorizer;
+                };
+                check_same_output( make, depth );
+                check_same_output( make, disparity );
+            }
+}
+
+// A cached table must not outlive what it was built from
+TEST_CASE( "colorizer: same output after a range change", "[post-processing]" )
+{
+    sw_frames sw;
+    auto profile = sw.add_stream( RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, 640, 480, 2 );
+    auto depth = sw.make( profile, depth_pixels( 640, 480 ) );
+
+    rs2::colorizer fresh;
+    fresh.set_option( RS2_OPTION_HISTOGRAM_EQUALIZATION_ENABLED, 0.f );
+    fresh.set_option( RS2_OPTION_MIN_DISTANCE, 1.f );
+    fresh.set_option( RS2_OPTION_MAX_DISTANCE, 2.f );
+
+    rs2::colorizer reused;
+    reused.set_option( RS2_OPTION_HISTOGRAM_EQUALIZATION_ENABLED, 0.f );
+    output_of( reused, depth );
+    reused.set_option( RS2_OPTION_MIN_DISTANCE, 1.f );
+    reused.set_option( RS2_OPTION_MAX_DISTANCE, 2.f );
+
+    CHECK( max_difference( output_of( reused, depth ), output_of( fresh, depth ) ) == 0 );
+}
@@ -0,0 +1,155 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "sw-frames.h"
+
+#include <cmath>
+#include <cstring>
+
+
+// The SIMD and multi-threaded paths of the depth filters have to output exactly what their generic, single-threaded
+// code does: each filter gets the same frame with the kernels forced off ("simd-level" none) and on, with 1 thread and
+// more, and the outputs are compared byte for byte.
+//
+// The sizes are not multiples of the vector widths (nor of the decimation scales), so the tails run as well.
+
+
+namespace {
+
+struct depth_input
+{
+    sw_frames sw;
+    rs2::stream_profile profile;
+    rs2::frame depth;
+
+    depth_input( int width, int height )
+    {
+        profile = sw.add_stream( RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, width, height, 2 );
+        depth = sw.make( profile, depth_pixels( width, height ) );
+    }
+
+    rs2::frame disparity( bool fixed_point )
+    {
+        rs2::disparity_transform to_disparity( true );
+        to_disparity.set_option( RS2_OPTION_FIXED_POINT_DISPARITY, fixed_point ? 1.f : 0.f );
+        rs2::frame disparity = to_disparity.process( depth );
+        REQUIRE( disparity.get_profile().format() == ( fixed_point ? RS2_FORMAT_DISPARITY16 : RS2_FORMAT_DISPARITY32 ) );
+        return disparity;
+    }
+};
+
+// Outputs of the transform to disparity, with and without its SIMD kernels
+void disparity_outputs( rs2::frame const & depth, bool fixed_point, std::vector< uint8_t > & generic,
+                        std::vector< uint8_t > & simd )
+{
+    for( auto output : { &generic, &simd } )
+    {
+        set_simd_level( output == &generic ? "none" : "auto" );
+        rs2::disparity_transform to_disparity( true );
+        to_disparity.set_option( RS2_OPTION_FIXED_POINT_DISPARITY, fixed_point ? 1.f : 0.f );
+        *output = output_of( to_disparity, depth );
+    }
+    set_simd_level( "auto" );
+    REQUIRE( generic.size() == simd.size() );
+}
+
+}  // namespace
+
+
+TEST_CASE( "spatial filter: same output with and without SIMD and threads", "[post-processing]" )
+{
+    for( auto size : { std::make_pair( 640, 480 ), std::make_pair( 637, 359 ) } )
+    {
+        depth_input in( size.first, size.second );
+        INFO( size.first << "x" << size.second );
+        for( float hole_fill : { 0.f, 2.f, 5.f } )
+        {
+            INFO( "holes fill " << hole_fill );
+            auto make = [=] { return rs2::spatial_filter( 0.5f, 20.f, 2.f, hole_fill ); };
+            check_same_output( make, in.depth );
+            check_same_output( make, in.disparity( false ) );
+            check_same_output( make, in.disparity( true ) );
+        }
+    }
+}
+
+TEST_CASE( "decimation filter: same output with and without SIMD and threads", "[post-processing]" )
+{
+    for( auto size : { std::make_pair( 640, 480 ), std::make_pair( 637, 359 ) } )
+    {
+        depth_input in( size.first, size.second );
+        INFO( size.first << "x" << size.second );
+        for( float scale : { 2.f, 3.f, 4.f, 5.f } )
+        {
+            INFO( "scale " << scale );
+            check_same_output( [=] { return rs2::decimation_filter( scale ); }, in.depth );
+        }
+    }
+}
+
+TEST_CASE( "hole filling filter: same output with and without SIMD and threads", "[post-processing]" )
+{
+    for( auto size : { std::make_pair( 640, 480 ), std::make_pair( 637, 359 ) } )
+    {
+        depth_input in( size.first, size.second );
+        INFO( size.first << "x" << size.second );
+        for( int mode : { 0, 1, 2 } )
+        {
+            INFO( "mode " << mode );
+            auto make = [=] { return rs2::hole_filling_filter( mode ); };
+            check_same_output( make, in.depth );
+            check_same_output( make, in.disparity( false ) );
+            check_same_output( make, in.disparity( true ) );
+        }
+    }
+}
+
+TEST_CASE( "threshold and units: same output with and without SIMD", "[post-processing]" )
+{
+    depth_input in( 637, 359 );
+    check_same_output( [] { return rs2::threshold_filter( 1.2f, 2.9f ); }, in.depth );
+    check_same_output( [] { return rs2::units_transform(); }, in.depth );
+}
+
+TEST_CASE( "disparity to depth: same output with and without SIMD", "[post-processing]" )
+{
+    depth_input in( 637, 359 );
+    auto make = [] { return rs2::disparity_transform( false ); };
+    check_same_output( make, in.disparity( false ) );
+    check_same_output( make, in.disparity( true ) );
+}
+
+// The SIMD kernel takes an approximate reciprocal (refined to within 2.5e-7 of the division) rather than dividing
+TEST_CASE( "depth to disparity: SIMD within the reciprocal's precision", "[post-processing]" )
+{
+    depth_input in( 637, 359 );
+
+    std::vector< uint8_t > generic, simd;
+    disparity_outputs( in.depth, false, generic, simd );
+    auto const n = generic.size() / sizeof( float );
+    int off = 0;
+    for( size_t i = 0; i < n; ++i )
+    {
+        float g, s;
+        std::memcpy( &g, generic.data() + i * sizeof( float ), sizeof( float ) );
+        std::memcpy( &s, simd.data() + i * sizeof( float ), sizeof( float ) );
+        if( std::abs( g - s ) > 2.5e-7f * std::abs( g ) )
+            ++off;
+    }
+    CHECK( off == 0 );
+
+    // Rounded to 1/32 pixel, the result may only land on the other side of a half
+    disparity_outputs( in.depth, true, generic, simd );
+    CHECK( max_difference( generic, simd ) >= 0 );
+    auto const count = generic.size() / sizeof( uint16_t );
+    off = 0;
+    for( size_t i = 0; i < count; ++i )
+    {
+        uint16_t g, s;
+        std::memcpy( &g, generic.data() + i * sizeof( uint16_t ), sizeof( uint16_t ) );
+        std::memcpy( &s, simd.data() + i * sizeof( uint16_t ), sizeof( uint16_t ) );
+        if( std::abs( int( g ) - int( s ) ) > 1 )
+            ++off;
+    }
+    CHECK( off == 0 );
+}
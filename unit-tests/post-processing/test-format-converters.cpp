@@ -0,0 +1,187 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <src/proc/synthetic-stream.h>
+#include <src/proc/color-formats-converter.h>
+#include <src/proc/depth-formats-converter.h>
+#include <src/proc/y411-converter.h>
+#include <src/proc/rotation-transform.h>
+#include <src/proc/y8i-to-y8y8.h>
+#include <src/proc/y12i-to-y16y16.h>
+
+#include "sw-frames.h"
+
+using namespace librealsense;
+
+
+// The format converters' SIMD and multi-threaded paths have to output what their generic code does. Only the
+// conversions of YUV to RGB round differently: the SSE and AVX2 kernels the NEON ones follow truncate each product,
+// where the generic code rounds the sum, so a channel may be off by up to 2 there. Their outputs must still be the same
+// at every SIMD level, and at any thread count.
+//
+// The sizes are not multiples of the vector widths, so the tails run as well.
+
+
+namespace {
+
+int const yuv_to_rgb_tolerance = 2;
+
+// The converters are not public: wrap them as the API does
+template< class T, class... ARGS >
+rs2::processing_block make_block( ARGS... args )
+{
+    std::shared_ptr< processing_block_interface > block = std::make_shared< T >( args... );
+    return rs2::processing_block(
+        std::shared_ptr< rs2_processing_block >( new rs2_processing_block( block ), rs2_delete_processing_block ) );
+}
+
+std::vector< rs2_format > const rgb_formats
+    = { RS2_FORMAT_RGB8, RS2_FORMAT_BGR8, RS2_FORMAT_RGBA8, RS2_FORMAT_BGRA8 };
+
+int tolerance_for( rs2_format target )
+{
+    return target == RS2_FORMAT_Y8 || target == RS2_FORMAT_Y16 ? 0 : yuv_to_rgb_tolerance;
+}
+
+}  // namespace
+
+
+TEST_CASE( "YUY2, UYVY and M420 converters: same output with and without SIMD", "[post-processing]" )
+{
+    for( auto size : { std::make_pair( 640, 480 ), std::make_pair( 642, 358 ) } )
+    {
+        int const w = size.first, h = size.second;
+        INFO( w << "x" << h );
+        sw_frames sw;
+        auto yuyv = sw.add_stream( RS2_STREAM_COLOR, 0, RS2_FORMAT_YUYV, w, h, 2 );
+        auto uyvy = sw.add_stream( RS2_STREAM_COLOR, 1, RS2_FORMAT_UYVY, w, h, 2 );
+        auto m420 = sw.add_stream( RS2_STREAM_COLOR, 2, RS2_FORMAT_M420, w, h, 1 );
+        auto yuyv_frame = sw.make( yuyv, random_bytes( size_t( w ) * h * 2, 3 ) );
+        auto uyvy_frame = sw.make( uyvy, random_bytes( size_t( w ) * h * 2, 4 ) );
+        auto m420_frame = sw.make( m420, random_bytes( size_t( w ) * h * 3 / 2, 5 ), w );
+
+        auto yuv_targets = rgb_formats;
+        yuv_targets.push_back( RS2_FORMAT_Y8 );
+        yuv_targets.push_back( RS2_FORMAT_Y16 );
+        for( auto target : yuv_targets )
+        {
+            INFO( "YUY2 to " << rs2_format_to_string( target ) );
+            check_same_output( [=] { return make_block< yuy2_converter >( target ); }, yuyv_frame,
+                               tolerance_for( target ) );
+        }
+        for( auto target : rgb_formats )
+        {
+            INFO( "UYVY to " << rs2_format_to_string( target ) );
+            check_same_output( [=] { return make_block< uyvy_converter >( target, RS2_STREAM_COLOR ); }, uyvy_frame,
+                               tolerance_for( target ) );
+        }
+        for( auto target : yuv_targets )
+        {
+            INFO( "M420 to " << rs2_format_to_string( target ) );
+            check_same_output( [=] { return make_block< m420_converter >( target ); }, m420_frame,
+                               tolerance_for( target ) );
+        }
+    }
+}
+
+TEST_CASE( "Y411 converter: same output with and without SIMD and threads", "[post-processing]" )
+{
+    // Y411 frames are a multiple of 32 pixels, and converted two rows at a time
+    for( auto size : { std::make_pair( 640, 480 ), std::make_pair( 96, 34 ) } )
+    {
+        int const w = size.first, h = size.second;
+        INFO( w << "x" << h );
+        sw_frames sw;
+        auto y411 = sw.add_stream( RS2_STREAM_COLOR, 0, RS2_FORMAT_Y411, w, h, 1 );
+        auto frame = sw.make( y411, random_bytes( size_t( w ) * h * 3 / 2, 6 ), w * 3 / 2 );
+        check_same_output( [] { return make_block< y411_converter >( RS2_FORMAT_RGB8 ); }, frame,
+                           yuv_to_rgb_tolerance );
+    }
+}
+
+TEST_CASE( "W10 converter: same output with and without SIMD and threads", "[post-processing]" )
+{
+    // Rows are only split between threads when they are whole 5-byte blocks
+    for( auto size : { std::make_pair( 640, 480 ), std::make_pair( 644, 359 ), std::make_pair( 638, 7 ) } )
+    {
+        int const w = size.first, h = size.second;
+        INFO( w << "x" << h );
+        sw_frames sw;
+        auto w10 = sw.add_stream( RS2_STREAM_INFRARED, 1, RS2_FORMAT_W10, w, h, 1 );
+        auto frame = sw.make( w10, random_bytes( size_t( w ) * h * 5 / 4 + 5, 7 ), w * 5 / 4 );
+        check_same_output( [] { return make_block< w10_converter >( RS2_FORMAT_Y10BPACK ); }, frame );
+    }
+}
+
+TEST_CASE( "rotation: same output with and without SIMD", "[post-processing]" )
+{
+    for( auto size : { std::make_pair( 640, 480 ), std::make_pair( 637, 358 ) } )
+    {
+        int const w = size.first, h = size.second;
+        INFO( w << "x" << h );
+        sw_frames sw;
+        auto z16 = sw.add_stream( RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, w, h, 2 );
+        auto y8 = sw.add_stream( RS2_STREAM_INFRARED, 1, RS2_FORMAT_Y8, w, h, 1 );
+        auto rgb = sw.add_stream( RS2_STREAM_COLOR, 0, RS2_FORMAT_RGB8, w, h, 3 );
+        auto confidence = sw.add_stream( RS2_STREAM_CONFIDENCE, 0, RS2_FORMAT_RAW8, w, h, 1 );
+
+        check_same_output(
+            [] { return make_block< rotation_transform >( RS2_FORMAT_Z16, RS2_STREAM_DEPTH, RS2_EXTENSION_DEPTH_FRAME ); },
+            sw.make( z16, depth_pixels( w, h ) ) );
+        check_same_output(
+            [] { return make_block< rotation_transform >( RS2_FORMAT_Y8, RS2_STREAM_INFRARED, RS2_EXTENSION_VIDEO_FRAME ); },
+            sw.make( y8, random_bytes( size_t( w ) * h, 8 ) ) );
+        check_same_output(
+            [] { return make_block< rotation_transform >( RS2_FORMAT_RGB8, RS2_STREAM_COLOR, RS2_EXTENSION_VIDEO_FRAME ); },
+            sw.make( rgb, random_bytes( size_t( w ) * h * 3, 9 ) ) );
+        check_same_output( [] { return make_block< confidence_rotation_transform >(); },
+                           sw.make( confidence, random_bytes( size_t( w ) * h, 10 ) ) );
+    }
+}
+
+// Decimating while deinterleaving has to give what deinterleaving, then decimating each side, does
+TEST_CASE( "Y8I and Y12I deinterleaving: decimated as by the decimation filter", "[post-processing]" )
+{
+    for( auto size : { std::make_pair( 640, 480 ), std::make_pair( 637, 359 ) } )
+    {
+        int const w = size.first, h = size.second;
+        INFO( w << "x" << h );
+        sw_frames sw;
+        auto y8i = sw.add_stream( RS2_STREAM_INFRARED, 0, RS2_FORMAT_Y8I, w, h, 2 );
+        auto y12i = sw.add_stream( RS2_STREAM_INFRARED, 3, RS2_FORMAT_Y12I, w, h, 3 );
+        auto y8i_frame = sw.make( y8i, random_bytes( size_t( w ) * h * 2, 11 ) );
+        auto y12i_frame = sw.make( y12i, random_bytes( size_t( w ) * h * 3, 12 ), w * 3 );
+
+        for( int scale : { 2, 3, 4, 5, 8 } )
+        {
+            INFO( "scale " << scale );
+            for( auto input : { y8i_frame, y12i_frame } )
+            {
+                bool const y8 = input.get_profile().format() == RS2_FORMAT_Y8I;
+                auto block = y8 ? make_block< y8i_to_y8y8 >() : make_block< y12i_to_y16y16 >();
+                INFO( rs2_format_to_string( input.get_profile().format() ) );
+
+                // Both sides, deinterleaved in full, then decimated
+                rs2::frame_queue q( 2 );
+                block.start( q );
+                block.invoke( input );
+                std::vector< uint8_t > expected;
+                rs2::frame side;
+                int sides = 0;
+                while( q.poll_for_frame( &side ) )
+                {
+                    ++sides;
+                    rs2::decimation_filter decimate{ float( scale ) };
+                    auto b = output_of( decimate, side );
+                    expected.insert( expected.end(), b.begin(), b.end() );
+                }
+                REQUIRE( sides == 2 );
+
+                block.set_option( RS2_OPTION_FILTER_MAGNITUDE, float( scale ) );
+                CHECK( max_difference( output_of( block, input ), expected ) == 0 );
+            }
+        }
+    }
+}
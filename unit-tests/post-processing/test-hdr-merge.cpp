@@ -0,0 +1,140 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "sw-frames.h"
+
+#include <algorithm>
+
+
+// The HDR merge's kernels are chosen at compile time, so rather than with and without SIMD, their output is checked
+// against the merge rule, pixel by pixel: each pixel comes from the sub-frame whose IR was the furthest from saturation
+// there (the first of them on a tie), and without IR from the first sub-frame with depth there.
+//
+// The frame sizes leave a tail after the last full vector.
+
+
+namespace {
+
+struct sequence
+{
+    std::vector< std::vector< uint8_t > > depth;  // Z16
+    std::vector< std::vector< uint8_t > > ir;     // Y8 or Y16; none to merge by depth alone
+};
+
+int confidence( sequence const & seq, bool y16, size_t frame, size_t i )
+{
+    int margin;
+    if( y16 )
+    {
+        auto const v = reinterpret_cast< uint16_t const * >( seq.ir[frame].data() )[i];
+        margin = std::min( int( v ) - 20, 1003 - int( v ) );
+    }
+    else
+    {
+        auto const v = seq.ir[frame][i];
+        margin = 4 * std::min( int( v ) - 5, 250 - int( v ) );
+    }
+    return std::max( 0, margin );
+}
+
+std::vector< uint8_t > expected_merge( sequence const & seq, bool y16, size_t pixels )
+{
+    std::vector< uint8_t > bytes( pixels * 2, 0 );
+    auto merged = reinterpret_cast< uint16_t * >( bytes.data() );
+    std::vector< int > best( pixels, 0 );
+    for( size_t frame = 0; frame < seq.depth.size(); ++frame )
+    {
+        auto depth = reinterpret_cast< uint16_t const * >( seq.depth[frame].data() );
+        for( size_t i = 0; i < pixels; ++i )
+        {
+            int const c = ! depth[i] ? 0 : seq.ir.empty() ? 1 : confidence( seq, y16, frame, i );
+            if( c > best[i] )
+            {
+                merged[i] = depth[i];
+                best[i] = c;
+            }
+        }
+    }
+    return bytes;
+}
+
+// The merge hdr_merge outputs once the whole sequence is in
+std::vector< uint8_t > merge( sequence const & seq, bool y16, int width, int height )
+{
+    sw_frames sw;
+    auto depth_profile = sw.add_stream( RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16, width, height, 2 );
+    auto ir_profile = sw.add_stream( RS2_STREAM_INFRARED, 1, y16 ? RS2_FORMAT_Y16 : RS2_FORMAT_Y8, width, height,
+                                     y16 ? 2 : 1 );
+    rs2::hdr_merge hdr;
+    rs2::frame output;
+    auto const size = seq.depth.size();
+    for( size_t id = 0; id < size; ++id )
+    {
+        sw.set_metadata( RS2_FRAME_METADATA_FRAME_COUNTER, rs2_metadata_type( 100 + id ) );
+        sw.set_metadata( RS2_FRAME_METADATA_SEQUENCE_ID, rs2_metadata_type( id ) );
+        sw.set_metadata( RS2_FRAME_METADATA_SEQUENCE_SIZE, rs2_metadata_type( size ) );
+        std::vector< rs2::frame > frames = { sw.make( depth_profile, seq.depth[id] ) };
+        if( ! seq.ir.empty() )
+            frames.push_back( sw.make( ir_profile, seq.ir[id] ) );
+        output = hdr.process( sw_frames::make_set( frames ) );
+    }
+    if( auto set = output.as< rs2::frameset >() )
+        output = set.get_depth_frame();
+    REQUIRE( output );
+    REQUIRE( output.get_profile().format() == RS2_FORMAT_Z16 );
+    return bytes_of( output );
+}
+
+sequence make_sequence( size_t size, bool with_ir, bool y16, int width, int height )
+{
+    sequence seq;
+    size_t const pixels = size_t( width ) * height;
+    for( unsigned n = 0; n < size; ++n )
+    {
+        seq.depth.push_back( depth_pixels( width, height, 10 + n ) );
+        if( ! with_ir )
+            continue;
+        if( ! y16 )
+            // Past both saturation limits, and a few ties
+            seq.ir.push_back( random_bytes( pixels, 20 + n, -10, 265 ) );
+        else
+        {
+            // 10-bit values past both limits, and some with the high bit set, which are invalid too
+            auto bytes = random_bytes( pixels * 2, 20 + n );
+            auto ir = reinterpret_cast< uint16_t * >( bytes.data() );
+            for( size_t i = 0; i < pixels; ++i )
+                ir[i] = ( i % 97 == 0 ) ? uint16_t( 0x8000 | ir[i] ) : uint16_t( ir[i] % 1100 );
+            seq.ir.push_back( bytes );
+        }
+    }
+    return seq;
+}
+
+}  // namespace
+
+
+TEST_CASE( "hdr merge: each pixel from the sub-frame with the best IR", "[post-processing]" )
+{
+    for( auto dims : { std::make_pair( 100, 7 ), std::make_pair( 637, 359 ) } )
+        for( size_t size : { 2, 3, 4 } )
+            for( bool y16 : { false, true } )
+            {
+                INFO( dims.first << "x" << dims.second << ", " << size << " sub-frames, IR "
+                                 << ( y16 ? "Y16" : "Y8" ) );
+                auto seq = make_sequence( size, true, y16, dims.first, dims.second );
+                auto const expected = expected_merge( seq, y16, size_t( dims.first ) * dims.second );
+                CHECK( max_difference( merge( seq, y16, dims.first, dims.second ), expected ) == 0 );
+            }
+}
+
+TEST_CASE( "hdr merge: without IR, each pixel from the first sub-frame with depth", "[post-processing]" )
+{
+    for( auto dims : { std::make_pair( 100, 7 ), std::make_pair( 637, 359 ) } )
+        for( size_t size : { 2, 4 } )
+        {
+            INFO( dims.first << "x" << dims.second << ", " << size << " sub-frames" );
+            auto seq = make_sequence( size, false, false, dims.first, dims.second );
+            auto const expected = expected_merge( seq, false, size_t( dims.first ) * dims.second );
+            CHECK( max_difference( merge( seq, false, dims.first, dims.second ), expected ) == 0 );
+        }
+}
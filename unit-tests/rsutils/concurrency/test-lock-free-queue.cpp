@@ -0,0 +1,93 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/time/timer.h>
+#include <rsutils/concurrency/concurrency.h>
+
+#include <thread>
+#include <vector>
+
+using namespace rsutils::time;
+
+
+TEST_CASE( "enqueue drops the oldest when full" )
+{
+    lock_free_single_consumer_queue< int > q( 3 );
+    for( int i = 0; i < 5; ++i )
+        q.enqueue( int( i ) );
+    REQUIRE( q.size() == 3 );
+
+    int i;
+    REQUIRE( q.try_dequeue( &i ) );
+    CHECK( i == 2 );
+    REQUIRE( q.try_dequeue( &i ) );
+    CHECK( i == 3 );
+    REQUIRE( q.try_dequeue( &i ) );
+    CHECK( i == 4 );
+    REQUIRE_FALSE( q.try_dequeue( &i ) );
+    REQUIRE( q.empty() );
+}
+
+
+TEST_CASE( "lock-free dequeue waits when empty, not after stop" )
+{
+    lock_free_single_consumer_queue< int > q;
+    int i;
+
+    timer t( std::chrono::milliseconds( 190 ) );
+    t.start();
+    REQUIRE_FALSE( q.dequeue( &i, 200 ) );
+    REQUIRE( t.has_expired() );
+
+    std::thread producer( [&]() {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+        q.enqueue( 42 );
+    } );
+    REQUIRE( q.dequeue( &i, 3000 ) );
+    CHECK( i == 42 );
+    producer.join();
+
+    std::thread stopper( [&]() {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+        q.stop();
+    } );
+    timer t2( std::chrono::seconds( 1 ) );
+    t2.start();
+    REQUIRE_FALSE( q.dequeue( &i, 3000 ) );
+    REQUIRE_FALSE( t2.has_expired() );
+    stopper.join();
+    REQUIRE( q.stopped() );
+}
+
+
+TEST_CASE( "lock-free queue keeps each producer's order" )
+{
+    int const n_producers = 4;
+    int const n_items = 20000;
+    lock_free_single_consumer_queue< int > q( n_producers * n_items );  // nothing gets dropped
+
+    std::vector< std::thread > producers;
+    for( int p = 0; p < n_producers; ++p )
+        producers.emplace_back( [&q, p, n_items]() {
+            for( int i = 0; i < n_items; ++i )
+                q.enqueue( p * n_items + i );
+        } );
+
+    std::vector< int > last( n_producers, -1 );
+    int count = 0;
+    int item;
+    while( count < n_producers * n_items && q.dequeue( &item, 3000 ) )
+    {
+        int const p = item / n_items;
+        int const i = item % n_items;
+        REQUIRE( i == last[p] + 1 );
+        last[p] = i;
+        ++count;
+    }
+    for( auto & t : producers )
+        t.join();
+    CHECK( count == n_producers * n_items );
+}
@@ -0,0 +1,68 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/concurrency/seqlock.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using rsutils::concurrency::seqlock;
+
+
+namespace {
+
+struct triplet
+{
+    double a, b;
+    int c;
+};
+
+}  // namespace
+
+
+TEST_CASE( "load returns what was stored" )
+{
+    seqlock< triplet > s( { 1., 2., 3 } );
+    auto t = s.load();
+    CHECK( t.a == 1. );
+    CHECK( t.b == 2. );
+    CHECK( t.c == 3 );
+
+    s.store( { 4., 5., 6 } );
+    t = s.load();
+    CHECK( t.a == 4. );
+    CHECK( t.b == 5. );
+    CHECK( t.c == 6 );
+}
+
+
+TEST_CASE( "readers never see a torn value" )
+{
+    seqlock< triplet > s( { 0., 0., 0 } );
+    std::atomic< bool > done( false );
+    std::atomic< int > torn( 0 );
+
+    std::vector< std::thread > readers;
+    for( int r = 0; r < 3; ++r )
+        readers.emplace_back( [&]() {
+            while( ! done )
+            {
+                auto const t = s.load();
+                if( t.b != 2 * t.a || t.c != int( t.a ) )
+                    ++torn;
+            }
+        } );
+
+    for( int i = 1; i <= 200000; ++i )
+        s.store( { double( i ), 2. * i, i } );
+    done = true;
+    for( auto & reader : readers )
+        reader.join();
+
+    CHECK( torn == 0 );
+    CHECK( s.load().c == 200000 );
+}
@@ -0,0 +1,95 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/concurrency/timer-wheel.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using rsutils::concurrency::timer_wheel;
+using std::chrono::milliseconds;
+
+
+TEST_CASE( "timer_wheel runs tasks periodically" )
+{
+    timer_wheel wheel( 2 );
+    std::atomic< int > runs( 0 );
+    auto id = wheel.add( [&]() { ++runs; }, milliseconds( 50 ), false );
+    std::this_thread::sleep_for( milliseconds( 525 ) );
+    wheel.remove( id );
+    int const after_remove = runs;
+    CHECK( after_remove >= 8 );
+    CHECK( after_remove <= 12 );
+
+    // Nothing runs once removed
+    std::this_thread::sleep_for( milliseconds( 150 ) );
+    CHECK( runs == after_remove );
+    CHECK( wheel.size() == 0 );
+}
+
+TEST_CASE( "timer_wheel starts at most one task per tick" )
+{
+    timer_wheel wheel( 4, milliseconds( 10 ) );
+    std::mutex m;
+    std::vector< std::chrono::steady_clock::time_point > starts;
+    std::vector< timer_wheel::task_id > ids;
+    for( int i = 0; i < 5; ++i )
+        ids.push_back( wheel.add(
+            [&]()
+            {
+                std::lock_guard< std::mutex > lock( m );
+                starts.push_back( std::chrono::steady_clock::now() );
+            },
+            milliseconds( 1000 ),
+            false ) );
+    std::this_thread::sleep_for( milliseconds( 200 ) );
+    for( auto id : ids )
+        wheel.remove( id );
+
+    // All were due on the same tick, but go out one after the other
+    REQUIRE( starts.size() == 5 );
+    for( size_t i = 1; i < starts.size(); ++i )
+        CHECK( starts[i] - starts[i - 1] >= milliseconds( 5 ) );
+}
+
+TEST_CASE( "timer_wheel task can remove itself" )
+{
+    timer_wheel wheel( 1 );
+    std::atomic< int > runs( 0 );
+    std::atomic< timer_wheel::task_id > id( 0 );
+    id = wheel.add(
+        [&]()
+        {
+            if( ++runs == 3 )
+                wheel.remove( id );
+        },
+        milliseconds( 20 ),
+        false );
+    std::this_thread::sleep_for( milliseconds( 300 ) );
+    CHECK( runs == 3 );
+    CHECK( wheel.size() == 0 );
+}
+
+TEST_CASE( "timer_wheel remove waits for a running task" )
+{
+    timer_wheel wheel( 1 );
+    std::atomic< bool > running( false ), finished( false );
+    auto id = wheel.add(
+        [&]()
+        {
+            running = true;
+            std::this_thread::sleep_for( milliseconds( 100 ) );
+            finished = true;
+        },
+        milliseconds( 1000 ),
+        false );
+    while( ! running )
+        std::this_thread::sleep_for( milliseconds( 1 ) );
+    wheel.remove( id );
+    CHECK( finished );
+}
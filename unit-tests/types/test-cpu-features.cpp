@@ -0,0 +1,35 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/cpu-features.cpp
+
+#include <src/cpu-features.h>
+
+#include "../catch.h"
+
+using namespace librealsense;
+
+
+TEST_CASE( "simd level names", "[types]" )
+{
+    for( auto level : { simd_level::none, simd_level::simd128, simd_level::avx2 } )
+        CHECK( parse_simd_level( get_string( level ) ) == level );
+    CHECK( parse_simd_level( "ssse3" ) == simd_level::simd128 );
+    CHECK( parse_simd_level( "neon" ) == simd_level::simd128 );
+    CHECK( parse_simd_level( "auto" ) == simd_level::avx2 );
+    CHECK_THROWS( parse_simd_level( "avx512" ) );
+}
+
+
+TEST_CASE( "simd level limit", "[types]" )
+{
+    auto const supported = get_supported_simd_level();
+    CHECK( get_simd_level() == supported );
+
+    limit_simd_level( simd_level::none );
+    CHECK( get_simd_level() == simd_level::none );
+
+    // Cannot go above what the CPU has
+    limit_simd_level( simd_level::avx2 );
+    CHECK( get_simd_level() == supported );
+}
@@ -0,0 +1,86 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/media/ros/ros_depth_codec.cpp
+//#cmake:add-file ../../third-party/rsutils/src/depth-codec.cpp
+
+#include <src/media/ros/ros_depth_codec.h>
+
+#include "../catch.h"
+
+#include <cstring>
+#include <random>
+
+using namespace librealsense;
+
+
+static std::vector< uint8_t > round_trip( ros_depth_codec::image_info const & info, std::vector< uint16_t > const & image )
+{
+    std::vector< uint8_t > encoded;
+    ros_depth_codec::encode( info, reinterpret_cast< uint8_t const * >( image.data() ), encoded );
+    auto decoded_info = ros_depth_codec::decode_info( encoded.data(), encoded.size() );
+    CHECK( decoded_info.width == info.width );
+    CHECK( decoded_info.height == info.height );
+    CHECK( decoded_info.step == info.step );
+    CHECK( decoded_info.depth_units == info.depth_units );
+
+    std::vector< uint16_t > decoded( image.size(), 0xBAD );
+    ros_depth_codec::decode( encoded.data(), encoded.size(), reinterpret_cast< uint8_t * >( decoded.data() ) );
+    CHECK( decoded == image );
+    return encoded;
+}
+
+
+TEST_CASE( "depth codec is lossless on a depth-like image", "[types]" )
+{
+    ros_depth_codec::image_info info{ 97, 31, 97 * 2, 0.001f };
+    std::vector< uint16_t > image( info.width * info.height );
+    std::mt19937 rng( 7 );
+    for( uint32_t y = 0; y < info.height; ++y )
+        for( uint32_t x = 0; x < info.width; ++x )
+        {
+            uint16_t v = uint16_t( 1000 + 3 * x + 5 * y + rng() % 4 );
+            if( x % 23 < 4 || ( y == 5 && x > 20 ) )  // holes, and one row that's mostly invalid
+                v = 0;
+            if( x == 50 )
+                v = 65535;  // needs a literal
+            image[y * info.width + x] = v;
+        }
+    auto encoded = round_trip( info, image );
+    CHECK( encoded.size() < image.size() * 2 );
+}
+
+TEST_CASE( "depth codec falls back to raw for noise", "[types]" )
+{
+    ros_depth_codec::image_info info{ 64, 8, 64 * 2, 0.0001f };
+    std::vector< uint16_t > image( info.width * info.height );
+    std::mt19937 rng( 3 );
+    for( auto & v : image )
+        v = uint16_t( rng() | 1 );
+    auto encoded = round_trip( info, image );
+    CHECK( encoded.size() <= image.size() * 2 + 32 );
+}
+
+TEST_CASE( "depth codec keeps rows with padding", "[types]" )
+{
+    ros_depth_codec::image_info info{ 10, 4, 16 * 2, 0.001f };  // 6 pixels of padding per row
+    std::vector< uint16_t > image( 16 * info.height, 0 );
+    for( uint32_t y = 0; y < info.height; ++y )
+        for( uint32_t x = 0; x < info.width; ++x )
+            image[y * 16 + x] = uint16_t( 500 + x );
+    round_trip( info, image );
+}
+
+TEST_CASE( "depth codec rejects corrupt data", "[types]" )
+{
+    ros_depth_codec::image_info info{ 16, 2, 32, 0.001f };
+    std::vector< uint16_t > image( 32, 700 );
+    std::vector< uint8_t > encoded;
+    ros_depth_codec::encode( info, reinterpret_cast< uint8_t const * >( image.data() ), encoded );
+    std::vector< uint16_t > out( 32 );
+    auto pixels = reinterpret_cast< uint8_t * >( out.data() );
+
+    CHECK_THROWS( ros_depth_codec::decode( encoded.data(), encoded.size() - 1, pixels ) );
+    encoded[0] = 'X';
+    CHECK_THROWS( ros_depth_codec::decode( encoded.data(), encoded.size(), pixels ) );
+}
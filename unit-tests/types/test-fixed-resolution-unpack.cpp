@@ -0,0 +1,106 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+// Exercise the fixed-resolution paths even when the library is not built with them
+#ifndef RS2_FIXED_RESOLUTION_UNPACK
+#define RS2_FIXED_RESOLUTION_UNPACK
+#endif
+
+#include <src/image.h>
+
+#include "../catch.h"
+
+#include <random>
+
+using namespace librealsense;
+
+
+namespace {
+
+struct y8i_pixel { uint8_t l, r; };
+
+template< class COUNT > void split_y8i( std::vector< uint8_t > & left, std::vector< uint8_t > & right,
+                                        std::vector< y8i_pixel > const & source, COUNT count )
+{
+    uint8_t * const dest[] = { left.data(), right.data() };
+    split_frame( dest, count, source.data(),
+        []( y8i_pixel const & p ) -> uint8_t { return p.l; },
+        []( y8i_pixel const & p ) -> uint8_t { return p.r; } );
+}
+
+std::vector< y8i_pixel > random_y8i( int count )
+{
+    std::mt19937 gen( 17 );
+    std::uniform_int_distribution< int > dist( 0, 255 );
+    std::vector< y8i_pixel > source( count );
+    for( auto & p : source )
+        p = { uint8_t( dist( gen ) ), uint8_t( dist( gen ) ) };
+    return source;
+}
+
+}  // namespace
+
+
+TEST_CASE( "with_resolution passes the common resolutions as constants", "[types]" )
+{
+    auto is_fixed = []( int width, int height )
+    {
+        bool fixed = false;
+        with_resolution( width, height, [&]( auto w, auto h )
+        {
+            fixed = ! std::is_same< decltype( w ), int >::value;
+            CHECK( int( w ) == width );
+            CHECK( int( h ) == height );
+            CHECK( int( pixel_count( w, h ) ) == width * height );
+        } );
+        return fixed;
+    };
+    CHECK( is_fixed( 848, 480 ) );
+    CHECK( is_fixed( 1280, 720 ) );
+    CHECK( is_fixed( 640, 480 ) );
+    CHECK_FALSE( is_fixed( 480, 848 ) );
+    CHECK_FALSE( is_fixed( 640, 360 ) );
+    CHECK_FALSE( is_fixed( 1, 1 ) );
+}
+
+
+TEST_CASE( "fixed-resolution split_frame matches the generic one", "[types]" )
+{
+    int const width = 848, height = 480;
+    auto const source = random_y8i( width * height );
+
+    std::vector< uint8_t > left( source.size() ), right( source.size() );
+    split_y8i( left, right, source, width * height );
+
+    std::vector< uint8_t > fixed_left( source.size() ), fixed_right( source.size() );
+    with_resolution( width, height, [&]( auto w, auto h ) { split_y8i( fixed_left, fixed_right, source, pixel_count( w, h ) ); } );
+
+    CHECK( fixed_left == left );
+    CHECK( fixed_right == right );
+    CHECK( left[0] == source[0].l );
+    CHECK( right.back() == source.back().r );
+}
+
+
+// Not run by default: unit-tests-types "[benchmark]"
+TEST_CASE( "fixed-resolution split_frame benchmark", "[.][benchmark]" )
+{
+    for( auto res : { std::make_pair( 848, 480 ), std::make_pair( 1280, 720 ), std::make_pair( 640, 480 ) } )
+    {
+        int const width = res.first, height = res.second;
+        auto const source = random_y8i( width * height );
+        std::vector< uint8_t > left( source.size() ), right( source.size() );
+        auto const name = std::to_string( width ) + "x" + std::to_string( height );
+
+        BENCHMARK( "Y8I " + name + " generic" )
+        {
+            split_y8i( left, right, source, width * height );
+            return left[0];
+        };
+        BENCHMARK( "Y8I " + name + " fixed" )
+        {
+            with_resolution( width, height, [&]( auto w, auto h ) { split_y8i( left, right, source, pixel_count( w, h ) ); } );
+            return left[0];
+        };
+    }
+}
@@ -0,0 +1,47 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <src/core/frame-additional-data.h>
+
+#include "../catch.h"
+
+#include <algorithm>
+
+using namespace librealsense;
+
+
+TEST_CASE( "frame_additional_data copies only the metadata in use", "[types]" )
+{
+    uint8_t const long_md[40] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+                                  21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40 };
+    uint8_t const short_md[4] = { 9, 9, 9, 9 };
+    frame_additional_data longer( 1., 7, 2., sizeof( long_md ), long_md, 3., 0., 6, false );
+    frame_additional_data shorter( 4., 8, 5., sizeof( short_md ), short_md, 6., 0., 7, false );
+
+    frame_additional_data copy( longer );
+    CHECK( copy.frame_number == 7 );
+    CHECK( copy.metadata_size == sizeof( long_md ) );
+    CHECK( std::equal( long_md, long_md + sizeof( long_md ), copy.metadata_blob.begin() ) );
+
+    // What the longer metadata left past the shorter one's end must not show
+    copy = shorter;
+    CHECK( copy.frame_number == 8 );
+    CHECK( copy.metadata_size == sizeof( short_md ) );
+    CHECK( std::equal( short_md, short_md + sizeof( short_md ), copy.metadata_blob.begin() ) );
+    CHECK( std::all_of( copy.metadata_blob.begin() + sizeof( short_md ), copy.metadata_blob.end(),
+                        []( uint8_t b ) { return b == 0; } ) );
+}
+
+TEST_CASE( "frame_additional_data shares decoded metadata", "[types]" )
+{
+    frame_additional_data original;
+    auto decoded = std::make_shared< metadata_array >();
+    ( *decoded )[RS2_FRAME_METADATA_FRAME_COUNTER] = { true, 42 };
+    original.decoded_metadata = decoded;
+
+    frame_additional_data copy;
+    copy = original;
+    REQUIRE( copy.decoded_metadata );
+    CHECK( copy.decoded_metadata.get() == decoded.get() );
+    CHECK( ( *copy.decoded_metadata )[RS2_FRAME_METADATA_FRAME_COUNTER].value == 42 );
+}
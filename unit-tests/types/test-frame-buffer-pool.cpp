@@ -0,0 +1,101 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <src/frame-buffer-pool.h>
+
+#include "../catch.h"
+
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+using namespace librealsense;
+
+
+namespace {
+
+struct buffer
+{
+    std::vector< uint8_t > data;
+    size_t get_reusable_data_size() const { return data.size(); }
+};
+
+buffer make( size_t size, uint8_t value )
+{
+    buffer b;
+    b.data.resize( size, value );
+    return b;
+}
+
+}  // namespace
+
+
+TEST_CASE( "frame_buffer_pool matches exact sizes", "[types]" )
+{
+    frame_buffer_pool< buffer > pool;
+    buffer b;
+    CHECK_FALSE( pool.get( 10, b ) );
+
+    pool.put( make( 10, 1 ) );
+    pool.put( make( 20, 2 ) );
+    CHECK( pool.size() == 2 );
+
+    CHECK_FALSE( pool.get( 15, b ) );
+    REQUIRE( pool.get( 20, b ) );
+    CHECK( b.data.size() == 20 );
+    CHECK( b.data[0] == 2 );
+    REQUIRE( pool.get( 10, b ) );
+    CHECK( b.data[0] == 1 );
+    CHECK( pool.size() == 0 );
+    CHECK_FALSE( pool.get( 10, b ) );
+}
+
+TEST_CASE( "frame_buffer_pool returns most recent first", "[types]" )
+{
+    frame_buffer_pool< buffer > pool;
+    pool.put( make( 10, 1 ) );
+    pool.put( make( 10, 2 ) );
+    buffer b;
+    REQUIRE( pool.get( 10, b ) );
+    CHECK( b.data[0] == 2 );
+}
+
+TEST_CASE( "frame_buffer_pool high-water mark", "[types]" )
+{
+    frame_buffer_pool< buffer > pool( 2 );
+    pool.put( make( 10, 1 ) );
+    pool.put( make( 10, 2 ) );
+    pool.put( make( 10, 3 ) );
+    CHECK( pool.size() == 2 );
+
+    buffer b;
+    REQUIRE( pool.get( 10, b ) );
+    pool.put( std::move( b ) );
+    CHECK( pool.size() == 2 );
+    pool.put( make( 10, 4 ) );
+    CHECK( pool.size() == 2 );
+}
+
+TEST_CASE( "frame_buffer_pool drops old buffers", "[types]" )
+{
+    frame_buffer_pool< buffer > pool( 10, std::chrono::milliseconds( 20 ) );
+    pool.put( make( 10, 1 ) );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+    pool.put( make( 20, 2 ) );  // trims the first on the way in
+    CHECK( pool.size() == 1 );
+    buffer b;
+    CHECK_FALSE( pool.get( 10, b ) );
+    CHECK( pool.get( 20, b ) );
+}
+
+TEST_CASE( "frame_buffer_pool drops old buffers when none are returned", "[types]" )
+{
+    frame_buffer_pool< buffer > pool( 10, std::chrono::milliseconds( 20 ) );
+    pool.put( make( 10, 1 ) );
+    pool.put( make( 20, 2 ) );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+    buffer b;
+    CHECK_FALSE( pool.get( 30, b ) );  // trims both, though neither was asked for
+    CHECK( pool.size() == 0 );
+    CHECK( pool.bytes() == 0 );
+}
@@ -0,0 +1,85 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <src/frame-memory-budget.h>
+
+#include "../catch.h"
+
+#include <thread>
+#include <vector>
+
+using namespace librealsense;
+using priority = frame_memory_budget::priority;
+
+
+TEST_CASE( "frame memory budget drops low priorities first", "[types]" )
+{
+    auto & budget = frame_memory_budget::instance();
+    budget.set_limit( 800 );
+
+    CHECK( budget.acquire( 500, priority::low ) );
+    CHECK( budget.get_in_use() == 500 );
+    // low frames may use up to 600, normal ones 700, high ones all 800
+    CHECK_FALSE( budget.acquire( 150, priority::low ) );
+    CHECK( budget.acquire( 150, priority::normal ) );
+    CHECK_FALSE( budget.acquire( 100, priority::normal ) );
+    CHECK( budget.acquire( 150, priority::high ) );
+    CHECK_FALSE( budget.acquire( 1, priority::high ) );
+    CHECK( budget.get_in_use() == 800 );
+
+    budget.release( 800 );
+    CHECK( budget.get_in_use() == 0 );
+    budget.set_limit( 0 );
+    CHECK( budget.acquire( 1 << 30, priority::low ) );
+    budget.release( 1 << 30 );
+}
+
+
+TEST_CASE( "frame memory budget reclaims pooled memory", "[types]" )
+{
+    auto & budget = frame_memory_budget::instance();
+    budget.set_limit( 1000 );
+
+    int reclaimed = 0;
+    auto id = budget.register_reclaimer( [&]() {
+        ++reclaimed;
+        budget.add_pooled( -int64_t( budget.get_pooled() ) );
+    } );
+
+    budget.add_pooled( 600 );
+    CHECK( budget.acquire( 300, priority::high ) );
+    CHECK( reclaimed == 0 );
+    // 300 + 600 + 200 > 1000: the pool gives its memory up
+    CHECK( budget.acquire( 200, priority::high ) );
+    CHECK( reclaimed == 1 );
+    CHECK( budget.get_pooled() == 0 );
+
+    budget.unregister_reclaimer( id );
+    budget.release( 500 );
+    budget.set_limit( 0 );
+}
+
+
+TEST_CASE( "frame memory budget holds under concurrent acquires", "[types]" )
+{
+    auto & budget = frame_memory_budget::instance();
+    budget.set_limit( 1000 );
+
+    std::atomic< int > acquired( 0 );
+    std::vector< std::thread > threads;
+    for( int t = 0; t < 8; ++t )
+        threads.emplace_back( [&]() {
+            for( int i = 0; i < 1000; ++i )
+                if( budget.acquire( 10, priority::high ) )
+                    ++acquired;
+        } );
+    for( auto & t : threads )
+        t.join();
+
+    CHECK( acquired == 100 );
+    CHECK( budget.get_in_use() == 1000 );
+    budget.release( 1000 );
+    budget.set_limit( 0 );
+}
@@ -0,0 +1,44 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <src/latency-stats.h>
+
+#include "../catch.h"
+
+using namespace librealsense;
+
+
+TEST_CASE( "latency_histogram buckets are contiguous", "[types]" )
+{
+    for( int b = 0; b < latency_histogram::BUCKETS - 1; ++b )
+    {
+        CHECK( latency_histogram::bucket_high( b ) == latency_histogram::bucket_low( b + 1 ) );
+        CHECK( latency_histogram::bucket_of( latency_histogram::bucket_low( b ) ) == b );
+        CHECK( latency_histogram::bucket_of( latency_histogram::bucket_high( b ) - 1 ) == b );
+    }
+    CHECK( latency_histogram::bucket_of( uint64_t( 1 ) << 40 ) == latency_histogram::BUCKETS - 1 );
+}
+
+TEST_CASE( "latency_histogram stats", "[types]" )
+{
+    latency_histogram h;
+    auto empty = h.get_stats();
+    CHECK( empty.count == 0 );
+    CHECK( empty.p99_ms == 0 );
+
+    for( int i = 1; i <= 100; ++i )
+        h.record( i );  // 1..100 ms
+    auto stats = h.get_stats();
+    CHECK( stats.count == 100 );
+    CHECK( stats.mean_ms == Approx( 50.5 ) );
+    CHECK( stats.max_ms == Approx( 100 ) );
+    // Within the histogram's 25% precision
+    CHECK( stats.p50_ms == Approx( 50 ).epsilon( 0.25 ) );
+    CHECK( stats.p90_ms == Approx( 90 ).epsilon( 0.25 ) );
+    CHECK( stats.p99_ms == Approx( 99 ).epsilon( 0.25 ) );
+    CHECK( stats.p50_ms <= stats.p90_ms );
+    CHECK( stats.p90_ms <= stats.p99_ms );
+
+    h.reset();
+    CHECK( h.get_stats().count == 0 );
+}
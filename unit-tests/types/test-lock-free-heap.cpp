@@ -0,0 +1,84 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <src/lock-free-heap.h>
+
+#include "../catch.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <set>
+
+using namespace librealsense;
+
+
+TEST_CASE( "lock_free_heap allocates every slot exactly once", "[types]" )
+{
+    lock_free_heap< int, 70 > heap;  // not a multiple of 64, to cover the partial last word
+    std::set< int * > items;
+    for( int i = 0; i < 70; ++i )
+    {
+        auto p = heap.allocate();
+        REQUIRE( p );
+        REQUIRE( items.insert( p ).second );
+    }
+    CHECK( heap.get_size() == 70 );
+    CHECK_FALSE( heap.allocate() );
+    CHECK( heap.get_size() == 70 );
+
+    for( auto p : items )
+        heap.deallocate( p );
+    CHECK( heap.is_empty() );
+    CHECK( heap.allocate() );
+}
+
+TEST_CASE( "lock_free_heap rejects foreign items", "[types]" )
+{
+    lock_free_heap< int, 4 > heap;
+    int x;
+    CHECK_THROWS( heap.deallocate( &x ) );
+}
+
+TEST_CASE( "lock_free_heap stop and wait", "[types]" )
+{
+    lock_free_heap< int, 4 > heap;
+    auto p = heap.allocate();
+    REQUIRE( p );
+    heap.stop_allocation();
+    CHECK_FALSE( heap.allocate() );
+    CHECK( heap.get_size() == 1 );
+
+    std::thread t( [&]() {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+        heap.deallocate( p );
+    } );
+    heap.wait_until_empty();
+    CHECK( heap.is_empty() );
+    t.join();
+}
+
+TEST_CASE( "lock_free_heap concurrent allocation", "[types]" )
+{
+    lock_free_heap< int, 128 > heap;
+    std::atomic< int > collisions( 0 );
+    std::vector< std::thread > threads;
+    for( int t = 0; t < 4; ++t )
+        threads.emplace_back( [&]() {
+            for( int i = 0; i < 10000; ++i )
+            {
+                auto p = heap.allocate();
+                if( ! p )
+                    continue;
+                if( *p != 0 )  // somebody else is using it
+                    ++collisions;
+                *p = 1;
+                *p = 0;
+                heap.deallocate( p );
+            }
+        } );
+    for( auto & t : threads )
+        t.join();
+    CHECK( collisions == 0 );
+    CHECK( heap.is_empty() );
+}
@@ -0,0 +1,49 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <src/proc/motion-correction.h>
+
+#include "../catch.h"
+
+#include <vector>
+
+using namespace librealsense;
+
+
+TEST_CASE( "motion_correction batch matches single samples", "[types]" )
+{
+    motion_correction c;
+    c.m = { { 0.f, -1.01f, 0.02f }, { 1.f, 0.03f, -0.01f }, { 0.01f, 0.f, -0.99f } };
+    c.offset = { 0.1f, -0.2f, 0.3f };
+
+    std::vector< rs2_motion_sample > samples( 7 );  // odd, to cover any remainder
+    for( size_t i = 0; i < samples.size(); ++i )
+    {
+        samples[i].data = { float( i ) - 3, 9.8f - float( i ), 0.5f * float( i ) };
+        samples[i].timestamp = 1000. + i;
+    }
+    auto const original = samples;
+
+    c.apply( samples.data(), samples.size() );
+    for( size_t i = 0; i < samples.size(); ++i )
+    {
+        auto expected = c( { original[i].data.x, original[i].data.y, original[i].data.z } );
+        CHECK( samples[i].data.x == Approx( expected.x ) );
+        CHECK( samples[i].data.y == Approx( expected.y ) );
+        CHECK( samples[i].data.z == Approx( expected.z ) );
+        CHECK( samples[i].timestamp == original[i].timestamp );
+    }
+}
+
+TEST_CASE( "motion_correction defaults to identity", "[types]" )
+{
+    motion_correction c;
+    rs2_motion_sample s;
+    s.data = { 1.f, 2.f, 3.f };
+    s.timestamp = 5.;
+    c.apply( &s, 1 );
+    CHECK( s.data.x == 1.f );
+    CHECK( s.data.y == 2.f );
+    CHECK( s.data.z == 3.f );
+    CHECK( s.timestamp == 5. );
+}
@@ -0,0 +1,106 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <src/motion-sample-ring.h>
+
+#include "../catch.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace librealsense;
+
+
+static rs2_motion_sample sample_at( uint64_t i )
+{
+    rs2_motion_sample s;
+    s.data = { float( i ), float( i ), float( i ) };
+    s.timestamp = double( i );
+    return s;
+}
+
+
+TEST_CASE( "motion_sample_ring finds sample ranges", "[types]" )
+{
+    auto ring = std::make_shared< motion_sample_ring >();
+    auto s = ring->find( 0, 100 );
+    CHECK( s.size == 0 );
+
+    for( uint64_t i = 0; i < 100; ++i )
+        ring->push( sample_at( i ) );
+    CHECK( ring->size() == 100 );
+
+    s = ring->find( 10.5, 20 );  // inclusive of 'to'
+    REQUIRE( s.size == 10 );
+    CHECK( s.data[0].timestamp == 11 );
+    CHECK( s.data[9].timestamp == 20 );
+    CHECK( ring->is_valid( s ) );
+
+    CHECK( ring->find( -10, 1000 ).size == 100 );
+    CHECK( ring->find( 200, 300 ).size == 0 );
+    CHECK( ring->find( 20, 10 ).size == 0 );
+}
+
+TEST_CASE( "motion_sample_ring spans stay contiguous across the wrap-around", "[types]" )
+{
+    auto ring = std::make_shared< motion_sample_ring >();
+    auto const n = motion_sample_ring::CAPACITY + 100;
+    for( uint64_t i = 0; i < n; ++i )
+        ring->push( sample_at( i ) );
+    // The slot of the oldest is the next to be reused, so it is no longer handed out
+    CHECK( ring->size() == motion_sample_ring::CAPACITY - 1 );
+    CHECK( ring->find( 0, 100 ).size == 0 );
+
+    auto s = ring->find( n - 200, n - 1 );  // starts before slot 0, ends after it
+    REQUIRE( s.size == 200 );
+    for( size_t i = 0; i < s.size; ++i )
+        CHECK( s.data[i].timestamp == double( n - 200 + i ) );
+    CHECK( ring->is_valid( s ) );
+
+    std::vector< rs2_motion_sample > out( 50 );
+    CHECK( ring->copy( n - 200, n - 1, out.data(), out.size() ) == 50 );
+    CHECK( out[0].timestamp == double( n - 200 ) );
+}
+
+TEST_CASE( "motion_sample_ring invalidates lapped spans", "[types]" )
+{
+    auto ring = std::make_shared< motion_sample_ring >();
+    for( uint64_t i = 0; i < 10; ++i )
+        ring->push( sample_at( i ) );
+    auto s = ring->find( 0, 5 );
+    REQUIRE( s.size == 6 );
+    for( uint64_t i = 10; i < motion_sample_ring::CAPACITY; ++i )
+        ring->push( sample_at( i ) );
+    CHECK( ring->is_valid( s ) );
+    ring->push( sample_at( motion_sample_ring::CAPACITY ) );  // reuses the slot of sample 0
+    CHECK_FALSE( ring->is_valid( s ) );
+}
+
+TEST_CASE( "motion_sample_ring readers never see torn samples", "[types]" )
+{
+    auto ring = std::make_shared< motion_sample_ring >();
+    std::atomic< bool > done( false );
+    std::thread writer( [&]() {
+        for( uint64_t i = 0; i < 200000; ++i )
+            ring->push( sample_at( i ) );
+        done = true;
+    } );
+
+    std::vector< rs2_motion_sample > out( motion_sample_ring::CAPACITY );
+    bool consistent = true;
+    while( ! done )
+    {
+        auto n = ring->copy( 0, 1e9, out.data(), out.size() );
+        for( size_t i = 0; i < n; ++i )
+        {
+            if( out[i].data.x != float( out[i].timestamp ) || out[i].data.z != float( out[i].timestamp ) )
+                consistent = false;
+            if( i && out[i].timestamp != out[i - 1].timestamp + 1 )
+                consistent = false;
+        }
+    }
+    writer.join();
+    CHECK( consistent );
+}
@@ -0,0 +1,46 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <src/proc/processing-roi.h>
+#include <src/core/options-container.h>
+
+#include "../catch.h"
+
+using namespace librealsense;
+
+
+TEST_CASE( "processing_roi maps fractions to the pixels they touch", "[types]" )
+{
+    options_container options;
+    processing_roi roi;
+    roi.register_options( options );
+    CHECK( ! roi.active() );
+
+    auto whole = roi.get( 640, 480 );
+    CHECK( whole.min_x == 0 );
+    CHECK( whole.min_y == 0 );
+    CHECK( whole.max_x == 639 );
+    CHECK( whole.max_y == 479 );
+
+    options.get_option( RS2_OPTION_ROI_MIN_X ).set( 0.25f );
+    options.get_option( RS2_OPTION_ROI_MAX_X ).set( 0.75f );
+    options.get_option( RS2_OPTION_ROI_MIN_Y ).set( 0.5f );
+    CHECK( roi.active() );
+
+    auto half = roi.get( 640, 480 );
+    CHECK( half.min_x == 160 );
+    CHECK( half.max_x == 479 );
+    CHECK( half.min_y == 240 );
+    CHECK( half.max_y == 479 );
+
+    // The same region after decimation by 3: partly covered pixels are in
+    auto decimated = roi.get( 213, 160 );
+    CHECK( decimated.min_x == 53 );
+    CHECK( decimated.max_x == 159 );
+    CHECK( decimated.min_y == 80 );
+    CHECK( decimated.max_y == 159 );
+
+    options.get_option( RS2_OPTION_ROI_MAX_X ).set( 0.25f );
+    auto empty = roi.get( 640, 480 );
+    CHECK( empty.max_x < empty.min_x );
+}
@@ -0,0 +1,41 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include <src/usb-bandwidth.h>
+
+#include "../catch.h"
+
+using namespace librealsense;
+
+
+TEST_CASE( "payload rates", "[types]" )
+{
+    CHECK( usb_bandwidth::get_payload_rate( RS2_FORMAT_Z16, 1280, 720, 30 ) == 1280. * 720 * 2 * 30 );
+    CHECK( usb_bandwidth::get_payload_rate( RS2_FORMAT_YUYV, 640, 480, 60 ) == 640. * 480 * 2 * 60 );
+    CHECK( usb_bandwidth::get_payload_rate( RS2_FORMAT_Y8, 848, 480, 90 ) == 848. * 480 * 90 );
+    // Compressed: unknown
+    CHECK( usb_bandwidth::get_payload_rate( RS2_FORMAT_MJPEG, 1280, 720, 30 ) == 0 );
+}
+
+
+TEST_CASE( "usb bus from device path", "[types]" )
+{
+    CHECK( usb_bandwidth::get_bus( "/sys/devices/pci0000:00/0000:00:14.0/usb2/2-3/2-3:1.0/video4linux/video0" )
+           == "/sys/devices/pci0000:00/0000:00:14.0/usb2" );
+    CHECK( usb_bandwidth::get_bus( "/sys/devices/pci0000:00/0000:00:14.0/usb10/10-1/10-1.2/10-1.2:1.3/video4linux/video4" )
+           == "/sys/devices/pci0000:00/0000:00:14.0/usb10" );
+    // Not a sysfs USB path: a bus of its own
+    CHECK( usb_bandwidth::get_bus( "\\\\?\\usb#vid_8086&pid_0b07&mi_00#6&2b7c0a8b&0&0000" )
+           == "\\\\?\\usb#vid_8086&pid_0b07&mi_00#6&2b7c0a8b&0&0000" );
+    CHECK( usb_bandwidth::get_bus( "/dev/video-rs-depth-0" ) == "/dev/video-rs-depth-0" );
+}
+
+
+TEST_CASE( "usb capacities", "[types]" )
+{
+    CHECK( usb_bandwidth::get_capacity( platform::usb2_type ) < usb_bandwidth::get_capacity( platform::usb3_type ) );
+    CHECK( usb_bandwidth::get_capacity( platform::usb3_2_type ) == usb_bandwidth::get_capacity( platform::usb3_type ) );
+    CHECK( usb_bandwidth::get_capacity( platform::usb1_1_type ) == usb_bandwidth::get_capacity( platform::usb2_type ) );
+}
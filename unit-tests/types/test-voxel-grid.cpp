@@ -0,0 +1,74 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/proc/voxel-grid.cpp
+
+#include <src/proc/voxel-grid.h>
+#include <src/proc/worker-pool.h>
+
+#include "../catch.h"
+
+#include <vector>
+
+using namespace librealsense;
+
+
+TEST_CASE( "voxel_grid emits the centroid of each cell", "[types]" )
+{
+    std::vector< float3 > points = { { 0.01f, 0.01f, 0.51f },
+                                     { 0.03f, 0.05f, 0.53f },
+                                     { 0.f, 0.f, 0.f },  // no depth
+                                     { 0.25f, 0.01f, 0.51f } };
+    std::vector< float2 > uv = { { 0.f, 0.f }, { 1.f, .5f }, { .3f, .3f }, { .2f, .2f } };
+    std::vector< float3 > out( points.size() );
+    std::vector< float2 > out_uv( points.size() );
+
+    voxel_grid grid;
+    auto n = grid.reduce( points.data(), uv.data(), points.size(), .1f, out.data(), out_uv.data(), nullptr, 1 );
+    REQUIRE( n == 2 );
+
+    bool found_pair = false, found_single = false;
+    for( size_t i = 0; i < n; ++i )
+    {
+        if( out[i].x < .1f )
+        {
+            found_pair = true;
+            CHECK( out[i].x == Approx( .02f ) );
+            CHECK( out[i].y == Approx( .03f ) );
+            CHECK( out[i].z == Approx( .52f ) );
+            CHECK( out_uv[i].x == Approx( .5f ) );
+            CHECK( out_uv[i].y == Approx( .25f ) );
+        }
+        else
+        {
+            found_single = true;
+            CHECK( out[i].x == Approx( .25f ) );
+            CHECK( out_uv[i].x == Approx( .2f ) );
+        }
+    }
+    CHECK( found_pair );
+    CHECK( found_single );
+}
+
+TEST_CASE( "voxel_grid output does not depend on the threads", "[types]" )
+{
+    std::vector< float3 > points;
+    for( int i = 0; i < 5000; ++i )
+        points.push_back( { ( i % 71 ) * .013f - .4f, ( i % 37 ) * .021f - .3f, ( i % 13 ) ? .5f + ( i % 29 ) * .01f : 0.f } );
+
+    voxel_grid grid;
+    std::vector< float3 > serial( points.size() ), parallel( points.size() );
+    auto n = grid.reduce( points.data(), nullptr, points.size(), .05f, serial.data(), nullptr, nullptr, 1 );
+
+    worker_pool pool( 3 );
+    auto in_place = points;
+    auto m = grid.reduce( in_place.data(), nullptr, in_place.size(), .05f, in_place.data(), nullptr, &pool, 4 );
+    REQUIRE( n == m );
+    REQUIRE( n > 0 );
+    for( size_t i = 0; i < n; ++i )
+    {
+        CHECK( serial[i].x == in_place[i].x );
+        CHECK( serial[i].y == in_place[i].y );
+        CHECK( serial[i].z == in_place[i].z );
+    }
+}
@@ -0,0 +1,92 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <src/proc/worker-pool.h>
+
+#include "../catch.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace librealsense;
+
+
+TEST_CASE( "worker_pool covers every index exactly once", "[types]" )
+{
+    worker_pool pool( 3 );
+    for( size_t parts : { 1, 2, 4, 7, 100 } )
+    {
+        std::vector< std::atomic< int > > hits( 37 );
+        for( auto & h : hits )
+            h = 0;
+        pool.parallel_for( 0, hits.size(), parts, [&]( size_t begin, size_t end ) {
+            REQUIRE( begin < end );
+            for( auto i = begin; i < end; ++i )
+                ++hits[i];
+        } );
+        for( auto & h : hits )
+            CHECK( h == 1 );
+    }
+}
+
+TEST_CASE( "worker_pool handles empty ranges", "[types]" )
+{
+    worker_pool pool( 2 );
+    int calls = 0;
+    pool.parallel_for( 5, 5, 4, [&]( size_t, size_t ) { ++calls; } );
+    CHECK( calls == 0 );
+}
+
+TEST_CASE( "worker_pool rethrows", "[types]" )
+{
+    worker_pool pool( 2 );
+    CHECK_THROWS( pool.parallel_for( 0, 10, 4, []( size_t begin, size_t ) {
+        if( begin == 0 )
+            throw std::runtime_error( "oops" );
+    } ) );
+    // The pool is still usable afterwards
+    std::atomic< size_t > total( 0 );
+    pool.parallel_for( 0, 10, 4, [&]( size_t begin, size_t end ) { total += end - begin; } );
+    CHECK( total == 10 );
+}
+
+TEST_CASE( "worker_pool::for_each_range runs on the caller without a pool", "[types]" )
+{
+    std::vector< std::pair< size_t, size_t > > ranges;
+    worker_pool::for_each_range( nullptr, 4, 10, [&]( size_t begin, size_t end ) { ranges.emplace_back( begin, end ); } );
+    REQUIRE( ranges.size() == 1 );
+    CHECK( ranges[0] == std::make_pair( size_t( 0 ), size_t( 10 ) ) );
+
+    worker_pool pool( 3 );
+    std::atomic< size_t > total( 0 );
+    worker_pool::for_each_range( &pool, 4, 10, [&]( size_t begin, size_t end ) { total += end - begin; } );
+    CHECK( total == 10 );
+}
+
+TEST_CASE( "worker_pool runs posted tasks, also from its own threads", "[types]" )
+{
+    std::atomic< int > done( 0 );
+    {
+        worker_pool pool( 3 );
+        for( int i = 0; i < 20; ++i )
+            pool.post( [&]() {
+                pool.post( [&]() { ++done; } );
+                ++done;
+            } );
+    }  // the pool finishes what was posted before it goes
+    CHECK( done == 40 );
+}
+
+TEST_CASE( "serial_queue keeps the order", "[types]" )
+{
+    std::vector< int > order;
+    serial_queue q;
+    for( int i = 0; i < 100; ++i )
+        q.post( [&order, i]() { order.push_back( i ); } );
+    q.flush();
+    CHECK( q.size() == 0 );
+    REQUIRE( order.size() == 100 );
+    for( int i = 0; i < 100; ++i )
+        CHECK( order[i] == i );
+}
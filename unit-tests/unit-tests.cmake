@@ -17,3 +17,4 @@ endif()
 
 include(algo/CMakeLists.txt)
 include(live/CMakeLists.txt)
+add_subdirectory(benchmarks)
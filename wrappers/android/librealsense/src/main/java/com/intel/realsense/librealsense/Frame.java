@@ -1,5 +1,11 @@
 package com.intel.realsense.librealsense;
 
+import android.annotation.TargetApi;
+import android.hardware.HardwareBuffer;
+import android.os.Build;
+
+import java.nio.ByteBuffer;
+
 public class Frame extends LrsClass implements Cloneable{
 
     Frame(long handle){
@@ -33,6 +39,23 @@ public class Frame extends LrsClass implements Cloneable{
         nGetData(mHandle, data);
     }
 
+    /**
+     * The frame's data, without copying it. The buffer is only valid until the frame is closed.
+     */
+    public ByteBuffer getDataBuffer() {
+        return nGetDataBuffer(mHandle);
+    }
+
+    /**
+     * The hardware buffer holding the frame's data, when its sensor allocates frames in hardware buffers (see
+     * Sensor.useHardwareBuffers), or null. It can be imported by GLES, Vulkan or NNAPI as it is, and is only valid
+     * until the frame is closed: the library then reuses it for other frames.
+     */
+    @TargetApi(Build.VERSION_CODES.O)
+    public HardwareBuffer getHardwareBuffer() {
+        return (HardwareBuffer) nGetHardwareBuffer(mHandle);
+    }
+
     public int getNumber(){
         return nGetNumber(mHandle);
     }
@@ -78,6 +101,8 @@ public class Frame extends LrsClass implements Cloneable{
     protected static native long nGetStreamProfile(long handle);
     private static native int nGetDataSize(long handle);
     private static native void nGetData(long handle, byte[] data);
+    private static native ByteBuffer nGetDataBuffer(long handle);
+    private static native Object nGetHardwareBuffer(long handle);
     private static native int nGetNumber(long handle);
     private static native double nGetTimestamp(long handle);
     private static native int nGetTimestampDomain(long handle);
@@ -67,6 +67,21 @@ public class Sensor extends Options {
         nStop(mHandle);
     }
 
+    /**
+     * Whether frames can be allocated in hardware buffers, which takes Android 8.0 (API 26)
+     */
+    public static boolean isHardwareBufferSupported() {
+        return nIsHardwareBufferSupported();
+    }
+
+    /**
+     * Allocate the frames this sensor produces in hardware buffers (see Frame.getHardwareBuffer), or go back to the
+     * library's own buffers. Takes effect for the frames that follow.
+     */
+    public void useHardwareBuffers(boolean enable) {
+        nSetHardwareBufferAllocator(mHandle, enable);
+    }
+
     // release resources - from AutoCloseable interface
     @Override
     public void close() {
@@ -118,5 +133,7 @@ public class Sensor extends Options {
     private static native void nOpenMultiple(long handle, long[] sp_list, int num_of_profiles);
     private static native void nStart(long handle, FrameCallback callback);
     private static native void nStop(long handle);
+    private static native boolean nIsHardwareBufferSupported();
+    private static native void nSetHardwareBufferAllocator(long handle, boolean enable);
     private static native void nClose(long handle);
 }
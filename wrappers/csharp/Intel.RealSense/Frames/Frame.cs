@@ -151,6 +151,19 @@ namespace Intel.RealSense
             }
         }
 
+        /// <summary>
+        /// Retrieve the data, profile, timestamp and (for video frames) dimensions of the frame in a single native call,
+        /// rather than a P/Invoke per property; of a composite frame, this describes its first frame
+        /// </summary>
+        /// <returns>the frame's snapshot</returns>
+        public FrameSnapshot Snapshot()
+        {
+            object error;
+            FrameSnapshot snapshot;
+            NativeMethods.rs2_frameset_snapshot(Handle, out snapshot, 1, IntPtr.Zero, 0, IntPtr.Zero, IntPtr.Zero, out error);
+            return snapshot;
+        }
+
         /// <summary>
         /// Returns the stream profile that was used to start the stream of this frame
         /// </summary>
@@ -189,6 +189,40 @@ namespace Intel.RealSense
             return enumerator;
         }
 
+        /// <summary>
+        /// Retrieve the data, profile and timestamp of every frame in the set, plus the requested metadata, in a single
+        /// native call. Reusing the arrays from one frameset to the next avoids any allocation.
+        /// </summary>
+        /// <param name="frames">receives a snapshot per frame, for up to its length of them</param>
+        /// <param name="metadata">the metadata to retrieve of each frame, or null for none</param>
+        /// <param name="values">receives the metadata of frame i at [i * metadata.Length + j]; 0 where unsupported</param>
+        /// <param name="supported">if not null, receives 1 where the metadata is supported and 0 where not, laid out as <paramref name="values"/></param>
+        /// <returns>the number of frames in the set, which may be more than were retrieved</returns>
+        /// <exception cref="ArgumentNullException">Thrown when <paramref name="frames"/> is null</exception>
+        /// <exception cref="ArgumentException">Thrown when <paramref name="values"/> or <paramref name="supported"/> is too small</exception>
+        public int Snapshot(FrameSnapshot[] frames, FrameMetadataValue[] metadata = null, long[] values = null, int[] supported = null)
+        {
+            if (frames == null)
+            {
+                throw new ArgumentNullException(nameof(frames));
+            }
+
+            int metadataCount = metadata == null ? 0 : metadata.Length;
+            int needed = frames.Length * metadataCount;
+            if (metadataCount != 0 && (values == null || values.Length < needed))
+            {
+                throw new ArgumentException("values must hold frames.Length * metadata.Length entries", nameof(values));
+            }
+
+            if (supported != null && supported.Length < needed)
+            {
+                throw new ArgumentException("supported must hold frames.Length * metadata.Length entries", nameof(supported));
+            }
+
+            object error;
+            return NativeMethods.rs2_frameset_snapshot(Handle, frames, frames.Length, metadata, metadataCount, values, supported, out error);
+        }
+
         /// <summary>Gets the number of frames embedded within a composite frame</summary>
         /// <value>Number of embedded frames</value>
         public int Count => count;
@@ -0,0 +1,57 @@
+﻿// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+namespace Intel.RealSense
+{
+    using System;
+    using System.Runtime.InteropServices;
+
+    /// <summary>
+    /// Everything commonly needed of a frame, retrieved in a single native call (see <see cref="FrameSet.Snapshot"/>)
+    /// instead of a P/Invoke per property. A blittable struct, so arrays of it can be reused frame after frame without
+    /// garbage.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FrameSnapshot
+    {
+        /// <summary>Native frame handle; not referenced, so only valid as long as its frameset</summary>
+        public IntPtr frame;
+
+        /// <summary>Frame data, valid as long as the frame</summary>
+        public IntPtr data;
+
+        /// <summary>Size of the data in bytes</summary>
+        public int dataSize;
+
+        /// <summary>Native stream profile handle</summary>
+        public IntPtr profile;
+
+        public Stream stream;
+
+        public int streamIndex;
+
+        public Format format;
+
+        /// <summary>Unique id of the stream profile</summary>
+        public int uniqueId;
+
+        public ulong frameNumber;
+
+        /// <summary>Timestamp in milliseconds</summary>
+        public double timestamp;
+
+        public TimestampDomain timestampDomain;
+
+        /// <summary>Width in pixels; 0 for non-video frames</summary>
+        public int width;
+
+        /// <summary>Height in pixels; 0 for non-video frames</summary>
+        public int height;
+
+        /// <summary>Stride in bytes; 0 for non-video frames</summary>
+        public int stride;
+
+        /// <summary>Bits per pixel; 0 for non-video frames</summary>
+        public int bitsPerPixel;
+    }
+}
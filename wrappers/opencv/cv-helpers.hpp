@@ -7,7 +7,61 @@
 #include <opencv2/opencv.hpp>   // Include OpenCV API
 #include <exception>
 
-// Convert rs2::frame to cv::Mat
+// cv::Mat allocator for matrices wrapping the memory of an rs2::frame: the frame is kept alive for as long as any
+// matrix (or copy of one) refers to its data, and is released with the last of them
+class frame_mat_allocator : public cv::MatAllocator
+{
+public:
+#if CV_VERSION_MAJOR >= 4
+    using access_flags = cv::AccessFlag;
+#else
+    using access_flags = int;
+#endif
+
+    static const frame_mat_allocator& instance()
+    {
+        static frame_mat_allocator inst;
+        return inst;
+    }
+
+    // Wraps the frame's pixels without copying them
+    cv::Mat wrap(const rs2::frame& f, int rows, int cols, int type, size_t step) const
+    {
+        cv::Mat m(rows, cols, type, const_cast<void*>(f.get_data()), step);
+        auto u = new cv::UMatData(this);
+        u->data = u->origdata = m.data;
+        u->size = step * rows;
+        u->flags |= cv::UMatData::USER_ALLOCATED;
+        u->userdata = new rs2::frame(f);
+        u->refcount = 1;
+        m.u = u;
+        m.allocator = this;
+        return m;
+    }
+
+    // New matrices are never allocated by this allocator, only wrapped
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step,
+                           access_flags flags, cv::UMatUsageFlags usage) const override
+    {
+        return cv::Mat::getStdAllocator()->allocate(dims, sizes, type, data, step, flags, usage);
+    }
+
+    bool allocate(cv::UMatData* u, access_flags flags, cv::UMatUsageFlags usage) const override
+    {
+        return cv::Mat::getStdAllocator()->allocate(u, flags, usage);
+    }
+
+    void deallocate(cv::UMatData* u) const override
+    {
+        if (!u)
+            return;
+        delete static_cast<rs2::frame*>(u->userdata);
+        delete u;
+    }
+};
+
+// Convert rs2::frame to cv::Mat. Apart from RGB8, which is converted to BGR, the matrix refers to the frame's memory
+// and keeps the frame alive with it.
 static cv::Mat frame_to_mat(const rs2::frame& f)
 {
     using namespace cv;
@@ -16,29 +70,35 @@ static cv::Mat frame_to_mat(const rs2::frame& f)
     auto vf = f.as<video_frame>();
     const int w = vf.get_width();
     const int h = vf.get_height();
+    const size_t step = vf.get_stride_in_bytes();
+    auto& alloc = frame_mat_allocator::instance();
 
     if (f.get_profile().format() == RS2_FORMAT_BGR8)
     {
-        return Mat(Size(w, h), CV_8UC3, (void*)f.get_data(), Mat::AUTO_STEP);
+        return alloc.wrap(f, h, w, CV_8UC3, step);
     }
     else if (f.get_profile().format() == RS2_FORMAT_RGB8)
     {
-        auto r_rgb = Mat(Size(w, h), CV_8UC3, (void*)f.get_data(), Mat::AUTO_STEP);
+        auto r_rgb = Mat(Size(w, h), CV_8UC3, (void*)f.get_data(), step);
         Mat r_bgr;
         cvtColor(r_rgb, r_bgr, COLOR_RGB2BGR);
         return r_bgr;
     }
-    else if (f.get_profile().format() == RS2_FORMAT_Z16)
+    else if (f.get_profile().format() == RS2_FORMAT_BGRA8)
+    {
+        return alloc.wrap(f, h, w, CV_8UC4, step);
+    }
+    else if (f.get_profile().format() == RS2_FORMAT_Z16 || f.get_profile().format() == RS2_FORMAT_Y16)
     {
-        return Mat(Size(w, h), CV_16UC1, (void*)f.get_data(), Mat::AUTO_STEP);
+        return alloc.wrap(f, h, w, CV_16UC1, step);
     }
     else if (f.get_profile().format() == RS2_FORMAT_Y8)
     {
-        return Mat(Size(w, h), CV_8UC1, (void*)f.get_data(), Mat::AUTO_STEP);
+        return alloc.wrap(f, h, w, CV_8UC1, step);
     }
     else if (f.get_profile().format() == RS2_FORMAT_DISPARITY32)
     {
-        return Mat(Size(w, h), CV_32FC1, (void*)f.get_data(), Mat::AUTO_STEP);
+        return alloc.wrap(f, h, w, CV_32FC1, step);
     }
 
     throw std::runtime_error("Frame format is not supported yet!");
@@ -0,0 +1,198 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include <rs-vino/async-inference.h>
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <cstring>
+
+
+using namespace InferenceEngine;
+
+
+namespace openvino_helpers
+{
+    async_inference::async_inference(
+        const std::string & pathToModel,
+        rs2_stream stream,
+        size_t nRequests,
+        bool doRawOutputMessages
+    )
+        : base_detection( "async inference", pathToModel, 1, false, true, doRawOutputMessages )
+        , _stream( stream )
+        , _n_requests( nRequests ? nRequests : 1 )
+        , _output_size( 0 )
+        , _block( [this]( rs2::frame f, const rs2::frame_source & source ) { process( f, source ); } )
+    {
+    }
+
+
+    CNNNetwork async_inference::read_network()
+    {
+        LOG(INFO) << "Loading " << topoName << " model from: " << pathToModel;
+
+        CNNNetwork network;
+
+#ifdef OPENVINO2019
+        CNNNetReader netReader;
+        netReader.ReadNetwork( pathToModel );
+        network = netReader.getNetwork();
+        netReader.ReadWeights( remove_ext( pathToModel ) + ".bin" );
+#else
+        InferenceEngine::Core ie;
+        network = ie.ReadNetwork( pathToModel );
+#endif
+
+        network.setBatchSize( 1 );
+
+        InputsDataMap inputInfo( network.getInputsInfo() );
+        if( inputInfo.size() != 1 )
+            throw std::logic_error( "Async inference network should have only one input" );
+        auto & input = *inputInfo.begin();
+        if( input.second->getTensorDesc().getDims().size() != 4 )
+            throw std::logic_error( "Async inference network input \"" + input.first + "\" should be an image" );
+        _input_layer_name = input.first;
+        // The frame is set as is: the Inference Engine resizes it to the network's input and converts it
+        input.second->setPrecision( _stream == RS2_STREAM_DEPTH ? Precision::U16 : Precision::U8 );
+        input.second->setLayout( Layout::NHWC );
+        input.second->getPreProcess().setResizeAlgorithm( ResizeAlgorithm::RESIZE_BILINEAR );
+
+        OutputsDataMap outputInfo( network.getOutputsInfo() );
+        if( outputInfo.size() != 1 )
+            throw std::logic_error( "Async inference network should have only one output" );
+        _output_layer_name = outputInfo.begin()->first;
+        DataPtr & outputDataPtr = outputInfo.begin()->second;
+        outputDataPtr->setPrecision( Precision::FP32 );
+        _output_size = 1;
+        for( auto dim : outputDataPtr->getTensorDesc().getDims() )
+            _output_size *= dim;
+
+        return network;
+    }
+
+
+    rs2::frame async_inference::get_results( rs2::frameset const & fs ) const
+    {
+        if( ! _results_profile )
+            return rs2::frame();
+        for( auto f : fs )
+            if( f.get_profile().unique_id() == _results_profile.unique_id() )
+                return f;
+        return rs2::frame();
+    }
+
+
+    Blob::Ptr async_inference::wrap_frame( rs2::video_frame const & image ) const
+    {
+        size_t channels;
+        switch( image.get_profile().format() )
+        {
+        case RS2_FORMAT_BGR8:
+        case RS2_FORMAT_RGB8: channels = 3; break;
+        case RS2_FORMAT_Y8:
+        case RS2_FORMAT_Z16: channels = 1; break;
+        default:
+            throw std::runtime_error( std::string( "Async inference does not support " )
+                                      + rs2_format_to_string( image.get_profile().format() ) + " frames" );
+        }
+        size_t const width = image.get_width();
+        size_t const height = image.get_height();
+        size_t const bpp = image.get_bytes_per_pixel();
+        if( size_t( image.get_stride_in_bytes() ) != width * bpp )
+            THROW_IE_EXCEPTION << "Doesn't support frames with padded rows";
+
+        // Set without a copy: the frame is kept alive by its slot until the request completes
+        if( bpp / channels == 2 )
+        {
+            TensorDesc desc( Precision::U16, { 1, channels, height, width }, Layout::NHWC );
+            return make_shared_blob< uint16_t >( desc, (uint16_t *)image.get_data() );
+        }
+        TensorDesc desc( Precision::U8, { 1, channels, height, width }, Layout::NHWC );
+        return make_shared_blob< uint8_t >( desc, (uint8_t *)image.get_data() );
+    }
+
+
+    void async_inference::submit( rs2::frame const & input, rs2::video_frame const & image )
+    {
+        if( _slots.empty() )
+        {
+            _slots.resize( _n_requests );
+            for( size_t i = 0; i < _n_requests; ++i )
+            {
+                _slots[i].request = net.CreateInferRequestPtr();
+                _free.push_back( i );
+            }
+        }
+
+        auto const i = _free.back();
+        auto & s = _slots[i];
+        s.request->SetBlob( _input_layer_name, wrap_frame( image ) );
+        s.frame = input;
+        s.request->StartAsync();
+        _free.pop_back();
+        _in_flight.push_back( i );
+    }
+
+
+    void async_inference::publish_oldest( const rs2::frame_source & source )
+    {
+        auto const i = _in_flight.front();
+        auto & s = _slots[i];
+        s.request->Wait( IInferRequest::WaitMode::RESULT_READY );
+        _in_flight.pop_front();
+        _free.push_back( i );
+        rs2::frame input = std::move( s.frame );
+
+        std::vector< rs2::frame > frames;
+        rs2::video_frame image = input;
+        if( auto fs = input.as< rs2::frameset >() )
+        {
+            for( auto f : fs )
+                frames.push_back( f );
+            image = fs.first( _stream );
+        }
+        else
+            frames.push_back( input );
+
+        int const bytes = int( _output_size * sizeof( float ) );
+        if( ! _results_profile || _results_for != image.get_profile() )
+        {
+            auto vsp = image.get_profile().as< rs2::video_stream_profile >();
+            auto intrinsics = vsp.get_intrinsics();
+            intrinsics.width = bytes;
+            intrinsics.height = 1;
+            _results_profile = vsp.clone( RS2_STREAM_ANY, 0, RS2_FORMAT_RAW8, bytes, 1, intrinsics );
+            _results_for = image.get_profile();
+        }
+        auto results = source.allocate_video_frame( _results_profile, image, 1, bytes, 1, bytes );
+        auto const output = s.request->GetBlob( _output_layer_name );
+        std::memcpy( (void *)results.get_data(), output->buffer().as< float * >(), bytes );
+        if( doRawOutputMessages )
+            LOG(DEBUG) << topoName << " results for frame " << image.get_frame_number();
+
+        frames.push_back( results );
+        source.frame_ready( source.allocate_composite_frame( frames ) );
+    }
+
+
+    void async_inference::process( rs2::frame f, const rs2::frame_source & source )
+    {
+        if( ! enabled() )
+            return;
+
+        rs2::video_frame image = f;
+        if( auto fs = f.as< rs2::frameset >() )
+            image = fs.first_or_default( _stream );
+        if( ! image || image.get_profile().stream_type() != _stream )
+            return;
+
+        // Whatever completed already goes out first, so frames come out in order
+        while( ! _in_flight.empty()
+               && _slots[_in_flight.front()].request->Wait( IInferRequest::WaitMode::STATUS_ONLY ) == StatusCode::OK )
+            publish_oldest( source );
+        if( _free.size() == 0 && ! _slots.empty() )
+            publish_oldest( source );
+
+        submit( f, image );
+    }
+}
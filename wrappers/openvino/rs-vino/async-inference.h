@@ -0,0 +1,85 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "base-detection.h"
+
+#include <deque>
+#include <vector>
+
+
+namespace openvino_helpers
+{
+    /*
+        Runs a network on the frames of one stream as a processing block, with several infer requests in
+        flight, so the rate of the camera is capped by the throughput of the device and not by the latency
+        of each inference.
+
+        The network's input is fed straight from the frame's memory, as an NHWC blob: no conversion copy is
+        made, and the Inference Engine resizes and converts it as part of the network. Color frames (BGR8,
+        RGB8, Y8) go in as U8; depth (Z16) as U16.
+
+        Each frame comes out once its inference completes, in the order they went in, as a frameset holding
+        the original frame(s) and a results frame: the network's (single) output, as FP32, in a RAW8 frame.
+        Use get_results() to find it. Results are published as further frames come in: a frame that finds all
+        the requests busy waits for the oldest one to complete, and those still in flight when frames stop
+        coming are not published.
+
+        Example usage:
+            openvino_helpers::async_inference detector( "face-detection-adas-0001.xml", RS2_STREAM_COLOR );
+            detector.load_into( engine, "CPU" );
+            rs2::frame_queue results;
+            detector.get_block().start( results );
+            ...
+            detector.get_block().invoke( pipe.wait_for_frames() );
+            ...
+            rs2::frameset fs;
+            if( results.poll_for_frame( &fs ) )
+                auto output = detector.get_results( fs ).get_data();  // float *
+    */
+    struct async_inference : public base_detection
+    {
+    private:
+        struct slot
+        {
+            InferenceEngine::InferRequest::Ptr request;
+            rs2::frame frame;  // what went in, kept until the request completes, as the blob is its memory
+        };
+
+        rs2_stream _stream;
+        size_t const _n_requests;
+        std::string _input_layer_name;
+        std::string _output_layer_name;
+        size_t _output_size;               // in floats
+        std::vector< slot > _slots;
+        std::deque< size_t > _in_flight;   // indices into _slots, oldest first
+        std::vector< size_t > _free;
+        rs2::stream_profile _results_profile;
+        rs2::stream_profile _results_for;  // the profile _results_profile was cloned from
+        rs2::processing_block _block;
+
+    public:
+        async_inference( const std::string & pathToModel,
+            rs2_stream stream = RS2_STREAM_COLOR,
+            size_t nRequests = 4,
+            bool doRawOutputMessages = false );
+
+        InferenceEngine::CNNNetwork read_network() override;
+
+        // The processing block to invoke with frames, or framesets holding a frame of the stream
+        rs2::processing_block & get_block() { return _block; }
+
+        // The results frame of a frameset that came out of the block, or an empty frame if none
+        rs2::frame get_results( rs2::frameset const & fs ) const;
+
+        // Number of floats in a results frame
+        size_t get_output_size() const { return _output_size; }
+
+    private:
+        void process( rs2::frame f, const rs2::frame_source & source );
+        void submit( rs2::frame const & input, rs2::video_frame const & image );
+        void publish_oldest( const rs2::frame_source & source );
+        InferenceEngine::Blob::Ptr wrap_frame( rs2::video_frame const & image ) const;
+    };
+}
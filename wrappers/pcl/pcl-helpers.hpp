@@ -0,0 +1,97 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/rs.hpp> // Include RealSense Cross Platform API
+#include <pcl/point_types.h>
+#include <pcl/point_cloud.h>
+#include <algorithm>
+#include <stdexcept>
+
+// Convert rs2::points to an (organized, not dense) pcl::PointCloud of XYZ points
+inline pcl::PointCloud<pcl::PointXYZ>::Ptr points_to_pcl(const rs2::points& points)
+{
+    pcl::PointCloud<pcl::PointXYZ>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZ>);
+
+    auto sp = points.get_profile().as<rs2::video_stream_profile>();
+    cloud->width = static_cast<uint32_t>(sp.width());
+    cloud->height = static_cast<uint32_t>(sp.height());
+    cloud->is_dense = false;
+    cloud->points.resize(points.size());
+
+    auto vertices = points.get_vertices();
+    auto out = cloud->points.data();
+    for (size_t i = 0, n = points.size(); i < n; ++i)
+    {
+        out[i].x = vertices[i].x;
+        out[i].y = vertices[i].y;
+        out[i].z = vertices[i].z;
+    }
+    return cloud;
+}
+
+// Convert rs2::points to a pcl::PointCloud of XYZRGB points, colored from the frame the pointcloud was mapped to
+// (rs2::pointcloud::map_to) through its texture coordinates. The color frame must be RGB8, BGR8, RGBA8 or BGRA8.
+//
+// The texture coordinates are turned into pixel offsets a block at a time, in a loop the compiler vectorizes, and
+// the colors are then gathered from those offsets.
+inline pcl::PointCloud<pcl::PointXYZRGB>::Ptr points_to_pcl(const rs2::points& points, const rs2::video_frame& color)
+{
+    int red = 0, blue = 2;
+    switch (color.get_profile().format())
+    {
+    case RS2_FORMAT_RGB8: case RS2_FORMAT_RGBA8: break;
+    case RS2_FORMAT_BGR8: case RS2_FORMAT_BGRA8: std::swap(red, blue); break;
+    default: throw std::runtime_error("Color frame format is not supported!");
+    }
+
+    pcl::PointCloud<pcl::PointXYZRGB>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZRGB>);
+
+    auto sp = points.get_profile().as<rs2::video_stream_profile>();
+    cloud->width = static_cast<uint32_t>(sp.width());
+    cloud->height = static_cast<uint32_t>(sp.height());
+    cloud->is_dense = false;
+    cloud->points.resize(points.size());
+
+    const int width = color.get_width();
+    const int height = color.get_height();
+    const int bpp = color.get_bytes_per_pixel();
+    const int stride = color.get_stride_in_bytes();
+    const auto texture = reinterpret_cast<const uint8_t*>(color.get_data());
+    const float fw = float(width), fh = float(height);
+
+    auto vertices = points.get_vertices();
+    auto uv = points.get_texture_coordinates();
+    auto out = cloud->points.data();
+
+    static const int block = 256;
+    int offsets[block];
+    const int n = static_cast<int>(points.size());
+    for (int begin = 0; begin < n; begin += block)
+    {
+        const int count = std::min(block, n - begin);
+
+        // Nearest texel, clamped to the frame
+        for (int i = 0; i < count; ++i)
+        {
+            int x = std::min(std::max(int(uv[begin + i].u * fw + .5f), 0), width - 1);
+            int y = std::min(std::max(int(uv[begin + i].v * fh + .5f), 0), height - 1);
+            offsets[i] = y * stride + x * bpp;
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            auto& p = out[begin + i];
+            auto& v = vertices[begin + i];
+            auto texel = texture + offsets[i];
+            p.x = v.x;
+            p.y = v.y;
+            p.z = v.z;
+            p.r = texel[red];
+            p.g = texel[1];
+            p.b = texel[blue];
+        }
+    }
+    return cloud;
+}
@@ -0,0 +1,57 @@
+## License: Apache 2.0. See LICENSE file in root directory.
+## Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#####################################################
+##        Sharing Frames with Worker Processes     ##
+#####################################################
+
+# The depth sensor allocates its frames from a shared-memory pool, and worker
+# processes see each frame's data as a numpy array without it being copied.
+import multiprocessing as mp
+import numpy as np
+import pyrealsense2 as rs
+
+POOL_NAME = "rs-depth-frames"
+
+def worker(handles):
+    while True:
+        handle = handles.get()
+        if handle is None:
+            break
+        # The pool's memory, as is; the frame goes back to the pool when released
+        with rs.shared_frame(handle) as frame:
+            depth = np.asanyarray(frame.get_data())
+            print("frame", handle.frame_number, "mean depth", depth[depth > 0].mean() if depth.any() else 0)
+
+if __name__ == "__main__":
+    ctx = rs.context()
+    sensor = ctx.query_devices()[0].first_depth_sensor()
+    profile = next(p.as_video_stream_profile() for p in sensor.get_stream_profiles()
+                   if p.stream_type() == rs.stream.depth and p.format() == rs.format.z16)
+
+    # Enough slots for the frames in flight: those the workers hold, and those on their way
+    width, height = profile.width(), profile.height()
+    pool = rs.shared_frame_pool(POOL_NAME, slots=16, slot_size=width * height * 2)
+    pool.attach(sensor)
+
+    handles = mp.Queue()
+    workers = [mp.Process(target=worker, args=(handles,)) for _ in range(4)]
+    for w in workers:
+        w.start()
+
+    def on_frame(frame):
+        handle = pool.share(frame)  # None when the pool was full and the library allocated the frame
+        if handle is not None:
+            handles.put(handle)
+
+    sensor.open(profile)
+    sensor.start(on_frame)
+    try:
+        input("Streaming; press Enter to stop\n")
+    finally:
+        sensor.stop()
+        sensor.close()
+        for w in workers:
+            handles.put(None)
+        for w in workers:
+            w.join()
@@ -30,6 +30,7 @@ PYBIND11_MODULE(NAME, m) {
     init_advanced_mode(m);
     init_serializable_device(m);
     init_util(m);
+    init_shared_memory(m);
     
     /** rs_export.hpp **/
     py::class_<rs2::save_to_ply, rs2::filter>(m, "save_to_ply")
@@ -38,7 +39,8 @@ PYBIND11_MODULE(NAME, m) {
         .def_property_readonly_static("option_ply_mesh", [](py::object) { return rs2::save_to_ply::OPTION_PLY_MESH; })
         .def_property_readonly_static("option_ply_binary", [](py::object) { return rs2::save_to_ply::OPTION_PLY_BINARY; })
         .def_property_readonly_static("option_ply_normals", [](py::object) { return rs2::save_to_ply::OPTION_PLY_NORMALS; })
-        .def_property_readonly_static("option_ply_threshold", [](py::object) { return rs2::save_to_ply::OPTION_PLY_THRESHOLD; });
+        .def_property_readonly_static("option_ply_threshold", [](py::object) { return rs2::save_to_ply::OPTION_PLY_THRESHOLD; })
+        .def_property_readonly_static("option_ply_sequence", [](py::object) { return rs2::save_to_ply::OPTION_PLY_SEQUENCE; });
 
     m.def("log_to_console", &rs2::log_to_console, "min_severity"_a);
     m.def("log_to_file", &rs2::log_to_file, "min_severity"_a, "file_path"_a);
@@ -11,6 +11,8 @@ Copyright(c) 2017 Intel Corporation. All Rights Reserved. */
 // For rs2_format
 #include "../include/librealsense2/h/rs_sensor.h"
 
+#include <memory>
+
 // Hacky little bit of half-functions to make .def(BIND_DOWNCAST) look nice for binding as/is functions
 #define BIND_DOWNCAST(class, downcast) "is_"#downcast, &rs2::class::is<rs2::downcast>).def("as_"#downcast, &rs2::class::as<rs2::downcast>
 
@@ -186,6 +188,7 @@ public:
     size_t _ndim = 0;             // Number of dimensions
     std::vector<size_t> _shape;   // Shape of the tensor (1 entry per dimension)
     std::vector<size_t> _strides; // Number of entries between adjacent entries (for each per dimension)
+    std::shared_ptr<void> _owner; // Keeps the storage alive, for buffers that own their data rather than point into a frame
 public:
     BufData(void *ptr, size_t itemsize, const std::string& format, size_t ndim, const std::vector<size_t> &shape, const std::vector<size_t> &strides)
         : _ptr(ptr), _itemsize(itemsize), _format(format), _ndim(ndim), _shape(shape), _strides(strides) {}
@@ -217,3 +220,4 @@ void init_export(py::module &m);
 void init_advanced_mode(py::module &m);
 void init_serializable_device(py::module& m);
 void init_util(py::module &m);
+void init_shared_memory(py::module &m);
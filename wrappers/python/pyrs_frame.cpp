@@ -20,6 +20,125 @@ namespace {
     }
 
 
+    // The BufData format of each pixel size, for video formats we don't break into channels
+    std::string const & bytes_per_pixel_to_format( size_t bpp )
+    {
+        static std::string const formats[] = { "", "@B", "@H", "@I", "@I" };
+        return bpp < sizeof( formats ) / sizeof( *formats ) ? formats[bpp] : formats[0];
+    }
+
+
+    // The DLPack ABI (https://github.com/dmlc/dlpack), unversioned; only what we need to export frames
+    enum { kDLCPU = 1 };
+    enum { kDLInt = 0, kDLUInt = 1, kDLFloat = 2 };
+
+    struct DLDevice { int32_t device_type; int32_t device_id; };
+    struct DLDataType { uint8_t code; uint8_t bits; uint16_t lanes; };
+    struct DLTensor
+    {
+        void * data;
+        DLDevice device;
+        int32_t ndim;
+        DLDataType dtype;
+        int64_t * shape;
+        int64_t * strides;  // in elements
+        uint64_t byte_offset;
+    };
+    struct DLManagedTensor
+    {
+        DLTensor dl_tensor;
+        void * manager_ctx;
+        void ( *deleter )( DLManagedTensor * self );
+    };
+
+    // Keeps the frame alive for as long as the consumer holds the tensor
+    struct dlpack_frame
+    {
+        DLManagedTensor tensor;
+        rs2::frame frame;
+        int64_t shape[3];
+        int64_t strides[3];
+    };
+
+    // The element type and the number of channels of each pixel
+    struct dlpack_pixel { uint8_t code; uint8_t bits; int64_t channels; };
+
+    dlpack_pixel get_dlpack_pixel( rs2_format format, int bpp )
+    {
+        switch( format )
+        {
+        case RS2_FORMAT_Z16: case RS2_FORMAT_DISPARITY16: case RS2_FORMAT_Y16: case RS2_FORMAT_RAW16:
+        case RS2_FORMAT_Y10BPACK: case RS2_FORMAT_FG:
+            return { kDLUInt, 16, 1 };
+        case RS2_FORMAT_DISPARITY32: case RS2_FORMAT_DISTANCE:
+            return { kDLFloat, 32, 1 };
+        case RS2_FORMAT_XYZ32F:
+            return { kDLFloat, 32, 3 };
+        default:
+            return { kDLUInt, 8, bpp };  // packed or multi-channel: bytes
+        }
+    }
+
+    void dlpack_capsule_destructor( PyObject * capsule )
+    {
+        // Renamed to "used_dltensor" once consumed, after which the consumer owns it
+        if( PyCapsule_IsValid( capsule, "dltensor" ) )
+        {
+            auto tensor = static_cast< DLManagedTensor * >( PyCapsule_GetPointer( capsule, "dltensor" ) );
+            tensor->deleter( tensor );
+        }
+    }
+
+    py::capsule frame_to_dlpack( rs2::frame const & f )
+    {
+        if( ! f )
+            throw std::runtime_error( "null frame" );
+
+        auto ctx = new dlpack_frame();
+        ctx->frame = f;
+        auto & t = ctx->tensor.dl_tensor;
+        t.data = const_cast< void * >( f.get_data() );
+        t.device = { kDLCPU, 0 };
+        t.shape = ctx->shape;
+        t.strides = ctx->strides;
+        t.byte_offset = 0;
+        ctx->tensor.manager_ctx = ctx;
+        ctx->tensor.deleter = []( DLManagedTensor * self ) { delete static_cast< dlpack_frame * >( self->manager_ctx ); };
+
+        auto vf = f.as< rs2::video_frame >();
+        auto const pixel = vf ? get_dlpack_pixel( vf.get_profile().format(), vf.get_bytes_per_pixel() )
+                              : dlpack_pixel{ kDLUInt, 8, 1 };
+        auto const item = pixel.bits / 8;
+        t.dtype = { pixel.code, pixel.bits, 1 };
+        if( vf && pixel.channels > 0 && vf.get_stride_in_bytes() % item == 0 )
+        {
+            ctx->shape[0] = vf.get_height();
+            ctx->shape[1] = vf.get_width();
+            ctx->shape[2] = pixel.channels;
+            ctx->strides[0] = vf.get_stride_in_bytes() / item;
+            ctx->strides[1] = pixel.channels;
+            ctx->strides[2] = 1;
+            t.ndim = pixel.channels > 1 ? 3 : 2;
+        }
+        else
+        {
+            // Same as get_data() for non-video frames: the raw bytes
+            t.dtype = { kDLUInt, 8, 1 };
+            ctx->shape[0] = f.get_data_size();
+            ctx->strides[0] = 1;
+            t.ndim = 1;
+        }
+
+        auto capsule = PyCapsule_New( &ctx->tensor, "dltensor", dlpack_capsule_destructor );
+        if( ! capsule )
+        {
+            delete ctx;
+            throw py::error_already_set();
+        }
+        return py::reinterpret_steal< py::capsule >( capsule );
+    }
+
+
 }
 
 
@@ -39,20 +158,19 @@ void init_frame(py::module &m) {
     auto get_frame_data = [](const rs2::frame& self) ->  BufData
     {
         if (auto vf = self.as<rs2::video_frame>()) {
-            std::map<size_t, std::string> bytes_per_pixel_to_format = { { 1, std::string("@B") },{ 2, std::string("@H") },{ 3, std::string("@I") },{ 4, std::string("@I") } };
             switch (vf.get_profile().format()) {
             case RS2_FORMAT_RGB8: case RS2_FORMAT_BGR8:
-                return BufData(const_cast<void*>(vf.get_data()), 1, bytes_per_pixel_to_format[1], 3,
+                return BufData(const_cast<void*>(vf.get_data()), 1, bytes_per_pixel_to_format(1), 3,
                     { static_cast<size_t>(vf.get_height()), static_cast<size_t>(vf.get_width()), 3 },
                     { static_cast<size_t>(vf.get_stride_in_bytes()), static_cast<size_t>(vf.get_bytes_per_pixel()), 1 });
                 break;
             case RS2_FORMAT_RGBA8: case RS2_FORMAT_BGRA8:
-                return BufData(const_cast<void*>(vf.get_data()), 1, bytes_per_pixel_to_format[1], 3,
+                return BufData(const_cast<void*>(vf.get_data()), 1, bytes_per_pixel_to_format(1), 3,
                     { static_cast<size_t>(vf.get_height()), static_cast<size_t>(vf.get_width()), 4 },
                     { static_cast<size_t>(vf.get_stride_in_bytes()), static_cast<size_t>(vf.get_bytes_per_pixel()), 1 });
                 break;
             default:
-                return BufData(const_cast<void*>(vf.get_data()), static_cast<size_t>(vf.get_bytes_per_pixel()), bytes_per_pixel_to_format[vf.get_bytes_per_pixel()], 2,
+                return BufData(const_cast<void*>(vf.get_data()), static_cast<size_t>(vf.get_bytes_per_pixel()), bytes_per_pixel_to_format(vf.get_bytes_per_pixel()), 2,
                     { static_cast<size_t>(vf.get_height()), static_cast<size_t>(vf.get_width()) },
                     { static_cast<size_t>(vf.get_stride_in_bytes()), static_cast<size_t>(vf.get_bytes_per_pixel()) });
             }
@@ -125,7 +243,7 @@ void init_frame(py::module &m) {
     pose_stream_profile.def(py::init<const rs2::stream_profile&>(), "sp"_a);
 
     py::class_<rs2::filter_interface> filter_interface(m, "filter_interface", "Interface for frame filtering functionality");
-    filter_interface.def("process", &rs2::filter_interface::process, "frame"_a); // No docstring in C++
+    filter_interface.def("process", &rs2::filter_interface::process, "frame"_a, py::call_guard<py::gil_scoped_release>()); // No docstring in C++
 
     py::class_<rs2::frame> frame(m, "frame", "Base class for multiple frame extensions");
     frame.def(py::init<>())
@@ -145,6 +263,12 @@ void init_frame(py::module &m) {
         .def("get_data_size", &rs2::frame::get_data_size, "Retrieve data size from frame handle.")
         .def("get_data", get_frame_data, "Retrieve data from the frame handle.", py::keep_alive<0, 1>())
         .def_property_readonly("data", get_frame_data, "Data from the frame handle. Identical to calling get_data.", py::keep_alive<0, 1>())
+        .def("__dlpack__", []( const rs2::frame& self, py::args, py::kwargs ) { return frame_to_dlpack( self ); },
+             "Export the frame data as a DLPack capsule, without copying; the frame is kept alive by the capsule. "
+             "Video frames are (height, width[, channels]) with a row stride; other frames are raw bytes. "
+             "Frames are always in host memory, so 'stream' and the other arguments are ignored.")
+        .def("__dlpack_device__", []( const rs2::frame& ) { return py::make_tuple( int( kDLCPU ), 0 ); },
+             "The DLPack device of the frame data: always the CPU")
         .def("get_profile", &rs2::frame::get_profile, "Retrieve stream profile from frame handle.")
         .def_property_readonly("profile", &rs2::frame::get_profile, "Stream profile from frame handle. Identical to calling get_profile.")
         .def("keep", &rs2::frame::keep, "Keep the frame, otherwise if no refernce to the frame, the frame will be released.")
@@ -270,12 +394,61 @@ void init_frame(py::module &m) {
                 throw std::domain_error("dims arg only supports values of 1, 2 or 3");
             }
         }, "Retrieve the texture coordinates (uv map) for the point cloud", py::keep_alive<0, 1>(), "dims"_a=1)
+        .def("to_xyzrgb", [](rs2::points& self, rs2::video_frame const& color, int dims) {
+            // Which bytes of a color pixel hold r, g and b
+            int r, g, b;
+            switch (color.get_profile().format()) {
+            case RS2_FORMAT_RGB8: case RS2_FORMAT_RGBA8: r = 0; g = 1; b = 2; break;
+            case RS2_FORMAT_BGR8: case RS2_FORMAT_BGRA8: r = 2; g = 1; b = 0; break;
+            case RS2_FORMAT_Y8: r = g = b = 0; break;
+            default: throw std::domain_error("color frame must be RGB8, BGR8, RGBA8, BGRA8 or Y8");
+            }
+            if (dims != 2 && dims != 3)
+                throw std::domain_error("dims arg only supports values of 2 or 3");
+
+            auto verts = self.get_vertices();
+            auto tex = self.get_texture_coordinates();
+            size_t n = self.size();
+            auto out = std::make_shared<std::vector<float>>(n * 6);
+            auto data = static_cast<const uint8_t*>(color.get_data());
+            int const w = color.get_width(), h = color.get_height();
+            int const bpp = color.get_bytes_per_pixel(), stride = color.get_stride_in_bytes();
+            auto xyzrgb = out->data();
+            for (size_t i = 0; i < n; ++i, xyzrgb += 6) {
+                xyzrgb[0] = verts[i].x;
+                xyzrgb[1] = verts[i].y;
+                xyzrgb[2] = verts[i].z;
+                // Same sampling as export_to_ply
+                int x = std::min(std::max(int(tex[i].u * w + .5f), 0), w - 1);
+                int y = std::min(std::max(int(tex[i].v * h + .5f), 0), h - 1);
+                auto pixel = data + y * stride + x * bpp;
+                xyzrgb[3] = pixel[r];
+                xyzrgb[4] = pixel[g];
+                xyzrgb[5] = pixel[b];
+            }
+
+            auto profile = self.get_profile().as<rs2::video_stream_profile>();
+            size_t ph = profile.height(), pw = profile.width();
+            auto buf = dims == 2 ? BufData(out->data(), sizeof(float), "@f", 6, n)
+                                 : BufData(out->data(), sizeof(float), "@f", 3, { ph, pw, 6 }, { pw*6*sizeof(float), 6*sizeof(float), sizeof(float) });
+            buf._owner = out;
+            return buf;
+        }, "Sample the color frame at the texture coordinates of each point (as mapped by pointcloud.map_to), returning a new buffer of x, y, z, r, g, b "
+           "floats per point (colors are 0-255, in RGB order whatever the color format). Computed natively, instead of "
+           "gathering colors through the uv map in Python.",
+           "color_frame"_a, "dims"_a=2, py::call_guard<py::gil_scoped_release>())
         .def("export_to_ply", &rs2::points::export_to_ply, "Export the point cloud to a PLY file")
         .def("size", &rs2::points::size); // No docstring in C++
 
     py::class_<rs2::depth_frame, rs2::video_frame> depth_frame(m, "depth_frame", "Extends the video_frame class with additional depth related attributes and functions.");
     depth_frame.def(py::init<rs2::frame>())
         .def("get_distance", &rs2::depth_frame::get_distance, "x"_a, "y"_a, "Provide the depth in meters at the given pixel")
+        .def("get_distances", [](const rs2::depth_frame& self, const std::vector<std::array<int, 2>>& pixels) {
+            std::vector<float> distances(pixels.size());
+            if (!pixels.empty())
+                self.get_distances(pixels[0].data(), int(pixels.size()), distances.data());
+            return distances;
+        }, "pixels"_a, "Provide the depth in meters at each of the given (x, y) pixels, in a single call")
         .def("get_units", &rs2::depth_frame::get_units, "Provide the scaling factor to use when converting from get_data() units to meters");
     
     // rs2::disparity_frame
@@ -41,6 +41,20 @@ void init_processing(py::module &m) {
             auto success = self.try_wait_for_frame(&frame, timeout_ms);
             return std::make_tuple(success, frame);
         }, "timeout_ms"_a = 5000, py::call_guard<py::gil_scoped_release>()) // No docstring in C++
+        .def("wait_for_frame_batch", [](const rs2::frame_queue &self, unsigned int max_frames, unsigned int timeout_ms) {
+            // Collected without the GIL; only the conversion of the result to a list needs it
+            std::vector<rs2::frame> frames;
+            rs2::frame frame;
+            if (max_frames && self.try_wait_for_frame(&frame, timeout_ms))
+            {
+                frames.push_back(std::move(frame));
+                while (frames.size() < max_frames && self.poll_for_frame(&frame))
+                    frames.push_back(std::move(frame));
+            }
+            return frames;
+        }, "Wait until a frame becomes available, then dequeue it along with any others already in the queue, up to "
+           "max_frames of them. Returns an empty list on timeout.", "max_frames"_a, "timeout_ms"_a = 5000,
+           py::call_guard<py::gil_scoped_release>())
         .def("__call__", &rs2::frame_queue::operator(), "Identical to calling enqueue.", "f"_a)
         .def("capacity", &rs2::frame_queue::capacity, "Return the capacity of the queue.")
         .def("size", &rs2::frame_queue::size, "Number of enqueued frames.")
@@ -80,7 +94,7 @@ void init_processing(py::module &m) {
     py::class_<rs2::pointcloud, rs2::filter> pointcloud(m, "pointcloud", "Generates 3D point clouds based on a depth frame. Can also map textures from a color frame.");
     pointcloud.def(py::init<>())
         .def(py::init<rs2_stream, int>(), "stream"_a, "index"_a = 0)
-        .def("calculate", &rs2::pointcloud::calculate, "Generate the pointcloud and texture mappings of depth map.", "depth"_a)
+        .def("calculate", &rs2::pointcloud::calculate, "Generate the pointcloud and texture mappings of depth map.", "depth"_a, py::call_guard<py::gil_scoped_release>())
         .def("map_to", &rs2::pointcloud::map_to, "Map the point cloud to the given color frame.", "mapped"_a);
 
     py::class_<rs2::yuy_decoder, rs2::filter> yuy_decoder(m, "yuy_decoder", "Converts frames in raw YUY format to RGB. This conversion is somewhat costly, "
@@ -109,6 +123,17 @@ void init_processing(py::module &m) {
         auto success = self.try_wait_for_frames( &fs, timeout_ms );
         return std::make_tuple( success, fs );
     };
+    auto wait_for_frame_batch = []( const rs2::syncer & self, unsigned int max_frames, unsigned int timeout_ms ) {
+        std::vector< rs2::frameset > sets;
+        rs2::frameset fs;
+        if( max_frames && self.try_wait_for_frames( &fs, timeout_ms ) )
+        {
+            sets.push_back( std::move( fs ) );
+            while( sets.size() < max_frames && self.poll_for_frames( &fs ) )
+                sets.push_back( std::move( fs ) );
+        }
+        return sets;
+    };
     syncer.def( py::init< int >(), "queue_size"_a = 1 )
         .def( "wait_for_frames",
               &rs2::syncer::wait_for_frames,
@@ -129,6 +154,13 @@ void init_processing(py::module &m) {
         .def( "try_wait_for_frame",  // same, but with a name that matches frame_queue!
               wait_for_frame,
               "timeout_ms"_a = 5000,
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "wait_for_frame_batch",
+              wait_for_frame_batch,
+              "Wait until a coherent set of frames becomes available, then return it along with any others already "
+              "synchronized, up to max_frames of them. Returns an empty list on timeout.",
+              "max_frames"_a,
+              "timeout_ms"_a = 5000,
               py::call_guard< py::gil_scoped_release >() );
       /*.def("__call__", &rs2::syncer::operator(), "frame"_a)*/
 
@@ -136,7 +168,7 @@ void init_processing(py::module &m) {
     align.def(py::init<rs2_stream>(), "To perform alignment of a depth image to the other, set the align_to parameter with the other stream type.\n"
               "To perform alignment of a non depth image to a depth image, set the align_to parameter to RS2_STREAM_DEPTH.\n"
               "Camera calibration and frame's stream type are determined on the fly, according to the first valid frameset passed to process().", "align_to"_a)
-        .def("process", (rs2::frameset(rs2::align::*)(rs2::frameset)) &rs2::align::process, "Run thealignment process on the given frames to get an aligned set of frames", "frames"_a);
+        .def("process", (rs2::frameset(rs2::align::*)(rs2::frameset)) &rs2::align::process, "Run thealignment process on the given frames to get an aligned set of frames", "frames"_a, py::call_guard<py::gil_scoped_release>());
 
     py::class_<rs2::colorizer, rs2::filter> colorizer(m, "colorizer", "Colorizer filter generates color images based on input depth frame");
     colorizer.def(py::init<>())
@@ -195,6 +227,14 @@ void init_processing(py::module &m) {
     py::class_<rs2::sequence_id_filter, rs2::filter> sequence_id_filter(m, "sequence_id_filter", "Splits depth frames with different sequence ID");
     sequence_id_filter.def(py::init<>())
         .def(py::init<float>(), "sequence_id"_a);
+
+    py::class_<rs2::rectify, rs2::filter> rectify(m, "rectify", "Undistorts color frames into a pinhole image with the same focal length and principal point");
+    rectify.def(py::init<>());
+
+    py::class_<rs2::fused_pointcloud, rs2::filter> fused_pointcloud(m, "fused_pointcloud", "Merges the depth frames of several cameras into the points of the whole rig");
+    fused_pointcloud.def(py::init<>())
+        .def("set_extrinsics", &rs2::fused_pointcloud::set_extrinsics, "Set where a camera is in the rig, by its serial number", "serial"_a, "extrinsics"_a)
+        .def("calculate", &rs2::fused_pointcloud::calculate, "Generate the points of all the depth frames in a frameset", "frames"_a);
     // rs2::rates_printer
     /** end rs_processing.hpp **/
 }
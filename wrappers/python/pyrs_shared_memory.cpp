@@ -0,0 +1,441 @@
+/* License: Apache 2.0. See LICENSE file in root directory.
+Copyright(c) 2024 Intel Corporation. All Rights Reserved. */
+
+#include "pyrealsense2.h"
+#include <librealsense2/rs.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace {
+
+
+    // The reference counts live in the shared memory itself, so they can only be lock-free atomics
+    static_assert( ATOMIC_INT_LOCK_FREE == 2, "shared frame pools need lock-free atomic ints" );
+
+    uint32_t const pool_magic = 0x52535346;  // "RSSF"
+
+    // What the region starts with; the slots follow, at data_offset
+    struct pool_header
+    {
+        uint32_t magic;
+        uint32_t slots;
+        uint64_t slot_size;
+        uint64_t data_offset;
+        std::atomic< int32_t > refs[1];  // one per slot: 0 for a free slot
+    };
+
+    size_t header_size( size_t slots )
+    {
+        size_t const size = offsetof( pool_header, refs ) + slots * sizeof( std::atomic< int32_t > );
+        return ( size + 63 ) / 64 * 64;  // slots start on a cache line
+    }
+
+
+    // A named shared-memory region mapped into this process: the one that created it removes the name when done, while
+    // the others keep their mappings for as long as they need them
+    class shared_region
+    {
+        std::string _name;
+        void * _base = nullptr;
+        size_t _size = 0;
+        bool _owner = false;
+#ifdef _WIN32
+        HANDLE _mapping = nullptr;
+#endif
+
+    public:
+        shared_region( std::string const & name, size_t size )  // create
+            : _name( name ), _size( size ), _owner( true )
+        {
+#ifdef _WIN32
+            _mapping = CreateFileMappingA( INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                           DWORD( uint64_t( size ) >> 32 ), DWORD( size ), name.c_str() );
+            if( ! _mapping || GetLastError() == ERROR_ALREADY_EXISTS )
+            {
+                if( _mapping )
+                    CloseHandle( _mapping );
+                throw std::runtime_error( "failed to create shared memory '" + name + "'" );
+            }
+            _base = MapViewOfFile( _mapping, FILE_MAP_ALL_ACCESS, 0, 0, size );
+#else
+            int fd = shm_open( posix_name().c_str(), O_CREAT | O_EXCL | O_RDWR, 0600 );
+            if( fd < 0 )
+                throw std::runtime_error( "failed to create shared memory '" + name + "'" );
+            if( ftruncate( fd, off_t( size ) ) == 0 )
+                _base = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+            close( fd );
+            if( _base == MAP_FAILED )
+                _base = nullptr;
+#endif
+            if( ! _base )
+            {
+                close_region();
+                throw std::runtime_error( "failed to map shared memory '" + name + "'" );
+            }
+        }
+
+        explicit shared_region( std::string const & name )  // open
+            : _name( name )
+        {
+#ifdef _WIN32
+            _mapping = OpenFileMappingA( FILE_MAP_ALL_ACCESS, FALSE, name.c_str() );
+            if( ! _mapping )
+                throw std::runtime_error( "no shared memory '" + name + "'" );
+            _base = MapViewOfFile( _mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0 );
+            MEMORY_BASIC_INFORMATION info;
+            if( _base && VirtualQuery( _base, &info, sizeof( info ) ) )
+                _size = info.RegionSize;
+#else
+            int fd = shm_open( posix_name().c_str(), O_RDWR, 0 );
+            if( fd < 0 )
+                throw std::runtime_error( "no shared memory '" + name + "'" );
+            struct stat st;
+            if( fstat( fd, &st ) == 0 && st.st_size > 0 )
+            {
+                _size = size_t( st.st_size );
+                _base = mmap( nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+            }
+            close( fd );
+            if( _base == MAP_FAILED )
+                _base = nullptr;
+#endif
+            if( ! _base )
+            {
+                close_region();
+                throw std::runtime_error( "failed to map shared memory '" + name + "'" );
+            }
+        }
+
+        ~shared_region() { close_region(); }
+
+        shared_region( shared_region const & ) = delete;
+        shared_region & operator=( shared_region const & ) = delete;
+
+        std::string const & name() const { return _name; }
+        uint8_t * base() const { return static_cast< uint8_t * >( _base ); }
+        size_t size() const { return _size; }
+
+    private:
+        std::string posix_name() const { return _name.empty() || _name[0] != '/' ? '/' + _name : _name; }
+
+        void close_region()
+        {
+#ifdef _WIN32
+            if( _base )
+                UnmapViewOfFile( _base );
+            if( _mapping )
+                CloseHandle( _mapping );
+            _mapping = nullptr;
+#else
+            if( _base )
+                munmap( _base, _size );
+            if( _owner )
+                shm_unlink( posix_name().c_str() );
+#endif
+            _base = nullptr;
+        }
+    };
+
+
+    // The slots of a pool, as mapped into this process
+    class frame_pool_memory
+    {
+        shared_region _region;
+        pool_header * _header;
+        std::atomic< uint32_t > _next{ 0 };  // where the search for a free slot starts
+
+    public:
+        frame_pool_memory( std::string const & name, uint32_t slots, size_t slot_size )
+            : _region( name, header_size( slots ) + slots * slot_size )
+            , _header( reinterpret_cast< pool_header * >( _region.base() ) )
+        {
+            for( uint32_t i = 0; i < slots; ++i )
+                new( &_header->refs[i] ) std::atomic< int32_t >( 0 );
+            _header->slots = slots;
+            _header->slot_size = slot_size;
+            _header->data_offset = header_size( slots );
+            _header->magic = pool_magic;
+        }
+
+        explicit frame_pool_memory( std::string const & name )
+            : _region( name )
+            , _header( reinterpret_cast< pool_header * >( _region.base() ) )
+        {
+            if( _region.size() < sizeof( pool_header ) || _header->magic != pool_magic
+                || _region.size() < _header->data_offset + _header->slots * _header->slot_size )
+                throw std::runtime_error( "'" + name + "' is not a shared frame pool" );
+        }
+
+        std::string const & name() const { return _region.name(); }
+        uint32_t slots() const { return _header->slots; }
+        size_t slot_size() const { return size_t( _header->slot_size ); }
+        uint8_t * slot_data( uint32_t slot ) const { return _region.base() + _header->data_offset + slot * _header->slot_size; }
+
+        // The slot 'data' points into, or -1 if it is not in the pool
+        int64_t slot_of( void const * data ) const
+        {
+            auto const p = static_cast< uint8_t const * >( data );
+            if( p < slot_data( 0 ) || p >= slot_data( slots() ) )
+                return -1;
+            return int64_t( ( p - slot_data( 0 ) ) / slot_size() );
+        }
+
+        // A free slot, now with a single reference; null if they are all in use
+        void * take()
+        {
+            auto const n = slots();
+            auto const first = _next++;
+            for( uint32_t i = 0; i < n; ++i )
+            {
+                auto const slot = ( first + i ) % n;
+                int32_t expected = 0;
+                if( _header->refs[slot].compare_exchange_strong( expected, 1 ) )
+                    return slot_data( slot );
+            }
+            return nullptr;
+        }
+
+        void add_ref( uint32_t slot ) { ++_header->refs[slot]; }
+        void release( uint32_t slot ) { --_header->refs[slot]; }
+        int32_t refs( uint32_t slot ) const { return _header->refs[slot].load(); }
+
+        // The pools other processes opened, so one mapping serves all their frames
+        static std::shared_ptr< frame_pool_memory > open( std::string const & name )
+        {
+            static std::mutex mutex;
+            static std::map< std::string, std::weak_ptr< frame_pool_memory > > pools;
+            std::lock_guard< std::mutex > lock( mutex );
+            auto & pool = pools[name];
+            auto memory = pool.lock();
+            if( ! memory )
+                pool = memory = std::make_shared< frame_pool_memory >( name );
+            return memory;
+        }
+    };
+
+
+    // What another process needs to find a frame in a pool, and see it as the frame it was; pickled to get there
+    struct shared_frame_handle
+    {
+        std::string pool;
+        uint32_t slot = 0;
+        size_t size = 0;
+        int width = 0, height = 0, stride = 0, bpp = 0;
+        rs2_format format = RS2_FORMAT_ANY;
+        unsigned long long frame_number = 0;
+        double timestamp = 0;
+    };
+
+
+    // Holds one reference to a slot, for as long as the frame is in use in this process
+    struct shared_frame
+    {
+        std::shared_ptr< frame_pool_memory > memory;
+        shared_frame_handle handle;
+        bool released = false;
+
+        explicit shared_frame( shared_frame_handle const & h )
+            : memory( frame_pool_memory::open( h.pool ) )
+            , handle( h )
+        {
+            if( h.slot >= memory->slots() || h.size > memory->slot_size() )
+                throw std::runtime_error( "invalid handle for shared frame pool '" + h.pool + "'" );
+        }
+        ~shared_frame() { release(); }
+
+        void release()
+        {
+            if( ! released )
+                memory->release( handle.slot );
+            released = true;
+        }
+
+        BufData data( std::shared_ptr< shared_frame > const & self ) const
+        {
+            if( released )
+                throw std::runtime_error( "shared frame was released" );
+            void * ptr = memory->slot_data( handle.slot );
+            BufData buf = [&]() {
+                if( ! handle.width || ! handle.height || ! handle.bpp )
+                    return BufData( ptr, 1, std::string( "@B" ), handle.size );
+                auto const h = size_t( handle.height ), w = size_t( handle.width );
+                auto const stride = size_t( handle.stride ), bpp = size_t( handle.bpp );
+                switch( handle.format )
+                {
+                case RS2_FORMAT_RGB8: case RS2_FORMAT_BGR8:
+                case RS2_FORMAT_RGBA8: case RS2_FORMAT_BGRA8:
+                    return BufData( ptr, 1, std::string( "@B" ), 3, { h, w, bpp }, { stride, bpp, 1 } );
+                default:
+                    break;
+                }
+                static std::string const formats[] = { "", "@B", "@H", "@I", "@I" };
+                if( bpp == 1 || bpp == 2 || bpp == 4 )
+                    return BufData( ptr, bpp, formats[bpp], 2, { h, w }, { stride, bpp } );
+                return BufData( ptr, 1, std::string( "@B" ), 2, { h, stride }, { stride, 1 } );
+            }();
+            buf._owner = self;  // the reference goes with the last view of the data
+            return buf;
+        }
+    };
+
+
+    // Allocates the payloads of a sensor's frames from a pool; frames that do not fit, or that come when all the slots
+    // are in use, get the library's own buffers
+    class shared_pool_allocator : public rs2_frame_allocator
+    {
+        std::shared_ptr< frame_pool_memory > _memory;
+
+    public:
+        explicit shared_pool_allocator( std::shared_ptr< frame_pool_memory > memory )
+            : _memory( std::move( memory ) )
+        {
+        }
+
+        void * allocate( size_t size ) override { return size <= _memory->slot_size() ? _memory->take() : nullptr; }
+        void deallocate( void * buffer, size_t ) override
+        {
+            auto const slot = _memory->slot_of( buffer );
+            if( slot >= 0 )
+                _memory->release( uint32_t( slot ) );
+        }
+        void release() override { delete this; }
+    };
+
+
+    struct shared_frame_pool
+    {
+        std::shared_ptr< frame_pool_memory > memory;
+
+        shared_frame_pool( std::string const & name, uint32_t slots, size_t slot_size )
+        {
+            if( ! slots || ! slot_size )
+                throw std::invalid_argument( "a shared frame pool needs slots of some size" );
+            memory = std::make_shared< frame_pool_memory >( name, slots, ( slot_size + 63 ) / 64 * 64 );
+        }
+
+        void attach( rs2::sensor const & sensor )
+        {
+            rs2_error * e = nullptr;
+            rs2_set_frame_allocator_cpp( sensor.get().get(), new shared_pool_allocator( memory ), &e );
+            rs2::error::handle( e );
+        }
+
+        // A handle with a reference of its own, for one other process to open; None if the frame is not in the pool
+        py::object share( rs2::frame const & f )
+        {
+            auto const slot = f ? memory->slot_of( f.get_data() ) : -1;
+            if( slot < 0 )
+                return py::none();
+
+            shared_frame_handle h;
+            h.pool = memory->name();
+            h.slot = uint32_t( slot );
+            h.size = size_t( f.get_data_size() );
+            if( auto vf = f.as< rs2::video_frame >() )
+            {
+                h.width = vf.get_width();
+                h.height = vf.get_height();
+                h.stride = vf.get_stride_in_bytes();
+                h.bpp = vf.get_bytes_per_pixel();
+            }
+            h.format = f.get_profile().format();
+            h.frame_number = f.get_frame_number();
+            h.timestamp = f.get_timestamp();
+            memory->add_ref( h.slot );
+            return py::cast( h );
+        }
+    };
+
+
+}  // namespace
+
+
+void init_shared_memory( py::module & m )
+{
+    py::class_< shared_frame_handle > handle( m, "shared_frame_handle",
+        "Identifies a frame in a shared_frame_pool, for another process to open as a shared_frame. Each handle holds a "
+        "reference to the frame, which the shared_frame opened from it releases: open it exactly once." );
+    handle.def_readonly( "pool", &shared_frame_handle::pool )
+        .def_readonly( "slot", &shared_frame_handle::slot )
+        .def_readonly( "size", &shared_frame_handle::size )
+        .def_readonly( "width", &shared_frame_handle::width )
+        .def_readonly( "height", &shared_frame_handle::height )
+        .def_readonly( "stride", &shared_frame_handle::stride )
+        .def_readonly( "bytes_per_pixel", &shared_frame_handle::bpp )
+        .def_readonly( "format", &shared_frame_handle::format )
+        .def_readonly( "frame_number", &shared_frame_handle::frame_number )
+        .def_readonly( "timestamp", &shared_frame_handle::timestamp )
+        .def( py::pickle(
+            []( shared_frame_handle const & h ) {
+                return py::make_tuple( h.pool, h.slot, h.size, h.width, h.height, h.stride, h.bpp, h.format,
+                                       h.frame_number, h.timestamp );
+            },
+            []( py::tuple t ) {
+                if( t.size() != 10 )
+                    throw std::runtime_error( "invalid shared_frame_handle state" );
+                shared_frame_handle h;
+                h.pool = t[0].cast< std::string >();
+                h.slot = t[1].cast< uint32_t >();
+                h.size = t[2].cast< size_t >();
+                h.width = t[3].cast< int >();
+                h.height = t[4].cast< int >();
+                h.stride = t[5].cast< int >();
+                h.bpp = t[6].cast< int >();
+                h.format = t[7].cast< rs2_format >();
+                h.frame_number = t[8].cast< unsigned long long >();
+                h.timestamp = t[9].cast< double >();
+                return h;
+            } ) );
+
+    py::class_< shared_frame, std::shared_ptr< shared_frame > > frame( m, "shared_frame",
+        "A frame of a shared_frame_pool, opened from a shared_frame_handle in any process. Its data (get_data(), or "
+        "the buffer protocol) is the pool's memory, without a copy; the frame goes back to the pool once this and every "
+        "other reference to it are released." );
+    frame.def( py::init< shared_frame_handle const & >(), "handle"_a )
+        .def( "get_data", []( std::shared_ptr< shared_frame > const & self ) { return self->data( self ); },
+              "The frame's data, as a buffer (e.g., for numpy.asanyarray) that keeps the frame until it is gone" )
+        .def_property_readonly( "data", []( std::shared_ptr< shared_frame > const & self ) { return self->data( self ); },
+              "The frame's data. Identical to calling get_data." )
+        .def_property_readonly( "handle", []( shared_frame const & self ) { return self.handle; } )
+        .def( "release", &shared_frame::release,
+              "Give up this reference to the frame now, rather than when the object is collected; any buffer obtained "
+              "from get_data() must not be used after this" )
+        .def( "__enter__", []( std::shared_ptr< shared_frame > const & self ) { return self; } )
+        .def( "__exit__", []( shared_frame & self, py::args ) { self.release(); } );
+
+    py::class_< shared_frame_pool > pool( m, "shared_frame_pool",
+        "A named shared-memory pool of frame buffers. Sensors attached to it allocate their frames from the pool, and "
+        "share() hands out handles that other processes (e.g., multiprocessing workers) open as a shared_frame, to see "
+        "the frame's data without any copy. Frames are reference-counted across processes: a buffer is reused only "
+        "once the sensor's frame and every shared_frame of it are released. Only frames the sensor allocates itself are "
+        "in the pool, so formats that are converted after arriving (e.g., RGB8 made from YUYV) are not." );
+    pool.def( py::init< std::string const &, uint32_t, size_t >(), "name"_a, "slots"_a, "slot_size"_a )
+        .def( "attach", &shared_frame_pool::attach, "Allocate the frames of a sensor from the pool, from now on",
+              "sensor"_a )
+        .def( "share", &shared_frame_pool::share,
+              "A handle to the frame, for another process to open; None if the frame is not in the pool", "frame"_a )
+        .def_property_readonly( "name", []( shared_frame_pool const & self ) { return self.memory->name(); } )
+        .def_property_readonly( "slots", []( shared_frame_pool const & self ) { return self.memory->slots(); } )
+        .def_property_readonly( "slot_size", []( shared_frame_pool const & self ) { return self.memory->slot_size(); } )
+        .def( "get_references", []( shared_frame_pool const & self, uint32_t slot ) {
+                  if( slot >= self.memory->slots() )
+                      throw std::out_of_range( "no such slot" );
+                  return self.memory->refs( slot );
+              }, "How many references there are to the frame in a slot (0 if it is free)", "slot"_a );
+}
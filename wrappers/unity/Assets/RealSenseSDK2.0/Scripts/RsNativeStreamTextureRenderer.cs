@@ -0,0 +1,186 @@
+using Intel.RealSense;
+using System;
+using System.Runtime.InteropServices;
+using UnityEngine;
+using UnityEngine.Events;
+
+/// <summary>
+/// Like RsStreamTextureRenderer, but frames are uploaded to the texture by the realsense2-unity native plugin, on
+/// Unity's render thread: managed code only hands over the frame, from the frame callback, and binds the texture.
+/// Requires the OpenGL Core graphics API; the texture may change (and be bound again) when the stream's resolution does.
+/// </summary>
+public class RsNativeStreamTextureRenderer : MonoBehaviour
+{
+    private const string dllName = "realsense2-unity";
+
+    [DllImport(dllName)]
+    private static extern int rs2_unity_create_texture();
+
+    [DllImport(dllName)]
+    private static extern void rs2_unity_destroy_texture(int id);
+
+    [DllImport(dllName)]
+    private static extern void rs2_unity_set_frame(int id, IntPtr frame);
+
+    [DllImport(dllName)]
+    private static extern uint rs2_unity_get_texture(int id, out int width, out int height, out Format format);
+
+    [DllImport(dllName)]
+    private static extern IntPtr rs2_unity_get_render_event_func();
+
+    private static TextureFormat Convert(Format lrsFormat)
+    {
+        switch (lrsFormat)
+        {
+            case Format.Z16:
+            case Format.Disparity16:
+            case Format.Y16:
+            case Format.Raw16:
+                return TextureFormat.R16;
+            case Format.Y8:
+            case Format.Raw8:
+                return TextureFormat.R8;
+            case Format.Rgb8:
+            case Format.Bgr8:
+                return TextureFormat.RGB24;
+            case Format.Rgba8:
+            case Format.Bgra8:
+                return TextureFormat.RGBA32;
+            case Format.Disparity32:
+                return TextureFormat.RFloat;
+            default:
+                throw new ArgumentException(string.Format("librealsense format: {0}, is not supported by the native plugin", lrsFormat));
+        }
+    }
+
+    public RsFrameProvider Source;
+
+    [System.Serializable]
+    public class TextureEvent : UnityEvent<Texture> { }
+
+    public Stream _stream;
+    public Format _format;
+    public int _streamIndex;
+
+    public FilterMode filterMode = FilterMode.Point;
+
+    protected Texture2D texture;
+
+    [Space]
+    public TextureEvent textureBinding;
+
+    int id;
+    uint textureName;
+    IntPtr renderEvent;
+    Predicate<Frame> matcher;
+
+    void Start()
+    {
+        if (SystemInfo.graphicsDeviceType != UnityEngine.Rendering.GraphicsDeviceType.OpenGLCore)
+        {
+            Debug.LogWarning("RsNativeStreamTextureRenderer requires the OpenGL Core graphics API; use RsStreamTextureRenderer instead");
+            enabled = false;
+            return;
+        }
+
+        id = rs2_unity_create_texture();
+        renderEvent = rs2_unity_get_render_event_func();
+        matcher = new Predicate<Frame>(Matches);
+        Source.OnStart += OnStartStreaming;
+        Source.OnStop += OnStopStreaming;
+    }
+
+    void OnDestroy()
+    {
+        if (Source != null)
+            Source.OnNewSample -= OnNewSample;
+
+        if (texture != null)
+        {
+            Destroy(texture);
+            texture = null;
+        }
+
+        if (id != 0)
+        {
+            rs2_unity_destroy_texture(id);
+            // Let the render thread delete the GL objects
+            GL.IssuePluginEvent(renderEvent, id);
+            id = 0;
+        }
+    }
+
+    protected void OnStopStreaming()
+    {
+        Source.OnNewSample -= OnNewSample;
+    }
+
+    public void OnStartStreaming(PipelineProfile activeProfile)
+    {
+        Source.OnNewSample += OnNewSample;
+    }
+
+    private bool Matches(Frame f)
+    {
+        using (var p = f.Profile)
+            return p.Stream == _stream && p.Format == _format && (p.Index == _streamIndex || _streamIndex == -1);
+    }
+
+    // On the frame callback's thread: the plugin keeps its own reference to the frame, until it is uploaded
+    void OnNewSample(Frame frame)
+    {
+        try
+        {
+            if (frame.IsComposite)
+            {
+                using (var fs = frame.As<FrameSet>())
+                using (var f = fs.FirstOrDefault(matcher))
+                {
+                    if (f != null)
+                        rs2_unity_set_frame(id, f.Handle);
+                    return;
+                }
+            }
+
+            if (matcher(frame))
+                rs2_unity_set_frame(id, frame.Handle);
+        }
+        catch (Exception e)
+        {
+            Debug.LogException(e);
+        }
+    }
+
+    protected void LateUpdate()
+    {
+        if (id == 0)
+            return;
+
+        // Uploads the latest frame on the render thread, once this frame's rendering gets there
+        GL.IssuePluginEvent(renderEvent, id);
+
+        int width, height;
+        Format format;
+        uint name = rs2_unity_get_texture(id, out width, out height, out format);
+        if (name == 0 || name == textureName)
+            return;
+        textureName = name;
+
+        if (texture != null && texture.width == width && texture.height == height && texture.format == Convert(format))
+        {
+            texture.UpdateExternalTexture((IntPtr)name);
+            return;
+        }
+
+        if (texture != null)
+            Destroy(texture);
+
+        bool linear = (QualitySettings.activeColorSpace != ColorSpace.Linear)
+            || (_stream != Stream.Color && _stream != Stream.Infrared);
+        texture = Texture2D.CreateExternalTexture(width, height, Convert(format), false, linear, (IntPtr)name);
+        texture.wrapMode = TextureWrapMode.Clamp;
+        texture.filterMode = filterMode;
+
+        textureBinding.Invoke(texture);
+    }
+}
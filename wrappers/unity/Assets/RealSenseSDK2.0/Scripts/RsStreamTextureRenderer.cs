@@ -151,12 +151,12 @@ public class RsStreamTextureRenderer : MonoBehaviour
 
     }
 
-    bool HasTextureConflict(VideoFrame vf)
+    bool HasTextureConflict(FrameSnapshot vf)
     {
         return !texture ||
-            texture.width != vf.Width ||
-            texture.height != vf.Height ||
-            BPP(texture.format) != vf.BitsPerPixel;
+            texture.width != vf.width ||
+            texture.height != vf.height ||
+            BPP(texture.format) != vf.bitsPerPixel;
     }
 
     protected void LateUpdate()
@@ -172,27 +172,27 @@ public class RsStreamTextureRenderer : MonoBehaviour
 
     private void ProcessFrame(VideoFrame frame)
     {
-        if (HasTextureConflict(frame))
+        // One native call for everything below, instead of one per property
+        var snapshot = frame.Snapshot();
+        if (HasTextureConflict(snapshot))
         {
             if (texture != null)
             {
                 Destroy(texture);
             }
 
-            using (var p = frame.Profile) {
-                bool linear = (QualitySettings.activeColorSpace != ColorSpace.Linear)
-                    || (p.Stream != Stream.Color && p.Stream != Stream.Infrared);
-                texture = new Texture2D(frame.Width, frame.Height, Convert(p.Format), false, linear)
-                {
-                    wrapMode = TextureWrapMode.Clamp,
-                    filterMode = filterMode
-                };
-            }
+            bool linear = (QualitySettings.activeColorSpace != ColorSpace.Linear)
+                || (snapshot.stream != Stream.Color && snapshot.stream != Stream.Infrared);
+            texture = new Texture2D(snapshot.width, snapshot.height, Convert(snapshot.format), false, linear)
+            {
+                wrapMode = TextureWrapMode.Clamp,
+                filterMode = filterMode
+            };
 
             textureBinding.Invoke(texture);
         }
 
-        texture.LoadRawTextureData(frame.Data, frame.Stride * frame.Height);
+        texture.LoadRawTextureData(snapshot.data, snapshot.stride * snapshot.height);
         texture.Apply();
     }
 }
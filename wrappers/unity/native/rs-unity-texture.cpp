@@ -0,0 +1,417 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "rs-unity-texture.h"
+
+#include <librealsense2/rs.h>
+#include <librealsense2/h/rs_frame.h>
+
+#include <glad/glad.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+// Not in our glad (GL 3.3): GL 4.4 / ARB_buffer_storage, loaded when the context has it
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#endif
+typedef void( APIENTRYP buffer_storage_proc )( GLenum target, GLsizeiptr size, const void * data, GLbitfield flags );
+
+
+namespace {
+
+
+// Uploads still in flight when a frame comes in are not waited for: there are enough regions in the pixel buffer for
+// the GPU to be reading one while we write the next
+int const n_regions = 3;
+
+buffer_storage_proc gl_buffer_storage = nullptr;
+
+
+void * get_gl_proc( const char * name )
+{
+#ifdef _WIN32
+    // wglGetProcAddress only knows the functions past GL 1.1
+    auto proc = (void *)wglGetProcAddress( name );
+    if( proc == nullptr || proc == (void *)1 || proc == (void *)2 || proc == (void *)3 || proc == (void *)-1 )
+    {
+        static HMODULE opengl32 = LoadLibraryA( "opengl32.dll" );
+        proc = (void *)GetProcAddress( opengl32, name );
+    }
+    return proc;
+#else
+    return dlsym( RTLD_DEFAULT, name );
+#endif
+}
+
+
+// Called on the render thread, the only one with Unity's context current
+bool load_gl()
+{
+    static bool const loaded = [] {
+        if( ! gladLoadGLLoader( get_gl_proc ) || ! GLAD_GL_VERSION_3_2 )  // fences
+            return false;
+        gl_buffer_storage = (buffer_storage_proc)get_gl_proc( "glBufferStorage" );
+        return true;
+    }();
+    return loaded;
+}
+
+
+struct gl_format
+{
+    GLint internal_format;
+    GLenum format;
+    GLenum type;
+};
+
+
+bool get_gl_format( rs2_format format, gl_format & gl )
+{
+    switch( format )
+    {
+    case RS2_FORMAT_Z16:
+    case RS2_FORMAT_DISPARITY16:
+    case RS2_FORMAT_Y16:
+    case RS2_FORMAT_RAW16:
+        gl = { GL_R16, GL_RED, GL_UNSIGNED_SHORT };
+        return true;
+    case RS2_FORMAT_Y8:
+    case RS2_FORMAT_RAW8:
+        gl = { GL_R8, GL_RED, GL_UNSIGNED_BYTE };
+        return true;
+    case RS2_FORMAT_RGB8:
+        gl = { GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE };
+        return true;
+    case RS2_FORMAT_BGR8:
+        gl = { GL_RGB8, GL_BGR, GL_UNSIGNED_BYTE };
+        return true;
+    case RS2_FORMAT_RGBA8:
+        gl = { GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE };
+        return true;
+    case RS2_FORMAT_BGRA8:
+        gl = { GL_RGBA8, GL_BGRA, GL_UNSIGNED_BYTE };
+        return true;
+    case RS2_FORMAT_DISPARITY32:
+        gl = { GL_R32F, GL_RED, GL_FLOAT };
+        return true;
+    default:
+        return false;
+    }
+}
+
+
+// The texture of one stream: frames are set from any thread, and uploaded on the render thread
+class stream_texture
+{
+    std::mutex _mutex;
+    rs2_frame * _pending = nullptr;  // the latest frame, not yet uploaded
+    GLuint _published = 0;           // what the managed side gets, with its size and format
+    int _width = 0, _height = 0;
+    rs2_format _format = RS2_FORMAT_ANY;
+
+    // Render thread only
+    GLuint _texture = 0;
+    GLuint _pbo = 0;
+    size_t _region_size = 0;
+    uint8_t * _mapped = nullptr;  // the whole buffer, when it is persistently mapped
+    GLsync _fences[n_regions] = {};
+    int _next = 0;
+
+public:
+    ~stream_texture()
+    {
+        if( _pending )
+            rs2_release_frame( _pending );
+    }
+
+    void set_frame( rs2_frame * frame )
+    {
+        rs2_error * e = nullptr;
+        rs2_frame_add_ref( frame, &e );
+        if( e )
+        {
+            rs2_free_error( e );
+            return;
+        }
+        rs2_frame * previous;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            previous = _pending;
+            _pending = frame;
+        }
+        if( previous )
+            rs2_release_frame( previous );  // never uploaded: the render thread fell behind
+    }
+
+    GLuint get( int * width, int * height, int * format )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( width )
+            *width = _width;
+        if( height )
+            *height = _height;
+        if( format )
+            *format = _format;
+        return _published;
+    }
+
+    void render()
+    {
+        rs2_frame * frame;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            frame = _pending;
+            _pending = nullptr;
+        }
+        if( ! frame )
+            return;
+        upload( frame );
+        rs2_release_frame( frame );
+    }
+
+    void release_gl()
+    {
+        release_buffer();
+        if( _texture )
+        {
+            glDeleteTextures( 1, &_texture );
+            _texture = 0;
+        }
+        std::lock_guard< std::mutex > lock( _mutex );
+        _published = 0;
+    }
+
+private:
+    void upload( rs2_frame * frame )
+    {
+        rs2_error * e = nullptr;
+        auto const width = rs2_get_frame_width( frame, &e );
+        auto const height = e ? 0 : rs2_get_frame_height( frame, &e );
+        auto const stride = e ? 0 : rs2_get_frame_stride_in_bytes( frame, &e );
+        auto const bpp = e ? 0 : rs2_get_frame_bits_per_pixel( frame, &e ) / 8;
+        auto const pixels = e ? nullptr : static_cast< const uint8_t * >( rs2_get_frame_data( frame, &e ) );
+        auto const profile = e ? nullptr : rs2_get_frame_stream_profile( frame, &e );
+        rs2_stream stream;
+        rs2_format format = RS2_FORMAT_ANY;
+        int index, uid, fps;
+        if( ! e )
+            rs2_get_stream_profile_data( profile, &stream, &format, &index, &uid, &fps, &e );
+        if( e )
+        {
+            rs2_free_error( e );  // not a video frame
+            return;
+        }
+        gl_format gl;
+        if( ! pixels || width <= 0 || height <= 0 || bpp <= 0 || ! get_gl_format( format, gl ) )
+            return;
+
+        GLint bound_texture = 0, bound_buffer = 0;
+        glGetIntegerv( GL_TEXTURE_BINDING_2D, &bound_texture );
+        glGetIntegerv( GL_PIXEL_UNPACK_BUFFER_BINDING, &bound_buffer );
+
+        // Textures are only made again when the size or format changes: the managed side has to pick up the new one
+        if( ! _texture || width != _width || height != _height || format != _format )
+        {
+            if( _texture )
+                glDeleteTextures( 1, &_texture );
+            glGenTextures( 1, &_texture );
+            glBindTexture( GL_TEXTURE_2D, _texture );
+            glTexImage2D( GL_TEXTURE_2D, 0, gl.internal_format, width, height, 0, gl.format, gl.type, nullptr );
+            glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+            glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+            glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+            glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+            std::lock_guard< std::mutex > lock( _mutex );
+            _published = _texture;
+            _width = width;
+            _height = height;
+            _format = format;
+        }
+
+        size_t const size = size_t( stride ) * height;
+        auto const offset = stage( pixels, size );
+
+        glBindTexture( GL_TEXTURE_2D, _texture );
+        glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+        glPixelStorei( GL_UNPACK_ROW_LENGTH, stride % bpp ? 0 : stride / bpp );
+        if( offset >= 0 )
+        {
+            glTexSubImage2D( GL_TEXTURE_2D, 0, 0, 0, width, height, gl.format, gl.type,
+                             reinterpret_cast< void * >( offset ) );
+            _fences[_next] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+            _next = ( _next + 1 ) % n_regions;
+        }
+        else
+        {
+            glBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+            glTexSubImage2D( GL_TEXTURE_2D, 0, 0, 0, width, height, gl.format, gl.type, pixels );
+        }
+        glPixelStorei( GL_UNPACK_ROW_LENGTH, 0 );
+        glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+
+        glBindBuffer( GL_PIXEL_UNPACK_BUFFER, bound_buffer );
+        glBindTexture( GL_TEXTURE_2D, bound_texture );
+    }
+
+    // Copies the pixels into the next region of the pixel buffer, left bound, and returns the offset of the region, or
+    // -1 if they could not be staged (and have to be uploaded directly)
+    ptrdiff_t stage( const uint8_t * pixels, size_t size )
+    {
+        if( size > _region_size )
+        {
+            release_buffer();
+            _region_size = ( size + 255 ) & ~size_t( 255 );
+            glGenBuffers( 1, &_pbo );
+            glBindBuffer( GL_PIXEL_UNPACK_BUFFER, _pbo );
+            if( gl_buffer_storage )
+            {
+                GLbitfield const flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                gl_buffer_storage( GL_PIXEL_UNPACK_BUFFER, _region_size * n_regions, nullptr, flags );
+                _mapped = static_cast< uint8_t * >(
+                    glMapBufferRange( GL_PIXEL_UNPACK_BUFFER, 0, _region_size * n_regions, flags ) );
+            }
+            if( ! _mapped )
+                glBufferData( GL_PIXEL_UNPACK_BUFFER, _region_size * n_regions, nullptr, GL_STREAM_DRAW );
+        }
+        else
+            glBindBuffer( GL_PIXEL_UNPACK_BUFFER, _pbo );
+
+        // The region was last uploaded from n_regions frames ago, and is normally long done with
+        auto & fence = _fences[_next];
+        if( fence )
+        {
+            glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, 100 * 1000 * 1000 );
+            glDeleteSync( fence );
+            fence = nullptr;
+        }
+
+        auto const offset = _region_size * _next;
+        if( _mapped )
+        {
+            memcpy( _mapped + offset, pixels, size );
+            return ptrdiff_t( offset );
+        }
+        // No persistent mapping (before GL 4.4): map the region for each frame; the fence above already synchronized
+        auto const flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+        if( auto staging = glMapBufferRange( GL_PIXEL_UNPACK_BUFFER, offset, size, flags ) )
+        {
+            memcpy( staging, pixels, size );
+            // Unmapping fails when the contents were lost (e.g., on a mode switch)
+            if( glUnmapBuffer( GL_PIXEL_UNPACK_BUFFER ) )
+                return ptrdiff_t( offset );
+        }
+        return -1;
+    }
+
+    void release_buffer()
+    {
+        for( auto & fence : _fences )
+            if( fence )
+            {
+                glDeleteSync( fence );
+                fence = nullptr;
+            }
+        if( ! _pbo )
+            return;
+        if( _mapped )
+        {
+            glBindBuffer( GL_PIXEL_UNPACK_BUFFER, _pbo );
+            glUnmapBuffer( GL_PIXEL_UNPACK_BUFFER );
+            _mapped = nullptr;
+        }
+        glDeleteBuffers( 1, &_pbo );
+        _pbo = 0;
+        _region_size = 0;
+    }
+};
+
+
+std::mutex textures_mutex;
+std::map< int, std::shared_ptr< stream_texture > > textures;
+std::vector< std::shared_ptr< stream_texture > > destroyed;  // their GL objects are deleted on the render thread
+int last_id = 0;
+
+
+std::shared_ptr< stream_texture > find( int id )
+{
+    std::lock_guard< std::mutex > lock( textures_mutex );
+    auto it = textures.find( id );
+    return it == textures.end() ? nullptr : it->second;
+}
+
+
+void UNITY_INTERFACE_API on_render_event( int id )
+{
+    if( ! load_gl() )
+        return;
+
+    std::vector< std::shared_ptr< stream_texture > > to_release;
+    {
+        std::lock_guard< std::mutex > lock( textures_mutex );
+        std::swap( to_release, destroyed );
+    }
+    for( auto & t : to_release )
+        t->release_gl();
+
+    if( auto t = find( id ) )
+        t->render();
+}
+
+
+}  // namespace
+
+
+int rs2_unity_create_texture()
+{
+    std::lock_guard< std::mutex > lock( textures_mutex );
+    auto const id = ++last_id;
+    textures[id] = std::make_shared< stream_texture >();
+    return id;
+}
+
+
+void rs2_unity_destroy_texture( int id )
+{
+    std::lock_guard< std::mutex > lock( textures_mutex );
+    auto it = textures.find( id );
+    if( it == textures.end() )
+        return;
+    destroyed.push_back( it->second );
+    textures.erase( it );
+}
+
+
+void rs2_unity_set_frame( int id, rs2_frame * frame )
+{
+    if( ! frame )
+        return;
+    if( auto t = find( id ) )
+        t->set_frame( frame );
+}
+
+
+unsigned int rs2_unity_get_texture( int id, int * width, int * height, int * format )
+{
+    if( auto t = find( id ) )
+        return t->get( width, height, format );
+    return 0;
+}
+
+
+unity_rendering_event rs2_unity_get_render_event_func()
+{
+    return on_render_event;
+}
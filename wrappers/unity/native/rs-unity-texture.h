@@ -0,0 +1,41 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+// Unity native rendering plugin: frames are handed over from any thread, and uploaded to OpenGL textures on Unity's
+// render thread, through GL.IssuePluginEvent( rs2_unity_get_render_event_func(), id ). Managed code never touches the
+// pixels: it only gets the GL name of the texture, for Texture2D.CreateExternalTexture().
+//
+// Requires Unity's OpenGL Core renderer. Pixels are staged in a pixel buffer of a few regions, persistently mapped when
+// the context has GL 4.4 (or ARB_buffer_storage), so the copy to the GPU is done by the driver while earlier frames are
+// still being rendered.
+//
+// Usage, from C#:
+//     id = rs2_unity_create_texture();
+//     rs2_unity_set_frame( id, frame.Handle );           // on the frame callback's thread; the frame can be disposed
+//     GL.IssuePluginEvent( rs2_unity_get_render_event_func(), id );   // every frame, e.g. in LateUpdate()
+//     name = rs2_unity_get_texture( id, out w, out h, out format );  // 0 until the first upload; changes with w/h/format
+//     rs2_unity_destroy_texture( id );
+
+#ifdef _WIN32
+#define UNITY_INTERFACE_API __stdcall
+#define RS2_UNITY_EXPORT extern "C" __declspec( dllexport )
+#else
+#define UNITY_INTERFACE_API
+#define RS2_UNITY_EXPORT extern "C" __attribute__( ( visibility( "default" ) ) )
+#endif
+
+struct rs2_frame;
+
+typedef void( UNITY_INTERFACE_API * unity_rendering_event )( int event_id );
+
+RS2_UNITY_EXPORT int rs2_unity_create_texture();
+// Its GL objects are deleted on the next render event
+RS2_UNITY_EXPORT void rs2_unity_destroy_texture( int id );
+// Keeps a reference to the frame until it is uploaded; a frame that is not uploaded before the next comes in is dropped
+RS2_UNITY_EXPORT void rs2_unity_set_frame( int id, rs2_frame * frame );
+// The GL name of the texture, and its size and rs2_format; 0 until a frame was uploaded
+RS2_UNITY_EXPORT unsigned int rs2_unity_get_texture( int id, int * width, int * height, int * format );
+// For GL.IssuePluginEvent(), with the id of the texture to upload the latest frame of
+RS2_UNITY_EXPORT unity_rendering_event rs2_unity_get_render_event_func();
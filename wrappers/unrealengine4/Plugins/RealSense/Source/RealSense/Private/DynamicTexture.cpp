@@ -83,18 +83,24 @@ FTextureUpdateData* FDynamicTexture::AllocBuffer()
 	return Tud;
 }
 
-void FDynamicTexture::EnqueUpdateCommand(FTextureUpdateData* Tud)
+bool FDynamicTexture::CanEnqueue() const
 {
-	SCOPED_PROFILER;
-
 	// UE4 is so great!
 	const bool HackIsValidThread = (!GIsThreadedRendering || ENamedThreads::GetRenderThread() != ENamedThreads::GameThread);
 
 	if (!HackIsValidThread)
 	{
 		REALSENSE_ERR(TEXT("EnqueUpdateCommand: invalid thread"));
+		return false;
 	}
-	else if (TextureObject && TextureObject->Resource)
+	return TextureObject && TextureObject->Resource;
+}
+
+void FDynamicTexture::EnqueUpdateCommand(FTextureUpdateData* Tud)
+{
+	SCOPED_PROFILER;
+
+	if (CanEnqueue())
 	{
 		CommandCounter.Increment();
 		ENQUEUE_RENDER_COMMAND(UpdateTextureCmd)(
@@ -120,9 +126,16 @@ void FDynamicTexture::Update(const rs2::video_frame& Frame)
 		return;
 	}
 
-	auto* Tud = AllocBuffer();
-	CopyData(Tud, Frame);
-	EnqueUpdateCommand(Tud);
+	// The render thread uploads straight from the frame, which it keeps until then: no copy is made on this thread
+	if (CanEnqueue())
+	{
+		CommandCounter.Increment();
+		ENQUEUE_RENDER_COMMAND(UpdateTextureFromFrameCmd)(
+			[this, Frame](FRHICommandListImmediate& RHICmdList)
+			{
+				this->RenderCmd_UpdateTexture(Frame);
+			});
+	}
 }
 
 void FDynamicTexture::CopyData(FTextureUpdateData* Tud, const rs2::video_frame& Frame)
@@ -198,3 +211,22 @@ void FDynamicTexture::RenderCmd_UpdateTexture(FTextureUpdateData* Tud)
 
 	CommandCounter.Decrement();
 }
+
+void FDynamicTexture::RenderCmd_UpdateTexture(const rs2::video_frame& Frame)
+{
+	SCOPED_PROFILER;
+
+	auto Tex = TextureObject;
+	if (Tex && Tex->Resource)
+	{
+		RHIUpdateTexture2D(
+			((FTexture2DResource*)Tex->Resource)->GetTexture2DRHI(), 
+			0, 
+			FUpdateTextureRegion2D(0, 0, 0, 0, Width, Height), 
+			Frame.get_stride_in_bytes(), 
+			(const uint8*)Frame.get_data()
+		);
+	}
+
+	CommandCounter.Decrement();
+}
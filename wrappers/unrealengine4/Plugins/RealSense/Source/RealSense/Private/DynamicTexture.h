@@ -35,6 +35,8 @@ private:
 
 	void RenderCmd_CreateTexture();
 	void RenderCmd_UpdateTexture(FTextureUpdateData* Tud);
+	void RenderCmd_UpdateTexture(const rs2::video_frame& Frame);
+	bool CanEnqueue() const;
 
 public:
 
@@ -44,6 +46,7 @@ public:
 	FTextureUpdateData* AllocBuffer();
 	void EnqueUpdateCommand(FTextureUpdateData* Tud);
 
+	// Uploads the frame on the render thread, from the frame's own memory
 	void Update(const rs2::video_frame& Frame);
 	void CopyData(FTextureUpdateData* Tud, const rs2::video_frame& Frame);
 